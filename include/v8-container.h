@@ -11,6 +11,7 @@
 #include <functional>
 
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-memory-span.h"   // NOLINT(build/include_directory)
 #include "v8-object.h"        // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
@@ -38,6 +39,30 @@ class V8_EXPORT Array : public Object {
    */
   static Local<Array> New(Isolate* isolate, Local<Value>* elements,
                           size_t length);
+
+  /**
+   * Creates a JavaScript array of numbers out of a C++ array of doubles. The
+   * elements are copied into a single unboxed backing store, without
+   * allocating a handle per element.
+   */
+  static Local<Array> New(Isolate* isolate, MemorySpan<const double> elements);
+
+  /**
+   * Creates a JavaScript array of numbers out of a C++ array of 32-bit
+   * integers. The elements are copied into a single backing store, without
+   * allocating a handle per element.
+   */
+  static Local<Array> New(Isolate* isolate, MemorySpan<const int32_t> elements);
+
+  /**
+   * Creates a JavaScript array of strings out of |length| UTF-8 encoded C++
+   * strings. |lengths| holds the length in bytes of each string; if it is
+   * nullptr, or an entry is -1, the corresponding string must be
+   * null-terminated. Returns an empty MaybeLocal if any string exceeds the
+   * maximum string length.
+   */
+  static MaybeLocal<Array> New(Isolate* isolate, const char* const* data,
+                               const int* lengths, size_t length);
   V8_INLINE static Array* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(value);
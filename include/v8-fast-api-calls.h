@@ -250,6 +250,7 @@ class CTypeInfo {
     kPointer,
     kV8Value,
     kSeqOneByteString,
+    kSeqTwoByteString,
     kApiObject,  // This will be deprecated once all users have
                  // migrated from v8::ApiObject to v8::Local<v8::Value>.
     kAny,        // This is added to enable untyped representation of fast
@@ -387,6 +388,13 @@ struct FastOneByteString {
   uint32_t length;
 };
 
+// A flat two-byte string, passed without copying its characters. {length} is
+// the number of UTF-16 code units.
+struct FastTwoByteString {
+  const uint16_t* data;
+  uint32_t length;
+};
+
 class V8_EXPORT CFunctionInfo {
  public:
   enum class Int64Representation : uint8_t {
@@ -466,6 +474,7 @@ union V8_TRIVIAL_ABI AnyCType {
   const FastApiTypedArray<float>* float_ta_value;
   const FastApiTypedArray<double>* double_ta_value;
   const FastOneByteString* string_value;
+  const FastTwoByteString* two_byte_string_value;
   FastApiCallbackOptions* options_value;
 };
 
@@ -782,6 +791,18 @@ struct TypeInfoHelper<const FastOneByteString&> {
   }
 };
 
+template <>
+struct TypeInfoHelper<const FastTwoByteString&> {
+  static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
+
+  static constexpr CTypeInfo::Type Type() {
+    return CTypeInfo::Type::kSeqTwoByteString;
+  }
+  static constexpr CTypeInfo::SequenceType SequenceType() {
+    return CTypeInfo::SequenceType::kScalar;
+  }
+};
+
 #define STATIC_ASSERT_IMPLIES(COND, ASSERTION, MSG) \
   static_assert(((COND) == 0) || (ASSERTION), MSG)
 
@@ -8,6 +8,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <memory>
+
 #include "v8-function-callback.h"  // NOLINT(build/include_directory)
 #include "v8-local-handle.h"       // NOLINT(build/include_directory)
 #include "v8-message.h"            // NOLINT(build/include_directory)
@@ -135,6 +137,51 @@ class V8_EXPORT Function : public Object {
   Function();
   static void CheckCast(Value* obj);
 };
+
+/**
+ * A call to a fixed JavaScript function that is repeated many times from C++,
+ * e.g. by an event dispatcher.
+ *
+ * The target is validated once, when the PreparedFunctionCall is created, and
+ * the argument buffer is allocated once and reused for every call. Compared to
+ * Function::Call, a prepared call neither allocates per call nor records the
+ * call in the V8.Execute histogram and timer events.
+ *
+ * Arguments are Locals and thus only valid within the HandleScope they were
+ * created in; all of them need to be set again before each call made in a
+ * different HandleScope.
+ */
+class V8_EXPORT PreparedFunctionCall final {
+ public:
+  /**
+   * Prepares calls to |function| with |argc| arguments. |function| must be a
+   * plain JavaScript function, i.e., neither bound, nor a proxy, nor a class
+   * constructor.
+   */
+  PreparedFunctionCall(Isolate* isolate, Local<Function> function, int argc);
+  ~PreparedFunctionCall();
+
+  PreparedFunctionCall(const PreparedFunctionCall&) = delete;
+  PreparedFunctionCall& operator=(const PreparedFunctionCall&) = delete;
+
+  int argc() const;
+
+  /**
+   * Sets the argument at |index| for subsequent calls.
+   */
+  void SetArgument(int index, Local<Value> value);
+
+  /**
+   * Calls the function with |recv| as receiver and the arguments set through
+   * SetArgument().
+   */
+  V8_WARN_UNUSED_RESULT MaybeLocal<Value> Call(Local<Context> context,
+                                               Local<Value> recv);
+
+ private:
+  struct Data;
+  std::unique_ptr<Data> data_;
+};
 }  // namespace v8
 
 #endif  // INCLUDE_V8_FUNCTION_H_
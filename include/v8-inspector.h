@@ -206,6 +206,12 @@ class V8_EXPORT V8InspectorSession {
   virtual void releaseObjectGroup(StringView) = 0;
   virtual void triggerPreciseCoverageDeltaUpdate(StringView occasion) = 0;
 
+  // Caps the number of properties generated for the previews of all
+  // arguments of a single console message. Arguments beyond the budget are
+  // reported without preview; their properties can still be requested lazily
+  // through their object ids. A negative value, the default, removes the cap.
+  virtual void setConsolePreviewBudget(int maxPreviewProperties) = 0;
+
   struct V8_EXPORT EvaluateResult {
     enum class ResultType {
       kNotRun,
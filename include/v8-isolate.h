@@ -830,6 +830,11 @@ class V8_EXPORT Isolate {
   /**
    * Get statistics about objects in the heap.
    *
+   * Statistics are only available when GC object stats tracking is enabled.
+   * With --track-gc-instance-type-stats, counts and sizes per instance type
+   * are gathered during marking at negligible cost; virtual sub-types are
+   * then reported as empty.
+   *
    * \param object_statistics The HeapObjectStatistics object to fill in
    *   statistics of objects of given type, which were live in the previous GC.
    * \param type_index The index of the type of object to fill details about,
@@ -1187,6 +1192,26 @@ class V8_EXPORT Isolate {
    */
   void CancelTerminateExecution();
 
+  /**
+   * Terminates the current thread of JavaScript execution in this isolate, as
+   * if by TerminateExecution(), once |timeout_in_ms| milliseconds have passed.
+   * Replaces any deadline that was set before. Until it expires, the deadline
+   * doesn't slow down running code, since it is enforced from a delayed task
+   * on a worker thread.
+   *
+   * Must be called from the thread that owns the isolate.
+   */
+  void SetExecutionDeadline(double timeout_in_ms);
+
+  /**
+   * Clears a deadline set with SetExecutionDeadline(). A deadline that is
+   * expiring concurrently may still terminate execution, which is then
+   * handled like any other TerminateExecution() call.
+   *
+   * Must be called from the thread that owns the isolate.
+   */
+  void ClearExecutionDeadline();
+
   /**
    * Request V8 to interrupt long running JavaScript code and invoke
    * the given |callback| passing the given |data| to it. After |callback|
@@ -5,6 +5,11 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
@@ -14,6 +19,10 @@ class Context;
 class Value;
 class String;
 
+namespace internal {
+class JsonStreamingData;
+}  // namespace internal
+
 /**
  * A JSON Parser and Stringifier.
  */
@@ -40,6 +49,43 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Collects a JSON text that arrives in chunks, e.g. from the network, and
+   * parses it once the last chunk has been received. The chunks are appended
+   * to a single buffer which directly backs the source string of the parse,
+   * so that the chunks neither need to be concatenated into a string by the
+   * embedder nor flattened into another copy by V8.
+   */
+  class V8_EXPORT StreamingParser {
+   public:
+    StreamingParser();
+    ~StreamingParser();
+
+    StreamingParser(const StreamingParser&) = delete;
+    StreamingParser& operator=(const StreamingParser&) = delete;
+
+    /**
+     * Appends a chunk of Latin-1 characters.
+     */
+    void Append(const uint8_t* data, size_t length);
+
+    /**
+     * Appends a chunk of UTF-16 code units. The first two-byte chunk widens
+     * all previously appended one-byte chunks.
+     */
+    void Append(const uint16_t* data, size_t length);
+
+    /**
+     * Parses all chunks appended so far in |context| and returns the
+     * resulting value if successful. Afterwards the parser is empty and may
+     * be reused for another JSON text.
+     */
+    V8_WARN_UNUSED_RESULT MaybeLocal<Value> Finish(Local<Context> context);
+
+   private:
+    std::unique_ptr<internal::JsonStreamingData> impl_;
+  };
 };
 
 }  // namespace v8
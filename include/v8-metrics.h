@@ -80,10 +80,26 @@ using GarbageCollectionFullMainThreadBatchedIncrementalSweep =
     GarbageCollectionBatchedEvents<
         GarbageCollectionFullMainThreadIncrementalSweep>;
 
+// Main-thread breakdown of a young generation cycle. Phases that don't apply
+// to the collector that ran (e.g. sweeping for the scavenger) are left at -1.
+struct GarbageCollectionYoungPhases {
+  // Visiting the roots.
+  int64_t roots_wall_clock_duration_in_us = -1;
+  // Copying (scavenger) or marking (minor mark-sweeper) live objects,
+  // including the time the main thread waits for parallel tasks.
+  int64_t copy_or_mark_wall_clock_duration_in_us = -1;
+  // Processing weak global handles and other weak references.
+  int64_t weak_wall_clock_duration_in_us = -1;
+  // Updating references to moved objects.
+  int64_t update_references_wall_clock_duration_in_us = -1;
+  int64_t sweep_wall_clock_duration_in_us = -1;
+};
+
 struct GarbageCollectionYoungCycle {
   int reason = -1;
   int64_t total_wall_clock_duration_in_us = -1;
   int64_t main_thread_wall_clock_duration_in_us = -1;
+  GarbageCollectionYoungPhases main_thread_phases;
   double collection_rate_in_percent = -1.0;
   double efficiency_in_bytes_per_us = -1.0;
   double main_thread_efficiency_in_bytes_per_us = -1.0;
@@ -156,6 +172,39 @@ struct WasmModulesPerIsolate {
   size_t count = 0;
 };
 
+/**
+ * Reported when optimized code for a JavaScript function has been installed.
+ * The function is identified by its script id and the start position of the
+ * function in the script source.
+ */
+struct JavaScriptOptimization {
+  int script_id = -1;
+  int function_start_position = -1;
+  // True for Maglev code, false for Turbofan code.
+  bool maglev = false;
+  // True if the code was compiled for on-stack replacement.
+  bool osr = false;
+  int64_t wall_clock_duration_in_us = -1;
+};
+
+/**
+ * Reported when execution of optimized code for a JavaScript function bails
+ * out to the interpreter or baseline code.
+ */
+struct JavaScriptDeoptimization {
+  int script_id = -1;
+  int function_start_position = -1;
+  // Bytecode offset at which execution continues in the outermost frame.
+  int bytecode_offset = -1;
+  // Static string naming the reason, e.g. "wrong map". Never freed.
+  const char* reason = nullptr;
+  // True for lazy deoptimizations, i.e. when the code was invalidated while
+  // a call from it was in progress.
+  bool lazy = false;
+  // True if the deoptimized code was Maglev code.
+  bool maglev = false;
+};
+
 /**
  * This class serves as a base class for recording event-based metrics in V8.
  * There a two kinds of metrics, those which are expected to be thread-safe and
@@ -208,6 +257,8 @@ class V8_EXPORT Recorder {
   ADD_MAIN_THREAD_EVENT(WasmModuleDecoded)
   ADD_MAIN_THREAD_EVENT(WasmModuleCompiled)
   ADD_MAIN_THREAD_EVENT(WasmModuleInstantiated)
+  ADD_MAIN_THREAD_EVENT(JavaScriptOptimization)
+  ADD_MAIN_THREAD_EVENT(JavaScriptDeoptimization)
 #undef ADD_MAIN_THREAD_EVENT
 
   // Thread-safe events are not allowed to access the context and therefore do
@@ -5,6 +5,8 @@
 #ifndef INCLUDE_V8_PRIMITIVE_H_
 #define INCLUDE_V8_PRIMITIVE_H_
 
+#include <memory>
+
 #include "v8-data.h"          // NOLINT(build/include_directory)
 #include "v8-internal.h"      // NOLINT(build/include_directory)
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
@@ -377,6 +379,28 @@ class V8_EXPORT String : public Name {
     const char* cached_data_ = nullptr;
   };
 
+  /**
+   * A region of immutable character data outside of V8's heap, e.g. a
+   * memory-mapped file, that backs many external strings at once.
+   *
+   * Strings created from a region do not own a resource of their own: V8 keeps
+   * a single reference to the region per isolate for as long as any of its
+   * strings is alive, and disposing such a string merely recycles a
+   * lightweight slice descriptor. The region is released by dropping the last
+   * std::shared_ptr to it, so the embedder unmaps the memory in the
+   * destructor.
+   */
+  class V8_EXPORT ExternalStringRegion {
+   public:
+    virtual ~ExternalStringRegion() = default;
+
+    /** The start of the region. Must be stable for the region's lifetime. */
+    virtual const void* data() const = 0;
+
+    /** The size of the region in bytes. */
+    virtual size_t byte_length() const = 0;
+  };
+
   /**
    * If the string is an external string, return the ExternalStringResourceBase
    * regardless of the encoding, otherwise return NULL.  The encoding of the
@@ -490,6 +514,25 @@ class V8_EXPORT String : public Name {
    */
   bool MakeExternal(ExternalOneByteStringResource* resource);
 
+  /**
+   * Creates a new external string from |length| Latin-1 characters starting at
+   * |byte_offset| within |region|. No per-string resource has to be allocated
+   * or disposed by the embedder; see ExternalStringRegion. The resulting
+   * string can be internalized in place, without copying its characters.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalOneByte(
+      Isolate* isolate, const std::shared_ptr<ExternalStringRegion>& region,
+      size_t byte_offset, size_t length);
+
+  /**
+   * Creates a new external string from |length| two-byte characters starting
+   * at |byte_offset| within |region|. |byte_offset| must be two-byte aligned.
+   * See NewExternalOneByte() above.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalTwoByte(
+      Isolate* isolate, const std::shared_ptr<ExternalStringRegion>& region,
+      size_t byte_offset, size_t length);
+
   /**
    * Returns true if this string can be made external, given the encoding for
    * the external string resource.
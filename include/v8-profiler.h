@@ -8,6 +8,7 @@
 #include <limits.h>
 
 #include <memory>
+#include <string>
 #include <unordered_set>
 #include <vector>
 
@@ -628,6 +629,18 @@ class V8_EXPORT HeapGraphNode {
 /**
  * HeapSnapshots record the state of the JS heap at some moment.
  */
+/**
+ * Difference in the objects of one class between two heap snapshots, see
+ * HeapSnapshot::DiffByClassName.
+ */
+struct V8_EXPORT HeapSnapshotClassDelta {
+  std::string class_name;
+  size_t added_count = 0;
+  size_t removed_count = 0;
+  size_t added_size = 0;
+  size_t removed_size = 0;
+};
+
 class V8_EXPORT HeapSnapshot {
  public:
   enum SerializationFormat {
@@ -649,6 +662,20 @@ class V8_EXPORT HeapSnapshot {
   /** Returns a max seen JS object Id. */
   SnapshotObjectId GetMaxSnapshotJSObjectId() const;
 
+  /**
+   * Returns, for every class whose objects differ, the objects added since
+   * |base| and the objects of |base| that are gone. Objects are matched by
+   * their snapshot object ids, so both snapshots must come from the same
+   * HeapProfiler. Objects and native nodes are grouped by their name, all
+   * other nodes by their type, e.g. "(string)", like in the DevTools summary
+   * view. The result is sorted by class name.
+   *
+   * Only the snapshots are read, not the heap, so this may be called from any
+   * thread as long as neither snapshot is deleted meanwhile.
+   */
+  std::vector<HeapSnapshotClassDelta> DiffByClassName(
+      const HeapSnapshot* base) const;
+
   /**
    * Deletes the snapshot and removes it from HeapProfiler's list.
    * All pointers to nodes, edges and paths previously returned become
@@ -804,6 +831,21 @@ class V8_EXPORT AllocationProfile {
      * what samples were added or removed between two snapshots.
      */
     uint64_t sample_id;
+
+    /**
+     * Number of garbage collections the sampled object has survived. For
+     * objects that were already collected but kept in the profile (see
+     * `kSamplingIncludeObjectsCollectedByMajorGC` and
+     * `kSamplingIncludeObjectsCollectedByMinorGC`), this is the number of
+     * garbage collections survived before the one that collected it.
+     */
+    unsigned int survived_gc_count = 0;
+
+    /**
+     * Time of the allocation in milliseconds, as returned by
+     * `v8::Platform::MonotonicallyIncreasingTime()` scaled to milliseconds.
+     */
+    double allocation_time_ms = 0;
   };
 
   /**
@@ -590,6 +590,37 @@ class V8_EXPORT ScriptCompiler {
    public:
     void Run();
 
+    /**
+     * Provides the full source text string and origin information to the
+     * streaming task, once the embedder has it. May be called before, during,
+     * or after Run(). This step checks whether the script matches an existing
+     * script in the Isolate's compilation cache. To check whether such a script
+     * was found, call ShouldMergeWithExistingScript.
+     *
+     * The Isolate provided must be the same one used during StartStreaming and
+     * must be currently entered on the thread that calls this function. The
+     * source text and origin provided in this step must precisely match those
+     * used later in ScriptCompiler::Compile for the same StreamedSource.
+     */
+    void SourceTextAvailable(Isolate* isolate, Local<String> source_text,
+                             const ScriptOrigin& origin);
+
+    /**
+     * Returns whether the embedder should call MergeWithExistingScript. This
+     * function may be called from any thread, any number of times, but its
+     * return value is only meaningful after both Run() and SourceTextAvailable
+     * have completed.
+     */
+    bool ShouldMergeWithExistingScript() const;
+
+    /**
+     * Merges the newly compiled script into an existing script which was found
+     * during SourceTextAvailable, so that less work remains for
+     * ScriptCompiler::Compile on the main thread. May be called only after
+     * Run() has completed. Can execute on any thread, like Run().
+     */
+    void MergeWithExistingScript();
+
    private:
     friend class ScriptCompiler;
 
@@ -788,6 +819,34 @@ class V8_EXPORT ScriptCompiler {
       Local<Context> context, StreamedSource* v8_source,
       Local<String> full_source_string, const ScriptOrigin& origin);
 
+  /**
+   * A module passed to CompileModuleGraph. The UTF-8 encoded source text is
+   * not owned and has to stay alive until CompileModuleGraph returns.
+   */
+  struct ModuleGraphEntry {
+    /**
+     * The specifier under which the other modules of the graph import this
+     * module. It is also used as the resource name of the module's script.
+     */
+    Local<String> specifier;
+    const char* utf8_source;
+    size_t utf8_length;
+  };
+
+  /**
+   * Compiles all modules of a module graph in parallel on worker threads and
+   * then links them in one pass, starting from the first module in
+   * |modules|.
+   *
+   * Import specifiers are matched verbatim against the specifiers of the
+   * entries, so the embedder has to resolve them to that form up front.
+   * Returns the first module, which is instantiated on success. Returns an
+   * empty handle with a pending exception if a module fails to compile or an
+   * import cannot be resolved.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Module> CompileModuleGraph(
+      Local<Context> context, MemorySpan<const ModuleGraphEntry> modules);
+
   /**
    * Compile a function for a given context. This is equivalent to running
    *
@@ -179,6 +179,15 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_native_contexts() { return number_of_native_contexts_; }
   size_t number_of_detached_contexts() { return number_of_detached_contexts_; }
 
+  /**
+   * Returns the number of maps (hidden classes), and of deprecated maps, that
+   * were live after the last full garbage collection. A large or growing
+   * number of deprecated maps hints at objects whose property representations
+   * keep changing.
+   */
+  size_t number_of_maps() { return number_of_maps_; }
+  size_t number_of_deprecated_maps() { return number_of_deprecated_maps_; }
+
   /**
    * Returns a 0/1 boolean, which signifies whether the V8 overwrite heap
    * garbage with a bit pattern.
@@ -198,6 +207,8 @@ class V8_EXPORT HeapStatistics {
   bool does_zap_garbage_;
   size_t number_of_native_contexts_;
   size_t number_of_detached_contexts_;
+  size_t number_of_maps_;
+  size_t number_of_deprecated_maps_;
   size_t total_global_handles_size_;
   size_t used_global_handles_size_;
 
@@ -15,6 +15,7 @@
 namespace v8 {
 
 class CFunction;
+class DictionaryTemplate;
 class FunctionTemplate;
 class ObjectTemplate;
 class Signature;
@@ -950,6 +951,41 @@ class V8_EXPORT ObjectTemplate : public Template {
   friend class FunctionTemplate;
 };
 
+/**
+ * A template to create dictionary-like objects with a fixed set of data
+ * properties.
+ *
+ * In contrast to v8::Object::New(), which creates objects in dictionary mode,
+ * instances created from a DictionaryTemplate share a fast-mode map that is
+ * resolved from the property names once and reused for later instantiations
+ * in the same context. This is intended for embedders that repeatedly create
+ * objects of the same shape, e.g. records returned from native code.
+ */
+class V8_EXPORT DictionaryTemplate final : public Data {
+ public:
+  /**
+   * Creates a template for objects with the given property names. The names
+   * must be unique.
+   */
+  static Local<DictionaryTemplate> New(Isolate* isolate, Local<Name>* names,
+                                       size_t length);
+
+  /**
+   * Creates a new instance of this template in the given context. The
+   * properties are initialized with |values|, which must contain exactly one
+   * value per name, in the order the names were passed to New().
+   */
+  V8_WARN_UNUSED_RESULT MaybeLocal<Object> NewInstance(Local<Context> context,
+                                                       Local<Value>* values,
+                                                       size_t length);
+
+  V8_INLINE static DictionaryTemplate* Cast(Data* data);
+
+ private:
+  DictionaryTemplate();
+  static void CheckCast(Data* that);
+};
+
 /**
  * A Signature specifies which receiver is valid for a function.
  *
@@ -995,6 +1031,13 @@ ObjectTemplate* ObjectTemplate::Cast(Data* data) {
   return reinterpret_cast<ObjectTemplate*>(data);
 }
 
+DictionaryTemplate* DictionaryTemplate::Cast(Data* data) {
+#ifdef V8_ENABLE_CHECKS
+  CheckCast(data);
+#endif
+  return reinterpret_cast<DictionaryTemplate*>(data);
+}
+
 Signature* Signature::Cast(Data* data) {
 #ifdef V8_ENABLE_CHECKS
   CheckCast(data);
@@ -18,6 +18,7 @@
 namespace v8 {
 
 class ArrayBuffer;
+class BackingStore;
 class Isolate;
 class Object;
 class SharedArrayBuffer;
@@ -286,6 +287,15 @@ class V8_EXPORT ValueDeserializer {
    */
   void SetSupportsLegacyWireFormat(bool supports_legacy_wire_format);
 
+  /**
+   * Declares that the data being deserialized lives inside |backing_store|,
+   * e.g. the backing store of a SharedArrayBuffer the sender serialized into.
+   * Large strings are then created as external strings pointing into the data
+   * instead of being copied, and they keep |backing_store| alive. The data
+   * must not be modified afterwards. Must be called before ReadHeader.
+   */
+  void SetDataBackingStore(std::shared_ptr<BackingStore> backing_store);
+
   /**
    * Reads the underlying wire format version. Likely mostly to be useful to
    * legacy code reading old wire format versions. Must be called after
@@ -5,10 +5,12 @@
 #include "src/api/api.h"
 
 #include <algorithm>  // For min
+#include <atomic>
 #include <cmath>      // For isnan.
 #include <limits>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>  // For move
 #include <vector>
 
@@ -63,6 +65,7 @@
 #include "src/handles/traced-handles-inl.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-write-barrier.h"
+#include "src/heap/local-heap-inl.h"
 #include "src/heap/safepoint.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/icu_util.h"
@@ -79,6 +82,7 @@
 #include "src/objects/contexts.h"
 #include "src/objects/embedder-data-array-inl.h"
 #include "src/objects/embedder-data-slot-inl.h"
+#include "src/objects/external-string-region-table.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/heap-object.h"
 #include "src/objects/instance-type-inl.h"
@@ -123,6 +127,7 @@
 #include "src/snapshot/snapshot.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
+#include "src/strings/unicode-decoder.h"
 #include "src/strings/unicode-inl.h"
 #include "src/tracing/trace-event.h"
 #include "src/utils/detachable-vector.h"
@@ -2812,6 +2817,28 @@ MaybeLocal<Function> ScriptCompiler::CompileFunctionInternal(
 
 void ScriptCompiler::ScriptStreamingTask::Run() { data_->task->Run(); }
 
+void ScriptCompiler::ScriptStreamingTask::SourceTextAvailable(
+    Isolate* v8_isolate, Local<String> source_text,
+    const ScriptOrigin& origin) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  DCHECK_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  auto str = Utils::OpenHandle(*source_text);
+  i::ScriptDetails script_details =
+      GetScriptDetails(i_isolate, origin.ResourceName(), origin.LineOffset(),
+                       origin.ColumnOffset(), origin.SourceMapUrl(),
+                       origin.GetHostDefinedOptions(), origin.Options());
+  data_->task->SourceTextAvailable(i_isolate, str, script_details);
+}
+
+bool ScriptCompiler::ScriptStreamingTask::ShouldMergeWithExistingScript()
+    const {
+  return data_->task->ShouldMergeWithExistingScript();
+}
+
+void ScriptCompiler::ScriptStreamingTask::MergeWithExistingScript() {
+  data_->task->MergeWithExistingScript();
+}
+
 ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreaming(
     Isolate* v8_isolate, StreamedSource* source, v8::ScriptType type,
     CompileOptions options, CompileHintCallback compile_hint_callback,
@@ -2931,6 +2958,160 @@ MaybeLocal<Module> ScriptCompiler::CompileModule(
       ToApiHandle<Module>(i_isolate->factory()->NewSourceTextModule(sfi)));
 }
 
+namespace {
+
+// Hands the complete source of a module graph entry to the streaming parser.
+class ModuleGraphSourceStream final
+    : public ScriptCompiler::ExternalSourceStream {
+ public:
+  explicit ModuleGraphSourceStream(base::Vector<const char> source)
+      : source_(source) {}
+
+  size_t GetMoreData(const uint8_t** src) override {
+    size_t length = source_.size();
+    if (length == 0) return 0;
+    // The caller takes ownership of the chunk.
+    uint8_t* chunk = new uint8_t[length];
+    std::memcpy(chunk, source_.begin(), length);
+    *src = chunk;
+    source_ = {};
+    return length;
+  }
+
+ private:
+  base::Vector<const char> source_;
+};
+
+// Runs the background compile tasks of a module graph on worker threads. The
+// main thread claims tasks from the same counter, see CompileModuleGraph.
+class CompileModuleGraphJob final : public JobTask {
+ public:
+  CompileModuleGraphJob(
+      const std::vector<i::BackgroundCompileTask*>* tasks,
+      std::atomic<size_t>* next_task)
+      : tasks_(tasks), next_task_(next_task) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      size_t index = next_task_->fetch_add(1, std::memory_order_relaxed);
+      if (index >= tasks_->size()) return;
+      // All tasks are claimed before the main thread joins the job.
+      DCHECK(!delegate->IsJoiningThread());
+      (*tasks_)[index]->Run();
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next = next_task_->load(std::memory_order_relaxed);
+    return tasks_->size() - std::min(next, tasks_->size());
+  }
+
+ private:
+  const std::vector<i::BackgroundCompileTask*>* const tasks_;
+  std::atomic<size_t>* const next_task_;
+};
+
+// The modules of the graph currently being linked by CompileModuleGraph on
+// this thread, keyed by specifier.
+using ModuleGraphMap = std::unordered_map<std::string, Local<Module>>;
+thread_local const ModuleGraphMap* linking_module_graph = nullptr;
+
+MaybeLocal<Module> ResolveModuleGraphImport(
+    Local<Context> context, Local<String> specifier,
+    Local<FixedArray> import_attributes, Local<Module> referrer) {
+  DCHECK_NOT_NULL(linking_module_graph);
+  std::unique_ptr<char[]> key = Utils::OpenHandle(*specifier)->ToCString();
+  auto it = linking_module_graph->find(key.get());
+  if (it != linking_module_graph->end()) return it->second;
+  Isolate* isolate = context->GetIsolate();
+  isolate->ThrowError(String::Concat(
+      isolate,
+      String::NewFromUtf8Literal(isolate, "Module not found in graph: "),
+      specifier));
+  return {};
+}
+
+}  // namespace
+
+MaybeLocal<Module> ScriptCompiler::CompileModuleGraph(
+    Local<Context> context, MemorySpan<const ModuleGraphEntry> modules) {
+  Utils::ApiCheck(!modules.empty(), "v8::ScriptCompiler::CompileModuleGraph",
+                  "Module graph must not be empty");
+  PREPARE_FOR_EXECUTION(context, ScriptCompiler, Compile);
+  TRACE_EVENT_CALL_STATS_SCOPED(i_isolate, "v8", "V8.ScriptCompiler");
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.CompileModuleGraph");
+
+  // Parse and compile all modules concurrently. The main thread takes part
+  // in the work through the main thread local isolate and then parks while
+  // waiting for the workers, so that they can still trigger GCs.
+  std::vector<std::unique_ptr<StreamedSource>> sources;
+  std::vector<i::BackgroundCompileTask*> tasks;
+  sources.reserve(modules.size());
+  tasks.reserve(modules.size());
+  for (const ModuleGraphEntry& entry : modules) {
+    auto source = std::make_unique<StreamedSource>(
+        std::make_unique<ModuleGraphSourceStream>(base::VectorOf(
+            entry.utf8_source, entry.utf8_length)),
+        StreamedSource::UTF8);
+    i::ScriptStreamingData* data = source->impl();
+    data->task = std::make_unique<i::BackgroundCompileTask>(
+        data, i_isolate, ScriptType::kModule, kNoCompileOptions,
+        &source->compilation_details());
+    tasks.push_back(data->task.get());
+    sources.push_back(std::move(source));
+  }
+  std::atomic<size_t> next_task{0};
+  std::unique_ptr<JobHandle> job_handle =
+      i::V8::GetCurrentPlatform()->PostJob(
+          TaskPriority::kUserBlocking,
+          std::make_unique<CompileModuleGraphJob>(&tasks, &next_task));
+  for (size_t index = next_task.fetch_add(1, std::memory_order_relaxed);
+       index < tasks.size();
+       index = next_task.fetch_add(1, std::memory_order_relaxed)) {
+    tasks[index]->RunOnMainThread(i_isolate);
+  }
+  i_isolate->main_thread_local_heap()->BlockMainThreadWhileParked(
+      [&job_handle]() { job_handle->Join(); });
+
+  // Finalize the modules in order on the main thread.
+  ModuleGraphMap graph;
+  Local<Module> first;
+  for (size_t i = 0; i < modules.size(); ++i) {
+    const ModuleGraphEntry& entry = modules[i];
+    Local<String> full_source;
+    has_exception =
+        !String::NewFromUtf8(reinterpret_cast<Isolate*>(i_isolate),
+                             entry.utf8_source, NewStringType::kNormal,
+                             static_cast<int>(entry.utf8_length))
+             .ToLocal(&full_source);
+    RETURN_ON_FAILED_EXECUTION(Module);
+    ScriptOrigin origin(entry.specifier, 0, 0, false, -1, Local<Value>(),
+                        false, false, true);
+    i::Handle<i::SharedFunctionInfo> sfi;
+    has_exception = !CompileStreamedSource(i_isolate, sources[i].get(),
+                                           full_source, origin)
+                         .ToHandle(&sfi);
+    if (has_exception) i_isolate->ReportPendingMessages();
+    RETURN_ON_FAILED_EXECUTION(Module);
+    Local<Module> module =
+        ToApiHandle<Module>(i_isolate->factory()->NewSourceTextModule(sfi));
+    if (i == 0) first = module;
+    graph.emplace(Utils::OpenHandle(*entry.specifier)->ToCString().get(),
+                  module);
+  }
+
+  // Link the whole graph in one pass.
+  const ModuleGraphMap* outer_graph = linking_module_graph;
+  linking_module_graph = &graph;
+  has_exception = !i::Module::Instantiate(i_isolate, Utils::OpenHandle(*first),
+                                          context, ResolveModuleGraphImport,
+                                          nullptr);
+  linking_module_graph = outer_graph;
+  RETURN_ON_FAILED_EXECUTION(Module);
+  RETURN_ESCAPED(first);
+}
+
 uint32_t ScriptCompiler::CachedDataVersionTag() {
   return static_cast<uint32_t>(base::hash_combine(
       internal::Version::Hash(), internal::FlagList::Hash(),
@@ -3435,6 +3616,35 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+JSON::StreamingParser::StreamingParser()
+    : impl_(std::make_unique<i::JsonStreamingData>()) {}
+
+JSON::StreamingParser::~StreamingParser() = default;
+
+void JSON::StreamingParser::Append(const uint8_t* data, size_t length) {
+  impl_->Append(data, length);
+}
+
+void JSON::StreamingParser::Append(const uint16_t* data, size_t length) {
+  impl_->Append(data, length);
+}
+
+MaybeLocal<Value> JSON::StreamingParser::Finish(Local<Context> context) {
+  PREPARE_FOR_EXECUTION(context, JSON, Parse);
+  i::Handle<i::String> source;
+  has_exception = !impl_->TakeSource(i_isolate).ToHandle(&source);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  i::Handle<i::Object> undefined = i_isolate->factory()->undefined_value();
+  auto maybe =
+      source->IsOneByteRepresentation()
+          ? i::JsonParser<uint8_t>::Parse(i_isolate, source, undefined)
+          : i::JsonParser<uint16_t>::Parse(i_isolate, source, undefined);
+  Local<Value> result;
+  has_exception = !ToLocal<Value>(maybe, &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -3673,6 +3883,11 @@ void ValueDeserializer::SetSupportsLegacyWireFormat(
   private_->supports_legacy_wire_format = supports_legacy_wire_format;
 }
 
+void ValueDeserializer::SetDataBackingStore(
+    std::shared_ptr<BackingStore> backing_store) {
+  private_->deserializer.SetDataBackingStore(std::move(backing_store));
+}
+
 uint32_t ValueDeserializer::GetWireFormatVersion() const {
   return private_->deserializer.GetWireFormatVersion();
 }
@@ -5485,6 +5700,73 @@ MaybeLocal<v8::Value> Function::Call(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+struct PreparedFunctionCall::Data {
+  Data(Isolate* isolate, Local<Function> function, int argc)
+      : isolate(isolate), function(isolate, function), argv(argc) {}
+
+  Isolate* const isolate;
+  Global<Function> function;
+  std::vector<Local<Value>> argv;
+#ifdef V8_ENABLE_DIRECT_LOCAL
+  std::vector<i::Handle<i::Object>> handles;
+#endif  // V8_ENABLE_DIRECT_LOCAL
+};
+
+PreparedFunctionCall::PreparedFunctionCall(Isolate* v8_isolate,
+                                           Local<Function> function, int argc) {
+  auto self = Utils::OpenDirectHandle(*function);
+  Utils::ApiCheck(i::IsJSFunction(*self), "v8::PreparedFunctionCall",
+                  "Function must be a JavaScript function");
+  Utils::ApiCheck(
+      !i::IsClassConstructor(i::JSFunction::cast(*self)->shared()->kind()),
+      "v8::PreparedFunctionCall", "Function must not be a class constructor");
+  Utils::ApiCheck(argc >= 0, "v8::PreparedFunctionCall",
+                  "Argument count must not be negative");
+  data_ = std::make_unique<Data>(v8_isolate, function, argc);
+#ifdef V8_ENABLE_DIRECT_LOCAL
+  data_->handles.resize(argc);
+#endif  // V8_ENABLE_DIRECT_LOCAL
+}
+
+PreparedFunctionCall::~PreparedFunctionCall() = default;
+
+int PreparedFunctionCall::argc() const {
+  return static_cast<int>(data_->argv.size());
+}
+
+void PreparedFunctionCall::SetArgument(int index, Local<Value> value) {
+  DCHECK_LE(0, index);
+  DCHECK_LT(index, argc());
+  data_->argv[index] = value;
+}
+
+MaybeLocal<v8::Value> PreparedFunctionCall::Call(Local<Context> context,
+                                                 v8::Local<v8::Value> recv) {
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  DCHECK_EQ(reinterpret_cast<Isolate*>(i_isolate), data_->isolate);
+  TRACE_EVENT_CALL_STATS_SCOPED(i_isolate, "v8", "V8.Execute");
+  ENTER_V8(i_isolate, context, Function, Call, InternalEscapableScope);
+  auto self = Utils::OpenHandle(*data_->function.Get(data_->isolate));
+  auto recv_obj = Utils::OpenHandle(*recv);
+  const int argc = this->argc();
+
+#ifdef V8_ENABLE_DIRECT_LOCAL
+  i::Handle<i::Object>* args = data_->handles.data();
+  for (int i = 0; i < argc; ++i) {
+    args[i] = Utils::OpenHandle(*data_->argv[i]);
+  }
+#else   // !V8_ENABLE_DIRECT_LOCAL
+  i::Handle<i::Object>* args =
+      reinterpret_cast<i::Handle<i::Object>*>(data_->argv.data());
+#endif  // V8_ENABLE_DIRECT_LOCAL
+
+  Local<Value> result;
+  has_exception = !ToLocal<Value>(
+      i::Execution::Call(i_isolate, self, recv_obj, argc, args), &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 void Function::SetName(v8::Local<v8::String> name) {
   auto self = Utils::OpenDirectHandle(this);
   if (!IsJSFunction(*self)) return;
@@ -5848,29 +6130,38 @@ static int WriteUtf8Impl(base::Vector<const Char> string, char* write_start,
       up_to = std::min(up_to, read_index + writable_length);
     }
     // Write the characters to the stream.
-    if (sizeof(Char) == 1) {
-      // Simply memcpy if we only have ASCII characters.
-      uint8_t char_mask = 0;
-      for (int i = read_index; i < up_to; i++) char_mask |= read_start[i];
-      if ((char_mask & 0x80) == 0) {
-        int copy_length = up_to - read_index;
+    if constexpr (sizeof(Char) == 1) {
+      while (read_index < up_to) {
+        // Simply memcpy runs of ASCII characters.
+        int copy_length =
+            i::NonAsciiStart(read_start + read_index, up_to - read_index);
         memcpy(current_write, read_start + read_index, copy_length);
         current_write += copy_length;
-        read_index = up_to;
-      } else {
-        for (; read_index < up_to; read_index++) {
-          current_write += unibrow::Utf8::EncodeOneByte(
-              current_write, static_cast<uint8_t>(read_start[read_index]));
-          DCHECK(write_capacity == -1 ||
-                 (current_write - write_start) <= write_capacity);
-        }
+        read_index += copy_length;
+        if (read_index == up_to) break;
+        current_write += unibrow::Utf8::EncodeOneByte(
+            current_write, static_cast<uint8_t>(read_start[read_index]));
+        read_index++;
+        DCHECK(write_capacity == -1 ||
+               (current_write - write_start) <= write_capacity);
       }
     } else {
-      for (; read_index < up_to; read_index++) {
+      while (read_index < up_to) {
         uint16_t character = read_start[read_index];
+        if (character <= unibrow::Utf8::kMaxOneByteChar) {
+          // Write runs of ASCII characters at once.
+          int ascii_length = i::CopyAsciiPrefix(
+              read_start + read_index, up_to - read_index, current_write);
+          DCHECK_GE(ascii_length, 1);
+          current_write += ascii_length;
+          read_index += ascii_length;
+          prev_char = read_start[read_index - 1];
+          continue;
+        }
         current_write += unibrow::Utf8::Encode(current_write, character,
                                                prev_char, replace_invalid_utf8);
         prev_char = character;
+        read_index++;
         DCHECK(write_capacity == -1 ||
                (current_write - write_start) <= write_capacity);
       }
@@ -6470,7 +6761,9 @@ HeapStatistics::HeapStatistics()
       peak_malloced_memory_(0),
       does_zap_garbage_(false),
       number_of_native_contexts_(0),
-      number_of_detached_contexts_(0) {}
+      number_of_detached_contexts_(0),
+      number_of_maps_(0),
+      number_of_deprecated_maps_(0) {}
 
 HeapSpaceStatistics::HeapSpaceStatistics()
     : space_name_(nullptr),
@@ -7322,6 +7615,171 @@ MaybeLocal<v8::Object> ObjectTemplate::NewInstance(Local<Context> context) {
   RETURN_ESCAPED(result);
 }
 
+namespace {
+
+// A DictionaryTemplate is backed by a FixedArray holding a weak (context, map)
+// cache entry followed by the internalized property names.
+constexpr int kDictionaryTemplateCacheIndex = 0;
+constexpr int kDictionaryTemplateFirstNameIndex = 1;
+constexpr int kDictionaryTemplateCacheContextIndex = 0;
+constexpr int kDictionaryTemplateCacheMapIndex = 1;
+
+// Returns the cached map for {native_context}, or an empty handle.
+i::MaybeHandle<i::Map> GetCachedDictionaryTemplateMap(
+    i::Isolate* i_isolate, i::DirectHandle<i::FixedArray> self,
+    i::DirectHandle<i::NativeContext> native_context) {
+  i::Tagged<i::Object> cache = self->get(kDictionaryTemplateCacheIndex);
+  if (!i::IsWeakFixedArray(cache)) return {};
+  i::Tagged<i::WeakFixedArray> entry = i::WeakFixedArray::cast(cache);
+  i::Tagged<i::HeapObject> context;
+  i::Tagged<i::HeapObject> map;
+  if (!entry->get(kDictionaryTemplateCacheContextIndex)
+           .GetHeapObjectIfWeak(&context) ||
+      context != *native_context ||
+      !entry->get(kDictionaryTemplateCacheMapIndex)
+           .GetHeapObjectIfWeak(&map)) {
+    return {};
+  }
+  i::Handle<i::Map> result(i::Map::cast(map), i_isolate);
+  if (result->is_deprecated()) return {};
+  return result;
+}
+
+// Resolves the property names of {self} to a fast-mode map rooted in the
+// object literal map cache of {native_context}, using {values} to pick the
+// initial field representations. Returns an empty handle if the
+// names cannot be represented by a fast-mode map.
+i::MaybeHandle<i::Map> ResolveDictionaryTemplateMap(
+    i::Isolate* i_isolate, i::DirectHandle<i::FixedArray> self,
+    i::DirectHandle<i::NativeContext> native_context, Local<Value>* values,
+    int length) {
+  i::Handle<i::Map> map;
+  if (GetCachedDictionaryTemplateMap(i_isolate, self, native_context)
+          .ToHandle(&map)) {
+    return map;
+  }
+  map = i_isolate->factory()->ObjectLiteralMapFromCache(native_context, length);
+  if (map->is_dictionary_map()) return {};
+  for (int i = 0; i < length; ++i) {
+    i::Handle<i::Name> name(
+        i::Name::cast(self->get(kDictionaryTemplateFirstNameIndex + i)),
+        i_isolate);
+    uint32_t index;
+    if (name->AsArrayIndex(&index)) return {};
+    map = i::Map::TransitionToDataProperty(
+        i_isolate, map, name, Utils::OpenHandle(*values[i]), i::NONE, i::PropertyConstness::kConst, i::StoreOrigin::kNamed);
+    if (map->is_dictionary_map()) return {};
+  }
+  i::Handle<i::WeakFixedArray> entry =
+      i_isolate->factory()->NewWeakFixedArray(2);
+  entry->set(kDictionaryTemplateCacheContextIndex,
+             i::HeapObjectReference::Weak(*native_context));
+  entry->set(kDictionaryTemplateCacheMapIndex,
+             i::HeapObjectReference::Weak(*map));
+  self->set(kDictionaryTemplateCacheIndex, *entry);
+  return map;
+}
+
+}  // namespace
+
+Local<DictionaryTemplate> DictionaryTemplate::New(Isolate* v8_isolate,
+                                                  Local<Name>* names,
+                                                  size_t length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  API_RCS_SCOPE(i_isolate, DictionaryTemplate, New);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  constexpr size_t kMaxNames =
+      i::FixedArray::kMaxLength - kDictionaryTemplateFirstNameIndex;
+  if (!Utils::ApiCheck(length <= kMaxNames, "v8::DictionaryTemplate::New",
+                       "too many property names")) {
+    return Local<DictionaryTemplate>();
+  }
+  i::Handle<i::FixedArray> result = i_isolate->factory()->NewFixedArray(
+      kDictionaryTemplateFirstNameIndex + static_cast<int>(length));
+  for (size_t i = 0; i < length; ++i) {
+    i::Handle<i::Name> name =
+        i_isolate->factory()->InternalizeName(Utils::OpenHandle(*names[i]));
+    for (size_t j = 0; j < i; ++j) {
+      if (!Utils::ApiCheck(
+              result->get(kDictionaryTemplateFirstNameIndex +
+                          static_cast<int>(j)) != *name,
+              "v8::DictionaryTemplate::New",
+              "property names must be unique")) {
+        return Local<DictionaryTemplate>();
+      }
+    }
+    result->set(kDictionaryTemplateFirstNameIndex + static_cast<int>(i),
+                *name);
+  }
+  return Utils::DictionaryTemplateToLocal(result);
+}
+
+MaybeLocal<v8::Object> DictionaryTemplate::NewInstance(Local<Context> context,
+                                                  Local<Value>* values,
+                                                  size_t length) {
+  auto self = Utils::OpenHandle(this);
+  i::Isolate* i_isolate = self->GetIsolate();
+  int property_count = self->length() - kDictionaryTemplateFirstNameIndex;
+  if (!Utils::ApiCheck(length == static_cast<size_t>(property_count),
+                       "v8::DictionaryTemplate::NewInstance",
+                       "values must match the template's property names")) {
+    return MaybeLocal<v8::Object>();
+  }
+  ENTER_V8_NO_SCRIPT(i_isolate, context, DictionaryTemplate, NewInstance,
+                     InternalEscapableScope);
+  i::Handle<i::NativeContext> native_context = Utils::OpenHandle(*context);
+  i::Factory* factory = i_isolate->factory();
+
+  i::Handle<i::Map> map;
+  if (ResolveDictionaryTemplateMap(i_isolate, self, native_context, values,
+                                   property_count)
+          .ToHandle(&map)) {
+    // Generalize field representations where a value does not fit the shared
+    // map; this keeps the instance in fast mode.
+    for (int i = 0; i < property_count; ++i) {
+      map = i::Map::PrepareForDataProperty(
+          i_isolate, map, i::InternalIndex(i), i::PropertyConstness::kConst,
+          Utils::OpenHandle(*values[i]));
+      if (map->is_dictionary_map()) break;
+    }
+  }
+
+  if (!map.is_null() && !map->is_dictionary_map()) {
+    i::Handle<i::JSObject> object = factory->NewJSObjectFromMap(
+        factory->ObjectLiteralMapFromCache(native_context, property_count));
+    i::JSObject::AllocateStorageForMap(object, map);
+    i::DisallowGarbageCollection no_gc;
+    i::Tagged<i::DescriptorArray> descriptors = map->instance_descriptors();
+    for (i::InternalIndex i : i::InternalIndex::Range(property_count)) {
+      // Initializing store.
+      object->WriteToField(i, descriptors->GetDetails(i),
+                           *Utils::OpenDirectHandle(*values[i.as_int()]));
+    }
+    RETURN_ESCAPED(Utils::ToLocal(object));
+  }
+
+  // Fall back to adding the properties one by one, e.g. for array index
+  // names or for more properties than fit into a fast-mode map.
+  i::Handle<i::JSObject> object =
+      factory->NewJSObject(handle(native_context->object_function(), i_isolate));
+  for (int i = 0; i < property_count; ++i) {
+    i::Handle<i::Name> name(
+        i::Name::cast(self->get(kDictionaryTemplateFirstNameIndex + i)),
+        i_isolate);
+    has_exception = i::JSObject::DefinePropertyOrElementIgnoreAttributes(
+                        object, name, Utils::OpenHandle(*values[i]))
+                        .is_null();
+    RETURN_ON_FAILED_EXECUTION(Object);
+  }
+  RETURN_ESCAPED(Utils::ToLocal(object));
+}
+
+void v8::DictionaryTemplate::CheckCast(Data* that) {
+  auto obj = Utils::OpenDirectHandle(that);
+  Utils::ApiCheck(i::IsFixedArray(*obj), "v8::DictionaryTemplate::Cast",
+                  "Value is not a DictionaryTemplate");
+}
+
 void v8::ObjectTemplate::CheckCast(Data* that) {
   auto obj = Utils::OpenDirectHandle(that);
   Utils::ApiCheck(i::IsObjectTemplateInfo(*obj), "v8::ObjectTemplate::Cast",
@@ -7592,6 +8050,60 @@ MaybeLocal<String> v8::String::NewExternalOneByte(
   return Utils::ToLocal(string);
 }
 
+MaybeLocal<String> v8::String::NewExternalOneByte(
+    Isolate* v8_isolate,
+    const std::shared_ptr<v8::String::ExternalStringRegion>& region,
+    size_t byte_offset, size_t length) {
+  CHECK_NOT_NULL(region);
+  Utils::ApiCheck(byte_offset <= region->byte_length() &&
+                      length <= region->byte_length() - byte_offset,
+                  "v8::String::NewExternalOneByte",
+                  "string must be within the region");
+  if (length > static_cast<size_t>(i::String::kMaxLength)) {
+    return MaybeLocal<String>();
+  }
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  API_RCS_SCOPE(i_isolate, String, NewExternalOneByte);
+  if (length == 0) {
+    return Utils::ToLocal(i_isolate->factory()->empty_string());
+  }
+  i::Handle<i::String> string =
+      i_isolate->external_string_region_table()
+          ->NewOneByteString(i_isolate, region, byte_offset, length)
+          .ToHandleChecked();
+  return Utils::ToLocal(string);
+}
+
+MaybeLocal<String> v8::String::NewExternalTwoByte(
+    Isolate* v8_isolate,
+    const std::shared_ptr<v8::String::ExternalStringRegion>& region,
+    size_t byte_offset, size_t length) {
+  CHECK_NOT_NULL(region);
+  Utils::ApiCheck(
+      byte_offset <= region->byte_length() &&
+          length <= (region->byte_length() - byte_offset) / sizeof(uint16_t),
+      "v8::String::NewExternalTwoByte", "string must be within the region");
+  Utils::ApiCheck(
+      i::IsAligned(reinterpret_cast<i::Address>(region->data()) + byte_offset,
+                   alignof(uint16_t)),
+      "v8::String::NewExternalTwoByte", "string must be two-byte aligned");
+  if (length > static_cast<size_t>(i::String::kMaxLength)) {
+    return MaybeLocal<String>();
+  }
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  API_RCS_SCOPE(i_isolate, String, NewExternalTwoByte);
+  if (length == 0) {
+    return Utils::ToLocal(i_isolate->factory()->empty_string());
+  }
+  i::Handle<i::String> string =
+      i_isolate->external_string_region_table()
+          ->NewTwoByteString(i_isolate, region, byte_offset, length)
+          .ToHandleChecked();
+  return Utils::ToLocal(string);
+}
+
 bool v8::String::MakeExternal(v8::String::ExternalStringResource* resource) {
   i::DisallowGarbageCollection no_gc;
 
@@ -8049,6 +8561,88 @@ Local<v8::Array> v8::Array::New(Isolate* v8_isolate, Local<Value>* elements,
       factory->NewJSArrayWithElements(result, i::PACKED_ELEMENTS, len));
 }
 
+Local<v8::Array> v8::Array::New(Isolate* v8_isolate,
+                                MemorySpan<const double> elements) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i::Factory* factory = i_isolate->factory();
+  API_RCS_SCOPE(i_isolate, Array, New);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  int len = static_cast<int>(elements.size());
+
+  i::Handle<i::FixedArrayBase> result = factory->NewFixedDoubleArray(len);
+  if (len > 0) {
+    i::Tagged<i::FixedDoubleArray> doubles =
+        i::FixedDoubleArray::cast(*result);
+    for (int i = 0; i < len; i++) doubles->set(i, elements.data()[i]);
+  }
+
+  return Utils::ToLocal(
+      factory->NewJSArrayWithElements(result, i::PACKED_DOUBLE_ELEMENTS, len));
+}
+
+Local<v8::Array> v8::Array::New(Isolate* v8_isolate,
+                                MemorySpan<const int32_t> elements) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i::Factory* factory = i_isolate->factory();
+  API_RCS_SCOPE(i_isolate, Array, New);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  int len = static_cast<int>(elements.size());
+  const int32_t* data = elements.data();
+
+  // With 31-bit Smis not every int32_t is a Smi; fall back to unboxed doubles
+  // rather than allocating a HeapNumber per element.
+  bool all_smis = true;
+  for (int i = 0; i < len; i++) {
+    if (!i::Smi::IsValid(data[i])) {
+      all_smis = false;
+      break;
+    }
+  }
+
+  if (!all_smis) {
+    i::Handle<i::FixedDoubleArray> result =
+        i::Handle<i::FixedDoubleArray>::cast(factory->NewFixedDoubleArray(len));
+    for (int i = 0; i < len; i++) result->set(i, data[i]);
+    return Utils::ToLocal(factory->NewJSArrayWithElements(
+        result, i::PACKED_DOUBLE_ELEMENTS, len));
+  }
+
+  i::Handle<i::FixedArray> result = factory->NewFixedArray(len);
+  for (int i = 0; i < len; i++) result->set(i, i::Smi::FromInt(data[i]));
+  return Utils::ToLocal(
+      factory->NewJSArrayWithElements(result, i::PACKED_SMI_ELEMENTS, len));
+}
+
+MaybeLocal<v8::Array> v8::Array::New(Isolate* v8_isolate,
+                                     const char* const* data,
+                                     const int* lengths, size_t length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i::Factory* factory = i_isolate->factory();
+  API_RCS_SCOPE(i_isolate, Array, New);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  int len = static_cast<int>(length);
+
+  i::Handle<i::FixedArray> result = factory->NewFixedArray(len);
+  for (int i = 0; i < len; i++) {
+    size_t string_length = (lengths == nullptr || lengths[i] < 0)
+                               ? strlen(data[i])
+                               : static_cast<size_t>(lengths[i]);
+    if (string_length > static_cast<size_t>(i::String::kMaxLength)) {
+      return MaybeLocal<v8::Array>();
+    }
+    i::Handle<i::String> string;
+    if (!factory
+             ->NewStringFromUtf8(base::VectorOf(data[i], string_length))
+             .ToHandle(&string)) {
+      return MaybeLocal<v8::Array>();
+    }
+    result->set(i, *string);
+  }
+
+  return Utils::ToLocal(
+      factory->NewJSArrayWithElements(result, i::PACKED_ELEMENTS, len));
+}
+
 // static
 MaybeLocal<v8::Array> v8::Array::New(
     Local<Context> context, size_t length,
@@ -9527,6 +10121,17 @@ void Isolate::CancelTerminateExecution() {
   i_isolate->CancelTerminateExecution();
 }
 
+void Isolate::SetExecutionDeadline(double timeout_in_ms) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->SetExecutionDeadline(
+      base::TimeDelta::FromMillisecondsD(timeout_in_ms));
+}
+
+void Isolate::ClearExecutionDeadline() {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->ClearExecutionDeadline();
+}
+
 void Isolate::RequestInterrupt(InterruptCallback callback, void* data) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i_isolate->RequestInterrupt(callback, data);
@@ -9902,6 +10507,8 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
   heap_statistics->number_of_native_contexts_ = heap->NumberOfNativeContexts();
   heap_statistics->number_of_detached_contexts_ =
       heap->NumberOfDetachedContexts();
+  heap_statistics->number_of_maps_ = heap->NumberOfMaps();
+  heap_statistics->number_of_deprecated_maps_ = heap->NumberOfDeprecatedMaps();
   heap_statistics->does_zap_garbage_ = i::heap::ShouldZapGarbage();
 
 #if V8_ENABLE_WEBASSEMBLY
@@ -9964,7 +10571,10 @@ size_t Isolate::NumberOfTrackedHeapObjectTypes() {
 bool Isolate::GetHeapObjectStatisticsAtLastGC(
     HeapObjectStatistics* object_statistics, size_t type_index) {
   if (!object_statistics) return false;
-  if (V8_LIKELY(!i::TracingFlags::is_gc_stats_enabled())) return false;
+  if (V8_LIKELY(!i::TracingFlags::is_gc_stats_enabled() &&
+                !i::v8_flags.track_gc_instance_type_stats)) {
+    return false;
+  }
 
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i::Heap* heap = i_isolate->heap();
@@ -11203,6 +11813,15 @@ SnapshotObjectId HeapSnapshot::GetMaxSnapshotJSObjectId() const {
   return ToInternal(this)->max_snapshot_js_object_id();
 }
 
+std::vector<HeapSnapshotClassDelta> HeapSnapshot::DiffByClassName(
+    const HeapSnapshot* base) const {
+  Utils::ApiCheck(
+      ToInternal(base)->profiler() == ToInternal(this)->profiler(),
+      "v8::HeapSnapshot::DiffByClassName",
+      "Snapshots must be taken by the same HeapProfiler");
+  return ToInternal(this)->DiffByClassName(*ToInternal(base));
+}
+
 void HeapSnapshot::Serialize(OutputStream* stream,
                              HeapSnapshot::SerializationFormat format) const {
   Utils::ApiCheck(format == kJSON, "v8::HeapSnapshot::Serialize",
@@ -96,44 +96,45 @@ class RegisteredExtension {
   static RegisteredExtension* first_extension_;
 };
 
-#define TO_LOCAL_LIST(V)                               \
-  V(ToLocal, AccessorPair, debug::AccessorPair)        \
-  V(ToLocal, NativeContext, Context)                   \
-  V(ToLocal, Object, Value)                            \
-  V(ToLocal, Module, Module)                           \
-  V(ToLocal, Name, Name)                               \
-  V(ToLocal, String, String)                           \
-  V(ToLocal, Symbol, Symbol)                           \
-  V(ToLocal, JSRegExp, RegExp)                         \
-  V(ToLocal, JSReceiver, Object)                       \
-  V(ToLocal, JSObject, Object)                         \
-  V(ToLocal, JSFunction, Function)                     \
-  V(ToLocal, JSArray, Array)                           \
-  V(ToLocal, JSMap, Map)                               \
-  V(ToLocal, JSSet, Set)                               \
-  V(ToLocal, JSProxy, Proxy)                           \
-  V(ToLocal, JSArrayBuffer, ArrayBuffer)               \
-  V(ToLocal, JSArrayBufferView, ArrayBufferView)       \
-  V(ToLocal, JSDataView, DataView)                     \
-  V(ToLocal, JSRabGsabDataView, DataView)              \
-  V(ToLocal, JSTypedArray, TypedArray)                 \
-  V(ToLocalShared, JSArrayBuffer, SharedArrayBuffer)   \
-  V(ToLocal, FunctionTemplateInfo, FunctionTemplate)   \
-  V(ToLocal, ObjectTemplateInfo, ObjectTemplate)       \
-  V(SignatureToLocal, FunctionTemplateInfo, Signature) \
-  V(MessageToLocal, Object, Message)                   \
-  V(PromiseToLocal, JSObject, Promise)                 \
-  V(StackTraceToLocal, FixedArray, StackTrace)         \
-  V(StackFrameToLocal, StackFrameInfo, StackFrame)     \
-  V(NumberToLocal, Object, Number)                     \
-  V(IntegerToLocal, Object, Integer)                   \
-  V(Uint32ToLocal, Object, Uint32)                     \
-  V(ToLocal, BigInt, BigInt)                           \
-  V(ExternalToLocal, JSObject, External)               \
-  V(CallableToLocal, JSReceiver, Function)             \
-  V(ToLocalPrimitive, Object, Primitive)               \
-  V(FixedArrayToLocal, FixedArray, FixedArray)         \
-  V(PrimitiveArrayToLocal, FixedArray, PrimitiveArray) \
+#define TO_LOCAL_LIST(V)                                       \
+  V(ToLocal, AccessorPair, debug::AccessorPair)                \
+  V(ToLocal, NativeContext, Context)                           \
+  V(ToLocal, Object, Value)                                    \
+  V(ToLocal, Module, Module)                                   \
+  V(ToLocal, Name, Name)                                       \
+  V(ToLocal, String, String)                                   \
+  V(ToLocal, Symbol, Symbol)                                   \
+  V(ToLocal, JSRegExp, RegExp)                                 \
+  V(ToLocal, JSReceiver, Object)                               \
+  V(ToLocal, JSObject, Object)                                 \
+  V(ToLocal, JSFunction, Function)                             \
+  V(ToLocal, JSArray, Array)                                   \
+  V(ToLocal, JSMap, Map)                                       \
+  V(ToLocal, JSSet, Set)                                       \
+  V(ToLocal, JSProxy, Proxy)                                   \
+  V(ToLocal, JSArrayBuffer, ArrayBuffer)                       \
+  V(ToLocal, JSArrayBufferView, ArrayBufferView)               \
+  V(ToLocal, JSDataView, DataView)                             \
+  V(ToLocal, JSRabGsabDataView, DataView)                      \
+  V(ToLocal, JSTypedArray, TypedArray)                         \
+  V(ToLocalShared, JSArrayBuffer, SharedArrayBuffer)           \
+  V(ToLocal, FunctionTemplateInfo, FunctionTemplate)           \
+  V(ToLocal, ObjectTemplateInfo, ObjectTemplate)               \
+  V(SignatureToLocal, FunctionTemplateInfo, Signature)         \
+  V(DictionaryTemplateToLocal, FixedArray, DictionaryTemplate) \
+  V(MessageToLocal, Object, Message)                           \
+  V(PromiseToLocal, JSObject, Promise)                         \
+  V(StackTraceToLocal, FixedArray, StackTrace)                 \
+  V(StackFrameToLocal, StackFrameInfo, StackFrame)             \
+  V(NumberToLocal, Object, Number)                             \
+  V(IntegerToLocal, Object, Integer)                           \
+  V(Uint32ToLocal, Object, Uint32)                             \
+  V(ToLocal, BigInt, BigInt)                                   \
+  V(ExternalToLocal, JSObject, External)                       \
+  V(CallableToLocal, JSReceiver, Function)                     \
+  V(ToLocalPrimitive, Object, Primitive)                       \
+  V(FixedArrayToLocal, FixedArray, FixedArray)                 \
+  V(PrimitiveArrayToLocal, FixedArray, PrimitiveArray)         \
   V(ToLocal, ScriptOrModule, ScriptOrModule)
 
 #define OPEN_HANDLE_LIST(V)                    \
@@ -141,6 +142,7 @@ class RegisteredExtension {
   V(FunctionTemplate, FunctionTemplateInfo)    \
   V(ObjectTemplate, ObjectTemplateInfo)        \
   V(Signature, FunctionTemplateInfo)           \
+  V(DictionaryTemplate, FixedArray)            \
   V(Data, Object)                              \
   V(RegExp, JSRegExp)                          \
   V(Object, JSReceiver)                        \
@@ -66,9 +66,8 @@ namespace base {
 // Define __cpuid() for non-MSVC libraries.
 #if !V8_LIBC_MSVCRT
 
-static V8_INLINE void __cpuid(int cpu_info[4], int info_type) {
-// Clear ecx to align with __cpuid() of MSVC:
-// https://msdn.microsoft.com/en-us/library/hskdteyh.aspx
+static V8_INLINE void __cpuidex(int cpu_info[4], int info_type,
+                                int info_subtype) {
 #if defined(__i386__) && defined(__pic__)
   // Make sure to preserve ebx, which contains the pointer
   // to the GOT in case we're generating PIC.
@@ -78,15 +77,21 @@ static V8_INLINE void __cpuid(int cpu_info[4], int info_type) {
       "xchg %%edi, %%ebx\n\t"
       : "=a"(cpu_info[0]), "=D"(cpu_info[1]), "=c"(cpu_info[2]),
         "=d"(cpu_info[3])
-      : "a"(info_type), "c"(0));
+      : "a"(info_type), "c"(info_subtype));
 #else
   __asm__ volatile("cpuid \n\t"
                    : "=a"(cpu_info[0]), "=b"(cpu_info[1]), "=c"(cpu_info[2]),
                      "=d"(cpu_info[3])
-                   : "a"(info_type), "c"(0));
+                   : "a"(info_type), "c"(info_subtype));
 #endif  // defined(__i386__) && defined(__pic__)
 }
 
+static V8_INLINE void __cpuid(int cpu_info[4], int info_type) {
+  // Clear ecx to align with __cpuid() of MSVC:
+  // https://msdn.microsoft.com/en-us/library/hskdteyh.aspx
+  __cpuidex(cpu_info, info_type, 0);
+}
+
 #endif  // !V8_LIBC_MSVCRT
 
 #elif V8_HOST_ARCH_ARM || V8_HOST_ARCH_ARM64 || V8_HOST_ARCH_MIPS64 || \
@@ -404,6 +409,7 @@ CPU::CPU()
       has_avx_(false),
       has_avx2_(false),
       has_fma3_(false),
+      has_avx_vnni_(false),
       has_bmi1_(false),
       has_bmi2_(false),
       has_lzcnt_(false),
@@ -480,6 +486,13 @@ CPU::CPU()
     // CET shadow stack feature flag. See
     // https://en.wikipedia.org/wiki/CPUID#EAX=7,_ECX=0:_Extended_Features
     has_cetss_ = (cpu_info7[2] & 0x00000080) != 0;
+    // AVX-VNNI (VEX-encoded vpdpbusd and friends) is reported in leaf 7,
+    // sub-leaf 1.
+    if (num_ids >= 7 && cpu_info7[0] >= 1) {
+      int cpu_info7_1[4];
+      __cpuidex(cpu_info7_1, 7, 1);
+      has_avx_vnni_ = (cpu_info7_1[0] & 0x00000010) != 0;
+    }
     // "Hypervisor Present Bit: Bit 31 of ECX of CPUID leaf 0x1."
     // See https://lwn.net/Articles/301888/
     // This is checking for any hypervisor. Hypervisors may choose not to
@@ -11,6 +11,7 @@
 #include "src/base/numbers/double.h"
 #include "src/base/numbers/fast-dtoa.h"
 #include "src/base/numbers/fixed-dtoa.h"
+#include "src/base/numbers/schubfach-dtoa.h"
 
 namespace v8 {
 namespace base {
@@ -57,8 +58,10 @@ void DoubleToAscii(double v, DtoaMode mode, int requested_digits,
   bool fast_worked;
   switch (mode) {
     case DTOA_SHORTEST:
-      fast_worked = FastDtoa(v, FAST_DTOA_SHORTEST, 0, buffer, length, point);
-      break;
+      // Schubfach always produces the shortest representation, so there is
+      // no need for a bignum fallback.
+      SchubfachDtoa(v, buffer, length, point);
+      return;
     case DTOA_FIXED:
       fast_worked = FastFixedDtoa(v, requested_digits, buffer, length, point);
       break;
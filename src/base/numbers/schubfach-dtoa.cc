@@ -0,0 +1,789 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/numbers/schubfach-dtoa.h"
+
+#include <stdint.h>
+
+#include "src/base/bits.h"
+#include "src/base/logging.h"
+#include "src/base/macros.h"
+#include "src/base/numbers/double.h"
+
+namespace v8 {
+namespace base {
+
+namespace {
+
+// The exponent of the smallest subnormal, i.e. Double's kDenormalExponent.
+constexpr int kMinExponent = -1074;
+constexpr int kSignificandSize = 53;
+constexpr uint64_t kHiddenBit = uint64_t{1} << 52;
+
+// The range of decimal exponents k for which kPowersOfTen holds an entry.
+constexpr int kMinDecimalExponent = -324;
+constexpr int kMaxDecimalExponent = 292;
+
+struct Uint126 {
+  uint64_t hi;  // The upper 63 bits.
+  uint64_t lo;  // The lower 63 bits.
+};
+
+// Entry k - kMinDecimalExponent holds
+//   g = floor(10^-k * 2^(125 - FloorLog2Pow10(-k))) + 1,
+// an over-approximation of 10^-k normalized to [2^125, 2^126).
+constexpr Uint126 kPowersOfTen[] = {
+    {0x4F0C'EDC9'5A71'8DD4, 0x5B01'E8B0'9AA0'D1B5},
+    {0x7E7B'160E'F71C'1621, 0x119C'A780'F767'B5EE},
+    {0x652F'44D8'C5B0'11B4, 0x0E16'EC67'2C52'F7F2},
+    {0x50F2'9D7A'37C0'0E29, 0x5812'56B8'F042'5FF5},
+    {0x40C2'1794'F966'71BA, 0x79A8'4560'C035'1991},
+    {0x679C'F287'F570'B5F7, 0x75DA'089A'CD21'C281},
+    {0x52E3'F539'9126'F7F9, 0x44AE'6D48'A41B'0201},
+    {0x424F'F761'40EB'F994, 0x36F1'F106'E9AF'34CD},
+    {0x6A19'8BCE'CE46'5C20, 0x57E9'81A4'A918'547B},
+    {0x54E1'3CA5'71D1'E34D, 0x2CBA'CE1D'5413'76C9},
+    {0x43E7'63B7'8E41'82A4, 0x23C8'A4E4'4342'C56E},
+    {0x6CA5'6C58'E39C'043A, 0x060D'D4A0'6B9E'08B0},
+    {0x56EA'BD13'E949'9CFB, 0x1E71'76E6'BC7E'6D59},
+    {0x4588'9743'2107'B0C8, 0x7EC1'2BEB'C9FE'BDE1},
+    {0x6F40'F205'01A5'E7A7, 0x7E01'DFDF'A997'9635},
+    {0x5900'C19D'9AEB'1FB9, 0x4B34'B319'5479'44F7},
+    {0x4733'CE17'AF22'7FC7, 0x55C3'C27A'A9FA'9D93},
+    {0x71EC'7CF2'B1D0'CC72, 0x5606'03F7'765D'C8EA},
+    {0x5B23'9728'8E40'A38E, 0x7804'CFF9'2B7E'3A55},
+    {0x48E9'45BA'0B66'E93F, 0x1337'0CC7'55FE'9511},
+    {0x74A8'6F90'123E'41FE, 0x51F1'AE0B'BCCA'881B},
+    {0x5D53'8C73'41CB'67FE, 0x74C1'5809'63D5'39AF},
+    {0x4AA9'3D29'016F'8665, 0x43CD'E007'8310'FAF3},
+    {0x7775'2EA8'024C'0A3C, 0x0616'333F'381B'2B1E},
+    {0x5F90'F220'01D6'6E96, 0x3811'C298'F9AF'55B1},
+    {0x4C73'F4E6'67DE'BEDE, 0x600E'3547'2E25'DE28},
+    {0x7A53'2170'A631'3164, 0x3349'EED8'49D6'303F},
+    {0x61DC'1AC0'84F4'2783, 0x42A1'8BE0'3B11'C033},
+    {0x4E49'AF00'6A5C'EC69, 0x1BB4'6FE6'95A7'CCF5},
+    {0x7D42'B19A'43C7'E0A8, 0x2C53'E63D'BC3F'AE55},
+    {0x6435'5AE1'CFD3'1A20, 0x2376'51CA'FCFF'BEAA},
+    {0x502A'AF1B'0CA8'E1B3, 0x35F8'416F'30CC'9888},
+    {0x4022'25AF'3D53'E7C2, 0x5E60'3458'F3D6'E06D},
+    {0x669D'0918'621F'D937, 0x4A33'86F4'B957'CD7B},
+    {0x5217'3A79'E819'7A92, 0x6E8F'9F2A'2DDF'D796},
+    {0x41AC'2EC7'ECE1'2EDB, 0x720C'7F54'F17F'DFAB},
+    {0x6913'7E0C'AE35'17C6, 0x1CE0'CBBB'1BFF'CC45},
+    {0x540F'980A'24F7'4638, 0x171A'3C95'AFFF'D69E},
+    {0x433F'ACD4'EA5F'6B60, 0x127B'63AA'F333'1218},
+    {0x6B99'1487'DD65'7899, 0x6A5F'05DE'51EB'5026},
+    {0x5614'106C'B11D'FA14, 0x5518'D17E'A7EF'7352},
+    {0x44DC'D9F0'8DB1'94DD, 0x2A7A'4132'1FF2'C2A8},
+    {0x6E2E'2980'E2B5'BAFB, 0x5D90'6850'331E'043F},
+    {0x5824'EE00'B55E'2F2F, 0x6473'86A6'8F4B'3699},
+    {0x4683'F19A'2AB1'BF59, 0x36C2'D21E'D908'F87B},
+    {0x70D3'1C29'DDE9'3228, 0x579E'1CFE'280E'5A5D},
+    {0x5A42'7CEE'4B20'F4ED, 0x2C7E'7D98'200B'7B7E},
+    {0x4835'30BE'A280'C3F1, 0x09FE'CAE0'19A2'C932},
+    {0x7388'4DFD'D0CE'064E, 0x4331'4499'C29E'0EB6},
+    {0x5C6D'0B31'73D8'050B, 0x4F5A'9D47'CEE4'D891},
+    {0x49F0'D5C1'2979'9DA2, 0x72AE'E439'7250'AD41},
+    {0x764E'22CE'A8C2'95D1, 0x377E'39F5'83B4'4868},
+    {0x5EA4'E8A5'53CE'DE41, 0x12CB'6191'3629'D387},
+    {0x4BB7'2084'430B'E500, 0x756F'8140'F821'7605},
+    {0x7925'00D3'9E79'6E67, 0x6F18'CECE'59CF'233C},
+    {0x60EA'670F'B1FA'BEB9, 0x3F47'0BD8'47D8'E8FD},
+    {0x4D88'5272'F4C8'9894, 0x329F'3CAD'0647'20CA},
+    {0x7C0D'50B7'EE0D'C0ED, 0x3765'2DE1'A3A5'0143},
+    {0x633D'DA2C'BE71'6724, 0x2C50'F181'4FB7'3436},
+    {0x4F64'AE8A'31F4'5283, 0x3D0D'8E01'0C92'902B},
+    {0x7F07'7DA9'E986'EA6B, 0x7B48'E334'E0EA'8045},
+    {0x659F'97BB'2138'BB89, 0x4907'1C2A'4D88'669D},
+    {0x514C'7962'80FA'2FA1, 0x20D2'7CEE'A46D'1EE4},
+    {0x4109'FAB5'33FB'594D, 0x670E'CA58'838A'7F1D},
+    {0x680F'F788'532B'C216, 0x0B4A'DD5A'6C10'CB62},
+    {0x533F'F939'DC23'01AB, 0x22A2'4AAE'BCDA'3C4E},
+    {0x4299'942E'49B5'9AEF, 0x354E'A225'63E1'C9D8},
+    {0x6A8F'537D'42BC'2B18, 0x554A'9D08'9FCF'A95A},
+    {0x553F'75FD'CEFC'EF46, 0x776E'E406'E63F'BAAE},
+    {0x4432'C4CB'0BFD'8C38, 0x5F8B'E99F'1E99'6225},
+    {0x6D1E'07AB'4662'79F4, 0x3279'75CB'6428'9D08},
+    {0x574B'3955'D1E8'6190, 0x2861'2B09'1CED'4A6D},
+    {0x45D5'C777'DB20'4E0D, 0x06B4'226D'B0BD'D524},
+    {0x6FBC'7259'5E9A'167B, 0x2453'6A49'1AC9'5506},
+    {0x5963'8EAD'E548'11FC, 0x1D0F'883A'7BD4'4405},
+    {0x4782'D88B'1DD3'4196, 0x4A72'D361'FCA9'D004},
+    {0x726A'F411'C952'028A, 0x43EA'EBCF'FAA9'4CD3},
+    {0x5B88'C341'6DDB'353B, 0x4FEF'230C'C887'70A9},
+    {0x493A'35CD'F17C'2A96, 0x0CBF'4F3D'6D39'26EE},
+    {0x7529'EFAF'E8C6'AA89, 0x6132'1862'485B'717C},
+    {0x5DBB'2626'53D2'2207, 0x675B'46B5'06AF'8DFD},
+    {0x4AFC'1E85'0FDB'4E6C, 0x52AF'6BC4'0559'3E64},
+    {0x77F9'CA6E'7FC5'4A47, 0x377F'12D3'3BC1'FD6D},
+    {0x5FFB'0858'6637'6E9F, 0x45FF'4242'9634'CABD},
+    {0x4CC8'D379'EB5F'8BB2, 0x6B32'9B68'782A'3BCB},
+    {0x7ADA'EBF6'4565'AC51, 0x2B84'2BDA'59DD'2C77},
+    {0x6248'BCC5'0451'56A7, 0x3C69'BCAE'AE4A'89F9},
+    {0x4EA0'9704'0374'4552, 0x6387'CA25'583B'A194},
+    {0x7DCD'BE6C'D253'A21E, 0x05A6'103B'C05F'68ED},
+    {0x64A4'9857'0EA9'4E7E, 0x37B8'0CFC'99E5'ED8A},
+    {0x5083'AD12'7221'0B98, 0x2C93'3D96'E184'BE08},
+    {0x4069'5741'F4E7'3C79, 0x7075'CADF'1AD0'9807},
+    {0x670E'F203'2171'FA5C, 0x4D89'4498'2AE7'59A4},
+    {0x5272'5B35'B45B'2EB0, 0x3E07'6A13'5585'E150},
+    {0x41F5'15C4'9048'F226, 0x64D2'BB42'AAD1'810D},
+    {0x6988'22D4'1A0E'503E, 0x07B7'9204'4482'6815},
+    {0x546C'E8A9'AE71'D9CB, 0x1FC6'0E69'D068'5344},
+    {0x438A'53BA'F1F4'AE3C, 0x196B'3EBB'0D20'429D},
+    {0x6C10'85F7'E987'7D2D, 0x0F11'FDF8'1500'6A94},
+    {0x5673'9E5F'EE05'FDBD, 0x58DB'3193'4400'5543},
+    {0x4529'4B7F'F19E'6497, 0x60AF'5ADC'3666'AA9C},
+    {0x6EA8'78CC'B5CA'3A8C, 0x344B'C493'8A3D'DDC7},
+    {0x5886'C70A'2B08'2ED6, 0x5D09'6A0F'A1CB'17D2},
+    {0x46D2'38D4'EF39'BF12, 0x173A'BB3F'B4A2'7975},
+    {0x7150'5AEE'4B8F'981D, 0x0B91'2B99'2103'F588},
+    {0x5AA6'AF25'093F'ACE4, 0x0940'EFAD'B403'2AD3},
+    {0x4885'58EA'6DCC'8A50, 0x0767'2624'9002'88A9},
+    {0x7408'8E43'E2E0'DD4C, 0x723E'A36D'B337'410E},
+    {0x5CD3'A503'1BE7'1770, 0x5B65'4F8A'F5C5'CDA5},
+    {0x4A42'EA68'E31F'45F3, 0x62B7'72D5'916B'0AEB},
+    {0x76D1'770E'3832'0986, 0x0458'B7BC'1BDE'77DD},
+    {0x5F0D'F8D8'2CF4'D46B, 0x1D13'C630'164B'9318},
+    {0x4C0B'2D79'BD90'A9EF, 0x30DC'9E8C'DEA2'DC13},
+    {0x79AB'7BF5'FC1A'A97F, 0x0160'FDAE'3104'9351},
+    {0x6155'FCC4'C9AE'EDFF, 0x1AB3'FE24'F403'A90E},
+    {0x4DDE'63D0'A158'BE65, 0x6229'981D'9002'EDA5},
+    {0x7C97'061A'9BC1'30A2, 0x69DC'2695'B337'E2A1},
+    {0x63AC'04E2'1634'26E8, 0x54B0'1EDE'28F9'821B},
+    {0x4FBC'D0B4'DE90'1F20, 0x43C0'18B1'BA61'34E2},
+    {0x7F94'8121'6419'CB67, 0x1F99'C11C'5D68'549D},
+    {0x6610'674D'E9AE'3C52, 0x4C7B'00E3'7DED'107E},
+    {0x51A6'B90B'2158'3042, 0x09FC'00B5'FE57'4065},
+    {0x4152'2DA2'8113'59CE, 0x3B30'0091'9845'CD1D},
+    {0x6883'7C37'34EB'C2E3, 0x784C'CDB5'C06F'AE95},
+    {0x539C'635F'5D89'68B6, 0x2D0A'3E2B'0059'5877},
+    {0x42E3'82B2'B13A'BA2B, 0x3DA1'CB55'99E1'1393},
+    {0x6B05'9DEA'B52A'C378, 0x629C'7888'F634'EC1E},
+    {0x559E'17EE'F755'692D, 0x3549'FA07'2B5D'89B1},
+    {0x447E'798B'F911'20F1, 0x1107'FB38'EF7E'07C1},
+    {0x6D97'28DF'F4E8'34B5, 0x01A6'5EC1'7F30'0C68},
+    {0x57AC'20B3'2A53'5D5D, 0x4E1E'B234'65C0'09ED},
+    {0x4623'4D5C'21DC'4AB1, 0x24E5'5B5D'1E33'3B24},
+    {0x7038'7BC6'9C93'AAB5, 0x216E'F894'FD1E'C506},
+    {0x59C6'C96B'B076'222A, 0x4DF2'6077'30E5'6A6C},
+    {0x47D2'3ABC'8D2B'4E88, 0x3E5B'805F'5A51'21F0},
+    {0x72E9'F794'1512'1740, 0x63C5'9A32'2A1B'697F},
+    {0x5BEE'5FA9'AA74'DF67, 0x0304'7B5B'54E2'BACC},
+    {0x498B'7FBA'EEC3'E5EC, 0x0269'FC49'10B5'623D},
+    {0x75AB'FF91'7E06'3CAC, 0x6A43'2D41'B455'69FB},
+    {0x5E23'32DA'CB38'308A, 0x21CF'5767'C377'87FC},
+    {0x4B4F'5BE2'3C2C'F3A1, 0x67D9'12B9'692C'6CCA},
+    {0x787E'F969'F9E1'85CF, 0x595B'5128'A847'1476},
+    {0x6065'9454'C7E7'9E3F, 0x6115'DA86'ED05'A9F8},
+    {0x4D1E'1043'D31F'B1CC, 0x4DAB'1538'BD9E'2193},
+    {0x7B63'4D39'51CC'4FAD, 0x62AB'5527'95C9'CF52},
+    {0x62B5'D761'0E3D'0C8B, 0x0222'AA86'116E'3F75},
+    {0x4EF7'DF80'D830'D6D5, 0x4E82'2204'DABE'992A},
+    {0x7E59'659A'F381'57BC, 0x1736'9CD4'9130'F510},
+    {0x6514'5148'C2CD'DFC9, 0x5F5E'E3DD'40F3'F740},
+    {0x50DD'0DD3'CF0B'196E, 0x1918'B64A'9A5C'C5CD},
+    {0x40B0'D7DC'A5A2'7ABE, 0x4746'F83B'AEB0'9E3E},
+    {0x6781'5961'0903'F797, 0x253E'59F9'1780'FD2F},
+    {0x52CD'E11A'6D9C'C612, 0x50FE'AE60'DF9A'6426},
+    {0x423E'4DAE'BE17'04DB, 0x5A65'584D'7FAE'B685},
+    {0x69FD'4917'968B'3AF9, 0x10A2'26E2'65E4'573B},
+    {0x54CA'A0DF'ABA2'9594, 0x0D4E'8581'EB1D'1295},
+    {0x43D5'4D7F'BC82'1143, 0x243E'D134'BC17'4211},
+    {0x6C88'7BFF'9403'4ED2, 0x06CA'E854'6025'3682},
+    {0x56D3'9666'1002'A574, 0x6BD5'86A9'E684'2B9B},
+    {0x4576'11EB'4002'1DF7, 0x0977'9EEE'5203'5616},
+    {0x6F23'4FDE'CCD0'2FF1, 0x5BF2'97E3'B66B'BCEF},
+    {0x58E9'0CB2'3D73'598E, 0x165B'ACB6'2B89'63F3},
+    {0x4720'D6F4'FDF5'E13E, 0x4516'23C4'EFA1'1CC2},
+    {0x71CE'24BB'2FEF'CECA, 0x3B56'9FA1'7F68'2E03},
+    {0x5B0B'5095'BFF3'0BD5, 0x15DE'E61A'CC53'5803},
+    {0x48D5'DA11'665C'0977, 0x2B18'B815'7042'ACCF},
+    {0x7489'5CE8'A3C6'758B, 0x5E8D'F355'806A'AE18},
+    {0x5D3A'B0BA'1C9E'C46F, 0x653E'5C44'66BB'BE7A},
+    {0x4A95'5A2E'7D4B'D059, 0x3765'169D'1EFC'9861},
+    {0x7755'5D17'2EDF'B3C2, 0x256E'8A94'FE60'F3CF},
+    {0x5F77'7DAC'257F'C301, 0x6ABE'D543'FEB3'F63F},
+    {0x4C5F'97BC'EACC'9C01, 0x3BCB'DDCF'FEF6'5E99},
+    {0x7A32'8C61'77AD'C668, 0x5FAC'9619'97F0'975B},
+    {0x61C2'09E7'92F1'6B86, 0x7FBD'44E1'465A'12AF},
+    {0x4E34'D4B9'425A'BC6B, 0x7FCA'9D81'0514'DBBF},
+    {0x7D21'545B'9D5D'FA46, 0x32DD'C8CE'6E87'C5FF},
+    {0x641A'A9E2'E44B'2E9E, 0x5BE4'A0A5'2539'6B32},
+    {0x5015'54B5'836F'587E, 0x7CB6'E6EA'842D'EF5C},
+    {0x4011'1091'35F2'AD32, 0x3092'5255'368B'25E3},
+    {0x6681'B41B'8984'4850, 0x4DB6'EA21'F0DE'A304},
+    {0x5201'5CE2'D469'D373, 0x57C5'881B'2718'826A},
+    {0x419A'B0B5'76BB'0F8F, 0x5FD1'39AF'527A'01EF},
+    {0x68F7'8122'5791'B27F, 0x4C81'F5E5'50C3'364A},
+    {0x53F9'341B'7941'5B99, 0x239B'2B1D'DA35'C508},
+    {0x432D'C349'2DCD'E2E1, 0x02E2'88E4'AE91'6A6D},
+    {0x6B7C'6BA8'4949'6B01, 0x516A'74A1'174F'10AE},
+    {0x55FD'22ED'076D'EF34, 0x4121'F6E7'45D8'DA25},
+    {0x44CA'8257'3924'BF5D, 0x1A81'9252'9E47'14EB},
+    {0x6E10'D08B'8EA1'322E, 0x5D9C'1D50'FD3E'87DD},
+    {0x580D'73A2'D880'F4F2, 0x17B0'1773'FDCB'9FE4},
+    {0x4671'294F'139A'5D8E, 0x4626'7929'97D6'1984},
+    {0x70B5'0EE4'EC2A'2F4A, 0x3D0A'5B75'BFBC'F59F},
+    {0x5A2A'7250'BCEE'8C3B, 0x4A6E'AF91'6630'C47F},
+    {0x4821'F50D'63F2'09C9, 0x21F2'260D'EB5A'36CC},
+    {0x7369'8815'6CB6'760E, 0x6983'7016'455D'247A},
+    {0x5C54'6CDD'F091'F80B, 0x6E02'C011'D117'5062},
+    {0x49DD'23E4'C074'C66F, 0x719B'CCDB'0DAC'404E},
+    {0x762E'9FD4'6721'3D7F, 0x68F9'47C4'E2AD'33B0},
+    {0x5E8B'B310'5280'FDFF, 0x6D94'396A'4EF0'F627},
+    {0x4BA2'F5A6'A867'3199, 0x3E10'2DEE'A58D'91B9},
+    {0x7904'BC3D'DA3E'B5C2, 0x3019'E317'6F48'E927},
+    {0x60D0'9697'E1CB'C49B, 0x4014'B5AC'5907'20EC},
+    {0x4D73'ABAC'B4A3'03AF, 0x4CDD'5E23'7A6C'1A57},
+    {0x7BEC'45E1'2104'D2B2, 0x47C8'969F'2A46'908A},
+    {0x6323'6B1A'80D0'A88E, 0x6CA0'787F'5505'406F},
+    {0x4F4F'88E2'00A6'ED3F, 0x0A19'F9FF'7737'66BF},
+    {0x7EE5'A7D0'010B'1531, 0x5CF6'5CCB'F1F2'3DFE},
+    {0x6584'8640'00D5'AA8E, 0x172B'7D6F'F4C1'CB32},
+    {0x5136'D1CC'CD77'BBA4, 0x78EF'978C'C3CE'3C28},
+    {0x40F8'A7D7'0AC6'2FB7, 0x13F2'DFA3'CFD8'3020},
+    {0x67F4'3FBE'77A3'7F8B, 0x3984'9906'1959'E699},
+    {0x5329'CC98'5FB5'FFA2, 0x6136'E0D1'ADE1'8548},
+    {0x4287'D6E0'4C91'994F, 0x00F8'B3DA'F181'376D},
+    {0x6A72'F166'E0E8'F54B, 0x1B27'862B'1C01'F247},
+    {0x5528'C11F'1A53'F76F, 0x2F52'D1BC'1667'F506},
+    {0x4420'9A7F'4843'2C59, 0x0C42'4163'451F'F738},
+    {0x6D00'F732'0D38'46F4, 0x7A03'9BD2'0833'2526},
+    {0x5733'F8F4'D760'38C3, 0x7B36'1641'A028'EA85},
+    {0x45C3'2D90'AC4C'FA36, 0x2F5E'7834'8020'BB9E},
+    {0x6F9E'AF4D'E07B'29F0, 0x4BCA'59ED'99CD'F8FC},
+    {0x594B'BF71'8062'87F3, 0x563B'7B24'7B0B'2D96},
+    {0x476F'CC5A'CD1B'9FF6, 0x11C9'2F50'626F'57AC},
+    {0x724C'7A2A'E1C5'CCBD, 0x02DB'7EE7'03E5'5912},
+    {0x5B70'61BB'E7D1'7097, 0x1BE2'CBEC'031D'E0DC},
+    {0x4926'B496'530D'F3AC, 0x164F'0989'9C17'E716},
+    {0x750A'BA8A'1E7C'B913, 0x3D4B'4275'C68C'A4F0},
+    {0x5DA2'2ED4'E530'940F, 0x4AA2'9B91'6BA3'B726},
+    {0x4AE8'2577'1DC0'7672, 0x6EE8'7C74'561C'9285},
+    {0x77D9'D58B'62CD'8A51, 0x3173'FA53'BCFA'8408},
+    {0x5FE1'77A2'B571'3B74, 0x278F'FB76'30C8'69A0},
+    {0x4CB4'5FB5'5DF4'2F90, 0x1FA6'62C4'F3D3'87B3},
+    {0x7ABA'32BB'C986'B280, 0x32A3'D13B'1FB8'D91F},
+    {0x622E'8EFC'A138'8ECD, 0x0EE9'742F'4C93'E0E6},
+    {0x4E8B'A596'E760'723D, 0x58BA'C359'0A0F'E71E},
+    {0x7DAC'3C24'A567'1D2F, 0x412A'D228'1019'71C9},
+    {0x6489'C9B6'EAB8'E426, 0x00EF'0E86'7347'8E3B},
+    {0x506E'3AF8'BBC7'1CEB, 0x1A58'D86B'8F6C'71C9},
+    {0x4058'2F2D'6305'B0BC, 0x1513'E056'0C56'C16E},
+    {0x66F3'7EAF'04D5'E793, 0x3B53'0089'AD57'9BE2},
+    {0x525C'6558'D0AB'1FA9, 0x15DC'006E'2446'164F},
+    {0x41E3'8447'0D55'B2ED, 0x5E49'99F1'B69E'783F},
+    {0x696C'06D8'1555'EB15, 0x7D42'8FE9'2430'C065},
+    {0x5456'6BE0'1111'88DE, 0x3102'0CBA'835A'3384},
+    {0x4378'564C'DA74'6D7E, 0x5A68'0A2E'CF7B'5C69},
+    {0x6BF3'BD47'C3ED'7BFD, 0x770C'DD17'B25E'FA42},
+    {0x565C'976C'9CBD'FCCB, 0x1270'B0DF'C1E5'9502},
+    {0x4516'DF8A'16FE'63D5, 0x5B8D'5A4C'9B1E'10CE},
+    {0x6E8A'FF43'57FD'6C89, 0x127B'C3AD'C4FC'E7B0},
+    {0x586F'329C'4664'56D4, 0x0EC9'6957'D0CA'52F3},
+    {0x46BF'5BB0'3850'4576, 0x3F07'8779'73D5'0F29},
+    {0x7132'2C4D'26E6'D58A, 0x31A5'A58F'1FBB'4B75},
+    {0x5A8E'89D7'5252'446E, 0x5AEA'EAD8'E62F'6F91},
+    {0x4872'07DF'750E'9D25, 0x2F22'557A'51BF'8C74},
+    {0x73E9'A632'54E4'2EA2, 0x1836'EF2A'1C65'AD86},
+    {0x5CBA'EB5B'771C'F21B, 0x2CF8'BF54'E384'8AD2},
+    {0x4A2F'22AF'927D'8E7C, 0x23FA'32AA'4F9D'3BDB},
+    {0x76B1'D118'EA62'7D93, 0x5329'EAAA'18FB'92F8},
+    {0x5EF4'A747'21E8'6476, 0x0F54'BBBB'472F'A8C6},
+    {0x4BF6'EC38'E7ED'1D2B, 0x25DD'62FC'38F2'ED6C},
+    {0x798B'138E'3FE1'C845, 0x22FB'D193'8E51'7BDF},
+    {0x613C'0FA4'FFE7'D36A, 0x4F2F'DADC'71DA'C97F},
+    {0x4DC9'A61D'9986'42BB, 0x58F3'157D'27E2'3ACC},
+    {0x7C75'D695'C270'6AC5, 0x74B8'2261'D969'F7AD},
+    {0x6391'7877'CEC0'556B, 0x1093'4EB4'ADEE'5FBE},
+    {0x4FA7'9393'0BCD'1122, 0x4075'D890'8B25'1965},
+    {0x7F72'85B8'12E1'B504, 0x00BC'8DB4'11D4'F56E},
+    {0x65F5'37C6'7581'5D9C, 0x66FD'3E29'A7DD'9125},
+    {0x5190'F96B'9134'4AE3, 0x6BFD'CB54'864A'DA84},
+    {0x4140'C789'40F6'A24F, 0x6FFE'3C43'9EA2'486A},
+    {0x6867'A5A8'67F1'03B2, 0x7FFD'2D38'FDD0'73DC},
+    {0x5386'1E20'5327'3628, 0x6664'242D'97D9'F64A},
+    {0x42D1'B1B3'75B8'F820, 0x51E9'B68A'DFE1'91D5},
+    {0x6AE9'1C52'55F4'C034, 0x1CA9'2411'6635'B621},
+    {0x5587'49DB'77F7'0029, 0x63BA'8341'1E91'5E81},
+    {0x446C'3B15'F992'6687, 0x6962'029A'7EDA'B201},
+    {0x6D79'F823'28EA'3DA6, 0x0F03'375D'97C4'5001},
+    {0x5794'C682'8721'CAEB, 0x259C'2C4A'DFD0'4001},
+    {0x4610'9ECE'D281'6F22, 0x5149'BD08'B30D'0001},
+    {0x701A'97B1'50CF'1837, 0x3542'C80D'EB48'0001},
+    {0x59AE'DFC1'0D72'79C5, 0x7768'A00B'22A0'0001},
+    {0x47BF'1967'3DF5'2E37, 0x7920'8008'E880'0001},
+    {0x72CB'5BD8'6321'E38C, 0x5B67'3341'7400'0001},
+    {0x5BD5'E313'8281'82D6, 0x7C52'8F67'9000'0001},
+    {0x4977'E8DC'6867'9BDF, 0x16A8'72B9'4000'0001},
+    {0x758C'A7C7'0D72'92FE, 0x5773'EAC2'0000'0001},
+    {0x5E0A'1FD2'7128'7598, 0x45F6'5568'0000'0001},
+    {0x4B3B'4CA8'5A86'C47A, 0x04C5'1120'0000'0001},
+    {0x785E'E10D'5DA4'6D90, 0x07A1'B500'0000'0001},
+    {0x604B'E73D'E483'8AD9, 0x52E7'C400'0000'0001},
+    {0x4D09'85CB'1D36'08AE, 0x0F1F'D000'0000'0001},
+    {0x7B42'6FAB'61F0'0DE3, 0x31CC'8000'0000'0001},
+    {0x629B'8C89'1B26'7182, 0x5B0A'0000'0000'0001},
+    {0x4EE2'D6D4'15B8'5ACE, 0x7C08'0000'0000'0001},
+    {0x7E37'BE20'22C0'914B, 0x1340'0000'0000'0001},
+    {0x64F9'64E6'8233'A76F, 0x2900'0000'0000'0001},
+    {0x50C7'83EB'9B5C'85F2, 0x5400'0000'0000'0001},
+    {0x409F'9CBC'7C4A'04C2, 0x1000'0000'0000'0001},
+    {0x6765'C793'FA10'079D, 0x0000'0000'0000'0001},
+    {0x52B7'D2DC'C80C'D2E4, 0x0000'0000'0000'0001},
+    {0x422C'A8B0'A00A'4250, 0x0000'0000'0000'0001},
+    {0x69E1'0DE7'6676'D080, 0x0000'0000'0000'0001},
+    {0x54B4'0B1F'852B'DA00, 0x0000'0000'0000'0001},
+    {0x43C3'3C19'3756'4800, 0x0000'0000'0000'0001},
+    {0x6C6B'935B'8BBD'4000, 0x0000'0000'0000'0001},
+    {0x56BC'75E2'D631'0000, 0x0000'0000'0000'0001},
+    {0x4563'9182'44F4'0000, 0x0000'0000'0000'0001},
+    {0x6F05'B59D'3B20'0000, 0x0000'0000'0000'0001},
+    {0x58D1'5E17'6280'0000, 0x0000'0000'0000'0001},
+    {0x470D'E4DF'8200'0000, 0x0000'0000'0000'0001},
+    {0x71AF'D498'D000'0000, 0x0000'0000'0000'0001},
+    {0x5AF3'107A'4000'0000, 0x0000'0000'0000'0001},
+    {0x48C2'7395'0000'0000, 0x0000'0000'0000'0001},
+    {0x746A'5288'0000'0000, 0x0000'0000'0000'0001},
+    {0x5D21'DBA0'0000'0000, 0x0000'0000'0000'0001},
+    {0x4A81'7C80'0000'0000, 0x0000'0000'0000'0001},
+    {0x7735'9400'0000'0000, 0x0000'0000'0000'0001},
+    {0x5F5E'1000'0000'0000, 0x0000'0000'0000'0001},
+    {0x4C4B'4000'0000'0000, 0x0000'0000'0000'0001},
+    {0x7A12'0000'0000'0000, 0x0000'0000'0000'0001},
+    {0x61A8'0000'0000'0000, 0x0000'0000'0000'0001},
+    {0x4E20'0000'0000'0000, 0x0000'0000'0000'0001},
+    {0x7D00'0000'0000'0000, 0x0000'0000'0000'0001},
+    {0x6400'0000'0000'0000, 0x0000'0000'0000'0001},
+    {0x5000'0000'0000'0000, 0x0000'0000'0000'0001},
+    {0x4000'0000'0000'0000, 0x0000'0000'0000'0001},
+    {0x6666'6666'6666'6666, 0x3333'3333'3333'3334},
+    {0x51EB'851E'B851'EB85, 0x0F5C'28F5'C28F'5C29},
+    {0x4189'374B'C6A7'EF9D, 0x5916'872B'020C'49BB},
+    {0x68DB'8BAC'710C'B295, 0x74F0'D844'D013'A92B},
+    {0x53E2'D623'8DA3'C211, 0x43F3'E037'0CDC'8755},
+    {0x431B'DE82'D7B6'34DA, 0x698F'E692'70B0'6C44},
+    {0x6B5F'CA6A'F2BD'215E, 0x0F4C'A41D'811A'46D4},
+    {0x55E6'3B88'C230'E77E, 0x3F70'834A'CDAE'9F10},
+    {0x44B8'2FA0'9B5A'52CB, 0x4C5A'02A2'3E25'4C0D},
+    {0x6DF3'7F67'5EF6'EADF, 0x2D5C'D103'96A2'1347},
+    {0x57F5'FF85'E592'557F, 0x3DE3'DA69'454E'75D3},
+    {0x465E'6604'B7A8'4465, 0x7E4F'E1ED'D10B'9175},
+    {0x7097'09A1'25DA'0709, 0x4A19'697C'81AC'1BEF},
+    {0x5A12'6E1A'84AE'6C07, 0x54E1'2130'67BC'E326},
+    {0x480E'BE7B'9D58'566C, 0x43E7'4DC0'52FD'8285},
+    {0x734A'CA5F'6226'F0AD, 0x530B'AF9A'1E62'6A6D},
+    {0x5C3B'D519'1B52'5A24, 0x426F'BFAE'7EB5'21F1},
+    {0x49C9'7747'490E'AE83, 0x4EBF'CC8B'9890'E7F4},
+    {0x760F'253E'DB4A'B0D2, 0x4ACC'7A78'F41B'0CBA},
+    {0x5E72'8432'4908'8D75, 0x223D'2EC7'29AF'3D62},
+    {0x4B8E'D028'3A6D'3DF7, 0x34FD'BF05'BAF2'9781},
+    {0x78E4'8040'5D7B'9658, 0x54C9'31A2'C4B7'58CF},
+    {0x60B6'CD00'4AC9'4513, 0x5D6D'C14F'03C5'E0A5},
+    {0x4D5F'0A66'A23A'9DA9, 0x3124'9AA5'9C9E'4D51},
+    {0x7BCB'43D7'69F7'62A8, 0x4EA0'F76F'60FD'4882},
+    {0x6309'0312'BB2C'4EED, 0x254D'92BF'80CA'A068},
+    {0x4F3A'68DB'C8F0'3F24, 0x1DD7'A899'33D5'4D20},
+    {0x7EC3'DAF9'4180'6506, 0x62F2'A75B'8622'1500},
+    {0x6569'7BFA'9ACD'1D9F, 0x025B'B916'04E8'10CD},
+    {0x5121'2FFB'AF0A'7E18, 0x6849'60DE'6A53'40A4},
+    {0x40E7'5996'25A1'FE7A, 0x203A'B3E5'21DC'33B6},
+    {0x67D8'8F56'A29C'CA5D, 0x19F7'863B'6960'52BD},
+    {0x5313'A5DE'E87D'6EB0, 0x7B2C'6B62'BAB3'7564},
+    {0x4276'1E4B'ED31'255A, 0x2F56'BC4E'FBC2'C450},
+    {0x6A56'96DF'E1E8'3BC3, 0x6557'93B1'92D1'3A1A},
+    {0x5512'124C'B4B9'C969, 0x3779'42F4'7574'2E7B},
+    {0x440E'750A'2A2E'3ABA, 0x5F94'3590'5DF6'8B96},
+    {0x6CE3'EE76'A9E3'912A, 0x65B9'EF4D'6324'1289},
+    {0x571C'BEC5'54B6'0DBB, 0x6AFB'25D7'8283'4207},
+    {0x45B0'989D'DD5E'7163, 0x08C8'EB12'CECF'6806},
+    {0x6F80'F42F'C897'1BD1, 0x5ADB'11B7'B14B'D9A3},
+    {0x5933'F68C'A078'E30E, 0x157C'0E2C'8DD6'47B5},
+    {0x475C'C53D'4D2D'8271, 0x5DFC'D823'A4AB'6C91},
+    {0x722E'0862'1515'9D82, 0x632E'269F'6DDF'141B},
+    {0x5B58'06B4'DDAA'E468, 0x4F58'1EE5'F17F'4349},
+    {0x4913'3890'B155'8386, 0x72AC'E584'C132'9C3B},
+    {0x74EB'8DB4'4EEF'38D7, 0x6AAE'3C07'9B84'2D2A},
+    {0x5D89'3E29'D8BF'60AC, 0x5558'3006'1603'5755},
+    {0x4AD4'31BB'13CC'4D56, 0x7779'C004'DE69'12AB},
+    {0x77B9'E92B'52E0'7BBE, 0x258F'99A1'63DB'5111},
+    {0x5FC7'EDBC'424D'2FCB, 0x37A6'1481'1CAF'740D},
+    {0x4C9F'F163'683D'BFD5, 0x7951'AA00'E3BF'900B},
+    {0x7A99'8238'A6C9'32EF, 0x754F'7667'D2CC'19AB},
+    {0x6214'682D'523A'8F26, 0x2AA5'F853'0F09'AE22},
+    {0x4E76'B9BD'DB62'0C1E, 0x5551'9375'A5A1'581B},
+    {0x7D8A'C2C9'5F03'4697, 0x3BB5'B8BC'3C35'59C5},
+    {0x646F'023A'B269'0545, 0x7C91'6096'9691'149E},
+    {0x5058'CE95'5B87'376B, 0x16DA'B3AB'ABA7'43B2},
+    {0x4047'0BAA'AF9F'5F88, 0x78AE'F622'EFB9'02F5},
+    {0x66D8'12AA'B298'98DB, 0x0DE4'BD04'B2C1'9E54},
+    {0x5246'7555'5BAD'4715, 0x57EA'30D0'8F01'4B76},
+    {0x41D1'F777'7C8A'9F44, 0x4654'F3DA'0C01'092C},
+    {0x694F'F258'C744'3207, 0x23BB'1FC3'4668'0EAC},
+    {0x543F'F513'D29C'F4D2, 0x4FC8'E635'D1EC'D88A},
+    {0x4366'5DA9'754A'5D75, 0x263A'51C4'A7F0'AD3B},
+    {0x6BD6'FC42'5543'C8BB, 0x56C3'B607'731A'AEC4},
+    {0x5645'969B'7769'6D62, 0x789C'919F'8F48'8BD0},
+    {0x4504'787C'5F87'8AB5, 0x46E3'A7B2'D906'D640},
+    {0x6E6D'8D93'CC0C'1122, 0x3E39'0C51'5B3E'239A},
+    {0x5857'A476'3CD6'741B, 0x4B60'D6A7'7C31'B615},
+    {0x46AC'8391'CA45'29AF, 0x55E7'121F'968E'2B44},
+    {0x7114'05B6'106E'A919, 0x0971'B698'F0E3'786D},
+    {0x5A76'6AF8'0D25'5414, 0x078E'2BAD'8D82'C6BD},
+    {0x485E'BBF9'A41D'DCDC, 0x6C71'BC8A'D79B'D231},
+    {0x73CA'C65C'39C9'6161, 0x2D82'C744'8C2C'8382},
+    {0x5CA2'3849'C7D4'4DE7, 0x3E02'3903'A356'CF9B},
+    {0x4A1B'603B'0643'7185, 0x7E68'2D9C'82AB'D949},
+    {0x7692'3391'A39F'1C09, 0x4A40'48FA'6AAC'8EDB},
+    {0x5EDB'5C74'82E5'B007, 0x5500'3A61'EEF0'7249},
+    {0x4BE2'B05D'3584'8CD2, 0x7733'61E7'F259'F507},
+    {0x796A'B3C8'55A0'E151, 0x3EB8'9CA6'508F'EE71},
+    {0x6122'296D'114D'810D, 0x7EFA'16EB'73A6'585B},
+    {0x4DB4'EDF0'DAA4'673E, 0x3261'ABEF'8FB8'46AF},
+    {0x7C54'AFE7'C43A'3ECA, 0x1D69'1318'E5F3'A44B},
+    {0x6376'F31F'D02E'98A1, 0x6454'0F47'1E5C'836F},
+    {0x4F92'5C19'7358'7A1B, 0x0376'729F'4B7D'35F3},
+    {0x7F50'935B'EBC0'C35E, 0x38BD'8432'1261'EFEB},
+    {0x65DA'0F7C'BC9A'35E5, 0x13CA'D028'0EB4'BFEF},
+    {0x517B'3F96'FD48'2B1D, 0x5CA2'4020'0BC3'CCBF},
+    {0x412F'6612'6439'BC17, 0x63B5'0019'A303'0A33},
+    {0x684B'D683'D38F'9359, 0x1F88'0029'04D1'A9EA},
+    {0x536F'DECF'DC72'DC47, 0x32D3'3354'03DA'EE55},
+    {0x42BF'E573'16C2'49D2, 0x5BDC'2910'0315'8B77},
+    {0x6ACC'A251'BE03'A951, 0x12F9'DB4C'D1BC'1258},
+    {0x5570'81DA'FE69'5440, 0x7594'AF70'A7C9'A847},
+    {0x445A'017B'FEBA'A9CD, 0x4476'F2C0'863A'ED06},
+    {0x6D5C'CF2C'CAC4'42E2, 0x3A57'EACD'A391'7B3C},
+    {0x577D'728A'3BD0'3581, 0x7B79'88A4'82DA'C8FD},
+    {0x45FD'F53B'630C'F79B, 0x15FA'D3B6'CF15'6D97},
+    {0x6FFC'BB92'3814'BF5E, 0x565E'1F8A'E4EF'15BE},
+    {0x5996'FC74'F9AA'32B2, 0x11E4'E608'B725'AAFF},
+    {0x47AB'FD2A'6154'F55B, 0x27EA'51A0'9284'88CC},
+    {0x72AC'C843'CEEE'555E, 0x7310'829A'8407'4146},
+    {0x5BBD'6D03'0BF1'DDE5, 0x4273'9BAE'D005'CDD2},
+    {0x4964'5735'A327'E4B7, 0x4EC2'E2F2'4004'A4A8},
+    {0x756D'5855'D1D9'6DF2, 0x4AD1'6B1D'333A'A10C},
+    {0x5DF1'1377'DB14'57F5, 0x2241'227D'C295'4DA3},
+    {0x4B27'42C6'48DD'132A, 0x4E9A'81FE'3544'3E1C},
+    {0x783E'D13D'4161'B844, 0x175D'9CC9'EED3'9694},
+    {0x6032'40FD'CDE7'C69C, 0x7917'B0A1'8BDC'7876},
+    {0x4CF5'00CB'0B1F'D217, 0x1412'F3B4'6FE3'9392},
+    {0x7B21'9ADE'7832'E9BE, 0x5351'85ED'7FD2'85B6},
+    {0x6281'48B1'F9C2'5498, 0x42A7'9E57'9975'37C5},
+    {0x4ECD'D3C1'949B'76E0, 0x3552'E512'E12A'9304},
+    {0x7E16'1F9C'20F8'BE33, 0x6EEB'081E'3510'EB39},
+    {0x64DE'7FB0'1A60'9829, 0x3F22'6CE4'F740'BC2E},
+    {0x50B1'FFC0'151A'1354, 0x3281'F0B7'2C33'C9BE},
+    {0x408E'6633'4414'DC43, 0x4201'8D5F'568F'D498},
+    {0x674A'3D1E'D354'939F, 0x1CCF'4898'8A7F'BA8D},
+    {0x52A1'CA7F'0F76'DC7F, 0x30A5'D3AD'3B99'620B},
+    {0x421B'0865'A5F8'B065, 0x73B7'DC8A'9614'4E6F},
+    {0x69C4'DA3C'3CC1'1A3C, 0x52BF'C744'2353'B0B1},
+    {0x549D'7B63'63CD'AE96, 0x7566'3903'4F76'26F4},
+    {0x43B1'2F82'B63E'2545, 0x4451'C735'D92B'525D},
+    {0x6C4E'B26A'BD30'3BA2, 0x3A1C'71EF'C1DE'EA2E},
+    {0x56A5'5B88'9759'C94E, 0x61B0'5B26'34B2'54F2},
+    {0x4551'1606'DF7B'0772, 0x1AF3'7C1E'908E'AA5B},
+    {0x6EE8'233E'325E'7250, 0x2B1F'2CFD'B417'76F8},
+    {0x58B9'B5CB'5B7E'C1D9, 0x6F4C'23FE'29AC'5F2D},
+    {0x46FA'F7D5'E2CB'CE47, 0x72A3'4FFE'87BD'18F1},
+    {0x7191'8C89'6ADF'B073, 0x0438'7FFD'A5FB'5B1B},
+    {0x5ADA'D6D4'557F'C05C, 0x0360'6664'84C9'15AF},
+    {0x48AF'1243'7799'66B0, 0x02B3'851D'3707'448C},
+    {0x744B'506B'F28F'0AB3, 0x1DEC'082E'BE72'0746},
+    {0x5D09'0D23'2872'6EF5, 0x64BC'D358'985B'3905},
+    {0x4A6D'A41C'205B'8BF7, 0x6A30'A913'AD15'C738},
+    {0x7715'D360'33C5'ACBF, 0x5D1A'A81F'7B56'0B8C},
+    {0x5F44'A919'C304'8A32, 0x7DAE'ECE5'FC44'D609},
+    {0x4C36'EDAE'359D'3B5B, 0x7E25'8A51'969D'7808},
+    {0x79F1'7C49'EF61'F893, 0x16A2'76E8'F0FB'F33F},
+    {0x618D'FD07'F2B4'C6DC, 0x121B'9253'F3FC'C299},
+    {0x4E0B'30D3'2890'9F16, 0x41AF'A843'2997'0214},
+    {0x7CDE'B485'0DB4'31BD, 0x4F7F'739E'A8F1'9CED},
+    {0x63E5'5D37'3E29'C164, 0x3F99'294B'BA5A'E3F1},
+    {0x4FEA'B0F8'FE87'CDE9, 0x7FAD'BAA2'FB7B'E98D},
+    {0x7FDD'E7F4'CA72'E30F, 0x7F7C'5DD1'925F'DC15},
+    {0x664B'1FF7'085B'E8D9, 0x4C63'7E41'41E6'49AB},
+    {0x51D5'B32C'06AF'ED7A, 0x704F'9834'34B8'3AEF},
+    {0x4177'C289'9EF3'2462, 0x26A6'135C'F6F9'C8BF},
+    {0x68BF'9DA8'FE51'D3D0, 0x3DD6'8561'8B29'4132},
+    {0x53CC'7E20'CB74'A973, 0x4B12'044E'08ED'CDC2},
+    {0x4309'FE80'A2C3'BAC2, 0x6F41'9D0B'3A57'D7CE},
+    {0x6B43'30CD'D139'2AD1, 0x3202'94DE'C3BF'BFB0},
+    {0x55CF'5A3E'40FA'88A7, 0x419B'AA4B'CFCC'995A},
+    {0x44A5'E1CB'672E'D3B9, 0x1AE2'EEA3'0CA3'ADE1},
+    {0x6DD6'3612'3EB1'52C1, 0x77D1'7DD1'ADD2'AFCF},
+    {0x57DE'91A8'3227'7567, 0x7974'64A7'BE42'263F},
+    {0x464B'A7B9'C1B9'2AB9, 0x4790'5086'31CE'84FF},
+    {0x7079'0C5C'6928'445C, 0x0C1A'1A70'4FB0'D4CC},
+    {0x59FA'7049'EDB9'D049, 0x567B'4859'D95A'43D6},
+    {0x47FB'8D07'F161'736E, 0x11FC'39E1'7AAE'9CAB},
+    {0x732C'14D9'8235'857D, 0x032D'2968'C44A'9445},
+    {0x5C23'43E1'34F7'9DFD, 0x4F57'5453'D03B'A9D1},
+    {0x49B5'CFE7'5D92'E4CA, 0x72AC'4376'402F'BB0E},
+    {0x75EF'B30B'C8EB'07AB, 0x0446'D256'CD19'2B49},
+    {0x5E59'5C09'6D88'D2EF, 0x1D05'7512'3DAD'BC3A},
+    {0x4B7A'B007'8AD3'DBF2, 0x4A6A'C40E'97BE'302F},
+    {0x78C4'4CD8'DE1F'C650, 0x7711'39B0'F2C9'E6B1},
+    {0x609D'0A47'1819'6B73, 0x78DA'948D'8F07'EBC1},
+    {0x4D4A'6E9F'467A'BC5C, 0x60AE'DD3E'0C06'5634},
+    {0x7BAA'4A98'70C4'6094, 0x344A'FB96'79A3'BD20},
+    {0x62EE'A213'8D69'E6DD, 0x103B'FC78'614F'CA80},
+    {0x4F25'4E76'0ABB'1F17, 0x2696'6393'810C'A200},
+    {0x7EA2'1723'445E'9825, 0x2423'D285'9B47'6999},
+    {0x654E'78E9'037E'E01D, 0x69B6'4204'7C39'2148},
+    {0x510B'93ED'9C65'8017, 0x6E2B'6803'9694'1AA0},
+    {0x40D6'0FF1'49EA'CCDF, 0x71BC'5336'1210'154D},
+    {0x67BC'E64E'DCAA'E166, 0x1C60'8523'5019'BBAE},
+    {0x52FD'850B'E3BB'E784, 0x7D1A'041C'4014'9625},
+    {0x4264'6A6F'E963'1F9D, 0x4A7B'367D'0010'781D},
+    {0x6A3A'43E6'4238'3295, 0x5D91'F0C8'001A'59C8},
+    {0x54FB'6985'01C6'8EDE, 0x17A7'F3D3'3348'47D4},
+    {0x43FC'546A'67D2'0BE4, 0x7953'2975'C2A0'3976},
+    {0x6CC6'ED77'0C83'463B, 0x0EEB'7589'3766'C256},
+    {0x5705'8AC5'A39C'382F, 0x2589'2AD4'2C52'3512},
+    {0x459E'089E'1C7C'F9BF, 0x37A0'EF10'2374'F742},
+    {0x6F63'40FC'FA61'8F98, 0x5901'7E80'38BB'2536},
+    {0x591C'33FD'951A'D946, 0x7A67'9866'93C8'EA91},
+    {0x4749'C331'4415'7A9F, 0x151F'AD1E'DCA0'BBA8},
+    {0x720F'9EB5'39BB'F765, 0x0832'AE97'C767'92A5},
+    {0x5B3F'B22A'9496'5F84, 0x068E'F213'05EC'7551},
+    {0x48FF'C1BB'AA11'E603, 0x1ED8'C1A8'D189'F774},
+    {0x74CC'692C'434F'D66B, 0x4AF4'690E'1C0F'F253},
+    {0x5D70'5423'690C'AB89, 0x225D'20D8'1673'2843},
+    {0x4AC0'434F'873D'5607, 0x3517'4D79'AB8F'5369},
+    {0x779A'054C'0B95'5672, 0x21BE'E25C'45B2'1F0E},
+    {0x5FAE'6AA3'3C77'785B, 0x3498'B516'9E28'18D8},
+    {0x4C8B'8882'96C5'F9E2, 0x5D46'F745'4B53'4713},
+    {0x7A78'DA6A'8AD6'5C9D, 0x7BA4'BED5'4552'0B52},
+    {0x61FA'4855'3BDE'B07E, 0x2FB6'FF11'0441'A2A8},
+    {0x4E61'D377'6318'8D31, 0x72F8'CC0D'9D01'4EED},
+    {0x7D69'5258'9E8D'AEB6, 0x1E5A'E015'C802'17E1},
+    {0x6454'41E0'7ED7'BEF8, 0x1848'B344'A001'ACB4},
+    {0x5043'67E6'CBDF'CBF9, 0x603A'2903'B334'8A2A},
+    {0x4035'ECB8'A319'6FFB, 0x002E'8736'28F6'D4EE},
+    {0x66BC'ADF4'3828'B32B, 0x19E4'0B89'DB24'87E3},
+    {0x5230'8B29'C686'F5BC, 0x14B6'6FA1'7C1D'3983},
+    {0x41C0'6F54'9ED2'5E30, 0x1091'F2E7'967D'C79C},
+    {0x6933'E554'3150'96B3, 0x341C'B7D8'F0C9'3F5F},
+    {0x5429'8443'5AA6'DEF5, 0x767D'5FE0'C0A0'FF80},
+    {0x4354'69CF'7BB8'B25E, 0x2B97'7FE7'0080'CC66},
+    {0x6BBA'42E5'92C1'1D63, 0x5F58'CCA4'CD9A'E0A3},
+    {0x562E'9BEA'DBCD'B11C, 0x4C47'0A1D'7148'B3B6},
+    {0x44F2'1655'7CA4'8DB0, 0x3D05'A1B1'276D'5C92},
+    {0x6E50'23BB'FAA0'E2B3, 0x7B3C'35E8'3F15'60E9},
+    {0x5840'1C96'621A'4EF6, 0x2F63'5E53'65AA'B3ED},
+    {0x4699'B078'4E7B'725E, 0x591C'4B75'EAEE'F658},
+    {0x70F5'E726'E3F8'B6FD, 0x74FA'1256'44B1'8A26},
+    {0x5A5E'5285'832D'5F31, 0x43FB'41DE'9D5A'D4EB},
+    {0x484B'7537'9C24'4C27, 0x4FFC'34B2'177B'DD89},
+    {0x73AB'EEBF'603A'1372, 0x4CC6'BAB6'8BF9'6274},
+    {0x5C89'8BCC'4CFB'42C2, 0x0A38'955E'D661'1B90},
+    {0x4A07'A309'D72F'689B, 0x21C6'DDE5'784D'AFA7},
+    {0x7672'9E76'2518'A75E, 0x693E'2FD5'8D49'190B},
+    {0x5EC2'185E'8413'B918, 0x5431'BFDE'0AA0'E0D5},
+    {0x4BCE'79E5'3676'2DAD, 0x29C1'664B'3BB3'E711},
+    {0x794A'5CA1'F0BD'15E2, 0x0F9B'D6DE'C5EC'A4E8},
+    {0x6108'4A1B'26FD'AB1B, 0x2616'457F'04BD'50BA},
+    {0x4DA0'3B48'EBFE'227C, 0x1E78'3798'D097'73C8},
+    {0x7C33'920E'4663'6A60, 0x30C0'58F4'80F2'52D9},
+    {0x635C'74D8'384F'884D, 0x0D66'AD90'6728'4247},
+    {0x4F7D'2A46'9372'D370, 0x711E'F140'5286'9B6C},
+    {0x7F2E'AA0A'8584'8581, 0x34FE'4ECD'50D7'5F14},
+    {0x65BE'EE6E'D136'D134, 0x2A65'0BD7'73DF'7F43},
+    {0x5165'8B8B'DA92'40F6, 0x551D'A312'C319'329C},
+    {0x411E'093C'AEDB'672B, 0x5DB1'4F42'35AD'C217},
+    {0x6830'0EC7'7E2B'D845, 0x7C4E'E536'BC49'368A},
+    {0x5359'A56C'64EF'E037, 0x7D0B'EA92'303A'9208},
+    {0x42AE'1DF0'50BF'E693, 0x173C'BBA8'2695'41A0},
+    {0x6AB0'2FE6'E799'70EB, 0x3EC7'92A6'A422'029A},
+    {0x5559'BFEB'EC7A'C0BC, 0x3239'421E'E9B4'CEE1},
+    {0x4447'CCBC'BD2F'0096, 0x5B61'01B2'5490'A581},
+    {0x6D3F'ADFA'C84B'3424, 0x2BCE'691D'541A'A268},
+    {0x5766'24C8'A03C'29B6, 0x563E'BA7D'DCE2'1B87},
+    {0x45EB'50A0'8030'215E, 0x7832'2ECB'171B'4939},
+    {0x6FDE'E767'3380'3564, 0x59E9'E478'24F8'7527},
+    {0x597F'1F85'C2CC'F783, 0x6187'E9F9'B72D'2A86},
+    {0x4798'E604'9BD7'2C69, 0x346C'BB2E'2C24'2205},
+    {0x728E'3CD4'2C8B'7A42, 0x20AD'F849'E039'D007},
+    {0x5BA4'FD76'8A09'2E9B, 0x33BE'603B'19C7'D99F},
+    {0x4950'CAC5'3B3A'8BAF, 0x42FE'B362'7B06'47B3},
+    {0x754E'113B'91F7'45E5, 0x5197'856A'5E70'72B8},
+    {0x5DD8'0DC9'4192'9E51, 0x27AC'6ABB'7EC0'5BC6},
+    {0x4B13'3E3A'9ADB'B1DA, 0x52F0'5562'CBCD'1638},
+    {0x781E'C9F7'5E2C'4FC4, 0x1E4D'556A'DFAE'89F3},
+    {0x6018'A192'B1BD'0C9C, 0x7EA4'4455'7FBE'D4C3},
+    {0x4CE0'8142'27CA'707D, 0x4BB6'9D11'32FF'109C},
+    {0x7B00'CED0'3FAA'4D95, 0x5F8A'94E8'5198'1A93},
+    {0x6267'0BD9'CC88'3E11, 0x32D5'43ED'0E13'4875},
+    {0x4EB8'D647'D6D3'64DA, 0x5BDD'CFF0'D80F'6D2B},
+    {0x7DF4'8A0C'8AEB'D491, 0x12FC'7FE7'C018'AEAB},
+    {0x64C3'A1A3'A256'43A7, 0x28C9'FFEC'99AD'5889},
+    {0x509C'814F'B511'CFB9, 0x0707'FFF0'7AF1'13A1},
+    {0x407D'343F'C40E'3FC7, 0x1F39'998D'2F27'42E7},
+    {0x672E'B9FF'A016'CC71, 0x7EC2'8F48'4B72'04A4},
+    {0x528B'C7FF'B345'705B, 0x189B'A5D3'6F8E'6A1D},
+    {0x4209'6CCC'8F6A'C048, 0x7A16'1E42'BFA5'21B1},
+    {0x69A8'AE14'18AA'CD41, 0x4356'96D1'32A1'CF81},
+    {0x5486'F1A9'AD55'7101, 0x1C45'4574'2881'72CE},
+    {0x439F'27BA'F111'2734, 0x169D'D129'BA01'28A5},
+    {0x6C31'D92B'1B4E'A520, 0x242F'B50F'9001'DAA1},
+    {0x568E'4755'AF72'1DB3, 0x368C'90D9'4001'7BB4},
+    {0x453E'9F77'BF8E'7E29, 0x120A'0D7A'999A'C95D},
+    {0x6ECA'98BF'98E3'FD0E, 0x5010'1590'F5C4'7561},
+    {0x58A2'13CC'7A4F'FDA5, 0x2673'4473'F7D0'5DE8},
+    {0x46E8'0FD6'C83F'FE1D, 0x6B8F'69F6'5FD9'E4B9},
+    {0x7173'4C8A'D9FF'FCFC, 0x45B2'4323'CC8F'D45C},
+    {0x5AC2'A3A2'47FF'FD96, 0x6AF5'0283'0A0C'A9E3},
+    {0x489B'B61B'6CCC'CADF, 0x08C4'0202'6E70'87E9},
+    {0x742C'5692'47AE'1164, 0x746C'D003'E3E7'3FDB},
+    {0x5CF0'4541'D2F1'A783, 0x76BD'7336'4FEC'3315},
+    {0x4A59'D101'758E'1F9C, 0x5EFD'F5C5'0CBC'F5AB},
+    {0x76F6'1B35'88E3'65C7, 0x4B2F'EFA1'ADFB'22AB},
+    {0x5F2B'48F7'A0B5'EB06, 0x08F3'261A'F195'B555},
+    {0x4C22'A0C6'1A2B'226B, 0x20C2'84E2'5ADE'2AAB},
+    {0x79D1'013C'F6AB'6A45, 0x1AD0'D49D'5E30'4444},
+    {0x6174'00FD'9222'BB6A, 0x48A7'107D'E4F3'69D0},
+    {0x4DF6'6731'41B5'62BB, 0x53B8'D9FE'50C2'BB0D},
+    {0x7CBD'71E8'6922'3792, 0x52C1'5CCA'1AD1'2B48},
+    {0x63CA'C186'BA81'C60E, 0x7567'7D6E'7BDA'8906},
+    {0x4FD5'679E'FB9B'04D8, 0x5DEC'6458'6315'3A6C},
+    {0x7FBB'D8FE'5F5E'6E27, 0x497A'3A27'04EE'C3DF},
+};
+static_assert(arraysize(kPowersOfTen) ==
+              kMaxDecimalExponent - kMinDecimalExponent + 1);
+
+// floor(e * log10(2)), exact for |e| <= 5456721.
+int FloorLog10Pow2(int e) {
+  return static_cast<int>((int64_t{e} * 661971961083) >> 41);
+}
+
+// floor(log10(3/4 * 2^e)), exact for |e| <= 5456721.
+int FloorLog10ThreeQuartersPow2(int e) {
+  return static_cast<int>((int64_t{e} * 661971961083 - 274743187321) >> 41);
+}
+
+// floor(e * log2(10)), exact for |e| <= 1838394.
+int FloorLog2Pow10(int e) {
+  return static_cast<int>((int64_t{e} * 913124641741) >> 38);
+}
+
+uint64_t MulHigh64(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+  return static_cast<uint64_t>((static_cast<unsigned __int128>(a) * b) >> 64);
+#else
+  return bits::UnsignedMulHigh64(a, b);
+#endif
+}
+
+// Returns g * cp / 2^127, rounded to odd.
+uint64_t RoundToOdd(const Uint126& g, uint64_t cp) {
+  constexpr uint64_t kMask63 = (uint64_t{1} << 63) - 1;
+  uint64_t x1 = MulHigh64(g.lo, cp);
+  uint64_t y0 = g.hi * cp;
+  uint64_t y1 = MulHigh64(g.hi, cp);
+  uint64_t z = (y0 >> 1) + x1;
+  uint64_t vbp = y1 + (z >> 63);
+  return vbp | (((z & kMask63) + kMask63) >> 63);
+}
+
+// Writes the digits of f * 10^e without trailing zeros.
+void EmitDigits(uint64_t f, int e, Vector<char> buffer, int* length,
+                int* decimal_point) {
+  DCHECK(f != 0);
+  while (f % 10 == 0) {
+    f /= 10;
+    e++;
+  }
+  char digits[kSchubfachDtoaMaximalLength];
+  int count = 0;
+  while (f != 0) {
+    DCHECK(count < kSchubfachDtoaMaximalLength);
+    digits[count++] = static_cast<char>('0' + f % 10);
+    f /= 10;
+  }
+  for (int i = 0; i < count; i++) buffer[i] = digits[count - 1 - i];
+  buffer[count] = '\0';
+  *length = count;
+  *decimal_point = e + count;
+}
+
+}  // namespace
+
+void SchubfachDtoa(double v, Vector<char> buffer, int* length,
+                   int* decimal_point) {
+  DCHECK(v > 0);
+  DCHECK(!Double(v).IsSpecial());
+
+  uint64_t bits = Double(v).AsUint64();
+  uint64_t fraction = bits & (kHiddenBit - 1);
+  int biased_exponent = static_cast<int>(bits >> 52);
+  // v == c * 2^q.
+  int q;
+  uint64_t c;
+  if (biased_exponent != 0) {
+    q = biased_exponent - 1075;
+    c = kHiddenBit | fraction;
+    // Integers below 2^53 are their own shortest representation.
+    if (-kSignificandSize < q && q < 0) {
+      uint64_t f = c >> -q;
+      if (f << -q == c) return EmitDigits(f, 0, buffer, length, decimal_point);
+    }
+  } else {
+    q = kMinExponent;
+    c = fraction;
+  }
+
+  // The rounding interval of v is [cbl, cbr] * 2^(q - 2), including its
+  // bounds only if c is even. It is narrower below powers of two.
+  const uint64_t is_odd = c & 1;
+  const uint64_t cb = c << 2;
+  const uint64_t cbr = cb + 2;
+  uint64_t cbl;
+  int k;
+  if (c != kHiddenBit || q == kMinExponent) {
+    cbl = cb - 2;
+    k = FloorLog10Pow2(q);
+  } else {
+    cbl = cb - 1;
+    k = FloorLog10ThreeQuartersPow2(q);
+  }
+  DCHECK(kMinDecimalExponent <= k && k <= kMaxDecimalExponent);
+  const int h = q + FloorLog2Pow10(-k) + 2;
+  const Uint126& g = kPowersOfTen[k - kMinDecimalExponent];
+
+  // Scale the interval by 10^-k, keeping two fractional bits.
+  const uint64_t vb = RoundToOdd(g, cb << h);
+  const uint64_t vbl = RoundToOdd(g, cbl << h);
+  const uint64_t vbr = RoundToOdd(g, cbr << h);
+
+  // The interval is less than ten units wide, so it contains at most one
+  // multiple of ten, which then is the shortest candidate.
+  const uint64_t s = vb >> 2;
+  if (s >= 10) {
+    const uint64_t sp10 = 10 * (s / 10);
+    const uint64_t tp10 = sp10 + 10;
+    const bool upin = vbl + is_odd <= sp10 << 2;
+    const bool wpin = (tp10 << 2) + is_odd <= vbr;
+    if (upin != wpin) {
+      return EmitDigits(upin ? sp10 : tp10, k, buffer, length, decimal_point);
+    }
+  }
+
+  // Otherwise pick between the two neighbors of v at the current length, the
+  // closer one if both are inside, with ties going to the even one.
+  const uint64_t t = s + 1;
+  const bool uin = vbl + is_odd <= s << 2;
+  const bool win = (t << 2) + is_odd <= vbr;
+  if (uin != win) {
+    return EmitDigits(uin ? s : t, k, buffer, length, decimal_point);
+  }
+  const int64_t cmp = static_cast<int64_t>(vb - ((s + t) << 1));
+  const bool pick_s = cmp < 0 || (cmp == 0 && (s & 1) == 0);
+  EmitDigits(pick_s ? s : t, k, buffer, length, decimal_point);
+}
+
+}  // namespace base
+}  // namespace v8
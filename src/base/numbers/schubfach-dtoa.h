@@ -0,0 +1,37 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_BASE_NUMBERS_SCHUBFACH_DTOA_H_
+#define V8_BASE_NUMBERS_SCHUBFACH_DTOA_H_
+
+#include "src/base/vector.h"
+
+namespace v8 {
+namespace base {
+
+// SchubfachDtoa will produce at most kSchubfachDtoaMaximalLength digits. This
+// does not include the terminating '\0' character.
+const int kSchubfachDtoaMaximalLength = 17;
+
+// Computes the shortest decimal representation of v using Raffaello
+// Giulietti's Schubfach algorithm. Like Ryu, it only needs a table of 128-bit
+// powers of ten and, unlike FastDtoa, never has to fall back to bignums.
+// The result should be interpreted as buffer * 10^(point - length).
+//
+// Precondition:
+//   * v must be a strictly positive finite double.
+//
+// The digits in the buffer are the shortest representation that reads back as
+// v. If there are several of them, the one closest to v is chosen, and ties
+// are broken in favor of an even last digit, as Number::toString requires.
+// There will be *length digits inside the buffer followed by a null
+// terminator, so the buffer must hold at least
+// kSchubfachDtoaMaximalLength + 1 characters.
+V8_BASE_EXPORT void SchubfachDtoa(double v, Vector<char> buffer, int* length,
+                                  int* decimal_point);
+
+}  // namespace base
+}  // namespace v8
+
+#endif  // V8_BASE_NUMBERS_SCHUBFACH_DTOA_H_
@@ -7,6 +7,7 @@
 
 #include "src/base/platform/platform-linux.h"
 
+#include <dlfcn.h>
 #include <pthread.h>
 #include <semaphore.h>
 #include <signal.h>
@@ -32,7 +33,9 @@
 
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 #include "src/base/logging.h"
 #include "src/base/memory.h"
@@ -276,6 +279,28 @@ std::vector<OS::SharedLibraryAddress> OS::GetSharedLibraryAddresses() {
   return ::v8::base::GetSharedLibraryAddresses(nullptr);
 }
 
+// static
+bool OS::MarkPagesMergeable(void* address, size_t size) {
+  DCHECK(IsAligned(reinterpret_cast<uintptr_t>(address), CommitPageSize()));
+  DCHECK(IsAligned(size, CommitPageSize()));
+#ifdef MADV_MERGEABLE
+  return madvise(address, size, MADV_MERGEABLE) == 0;
+#else
+  return false;
+#endif
+}
+
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+  DCHECK(IsAligned(reinterpret_cast<uintptr_t>(address), CommitPageSize()));
+  DCHECK(IsAligned(size, CommitPageSize()));
+#ifdef MADV_HUGEPAGE
+  return madvise(address, size, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
 // static
 bool OS::RemapPages(const void* address, size_t size, void* new_address,
                     MemoryPermission access) {
@@ -347,5 +372,99 @@ bool OS::RemapPages(const void* address, size_t size, void* new_address,
   return true;
 }
 
+namespace {
+
+// A process-wide shared copy of memory, see OS::RemapSharedCopy().
+struct SharedCopy {
+  const void* address;
+  size_t size;
+  int fd;
+  // A read-only view of the copy, used to check that the source memory is
+  // unchanged before the copy is reused.
+  void* view;
+  size_t view_size;
+};
+
+LazyMutex shared_copies_mutex = LAZY_MUTEX_INITIALIZER;
+
+std::vector<SharedCopy>& SharedCopies() {
+  static std::vector<SharedCopy>* shared_copies = new std::vector<SharedCopy>();
+  return *shared_copies;
+}
+
+// Need to disable CFI_ICALL due to the indirect call to memfd_create.
+DISABLE_CFI_ICALL
+int CreateSharedCopyFile(const void* address, size_t size, size_t file_size) {
+  using memfd_create_t = int (*)(const char*, unsigned int);
+  memfd_create_t memfd_create =
+      reinterpret_cast<memfd_create_t>(dlsym(RTLD_DEFAULT, "memfd_create"));
+  if (!memfd_create) return -1;
+  int fd = memfd_create("v8_shared_copy", MFD_CLOEXEC);
+  if (fd == -1) return -1;
+  if (ftruncate(fd, file_size) != 0) {
+    close(fd);
+    return -1;
+  }
+  const uint8_t* data = static_cast<const uint8_t*>(address);
+  size_t written = 0;
+  while (written < size) {
+    ssize_t result = write(fd, data + written, size - written);
+    if (result == -1) {
+      if (errno == EINTR) continue;
+      close(fd);
+      return -1;
+    }
+    written += static_cast<size_t>(result);
+  }
+  return fd;
+}
+
+}  // namespace
+
+// static
+bool OS::RemapSharedCopy(const void* address, size_t size, void* new_address,
+                         MemoryPermission access) {
+  DCHECK(
+      IsAligned(reinterpret_cast<uintptr_t>(new_address), CommitPageSize()));
+  const size_t mapping_size = RoundUp(size, CommitPageSize());
+
+  int fd = -1;
+  {
+    MutexGuard guard(shared_copies_mutex.Pointer());
+    std::vector<SharedCopy>& copies = SharedCopies();
+    for (auto it = copies.begin(); it != copies.end(); ++it) {
+      if (it->address != address || it->size != size) continue;
+      if (memcmp(it->view, address, size) == 0) {
+        fd = it->fd;
+      } else {
+        // The source memory was freed and reused for something else.
+        CHECK_EQ(0, munmap(it->view, it->view_size));
+        CHECK_EQ(0, close(it->fd));
+        copies.erase(it);
+      }
+      break;
+    }
+    if (fd == -1) {
+      fd = CreateSharedCopyFile(address, size, mapping_size);
+      if (fd == -1) return false;
+      void* view = mmap(nullptr, mapping_size, PROT_READ, MAP_SHARED, fd, 0);
+      if (view == MAP_FAILED) {
+        close(fd);
+        return false;
+      }
+      copies.push_back({address, size, fd, view, mapping_size});
+    }
+  }
+
+  // The mapping may still be refused, e.g. if executable mappings of memory
+  // files are disallowed. The target is left untouched in that case.
+  void* mapped_address =
+      mmap(new_address, mapping_size, GetProtectionFromMemoryPermission(access),
+           MAP_FIXED | MAP_SHARED, fd, 0);
+  if (mapped_address == MAP_FAILED) return false;
+  CHECK_EQ(mapped_address, new_address);
+  return true;
+}
+
 }  // namespace base
 }  // namespace v8
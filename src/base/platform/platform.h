@@ -347,9 +347,77 @@ class V8_BASE_EXPORT OS {
                                                void* new_address,
                                                MemoryPermission access);
 
+  // Whether the platform supports mapping a process-wide shared copy of memory
+  // that cannot be remapped from a file.
+  V8_WARN_UNUSED_RESULT static constexpr bool IsRemapSharedCopySupported() {
+#if defined(V8_OS_LINUX) && !defined(V8_OS_ANDROID) && \
+    (defined(V8_TARGET_ARCH_X64) || defined(V8_TARGET_ARCH_ARM64))
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  // Maps a copy of the |size| bytes at |address| at |new_address| with
+  // |access| permissions, rounding the mapping up to whole pages. The copy is
+  // backed by an anonymous shared memory file that is created on first use
+  // and then reused for every alias of the same memory, so that all aliases
+  // share physical pages. The source memory must not change afterwards.
+  //
+  // |new_address| must be page-aligned. If there is already memory mapped at
+  // the target address, it is replaced by the new mapping.
+  //
+  // Must not be called if |IsRemapSharedCopySupported()| returns false.
+  // Returns true for success.
+  V8_WARN_UNUSED_RESULT static bool RemapSharedCopy(const void* address,
+                                                    size_t size,
+                                                    void* new_address,
+                                                    MemoryPermission access);
+
   // Make part of the process's data memory read-only.
   static void SetDataReadOnly(void* address, size_t size);
 
+  // Whether the platform supports merging identical pages of different
+  // processes.
+  V8_WARN_UNUSED_RESULT static constexpr bool IsMergeablePagesSupported() {
+#if defined(V8_OS_LINUX) && !defined(V8_OS_ANDROID)
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  // Marks private anonymous memory as a candidate for merging with pages of
+  // identical content, e.g. in other processes running the same binary. The
+  // pages stay copy-on-write, so later writes are unaffected.
+  //
+  // Must not be called if |IsMergeablePagesSupported()| returns false.
+  // Returns true for success.
+  V8_WARN_UNUSED_RESULT static bool MarkPagesMergeable(void* address,
+                                                       size_t size);
+
+  // Whether the platform supports backing anonymous memory with transparent
+  // huge pages.
+  V8_WARN_UNUSED_RESULT static constexpr bool IsHugePagesSupported() {
+#if defined(V8_OS_LINUX) && !defined(V8_OS_ANDROID)
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  // The size of a transparent huge page on platforms that support them.
+  static constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+  // Asks the kernel to back the given range with transparent huge pages where
+  // whole, suitably aligned huge pages fit into it. The range may still be
+  // inaccessible; the advice applies once it is committed.
+  //
+  // Must not be called if |IsHugePagesSupported()| returns false.
+  // Returns true for success.
+  V8_WARN_UNUSED_RESULT static bool AdviseHugePages(void* address,
+                                                    size_t size);
+
  private:
   // These classes use the private memory management API below.
   friend class AddressSpaceReservation;
@@ -358,6 +426,8 @@ class V8_BASE_EXPORT OS {
   friend class v8::base::PageAllocator;
   friend class v8::base::VirtualAddressSpace;
   friend class v8::base::VirtualAddressSubspace;
+  FRIEND_TEST(OS, AdviseHugePages);
+  FRIEND_TEST(OS, MarkPagesMergeable);
   FRIEND_TEST(OS, RemapPages);
 
   static size_t AllocatePageSize();
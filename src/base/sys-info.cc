@@ -18,6 +18,15 @@
 #include <sys/sysctl.h>
 #endif
 
+#if V8_OS_LINUX
+#include <sched.h>
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
 #include <limits>
 
 #include "src/base/logging.h"
@@ -127,6 +136,107 @@ int64_t SysInfo::AmountOfVirtualMemory() {
 #endif
 }
 
+#if V8_OS_LINUX
+namespace {
+
+// Reads a single positive integer from a cgroup interface file. Returns zero
+// if the file does not exist, cannot be parsed or holds "max" (no limit).
+int64_t ReadCgroupValue(const char* path) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) return 0;
+  char buffer[32] = {0};
+  bool ok = fgets(buffer, sizeof(buffer), file) != nullptr;
+  fclose(file);
+  if (!ok || strncmp(buffer, "max", 3) == 0) return 0;
+  char* end = nullptr;
+  long long value = strtoll(buffer, &end, 10);  // NOLINT(runtime/int)
+  if (end == buffer || value <= 0) return 0;
+  return static_cast<int64_t>(value);
+}
+
+constexpr const char* kCgroupV2MemoryMax = "/sys/fs/cgroup/memory.max";
+constexpr const char* kCgroupV2MemoryCurrent = "/sys/fs/cgroup/memory.current";
+constexpr const char* kCgroupV1MemoryLimit =
+    "/sys/fs/cgroup/memory/memory.limit_in_bytes";
+constexpr const char* kCgroupV1MemoryUsage =
+    "/sys/fs/cgroup/memory/memory.usage_in_bytes";
+constexpr const char* kCgroupV2CpuMax = "/sys/fs/cgroup/cpu.max";
+constexpr const char* kCgroupV1CpuQuota = "/sys/fs/cgroup/cpu/cpu.cfs_quota_us";
+constexpr const char* kCgroupV1CpuPeriod =
+    "/sys/fs/cgroup/cpu/cpu.cfs_period_us";
+
+// Returns the CPU bandwidth quota of the control group in processors, rounded
+// up, or zero if there is none.
+int ReadCgroupCpuQuota() {
+  int64_t quota = 0;
+  int64_t period = 0;
+  // cgroup v2 holds "<quota> <period>", or "max <period>" without a quota.
+  if (FILE* file = fopen(kCgroupV2CpuMax, "r")) {
+    long long v2_quota = 0;   // NOLINT(runtime/int)
+    long long v2_period = 0;  // NOLINT(runtime/int)
+    if (fscanf(file, "%lld %lld", &v2_quota, &v2_period) == 2) {
+      quota = v2_quota;
+      period = v2_period;
+    }
+    fclose(file);
+  } else {
+    // cgroup v1 reports a quota of -1 without a quota.
+    quota = ReadCgroupValue(kCgroupV1CpuQuota);
+    period = ReadCgroupValue(kCgroupV1CpuPeriod);
+  }
+  if (quota <= 0 || period <= 0) return 0;
+  return static_cast<int>(
+      std::min<int64_t>((quota + period - 1) / period,
+                        std::numeric_limits<int>::max()));
+}
+
+}  // namespace
+#endif  // V8_OS_LINUX
+
+// static
+int SysInfo::NumberOfAvailableProcessors() {
+  int processors = NumberOfProcessors();
+#if V8_OS_LINUX
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0) {
+    int affinity_processors = CPU_COUNT(&cpu_set);
+    if (affinity_processors > 0) {
+      processors = std::min(processors, affinity_processors);
+    }
+  }
+  int quota_processors = ReadCgroupCpuQuota();
+  if (quota_processors > 0) processors = std::min(processors, quota_processors);
+#endif
+  return processors;
+}
+
+// static
+int64_t SysInfo::AmountOfContainerMemoryLimit() {
+#if V8_OS_LINUX
+  int64_t limit = ReadCgroupValue(kCgroupV2MemoryMax);
+  if (limit == 0) limit = ReadCgroupValue(kCgroupV1MemoryLimit);
+  // cgroup v1 reports a huge page-aligned value instead of "max" when there is
+  // no limit.
+  int64_t physical_memory = AmountOfPhysicalMemory();
+  if (physical_memory > 0 && limit >= physical_memory) return 0;
+  return limit;
+#else
+  return 0;
+#endif
+}
+
+// static
+int64_t SysInfo::AmountOfContainerMemoryUsage() {
+#if V8_OS_LINUX
+  int64_t usage = ReadCgroupValue(kCgroupV2MemoryCurrent);
+  if (usage == 0) usage = ReadCgroupValue(kCgroupV1MemoryUsage);
+  return usage;
+#else
+  return 0;
+#endif
+}
+
 // static
 uintptr_t SysInfo::AddressSpaceEnd() {
 #if V8_OS_WIN
@@ -18,6 +18,12 @@ class V8_BASE_EXPORT SysInfo final {
   // Returns the number of logical processors/core on the current machine.
   static int NumberOfProcessors();
 
+  // Returns the number of processors this process can actually use: those in
+  // its CPU affinity mask, further limited by the CPU bandwidth quota of its
+  // control group (cgroup v2 cpu.max or cgroup v1 cpu.cfs_quota_us), rounded
+  // up. Same as NumberOfProcessors() where neither is supported.
+  static int NumberOfAvailableProcessors();
+
   // Returns the number of bytes of physical memory on the current machine.
   static int64_t AmountOfPhysicalMemory();
 
@@ -25,6 +31,16 @@ class V8_BASE_EXPORT SysInfo final {
   // value of zero means that there is no limit on the available virtual memory.
   static int64_t AmountOfVirtualMemory();
 
+  // Returns the memory limit in bytes that the control group of this process
+  // imposes on it (cgroup v2 memory.max or cgroup v1 memory.limit_in_bytes).
+  // A return value of zero means that there is no such limit or that it could
+  // not be determined.
+  static int64_t AmountOfContainerMemoryLimit();
+
+  // Returns the number of bytes currently charged to the control group of
+  // this process, or zero if that could not be determined.
+  static int64_t AmountOfContainerMemoryUsage();
+
   // Returns the end of the virtual address space available to this process.
   // Memory mappings at or above this address cannot be addressed by this
   // process, so all pointer values will be below this value.
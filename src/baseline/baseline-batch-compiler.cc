@@ -212,6 +212,8 @@ class ConcurrentBaselineCompiler {
     job_handle_->NotifyConcurrencyIncrease();
   }
 
+  size_t PendingBatchCount() const { return incoming_queue_.size(); }
+
   void InstallBatch() {
     while (!outgoing_queue_.IsEmpty()) {
       std::unique_ptr<BaselineBatchCompilerJob> job;
@@ -351,11 +353,9 @@ bool BaselineBatchCompiler::ShouldCompileBatch(
            shared->DebugNameCStr().get());
     PrintF(trace_scope.file(),
            " with estimated size %d (current budget: %d/%d)\n", estimated_size,
-           estimated_instruction_size_,
-           v8_flags.baseline_batch_compilation_threshold.value());
+           estimated_instruction_size_, BatchCompilationThreshold());
   }
-  if (estimated_instruction_size_ >=
-      v8_flags.baseline_batch_compilation_threshold) {
+  if (estimated_instruction_size_ >= BatchCompilationThreshold()) {
     if (v8_flags.trace_baseline_batch_compilation) {
       CodeTracer::Scope trace_scope(isolate_->GetCodeTracer());
       PrintF(trace_scope.file(),
@@ -368,6 +368,17 @@ bool BaselineBatchCompiler::ShouldCompileBatch(
   return false;
 }
 
+int BaselineBatchCompiler::BatchCompilationThreshold() const {
+  int threshold = v8_flags.baseline_batch_compilation_threshold;
+  if (!concurrent()) return threshold;
+  // Each batch costs a job, a set of persistent handles and an install
+  // interrupt on the main thread. If the background threads can't keep up,
+  // prefer fewer, larger batches.
+  size_t shift = std::min<size_t>(concurrent_compiler_->PendingBatchCount(),
+                                  kMaxBatchCompilationThresholdShift);
+  return threshold << shift;
+}
+
 bool BaselineBatchCompiler::MaybeCompileFunction(MaybeObject maybe_sfi) {
   Tagged<HeapObject> heapobj;
   // Skip functions where the weak reference is no longer valid.
@@ -20,6 +20,9 @@ class ConcurrentBaselineCompiler;
 class BaselineBatchCompiler {
  public:
   static const int kInitialQueueSize = 32;
+  // The batch compilation threshold is doubled for every batch pending
+  // concurrent compilation, up to this many times.
+  static constexpr int kMaxBatchCompilationThresholdShift = 3;
 
   explicit BaselineBatchCompiler(Isolate* isolate);
   ~BaselineBatchCompiler();
@@ -46,6 +49,11 @@ class BaselineBatchCompiler {
   // compiled.
   bool ShouldCompileBatch(Tagged<SharedFunctionInfo> shared);
 
+  // Returns the estimated instruction size at which the current batch is
+  // compiled. This grows with the number of batches still waiting for a
+  // background thread, so that a backlog is worked off in fewer, larger jobs.
+  int BatchCompilationThreshold() const;
+
   // Compiles the current batch.
   void CompileBatch(Handle<JSFunction> function);
 
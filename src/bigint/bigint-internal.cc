@@ -4,6 +4,9 @@
 
 #include "src/bigint/bigint-internal.h"
 
+#include <atomic>
+#include <thread>
+
 namespace v8 {
 namespace bigint {
 
@@ -26,6 +29,69 @@ Status ProcessorImpl::get_and_clear_status() {
   return result;
 }
 
+namespace {
+
+// Shared state of the parts of a ProcessorImpl::RunInParallel invocation.
+class ParallelRun final : public Platform::ParallelTask {
+ public:
+  ParallelRun(Platform* platform,
+              const std::function<void(ProcessorImpl*, int)>& part)
+      : platform_(platform),
+        part_(part),
+        owner_thread_(std::this_thread::get_id()) {}
+
+  void Run(int index) override;
+
+  // Only the owning thread may query the embedder's platform; other threads
+  // learn about interrupts through {interrupted_}.
+  bool InterruptRequested() {
+    if (interrupted_.load(std::memory_order_relaxed)) return true;
+    if (std::this_thread::get_id() == owner_thread_ &&
+        platform_->InterruptRequested()) {
+      interrupted_.store(true, std::memory_order_relaxed);
+      return true;
+    }
+    return false;
+  }
+
+  bool interrupted() const {
+    return interrupted_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  Platform* platform_;
+  const std::function<void(ProcessorImpl*, int)>& part_;
+  const std::thread::id owner_thread_;
+  std::atomic<bool> interrupted_{false};
+};
+
+// The platform of the processors that compute the parts of a ParallelRun.
+// It does not offer worker threads itself, so parts never split further.
+class ParallelRunPlatform final : public Platform {
+ public:
+  explicit ParallelRunPlatform(ParallelRun* run) : run_(run) {}
+
+  bool InterruptRequested() override { return run_->InterruptRequested(); }
+
+ private:
+  ParallelRun* run_;
+};
+
+void ParallelRun::Run(int index) {
+  if (interrupted()) return;
+  ProcessorImpl processor(new ParallelRunPlatform(this));
+  part_(&processor, index);
+}
+
+}  // namespace
+
+void ProcessorImpl::RunInParallel(
+    int count, const std::function<void(ProcessorImpl*, int)>& part) {
+  ParallelRun run(platform_, part);
+  platform_->RunInParallel(&run, count);
+  if (run.interrupted()) status_ = Status::kInterrupted;
+}
+
 Processor* Processor::New(Platform* platform) {
   ProcessorImpl* impl = new ProcessorImpl(platform);
   return static_cast<Processor*>(impl);
@@ -5,6 +5,7 @@
 #ifndef V8_BIGINT_BIGINT_INTERNAL_H_
 #define V8_BIGINT_BIGINT_INTERNAL_H_
 
+#include <functional>
 #include <memory>
 
 #include "src/bigint/bigint.h"
@@ -16,6 +17,9 @@ constexpr int kKaratsubaThreshold = 34;
 constexpr int kToomThreshold = 193;
 constexpr int kFftThreshold = 1500;
 constexpr int kFftInnerThreshold = 200;
+// Minimum combined length of the parts of a top-level FFT for splitting its
+// pointwise multiplications across worker threads.
+constexpr int kFftParallelThreshold = 20000;
 
 constexpr int kBurnikelThreshold = 57;
 constexpr int kNewtonInversionThreshold = 50;
@@ -75,6 +79,16 @@ class ProcessorImpl : public Processor {
 
   bool should_terminate() { return status_ == Status::kInterrupted; }
 
+  int NumberOfWorkerThreads() { return platform_->NumberOfWorkerThreads(); }
+
+  // Calls {part} for every index in [0, count), possibly concurrently on the
+  // platform's worker threads. Each call gets its own processor, whose
+  // interrupt checks are forwarded to this processor's platform. If any part
+  // is interrupted, the remaining ones are skipped or interrupted as well,
+  // and so is this processor.
+  void RunInParallel(int count,
+                     const std::function<void(ProcessorImpl*, int)>& part);
+
   // Each unit is supposed to represent approximately one CPU {mul} instruction.
   // Doesn't need to be accurate; we just want to make sure to check for
   // interrupt requests every now and then (roughly every 10-100 ms; often
@@ -191,6 +191,26 @@ class Platform {
   // a Platform subclass that overrides this method. It will be queried
   // every now and then by long-running operations.
   virtual bool InterruptRequested() { return false; }
+
+  // A computation that has been split into independent parts.
+  class ParallelTask {
+   public:
+    virtual ~ParallelTask() = default;
+    // Computes part {index}. Different parts may run concurrently.
+    virtual void Run(int index) = 0;
+  };
+
+  // If you want very large multiplications (and the divisions built on top
+  // of them) to use several threads, implement a Platform subclass that
+  // returns the number of available worker threads here, and that overrides
+  // {RunInParallel} to call {task->Run(i)} for every i in [0, count) on those
+  // threads. {RunInParallel} must only return once all parts are done. The
+  // calling thread should contribute, since it is the only one on which
+  // {InterruptRequested} will be queried while the parts are running.
+  virtual int NumberOfWorkerThreads() { return 0; }
+  virtual void RunInParallel(ParallelTask* task, int count) {
+    for (int i = 0; i < count; i++) task->Run(i);
+  }
 };
 
 // These are the operations that this library supports.
@@ -463,7 +463,7 @@ class FFTContainer {
 
   void PointwiseMultiply(const FFTContainer& other);
   void DoPointwiseMultiplication(const FFTContainer& other, int start, int end,
-                                 digit_t* temp);
+                                 digit_t* temp, ProcessorImpl* processor);
 
   int length() const { return length_; }
 
@@ -722,7 +722,8 @@ void MultiplyFFT_Inner(RWDigits Z, Digits X, Digits Y, const Parameters& params,
 // Actual implementation of pointwise multiplications.
 void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
                                              int start, int end,
-                                             digit_t* temp) {
+                                             digit_t* temp,
+                                             ProcessorImpl* processor) {
   // The (K_ & 3) != 0 condition makes sure that the inner FFT gets
   // to split the work into at least 4 chunks.
   bool use_fft = length_ >= kFftInnerThreshold && (K_ & 3) == 0;
@@ -733,11 +734,11 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
     Digits A(part_[i], length_);
     Digits B(other.part_[i], length_);
     if (use_fft) {
-      MultiplyFFT_Inner(result, A, B, params, processor_);
+      MultiplyFFT_Inner(result, A, B, params, processor);
     } else {
-      processor_->Multiply(result, A, B);
+      processor->Multiply(result, A, B);
     }
-    if (processor_->should_terminate()) return;
+    if (processor->should_terminate()) return;
     ModFnDoubleWidth(part_[i], result.digits(), length_);
     // To improve cache friendliness, we perform the first level of the
     // backwards FFT here.
@@ -750,7 +751,24 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
 // Convenient entry point for pointwise multiplications.
 void FFTContainer::PointwiseMultiply(const FFTContainer& other) {
   DCHECK(n_ == other.n_);
-  DoPointwiseMultiplication(other, 0, n_, temp_);
+  int tasks = 1;
+  if (length_ * n_ >= kFftParallelThreshold) {
+    tasks = std::min(processor_->NumberOfWorkerThreads() + 1, n_ / 2);
+  }
+  if (tasks <= 1) {
+    return DoPointwiseMultiplication(other, 0, n_, temp_, processor_);
+  }
+  // The parts are independent, except that the first level of the backwards
+  // FFT combines each odd part with its predecessor, so each task has to
+  // start at an even part.
+  int parts_per_task = RoundUp(DIV_CEIL(n_, tasks), 2);
+  processor_->RunInParallel(tasks, [&](ProcessorImpl* processor, int index) {
+    int start = index * parts_per_task;
+    int end = std::min(start + parts_per_task, n_);
+    if (start >= end) return;
+    std::unique_ptr<digit_t[]> temp(new digit_t[2 * length_]);
+    DoPointwiseMultiplication(other, start, end, temp.get(), processor);
+  });
 }
 
 }  // namespace
@@ -60,10 +60,13 @@ inline bool HasOnlySimpleElements(Isolate* isolate,
 
 // This method may transition the elements kind of the JSArray once, to make
 // sure that all elements provided as arguments in the specified range can be
-// added without further elements kinds transitions.
+// added without further elements kinds transitions. If the arguments are going
+// to be added to the array ({adds_elements}), the backing store is grown along
+// with the transition so that it is copied only once.
 void MatchArrayElementsKindToArguments(Isolate* isolate, Handle<JSArray> array,
                                        BuiltinArguments* args,
-                                       int first_arg_index, int num_arguments) {
+                                       int first_arg_index, int num_arguments,
+                                       bool adds_elements) {
   int args_length = args->length();
   if (first_arg_index >= args_length) return;
 
@@ -92,6 +95,25 @@ void MatchArrayElementsKindToArguments(Isolate* isolate, Handle<JSArray> array,
     // Use a short-lived HandleScope to avoid creating several copies of the
     // elements handle which would cause issues when left-trimming later-on.
     HandleScope scope(isolate);
+    target_kind =
+        JSObject::GetAllocationSiteTransitionTarget(array, target_kind);
+    if (adds_elements &&
+        IsDoubleElementsKind(origin_kind) != IsDoubleElementsKind(target_kind)) {
+      uint32_t capacity = static_cast<uint32_t>(array->elements()->length());
+      uint32_t new_length = static_cast<uint32_t>(Smi::ToInt(array->length())) +
+                            static_cast<uint32_t>(num_arguments);
+      uint32_t new_capacity = JSObject::NewElementsCapacity(new_length);
+      uint32_t max_length = IsDoubleElementsKind(target_kind)
+                                ? FixedDoubleArray::kMaxLength
+                                : FixedArray::kMaxLength;
+      if (capacity > 0 && new_length > capacity &&
+          new_capacity <= max_length) {
+        ElementsAccessor::ForKind(target_kind)
+            ->GrowCapacityAndConvert(array, new_capacity)
+            .Check();
+        return;
+      }
+    }
     JSObject::TransitionElementsKind(array, target_kind);
   }
 }
@@ -104,7 +126,8 @@ inline bool EnsureJSArrayWithWritableFastElements(Isolate* isolate,
                                                   Handle<Object> receiver,
                                                   BuiltinArguments* args,
                                                   int first_arg_index,
-                                                  int num_arguments) {
+                                                  int num_arguments,
+                                                  bool adds_elements) {
   if (!IsJSArray(*receiver)) return false;
   Handle<JSArray> array = Handle<JSArray>::cast(receiver);
   ElementsKind origin_kind = array->GetElementsKind();
@@ -123,7 +146,7 @@ inline bool EnsureJSArrayWithWritableFastElements(Isolate* isolate,
   // Need to ensure that the arguments passed in args can be contained in
   // the array.
   MatchArrayElementsKindToArguments(isolate, array, args, first_arg_index,
-                                    num_arguments);
+                                    num_arguments, adds_elements);
   return true;
 }
 
@@ -219,7 +242,8 @@ V8_WARN_UNUSED_RESULT Maybe<bool> TryFastArrayFill(
   if (end_index > kMaxUInt32) return Just(false);
   if (!IsJSObject(*receiver)) return Just(false);
 
-  if (!EnsureJSArrayWithWritableFastElements(isolate, receiver, args, 1, 1)) {
+  if (!EnsureJSArrayWithWritableFastElements(isolate, receiver, args, 1, 1,
+                                             false)) {
     return Just(false);
   }
 
@@ -381,7 +405,7 @@ BUILTIN(ArrayPush) {
   HandleScope scope(isolate);
   Handle<Object> receiver = args.receiver();
   if (!EnsureJSArrayWithWritableFastElements(isolate, receiver, &args, 1,
-                                             args.length() - 1)) {
+                                             args.length() - 1, true)) {
     return GenericArrayPush(isolate, &args);
   }
 
@@ -471,7 +495,7 @@ BUILTIN(ArrayPop) {
   HandleScope scope(isolate);
   Handle<Object> receiver = args.receiver();
   if (!EnsureJSArrayWithWritableFastElements(isolate, receiver, nullptr, 0,
-                                             0)) {
+                                             0, false)) {
     return GenericArrayPop(isolate, &args);
   }
   Handle<JSArray> array = Handle<JSArray>::cast(receiver);
@@ -518,7 +542,7 @@ V8_WARN_UNUSED_RESULT bool CanUseFastArrayShift(Isolate* isolate,
   if (V8_COMPRESS_POINTERS_8GB_BOOL) return false;
 
   if (!EnsureJSArrayWithWritableFastElements(isolate, receiver, nullptr, 0,
-                                             0) ||
+                                             0, false) ||
       !IsJSArrayFastElementMovingAllowed(isolate, JSArray::cast(*receiver))) {
     return false;
   }
@@ -637,7 +661,7 @@ BUILTIN(ArrayUnshift) {
   DCHECK(!isolate->IsAnyInitialArrayPrototype(*array));
 
   MatchArrayElementsKindToArguments(isolate, array, &args, 1,
-                                    args.length() - 1);
+                                    args.length() - 1, true);
 
   int to_add = args.length() - 1;
   if (to_add == 0) return array->length();
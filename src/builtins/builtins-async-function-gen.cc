@@ -139,6 +139,12 @@ TF_BUILTIN(AsyncFunctionEnter, AsyncFunctionBuiltinsAssembler) {
       parameters_and_registers);
   StoreObjectFieldNoWriteBarrier(
       async_function_object, JSAsyncFunctionObject::kPromiseOffset, promise);
+  StoreObjectFieldRoot(async_function_object,
+                       JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+                       RootIndex::kUndefinedValue);
+  StoreObjectFieldRoot(async_function_object,
+                       JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+                       RootIndex::kUndefinedValue);
 
   // While we are executing an async function, we need to have the implicit
   // promise on the stack to get the catch prediction right, even before we
@@ -237,14 +243,43 @@ void AsyncFunctionBuiltinsAssembler::AsyncFunctionAwait(
   auto value = Parameter<Object>(Descriptor::kValue);
   auto context = Parameter<Context>(Descriptor::kContext);
 
-  TNode<SharedFunctionInfo> on_resolve_sfi =
-      AsyncFunctionAwaitResolveSharedFunConstant();
-  TNode<SharedFunctionInfo> on_reject_sfi =
-      AsyncFunctionAwaitRejectSharedFunConstant();
   TNode<JSPromise> outer_promise = LoadObjectField<JSPromise>(
       async_function_object, JSAsyncFunctionObject::kPromiseOffset);
-  Await(context, async_function_object, value, outer_promise, on_resolve_sfi,
-        on_reject_sfi, is_predicted_as_caught);
+
+  // The resume closures only depend on the {async_function_object}, so they
+  // are created on the first await and reused afterwards.
+  TVARIABLE(JSFunction, var_on_resolve);
+  TVARIABLE(JSFunction, var_on_reject);
+  Label if_closures_missing(this, Label::kDeferred), if_closures_done(this);
+  TNode<Object> cached_on_resolve = LoadObjectField(
+      async_function_object, JSAsyncFunctionObject::kAwaitResolveClosureOffset);
+  GotoIf(IsUndefined(cached_on_resolve), &if_closures_missing);
+  var_on_resolve = CAST(cached_on_resolve);
+  var_on_reject = LoadObjectField<JSFunction>(
+      async_function_object, JSAsyncFunctionObject::kAwaitRejectClosureOffset);
+  Goto(&if_closures_done);
+
+  BIND(&if_closures_missing);
+  {
+    TNode<Context> closure_context =
+        AllocateAwaitClosureContext(context, async_function_object);
+    var_on_resolve = AllocateAwaitClosure(
+        context, closure_context, AsyncFunctionAwaitResolveSharedFunConstant());
+    var_on_reject = AllocateAwaitClosure(
+        context, closure_context, AsyncFunctionAwaitRejectSharedFunConstant());
+    StoreObjectField(async_function_object,
+                     JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+                     var_on_resolve.value());
+    StoreObjectField(async_function_object,
+                     JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+                     var_on_reject.value());
+    Goto(&if_closures_done);
+  }
+
+  BIND(&if_closures_done);
+  Await(context, async_function_object, value, outer_promise,
+        var_on_resolve.value(), var_on_reject.value(),
+        BooleanConstant(is_predicted_as_caught));
 
   // Return outer promise to avoid adding an load of the outer promise before
   // suspending in BytecodeGenerator.
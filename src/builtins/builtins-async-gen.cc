@@ -30,91 +30,42 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     TNode<Boolean> is_predicted_as_caught) {
   const TNode<NativeContext> native_context = LoadNativeContext(context);
 
-  // We do the `PromiseResolve(%Promise%,value)` avoiding to unnecessarily
-  // create wrapper promises. Now if {value} is already a promise with the
-  // intrinsics %Promise% constructor as its "constructor", we don't need
-  // to allocate the wrapper promise.
-  {
-    TVARIABLE(Object, var_value, value);
-    Label if_slow_path(this, Label::kDeferred), if_done(this),
-        if_slow_constructor(this, Label::kDeferred);
-    GotoIf(TaggedIsSmi(value), &if_slow_path);
-    TNode<HeapObject> value_object = CAST(value);
-    const TNode<Map> value_map = LoadMap(value_object);
-    GotoIfNot(IsJSPromiseMap(value_map), &if_slow_path);
-    // We can skip the "constructor" lookup on {value} if it's [[Prototype]]
-    // is the (initial) Promise.prototype and the @@species protector is
-    // intact, as that guards the lookup path for "constructor" on
-    // JSPromise instances which have the (initial) Promise.prototype.
-    const TNode<Object> promise_prototype =
-        LoadContextElement(native_context, Context::PROMISE_PROTOTYPE_INDEX);
-    GotoIfNot(TaggedEqual(LoadMapPrototype(value_map), promise_prototype),
-              &if_slow_constructor);
-    Branch(IsPromiseSpeciesProtectorCellInvalid(), &if_slow_constructor,
-           &if_done);
-
-    // At this point, {value} doesn't have the initial promise prototype or
-    // the promise @@species protector was invalidated, but {value} could still
-    // have the %Promise% as its "constructor", so we need to check that as
-    // well.
-    BIND(&if_slow_constructor);
-    {
-      const TNode<Object> value_constructor = GetProperty(
-          context, value, isolate()->factory()->constructor_string());
-      const TNode<Object> promise_function =
-          LoadContextElement(native_context, Context::PROMISE_FUNCTION_INDEX);
-      Branch(TaggedEqual(value_constructor, promise_function), &if_done,
-             &if_slow_path);
-    }
-
-    BIND(&if_slow_path);
-    {
-      // We need to mark the {value} wrapper as having {outer_promise}
-      // as its parent, which is why we need to inline a good chunk of
-      // logic from the `PromiseResolve` builtin here.
-      var_value = NewJSPromise(native_context, outer_promise);
-      CallBuiltin(Builtin::kResolvePromise, native_context, var_value.value(),
-                  value);
-      Goto(&if_done);
-    }
-
-    BIND(&if_done);
-    value = var_value.value();
-  }
-
-  static const int kClosureContextSize =
-      FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
   TNode<Context> closure_context =
-      UncheckedCast<Context>(AllocateInNewSpace(kClosureContextSize));
+      AllocateAwaitClosureContext(native_context, generator);
+  TNode<JSFunction> on_resolve =
+      AllocateAwaitClosure(native_context, closure_context, on_resolve_sfi);
+  TNode<JSFunction> on_reject =
+      AllocateAwaitClosure(native_context, closure_context, on_reject_sfi);
+  return Await(context, generator, value, outer_promise, on_resolve, on_reject,
+               is_predicted_as_caught);
+}
+
+TNode<Object> AsyncBuiltinsAssembler::Await(
+    TNode<Context> context, TNode<JSGeneratorObject> generator,
+    TNode<Object> value, TNode<JSPromise> outer_promise,
+    TNode<JSFunction> on_resolve, TNode<JSFunction> on_reject,
+    TNode<Boolean> is_predicted_as_caught) {
+  const TNode<NativeContext> native_context = LoadNativeContext(context);
+  TNode<Uint32T> promiseHookFlags = PromiseHookFlags();
+
+  // Awaiting a value that is not a JSReceiver wraps it into a fulfilled
+  // promise, which nothing can observe unless promise hooks or the debugger
+  // are active. Schedule the continuation directly in that case.
+  TVARIABLE(Object, var_result);
+  Label if_primitive(this), if_generic(this), done(this);
+  GotoIf(NeedsAnyPromiseHooks(promiseHookFlags), &if_generic);
+  GotoIf(TaggedIsSmi(value), &if_primitive);
+  Branch(IsJSReceiver(CAST(value)), &if_generic, &if_primitive);
+
+  BIND(&if_primitive);
   {
-    // Initialize the await context, storing the {generator} as extension.
-    TNode<Map> map = CAST(
-        LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
-    StoreMapNoWriteBarrier(closure_context, map);
-    StoreObjectFieldNoWriteBarrier(
-        closure_context, Context::kLengthOffset,
-        SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
-    const TNode<Object> empty_scope_info =
-        LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
-    StoreContextElementNoWriteBarrier(
-        closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
-    StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
-                                      native_context);
-    StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
-                                      generator);
+    EnqueuePromiseFulfillReactionJob(context, value, on_resolve, on_reject);
+    var_result = UndefinedConstant();
+    Goto(&done);
   }
 
-  // Allocate and initialize resolve handler
-  TNode<HeapObject> on_resolve =
-      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
-  InitializeNativeClosure(closure_context, native_context, on_resolve,
-                          on_resolve_sfi);
-
-  // Allocate and initialize reject handler
-  TNode<HeapObject> on_reject =
-      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
-  InitializeNativeClosure(closure_context, native_context, on_reject,
-                          on_reject_sfi);
+  BIND(&if_generic);
+  value = PromiseResolveForAwait(context, value, outer_promise);
 
   // Deal with PromiseHooks and debug support in the runtime. This
   // also allocates the throwaway promise, which is only needed in
@@ -122,7 +73,6 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   TVARIABLE(Object, var_throwaway, UndefinedConstant());
   Label if_instrumentation(this, Label::kDeferred),
       if_instrumentation_done(this);
-  TNode<Uint32T> promiseHookFlags = PromiseHookFlags();
   GotoIf(IsIsolatePromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(
              promiseHookFlags),
          &if_instrumentation);
@@ -145,8 +95,103 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   }
   BIND(&if_instrumentation_done);
 
-  return CallBuiltin(Builtin::kPerformPromiseThen, native_context, value,
-                     on_resolve, on_reject, var_throwaway.value());
+  var_result = CallBuiltin(Builtin::kPerformPromiseThen, native_context, value,
+                           on_resolve, on_reject, var_throwaway.value());
+  Goto(&done);
+
+  BIND(&done);
+  return var_result.value();
+}
+
+TNode<Object> AsyncBuiltinsAssembler::PromiseResolveForAwait(
+    TNode<Context> context, TNode<Object> value,
+    TNode<JSPromise> outer_promise) {
+  const TNode<NativeContext> native_context = LoadNativeContext(context);
+
+  // We do the `PromiseResolve(%Promise%,value)` avoiding to unnecessarily
+  // create wrapper promises. Now if {value} is already a promise with the
+  // intrinsics %Promise% constructor as its "constructor", we don't need
+  // to allocate the wrapper promise.
+  TVARIABLE(Object, var_value, value);
+  Label if_slow_path(this, Label::kDeferred), if_done(this),
+      if_slow_constructor(this, Label::kDeferred);
+  GotoIf(TaggedIsSmi(value), &if_slow_path);
+  TNode<HeapObject> value_object = CAST(value);
+  const TNode<Map> value_map = LoadMap(value_object);
+  GotoIfNot(IsJSPromiseMap(value_map), &if_slow_path);
+  // We can skip the "constructor" lookup on {value} if it's [[Prototype]]
+  // is the (initial) Promise.prototype and the @@species protector is
+  // intact, as that guards the lookup path for "constructor" on
+  // JSPromise instances which have the (initial) Promise.prototype.
+  const TNode<Object> promise_prototype =
+      LoadContextElement(native_context, Context::PROMISE_PROTOTYPE_INDEX);
+  GotoIfNot(TaggedEqual(LoadMapPrototype(value_map), promise_prototype),
+            &if_slow_constructor);
+  Branch(IsPromiseSpeciesProtectorCellInvalid(), &if_slow_constructor,
+         &if_done);
+
+  // At this point, {value} doesn't have the initial promise prototype or
+  // the promise @@species protector was invalidated, but {value} could still
+  // have the %Promise% as its "constructor", so we need to check that as
+  // well.
+  BIND(&if_slow_constructor);
+  {
+    const TNode<Object> value_constructor = GetProperty(
+        context, value, isolate()->factory()->constructor_string());
+    const TNode<Object> promise_function =
+        LoadContextElement(native_context, Context::PROMISE_FUNCTION_INDEX);
+    Branch(TaggedEqual(value_constructor, promise_function), &if_done,
+           &if_slow_path);
+  }
+
+  BIND(&if_slow_path);
+  {
+    // We need to mark the {value} wrapper as having {outer_promise}
+    // as its parent, which is why we need to inline a good chunk of
+    // logic from the `PromiseResolve` builtin here.
+    var_value = NewJSPromise(native_context, outer_promise);
+    CallBuiltin(Builtin::kResolvePromise, native_context, var_value.value(),
+                value);
+    Goto(&if_done);
+  }
+
+  BIND(&if_done);
+  return var_value.value();
+}
+
+TNode<Context> AsyncBuiltinsAssembler::AllocateAwaitClosureContext(
+    TNode<Context> context, TNode<JSGeneratorObject> generator) {
+  const TNode<NativeContext> native_context = LoadNativeContext(context);
+  static const int kClosureContextSize =
+      FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
+  TNode<Context> closure_context =
+      UncheckedCast<Context>(AllocateInNewSpace(kClosureContextSize));
+  // Initialize the await context, storing the {generator} as extension.
+  TNode<Map> map = CAST(
+      LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
+  StoreMapNoWriteBarrier(closure_context, map);
+  StoreObjectFieldNoWriteBarrier(
+      closure_context, Context::kLengthOffset,
+      SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
+  const TNode<Object> empty_scope_info =
+      LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
+  StoreContextElementNoWriteBarrier(
+      closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
+  StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
+                                    native_context);
+  StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
+                                    generator);
+  return closure_context;
+}
+
+TNode<JSFunction> AsyncBuiltinsAssembler::AllocateAwaitClosure(
+    TNode<Context> context, TNode<Context> closure_context,
+    TNode<SharedFunctionInfo> shared_info) {
+  TNode<HeapObject> closure =
+      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
+  InitializeNativeClosure(closure_context, LoadNativeContext(context), closure,
+                          shared_info);
+  return CAST(closure);
 }
 
 void AsyncBuiltinsAssembler::InitializeNativeClosure(
@@ -36,6 +36,21 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
     return Await(context, generator, value, outer_promise, on_resolve_sfi,
                  on_reject_sfi, BooleanConstant(is_predicted_as_caught));
   }
+  // Same as above, but with already allocated `on_resolve` and `on_reject`
+  // closures, which allows callers to reuse them across multiple awaits.
+  TNode<Object> Await(TNode<Context> context,
+                      TNode<JSGeneratorObject> generator, TNode<Object> value,
+                      TNode<JSPromise> outer_promise,
+                      TNode<JSFunction> on_resolve, TNode<JSFunction> on_reject,
+                      TNode<Boolean> is_predicted_as_caught);
+
+  // Allocate the context shared by the await closures of {generator}, and the
+  // closures themselves.
+  TNode<Context> AllocateAwaitClosureContext(
+      TNode<Context> context, TNode<JSGeneratorObject> generator);
+  TNode<JSFunction> AllocateAwaitClosure(TNode<Context> context,
+                                         TNode<Context> closure_context,
+                                         TNode<SharedFunctionInfo> shared_info);
 
   // Return a new built-in function object as defined in
   // Async Iterator Value Unwrap Functions
@@ -47,6 +62,9 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
                                TNode<NativeContext> native_context,
                                TNode<HeapObject> function,
                                TNode<SharedFunctionInfo> shared_info);
+  TNode<Object> PromiseResolveForAwait(TNode<Context> context,
+                                       TNode<Object> value,
+                                       TNode<JSPromise> outer_promise);
   TNode<Context> AllocateAsyncIteratorValueUnwrapContext(
       TNode<NativeContext> native_context, TNode<Boolean> done);
 };
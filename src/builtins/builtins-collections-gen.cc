@@ -76,15 +76,10 @@ void BaseCollectionsAssembler::AddConstructorEntries(
   BIND(&if_fast_js_array);
   {
     var_mode = Int32Constant(kFastJSArray);
-    if (variant == kWeakSet || variant == kWeakMap) {
-      var_at_least_space_for =
-          PositiveSmiUntag(LoadFastJSArrayLength(CAST(initial_entries)));
-    } else {
-      // TODO(ishell): consider using array length for all collections
-      static_assert(OrderedHashSet::kInitialCapacity ==
-                    OrderedHashMap::kInitialCapacity);
-      var_at_least_space_for = IntPtrConstant(OrderedHashSet::kInitialCapacity);
-    }
+    // Presize the table so that adding the entries doesn't repeatedly grow
+    // it. Duplicate keys are handled by ShrinkPresizedTableIfNeeded below.
+    var_at_least_space_for =
+        PositiveSmiUntag(LoadFastJSArrayLength(CAST(initial_entries)));
     Goto(&allocate_table);
   }
   TVARIABLE(JSReceiver, var_iterator_object);
@@ -123,6 +118,7 @@ void BaseCollectionsAssembler::AddConstructorEntries(
           variant, context, native_context, collection, initial_entries_jsarray,
           &if_may_have_side_effects, var_index);
     }
+    ShrinkPresizedTableIfNeeded(variant, context, collection);
     Goto(&exit);
 
     if (variant == kMap || variant == kWeakMap) {
@@ -738,15 +734,60 @@ TNode<HeapObject> CollectionsBuiltinsAssembler::AllocateJSCollectionIterator(
 
 TNode<HeapObject> CollectionsBuiltinsAssembler::AllocateTable(
     Variant variant, TNode<IntPtrT> at_least_space_for) {
+  // Counterpart to OrderedHashTable::Allocate: the buckets already provide the
+  // slack, so the capacity only needs to be a power of two. Requests beyond
+  // the maximum capacity start out at the largest possible table and are left
+  // to the usual growth path to throw.
+  static_assert(OrderedHashSet::kInitialCapacity ==
+                OrderedHashMap::kInitialCapacity);
+  const int max_capacity = static_cast<int>(base::bits::RoundDownToPowerOfTwo32(
+      variant == kMap ? OrderedHashMap::MaxCapacity()
+                      : OrderedHashSet::MaxCapacity()));
+  TNode<IntPtrT> capacity = IntPtrRoundUpToPowerOfTwo32(IntPtrMax(
+      IntPtrMin(at_least_space_for, IntPtrConstant(max_capacity)),
+      IntPtrConstant(OrderedHashSet::kInitialCapacity)));
   if (variant == kMap) {
-    return AllocateOrderedHashMap();
+    return AllocateOrderedHashMap(capacity);
   } else {
     DCHECK_EQ(variant, kSet);
-    TNode<IntPtrT> capacity = HashTableComputeCapacity(at_least_space_for);
     return AllocateOrderedHashSet(capacity);
   }
 }
 
+void CollectionsBuiltinsAssembler::ShrinkPresizedTableIfNeeded(
+    Variant variant, TNode<Context> context, TNode<HeapObject> collection) {
+  DCHECK(variant == kMap || variant == kSet);
+  static_assert(OrderedHashMap::NumberOfBucketsIndex() ==
+                OrderedHashSet::NumberOfBucketsIndex());
+  static_assert(OrderedHashMap::NumberOfElementsIndex() ==
+                OrderedHashSet::NumberOfElementsIndex());
+  const TNode<FixedArray> table =
+      LoadObjectField<FixedArray>(collection, GetTableOffset(variant));
+  const TNode<Smi> number_of_elements = CAST(UnsafeLoadFixedArrayElement(
+      table, OrderedHashMap::NumberOfElementsIndex()));
+  const TNode<Smi> number_of_buckets = CAST(UnsafeLoadFixedArrayElement(
+      table, OrderedHashMap::NumberOfBucketsIndex()));
+
+  // Same heuristic as when deleting entries: shrink if there are fewer
+  // elements than #buckets / 2. Tables of the initial size can't shrink.
+  Label shrink(this, Label::kDeferred), done(this);
+  GotoIf(SmiLessThanOrEqual(
+             number_of_buckets,
+             SmiConstant(OrderedHashMap::kInitialCapacity /
+                         OrderedHashMap::kLoadFactor)),
+         &done);
+  Branch(SmiLessThan(SmiAdd(number_of_elements, number_of_elements),
+                     number_of_buckets),
+         &shrink, &done);
+
+  BIND(&shrink);
+  CallRuntime(variant == kMap ? Runtime::kMapShrink : Runtime::kSetShrink,
+              context, collection);
+  Goto(&done);
+
+  BIND(&done);
+}
+
 TF_BUILTIN(MapConstructor, CollectionsBuiltinsAssembler) {
   auto new_target = Parameter<Object>(Descriptor::kJSNewTarget);
   TNode<IntPtrT> argc = ChangeInt32ToIntPtr(
@@ -1191,7 +1232,8 @@ void CollectionsBuiltinsAssembler::FindOrderedHashTableEntryForStringKey(
   FindOrderedHashTableEntry<CollectionType>(
       table, hash,
       [&](TNode<Object> other_key, Label* if_same, Label* if_not_same) {
-        SameValueZeroString(key_tagged, other_key, if_same, if_not_same);
+        SameValueZeroString(key_tagged, hash, other_key, if_same,
+                            if_not_same);
       },
       result, entry_found, not_found);
 }
@@ -1257,13 +1299,28 @@ TNode<Uint32T> CollectionsBuiltinsAssembler::ComputeStringHash(
 }
 
 void CollectionsBuiltinsAssembler::SameValueZeroString(
-    TNode<String> key_string, TNode<Object> candidate_key, Label* if_same,
-    Label* if_not_same) {
+    TNode<String> key_string, TNode<Uint32T> key_hash,
+    TNode<Object> candidate_key, Label* if_same, Label* if_not_same) {
   // If the candidate is not a string, the keys are not equal.
   GotoIf(TaggedIsSmi(candidate_key), if_not_same);
   GotoIfNot(IsString(CAST(candidate_key)), if_not_same);
 
   GotoIf(TaggedEqual(key_string, candidate_key), if_same);
+
+  // Strings sharing a bucket usually have different hashes. The candidate's
+  // hash field sits next to its map, which was just loaded, so comparing the
+  // hashes rejects most candidates without comparing their contents.
+  Label compare_strings(this);
+  TNode<Uint32T> candidate_raw_hash_field =
+      LoadNameRawHashField(CAST(candidate_key));
+  GotoIf(IsSetWord32(candidate_raw_hash_field, Name::kHashNotComputedMask),
+         &compare_strings);
+  GotoIf(Word32NotEqual(DecodeWord32<Name::HashBits>(candidate_raw_hash_field),
+                        key_hash),
+         if_not_same);
+  Goto(&compare_strings);
+
+  BIND(&compare_strings);
   BranchIfStringEqual(key_string, CAST(candidate_key), if_same, if_not_same);
 }
 
@@ -91,6 +91,13 @@ class BaseCollectionsAssembler : public CodeStubAssembler {
   virtual TNode<HeapObject> AllocateTable(
       Variant variant, TNode<IntPtrT> at_least_space_for) = 0;
 
+  // Called once the entries of a fast JSArray have been added to a collection
+  // whose backing store was presized from the array length. Gives back the
+  // unused space if the array contained many duplicate keys.
+  virtual void ShrinkPresizedTableIfNeeded(Variant variant,
+                                           TNode<Context> context,
+                                           TNode<HeapObject> collection) {}
+
   // Main entry point for a collection constructor builtin.
   void GenerateConstructor(Variant variant,
                            Handle<String> constructor_function_name,
@@ -231,6 +238,8 @@ class CollectionsBuiltinsAssembler : public BaseCollectionsAssembler {
       const TNode<HeapObject> collection);
   TNode<HeapObject> AllocateTable(Variant variant,
                                   TNode<IntPtrT> at_least_space_for) override;
+  void ShrinkPresizedTableIfNeeded(Variant variant, TNode<Context> context,
+                                   TNode<HeapObject> collection) override;
   TNode<Uint32T> GetHash(const TNode<HeapObject> key);
   TNode<Uint32T> CallGetHashRaw(const TNode<HeapObject> key);
   TNode<Smi> CallGetOrCreateHashRaw(const TNode<HeapObject> key);
@@ -328,7 +337,7 @@ class CollectionsBuiltinsAssembler : public BaseCollectionsAssembler {
                                              Label* entry_found,
                                              Label* not_found);
   TNode<Uint32T> ComputeStringHash(TNode<String> string_key);
-  void SameValueZeroString(TNode<String> key_string,
+  void SameValueZeroString(TNode<String> key_string, TNode<Uint32T> key_hash,
                            TNode<Object> candidate_key, Label* if_same,
                            Label* if_not_same);
 
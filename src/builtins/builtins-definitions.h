@@ -336,6 +336,8 @@ namespace internal {
   /* Object property helpers */                                                \
   TFS(HasProperty, NeedsContext::kYes, kObject, kKey)                          \
   TFS(DeleteProperty, NeedsContext::kYes, kObject, kKey, kLanguageMode)        \
+  /* Makes a value shareable before it is stored into a shared object */      \
+  TFS(SharedValueBarrier, NeedsContext::kYes, kValue)                          \
   /* ES #sec-copydataproperties */                                             \
   TFS(CopyDataProperties, NeedsContext::kYes, kTarget, kSource)                \
   TFS(SetDataProperties, NeedsContext::kYes, kTarget, kSource)                 \
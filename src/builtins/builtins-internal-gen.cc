@@ -1160,6 +1160,15 @@ TF_BUILTIN(SetDataProperties, SetOrCopyDataPropertiesAssembler) {
   TailCallRuntime(Runtime::kSetDataProperties, context, target, source);
 }
 
+TF_BUILTIN(SharedValueBarrier, CodeStubAssembler) {
+  auto value = Parameter<Object>(Descriptor::kValue);
+  auto context = Parameter<Context>(Descriptor::kContext);
+
+  TVARIABLE(Object, var_shared_value, value);
+  SharedValueBarrier(context, &var_shared_value);
+  Return(var_shared_value.value());
+}
+
 TF_BUILTIN(ForInEnumerate, CodeStubAssembler) {
   auto receiver = Parameter<JSReceiver>(Descriptor::kReceiver);
   auto context = Parameter<Context>(Descriptor::kContext);
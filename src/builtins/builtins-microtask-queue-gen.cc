@@ -578,9 +578,22 @@ TF_BUILTIN(EnqueueMicrotask, MicrotaskQueueBuiltinsAssembler) {
     StoreNoWriteBarrier(MachineType::PointerRepresentation(), ring_buffer,
                         CalculateRingBufferOffset(capacity, start, size),
                         BitcastTaggedToWord(microtask));
+    TNode<IntPtrT> new_size = IntPtrAdd(size, IntPtrConstant(1));
     StoreNoWriteBarrier(MachineType::PointerRepresentation(), microtask_queue,
-                        IntPtrConstant(MicrotaskQueue::kSizeOffset),
-                        IntPtrAdd(size, IntPtrConstant(1)));
+                        IntPtrConstant(MicrotaskQueue::kSizeOffset), new_size);
+
+    Label if_new_high_water_mark(this, Label::kDeferred);
+    TNode<IntPtrT> high_water_mark = Load<IntPtrT>(
+        microtask_queue,
+        IntPtrConstant(MicrotaskQueue::kSizeHighWaterMarkOffset));
+    GotoIf(IntPtrGreaterThan(new_size, high_water_mark),
+           &if_new_high_water_mark);
+    Return(UndefinedConstant());
+
+    BIND(&if_new_high_water_mark);
+    StoreNoWriteBarrier(
+        MachineType::PointerRepresentation(), microtask_queue,
+        IntPtrConstant(MicrotaskQueue::kSizeHighWaterMarkOffset), new_size);
     Return(UndefinedConstant());
   }
 
@@ -298,7 +298,7 @@ void TypedArrayBuiltinsAssembler::CallCMemmove(TNode<RawPtrT> dest_ptr,
                                                TNode<RawPtrT> src_ptr,
                                                TNode<UintPtrT> byte_length) {
   TNode<ExternalReference> memmove =
-      ExternalConstant(ExternalReference::libc_memmove_function());
+      ExternalConstant(ExternalReference::parallel_memmove_function());
   CallCFunction(memmove, MachineType::AnyTagged(),
                 std::make_pair(MachineType::Pointer(), dest_ptr),
                 std::make_pair(MachineType::Pointer(), src_ptr),
@@ -319,8 +319,9 @@ void TypedArrayBuiltinsAssembler::CallCRelaxedMemmove(
 void TypedArrayBuiltinsAssembler::CallCMemcpy(TNode<RawPtrT> dest_ptr,
                                               TNode<RawPtrT> src_ptr,
                                               TNode<UintPtrT> byte_length) {
+  // Non-overlapping, so the (possibly parallel) memmove has memcpy semantics.
   TNode<ExternalReference> memcpy =
-      ExternalConstant(ExternalReference::libc_memcpy_function());
+      ExternalConstant(ExternalReference::parallel_memmove_function());
   CallCFunction(memcpy, MachineType::AnyTagged(),
                 std::make_pair(MachineType::Pointer(), dest_ptr),
                 std::make_pair(MachineType::Pointer(), src_ptr),
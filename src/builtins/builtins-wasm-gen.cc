@@ -68,6 +68,13 @@ TNode<NativeContext> WasmBuiltinsAssembler::LoadContextFromInstanceData(
                           kHeapObjectTag)));
 }
 
+TNode<WasmInstanceObject>
+WasmBuiltinsAssembler::LoadInstanceObjectFromInstanceData(
+    TNode<WasmTrustedInstanceData> trusted_data) {
+  return LoadObjectField<WasmInstanceObject>(
+      trusted_data, WasmTrustedInstanceData::kInstanceObjectOffset);
+}
+
 TNode<FixedArray> WasmBuiltinsAssembler::LoadTablesFromInstanceData(
     TNode<WasmTrustedInstanceData> trusted_data) {
   return LoadObjectField<FixedArray>(trusted_data,
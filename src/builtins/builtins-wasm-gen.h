@@ -25,6 +25,9 @@ class WasmBuiltinsAssembler : public CodeStubAssembler {
   TNode<NativeContext> LoadContextFromInstanceData(
       TNode<WasmTrustedInstanceData>);
 
+  TNode<WasmInstanceObject> LoadInstanceObjectFromInstanceData(
+      TNode<WasmTrustedInstanceData>);
+
   TNode<FixedArray> LoadTablesFromInstanceData(TNode<WasmTrustedInstanceData>);
 
   TNode<FixedArray> LoadInternalFunctionsFromInstanceData(
@@ -4393,6 +4393,11 @@ TNode<OrderedHashMap> CodeStubAssembler::AllocateOrderedHashMap() {
       IntPtrConstant(OrderedHashMap::kInitialCapacity));
 }
 
+TNode<OrderedHashMap> CodeStubAssembler::AllocateOrderedHashMap(
+    TNode<IntPtrT> capacity) {
+  return AllocateOrderedHashTableWithCapacity<OrderedHashMap>(capacity);
+}
+
 TNode<JSObject> CodeStubAssembler::AllocateJSObjectFromMap(
     TNode<Map> map, base::Optional<TNode<HeapObject>> properties,
     base::Optional<TNode<FixedArray>> elements, AllocationFlags flags,
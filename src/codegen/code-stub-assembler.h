@@ -2199,6 +2199,7 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
   TNode<OrderedHashSet> AllocateOrderedHashSet(TNode<IntPtrT> capacity);
 
   TNode<OrderedHashMap> AllocateOrderedHashMap();
+  TNode<OrderedHashMap> AllocateOrderedHashMap(TNode<IntPtrT> capacity);
 
   // Allocates an OrderedNameDictionary of the given capacity. This guarantees
   // that |capacity| entries can be added without reallocating.
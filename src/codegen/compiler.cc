@@ -34,6 +34,8 @@
 #include "src/execution/isolate-inl.h"
 #include "src/execution/isolate.h"
 #include "src/execution/local-isolate.h"
+#include "src/execution/shared-tiering-decisions.h"
+#include "src/execution/tiering-manager.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/flags/flags.h"
 #include "src/handles/global-handles-inl.h"
@@ -48,6 +50,7 @@
 #include "src/interpreter/interpreter.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/log-inl.h"
+#include "src/logging/metrics.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/feedback-cell-inl.h"
 #include "src/objects/js-function-inl.h"
@@ -61,6 +64,7 @@
 #include "src/parsing/parsing.h"
 #include "src/parsing/pending-compilation-error-handler.h"
 #include "src/parsing/scanner-character-streams.h"
+#include "src/snapshot/code-cache-store.h"
 #include "src/snapshot/code-serializer.h"
 #include "src/utils/ostreams.h"
 #include "src/zone/zone-list-inl.h"  // crbug.com/v8/8816
@@ -304,6 +308,26 @@ class CompilerTracer : public AllStatic {
   }
 };
 
+void RecordOptimizationMetricsEvent(Isolate* isolate,
+                                    Handle<JSFunction> function,
+                                    CodeKind code_kind, bool is_osr,
+                                    double time_taken_ms) {
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      isolate->metrics_recorder();
+  if (!recorder->HasEmbedderRecorder()) return;
+  Tagged<SharedFunctionInfo> shared = function->shared();
+  v8::metrics::JavaScriptOptimization event;
+  event.script_id = Script::cast(shared->script())->id();
+  event.function_start_position = shared->StartPosition();
+  event.maglev = code_kind == CodeKind::MAGLEV;
+  event.osr = is_osr;
+  event.wall_clock_duration_in_us = static_cast<int64_t>(
+      time_taken_ms * base::TimeConstants::kMicrosecondsPerMillisecond);
+  recorder->AddMainThreadEvent(
+      event, isolate->GetOrRegisterRecorderContextId(
+                 handle(function->native_context(), isolate)));
+}
+
 }  // namespace
 
 // static
@@ -582,6 +606,10 @@ void TurbofanCompilationJob::RecordCompilationStats(ConcurrencyMode mode,
   }
 
   DCHECK(!compilation_info()->is_osr());
+  isolate->tiering_manager()->NotifyOptimizedCompileFinished(
+      CodeKind::TURBOFAN, (time_taken_to_prepare_ + time_taken_to_execute_ +
+                           time_taken_to_finalize_)
+                              .InMillisecondsF());
   counters->turbofan_optimize_prepare()->AddSample(
       static_cast<int>(time_taken_to_prepare_.InMicroseconds()));
   counters->turbofan_optimize_execute()->AddSample(
@@ -615,6 +643,8 @@ void TurbofanCompilationJob::RecordCompilationStats(ConcurrencyMode mode,
       shared->cached_tiering_decision() ==
           CachedTieringDecision::kEarlyMaglev) {
     shared->set_cached_tiering_decision(CachedTieringDecision::kEarlyTurbofan);
+    SharedTieringDecisions::Record(*shared,
+                                   CachedTieringDecision::kEarlyTurbofan);
   }
 }
 
@@ -635,6 +665,9 @@ void TurbofanCompilationJob::RecordFunctionCompilation(
       isolate, code_type, script, compilation_info()->shared_info(),
       feedback_vector, abstract_code, compilation_info()->code_kind(),
       time_taken_ms);
+  RecordOptimizationMetricsEvent(isolate, compilation_info()->closure(),
+                                 compilation_info()->code_kind(),
+                                 compilation_info()->is_osr(), time_taken_ms);
 }
 
 uint64_t TurbofanCompilationJob::trace_id() const {
@@ -2287,8 +2320,20 @@ MaybeHandle<SharedFunctionInfo> BackgroundCompileTask::FinalizeScript(
     maybe_result = outer_function_sfi_;
   }
 
-  if (Handle<Script> cached_script;
-      maybe_cached_script.ToHandle(&cached_script) && !maybe_result.is_null()) {
+  if (background_merge_task_.HasPendingForegroundWork() &&
+      !maybe_result.is_null()) {
+    // The embedder already ran the background half of the merge with the
+    // cached script, see MergeWithExistingScript.
+    Handle<SharedFunctionInfo> result =
+        background_merge_task_.CompleteMergeInForeground(isolate, script);
+    maybe_result = result;
+    script = handle(Script::cast(result->script()), isolate);
+    DCHECK(Object::StrictEquals(script->source(), *source));
+    DCHECK(isolate->factory()->script_list()->Contains(
+        MaybeObject::MakeWeak(MaybeObject::FromObject(*script))));
+  } else if (Handle<Script> cached_script;
+             maybe_cached_script.ToHandle(&cached_script) &&
+             !maybe_result.is_null()) {
     BackgroundMergeTask merge;
     merge.SetUpOnMainThread(isolate, cached_script);
     CHECK(merge.HasPendingBackgroundWork());
@@ -2335,6 +2380,35 @@ MaybeHandle<SharedFunctionInfo> BackgroundCompileTask::FinalizeScript(
   return handle(*result, isolate);
 }
 
+void BackgroundCompileTask::SourceTextAvailable(
+    Isolate* isolate, Handle<String> source_text,
+    const ScriptDetails& script_details) {
+  DCHECK_EQ(isolate, isolate_for_local_isolate_);
+  DCHECK(flags_.is_toplevel());
+  background_merge_task_.SetUpOnMainThread(isolate, source_text, script_details,
+                                           flags_.outer_language_mode());
+}
+
+bool BackgroundCompileTask::ShouldMergeWithExistingScript() const {
+  DCHECK(flags_.is_toplevel());
+  // Jobs which have to be finalized on the main thread (e.g. asm.js) may still
+  // fail, in which case there is nothing to merge.
+  return background_merge_task_.HasPendingBackgroundWork() &&
+         !outer_function_sfi_.is_null() &&
+         jobs_to_retry_finalization_on_main_thread_.empty();
+}
+
+void BackgroundCompileTask::MergeWithExistingScript() {
+  DCHECK(ShouldMergeWithExistingScript());
+
+  LocalIsolate isolate(isolate_for_local_isolate_, ThreadKind::kBackground);
+  UnparkedScope unparked_scope(&isolate);
+  LocalHandleScope handle_scope(isolate.heap());
+
+  background_merge_task_.BeginMergeInBackground(&isolate,
+                                                handle(*script_, &isolate));
+}
+
 bool BackgroundCompileTask::FinalizeFunction(
     Isolate* isolate, Compiler::ClearExceptionFlag flag) {
   DCHECK(!flags_.is_toplevel());
@@ -2449,11 +2523,11 @@ void BackgroundDeserializeTask::MergeWithExistingScript() {
 }
 
 MaybeHandle<SharedFunctionInfo> BackgroundDeserializeTask::Finish(
-    Isolate* isolate, Handle<String> source,
-    ScriptOriginOptions origin_options) {
+    Isolate* isolate, Handle<String> source, ScriptOriginOptions origin_options,
+    MaybeHandle<Script> maybe_cached_script) {
   return CodeSerializer::FinishOffThreadDeserialize(
       isolate, std::move(off_thread_data_), &cached_data_, source,
-      origin_options, &background_merge_task_);
+      origin_options, &background_merge_task_, maybe_cached_script);
 }
 
 // ----------------------------------------------------------------------------
@@ -2513,6 +2587,7 @@ bool Compiler::CollectSourcePositions(Isolate* isolate,
   // Prevent parallel tasks from being spawned by this job.
   flags.set_post_parallel_compile_tasks_for_eager_toplevel(false);
   flags.set_post_parallel_compile_tasks_for_lazy(false);
+  flags.set_post_parallel_compile_tasks_for_lazy_toplevel(false);
 
   UnoptimizedCompileState compile_state;
   ReusableUnoptimizedCompileState reusable_state(isolate);
@@ -3600,6 +3675,13 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
   // nor put the compilation result back into the cache.
   const bool use_compilation_cache =
       extension == nullptr && script_details.repl_mode == REPLMode::kNo;
+  // Scripts for which the embedder neither provides nor requests cached data
+  // go through the persistent code cache, if there is one.
+  const bool use_code_cache_store =
+      use_compilation_cache && natives == NOT_NATIVES_CODE &&
+      CodeCacheStore::IsEnabled() &&
+      (compile_options == ScriptCompiler::kNoCompileOptions ||
+       compile_options == ScriptCompiler::kEagerCompile);
   MaybeHandle<SharedFunctionInfo> maybe_result;
   MaybeHandle<Script> maybe_script;
   IsCompiledScope is_compiled_scope;
@@ -3630,26 +3712,24 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
                    "V8.CompileDeserialize");
       if (deserialize_task) {
         // If there's a cache consume task, finish it.
-        maybe_result = deserialize_task->Finish(isolate, source,
-                                                script_details.origin_options);
-        // It is possible at this point that there is a Script object for this
-        // script in the compilation cache (held in the variable maybe_script),
-        // which does not match maybe_result->script(). This could happen any of
-        // three ways:
-        // 1. The embedder didn't call MergeWithExistingScript.
-        // 2. At the time the embedder called SourceTextAvailable, there was not
-        //    yet a Script in the compilation cache, but it arrived sometime
-        //    later.
-        // 3. At the time the embedder called SourceTextAvailable, there was a
-        //    Script available, and the new content has been merged into that
-        //    Script. However, since then, the Script was replaced in the
-        //    compilation cache, such as by another evaluation of the script
-        //    hitting case 2, or DevTools clearing the cache.
-        // This is okay; the new Script object will replace the current Script
-        // held by the compilation cache. Both Scripts may remain in use
-        // indefinitely, causing increased memory usage, but these cases are
-        // sufficiently unlikely, and ensuring a correct merge in the third case
-        // would be non-trivial.
+        maybe_result = deserialize_task->Finish(
+            isolate, source, script_details.origin_options, maybe_script);
+        // If there is a Script object for this script in the compilation cache
+        // (held in the variable maybe_script) and no merge happened in the
+        // background, either because the embedder didn't call
+        // MergeWithExistingScript or because the Script only arrived in the
+        // compilation cache after SourceTextAvailable, Finish merges the new
+        // content into it on the main thread.
+        // It is still possible that maybe_script does not match
+        // maybe_result->script(), if at the time the embedder called
+        // SourceTextAvailable there was a Script available, and the new
+        // content has been merged into that Script, but since then the Script
+        // was replaced in the compilation cache, such as by DevTools clearing
+        // the cache. This is okay; the new Script object will replace the
+        // current Script held by the compilation cache. Both Scripts may
+        // remain in use indefinitely, causing increased memory usage, but this
+        // case is sufficiently unlikely, and ensuring a correct merge would be
+        // non-trivial.
       } else {
         maybe_result = CodeSerializer::Deserialize(
             isolate, cached_data, source, script_details.origin_options,
@@ -3670,6 +3750,31 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
         // Deserializer failed. Fall through to compile.
         compile_timer.set_consuming_code_cache_failed();
       }
+    } else if (use_code_cache_store) {
+      if (std::unique_ptr<CodeCacheStore::Entry> entry = CodeCacheStore::Lookup(
+              isolate, source, script_details.origin_options)) {
+        compile_timer.set_consuming_code_cache();
+        NestedTimedHistogramScope timer(
+            isolate->counters()->compile_deserialize());
+        RCS_SCOPE(isolate, RuntimeCallCounterId::kCompileDeserialize);
+        TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                     "V8.CompileDeserialize");
+        maybe_result = CodeSerializer::Deserialize(
+            isolate, entry->data(), source, script_details.origin_options,
+            maybe_script);
+        Handle<SharedFunctionInfo> result;
+        if (maybe_result.ToHandle(&result)) {
+          is_compiled_scope = result->is_compiled_scope(isolate);
+          DCHECK(is_compiled_scope.is_compiled());
+          compilation_cache->PutScript(source, language_mode, result);
+        } else {
+          // The entry was rejected, e.g. because it was produced by a
+          // differently configured process. Drop it and recompile.
+          compile_timer.set_consuming_code_cache_failed();
+          CodeCacheStore::Remove(isolate, source,
+                                 script_details.origin_options);
+        }
+      }
     }
   }
 
@@ -3708,6 +3813,10 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     if (use_compilation_cache && maybe_result.ToHandle(&result)) {
       DCHECK(is_compiled_scope.is_compiled());
       compilation_cache->PutScript(source, language_mode, result);
+      if (use_code_cache_store) {
+        CodeCacheStore::Store(isolate, source, script_details.origin_options,
+                              result);
+      }
     } else if (maybe_result.is_null() && natives != EXTENSION_CODE) {
       isolate->ReportPendingMessages();
     }
@@ -4170,13 +4279,21 @@ void Compiler::FinalizeMaglevCompilationJob(maglev::MaglevCompilationJob* job,
     RecordMaglevFunctionCompilation(isolate, function,
                                     Handle<AbstractCode>::cast(code));
     job->RecordCompilationStats(isolate);
+    isolate->tiering_manager()->NotifyOptimizedCompileFinished(
+        CodeKind::MAGLEV,
+        job->prepare_in_ms() + job->execute_in_ms() + job->finalize_in_ms());
     if (v8_flags.profile_guided_optimization &&
         shared->cached_tiering_decision() == CachedTieringDecision::kPending) {
       shared->set_cached_tiering_decision(CachedTieringDecision::kEarlyMaglev);
+      SharedTieringDecisions::Record(*shared,
+                                     CachedTieringDecision::kEarlyMaglev);
     }
     CompilerTracer::TraceFinishMaglevCompile(
         isolate, function, job->is_osr(), job->prepare_in_ms(),
         job->execute_in_ms(), job->finalize_in_ms());
+    RecordOptimizationMetricsEvent(
+        isolate, function, CodeKind::MAGLEV, job->is_osr(),
+        job->prepare_in_ms() + job->execute_in_ms() + job->finalize_in_ms());
   }
 #endif
 }
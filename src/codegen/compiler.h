@@ -594,6 +594,15 @@ class V8_EXPORT_PRIVATE BackgroundCompileTask {
 
   void AbortFunction();
 
+  // Streaming script compilation can look up an existing script in the
+  // compilation cache as soon as the source text is known, so that the merge
+  // with that script can run off the main thread. See
+  // v8::ScriptCompiler::ScriptStreamingTask.
+  void SourceTextAvailable(Isolate* isolate, Handle<String> source_text,
+                           const ScriptDetails& script_details);
+  bool ShouldMergeWithExistingScript() const;
+  void MergeWithExistingScript();
+
   UnoptimizedCompileFlags flags() const { return flags_; }
 
  private:
@@ -632,6 +641,8 @@ class V8_EXPORT_PRIVATE BackgroundCompileTask {
 
   CompileHintCallback compile_hint_callback_ = nullptr;
   void* compile_hint_callback_data_ = nullptr;
+
+  BackgroundMergeTask background_merge_task_;
 };
 
 // Contains all data which needs to be transmitted between threads for
@@ -680,9 +691,13 @@ class V8_EXPORT_PRIVATE BackgroundDeserializeTask {
   // once.
   void MergeWithExistingScript();
 
-  MaybeHandle<SharedFunctionInfo> Finish(Isolate* isolate,
-                                         Handle<String> source,
-                                         ScriptOriginOptions origin_options);
+  // Finishes deserialization. If no merge was done by
+  // MergeWithExistingScript, the result is merged into |maybe_cached_script|,
+  // the Script for the same source from the Isolate compilation cache, if any.
+  MaybeHandle<SharedFunctionInfo> Finish(
+      Isolate* isolate, Handle<String> source,
+      ScriptOriginOptions origin_options,
+      MaybeHandle<Script> maybe_cached_script = {});
 
   bool rejected() const { return cached_data_.rejected(); }
 
@@ -22,6 +22,7 @@ enum CpuFeature {
   AVX,
   AVX2,
   FMA3,
+  AVX_VNNI,
   BMI1,
   BMI2,
   LZCNT,
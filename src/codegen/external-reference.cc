@@ -38,6 +38,7 @@
 #include "src/regexp/regexp-stack.h"
 #include "src/strings/string-search.h"
 #include "src/strings/unicode-inl.h"
+#include "src/utils/memcopy.h"
 
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/wasm/wasm-external-refs.h"
@@ -1037,6 +1038,13 @@ void* libc_memset(void* dest, int value, size_t n) {
 
 FUNCTION_REFERENCE(libc_memset_function, libc_memset)
 
+void* parallel_memmove(void* dest, const void* src, size_t n) {
+  ParallelMemMove(dest, src, n);
+  return dest;
+}
+
+FUNCTION_REFERENCE(parallel_memmove_function, parallel_memmove)
+
 void relaxed_memcpy(volatile base::Atomic8* dest,
                     volatile const base::Atomic8* src, size_t n) {
   base::Relaxed_Memcpy(dest, src, n);
@@ -1066,6 +1074,9 @@ ExternalReference ExternalReference::search_string_raw() {
 FUNCTION_REFERENCE(jsarray_array_join_concat_to_sequential_string,
                    JSArray::ArrayJoinConcatToSequentialString)
 
+FUNCTION_REFERENCE(jsarray_array_join_packed_to_sequential_string,
+                   JSArray::ArrayJoinPackedToSequentialString)
+
 FUNCTION_REFERENCE(gsab_byte_length, JSArrayBuffer::GsabByteLength)
 
 ExternalReference ExternalReference::search_string_raw_one_one() {
@@ -179,11 +179,14 @@ class StatsCounter;
   V(invoke_function_callback_optimized, "InvokeFunctionCallbackOptimized")     \
   V(jsarray_array_join_concat_to_sequential_string,                            \
     "jsarray_array_join_concat_to_sequential_string")                          \
+  V(jsarray_array_join_packed_to_sequential_string,                            \
+    "jsarray_array_join_packed_to_sequential_string")                          \
   V(jsreceiver_create_identity_hash, "jsreceiver_create_identity_hash")        \
   V(libc_memchr_function, "libc_memchr")                                       \
   V(libc_memcpy_function, "libc_memcpy")                                       \
   V(libc_memmove_function, "libc_memmove")                                     \
   V(libc_memset_function, "libc_memset")                                       \
+  V(parallel_memmove_function, "parallel_memmove")                             \
   V(relaxed_memcpy_function, "relaxed_memcpy")                                 \
   V(relaxed_memmove_function, "relaxed_memmove")                               \
   V(mod_two_doubles_operation, "mod_two_doubles")                              \
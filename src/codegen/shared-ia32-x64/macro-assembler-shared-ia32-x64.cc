@@ -754,6 +754,24 @@ void SharedMacroAssemblerBase::I32x4DotI8x16I7x16AddS(
     XMMRegister dst, XMMRegister src1, XMMRegister src2, XMMRegister src3,
     XMMRegister scratch, XMMRegister splat_reg) {
   ASM_CODE_COMMENT(this);
+#if V8_TARGET_ARCH_X64
+  if (CpuFeatures::IsSupported(AVX_VNNI)) {
+    // vpdpbusd multiplies the unsigned bytes of its second operand with the
+    // signed bytes of its third operand and accumulates into dst. Unlike
+    // pmaddubsw, the intermediate sums are not saturated, which the relaxed
+    // semantics allow.
+    CpuFeatureScope avx_vnni_scope(this, AVX_VNNI);
+    if (dst == src3) {
+      vpdpbusd(dst, src2, src1);
+    } else {
+      Movdqa(scratch, src3);
+      vpdpbusd(scratch, src2, src1);
+      Movdqa(dst, scratch);
+    }
+    return;
+  }
+#endif  // V8_TARGET_ARCH_X64
+
   // k = i16x8.splat(1)
   Pcmpeqd(splat_reg, splat_reg);
   Psrlw(splat_reg, splat_reg, uint8_t{15});
@@ -101,6 +101,7 @@ void CpuFeatures::ProbeImpl(bool cross_compile) {
     SetSupported(AVX);
     if (cpu.has_avx2()) SetSupported(AVX2);
     if (cpu.has_fma3()) SetSupported(FMA3);
+    if (cpu.has_avx_vnni()) SetSupported(AVX_VNNI);
   }
 
   // SAHF is not generally available in long mode.
@@ -128,6 +129,7 @@ void CpuFeatures::ProbeImpl(bool cross_compile) {
   if (!v8_flags.enable_avx || !IsSupported(SSE4_2)) SetUnsupported(AVX);
   if (!v8_flags.enable_avx2 || !IsSupported(AVX)) SetUnsupported(AVX2);
   if (!v8_flags.enable_fma3 || !IsSupported(AVX)) SetUnsupported(FMA3);
+  if (!v8_flags.enable_avx_vnni || !IsSupported(AVX)) SetUnsupported(AVX_VNNI);
 
   // Set a static value on whether Simd is supported.
   // This variable is only used for certain archs to query SupportWasmSimd128()
@@ -145,6 +147,7 @@ void CpuFeatures::PrintTarget() {}
 void CpuFeatures::PrintFeatures() {
   printf(
       "SSE3=%d SSSE3=%d SSE4_1=%d SSE4_2=%d SAHF=%d AVX=%d AVX2=%d FMA3=%d "
+      "AVX_VNNI=%d "
       "BMI1=%d "
       "BMI2=%d "
       "LZCNT=%d "
@@ -153,9 +156,9 @@ void CpuFeatures::PrintFeatures() {
       CpuFeatures::IsSupported(SSE4_1), CpuFeatures::IsSupported(SSE4_2),
       CpuFeatures::IsSupported(SAHF), CpuFeatures::IsSupported(AVX),
       CpuFeatures::IsSupported(AVX2), CpuFeatures::IsSupported(FMA3),
-      CpuFeatures::IsSupported(BMI1), CpuFeatures::IsSupported(BMI2),
-      CpuFeatures::IsSupported(LZCNT), CpuFeatures::IsSupported(POPCNT),
-      CpuFeatures::IsSupported(INTEL_ATOM));
+      CpuFeatures::IsSupported(AVX_VNNI), CpuFeatures::IsSupported(BMI1),
+      CpuFeatures::IsSupported(BMI2), CpuFeatures::IsSupported(LZCNT),
+      CpuFeatures::IsSupported(POPCNT), CpuFeatures::IsSupported(INTEL_ATOM));
 }
 
 // -----------------------------------------------------------------------------
@@ -3672,6 +3675,22 @@ void Assembler::vinserti128(YMMRegister dst, YMMRegister src1, XMMRegister src2,
   emit(imm8);
 }
 
+void Assembler::vpdpbusd(XMMRegister dst, XMMRegister src1, XMMRegister src2) {
+  DCHECK(IsEnabled(AVX_VNNI));
+  EnsureSpace ensure_space(this);
+  emit_vex_prefix(dst, src1, src2, kL128, k66, k0F38, kW0);
+  emit(0x50);
+  emit_sse_operand(dst, src2);
+}
+
+void Assembler::vpdpbusd(YMMRegister dst, YMMRegister src1, YMMRegister src2) {
+  DCHECK(IsEnabled(AVX_VNNI));
+  EnsureSpace ensure_space(this);
+  emit_vex_prefix(dst, src1, src2, kL256, k66, k0F38, kW0);
+  emit(0x50);
+  emit_sse_operand(dst, src2);
+}
+
 void Assembler::vperm2f128(YMMRegister dst, YMMRegister src1, YMMRegister src2,
                            uint8_t imm8) {
   DCHECK(IsEnabled(AVX));
@@ -1709,6 +1709,10 @@ class V8_EXPORT_PRIVATE Assembler : public AssemblerBase {
                   uint8_t lane);
   void vextractf128(XMMRegister dst, YMMRegister src, uint8_t lane);
 
+  // AVX-VNNI instructions.
+  void vpdpbusd(XMMRegister dst, XMMRegister src1, XMMRegister src2);
+  void vpdpbusd(YMMRegister dst, YMMRegister src1, YMMRegister src2);
+
   void fma_instr(uint8_t op, XMMRegister dst, XMMRegister src1,
                  XMMRegister src2, VectorLength l, SIMDPrefix pp,
                  LeadingOpcode m, VexW w);
@@ -1893,6 +1893,30 @@ void MacroAssembler::I16x16ExtMul(YMMRegister dst, XMMRegister src1,
   vpmullw(dst, dst, scratch);
 }
 
+void MacroAssembler::I32x8DotI8x32I7x32AddS(YMMRegister dst, YMMRegister src1,
+                                            YMMRegister src2, YMMRegister src3,
+                                            YMMRegister scratch,
+                                            YMMRegister splat_reg) {
+  ASM_CODE_COMMENT(this);
+  // This is guaranteed by the instruction selector.
+  DCHECK_EQ(dst, src3);
+  if (CpuFeatures::IsSupported(AVX_VNNI)) {
+    CpuFeatureScope avx_vnni_scope(this, AVX_VNNI);
+    vpdpbusd(dst, src2, src1);
+    return;
+  }
+
+  DCHECK(CpuFeatures::IsSupported(AVX2));
+  CpuFeatureScope avx2_scope(this, AVX2);
+  // k = i16x16.splat(1)
+  vpcmpeqd(splat_reg, splat_reg, splat_reg);
+  vpsrlw(splat_reg, splat_reg, uint8_t{15});
+
+  vpmaddubsw(scratch, src2, src1);
+  vpmaddwd(scratch, scratch, splat_reg);
+  vpaddd(dst, src3, scratch);
+}
+
 void MacroAssembler::I32x8ExtAddPairwiseI16x16S(YMMRegister dst,
                                                 YMMRegister src,
                                                 YMMRegister scratch) {
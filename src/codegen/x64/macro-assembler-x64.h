@@ -235,6 +235,9 @@ class V8_EXPORT_PRIVATE MacroAssembler
                    YMMRegister scratch, bool is_signed);
   void I16x16ExtMul(YMMRegister dst, XMMRegister src1, XMMRegister src2,
                     YMMRegister scratch, bool is_signed);
+  void I32x8DotI8x32I7x32AddS(YMMRegister dst, YMMRegister src1,
+                              YMMRegister src2, YMMRegister src3,
+                              YMMRegister scratch, YMMRegister splat_reg);
 #define MACRO_ASM_X64_IEXTADDPAIRWISE_LIST(V) \
   V(I32x8ExtAddPairwiseI16x16S)               \
   V(I32x8ExtAddPairwiseI16x16U)               \
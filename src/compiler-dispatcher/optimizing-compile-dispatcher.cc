@@ -15,7 +15,8 @@
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
-#include "src/objects/js-function.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/js-function-inl.h"
 #include "src/tasks/cancelable-task.h"
 #include "src/tracing/trace-event.h"
 
@@ -81,19 +82,62 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
     job_handle_->Cancel();
   }
   DeleteArray(input_queue_);
+  DeleteArray(input_queue_priority_);
 }
 
 TurbofanCompilationJob* OptimizingCompileDispatcher::NextInput(
     LocalIsolate* local_isolate) {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
   if (input_queue_length_ == 0) return nullptr;
-  TurbofanCompilationJob* job = input_queue_[InputQueueIndex(0)];
+  int position = NextInputPosition();
+  TurbofanCompilationJob* job = input_queue_[InputQueueIndex(position)];
   DCHECK_NOT_NULL(job);
+  // Close the gap left by the job, keeping the other jobs in queue order.
+  for (int i = position; i > 0; i--) {
+    input_queue_[InputQueueIndex(i)] = input_queue_[InputQueueIndex(i - 1)];
+    input_queue_priority_[InputQueueIndex(i)] =
+        input_queue_priority_[InputQueueIndex(i - 1)];
+  }
   input_queue_shift_ = InputQueueIndex(1);
   input_queue_length_--;
   return job;
 }
 
+int OptimizingCompileDispatcher::NextInputPosition() {
+  DCHECK_LT(0, input_queue_length_);
+  if (!v8_flags.concurrent_recompilation_prioritize) return 0;
+  // The queue is short, so a linear scan is fine. Ties are broken in favor of
+  // the oldest job.
+  int best = 0;
+  for (int i = 1; i < input_queue_length_; i++) {
+    if (input_queue_priority_[InputQueueIndex(i)] >
+        input_queue_priority_[InputQueueIndex(best)]) {
+      best = i;
+    }
+  }
+  return best;
+}
+
+int OptimizingCompileDispatcher::ComputeJobPriority(
+    TurbofanCompilationJob* job) {
+  DCHECK_EQ(ThreadId::Current(), isolate_->thread_id());
+  OptimizedCompilationInfo* info = job->compilation_info();
+  // OSR requests come from a loop that is currently running, its result is
+  // needed as soon as possible.
+  if (info->is_osr()) return kMaxInt;
+  Tagged<JSFunction> function = *info->closure();
+  int invocation_count = 0;
+  if (function->has_feedback_vector()) {
+    invocation_count = function->feedback_vector()->invocation_count();
+  }
+  // Large functions take longer to compile; scale their hotness down so that
+  // a burst of them doesn't delay the compilation of small hot functions.
+  int size_factor =
+      1 + info->bytecode_array()->length() /
+              std::max(1, v8_flags.concurrent_recompilation_large_bytecode_size);
+  return invocation_count / size_factor;
+}
+
 void OptimizingCompileDispatcher::CompileNext(TurbofanCompilationJob* job,
                                               LocalIsolate* local_isolate) {
   if (!job) return;
@@ -221,11 +265,15 @@ bool OptimizingCompileDispatcher::HasJobs() {
 void OptimizingCompileDispatcher::QueueForOptimization(
     TurbofanCompilationJob* job) {
   DCHECK(IsQueueAvailable());
+  int priority = v8_flags.concurrent_recompilation_prioritize
+                     ? ComputeJobPriority(job)
+                     : 0;
   {
     // Add job to the back of the input queue.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
     DCHECK_LT(input_queue_length_, input_queue_capacity_);
     input_queue_[InputQueueIndex(input_queue_length_)] = job;
+    input_queue_priority_[InputQueueIndex(input_queue_length_)] = priority;
     input_queue_length_++;
   }
   if (job_handle_->UpdatePriorityEnabled()) {
@@ -243,6 +291,7 @@ OptimizingCompileDispatcher::OptimizingCompileDispatcher(Isolate* isolate)
       input_queue_shift_(0),
       recompilation_delay_(v8_flags.concurrent_recompilation_delay) {
   input_queue_ = NewArray<TurbofanCompilationJob*>(input_queue_capacity_);
+  input_queue_priority_ = NewArray<int>(input_queue_capacity_);
   if (v8_flags.concurrent_recompilation) {
     job_handle_ = V8::GetCurrentPlatform()->PostJob(
         kTaskPriority, std::make_unique<CompileTask>(isolate, this));
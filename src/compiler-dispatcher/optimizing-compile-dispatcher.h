@@ -75,6 +75,13 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void CompileNext(TurbofanCompilationJob* job, LocalIsolate* local_isolate);
   TurbofanCompilationJob* NextInput(LocalIsolate* local_isolate);
 
+  // Computes the priority of {job} in the input queue, higher is more urgent.
+  // Must be called on the main thread.
+  int ComputeJobPriority(TurbofanCompilationJob* job);
+  // Returns the position (in queue order) of the input job that should be
+  // compiled next. Must be called with {input_queue_mutex_} held.
+  int NextInputPosition();
+
   inline int InputQueueIndex(int i) {
     int result = (i + input_queue_shift_) % input_queue_capacity_;
     DCHECK_LE(0, result);
@@ -86,6 +93,9 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   // Circular queue of incoming recompilation tasks (including OSR).
   TurbofanCompilationJob** input_queue_;
+  // Priorities of the jobs in {input_queue_}, indexed the same way. Only used
+  // with --concurrent-recompilation-prioritize.
+  int* input_queue_priority_;
   int input_queue_capacity_;
   int input_queue_length_;
   int input_queue_shift_;
@@ -136,6 +136,12 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   // Provides access to JSAsyncFunctionObject::promise() field.
   static FieldAccess ForJSAsyncFunctionObjectPromise();
 
+  // Provides access to JSAsyncFunctionObject::await_resolve_closure() field.
+  static FieldAccess ForJSAsyncFunctionObjectAwaitResolveClosure();
+
+  // Provides access to JSAsyncFunctionObject::await_reject_closure() field.
+  static FieldAccess ForJSAsyncFunctionObjectAwaitRejectClosure();
+
   // Provides access to JSAsyncGeneratorObject::queue() field.
   static FieldAccess ForJSAsyncGeneratorObjectQueue();
 
@@ -368,6 +374,9 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   // Provides access to NameDictionary fields.
   static FieldAccess ForNameDictionaryFlagsIndex();
 
+  // Provides access to the block counter of a CoverageInfo slot.
+  static FieldAccess ForCoverageInfoBlockCount(int slot_index);
+
   // Provides access to FeedbackCell fields.
   static FieldAccess ForFeedbackCellInterruptBudget();
 
@@ -380,8 +380,9 @@ int InstructionScheduler::GetTargetInstructionFlags(
 }
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // Basic latency modeling for arm64 instructions. They have been determined
-  // in an empirical way.
+  // Basic latency modeling for arm64 instructions. Arithmetic latencies follow
+  // recent cores such as Neoverse N2 and V1; load latencies have been
+  // determined in an empirical way.
   switch (instr->arch_opcode()) {
     case kArm64Add:
     case kArm64Add32:
@@ -461,13 +462,11 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Mneg32:
     case kArm64Msub32:
     case kArm64Mul32:
-      return 3;
-
     case kArm64Madd:
     case kArm64Mneg:
     case kArm64Msub:
     case kArm64Mul:
-      return 5;
+      return 2;
 
     case kArm64Idiv32:
     case kArm64Udiv32:
@@ -477,27 +476,33 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Udiv:
       return 20;
 
-    case kArm64Float32Add:
-    case kArm64Float32Sub:
-    case kArm64Float64Add:
-    case kArm64Float64Sub:
-      return 5;
-
     case kArm64Float32Abs:
+    case kArm64Float32Add:
     case kArm64Float32Cmp:
     case kArm64Float32Neg:
+    case kArm64Float32Sub:
     case kArm64Float64Abs:
+    case kArm64Float64Add:
     case kArm64Float64Cmp:
     case kArm64Float64Neg:
+    case kArm64Float64Sub:
+      return 2;
+
+    case kArm64Float32Mul:
+    case kArm64Float64Mul:
       return 3;
 
-    case kArm64Float32Div:
     case kArm64Float32Sqrt:
-      return 12;
+      return 9;
+
+    case kArm64Float32Div:
+      return 10;
 
     case kArm64Float64Div:
+      return 15;
+
     case kArm64Float64Sqrt:
-      return 19;
+      return 16;
 
     case kArm64Float32RoundDown:
     case kArm64Float32RoundTiesEven:
@@ -508,7 +513,7 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Float64RoundTiesEven:
     case kArm64Float64RoundTruncate:
     case kArm64Float64RoundUp:
-      return 5;
+      return 3;
 
     case kArm64Float32ToFloat64:
     case kArm64Float64ToFloat32:
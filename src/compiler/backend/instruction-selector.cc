@@ -4207,6 +4207,8 @@ void InstructionSelectorT<TurbofanAdapter>::VisitNode(Node* node) {
       return MarkAsSimd256(node), VisitI16x16ShrU(node);
     case IrOpcode::kI32x8DotI16x16S:
       return MarkAsSimd256(node), VisitI32x8DotI16x16S(node);
+    case IrOpcode::kI32x8DotI8x32I7x32AddS:
+      return MarkAsSimd256(node), VisitI32x8DotI8x32I7x32AddS(node);
     case IrOpcode::kI16x16RoundingAverageU:
       return MarkAsSimd256(node), VisitI16x16RoundingAverageU(node);
     case IrOpcode::kI8x32RoundingAverageU:
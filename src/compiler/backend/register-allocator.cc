@@ -4,8 +4,10 @@
 
 #include "src/compiler/backend/register-allocator.h"
 
+#include <atomic>
 #include <iomanip>
 
+#include "include/v8-platform.h"
 #include "src/base/iterator.h"
 #include "src/base/small-vector.h"
 #include "src/base/vector.h"
@@ -13,6 +15,7 @@
 #include "src/codegen/tick-counter.h"
 #include "src/compiler/backend/spill-placer.h"
 #include "src/compiler/linkage.h"
+#include "src/init/v8.h"
 #include "src/strings/string-stream.h"
 
 namespace v8 {
@@ -4652,34 +4655,104 @@ void OperandAssigner::AssignSpillSlots() {
   }
 }
 
+namespace {
+
+InstructionOperand GetCommittedSpillOperand(RegisterAllocationData* data,
+                                            TopLevelLiveRange* top_range) {
+  if (top_range->HasSpillOperand()) {
+    auto it = data->slot_for_const_range().find(top_range);
+    if (it != data->slot_for_const_range().end()) return *it->second;
+    return *top_range->GetSpillOperand();
+  }
+  if (top_range->HasSpillRange()) return top_range->GetSpillRangeOperand();
+  return InstructionOperand();
+}
+
+// Rewrites the operands of all uses of {top_range} (and of the incoming
+// operands of its phi, if any) with the locations chosen by the allocator.
+// This only writes to operands owned by {top_range}, and only reads allocation
+// results, so it can be done for different ranges concurrently.
+void ConvertUsesOfRange(RegisterAllocationData* data,
+                        TopLevelLiveRange* top_range,
+                        const InstructionOperand& spill_operand) {
+  if (top_range->is_phi()) {
+    data->GetPhiMapValueFor(top_range)->CommitAssignment(
+        top_range->GetAssignedOperand());
+  }
+  for (LiveRange* range = top_range; range != nullptr; range = range->next()) {
+    InstructionOperand assigned = range->GetAssignedOperand();
+    DCHECK(!assigned.IsUnallocated());
+    range->ConvertUsesToOperand(assigned, spill_operand);
+  }
+}
+
+class ConvertUsesJob final : public JobTask {
+ public:
+  explicit ConvertUsesJob(RegisterAllocationData* data) : data_(data) {}
+
+  void Run(JobDelegate* delegate) override {
+    const size_t num_ranges = data_->live_ranges().size();
+    while (!delegate->ShouldYield()) {
+      size_t start =
+          next_range_.fetch_add(kRangesPerStep, std::memory_order_relaxed);
+      if (start >= num_ranges) return;
+      size_t end = std::min(start + kRangesPerStep, num_ranges);
+      for (size_t i = start; i < end; ++i) {
+        TopLevelLiveRange* top_range = data_->live_ranges()[i];
+        if (top_range->IsEmpty()) continue;
+        ConvertUsesOfRange(data_, top_range,
+                           GetCommittedSpillOperand(data_, top_range));
+      }
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    const size_t num_ranges = data_->live_ranges().size();
+    size_t next = next_range_.load(std::memory_order_relaxed);
+    size_t remaining = num_ranges - std::min(next, num_ranges);
+    return std::min<size_t>(
+        (remaining + kRangesPerStep - 1) / kRangesPerStep,
+        v8_flags.turbo_parallel_commit_assignment_max_threads);
+  }
+
+ private:
+  static constexpr size_t kRangesPerStep = 256;
+
+  RegisterAllocationData* const data_;
+  std::atomic<size_t> next_range_{0};
+};
+
+}  // namespace
+
 void OperandAssigner::CommitAssignment() {
   const size_t live_ranges_size = data()->live_ranges().size();
+
+  // For very large functions, the uses of the different live ranges are
+  // rewritten on several threads. Committing the spill moves allocates gap
+  // moves in the instruction zone and is left to the sequential loop below.
+  const bool uses_converted_in_parallel =
+      v8_flags.turbo_parallel_commit_assignment &&
+      V8::GetCurrentPlatform()->NumberOfWorkerThreads() > 0 &&
+      live_ranges_size >=
+          static_cast<size_t>(
+              v8_flags.turbo_parallel_commit_assignment_min_live_ranges);
+  if (uses_converted_in_parallel) {
+    V8::GetCurrentPlatform()
+        ->PostJob(TaskPriority::kUserBlocking,
+                  std::make_unique<ConvertUsesJob>(data()))
+        ->Join();
+  }
+
   for (TopLevelLiveRange* top_range : data()->live_ranges()) {
     data()->tick_counter()->TickAndMaybeEnterSafepoint();
     CHECK_EQ(live_ranges_size,
              data()->live_ranges().size());  // TODO(neis): crbug.com/831822
     DCHECK_NOT_NULL(top_range);
     if (top_range->IsEmpty()) continue;
-    InstructionOperand spill_operand;
-    if (top_range->HasSpillOperand()) {
-      auto it = data()->slot_for_const_range().find(top_range);
-      if (it != data()->slot_for_const_range().end()) {
-        spill_operand = *it->second;
-      } else {
-        spill_operand = *top_range->GetSpillOperand();
-      }
-    } else if (top_range->HasSpillRange()) {
-      spill_operand = top_range->GetSpillRangeOperand();
-    }
-    if (top_range->is_phi()) {
-      data()->GetPhiMapValueFor(top_range)->CommitAssignment(
-          top_range->GetAssignedOperand());
-    }
-    for (LiveRange* range = top_range; range != nullptr;
-         range = range->next()) {
-      InstructionOperand assigned = range->GetAssignedOperand();
-      DCHECK(!assigned.IsUnallocated());
-      range->ConvertUsesToOperand(assigned, spill_operand);
+    InstructionOperand spill_operand =
+        GetCommittedSpillOperand(data(), top_range);
+    if (!uses_converted_in_parallel) {
+      ConvertUsesOfRange(data(), top_range, spill_operand);
     }
 
     if (!spill_operand.IsInvalid()) {
@@ -279,6 +279,7 @@ namespace compiler {
   V(X64I32x4DotI16x8S)                               \
   V(X64I32x8DotI16x16S)                              \
   V(X64I32x4DotI8x16I7x16AddS)                       \
+  V(X64I32x8DotI8x32I7x32AddS)                       \
   V(X64I32x4ExtMulLowI16x8S)                         \
   V(X64I32x4ExtMulHighI16x8S)                        \
   V(X64I32x4ExtMulLowI16x8U)                         \
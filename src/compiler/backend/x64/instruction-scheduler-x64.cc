@@ -219,6 +219,7 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kX64I32x4DotI16x8S:
     case kX64I32x8DotI16x16S:
     case kX64I32x4DotI8x16I7x16AddS:
+    case kX64I32x8DotI8x32I7x32AddS:
     case kX64I32x4ExtMulLowI16x8S:
     case kX64I32x4ExtMulHighI16x8S:
     case kX64I32x8ExtMulI16x8S:
@@ -419,17 +420,22 @@ int InstructionScheduler::GetTargetInstructionFlags(
 }
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // Basic latency modeling for x64 instructions. They have been determined
-  // in an empirical way.
+  // Basic latency modeling for x64 instructions, based on recent cores such as
+  // Golden Cove and Zen 4. The AVX forms are selected whenever AVX is
+  // supported and have the same latencies as their SSE counterparts.
   switch (instr->arch_opcode()) {
-    case kSSEFloat64Mul:
-      return 5;
     case kX64Imul:
     case kX64Imul32:
     case kX64ImulHigh32:
     case kX64UmulHigh32:
     case kX64ImulHigh64:
     case kX64UmulHigh64:
+    case kX64Lzcnt:
+    case kX64Lzcnt32:
+    case kX64Tzcnt:
+    case kX64Tzcnt32:
+    case kX64Popcnt:
+    case kX64Popcnt32:
     case kX64Float32Abs:
     case kX64Float32Neg:
     case kX64Float64Abs:
@@ -442,8 +448,17 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64Sub:
     case kSSEFloat64Max:
     case kSSEFloat64Min:
+    case kAVXFloat32Cmp:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat64Cmp:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
       return 3;
     case kSSEFloat32Mul:
+    case kSSEFloat64Mul:
+    case kAVXFloat32Mul:
+    case kAVXFloat64Mul:
     case kSSEFloat32ToFloat64:
     case kSSEFloat64ToFloat32:
     case kSSEFloat32Round:
@@ -454,18 +469,22 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64ToUint32:
       return 4;
     case kX64Idiv:
-      return 49;
+      return 18;
     case kX64Idiv32:
-      return 35;
+      return 14;
     case kX64Udiv:
-      return 38;
+      return 16;
     case kX64Udiv32:
-      return 26;
+      return 12;
     case kSSEFloat32Div:
+    case kAVXFloat32Div:
+      return 11;
     case kSSEFloat64Div:
+    case kAVXFloat64Div:
     case kSSEFloat32Sqrt:
-    case kSSEFloat64Sqrt:
       return 13;
+    case kSSEFloat64Sqrt:
+      return 16;
     case kSSEFloat32ToInt64:
     case kSSEFloat64ToInt64:
     case kSSEFloat32ToUint64:
@@ -8,6 +8,7 @@
 #include "src/codegen/source-position-table.h"
 #include "src/codegen/tick-counter.h"
 #include "src/common/assert-scope.h"
+#include "src/compiler/access-builder.h"
 #include "src/compiler/bytecode-analysis.h"
 #include "src/compiler/common-operator.h"
 #include "src/compiler/compiler-source-position-table.h"
@@ -3650,15 +3651,31 @@ DEBUG_BREAK_BYTECODE_LIST(DEBUG_BREAK)
 #undef DEBUG_BREAK
 
 void BytecodeGraphBuilder::VisitIncBlockCounter() {
-  Node* closure = GetFunctionClosure();
-  Node* coverage_array_slot =
-      jsgraph()->ConstantNoHole(bytecode_iterator().GetIndexOperand(0));
-
-  // Lowered by js-intrinsic-lowering to call Builtin::kIncBlockCounter.
-  const Operator* op =
-      javascript()->CallRuntime(Runtime::kInlineIncBlockCounter);
-
-  NewNode(op, closure, coverage_array_slot);
+  int coverage_array_slot = bytecode_iterator().GetIndexOperand(0);
+
+  // Without coverage info the IncBlockCounter builtin is a no-op. Coverage
+  // infos are only installed together with bytecode, and switching to a block
+  // coverage mode deoptimizes all code, so the counter can be dropped.
+  OptionalHeapObjectRef coverage_info = shared_info().coverage_info(broker());
+  if (!coverage_info.has_value()) return;
+
+  // Update the counter in place rather than calling the builtin. In binary
+  // mode only whether the block executed is reported, so a plain store of a
+  // non-zero value suffices.
+  FieldAccess access =
+      AccessBuilder::ForCoverageInfoBlockCount(coverage_array_slot);
+  Node* coverage_info_node =
+      jsgraph()->ConstantNoHole(coverage_info.value(), broker());
+  Node* count;
+  if (broker()->local_isolate_or_isolate()->is_block_binary_code_coverage()) {
+    count = jsgraph()->ConstantNoHole(1);
+  } else {
+    Node* old_count =
+        NewNode(simplified()->LoadField(access), coverage_info_node);
+    count = NewNode(simplified()->NumberAdd(), old_count,
+                    jsgraph()->ConstantNoHole(1));
+  }
+  NewNode(simplified()->StoreField(access), coverage_info_node, count);
 }
 
 void BytecodeGraphBuilder::VisitForInEnumerate() {
@@ -26,6 +26,7 @@ namespace compiler {
   V(FieldConstness)                     \
   V(FieldRepresentation)                \
   V(FieldType)                          \
+  V(FunctionCode)                       \
   V(GlobalProperty)                     \
   V(InitialMap)                         \
   V(InitialMapInstanceSizePrediction)   \
@@ -647,6 +648,36 @@ class ConsistentJSFunctionViewDependency final : public CompilationDependency {
   const JSFunctionRef function_;
 };
 
+// Check that a function's code does not change during compilation.
+class FunctionCodeDependency final : public CompilationDependency {
+ public:
+  FunctionCodeDependency(JSFunctionRef function, CodeRef code)
+      : CompilationDependency(kFunctionCode),
+        function_(function),
+        code_(code) {}
+
+  bool IsValid(JSHeapBroker* broker) const override {
+    return function_.object()->code(broker->isolate()) == *code_.object();
+  }
+
+  void Install(JSHeapBroker* broker, PendingDependencies* deps) const override {
+  }
+
+ private:
+  size_t Hash() const override {
+    ObjectRef::Hash h;
+    return base::hash_combine(h(function_), h(code_));
+  }
+
+  bool Equals(const CompilationDependency* that) const override {
+    const FunctionCodeDependency* const zat = that->AsFunctionCode();
+    return function_.equals(zat->function_) && code_.equals(zat->code_);
+  }
+
+  const JSFunctionRef function_;
+  const CodeRef code_;
+};
+
 class TransitionDependency final : public CompilationDependency {
  public:
   explicit TransitionDependency(MapRef map)
@@ -1457,6 +1488,19 @@ void CompilationDependencies::DependOnConsistentJSFunctionView(
   RecordDependency(zone_->New<ConsistentJSFunctionViewDependency>(function));
 }
 
+bool CompilationDependencies::DependOnInterpreterEntry(JSFunctionRef function) {
+  // With native interpreter frames, every function has its own copy of the
+  // trampoline.
+  if (v8_flags.interpreted_frames_native_stack) return false;
+  OptionalCodeRef code = function.code(broker_);
+  if (!code.has_value() ||
+      code->object()->builtin_id() != Builtin::kInterpreterEntryTrampoline) {
+    return false;
+  }
+  RecordDependency(zone_->New<FunctionCodeDependency>(function, *code));
+  return true;
+}
+
 void CompilationDependencies::DependOnNoSlackTrackingChange(MapRef map) {
   if (map.construction_counter() == 0) return;
   RecordDependency(zone_->New<NoSlackTrackingChangeDependency>(map));
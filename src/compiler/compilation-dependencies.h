@@ -138,6 +138,15 @@ class V8_EXPORT_PRIVATE CompilationDependencies : public ZoneObject {
 
   void DependOnConsistentJSFunctionView(JSFunctionRef function);
 
+  // Returns true if {function} is currently entered through the
+  // InterpreterEntryTrampoline, in which case calls to it can call that
+  // builtin directly instead of loading the function's code (through the code
+  // pointer table when the sandbox is enabled). The trampoline continues to
+  // any baseline or optimized code the function gets later, so such calls stay
+  // correct; the dependency only ensures that the code did not change before
+  // the calling code is installed.
+  bool DependOnInterpreterEntry(JSFunctionRef function);
+
   // Predict the final instance size for {function}'s initial map and record
   // the assumption that this prediction is correct. In addition, register
   // the initial map dependency. This method returns the {function}'s the
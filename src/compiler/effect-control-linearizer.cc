@@ -6862,7 +6862,11 @@ Node* EffectControlLinearizer::AdaptFastCallArgument(
             __ Bind(&done);
             return done.PhiAt(0);
           }
-          case CTypeInfo::Type::kSeqOneByteString: {
+          case CTypeInfo::Type::kSeqOneByteString:
+          case CTypeInfo::Type::kSeqTwoByteString: {
+            const bool is_one_byte =
+                arg_type.GetType() == CTypeInfo::Type::kSeqOneByteString;
+
             // Check that the value is a HeapObject.
             Node* value_is_smi = ObjectIsSmi(node);
             __ GotoIf(value_is_smi, if_error);
@@ -6875,17 +6879,18 @@ Node* EffectControlLinearizer::AdaptFastCallArgument(
                 instance_type,
                 __ Int32Constant(kStringRepresentationAndEncodingMask));
 
-            Node* is_onebytestring = __ Word32Equal(
-                encoding, __ Int32Constant(kSeqOneByteStringTag));
-            __ GotoIfNot(is_onebytestring, if_error);
+            Node* has_expected_encoding = __ Word32Equal(
+                encoding, __ Int32Constant(is_one_byte ? kSeqOneByteStringTag
+                                                       : kSeqTwoByteStringTag));
+            __ GotoIfNot(has_expected_encoding, if_error);
 
-            Node* length_in_bytes =
-                __ LoadField(AccessBuilder::ForStringLength(), node);
+            Node* length = __ LoadField(AccessBuilder::ForStringLength(), node);
+            ElementAccess char_access =
+                is_one_byte ? AccessBuilder::ForSeqOneByteStringCharacter()
+                            : AccessBuilder::ForSeqTwoByteStringCharacter();
             Node* data_ptr = __ IntPtrAdd(
                 __ BitcastTaggedToWord(node),
-                __ IntPtrConstant(
-                    AccessBuilder::ForSeqOneByteStringCharacter().header_size -
-                    kHeapObjectTag));
+                __ IntPtrConstant(char_access.header_size - kHeapObjectTag));
 
             constexpr int kAlign = alignof(FastOneByteString);
             constexpr int kSize = sizeof(FastOneByteString);
@@ -6893,6 +6898,10 @@ Node* EffectControlLinearizer::AdaptFastCallArgument(
                           "The size of "
                           "FastOneByteString isn't equal to the sum of its "
                           "expected members.");
+            static_assert(sizeof(FastTwoByteString) == kSize &&
+                              alignof(FastTwoByteString) == kAlign,
+                          "FastOneByteString and FastTwoByteString are "
+                          "expected to have the same layout.");
             Node* stack_slot = __ StackSlot(kSize, kAlign);
 
             __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
@@ -6900,7 +6909,7 @@ Node* EffectControlLinearizer::AdaptFastCallArgument(
                      stack_slot, 0, data_ptr);
             __ Store(StoreRepresentation(MachineRepresentation::kWord32,
                                          kNoWriteBarrier),
-                     stack_slot, sizeof(size_t), length_in_bytes);
+                     stack_slot, sizeof(size_t), length);
 
             static_assert(sizeof(uintptr_t) == sizeof(size_t),
                           "The string length can't "
@@ -7137,6 +7146,7 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
           case CTypeInfo::Type::kPointer:
             return BuildAllocateJSExternalObject(c_call_result);
           case CTypeInfo::Type::kSeqOneByteString:
+          case CTypeInfo::Type::kSeqTwoByteString:
           case CTypeInfo::Type::kV8Value:
           case CTypeInfo::Type::kApiObject:
           case CTypeInfo::Type::kUint8:
@@ -4,6 +4,8 @@
 
 #include "src/compiler/escape-analysis.h"
 
+#include <cmath>
+
 #include "src/codegen/tick-counter.h"
 #include "src/compiler/frame-states.h"
 #include "src/compiler/node-matchers.h"
@@ -539,6 +541,10 @@ VariableTracker::State VariableTracker::MergeInputs(Node* effect_phi) {
 
 namespace {
 
+// LoadElements with a non-constant index into a virtual object are turned into
+// a chain of Selects if the index can only refer to this many elements.
+constexpr int kMaxElementLoadSelectCandidates = 4;
+
 int OffsetOfFieldAccess(const Operator* op) {
   DCHECK(op->opcode() == IrOpcode::kLoadField ||
          op->opcode() == IrOpcode::kStoreField);
@@ -686,50 +692,66 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
         int const length =
             (vobject->size() - access.header_size) >>
             ElementSizeLog2Of(access.machine_type.representation());
-        Variable var0, var1;
-        Node* value0;
-        Node* value1;
-        if (length == 1 &&
-            vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var) &&
-            current->Get(var).To(&value) &&
-            (value == nullptr ||
-             NodeProperties::GetType(value).Is(access.type))) {
-          // The {object} has no elements, and we know that the LoadElement
-          // {index} must be within bounds, thus it must always yield this
-          // one element of {object}.
-          current->SetReplacement(value);
-          break;
-        } else if (length == 2 &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var0) &&
-                   current->Get(var0).To(&value0) &&
-                   (value0 == nullptr ||
-                    NodeProperties::GetType(value0).Is(access.type)) &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 1)).To(&var1) &&
-                   current->Get(var1).To(&value1) &&
-                   (value1 == nullptr ||
-                    NodeProperties::GetType(value1).Is(access.type))) {
-          if (value0 && value1) {
-            // The {object} has exactly two elements, so the LoadElement
-            // must return one of them (i.e. either the element at index
-            // 0 or the one at index 1). So we can turn the LoadElement
-            // into a Select operation instead (still allowing the {object}
-            // to be scalar replaced). We must however mark the elements
-            // of the {object} itself as escaping.
-            Node* check =
-                jsgraph->graph()->NewNode(jsgraph->simplified()->NumberEqual(),
-                                          index, jsgraph->ZeroConstant());
-            NodeProperties::SetType(check, Type::Boolean());
-            Node* select = jsgraph->graph()->NewNode(
-                jsgraph->common()->Select(access.machine_type.representation()),
-                check, value0, value1);
-            NodeProperties::SetType(select, access.type);
+        // The LoadElement {index} must be within bounds, so it yields one of
+        // the elements of {object} in the range permitted by the type of
+        // {index}. For a few candidates, we turn the LoadElement into a chain
+        // of Select operations instead (still allowing the {object} to be
+        // scalar replaced).
+        Type index_type = NodeProperties::GetType(index);
+        double min_index = 0;
+        double max_index = length - 1;
+        if (!index_type.IsNone() && index_type.Is(Type::OrderedNumber())) {
+          min_index = std::max(min_index, std::ceil(index_type.Min()));
+          max_index = std::min(max_index, std::floor(index_type.Max()));
+        }
+        if (min_index <= max_index &&
+            max_index - min_index < kMaxElementLoadSelectCandidates) {
+          int const first = static_cast<int>(min_index);
+          int const count = static_cast<int>(max_index - min_index) + 1;
+          Node* values[kMaxElementLoadSelectCandidates];
+          bool all_known = true;
+          int i = 0;
+          for (; i < count; ++i) {
+            if (!vobject->FieldAt(OffsetOfElementAt(access, first + i))
+                     .To(&var) ||
+                !current->Get(var).To(&values[i])) {
+              break;
+            }
+            if (values[i] == nullptr) {
+              all_known = false;
+            } else if (!NodeProperties::GetType(values[i]).Is(access.type)) {
+              break;
+            }
+          }
+          if (i == count) {
+            if (!all_known) {
+              // If the variables have no values, we have
+              // not reached the fixed-point yet.
+              break;
+            }
+            if (count == 1) {
+              current->SetReplacement(values[0]);
+              break;
+            }
+            // We must however mark the elements of the {object} itself as
+            // escaping.
+            Node* select = values[count - 1];
+            for (int j = count - 2; j >= 0; --j) {
+              Node* candidate = jsgraph->ConstantNoHole(first + j);
+              NodeProperties::SetType(
+                  candidate,
+                  Type::Constant(first + j, jsgraph->graph()->zone()));
+              Node* check = jsgraph->graph()->NewNode(
+                  jsgraph->simplified()->NumberEqual(), index, candidate);
+              NodeProperties::SetType(check, Type::Boolean());
+              select = jsgraph->graph()->NewNode(
+                  jsgraph->common()->Select(
+                      access.machine_type.representation()),
+                  check, values[j], select);
+              NodeProperties::SetType(select, access.type);
+            }
             current->SetReplacement(select);
-            current->SetEscaped(value0);
-            current->SetEscaped(value1);
-            break;
-          } else {
-            // If the variables have no values, we have
-            // not reached the fixed-point yet.
+            for (int j = 0; j < count; ++j) current->SetEscaped(values[j]);
             break;
           }
         }
@@ -53,6 +53,7 @@ ElementsKind GetTypedArrayElementsKind(CTypeInfo::Type type) {
       return FLOAT64_ELEMENTS;
     case CTypeInfo::Type::kVoid:
     case CTypeInfo::Type::kSeqOneByteString:
+    case CTypeInfo::Type::kSeqTwoByteString:
     case CTypeInfo::Type::kBool:
     case CTypeInfo::Type::kPointer:
     case CTypeInfo::Type::kV8Value:
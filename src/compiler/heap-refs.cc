@@ -17,6 +17,7 @@
 #include "src/compiler/js-heap-broker-inl.h"
 #include "src/execution/protectors-inl.h"
 #include "src/objects/allocation-site-inl.h"
+#include "src/objects/debug-objects.h"
 #include "src/objects/descriptor-array.h"
 #include "src/objects/heap-number-inl.h"
 #include "src/objects/js-array-buffer-inl.h"
@@ -1662,6 +1663,27 @@ bool SharedFunctionInfoRef::HasBreakInfo(JSHeapBroker* broker) const {
   }
 }
 
+OptionalHeapObjectRef SharedFunctionInfoRef::coverage_info(
+    JSHeapBroker* broker) const {
+  base::Optional<Tagged<HeapObject>> coverage_info;
+  if (broker->IsMainThread()) {
+    Isolate* isolate = broker->isolate();
+    if (object()->HasCoverageInfo(isolate)) {
+      coverage_info = object()->GetCoverageInfo(isolate);
+    }
+  } else {
+    LocalIsolate* local_isolate = broker->local_isolate();
+    SharedMutexGuardIfOffThread<LocalIsolate, base::kShared> mutex_guard(
+        local_isolate->shared_function_info_access(), local_isolate);
+    Isolate* isolate = local_isolate->GetMainThreadIsolateUnsafe();
+    if (object()->HasCoverageInfo(isolate)) {
+      coverage_info = object()->GetCoverageInfo(isolate);
+    }
+  }
+  if (!coverage_info.has_value()) return {};
+  return TryMakeRef(broker, coverage_info.value());
+}
+
 SharedFunctionInfo::Inlineability SharedFunctionInfoRef::GetInlineability(
     JSHeapBroker* broker) const {
   return broker->IsMainThread()
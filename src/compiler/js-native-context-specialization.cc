@@ -1531,15 +1531,26 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
   ZoneVector<PropertyAccessInfo> access_infos(zone());
   {
     ZoneVector<PropertyAccessInfo> access_infos_for_feedback(zone());
+    bool has_shared_struct_map = false;
+    bool has_unshared_map = false;
     for (MapRef map : inferred_maps) {
       if (map.is_deprecated()) continue;
 
-      // TODO(v8:12547): Support writing to objects in shared space, which need
-      // a write barrier that calls Object::Share to ensure the RHS is shared.
-      if (InstanceTypeChecker::IsAlwaysSharedSpaceJSObject(
-              map.instance_type()) &&
-          access_mode == AccessMode::kStore) {
-        return NoChange();
+      if (access_mode == AccessMode::kStore) {
+        // Stores to shared struct fields pass the value through a
+        // SharedValueBarrier in BuildPropertyStore, see below. That must not
+        // happen for unshared receivers, so don't mix both kinds of maps.
+        // TODO(v8:12547): Support writing to other objects in shared space.
+        InstanceType instance_type = map.instance_type();
+        if (InstanceTypeChecker::IsJSSharedStruct(instance_type)) {
+          has_shared_struct_map = true;
+        } else if (InstanceTypeChecker::IsAlwaysSharedSpaceJSObject(
+                       instance_type)) {
+          return NoChange();
+        } else {
+          has_unshared_map = true;
+        }
+        if (has_shared_struct_map && has_unshared_map) return NoChange();
       }
 
       PropertyAccessInfo access_info =
@@ -2734,6 +2745,44 @@ Node* JSNativeContextSpecialization::InlinePropertyGetterCall(
   return value;
 }
 
+bool JSNativeContextSpecialization::IsSharedStructAccess(
+    PropertyAccessInfo const& access_info) const {
+  ZoneVector<MapRef> const& maps = access_info.lookup_start_object_maps();
+  if (maps.empty()) return false;
+  DCHECK(std::all_of(maps.begin(), maps.end(), [&](MapRef map) {
+    return InstanceTypeChecker::IsJSSharedStruct(map.instance_type()) ==
+           InstanceTypeChecker::IsJSSharedStruct(maps[0].instance_type());
+  }));
+  return InstanceTypeChecker::IsJSSharedStruct(maps[0].instance_type());
+}
+
+Node* JSNativeContextSpecialization::BuildSharedValueBarrier(
+    Node* value, Node* context, Node* frame_state, Node** effect,
+    Node** control, ZoneVector<Node*>* if_exceptions) {
+  // The barrier throws for values that can't be shared, e.g. ordinary
+  // JSObjects.
+  Callable callable =
+      Builtins::CallableFor(isolate(), Builtin::kSharedValueBarrier);
+  CallDescriptor* call_descriptor = Linkage::GetStubCallDescriptor(
+      graph()->zone(), callable.descriptor(),
+      callable.descriptor().GetStackParameterCount(),
+      CallDescriptor::kNeedsFrameState, Operator::kNoProperties);
+  value = *effect = *control = graph()->NewNode(
+      common()->Call(call_descriptor),
+      jsgraph()->HeapConstantNoHole(callable.code()), value, context,
+      frame_state, *effect, *control);
+
+  // Remember to rewire the IfException edge if this is inside a try-block.
+  if (if_exceptions != nullptr) {
+    Node* const if_exception =
+        graph()->NewNode(common()->IfException(), *control, *effect);
+    Node* const if_success = graph()->NewNode(common()->IfSuccess(), *control);
+    if_exceptions->push_back(if_exception);
+    *control = if_success;
+  }
+  return value;
+}
+
 void JSNativeContextSpecialization::InlinePropertySetterCall(
     Node* receiver, Node* value, Node* context, Node* frame_state,
     Node** effect, Node** control, ZoneVector<Node*>* if_exceptions,
@@ -3046,6 +3095,12 @@ JSNativeContextSpecialization::BuildPropertyStore(
 
         } else {
           DCHECK(field_representation == MachineRepresentation::kTagged);
+          if (IsSharedStructAccess(access_info)) {
+            // Values stored into shared structs must be shareable across
+            // isolates, which may require copying them into the shared heap.
+            value = BuildSharedValueBarrier(value, context, frame_state,
+                                            &effect, &control, if_exceptions);
+          }
         }
         break;
       case MachineRepresentation::kNone:
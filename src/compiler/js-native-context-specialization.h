@@ -177,6 +177,13 @@ class V8_EXPORT_PRIVATE JSNativeContextSpecialization final
                                  Node** control,
                                  ZoneVector<Node*>* if_exceptions,
                                  PropertyAccessInfo const& access_info);
+  // Stores to shared struct fields need to make the stored value shareable
+  // first, see BuildSharedValueBarrier.
+  bool IsSharedStructAccess(PropertyAccessInfo const& access_info) const;
+  Node* BuildSharedValueBarrier(Node* value, Node* context, Node* frame_state,
+                                Node** effect, Node** control,
+                                ZoneVector<Node*>* if_exceptions);
+
   void InlinePropertySetterCall(Node* receiver, Node* value, Node* context,
                                 Node* frame_state, Node** effect,
                                 Node** control,
@@ -1862,6 +1862,20 @@ Reduction JSTypedLowering::ReduceJSCall(Node* node) {
       node->InsertInput(graph()->zone(), 3,
                         jsgraph()->ConstantNoHole(JSParameterCount(arity)));
       NodeProperties::ChangeOp(node, common()->Call(call_descriptor));
+    } else if (function.has_value() &&
+               dependencies()->DependOnInterpreterEntry(*function)) {
+      // Patch {node} to a direct call of the InterpreterEntryTrampoline.
+      Callable callable = Builtins::CallableFor(
+          isolate(), Builtin::kInterpreterEntryTrampoline);
+      auto call_descriptor = Linkage::GetStubCallDescriptor(
+          graph()->zone(), callable.descriptor(), 1 + arity, flags);
+      Node* stub_code = jsgraph()->HeapConstantNoHole(callable.code());
+      node->RemoveInput(n.FeedbackVectorIndex());
+      node->InsertInput(graph()->zone(), 0, stub_code);  // Code object.
+      node->InsertInput(graph()->zone(), 2, new_target);
+      node->InsertInput(graph()->zone(), 3,
+                        jsgraph()->ConstantNoHole(JSParameterCount(arity)));
+      NodeProperties::ChangeOp(node, common()->Call(call_descriptor));
     } else {
       // Patch {node} to a direct call.
       node->RemoveInput(n.FeedbackVectorIndex());
@@ -687,6 +687,7 @@ std::ostream& operator<<(std::ostream& os, TruncateKind kind) {
   IF_WASM(V, I16x16ShrS, Operator::kNoProperties, 2, 0, 1)                     \
   IF_WASM(V, I16x16ShrU, Operator::kNoProperties, 2, 0, 1)                     \
   IF_WASM(V, I32x8DotI16x16S, Operator::kCommutative, 2, 0, 1)                 \
+  IF_WASM(V, I32x8DotI8x32I7x32AddS, Operator::kNoProperties, 3, 0, 1)         \
   IF_WASM(V, I16x16RoundingAverageU, Operator::kCommutative, 2, 0, 1)          \
   IF_WASM(V, I8x32RoundingAverageU, Operator::kCommutative, 2, 0, 1)           \
   IF_WASM(V, I64x4ExtMulI32x4S, Operator::kCommutative, 2, 0, 1)               \
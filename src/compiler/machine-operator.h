@@ -1132,6 +1132,7 @@ class V8_EXPORT_PRIVATE MachineOperatorBuilder final
   const Operator* I16x16ShrS();
   const Operator* I16x16ShrU();
   const Operator* I32x8DotI16x16S();
+  const Operator* I32x8DotI8x32I7x32AddS();
   const Operator* I16x16RoundingAverageU();
   const Operator* I8x32RoundingAverageU();
   const Operator* I64x4ExtMulI32x4S();
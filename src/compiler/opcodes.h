@@ -1197,6 +1197,7 @@
   V(I16x16ShrS)                    \
   V(I16x16ShrU)                    \
   V(I32x8DotI16x16S)               \
+  V(I32x8DotI8x32I7x32AddS)        \
   V(I16x16RoundingAverageU)        \
   V(I8x32RoundingAverageU)         \
   V(I64x4ExtMulI32x4S)             \
@@ -68,9 +68,16 @@ PipelineStatisticsBase::PipelineStatisticsBase(
 }
 
 PipelineStatisticsBase::~PipelineStatisticsBase() {
-  CompilationStatistics::BasicStats diff;
-  total_stats_.End(this, &diff);
-  compilation_stats_->RecordTotalStats(diff);
+  if (total_stats_.scope_) {
+    CompilationStatistics::BasicStats diff;
+    EndTotal(&diff);
+  }
+}
+
+void PipelineStatisticsBase::EndTotal(CompilationStatistics::BasicStats* diff) {
+  DCHECK(!InPhaseKind());
+  total_stats_.End(this, diff);
+  compilation_stats_->RecordTotalStats(*diff);
 }
 
 void PipelineStatisticsBase::BeginPhaseKind(const char* phase_kind_name) {
@@ -112,6 +119,13 @@ TurbofanPipelineStatistics::TurbofanPipelineStatistics(
 
 TurbofanPipelineStatistics::~TurbofanPipelineStatistics() {
   if (Base::InPhaseKind()) EndPhaseKind();
+  // Report per-job totals so that outlier compilations (in time or zone
+  // memory) can be identified from a trace.
+  CompilationStatistics::BasicStats diff;
+  Base::EndTotal(&diff);
+  TRACE_EVENT_INSTANT2(kTraceCategory, "V8.TFJobStats", TRACE_EVENT_SCOPE_THREAD,
+                       "kind", CodeKindToString(code_kind()), "stats",
+                       TRACE_STR_COPY(diff.AsJSON().c_str()));
 }
 
 void TurbofanPipelineStatistics::BeginPhaseKind(const char* name) {
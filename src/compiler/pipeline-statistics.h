@@ -34,6 +34,11 @@ class PipelineStatisticsBase {
   void BeginPhaseKind(const char* phase_kind_name);
   void EndPhaseKind(CompilationStatistics::BasicStats* diff);
 
+  // Ends the stats for the entire compilation job and records them. Called by
+  // subclasses so they can report per-job totals; otherwise the destructor
+  // takes care of it.
+  void EndTotal(CompilationStatistics::BasicStats* diff);
+
   size_t OuterZoneSize() {
     return static_cast<size_t>(outer_zone_->allocation_size());
   }
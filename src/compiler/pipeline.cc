@@ -81,12 +81,14 @@
 #include "src/compiler/simplified-operator-reducer.h"
 #include "src/compiler/simplified-operator.h"
 #include "src/compiler/store-store-elimination.h"
+#include "src/compiler/turboshaft/bounds-check-elimination-phase.h"
 #include "src/compiler/turboshaft/build-graph-phase.h"
 #include "src/compiler/turboshaft/code-elimination-and-simplification-phase.h"
 #include "src/compiler/turboshaft/csa-optimize-phase.h"
 #include "src/compiler/turboshaft/debug-feature-lowering-phase.h"
 #include "src/compiler/turboshaft/decompression-optimization-phase.h"
 #include "src/compiler/turboshaft/instruction-selection-phase.h"
+#include "src/compiler/turboshaft/loop-invariant-code-motion-phase.h"
 #include "src/compiler/turboshaft/loop-peeling-phase.h"
 #include "src/compiler/turboshaft/loop-unrolling-phase.h"
 #include "src/compiler/turboshaft/machine-lowering-phase.h"
@@ -125,6 +127,7 @@
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/compiler/int64-lowering.h"
 #include "src/compiler/turboshaft/int64-lowering-phase.h"
+#include "src/compiler/turboshaft/js-loop-vectorization-phase.h"
 #include "src/compiler/turboshaft/wasm-dead-code-elimination-phase.h"
 #include "src/compiler/turboshaft/wasm-gc-optimize-phase.h"
 #include "src/compiler/turboshaft/wasm-lowering-phase.h"
@@ -800,6 +803,9 @@ class PipelineImpl final {
 
  private:
   PipelineData* const data_;
+  // Set by CreateGraph if the Turboshaft graph was built from Maglev, in which
+  // case the Turbofan graph phases are skipped.
+  bool graph_built_from_maglev_ = false;
 };
 
 namespace {
@@ -2859,8 +2865,13 @@ bool PipelineImpl::CreateGraph() {
 
     turboshaft::Tracing::Scope tracing_scope(data->info());
 
-    Run<turboshaft::MaglevGraphBuildingPhase>();
-  } else {
+    // Functions whose Maglev graph cannot be translated yet fall back to
+    // building the graph from bytecode below.
+    graph_built_from_maglev_ =
+        !Run<turboshaft::MaglevGraphBuildingPhase>().has_value();
+  }
+
+  if (!graph_built_from_maglev_) {
     Run<GraphBuilderPhase>();
     RunPrintAndVerify(GraphBuilderPhase::phase_name(), true);
 
@@ -2894,7 +2905,7 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
 
   data->BeginPhaseKind("V8.TFLowering");
 
-  if (V8_LIKELY(!v8_flags.turboshaft_from_maglev)) {
+  if (V8_LIKELY(!graph_built_from_maglev_)) {
     // Trim the graph before typing to ensure all nodes are typed.
     Run<EarlyGraphTrimmingPhase>();
     RunPrintAndVerify(EarlyGraphTrimmingPhase::phase_name(), true);
@@ -3044,7 +3055,7 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
             turboshaft::TurboshaftPipelineKind::kJS));
     turboshaft::Tracing::Scope tracing_scope(data->info());
 
-    if (!v8_flags.turboshaft_from_maglev) {
+    if (!graph_built_from_maglev_) {
       if (base::Optional<BailoutReason> bailout =
               Run<turboshaft::BuildGraphPhase>(linkage)) {
         info()->AbortOptimization(*bailout);
@@ -3077,6 +3088,21 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
       Run<turboshaft::LoopUnrollingPhase>();
     }
 
+    if (v8_flags.turboshaft_bounds_check_elimination) {
+      Run<turboshaft::BoundsCheckEliminationPhase>();
+    }
+
+    if (v8_flags.turboshaft_licm) {
+      Run<turboshaft::LoopInvariantCodeMotionPhase>();
+    }
+
+#if V8_ENABLE_WEBASSEMBLY
+    if (v8_flags.turboshaft_js_loop_vectorization &&
+        CpuFeatures::SupportsWasmSimd128()) {
+      Run<turboshaft::JSLoopVectorizationPhase>();
+    }
+#endif  // V8_ENABLE_WEBASSEMBLY
+
     if (v8_flags.turbo_store_elimination) {
       Run<turboshaft::StoreStoreEliminationPhase>();
     }
@@ -30,102 +30,103 @@ namespace compiler {
 
 namespace {
 
-#define SIMPLE_SIMD_OP(V)                   \
-  V(F64x2Add, F64x4Add)                     \
-  V(F32x4Add, F32x8Add)                     \
-  V(I64x2Add, I64x4Add)                     \
-  V(I32x4Add, I32x8Add)                     \
-  V(I16x8Add, I16x16Add)                    \
-  V(I8x16Add, I8x32Add)                     \
-  V(F64x2Sub, F64x4Sub)                     \
-  V(F32x4Sub, F32x8Sub)                     \
-  V(I64x2Sub, I64x4Sub)                     \
-  V(I32x4Sub, I32x8Sub)                     \
-  V(I16x8Sub, I16x16Sub)                    \
-  V(I8x16Sub, I8x32Sub)                     \
-  V(F64x2Mul, F64x4Mul)                     \
-  V(F32x4Mul, F32x8Mul)                     \
-  V(I64x2Mul, I64x4Mul)                     \
-  V(I32x4Mul, I32x8Mul)                     \
-  V(I16x8Mul, I16x16Mul)                    \
-  V(F64x2Div, F64x4Div)                     \
-  V(F32x4Div, F32x8Div)                     \
-  V(I16x8AddSatS, I16x16AddSatS)            \
-  V(I16x8SubSatS, I16x16SubSatS)            \
-  V(I16x8AddSatU, I16x16AddSatU)            \
-  V(I16x8SubSatU, I16x16SubSatU)            \
-  V(I8x16AddSatS, I8x32AddSatS)             \
-  V(I8x16SubSatS, I8x32SubSatS)             \
-  V(I8x16AddSatU, I8x32AddSatU)             \
-  V(I8x16SubSatU, I8x32SubSatU)             \
-  V(F64x2Eq, F64x4Eq)                       \
-  V(F32x4Eq, F32x8Eq)                       \
-  V(I64x2Eq, I64x4Eq)                       \
-  V(I32x4Eq, I32x8Eq)                       \
-  V(I16x8Eq, I16x16Eq)                      \
-  V(I8x16Eq, I8x32Eq)                       \
-  V(F64x2Ne, F64x4Ne)                       \
-  V(F32x4Ne, F32x8Ne)                       \
-  V(I64x2GtS, I64x4GtS)                     \
-  V(I32x4GtS, I32x8GtS)                     \
-  V(I16x8GtS, I16x16GtS)                    \
-  V(I8x16GtS, I8x32GtS)                     \
-  V(F64x2Lt, F64x4Lt)                       \
-  V(F32x4Lt, F32x8Lt)                       \
-  V(F64x2Le, F64x4Le)                       \
-  V(F32x4Le, F32x8Le)                       \
-  V(I32x4MinS, I32x8MinS)                   \
-  V(I16x8MinS, I16x16MinS)                  \
-  V(I8x16MinS, I8x32MinS)                   \
-  V(I32x4MinU, I32x8MinU)                   \
-  V(I16x8MinU, I16x16MinU)                  \
-  V(I8x16MinU, I8x32MinU)                   \
-  V(I32x4MaxS, I32x8MaxS)                   \
-  V(I16x8MaxS, I16x16MaxS)                  \
-  V(I8x16MaxS, I8x32MaxS)                   \
-  V(I32x4MaxU, I32x8MaxU)                   \
-  V(I16x8MaxU, I16x16MaxU)                  \
-  V(I8x16MaxU, I8x32MaxU)                   \
-  V(F32x4Abs, F32x8Abs)                     \
-  V(I32x4Abs, I32x8Abs)                     \
-  V(I16x8Abs, I16x16Abs)                    \
-  V(I8x16Abs, I8x32Abs)                     \
-  V(F32x4Neg, F32x8Neg)                     \
-  V(I32x4Neg, I32x8Neg)                     \
-  V(I16x8Neg, I16x16Neg)                    \
-  V(I8x16Neg, I8x32Neg)                     \
-  V(F64x2Sqrt, F64x4Sqrt)                   \
-  V(F32x4Sqrt, F32x8Sqrt)                   \
-  V(F64x2Min, F64x4Min)                     \
-  V(F32x4Min, F32x8Min)                     \
-  V(F64x2Max, F64x4Max)                     \
-  V(F32x4Max, F32x8Max)                     \
-  V(I64x2Ne, I64x4Ne)                       \
-  V(I32x4Ne, I32x8Ne)                       \
-  V(I16x8Ne, I16x16Ne)                      \
-  V(I8x16Ne, I8x32Ne)                       \
-  V(I32x4GtU, I32x8GtU)                     \
-  V(I16x8GtU, I16x16GtU)                    \
-  V(I8x16GtU, I8x32GtU)                     \
-  V(I64x2GeS, I64x4GeS)                     \
-  V(I32x4GeS, I32x8GeS)                     \
-  V(I16x8GeS, I16x16GeS)                    \
-  V(I8x16GeS, I8x32GeS)                     \
-  V(I32x4GeU, I32x8GeU)                     \
-  V(I16x8GeU, I16x16GeU)                    \
-  V(I8x16GeU, I8x32GeU)                     \
-  V(F32x4Pmin, F32x8Pmin)                   \
-  V(F32x4Pmax, F32x8Pmax)                   \
-  V(F64x2Pmin, F64x4Pmin)                   \
-  V(F64x2Pmax, F64x4Pmax)                   \
-  V(F32x4SConvertI32x4, F32x8SConvertI32x8) \
-  V(F32x4UConvertI32x4, F32x8UConvertI32x8) \
-  V(I32x4UConvertF32x4, I32x8UConvertF32x8) \
-  V(S128And, S256And)                       \
-  V(S128Or, S256Or)                         \
-  V(S128Xor, S256Xor)                       \
-  V(S128Not, S256Not)                       \
-  V(S128Select, S256Select)                 \
+#define SIMPLE_SIMD_OP(V)                           \
+  V(F64x2Add, F64x4Add)                             \
+  V(F32x4Add, F32x8Add)                             \
+  V(I64x2Add, I64x4Add)                             \
+  V(I32x4Add, I32x8Add)                             \
+  V(I16x8Add, I16x16Add)                            \
+  V(I8x16Add, I8x32Add)                             \
+  V(F64x2Sub, F64x4Sub)                             \
+  V(F32x4Sub, F32x8Sub)                             \
+  V(I64x2Sub, I64x4Sub)                             \
+  V(I32x4Sub, I32x8Sub)                             \
+  V(I16x8Sub, I16x16Sub)                            \
+  V(I8x16Sub, I8x32Sub)                             \
+  V(F64x2Mul, F64x4Mul)                             \
+  V(F32x4Mul, F32x8Mul)                             \
+  V(I64x2Mul, I64x4Mul)                             \
+  V(I32x4Mul, I32x8Mul)                             \
+  V(I16x8Mul, I16x16Mul)                            \
+  V(F64x2Div, F64x4Div)                             \
+  V(F32x4Div, F32x8Div)                             \
+  V(I16x8AddSatS, I16x16AddSatS)                    \
+  V(I16x8SubSatS, I16x16SubSatS)                    \
+  V(I16x8AddSatU, I16x16AddSatU)                    \
+  V(I16x8SubSatU, I16x16SubSatU)                    \
+  V(I8x16AddSatS, I8x32AddSatS)                     \
+  V(I8x16SubSatS, I8x32SubSatS)                     \
+  V(I8x16AddSatU, I8x32AddSatU)                     \
+  V(I8x16SubSatU, I8x32SubSatU)                     \
+  V(F64x2Eq, F64x4Eq)                               \
+  V(F32x4Eq, F32x8Eq)                               \
+  V(I64x2Eq, I64x4Eq)                               \
+  V(I32x4Eq, I32x8Eq)                               \
+  V(I16x8Eq, I16x16Eq)                              \
+  V(I8x16Eq, I8x32Eq)                               \
+  V(F64x2Ne, F64x4Ne)                               \
+  V(F32x4Ne, F32x8Ne)                               \
+  V(I64x2GtS, I64x4GtS)                             \
+  V(I32x4GtS, I32x8GtS)                             \
+  V(I16x8GtS, I16x16GtS)                            \
+  V(I8x16GtS, I8x32GtS)                             \
+  V(F64x2Lt, F64x4Lt)                               \
+  V(F32x4Lt, F32x8Lt)                               \
+  V(F64x2Le, F64x4Le)                               \
+  V(F32x4Le, F32x8Le)                               \
+  V(I32x4MinS, I32x8MinS)                           \
+  V(I16x8MinS, I16x16MinS)                          \
+  V(I8x16MinS, I8x32MinS)                           \
+  V(I32x4MinU, I32x8MinU)                           \
+  V(I16x8MinU, I16x16MinU)                          \
+  V(I8x16MinU, I8x32MinU)                           \
+  V(I32x4MaxS, I32x8MaxS)                           \
+  V(I16x8MaxS, I16x16MaxS)                          \
+  V(I8x16MaxS, I8x32MaxS)                           \
+  V(I32x4MaxU, I32x8MaxU)                           \
+  V(I16x8MaxU, I16x16MaxU)                          \
+  V(I8x16MaxU, I8x32MaxU)                           \
+  V(F32x4Abs, F32x8Abs)                             \
+  V(I32x4Abs, I32x8Abs)                             \
+  V(I16x8Abs, I16x16Abs)                            \
+  V(I8x16Abs, I8x32Abs)                             \
+  V(F32x4Neg, F32x8Neg)                             \
+  V(I32x4Neg, I32x8Neg)                             \
+  V(I16x8Neg, I16x16Neg)                            \
+  V(I8x16Neg, I8x32Neg)                             \
+  V(F64x2Sqrt, F64x4Sqrt)                           \
+  V(F32x4Sqrt, F32x8Sqrt)                           \
+  V(F64x2Min, F64x4Min)                             \
+  V(F32x4Min, F32x8Min)                             \
+  V(F64x2Max, F64x4Max)                             \
+  V(F32x4Max, F32x8Max)                             \
+  V(I64x2Ne, I64x4Ne)                               \
+  V(I32x4Ne, I32x8Ne)                               \
+  V(I16x8Ne, I16x16Ne)                              \
+  V(I8x16Ne, I8x32Ne)                               \
+  V(I32x4GtU, I32x8GtU)                             \
+  V(I16x8GtU, I16x16GtU)                            \
+  V(I8x16GtU, I8x32GtU)                             \
+  V(I64x2GeS, I64x4GeS)                             \
+  V(I32x4GeS, I32x8GeS)                             \
+  V(I16x8GeS, I16x16GeS)                            \
+  V(I8x16GeS, I8x32GeS)                             \
+  V(I32x4GeU, I32x8GeU)                             \
+  V(I16x8GeU, I16x16GeU)                            \
+  V(I8x16GeU, I8x32GeU)                             \
+  V(F32x4Pmin, F32x8Pmin)                           \
+  V(F32x4Pmax, F32x8Pmax)                           \
+  V(F64x2Pmin, F64x4Pmin)                           \
+  V(F64x2Pmax, F64x4Pmax)                           \
+  V(F32x4SConvertI32x4, F32x8SConvertI32x8)         \
+  V(F32x4UConvertI32x4, F32x8UConvertI32x8)         \
+  V(I32x4UConvertF32x4, I32x8UConvertF32x8)         \
+  V(S128And, S256And)                               \
+  V(S128Or, S256Or)                                 \
+  V(S128Xor, S256Xor)                               \
+  V(S128Not, S256Not)                               \
+  V(S128Select, S256Select)                         \
+  V(I32x4DotI8x16I7x16AddS, I32x8DotI8x32I7x32AddS) \
   V(S128AndNot, S256AndNot)
 
 #define SIMD_SHIFT_OP(V)   \
@@ -1277,7 +1277,29 @@ void Scheduler::PropagateImmediateDominators(BasicBlock* block) {
   }
 }
 
+void Scheduler::MarkDeoptimizeAndThrowBlocksDeferred(Schedule* schedule) {
+  // Blocks that end in a deoptimization or a throw are unlikely to be executed
+  // even when the branch leading to them carries no hint. Deferring them moves
+  // them out of the hot part of the code. A deferred block with several
+  // predecessors requires all of them to be deferred, so only blocks that have
+  // a single predecessor are marked here.
+  for (BasicBlock* block : *schedule->rpo_order()) {
+    if (block == schedule->start() || block->PredecessorCount() != 1) continue;
+    if (block->control() == BasicBlock::kDeoptimize ||
+        block->control() == BasicBlock::kThrow) {
+      TRACE("Block id:%d is deferred since it ends in a %s\n",
+            block->id().ToInt(),
+            block->control() == BasicBlock::kThrow ? "throw" : "deopt");
+      block->set_deferred(true);
+    }
+  }
+}
+
 void Scheduler::GenerateDominatorTree(Schedule* schedule) {
+  if (v8_flags.turbo_defer_deoptimize_and_throw_blocks) {
+    MarkDeoptimizeAndThrowBlocksDeferred(schedule);
+  }
+
   // Seed start block to be the first dominator.
   schedule->start()->set_dominator_depth(0);
 
@@ -110,6 +110,7 @@ class V8_EXPORT_PRIVATE Scheduler {
   void DecrementUnscheduledUseCount(Node* node, Node* from);
 
   static void PropagateImmediateDominators(BasicBlock* block);
+  static void MarkDeoptimizeAndThrowBlocksDeferred(Schedule* schedule);
 
   // Uses {common_dominator_cache_} to speed up repeated calls.
   BasicBlock* GetCommonDominator(BasicBlock* b1, BasicBlock* b2);
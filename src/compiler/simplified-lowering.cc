@@ -1975,6 +1975,7 @@ class RepresentationSelector {
           case CTypeInfo::Type::kPointer:
           case CTypeInfo::Type::kV8Value:
           case CTypeInfo::Type::kSeqOneByteString:
+          case CTypeInfo::Type::kSeqTwoByteString:
           case CTypeInfo::Type::kApiObject:
             return UseInfo::AnyTagged();
         }
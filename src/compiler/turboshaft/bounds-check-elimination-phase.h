@@ -0,0 +1,20 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_BOUNDS_CHECK_ELIMINATION_PHASE_H_
+#define V8_COMPILER_TURBOSHAFT_BOUNDS_CHECK_ELIMINATION_PHASE_H_
+
+#include "src/compiler/turboshaft/phase.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+struct BoundsCheckEliminationPhase {
+  DECL_TURBOSHAFT_PHASE_CONSTANTS(BoundsCheckElimination)
+
+  void Run(Zone* temp_zone);
+};
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_BOUNDS_CHECK_ELIMINATION_PHASE_H_
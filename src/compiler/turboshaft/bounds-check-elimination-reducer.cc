@@ -0,0 +1,164 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/bounds-check-elimination-reducer.h"
+
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/loop-finder.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+void BoundsCheckEliminationAnalyzer::DetectRedundantChecks() {
+  for (const auto& [header, info] : loop_finder_.LoopHeaders()) {
+    if (info.has_inner_loops || info.op_count > kMaxLoopSizeForAnalysis) {
+      continue;
+    }
+    AnalyzeLoop(header);
+  }
+}
+
+void BoundsCheckEliminationAnalyzer::AnalyzeLoop(Block* header) {
+  DCHECK(header->IsLoop());
+  const BranchOp* branch =
+      header->LastOperation(*input_graph_).TryCast<BranchOp>();
+  if (!branch) return;
+
+  const ComparisonOp* cond =
+      input_graph_->Get(branch->condition()).TryCast<ComparisonOp>();
+  if (!cond || cond->kind != ComparisonOp::Kind::kSignedLessThan) return;
+  OpIndex phi_idx = cond->left();
+  bool is_extended = false;
+  if (const ChangeOp* change =
+          input_graph_->Get(phi_idx).TryCast<ChangeOp>()) {
+    // Loops like `for (let i = 0; i < a.length; i++)` on typed arrays compare
+    // a sign-extended `i` against a 64-bit length.
+    if (change->kind != ChangeOp::Kind::kSignExtend) return;
+    phi_idx = change->input();
+    is_extended = true;
+  }
+  if (!IsNonNegativeInductionVariable(phi_idx, header, is_extended)) return;
+  OpIndex limit = SkipExtensions(cond->right());
+
+  auto loop_body = loop_finder_.GetLoopBody(header);
+  // The loop must be exited when the condition is false, and only when the
+  // condition is false, so that the whole body is dominated by the true
+  // successor of {branch}.
+  if (loop_body.find(branch->if_true) == loop_body.end() ||
+      loop_body.find(branch->if_false) != loop_body.end()) {
+    return;
+  }
+
+  for (Block* block : loop_body) {
+    if (block == header) continue;
+    for (OpIndex index : input_graph_->OperationIndices(*block)) {
+      const ComparisonOp* check =
+          input_graph_->Get(index).TryCast<ComparisonOp>();
+      if (!check) continue;
+      if (check->kind == ComparisonOp::Kind::kUnsignedLessThan) {
+        // Since {phi_idx} and {limit} are both non-negative, extending them
+        // doesn't change their value.
+        if (SkipExtensions(check->left()) != phi_idx) continue;
+        if (SkipExtensions(check->right()) != limit) continue;
+      } else if (check->kind == ComparisonOp::Kind::kSignedLessThan) {
+        if (check->left() != cond->left()) continue;
+        if (check->right() != cond->right()) continue;
+      } else {
+        continue;
+      }
+      redundant_checks_[index] = true;
+      found_redundant_checks_ = true;
+    }
+  }
+}
+
+bool BoundsCheckEliminationAnalyzer::IsNonNegativeInductionVariable(
+    OpIndex phi_idx, Block* header, bool needs_overflow_check) const {
+  const PhiOp* phi = input_graph_->Get(phi_idx).TryCast<PhiOp>();
+  if (!phi || phi->input_count != 2) return false;
+  if (input_graph_->BlockOf(phi_idx) != header->index()) return false;
+  if (phi->rep != RegisterRepresentation::Word32() &&
+      phi->rep != RegisterRepresentation::Word64()) {
+    return false;
+  }
+  WordRepresentation rep = WordRepresentation(phi->rep);
+
+  int64_t initial_value;
+  if (!matcher_.MatchIntegralWordConstant(phi->input(0), rep,
+                                          &initial_value) ||
+      initial_value < 0) {
+    return false;
+  }
+
+  return IsIncrementByOne(phi->input(PhiOp::kLoopPhiBackEdgeIndex), phi_idx,
+                          rep, needs_overflow_check);
+}
+
+bool BoundsCheckEliminationAnalyzer::IsIncrementByOne(
+    OpIndex idx, OpIndex phi_idx, WordRepresentation rep,
+    bool needs_overflow_check) const {
+  OpIndex left, right;
+  if (const ProjectionOp* proj =
+          input_graph_->Get(idx).TryCast<ProjectionOp>()) {
+    // Overflow checked additions are fine as well: the increment never
+    // overflows in the loop (see the class comment).
+    if (proj->index != OverflowCheckedBinopOp::kValueIndex) return false;
+    const OverflowCheckedBinopOp* binop =
+        input_graph_->Get(proj->input()).TryCast<OverflowCheckedBinopOp>();
+    if (!binop || binop->kind != OverflowCheckedBinopOp::Kind::kSignedAdd ||
+        binop->rep != rep) {
+      return false;
+    }
+    if (needs_overflow_check && !DeoptimizesOnOverflow(proj->input())) {
+      return false;
+    }
+    left = binop->left();
+    right = binop->right();
+  } else if (const WordBinopOp* binop =
+                 input_graph_->Get(idx).TryCast<WordBinopOp>()) {
+    // When the loop condition is computed on a wider representation than the
+    // increment, the increment could wrap around before the condition fails.
+    if (needs_overflow_check) return false;
+    if (binop->kind != WordBinopOp::Kind::kAdd || binop->rep != rep) {
+      return false;
+    }
+    left = binop->left();
+    right = binop->right();
+  } else {
+    return false;
+  }
+
+  if (right == phi_idx) std::swap(left, right);
+  if (left != phi_idx) return false;
+  int64_t step;
+  return matcher_.MatchIntegralWordConstant(right, rep, &step) && step == 1;
+}
+
+bool BoundsCheckEliminationAnalyzer::DeoptimizesOnOverflow(
+    OpIndex binop_idx) const {
+  const Block& block = input_graph_->Get(input_graph_->BlockOf(binop_idx));
+  for (const Operation& op : input_graph_->operations(block)) {
+    const DeoptimizeIfOp* deopt = op.TryCast<DeoptimizeIfOp>();
+    if (!deopt || deopt->negated) continue;
+    const ProjectionOp* proj =
+        input_graph_->Get(deopt->condition()).TryCast<ProjectionOp>();
+    if (proj && proj->input() == binop_idx &&
+        proj->index == OverflowCheckedBinopOp::kOverflowIndex) {
+      return true;
+    }
+  }
+  return false;
+}
+
+OpIndex BoundsCheckEliminationAnalyzer::SkipExtensions(OpIndex idx) const {
+  while (const ChangeOp* change = input_graph_->Get(idx).TryCast<ChangeOp>()) {
+    if (change->kind != ChangeOp::Kind::kZeroExtend &&
+        change->kind != ChangeOp::Kind::kSignExtend) {
+      break;
+    }
+    idx = change->input();
+  }
+  return idx;
+}
+
+}  // namespace v8::internal::compiler::turboshaft
@@ -0,0 +1,107 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/loop-finder.h"
+#include "src/compiler/turboshaft/operation-matcher.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/phase.h"
+#include "src/compiler/turboshaft/sidetable.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+class BoundsCheckEliminationAnalyzer {
+  // BoundsCheckEliminationAnalyzer finds bounds checks in innermost loops that
+  // are implied by the loop condition. In particular, it pattern matches loops
+  // like
+  //
+  //    for (let i = 0; i < a.length; i++) { ... a[i] ... }
+  //
+  // where the header of the loop ends with a `Branch(i < limit)` whose true
+  // successor is the only one that stays in the loop, `i` starts at a
+  // non-negative constant and is incremented by 1 on the backedge. In the body
+  // of such loops, `0 <= i < limit` always holds, so that any
+  // `Uint(32|64)LessThan(i, limit)` is known to be true. This is how
+  // CheckedUint32Bounds and CheckedUint64Bounds are lowered, including those
+  // introduced for typed array and DataView accesses.
+  //
+  // Note that incrementing `i` cannot overflow: the backedge is only reached
+  // through the loop body, where `i < limit <= max_int`. When `i` is
+  // sign-extended before being compared to `limit` (which is the case for
+  // typed arrays, whose length is a WordPtr), this doesn't hold anymore, and
+  // the increment must thus deopt on overflow.
+ public:
+  BoundsCheckEliminationAnalyzer(Zone* phase_zone, Graph* input_graph)
+      : input_graph_(input_graph),
+        matcher_(*input_graph),
+        loop_finder_(phase_zone, input_graph),
+        redundant_checks_(input_graph->op_id_count(), false, phase_zone,
+                          input_graph) {
+    DetectRedundantChecks();
+  }
+
+  bool IsRedundantCheck(OpIndex index) const {
+    return redundant_checks_[index];
+  }
+
+  bool found_redundant_checks() const { return found_redundant_checks_; }
+
+  static constexpr size_t kMaxLoopSizeForAnalysis = 5000;
+
+ private:
+  void DetectRedundantChecks();
+  void AnalyzeLoop(Block* header);
+  bool IsNonNegativeInductionVariable(OpIndex phi_idx, Block* header,
+                                      bool needs_overflow_check) const;
+  bool IsIncrementByOne(OpIndex idx, OpIndex phi_idx, WordRepresentation rep,
+                        bool needs_overflow_check) const;
+  // Returns true if the overflow output of {binop_idx} is used by a
+  // DeoptimizeIf in the same block.
+  bool DeoptimizesOnOverflow(OpIndex binop_idx) const;
+  // Skips integer ChangeOps that only increase the bit-width of their input.
+  // This preserves the value of non-negative inputs.
+  OpIndex SkipExtensions(OpIndex idx) const;
+
+  Graph* input_graph_;
+  OperationMatcher matcher_;
+  LoopFinder loop_finder_;
+  FixedOpIndexSidetable<bool> redundant_checks_;
+  bool found_redundant_checks_ = false;
+};
+
+template <class Next>
+class BoundsCheckEliminationReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE()
+
+  OpIndex REDUCE_INPUT_GRAPH(Comparison)(OpIndex ig_idx,
+                                         const ComparisonOp& comp) {
+    LABEL_BLOCK(no_change) {
+      return Next::ReduceInputGraphComparison(ig_idx, comp);
+    }
+    if (!analyzer_.IsRedundantCheck(ig_idx)) goto no_change;
+    if (ShouldSkipOptimizationStep()) goto no_change;
+
+    // The DeoptimizeIf (or the Branch to an Unreachable block) using this
+    // comparison will be removed by the MachineOptimizationReducer.
+    return __ Word32Constant(1);
+  }
+
+ private:
+  BoundsCheckEliminationAnalyzer analyzer_{__ phase_zone(),
+                                           &__ modifiable_input_graph()};
+};
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
@@ -58,8 +58,7 @@ class GraphVisitor : public Next {
                        Asm().phase_zone()),
         blocks_needing_variables_(Asm().input_graph().block_count(),
                                   Asm().phase_zone()),
-        old_opindex_to_variables(Asm().input_graph().op_id_count(),
-                                 Asm().phase_zone(), &Asm().input_graph()) {
+        old_opindex_to_variables(Asm().phase_zone()) {
     Asm().output_graph().Reset();
   }
 
@@ -1317,12 +1316,16 @@ class GraphVisitor : public Next {
   }
 
   MaybeVariable GetVariableFor(OpIndex old_index) const {
-    return old_opindex_to_variables[old_index];
+    auto it = old_opindex_to_variables.find(old_index);
+    if (it == old_opindex_to_variables.end()) return base::nullopt;
+    return it->second;
   }
 
   void SetVariableFor(OpIndex old_index, MaybeVariable var) {
-    DCHECK(!old_opindex_to_variables[old_index].has_value());
-    old_opindex_to_variables[old_index] = var;
+    DCHECK(var.has_value());
+    bool inserted = old_opindex_to_variables.emplace(old_index, *var).second;
+    USE(inserted);
+    DCHECK(inserted);
   }
 
   template <size_t expected_size>
@@ -1381,8 +1384,11 @@ class GraphVisitor : public Next {
   // {op_mapping}.
   BitVector blocks_needing_variables_;
 
-  // Mapping from old OpIndex to Variables.
-  FixedOpIndexSidetable<MaybeVariable> old_opindex_to_variables;
+  // Mapping from old OpIndex to Variables. Only operations of blocks that
+  // need variables (typically cloned blocks) have an entry, which is a small
+  // fraction of the graph, so this is a hash map rather than a sidetable
+  // sized to the whole input graph.
+  ZoneAbslFlatHashMap<OpIndex, Variable> old_opindex_to_variables;
 };
 
 template <template <class> class... Reducers>
@@ -271,7 +271,11 @@ class FastApiCallReducer : public Next {
               BIND(done, result);
               return result;
             }
-            case CTypeInfo::Type::kSeqOneByteString: {
+            case CTypeInfo::Type::kSeqOneByteString:
+            case CTypeInfo::Type::kSeqTwoByteString: {
+              const bool is_one_byte =
+                  arg_type.GetType() == CTypeInfo::Type::kSeqOneByteString;
+
               // Check that the value is a HeapObject.
               GOTO_IF(__ ObjectIsSmi(argument), handle_error);
               V<HeapObject> argument_obj = V<HeapObject>::Cast(argument);
@@ -281,13 +285,17 @@ class FastApiCallReducer : public Next {
 
               V<Word32> encoding = __ Word32BitwiseAnd(
                   instance_type, kStringRepresentationAndEncodingMask);
-              GOTO_IF_NOT(__ Word32Equal(encoding, kSeqOneByteStringTag),
-                          handle_error);
+              GOTO_IF_NOT(
+                  __ Word32Equal(encoding, is_one_byte ? kSeqOneByteStringTag
+                                                       : kSeqTwoByteStringTag),
+                  handle_error);
 
-              V<WordPtr> length_in_bytes = __ template LoadField<WordPtr>(
+              V<WordPtr> length = __ template LoadField<WordPtr>(
                   argument_obj, AccessBuilder::ForStringLength());
               V<WordPtr> data_ptr = __ GetElementStartPointer(
-                  argument_obj, AccessBuilder::ForSeqOneByteStringCharacter());
+                  argument_obj,
+                  is_one_byte ? AccessBuilder::ForSeqOneByteStringCharacter()
+                              : AccessBuilder::ForSeqTwoByteStringCharacter());
 
               constexpr int kAlign = alignof(FastOneByteString);
               constexpr int kSize = sizeof(FastOneByteString);
@@ -295,10 +303,14 @@ class FastApiCallReducer : public Next {
                             "The size of "
                             "FastOneByteString isn't equal to the sum of its "
                             "expected members.");
+              static_assert(sizeof(FastTwoByteString) == kSize &&
+                                alignof(FastTwoByteString) == kAlign,
+                            "FastOneByteString and FastTwoByteString are "
+                            "expected to have the same layout.");
               OpIndex stack_slot = __ StackSlot(kSize, kAlign);
               __ StoreOffHeap(stack_slot, data_ptr,
                               MemoryRepresentation::PointerSized());
-              __ StoreOffHeap(stack_slot, length_in_bytes,
+              __ StoreOffHeap(stack_slot, length,
                               MemoryRepresentation::Uint32(), sizeof(size_t));
               static_assert(sizeof(uintptr_t) == sizeof(size_t),
                             "The string length can't "
@@ -541,6 +553,7 @@ class FastApiCallReducer : public Next {
       case CTypeInfo::Type::kPointer:
         return BuildAllocateJSExternalObject(result);
       case CTypeInfo::Type::kSeqOneByteString:
+      case CTypeInfo::Type::kSeqTwoByteString:
       case CTypeInfo::Type::kV8Value:
       case CTypeInfo::Type::kApiObject:
       case CTypeInfo::Type::kUint8:
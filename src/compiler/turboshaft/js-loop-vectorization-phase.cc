@@ -0,0 +1,25 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/js-loop-vectorization-phase.h"
+
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/js-loop-vectorization-reducer.h"
+#include "src/compiler/turboshaft/machine-optimization-reducer.h"
+#include "src/compiler/turboshaft/required-optimization-reducer.h"
+#include "src/compiler/turboshaft/value-numbering-reducer.h"
+#include "src/compiler/turboshaft/variable-reducer.h"
+#include "src/numbers/conversions-inl.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+void JSLoopVectorizationPhase::Run(Zone* temp_zone) {
+  turboshaft::CopyingPhase<turboshaft::JSLoopVectorizationReducer,
+                           turboshaft::VariableReducer,
+                           turboshaft::MachineOptimizationReducer,
+                           turboshaft::RequiredOptimizationReducer,
+                           turboshaft::ValueNumberingReducer>::Run(temp_zone);
+}
+
+}  // namespace v8::internal::compiler::turboshaft
@@ -0,0 +1,381 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/js-loop-vectorization-reducer.h"
+
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/loop-finder.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+using LaneKind = JSLoopVectorizationAnalyzer::LaneKind;
+
+void JSLoopVectorizationAnalyzer::DetectVectorizableLoops() {
+  for (const auto& [header, info] : loop_finder_.LoopHeaders()) {
+    if (info.has_inner_loops || info.op_count > kMaxLoopSizeForVectorization) {
+      continue;
+    }
+    std::optional<VectorizableLoop> loop = AnalyzeLoop(header);
+    if (loop.has_value()) vectorizable_loops_.insert({header, *loop});
+  }
+}
+
+std::optional<JSLoopVectorizationAnalyzer::VectorizableLoop>
+JSLoopVectorizationAnalyzer::AnalyzeLoop(Block* header) {
+  DCHECK(header->IsLoop());
+  const BranchOp* branch =
+      header->LastOperation(*input_graph_).TryCast<BranchOp>();
+  if (!branch) return std::nullopt;
+  const ComparisonOp* cond =
+      input_graph_->Get(branch->condition()).TryCast<ComparisonOp>();
+  if (!cond || cond->kind != ComparisonOp::Kind::kSignedLessThan) {
+    return std::nullopt;
+  }
+
+  VectorizableLoop loop;
+  loop.induction_variable = cond->left();
+  if (const ChangeOp* change =
+          input_graph_->Get(cond->left()).TryCast<ChangeOp>()) {
+    if (change->kind != ChangeOp::Kind::kSignExtend) return std::nullopt;
+    loop.induction_variable = change->input();
+  }
+  const PhiOp* phi =
+      input_graph_->Get(loop.induction_variable).TryCast<PhiOp>();
+  if (!phi || phi->input_count != 2 ||
+      phi->rep != RegisterRepresentation::Word32() ||
+      input_graph_->BlockOf(loop.induction_variable) != header->index()) {
+    return std::nullopt;
+  }
+  loop.increment = GetIncrementByOne(
+      phi->input(PhiOp::kLoopPhiBackEdgeIndex), loop.induction_variable);
+  if (!loop.increment.valid()) return std::nullopt;
+
+  LoopBody body = loop_finder_.GetLoopBody(header);
+  if (body.find(branch->if_true) == body.end() ||
+      body.find(branch->if_false) != body.end()) {
+    return std::nullopt;
+  }
+  if (!IsLoopInvariant(cond->right(), header, body)) return std::nullopt;
+
+  // Since the vectorized loop can only be exited from its header, all of the
+  // other blocks of the loop should only jump to blocks of the loop.
+  for (Block* block : body) {
+    if (block == header) continue;
+    const Operation& last = block->LastOperation(*input_graph_);
+    for (Block* successor : SuccessorBlocks(last)) {
+      if (body.find(successor) == body.end()) return std::nullopt;
+    }
+  }
+
+  const Block* vector_block = nullptr;
+  MemoryRepresentation elem_rep = MemoryRepresentation::Simd128();
+  base::SmallVector<OpIndex, 32> vector_ops;
+  auto reject = [&]() -> std::optional<VectorizableLoop> {
+    for (OpIndex index : vector_ops) lane_kinds_[index] = LaneKind::kNone;
+    return std::nullopt;
+  };
+
+  for (Block* block : body) {
+    for (OpIndex index : input_graph_->OperationIndices(*block)) {
+      const Operation& op = input_graph_->Get(index);
+      if (index == loop.induction_variable) {
+        depends_on_induction_variable_[index] = true;
+        continue;
+      }
+      if (op.Is<PhiOp>() && block == header) return reject();
+      // The branch of the header is replaced in the vectorized loop.
+      if (&op == branch) continue;
+
+      bool has_vector_input = false;
+      for (OpIndex input : op.inputs()) {
+        if (depends_on_induction_variable_[input]) {
+          depends_on_induction_variable_[index] = true;
+        }
+        if (lane_kinds_[input] != LaneKind::kNone) has_vector_input = true;
+      }
+
+      if (const LoadOp* load = op.TryCast<LoadOp>();
+          load && IsVectorLoad(*load, loop.induction_variable)) {
+        if (loop.store.valid()) return reject();
+        if (elem_rep == MemoryRepresentation::Simd128()) {
+          elem_rep = load->loaded_rep;
+        } else if (elem_rep != load->loaded_rep) {
+          return reject();
+        }
+        loop.loads.push_back(index);
+        lane_kinds_[index] = elem_rep == MemoryRepresentation::Float64()
+                                 ? LaneKind::kF64x2
+                             : elem_rep == MemoryRepresentation::Float32()
+                                 ? LaneKind::kF32x4
+                                 : LaneKind::kI32x4;
+      } else if (const StoreOp* store = op.TryCast<StoreOp>();
+                 store && has_vector_input) {
+        if (loop.store.valid() ||
+            !IsVectorStore(*store, loop.induction_variable, elem_rep)) {
+          return reject();
+        }
+        loop.store = index;
+      } else if (has_vector_input) {
+        LaneKind kind = ComputeLaneKind(op, elem_rep);
+        if (kind == LaneKind::kNone) return reject();
+        lane_kinds_[index] = kind;
+      } else if (!IsScalarOperationAllowed(index, op, loop)) {
+        return reject();
+      }
+
+      if (lane_kinds_[index] != LaneKind::kNone || index == loop.store) {
+        if (vector_block == nullptr) vector_block = block;
+        if (vector_block != block) return reject();
+        vector_ops.push_back(index);
+      }
+    }
+  }
+
+  if (!loop.store.valid()) return reject();
+  loop.lanes = kSimd128Size / elem_rep.SizeInBytes();
+  return loop;
+}
+
+LaneKind JSLoopVectorizationAnalyzer::ComputeLaneKind(
+    const Operation& op, MemoryRepresentation elem_rep) {
+  // Scalar inputs are splatted, which is only correct if they have the same
+  // value in all of the iterations that are merged into a vector iteration.
+  auto is_input = [&](OpIndex input, LaneKind kind) {
+    if (lane_kinds_[input] == LaneKind::kNone) {
+      return kind != LaneKind::kF32x4Widened &&
+             !depends_on_induction_variable_[input];
+    }
+    return lane_kinds_[input] == kind;
+  };
+
+  if (const FloatBinopOp* binop = op.TryCast<FloatBinopOp>()) {
+    switch (binop->kind) {
+      case FloatBinopOp::Kind::kAdd:
+      case FloatBinopOp::Kind::kSub:
+      case FloatBinopOp::Kind::kMul:
+      case FloatBinopOp::Kind::kDiv:
+        break;
+      default:
+        return LaneKind::kNone;
+    }
+    if (elem_rep == MemoryRepresentation::Float64()) {
+      DCHECK_EQ(binop->rep, FloatRepresentation::Float64());
+      if (is_input(binop->left(), LaneKind::kF64x2) &&
+          is_input(binop->right(), LaneKind::kF64x2)) {
+        return LaneKind::kF64x2;
+      }
+    } else if (elem_rep == MemoryRepresentation::Float32()) {
+      if (binop->rep == FloatRepresentation::Float32()) {
+        if (is_input(binop->left(), LaneKind::kF32x4) &&
+            is_input(binop->right(), LaneKind::kF32x4)) {
+          return LaneKind::kF32x4;
+        }
+      } else if (is_input(binop->left(), LaneKind::kF32x4Widened) &&
+                 is_input(binop->right(), LaneKind::kF32x4Widened)) {
+        // Float64 results of a single operation on Float32 values, rounded to
+        // Float32, are the same as the results of the Float32 operation.
+        return LaneKind::kF32x4WidenedResult;
+      }
+    }
+    return LaneKind::kNone;
+  }
+
+  if (const WordBinopOp* binop = op.TryCast<WordBinopOp>()) {
+    if (elem_rep != MemoryRepresentation::Int32()) return LaneKind::kNone;
+    DCHECK_EQ(binop->rep, WordRepresentation::Word32());
+    switch (binop->kind) {
+      case WordBinopOp::Kind::kAdd:
+      case WordBinopOp::Kind::kSub:
+      case WordBinopOp::Kind::kMul:
+        break;
+      default:
+        return LaneKind::kNone;
+    }
+    if (is_input(binop->left(), LaneKind::kI32x4) &&
+        is_input(binop->right(), LaneKind::kI32x4)) {
+      return LaneKind::kI32x4;
+    }
+    return LaneKind::kNone;
+  }
+
+  if (const ChangeOp* change = op.TryCast<ChangeOp>()) {
+    if (change->kind != ChangeOp::Kind::kFloatConversion) {
+      return LaneKind::kNone;
+    }
+    if (change->from == RegisterRepresentation::Float32() &&
+        lane_kinds_[change->input()] == LaneKind::kF32x4) {
+      return LaneKind::kF32x4Widened;
+    }
+    if (change->to == RegisterRepresentation::Float32() &&
+        lane_kinds_[change->input()] == LaneKind::kF32x4WidenedResult) {
+      return LaneKind::kF32x4;
+    }
+    return LaneKind::kNone;
+  }
+
+  return LaneKind::kNone;
+}
+
+bool JSLoopVectorizationAnalyzer::IsVectorLoad(
+    const LoadOp& load, OpIndex induction_variable) const {
+  // Typed array accesses are the only loads of the JS pipeline that are not
+  // load eliminable.
+  if (load.kind.tagged_base || load.kind.is_atomic ||
+      load.kind.load_eliminable) {
+    return false;
+  }
+  if (!load.index().valid() || load.offset != 0) return false;
+  if (SkipExtensions(load.index().value()) != induction_variable) return false;
+  if (depends_on_induction_variable_[load.base()]) return false;
+  if (load.loaded_rep != MemoryRepresentation::Float64() &&
+      load.loaded_rep != MemoryRepresentation::Float32() &&
+      load.loaded_rep != MemoryRepresentation::Int32()) {
+    return false;
+  }
+  return load.element_size_log2 == load.loaded_rep.SizeInBytesLog2();
+}
+
+bool JSLoopVectorizationAnalyzer::IsVectorStore(
+    const StoreOp& store, OpIndex induction_variable,
+    MemoryRepresentation elem_rep) const {
+  if (store.kind.tagged_base || store.kind.is_atomic ||
+      store.kind.load_eliminable) {
+    return false;
+  }
+  if (store.write_barrier != WriteBarrierKind::kNoWriteBarrier) return false;
+  if (!store.index().valid() || store.offset != 0) return false;
+  if (SkipExtensions(store.index().value()) != induction_variable) {
+    return false;
+  }
+  if (depends_on_induction_variable_[store.base()]) return false;
+  if (store.stored_rep != elem_rep ||
+      store.element_size_log2 != elem_rep.SizeInBytesLog2()) {
+    return false;
+  }
+  LaneKind value_kind = lane_kinds_[store.value()];
+  return value_kind == LaneKind::kF64x2 || value_kind == LaneKind::kF32x4 ||
+         value_kind == LaneKind::kI32x4;
+}
+
+bool JSLoopVectorizationAnalyzer::IsScalarOperationAllowed(
+    OpIndex index, const Operation& op, const VectorizableLoop& loop) const {
+  // Vectorizing the loop means that the scalar operations of the loop are
+  // executed once every {lanes} iterations. Operations that depend on the
+  // induction variable are fine as long as they only flow into vector
+  // operations or frame states.
+  bool depends_on_iv = depends_on_induction_variable_[index];
+  switch (op.opcode) {
+    case Opcode::kLoad:
+      // Non-vector loads can only load from the heap. The loop's store is
+      // an off-heap store or an in-bounds store to the elements of an
+      // on-heap typed array, and thus doesn't invalidate them.
+      return !depends_on_iv && op.Cast<LoadOp>().kind.tagged_base;
+    case Opcode::kStore:
+      return false;
+    case Opcode::kCall:
+      // The stack check can trigger a lazy deopt, which would redo the
+      // iterations of the vectorized loop starting at the induction variable
+      // of the frame state. This is only correct if none of them performed
+      // the store.
+      return !loop.store.valid() &&
+             op.Cast<CallOp>().IsStackCheck(*input_graph_, broker_,
+                                            StackCheckKind::kJSIterationBody);
+    case Opcode::kDeoptimizeIf: {
+      const DeoptimizeIfOp& deopt = op.Cast<DeoptimizeIfOp>();
+      const ProjectionOp* proj =
+          input_graph_->Get(deopt.condition()).TryCast<ProjectionOp>();
+      return !deopt.negated && proj && proj->input() == loop.increment &&
+             proj->index == OverflowCheckedBinopOp::kOverflowIndex;
+    }
+    case Opcode::kBranch:
+      return !depends_on_iv;
+    case Opcode::kFrameState:
+    case Opcode::kRetain:
+    case Opcode::kGoto:
+    case Opcode::kTaggedBitcast:
+    case Opcode::kStackPointerGreaterThan:
+      return true;
+    default:
+      break;
+  }
+  if (op.IsBlockTerminator()) return false;
+  OpEffects effects = op.Effects();
+  return !effects.is_required_when_unused() && !effects.can_allocate &&
+         !effects.produces.store_heap_memory &&
+         !effects.produces.store_off_heap_memory;
+}
+
+bool JSLoopVectorizationAnalyzer::IsLoopInvariant(OpIndex index, Block* header,
+                                                  const LoopBody& body) const {
+  if (!InBody(index, body)) return true;
+  // The length of the loaded arrays is usually loaded in the loop header.
+  if (input_graph_->BlockOf(index) != header->index()) return false;
+  const Operation& op = input_graph_->Get(index);
+  if (const LoadOp* load = op.TryCast<LoadOp>()) {
+    if (!load->kind.tagged_base) return false;
+  } else if (!op.Effects().hoistable_before_a_branch()) {
+    return false;
+  }
+  for (OpIndex input : op.inputs()) {
+    if (!IsLoopInvariant(input, header, body)) return false;
+  }
+  return true;
+}
+
+OpIndex JSLoopVectorizationAnalyzer::GetIncrementByOne(
+    OpIndex value, OpIndex induction_variable) const {
+  OpIndex increment, left, right;
+  if (const ProjectionOp* proj =
+          input_graph_->Get(value).TryCast<ProjectionOp>()) {
+    if (proj->index != OverflowCheckedBinopOp::kValueIndex) {
+      return OpIndex::Invalid();
+    }
+    const OverflowCheckedBinopOp* binop =
+        input_graph_->Get(proj->input()).TryCast<OverflowCheckedBinopOp>();
+    if (!binop || binop->kind != OverflowCheckedBinopOp::Kind::kSignedAdd) {
+      return OpIndex::Invalid();
+    }
+    increment = proj->input();
+    left = binop->left();
+    right = binop->right();
+  } else if (const WordBinopOp* binop =
+                 input_graph_->Get(value).TryCast<WordBinopOp>()) {
+    if (binop->kind != WordBinopOp::Kind::kAdd) return OpIndex::Invalid();
+    increment = value;
+    left = binop->left();
+    right = binop->right();
+  } else {
+    return OpIndex::Invalid();
+  }
+
+  if (right == induction_variable) std::swap(left, right);
+  if (left != induction_variable) return OpIndex::Invalid();
+  int64_t step;
+  if (!matcher_.MatchIntegralWordConstant(right, WordRepresentation::Word32(),
+                                          &step) ||
+      step != 1) {
+    return OpIndex::Invalid();
+  }
+  return increment;
+}
+
+bool JSLoopVectorizationAnalyzer::InBody(OpIndex index,
+                                         const LoopBody& body) const {
+  Block* block = &input_graph_->Get(input_graph_->BlockOf(index));
+  return body.find(block) != body.end();
+}
+
+OpIndex JSLoopVectorizationAnalyzer::SkipExtensions(OpIndex index) const {
+  while (const ChangeOp* change =
+             input_graph_->Get(index).TryCast<ChangeOp>()) {
+    if (change->kind != ChangeOp::Kind::kSignExtend &&
+        change->kind != ChangeOp::Kind::kZeroExtend) {
+      break;
+    }
+    index = change->input();
+  }
+  return index;
+}
+
+}  // namespace v8::internal::compiler::turboshaft
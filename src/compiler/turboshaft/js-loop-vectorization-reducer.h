@@ -0,0 +1,415 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_JS_LOOP_VECTORIZATION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_JS_LOOP_VECTORIZATION_REDUCER_H_
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+#include <optional>
+
+#include "src/base/small-vector.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/loop-finder.h"
+#include "src/compiler/turboshaft/operation-matcher.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/phase.h"
+#include "src/compiler/turboshaft/sidetable.h"
+#include "src/compiler/turboshaft/utils.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+class JSLoopVectorizationAnalyzer {
+  // JSLoopVectorizationAnalyzer finds innermost loops that apply an
+  // element-wise operation on typed arrays, like
+  //
+  //    for (let i = start; i < n; i++) { c[i] = a[i] * b[i] + k; }
+  //
+  // with Float64Array, Float32Array or Int32Array {a}, {b} and {c}, and which
+  // can thus be rewritten to process kSimd128Size bytes per iteration.
+  //
+  // This only works once bounds checks have been removed from the loop (see
+  // BoundsCheckEliminationReducer), since the only deopt that is allowed in
+  // the loop is the overflow check of the induction variable (which cannot
+  // fail in the vectorized loop). The requirements are:
+  //   - the header ends with a `Branch(i < limit)`, where `i` is the only phi
+  //     of the header, is a Word32 incremented by 1, and `limit` doesn't
+  //     change during the loop. The loop is only exited through this branch.
+  //   - the loop contains a single store, of the form `base[i] = v`, where `v`
+  //     is computed (in the same block) from loads `base'[i]` with the same
+  //     element type, using additions, subtractions, multiplications and
+  //     divisions (no divisions for Int32), and values that don't depend on
+  //     `i`. For Float32, the Float64 operation emitted by JS on converted
+  //     inputs is allowed, since rounding the Float64 result of a single such
+  //     operation to Float32 gives the same result as the Float32 operation.
+  //   - the other operations of the loop don't write to memory and, if they
+  //     depend on `i`, only flow into frame states (ie, they don't influence
+  //     the loop's behavior). The loop's stack check has to come before the
+  //     store, so that a lazy deopt doesn't repeat a store.
+  // Loops with reductions (like `sum += a[i]`) aren't vectorized, since this
+  // would change the order of floating-point operations.
+ public:
+  enum class LaneKind : uint8_t {
+    kNone,
+    kF64x2,
+    kF32x4,
+    kI32x4,
+    // A kF32x4 vector whose lanes have been converted to Float64.
+    kF32x4Widened,
+    // The Float64 result of an operation on 2 kF32x4Widened vectors, which has
+    // to be converted back to Float32 right away.
+    kF32x4WidenedResult,
+  };
+
+  struct VectorizableLoop {
+    OpIndex induction_variable;
+    // The addition computing the next value of {induction_variable}.
+    OpIndex increment;
+    OpIndex store;
+    base::SmallVector<OpIndex, 4> loads;
+    int lanes;
+  };
+
+  JSLoopVectorizationAnalyzer(Zone* phase_zone, Graph* input_graph,
+                              JSHeapBroker* broker)
+      : input_graph_(input_graph),
+        broker_(broker),
+        matcher_(*input_graph),
+        loop_finder_(phase_zone, input_graph),
+        lane_kinds_(input_graph->op_id_count(), LaneKind::kNone, phase_zone,
+                    input_graph),
+        depends_on_induction_variable_(input_graph->op_id_count(), false,
+                                       phase_zone, input_graph),
+        vectorizable_loops_(phase_zone) {
+    DetectVectorizableLoops();
+  }
+
+  const VectorizableLoop* GetVectorizableLoop(const Block* header) const {
+    auto it = vectorizable_loops_.find(header);
+    if (it == vectorizable_loops_.end()) return nullptr;
+    return &it->second;
+  }
+
+  LaneKind GetLaneKind(OpIndex index) const { return lane_kinds_[index]; }
+
+  ZoneSet<Block*, LoopFinder::BlockCmp> GetLoopBody(Block* loop_header) {
+    return loop_finder_.GetLoopBody(loop_header);
+  }
+
+  static constexpr size_t kMaxLoopSizeForVectorization = 200;
+
+ private:
+  using LoopBody = ZoneSet<Block*, LoopFinder::BlockCmp>;
+
+  void DetectVectorizableLoops();
+  std::optional<VectorizableLoop> AnalyzeLoop(Block* header);
+  // Computes the lane kind of {op}, which has at least one vector input, or
+  // returns LaneKind::kNone if {op} cannot be vectorized.
+  LaneKind ComputeLaneKind(const Operation& op, MemoryRepresentation elem_rep);
+  bool IsVectorLoad(const LoadOp& load, OpIndex induction_variable) const;
+  bool IsVectorStore(const StoreOp& store, OpIndex induction_variable,
+                     MemoryRepresentation elem_rep) const;
+  bool IsScalarOperationAllowed(OpIndex index, const Operation& op,
+                                const VectorizableLoop& loop) const;
+  bool IsLoopInvariant(OpIndex index, Block* header,
+                       const LoopBody& body) const;
+  OpIndex GetIncrementByOne(OpIndex value, OpIndex induction_variable) const;
+  bool InBody(OpIndex index, const LoopBody& body) const;
+  OpIndex SkipExtensions(OpIndex index) const;
+
+  Graph* input_graph_;
+  JSHeapBroker* broker_;
+  OperationMatcher matcher_;
+  LoopFinder loop_finder_;
+  FixedOpIndexSidetable<LaneKind> lane_kinds_;
+  FixedOpIndexSidetable<bool> depends_on_induction_variable_;
+  ZoneUnorderedMap<const Block*, VectorizableLoop> vectorizable_loops_;
+};
+
+// JSLoopVectorizationReducer emits a vectorized copy of the loops found by
+// JSLoopVectorizationAnalyzer before the original loop, which then computes
+// the remaining iterations (when the number of iterations isn't a multiple of
+// the number of lanes, or when the vectorized loop bailed out because the
+// stored array overlaps a loaded array in a way that makes the vectorized
+// loop incorrect).
+template <class Next>
+class JSLoopVectorizationReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE()
+
+  using LaneKind = JSLoopVectorizationAnalyzer::LaneKind;
+  using VectorizableLoop = JSLoopVectorizationAnalyzer::VectorizableLoop;
+
+  OpIndex REDUCE_INPUT_GRAPH(Goto)(OpIndex ig_idx, const GotoOp& gto) {
+    LABEL_BLOCK(no_change) { return Next::ReduceInputGraphGoto(ig_idx, gto); }
+
+    Block* dst = gto.destination;
+    if (!dst->IsLoop() || gto.is_backedge || IsEmittingVectorLoop()) {
+      goto no_change;
+    }
+    const VectorizableLoop* loop = analyzer_.GetVectorizableLoop(dst);
+    if (loop == nullptr) goto no_change;
+    if (ShouldSkipOptimizationStep()) goto no_change;
+
+    EmitVectorLoop(dst, loop);
+    // The forward edge to the original loop is now emitted from the exit of
+    // the vectorized loop.
+    goto no_change;
+  }
+
+  OpIndex REDUCE_INPUT_GRAPH(Phi)(OpIndex ig_idx, const PhiOp& phi) {
+    if (remainder_loop_header_ == nullptr ||
+        __ current_input_block() != remainder_loop_header_) {
+      return Next::ReduceInputGraphPhi(ig_idx, phi);
+    }
+    // The remainder loop starts where the vectorized loop stopped.
+    DCHECK_EQ(ig_idx, remainder_loop_->induction_variable);
+    remainder_loop_header_ = nullptr;
+    return __ PendingLoopPhi(remainder_start_, phi.rep);
+  }
+
+  OpIndex REDUCE_INPUT_GRAPH(Branch)(OpIndex ig_idx, const BranchOp& branch) {
+    if (!IsEmittingVectorLoop() ||
+        __ current_input_block() != vector_loop_header_) {
+      return Next::ReduceInputGraphBranch(ig_idx, branch);
+    }
+
+    // The vectorized loop keeps going as long as there are at least {lanes}
+    // iterations left. Additionally, the induction variable should not
+    // overflow, since we don't want the overflow check to deopt after the
+    // vectorized store has been performed.
+    const ComparisonOp& cond =
+        __ input_graph().Get(branch.condition()).template Cast<ComparisonOp>();
+    WordRepresentation rep(cond.rep);
+    int lanes = vector_loop_->lanes;
+    OpIndex left = __ MapToNewGraph(cond.left());
+    OpIndex right = __ MapToNewGraph(cond.right());
+    V<Word32> iv = __ MapToNewGraph(vector_loop_->induction_variable);
+    V<Word32> in_bounds = __ IntLessThan(left, right, rep);
+    V<Word32> has_full_vector =
+        __ UintLessThan(__ WordConstant(lanes - 1, rep),
+                        __ WordBinop(right, left, WordBinopOp::Kind::kSub, rep),
+                        rep);
+    V<Word32> no_overflow = __ Int32LessThan(iv, kMaxInt - lanes + 1);
+    V<Word32> condition = __ Word32BitwiseAnd(
+        __ Word32BitwiseAnd(in_bounds, has_full_vector), no_overflow);
+
+    vector_loop_exit_value_ = iv;
+    __ Branch(condition, __ MapToNewGraph(branch.if_true), vector_loop_exit_,
+              branch.hint);
+    return OpIndex::Invalid();
+  }
+
+  OpIndex REDUCE_INPUT_GRAPH(WordBinop)(OpIndex ig_idx,
+                                        const WordBinopOp& binop) {
+    if (!IsEmittingVectorLoop()) {
+      return Next::ReduceInputGraphWordBinop(ig_idx, binop);
+    }
+    if (ig_idx == vector_loop_->increment) {
+      auto [left, right] = MapIncrementInputs(binop.left(), binop.right());
+      return __ WordBinop(left, right, binop.kind, binop.rep);
+    }
+    if (analyzer_.GetLaneKind(ig_idx) == LaneKind::kNone) {
+      return Next::ReduceInputGraphWordBinop(ig_idx, binop);
+    }
+
+    DCHECK_EQ(analyzer_.GetLaneKind(ig_idx), LaneKind::kI32x4);
+    Simd128BinopOp::Kind kind;
+    switch (binop.kind) {
+      case WordBinopOp::Kind::kAdd:
+        kind = Simd128BinopOp::Kind::kI32x4Add;
+        break;
+      case WordBinopOp::Kind::kSub:
+        kind = Simd128BinopOp::Kind::kI32x4Sub;
+        break;
+      case WordBinopOp::Kind::kMul:
+        kind = Simd128BinopOp::Kind::kI32x4Mul;
+        break;
+      default:
+        UNREACHABLE();
+    }
+    EmitVectorBinop(ig_idx, binop.left(), binop.right(), kind,
+                    Simd128SplatOp::Kind::kI32x4);
+    return OpIndex::Invalid();
+  }
+
+  OpIndex REDUCE_INPUT_GRAPH(OverflowCheckedBinop)(
+      OpIndex ig_idx, const OverflowCheckedBinopOp& binop) {
+    if (!IsEmittingVectorLoop() || ig_idx != vector_loop_->increment) {
+      return Next::ReduceInputGraphOverflowCheckedBinop(ig_idx, binop);
+    }
+    auto [left, right] = MapIncrementInputs(binop.left(), binop.right());
+    return __ OverflowCheckedBinop(left, right, binop.kind, binop.rep);
+  }
+
+  OpIndex REDUCE_INPUT_GRAPH(FloatBinop)(OpIndex ig_idx,
+                                         const FloatBinopOp& binop) {
+    LaneKind lane_kind = analyzer_.GetLaneKind(ig_idx);
+    if (!IsEmittingVectorLoop() || lane_kind == LaneKind::kNone) {
+      return Next::ReduceInputGraphFloatBinop(ig_idx, binop);
+    }
+
+    bool is_f64 = lane_kind == LaneKind::kF64x2;
+    Simd128BinopOp::Kind kind;
+    switch (binop.kind) {
+      case FloatBinopOp::Kind::kAdd:
+        kind = is_f64 ? Simd128BinopOp::Kind::kF64x2Add
+                      : Simd128BinopOp::Kind::kF32x4Add;
+        break;
+      case FloatBinopOp::Kind::kSub:
+        kind = is_f64 ? Simd128BinopOp::Kind::kF64x2Sub
+                      : Simd128BinopOp::Kind::kF32x4Sub;
+        break;
+      case FloatBinopOp::Kind::kMul:
+        kind = is_f64 ? Simd128BinopOp::Kind::kF64x2Mul
+                      : Simd128BinopOp::Kind::kF32x4Mul;
+        break;
+      case FloatBinopOp::Kind::kDiv:
+        kind = is_f64 ? Simd128BinopOp::Kind::kF64x2Div
+                      : Simd128BinopOp::Kind::kF32x4Div;
+        break;
+      default:
+        UNREACHABLE();
+    }
+    EmitVectorBinop(ig_idx, binop.left(), binop.right(), kind,
+                    is_f64 ? Simd128SplatOp::Kind::kF64x2
+                           : Simd128SplatOp::Kind::kF32x4);
+    return OpIndex::Invalid();
+  }
+
+  OpIndex REDUCE_INPUT_GRAPH(Change)(OpIndex ig_idx, const ChangeOp& change) {
+    if (!IsEmittingVectorLoop() ||
+        analyzer_.GetLaneKind(ig_idx) == LaneKind::kNone) {
+      return Next::ReduceInputGraphChange(ig_idx, change);
+    }
+    // Float32 <-> Float64 conversions of vectorized Float32 values are no-ops,
+    // since the operations on the converted values are performed on Float32
+    // lanes directly.
+    DCHECK_EQ(change.kind, ChangeOp::Kind::kFloatConversion);
+    vector_values_[ig_idx] = vector_values_[change.input()];
+    return OpIndex::Invalid();
+  }
+
+  OpIndex REDUCE_INPUT_GRAPH(Load)(OpIndex ig_idx, const LoadOp& load) {
+    if (!IsEmittingVectorLoop() ||
+        analyzer_.GetLaneKind(ig_idx) == LaneKind::kNone) {
+      return Next::ReduceInputGraphLoad(ig_idx, load);
+    }
+    vector_values_[ig_idx] =
+        __ Load(__ MapToNewGraph(load.base()),
+                __ MapToNewGraph(load.index().value()), load.kind,
+                MemoryRepresentation::Simd128(),
+                RegisterRepresentation::Simd128(), 0, load.element_size_log2);
+    return OpIndex::Invalid();
+  }
+
+  OpIndex REDUCE_INPUT_GRAPH(Store)(OpIndex ig_idx, const StoreOp& store) {
+    if (!IsEmittingVectorLoop() || ig_idx != vector_loop_->store) {
+      return Next::ReduceInputGraphStore(ig_idx, store);
+    }
+
+    // If the stored array starts less than kSimd128Size bytes after one of the
+    // loaded arrays, then the scalar loop would load values stored by a
+    // previous iteration, which the vectorized loop would miss. In this case,
+    // the remainder of the loop is computed by the scalar loop.
+    V<WordPtr> store_base = __ MapToNewGraph(store.base());
+    for (OpIndex load_idx : vector_loop_->loads) {
+      const LoadOp& load = __ input_graph().Get(load_idx).template Cast<LoadOp>();
+      V<WordPtr> load_base = __ MapToNewGraph(load.base());
+      V<WordPtr> distance = __ WordPtrSub(store_base, load_base);
+      __ GotoIf(UNLIKELY(__ UintPtrLessThan(
+                    __ WordPtrSub(distance, 1),
+                    __ IntPtrConstant(kSimd128Size - 1))),
+                vector_loop_exit_);
+    }
+
+    __ Store(store_base, __ MapToNewGraph(store.index().value()),
+             vector_values_[store.value()], store.kind,
+             MemoryRepresentation::Simd128(), store.write_barrier, 0,
+             store.element_size_log2);
+    return OpIndex::Invalid();
+  }
+
+ private:
+  bool IsEmittingVectorLoop() const { return vector_loop_ != nullptr; }
+
+  void EmitVectorLoop(Block* header, const VectorizableLoop* loop) {
+    vector_loop_exit_ = __ NewBlock();
+    {
+      ScopedModification<const VectorizableLoop*> set_loop(&vector_loop_,
+                                                           loop);
+      ScopedModification<const Block*> set_header(&vector_loop_header_,
+                                                  header);
+      __ CloneSubGraph(analyzer_.GetLoopBody(header),
+                       /* keep_loop_kinds */ true);
+    }
+
+    // All of the exits of the vectorized loop are in iterations that haven't
+    // performed any store yet, so the remainder loop can restart from the
+    // current value of the induction variable.
+    __ Bind(vector_loop_exit_);
+    remainder_loop_header_ = header;
+    remainder_loop_ = loop;
+    remainder_start_ = vector_loop_exit_value_;
+  }
+
+  std::pair<OpIndex, OpIndex> MapIncrementInputs(OpIndex left, OpIndex right) {
+    WordRepresentation rep = WordRepresentation::Word32();
+    OpIndex lanes = __ WordConstant(vector_loop_->lanes, rep);
+    if (left == vector_loop_->induction_variable) {
+      return {__ MapToNewGraph(left), lanes};
+    }
+    DCHECK_EQ(right, vector_loop_->induction_variable);
+    return {lanes, __ MapToNewGraph(right)};
+  }
+
+  V<Simd128> GetVectorInput(OpIndex input, Simd128SplatOp::Kind splat_kind) {
+    if (analyzer_.GetLaneKind(input) != LaneKind::kNone) {
+      DCHECK(vector_values_[input].valid());
+      return vector_values_[input];
+    }
+    return __ Simd128Splat(__ MapToNewGraph(input), splat_kind);
+  }
+
+  void EmitVectorBinop(OpIndex ig_idx, OpIndex left, OpIndex right,
+                       Simd128BinopOp::Kind kind,
+                       Simd128SplatOp::Kind splat_kind) {
+    V<Simd128> new_left = GetVectorInput(left, splat_kind);
+    V<Simd128> new_right = GetVectorInput(right, splat_kind);
+    vector_values_[ig_idx] = __ Simd128Binop(new_left, new_right, kind);
+  }
+
+  JSLoopVectorizationAnalyzer analyzer_{__ phase_zone(),
+                                        &__ modifiable_input_graph(),
+                                        PipelineData::Get().broker()};
+
+  // State while emitting the vectorized loop.
+  const VectorizableLoop* vector_loop_ = nullptr;
+  const Block* vector_loop_header_ = nullptr;
+  Block* vector_loop_exit_ = nullptr;
+  OpIndex vector_loop_exit_value_ = OpIndex::Invalid();
+  // The vectorized values of the operations of the loop. They are not
+  // recorded in the regular old-to-new mapping, since they don't have the
+  // same representation as the original operations.
+  FixedOpIndexSidetable<OpIndex> vector_values_{
+      __ input_graph().op_id_count(), OpIndex::Invalid(), __ phase_zone(),
+      &__ input_graph()};
+
+  // State while emitting the remainder loop.
+  const Block* remainder_loop_header_ = nullptr;
+  const VectorizableLoop* remainder_loop_ = nullptr;
+  OpIndex remainder_start_ = OpIndex::Invalid();
+};
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_JS_LOOP_VECTORIZATION_REDUCER_H_
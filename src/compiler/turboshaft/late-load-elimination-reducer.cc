@@ -231,6 +231,15 @@ void LateLoadEliminationAnalyzer::ProcessCall(OpIndex op_idx,
         memory_.Invalidate(op.arguments()[0], OpIndex::Invalid(),
                            JSObject::kElementsOffset);
         return;
+      case Builtin::kFastNewFunctionContextFunction:
+      case Builtin::kFastNewFunctionContextEval:
+        // These only allocate and initialize a new context, so no existing
+        // memory is invalidated. The new context references its inputs
+        // though, so they could have aliases from now on.
+        for (OpIndex input : op.inputs()) {
+          InvalidateIfAlias(input);
+        }
+        return;
       default:
         break;
     }
@@ -0,0 +1,157 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_LOOP_INVARIANT_CODE_MOTION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_LOOP_INVARIANT_CODE_MOTION_REDUCER_H_
+
+#include "src/base/logging.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/loop-finder.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/phase.h"
+#include "src/compiler/turboshaft/sidetable.h"
+#include "src/compiler/turboshaft/uniform-reducer-adapter.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+// LoopInvariantCodeMotion moves loop-invariant operations out of the header of
+// innermost loops and into their pre-header, so that they are computed once
+// per loop entry rather than once per iteration.
+//
+// Only operations of the loop header are considered: since the header is
+// executed every time the loop is entered, hoisting these operations never
+// introduces computations on paths that didn't have them before. An operation
+// is hoisted if:
+//   - all of its inputs are defined outside of the loop (or are themselves
+//     hoisted),
+//   - it can be reordered before a branch or a check (see
+//     `OpEffects::hoistable_before_a_branch`) and doesn't create identity,
+//   - if it reads mutable memory, nothing in the loop writes to memory.
+// This last condition is a very conservative replacement for a proper alias
+// analysis, but it covers the common case of loops computing on values that
+// are read from a fixed location.
+
+template <class Next>
+class LoopInvariantCodeMotionReducer
+    : public UniformReducerAdapter<LoopInvariantCodeMotionReducer, Next> {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE()
+
+  using Adapter = UniformReducerAdapter<LoopInvariantCodeMotionReducer, Next>;
+
+  void Analyze() {
+    for (const auto& [header, info] : loop_finder_.LoopHeaders()) {
+      if (info.has_inner_loops || info.op_count > kMaxLoopSizeForAnalysis) {
+        continue;
+      }
+      ComputeHoistableOperations(header);
+    }
+    Next::Analyze();
+  }
+
+  OpIndex REDUCE_INPUT_GRAPH(Goto)(OpIndex ig_idx, const GotoOp& gto) {
+    LABEL_BLOCK(no_change) { return Next::ReduceInputGraphGoto(ig_idx, gto); }
+
+    Block* dst = gto.destination;
+    if (!dst->IsLoop() || gto.is_backedge) goto no_change;
+    auto it = hoistable_ops_.find(dst);
+    if (it == hoistable_ops_.end()) goto no_change;
+    if (ShouldSkipOptimizationStep()) goto no_change;
+
+    // Emitting the hoisted operations right before the forward edge to the
+    // loop header, ie, at the end of the pre-header.
+    for (OpIndex index : it->second) {
+      if (!__ InlineOp(index, __ current_input_block())) break;
+      hoisted_[index] = true;
+    }
+
+    goto no_change;
+  }
+
+  template <typename Op, typename Continuation>
+  OpIndex ReduceInputGraphOperation(OpIndex ig_index, const Op& op) {
+    if (hoisted_[ig_index]) {
+      // This operation has already been emitted in the pre-header, and the
+      // mapping to its new index has already been recorded. Returning Invalid
+      // here prevents the mapping from being updated a second time.
+      return OpIndex::Invalid();
+    }
+    return Continuation{this}.ReduceInputGraph(ig_index, op);
+  }
+
+ private:
+  // Analyzing a loop is linear in its size, but very large loops are unlikely
+  // to have their header dominate their running time.
+  static constexpr size_t kMaxLoopSizeForAnalysis = 5000;
+
+  void ComputeHoistableOperations(Block* header) {
+    const Graph& graph = __ input_graph();
+    auto loop_body = loop_finder_.GetLoopBody(header);
+
+    bool loop_writes_memory = false;
+    for (const Block* block : loop_body) {
+      for (const Operation& op : graph.operations(*block)) {
+        OpEffects effects = op.Effects();
+        if (effects.produces.store_heap_memory ||
+            effects.produces.store_off_heap_memory) {
+          loop_writes_memory = true;
+          break;
+        }
+      }
+      if (loop_writes_memory) break;
+    }
+
+    ZoneVector<OpIndex> hoistable(__ phase_zone());
+    for (OpIndex index : graph.OperationIndices(*header)) {
+      const Operation& op = graph.Get(index);
+      if (!CanHoist(op, loop_writes_memory)) continue;
+      bool inputs_are_invariant = true;
+      for (OpIndex input : op.inputs()) {
+        if (hoisted_[input]) continue;
+        Block* input_block = &graph.Get(graph.BlockOf(input));
+        if (loop_body.find(input_block) != loop_body.end()) {
+          inputs_are_invariant = false;
+          break;
+        }
+      }
+      if (!inputs_are_invariant) continue;
+      hoistable.push_back(index);
+      // {hoisted_} is temporarily used to record ops that will be hoisted so
+      // that their uses in the header can be hoisted as well. It is reset
+      // below, and set again once the operations have actually been emitted.
+      hoisted_[index] = true;
+    }
+    if (hoistable.empty()) return;
+    for (OpIndex index : hoistable) hoisted_[index] = false;
+    hoistable_ops_.insert({header, std::move(hoistable)});
+  }
+
+  static bool CanHoist(const Operation& op, bool loop_writes_memory) {
+    if (op.Is<PhiOp>() || op.IsBlockTerminator()) return false;
+    if (!CanBeUsedAsInput(op)) return false;
+    OpEffects effects = op.Effects();
+    if (!effects.hoistable_before_a_branch()) return false;
+    if (effects.can_create_identity || effects.is_required_when_unused()) {
+      return false;
+    }
+    if (effects.can_read_mutable_memory() && loop_writes_memory) return false;
+    return true;
+  }
+
+  ZoneUnorderedMap<Block*, ZoneVector<OpIndex>> hoistable_ops_{
+      __ phase_zone()};
+  FixedOpIndexSidetable<bool> hoisted_{__ input_graph().op_id_count(), false,
+                                       __ phase_zone(), &__ input_graph()};
+  LoopFinder loop_finder_{__ phase_zone(), &__ modifiable_input_graph()};
+};
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_LOOP_INVARIANT_CODE_MOTION_REDUCER_H_
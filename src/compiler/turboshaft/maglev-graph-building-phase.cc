@@ -14,6 +14,54 @@ namespace v8::internal::compiler::turboshaft {
 
 #include "src/compiler/turboshaft/define-assembler-macros.inc"
 
+// Checks ahead of translation whether GraphBuilder supports every node of a
+// Maglev graph. Keep in sync with the Process overloads of GraphBuilder.
+class SupportChecker {
+ public:
+  void PreProcessGraph(maglev::Graph* graph) {}
+  void PostProcessGraph(maglev::Graph* graph) {}
+  void PreProcessBasicBlock(maglev::BasicBlock* block) {}
+
+#define SUPPORTED_NODE(Name)                                        \
+  maglev::ProcessResult Process(maglev::Name* node,                 \
+                                const maglev::ProcessingState&) {   \
+    CheckDeoptInfo(node);                                           \
+    return maglev::ProcessResult::kContinue;                        \
+  }
+  SUPPORTED_NODE(Constant)
+  SUPPORTED_NODE(RootConstant)
+  SUPPORTED_NODE(InitialValue)
+  SUPPORTED_NODE(FunctionEntryStackCheck)
+  SUPPORTED_NODE(Jump)
+  SUPPORTED_NODE(CheckedSmiUntag)
+  SUPPORTED_NODE(Int32AddWithOverflow)
+  SUPPORTED_NODE(Int32ToNumber)
+  SUPPORTED_NODE(Return)
+  SUPPORTED_NODE(ReduceInterruptBudgetForReturn)
+#undef SUPPORTED_NODE
+
+  template <typename NodeT>
+  maglev::ProcessResult Process(NodeT* node, const maglev::ProcessingState&) {
+    supported_ = false;
+    return maglev::ProcessResult::kContinue;
+  }
+
+  bool supported() const { return supported_; }
+
+ private:
+  template <typename NodeT>
+  void CheckDeoptInfo(NodeT* node) {
+    if constexpr (NodeT::kProperties.can_eager_deopt()) {
+      // Frame states of inlined functions are not translated yet.
+      if (node->eager_deopt_info()->top_frame().parent() != nullptr) {
+        supported_ = false;
+      }
+    }
+  }
+
+  bool supported_ = true;
+};
+
 class GraphBuilder {
  public:
   using Assembler = TSAssembler<>;
@@ -223,7 +271,7 @@ class GraphBuilder {
   ZoneUnorderedMap<const maglev::BasicBlock*, Block*> block_mapping_;
 };
 
-void MaglevGraphBuildingPhase::Run(Zone* temp_zone) {
+base::Optional<BailoutReason> MaglevGraphBuildingPhase::Run(Zone* temp_zone) {
   PipelineData& data = PipelineData::Get();
   UnparkedScopeIfNeeded unparked_scope(data.broker());
 
@@ -238,8 +286,15 @@ void MaglevGraphBuildingPhase::Run(Zone* temp_zone) {
       compilation_info->toplevel_compilation_unit(), maglev_graph);
   maglev_graph_builder.Build();
 
+  maglev::GraphProcessor<SupportChecker, true> checker;
+  checker.ProcessGraph(maglev_graph);
+  if (!checker.node_processor().supported()) {
+    return BailoutReason::kGraphBuildingFailed;
+  }
+
   maglev::GraphProcessor<GraphBuilder, true> builder(data.graph(), temp_zone);
   builder.ProcessGraph(maglev_graph);
+  return {};
 }
 
 #include "src/compiler/turboshaft/undef-assembler-macros.inc"
@@ -5,6 +5,8 @@
 #ifndef V8_COMPILER_TURBOSHAFT_MAGLEV_GRAPH_BUILDING_PHASE_H_
 #define V8_COMPILER_TURBOSHAFT_MAGLEV_GRAPH_BUILDING_PHASE_H_
 
+#include "src/base/optional.h"
+#include "src/codegen/bailout-reason.h"
 #include "src/compiler/turboshaft/phase.h"
 #include "src/zone/zone.h"
 
@@ -13,7 +15,10 @@ namespace v8::internal::compiler::turboshaft {
 struct MaglevGraphBuildingPhase {
   DECL_TURBOSHAFT_PHASE_CONSTANTS(MaglevGraphBuilding)
 
-  void Run(Zone* temp_zone);
+  // Returns a bailout reason if the Maglev graph contains nodes that cannot be
+  // translated yet, in which case the Turboshaft graph is left untouched and
+  // the caller can build the graph from bytecode instead.
+  base::Optional<BailoutReason> Run(Zone* temp_zone);
 };
 
 }  // namespace v8::internal::compiler::turboshaft
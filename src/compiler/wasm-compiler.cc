@@ -3231,6 +3231,40 @@ void WasmGraphBuilder::CompareToInternalFunctionAtIndex(Node* func_ref,
                 success_control, failure_control, hint);
 }
 
+void WasmGraphBuilder::CompareToIndirectCallTargetAtIndex(
+    uint32_t table_index, Node* key, uint32_t function_index,
+    Node** success_control, Node** failure_control, bool is_last_case,
+    wasm::WasmCodePosition position) {
+  Node* ift_size;
+  Node* ift_sig_ids;
+  Node* ift_targets;
+  Node* ift_refs;
+  LoadIndirectFunctionTable(table_index, &ift_size, &ift_sig_ids, &ift_targets,
+                            &ift_refs);
+  TrapIfFalse(wasm::kTrapTableOutOfBounds, gasm_->Uint32LessThan(key, ift_size),
+              position);
+
+  // All instances of a module share its jump table, so both the target and
+  // the instance need to match.
+  Node* key_intptr = gasm_->BuildChangeUint32ToUintPtr(key);
+  Node* target = gasm_->LoadExternalPointerArrayElement(
+      ift_targets, key_intptr, kWasmIndirectFunctionTargetTag,
+      BuildLoadIsolateRoot());
+  Node* expected_target = gasm_->IntAdd(
+      LOAD_INSTANCE_FIELD(JumpTableStart, MachineType::Pointer()),
+      gasm_->IntPtrConstant(wasm::JumpTableOffset(env_->module,
+                                                  function_index)));
+  Node* target_ref = gasm_->LoadFixedArrayElement(ift_refs, key_intptr,
+                                                  MachineType::TaggedPointer());
+  Node* instance_object =
+      LOAD_INSTANCE_FIELD(InstanceObject, MachineType::TaggedPointer());
+  Node* is_match =
+      gasm_->Word32And(gasm_->WordEqual(target, expected_target),
+                       gasm_->TaggedEqual(target_ref, instance_object));
+  BranchHint hint = is_last_case ? BranchHint::kTrue : BranchHint::kNone;
+  gasm_->Branch(is_match, success_control, failure_control, hint);
+}
+
 Node* WasmGraphBuilder::CallRef(const wasm::FunctionSig* sig,
                                 base::Vector<Node*> args,
                                 base::Vector<Node*> rets,
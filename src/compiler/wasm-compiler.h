@@ -319,6 +319,16 @@ class WasmGraphBuilder {
                                         Node** failure_control,
                                         bool is_last_case);
 
+  // Branches on whether entry {key} of the dispatch table {table_index} holds
+  // the function {function_index} of this instance. Traps if {key} is out of
+  // bounds.
+  void CompareToIndirectCallTargetAtIndex(uint32_t table_index, Node* key,
+                                          uint32_t function_index,
+                                          Node** success_control,
+                                          Node** failure_control,
+                                          bool is_last_case,
+                                          wasm::WasmCodePosition position);
+
   // BrOnNull returns the control for the null and non-null case.
   std::tuple<Node*, Node*> BrOnNull(Node* ref_object, wasm::ValueType type);
 
@@ -99,6 +99,39 @@ class FastCApiObject {
     CHECK_SELF_OR_THROW();
     self->slow_call_count_++;
   }
+
+#ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static AnyCType CopyTwoByteStringFastCallbackPatch(AnyCType receiver,
+                                                     AnyCType should_fallback,
+                                                     AnyCType source,
+                                                     AnyCType out,
+                                                     AnyCType options) {
+    AnyCType ret;
+    CopyTwoByteStringFastCallback(
+        receiver.object_value, should_fallback.bool_value,
+        *source.two_byte_string_value, *out.uint8_ta_value,
+        *options.options_value);
+    return ret;
+  }
+
+#endif  //  V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
+  static void CopyTwoByteStringFastCallback(
+      Local<Object> receiver, bool should_fallback,
+      const FastTwoByteString& source, const FastApiTypedArray<uint8_t>& out,
+      FastApiCallbackOptions& options) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    self->fast_call_count_++;
+
+    if (should_fallback) {
+      options.fallback = true;
+    } else {
+      options.fallback = false;
+    }
+
+    uint8_t* memory = nullptr;
+    CHECK(out.getStorageIfAligned(&memory));
+    memcpy(memory, source.data, source.length * sizeof(uint16_t));
+  }
 #ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
   static AnyCType AddAllFastCallbackPatch(AnyCType receiver,
                                           AnyCType should_fallback,
@@ -1463,6 +1496,16 @@ Local<FunctionTemplate> Shell::CreateTestFastCApiTemplate(Isolate* isolate) {
                               ConstructorBehavior::kThrow,
                               SideEffectType::kHasSideEffect, &copy_str_func));
 
+    CFunction copy_two_byte_str_func = CFunction::Make(
+        FastCApiObject::CopyTwoByteStringFastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::CopyTwoByteStringFastCallbackPatch));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "copy_two_byte_string",
+        FunctionTemplate::New(
+            isolate, FastCApiObject::CopyStringSlowCallback, Local<Value>(),
+            signature, 1, ConstructorBehavior::kThrow,
+            SideEffectType::kHasSideEffect, &copy_two_byte_str_func));
+
     CFunction add_all_c_func =
         CFunction::Make(FastCApiObject::AddAllFastCallback V8_IF_USE_SIMULATOR(
             FastCApiObject::AddAllFastCallbackPatch));
@@ -4956,6 +4956,12 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--thread-pool-size=", 19) == 0) {
       options.thread_pool_size = atoi(argv[i] + 19);
       argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--bench-isolates=", 17) == 0) {
+      options.bench_isolates = atoi(argv[i] + 17);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--bench-seconds=", 16) == 0) {
+      options.bench_seconds = atoi(argv[i] + 16);
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--stress-delay-tasks") == 0) {
       // Delay execution of tasks by 0-100ms randomly (based on --random-seed).
       options.stress_delay_tasks = true;
@@ -5194,6 +5200,175 @@ bool Shell::RunMainIsolate(v8::Isolate* isolate, bool keep_context_alive) {
   return success;
 }
 
+namespace {
+
+// Metrics collected by a single --bench-isolates thread. Only the owning
+// thread writes to them until it has been joined.
+struct BenchIsolateStats {
+  size_t ops = 0;
+  bool failed = false;
+  std::vector<double> gc_pauses_ms;
+  base::TimeTicks gc_start;
+  int compile_queue_max = 0;
+  int64_t compile_queue_sum = 0;
+  int64_t compile_queue_samples = 0;
+};
+
+void BenchGCPrologue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                     void* data) {
+  static_cast<BenchIsolateStats*>(data)->gc_start = base::TimeTicks::Now();
+}
+
+void BenchGCEpilogue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                     void* data) {
+  BenchIsolateStats* stats = static_cast<BenchIsolateStats*>(data);
+  stats->gc_pauses_ms.push_back(
+      (base::TimeTicks::Now() - stats->gc_start).InMillisecondsF());
+}
+
+class BenchIsolateThread : public base::Thread {
+ public:
+  BenchIsolateThread(base::TimeTicks deadline, BenchIsolateStats* stats)
+      : base::Thread(GetThreadOptions("BenchIsolateThread")),
+        deadline_(deadline),
+        stats_(stats) {}
+
+  void Run() override {
+    Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = Shell::array_buffer_allocator;
+    Isolate* isolate = Isolate::New(create_params);
+    i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+    {
+      Isolate::Scope isolate_scope(isolate);
+      D8Console console(isolate);
+      Shell::Initialize(isolate, &console, false);
+      PerIsolateData data(isolate);
+      isolate->AddGCPrologueCallback(BenchGCPrologue, stats_);
+      isolate->AddGCEpilogueCallback(BenchGCEpilogue, stats_);
+
+      // Every iteration runs the script in a fresh context, like a server
+      // handling one request per context.
+      while (base::TimeTicks::Now() < deadline_) {
+        {
+          HandleScope scope(isolate);
+          Local<Context> context;
+          if (!Shell::CreateEvaluationContext(isolate).ToLocal(&context)) {
+            stats_->failed = true;
+            break;
+          }
+          Context::Scope context_scope(context);
+          PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
+          if (!Shell::options.isolate_sources[0].Execute(isolate) ||
+              !Shell::CompleteMessageLoop(isolate)) {
+            stats_->failed = true;
+            break;
+          }
+        }
+        stats_->ops++;
+        if (i_isolate->concurrent_recompilation_enabled()) {
+          int length =
+              i_isolate->optimizing_compile_dispatcher()->InputQueueLength();
+          stats_->compile_queue_max =
+              std::max(stats_->compile_queue_max, length);
+          stats_->compile_queue_sum += length;
+          stats_->compile_queue_samples++;
+        }
+        Shell::CollectGarbage(isolate);
+      }
+
+      isolate->RemoveGCEpilogueCallback(BenchGCEpilogue, stats_);
+      isolate->RemoveGCPrologueCallback(BenchGCPrologue, stats_);
+      Shell::ResetOnProfileEndListener(isolate);
+    }
+    isolate->Dispose();
+  }
+
+ private:
+  const base::TimeTicks deadline_;
+  BenchIsolateStats* const stats_;
+};
+
+// Nearest-rank percentile of an ascending list of samples.
+double BenchPercentile(const std::vector<double>& sorted, int percentile) {
+  if (sorted.empty()) return 0;
+  size_t rank = (sorted.size() * percentile + 99) / 100;
+  return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+void PrintBenchGCPauses(std::vector<double> pauses_ms) {
+  std::sort(pauses_ms.begin(), pauses_ms.end());
+  double total_ms = 0;
+  for (double pause : pauses_ms) total_ms += pause;
+  printf(
+      "{\"count\": %zu, \"total_ms\": %.3f, \"p50_ms\": %.3f, "
+      "\"p90_ms\": %.3f, \"p99_ms\": %.3f, \"max_ms\": %.3f}",
+      pauses_ms.size(), total_ms, BenchPercentile(pauses_ms, 50),
+      BenchPercentile(pauses_ms, 90), BenchPercentile(pauses_ms, 99),
+      pauses_ms.empty() ? 0 : pauses_ms.back());
+}
+
+}  // namespace
+
+int Shell::RunBench(v8::Isolate* isolate) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  const int isolate_count = options.bench_isolates;
+  std::vector<BenchIsolateStats> stats(isolate_count);
+  std::vector<std::unique_ptr<BenchIsolateThread>> threads;
+  const base::TimeTicks start = base::TimeTicks::Now();
+  const base::TimeTicks deadline =
+      start + base::TimeDelta::FromSeconds(options.bench_seconds);
+  for (int i = 0; i < isolate_count; ++i) {
+    threads.push_back(
+        std::make_unique<BenchIsolateThread>(deadline, &stats[i]));
+    CHECK(threads.back()->Start());
+  }
+
+  // Park the main thread here to prevent deadlocks in shared GCs when
+  // waiting in Join.
+  i_isolate->main_thread_local_heap()->BlockMainThreadWhileParked(
+      [&threads](const i::ParkedScope& parked) {
+        for (auto& thread : threads) thread->Join();
+      });
+  const double seconds = (base::TimeTicks::Now() - start).InSecondsF();
+
+  size_t total_ops = 0;
+  bool failed = false;
+  std::vector<double> all_pauses_ms;
+  for (const BenchIsolateStats& s : stats) {
+    total_ops += s.ops;
+    failed |= s.failed;
+    all_pauses_ms.insert(all_pauses_ms.end(), s.gc_pauses_ms.begin(),
+                         s.gc_pauses_ms.end());
+  }
+
+  printf(
+      "{\"isolates\": %d, \"seconds\": %.3f, \"ops\": %zu, "
+      "\"ops_per_second\": %.3f, \"gc_pauses\": ",
+      isolate_count, seconds, total_ops, total_ops / seconds);
+  PrintBenchGCPauses(all_pauses_ms);
+  printf(", \"per_isolate\": [");
+  for (int i = 0; i < isolate_count; ++i) {
+    const BenchIsolateStats& s = stats[i];
+    printf("%s{\"ops\": %zu, \"ops_per_second\": %.3f, \"failed\": %s",
+           i == 0 ? "" : ", ", s.ops, s.ops / seconds,
+           s.failed ? "true" : "false");
+    printf(", \"gc_pauses\": ");
+    PrintBenchGCPauses(s.gc_pauses_ms);
+    printf(
+        ", \"compile_queue\": {\"max\": %d, \"mean\": %.3f}}",
+        s.compile_queue_max,
+        s.compile_queue_samples == 0
+            ? 0.0
+            : static_cast<double>(s.compile_queue_sum) /
+                  s.compile_queue_samples);
+  }
+  printf("]}\n");
+  fflush(stdout);
+
+  if (options.no_fail) return 0;
+  return failed ? 1 : 0;
+}
+
 void Shell::CollectGarbage(Isolate* isolate) {
   if (options.send_idle_notification) {
     isolate->ContextDisposedNotification();
@@ -5973,6 +6148,8 @@ int Shell::Main(int argc, char* argv[]) {
         result = RunMain(isolate, true);
         options.compile_options.Overwrite(
             v8::ScriptCompiler::kNoCompileOptions);
+      } else if (options.bench_isolates > 0) {
+        result = RunBench(isolate);
       } else {
         bool last_run = true;
         result = RunMain(isolate, last_run);
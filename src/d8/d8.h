@@ -460,6 +460,8 @@ class ShellOptions {
   DisallowReassignment<bool> quiet_load = {"quiet-load", false};
   DisallowReassignment<bool> apply_priority = {"apply-priority", true};
   DisallowReassignment<int> thread_pool_size = {"thread-pool-size", 0};
+  DisallowReassignment<int> bench_isolates = {"bench-isolates", 0};
+  DisallowReassignment<int> bench_seconds = {"bench-seconds", 10};
   DisallowReassignment<bool> stress_delay_tasks = {"stress-delay-tasks", false};
   std::vector<const char*> arguments;
   DisallowReassignment<bool> include_arguments = {"arguments", true};
@@ -515,6 +517,9 @@ class Shell : public i::AllStatic {
                                                  const char* name);
   static MaybeLocal<Context> CreateEvaluationContext(Isolate* isolate);
   static int RunMain(Isolate* isolate, bool last_run);
+  // Runs the main source group repeatedly in --bench-isolates fresh isolates
+  // for --bench-seconds and prints per-isolate metrics as JSON.
+  static int RunBench(Isolate* isolate);
   static int Main(int argc, char* argv[]);
   static void Exit(int exit_code);
   static void OnExit(Isolate* isolate, bool dispose);
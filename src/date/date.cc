@@ -45,12 +45,8 @@ void DateCache::ResetDateCache(
     stamp_ = Smi::FromInt(stamp_.value() + 1);
   }
   DCHECK(stamp_ != Smi::FromInt(kInvalidStamp));
-  for (int i = 0; i < kDSTSize; ++i) {
-    ClearSegment(&dst_[i]);
-  }
-  dst_usage_counter_ = 0;
-  before_ = &dst_[0];
-  after_ = &dst_[1];
+  dst_cache_.Reset();
+  local_offset_cache_.Reset();
   ymd_valid_ = false;
 #ifdef V8_INTL_SUPPORT
   if (!v8_flags.icu_timezone_data) {
@@ -72,13 +68,6 @@ double DateCache::TimeClip(double time) {
   return std::numeric_limits<double>::quiet_NaN();
 }
 
-void DateCache::ClearSegment(DST* segment) {
-  segment->start_sec = kMaxEpochTimeInSec;
-  segment->end_sec = -kMaxEpochTimeInSec;
-  segment->offset_ms = 0;
-  segment->last_used = 0;
-}
-
 void DateCache::YearMonthDayFromDays(int days, int* year, int* month,
                                      int* day) {
   if (ymd_valid_) {
@@ -275,128 +264,130 @@ int DateCache::GetLocalOffsetFromOS(int64_t time_ms, bool is_utc) {
   return static_cast<int>(offset);
 }
 
-void DateCache::ExtendTheAfterSegment(int time_sec, int offset_ms) {
+void DateCache::SegmentCache::Reset() {
+  for (int i = 0; i < kSize; ++i) {
+    ClearSegment(&segments_[i]);
+  }
+  usage_counter_ = 0;
+  before_ = &segments_[0];
+  after_ = &segments_[1];
+}
+
+void DateCache::SegmentCache::ClearSegment(Segment* segment) {
+  segment->start_ms = std::numeric_limits<int64_t>::max();
+  segment->end_ms = std::numeric_limits<int64_t>::min();
+  segment->offset_ms = 0;
+  segment->last_used = 0;
+}
+
+void DateCache::SegmentCache::ExtendTheAfterSegment(int64_t time_ms,
+                                                    int offset_ms) {
   if (after_->offset_ms == offset_ms &&
-      after_->start_sec - kDefaultDSTDeltaInSec <= time_sec &&
-      time_sec <= after_->end_sec) {
+      after_->start_ms - kDefaultOffsetDeltaInMs <= time_ms &&
+      time_ms <= after_->end_ms) {
     // Extend the after_ segment.
-    after_->start_sec = time_sec;
+    after_->start_ms = time_ms;
   } else {
     // The after_ segment is either invalid or starts too late.
     if (!InvalidSegment(after_)) {
       // If the after_ segment is valid, replace it with a new segment.
-      after_ = LeastRecentlyUsedDST(before_);
+      after_ = LeastRecentlyUsed(before_);
     }
-    after_->start_sec = time_sec;
-    after_->end_sec = time_sec;
+    after_->start_ms = time_ms;
+    after_->end_ms = time_ms;
     after_->offset_ms = offset_ms;
-    after_->last_used = ++dst_usage_counter_;
+    after_->last_used = ++usage_counter_;
   }
 }
 
-int DateCache::DaylightSavingsOffsetInMs(int64_t time_ms) {
-  int time_sec = (time_ms >= 0 && time_ms <= kMaxEpochTimeInMs)
-                     ? static_cast<int>(time_ms / 1000)
-                     : static_cast<int>(EquivalentTime(time_ms) / 1000);
-
+template <typename Query>
+int DateCache::SegmentCache::Get(int64_t time_ms, Query query) {
   // Invalidate cache if the usage counter is close to overflow.
-  // Note that dst_usage_counter is incremented less than ten times
+  // Note that usage_counter_ is incremented less than ten times
   // in this function.
-  if (dst_usage_counter_ >= kMaxInt - 10) {
-    dst_usage_counter_ = 0;
-    for (int i = 0; i < kDSTSize; ++i) {
-      ClearSegment(&dst_[i]);
-    }
-  }
+  if (usage_counter_ >= kMaxInt - 10) Reset();
 
   // Optimistic fast check.
-  if (before_->start_sec <= time_sec && time_sec <= before_->end_sec) {
+  if (before_->start_ms <= time_ms && time_ms <= before_->end_ms) {
     // Cache hit.
-    before_->last_used = ++dst_usage_counter_;
+    before_->last_used = ++usage_counter_;
     return before_->offset_ms;
   }
 
-  ProbeDST(time_sec);
+  Probe(time_ms);
 
-  DCHECK(InvalidSegment(before_) || before_->start_sec <= time_sec);
-  DCHECK(InvalidSegment(after_) || time_sec < after_->start_sec);
+  DCHECK(InvalidSegment(before_) || before_->start_ms <= time_ms);
+  DCHECK(InvalidSegment(after_) || time_ms < after_->start_ms);
 
   if (InvalidSegment(before_)) {
     // Cache miss.
-    before_->start_sec = time_sec;
-    before_->end_sec = time_sec;
-    before_->offset_ms = GetDaylightSavingsOffsetFromOS(time_sec);
-    before_->last_used = ++dst_usage_counter_;
+    before_->start_ms = time_ms;
+    before_->end_ms = time_ms;
+    before_->offset_ms = query(time_ms);
+    before_->last_used = ++usage_counter_;
     return before_->offset_ms;
   }
 
-  if (time_sec <= before_->end_sec) {
+  if (time_ms <= before_->end_ms) {
     // Cache hit.
-    before_->last_used = ++dst_usage_counter_;
+    before_->last_used = ++usage_counter_;
     return before_->offset_ms;
   }
 
-  if (time_sec - kDefaultDSTDeltaInSec > before_->end_sec) {
+  if (time_ms - kDefaultOffsetDeltaInMs > before_->end_ms) {
     // If the before_ segment ends too early, then just
-    // query for the offset of the time_sec
-    int offset_ms = GetDaylightSavingsOffsetFromOS(time_sec);
-    ExtendTheAfterSegment(time_sec, offset_ms);
+    // query for the offset of the time_ms
+    int offset_ms = query(time_ms);
+    ExtendTheAfterSegment(time_ms, offset_ms);
     // This swap helps the optimistic fast check in subsequent invocations.
-    DST* temp = before_;
-    before_ = after_;
-    after_ = temp;
+    std::swap(before_, after_);
     return offset_ms;
   }
 
-  // Now the time_sec is between
-  // before_->end_sec and before_->end_sec + default DST delta.
+  // Now the time_ms is between
+  // before_->end_ms and before_->end_ms + default offset delta.
   // Update the usage counter of before_ since it is going to be used.
-  before_->last_used = ++dst_usage_counter_;
+  before_->last_used = ++usage_counter_;
 
   // Check if after_ segment is invalid or starts too late.
-  // Note that start_sec of invalid segments is kMaxEpochTimeInSec.
-  int new_after_start_sec =
-      before_->end_sec < kMaxEpochTimeInSec - kDefaultDSTDeltaInSec
-          ? before_->end_sec + kDefaultDSTDeltaInSec
-          : kMaxEpochTimeInSec;
-  if (new_after_start_sec <= after_->start_sec) {
-    int new_offset_ms = GetDaylightSavingsOffsetFromOS(new_after_start_sec);
-    ExtendTheAfterSegment(new_after_start_sec, new_offset_ms);
+  // Note that start_ms of invalid segments is the largest int64_t.
+  int64_t new_after_start_ms = before_->end_ms + kDefaultOffsetDeltaInMs;
+  if (new_after_start_ms <= after_->start_ms) {
+    int new_offset_ms = query(new_after_start_ms);
+    ExtendTheAfterSegment(new_after_start_ms, new_offset_ms);
   } else {
     DCHECK(!InvalidSegment(after_));
     // Update the usage counter of after_ since it is going to be used.
-    after_->last_used = ++dst_usage_counter_;
+    after_->last_used = ++usage_counter_;
   }
 
-  // Now the time_sec is between before_->end_sec and after_->start_sec.
-  // Only one daylight savings offset change can occur in this interval.
+  // Now the time_ms is between before_->end_ms and after_->start_ms.
+  // Only one offset change can occur in this interval.
 
   if (before_->offset_ms == after_->offset_ms) {
     // Merge two segments if they have the same offset.
-    before_->end_sec = after_->end_sec;
+    before_->end_ms = after_->end_ms;
     ClearSegment(after_);
     return before_->offset_ms;
   }
 
-  // Binary search for daylight savings offset change point,
+  // Binary search for offset change point,
   // but give up if we don't find it in five iterations.
   for (int i = 4; i >= 0; --i) {
-    int delta = after_->start_sec - before_->end_sec;
-    int middle_sec = (i == 0) ? time_sec : before_->end_sec + delta / 2;
-    int offset_ms = GetDaylightSavingsOffsetFromOS(middle_sec);
+    int64_t delta = after_->start_ms - before_->end_ms;
+    int64_t middle_ms = (i == 0) ? time_ms : before_->end_ms + delta / 2;
+    int offset_ms = query(middle_ms);
     if (before_->offset_ms == offset_ms) {
-      before_->end_sec = middle_sec;
-      if (time_sec <= before_->end_sec) {
+      before_->end_ms = middle_ms;
+      if (time_ms <= before_->end_ms) {
         return offset_ms;
       }
     } else {
       DCHECK(after_->offset_ms == offset_ms);
-      after_->start_sec = middle_sec;
-      if (time_sec >= after_->start_sec) {
+      after_->start_ms = middle_ms;
+      if (time_ms >= after_->start_ms) {
         // This swap helps the optimistic fast check in subsequent invocations.
-        DST* temp = before_;
-        before_ = after_;
-        after_ = temp;
+        std::swap(before_, after_);
         return offset_ms;
       }
     }
@@ -404,19 +395,19 @@ int DateCache::DaylightSavingsOffsetInMs(int64_t time_ms) {
   return 0;
 }
 
-void DateCache::ProbeDST(int time_sec) {
-  DST* before = nullptr;
-  DST* after = nullptr;
+void DateCache::SegmentCache::Probe(int64_t time_ms) {
+  Segment* before = nullptr;
+  Segment* after = nullptr;
   DCHECK(before_ != after_);
 
-  for (int i = 0; i < kDSTSize; ++i) {
-    if (dst_[i].start_sec <= time_sec) {
-      if (before == nullptr || before->start_sec < dst_[i].start_sec) {
-        before = &dst_[i];
+  for (int i = 0; i < kSize; ++i) {
+    if (segments_[i].start_ms <= time_ms) {
+      if (before == nullptr || before->start_ms < segments_[i].start_ms) {
+        before = &segments_[i];
       }
-    } else if (time_sec < dst_[i].end_sec) {
-      if (after == nullptr || after->end_sec > dst_[i].end_sec) {
-        after = &dst_[i];
+    } else if (time_ms < segments_[i].end_ms) {
+      if (after == nullptr || after->end_ms > segments_[i].end_ms) {
+        after = &segments_[i];
       }
     }
   }
@@ -424,38 +415,68 @@ void DateCache::ProbeDST(int time_sec) {
   // If before or after segments were not found,
   // then set them to any invalid segment.
   if (before == nullptr) {
-    before = InvalidSegment(before_) ? before_ : LeastRecentlyUsedDST(after);
+    before = InvalidSegment(before_) ? before_ : LeastRecentlyUsed(after);
   }
   if (after == nullptr) {
     after = InvalidSegment(after_) && before != after_
                 ? after_
-                : LeastRecentlyUsedDST(before);
+                : LeastRecentlyUsed(before);
   }
 
   DCHECK_NOT_NULL(before);
   DCHECK_NOT_NULL(after);
   DCHECK(before != after);
-  DCHECK(InvalidSegment(before) || before->start_sec <= time_sec);
-  DCHECK(InvalidSegment(after) || time_sec < after->start_sec);
+  DCHECK(InvalidSegment(before) || before->start_ms <= time_ms);
+  DCHECK(InvalidSegment(after) || time_ms < after->start_ms);
   DCHECK(InvalidSegment(before) || InvalidSegment(after) ||
-         before->end_sec < after->start_sec);
+         before->end_ms < after->start_ms);
 
   before_ = before;
   after_ = after;
 }
 
-DateCache::DST* DateCache::LeastRecentlyUsedDST(DST* skip) {
-  DST* result = nullptr;
-  for (int i = 0; i < kDSTSize; ++i) {
-    if (&dst_[i] == skip) continue;
-    if (result == nullptr || result->last_used > dst_[i].last_used) {
-      result = &dst_[i];
+DateCache::SegmentCache::Segment* DateCache::SegmentCache::LeastRecentlyUsed(
+    Segment* skip) {
+  Segment* result = nullptr;
+  for (int i = 0; i < kSize; ++i) {
+    if (&segments_[i] == skip) continue;
+    if (result == nullptr || result->last_used > segments_[i].last_used) {
+      result = &segments_[i];
     }
   }
   ClearSegment(result);
   return result;
 }
 
+int DateCache::LocalOffsetInMs(int64_t time_ms, bool is_utc) {
+  auto query = [this](int64_t utc_ms) {
+    return GetLocalOffsetFromOS(utc_ms, true);
+  };
+  if (is_utc) return local_offset_cache_.Get(time_ms, query);
+  // Guess the UTC time from the offset at a nearby time. If the offset is
+  // known not to change around the guess, it is the only UTC time that maps
+  // to {time_ms}; otherwise the local time may be skipped or repeated by an
+  // offset change and only the OS knows how to resolve it.
+  int offset_ms = local_offset_cache_.Get(time_ms, query);
+  int64_t utc_ms = time_ms - offset_ms;
+  if (local_offset_cache_.Get(utc_ms, query) == offset_ms &&
+      local_offset_cache_.LastSegmentCovers(
+          utc_ms - kMaxLocalOffsetDistanceInMs,
+          utc_ms + kMaxLocalOffsetDistanceInMs)) {
+    return offset_ms;
+  }
+  return GetLocalOffsetFromOS(time_ms, false);
+}
+
+int DateCache::DaylightSavingsOffsetInMs(int64_t time_ms) {
+  if (time_ms < 0 || time_ms > kMaxEpochTimeInMs) {
+    time_ms = EquivalentTime(time_ms);
+  }
+  return dst_cache_.Get(time_ms, [this](int64_t ms) {
+    return GetDaylightSavingsOffsetFromOS(ms / 1000);
+  });
+}
+
 namespace {
 
 // ES6 section 20.3.1.1 Time Values and Time Range
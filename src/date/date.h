@@ -76,9 +76,7 @@ class V8_EXPORT_PRIVATE DateCache {
   }
 
   // ECMA 262 - ES#sec-local-time-zone-adjustment
-  int LocalOffsetInMs(int64_t time, bool is_utc) {
-    return GetLocalOffsetFromOS(time, is_utc);
-  }
+  int LocalOffsetInMs(int64_t time_ms, bool is_utc);
 
   const char* LocalTimezone(int64_t time_ms) {
     if (time_ms < 0 || time_ms > kMaxEpochTimeInMs) {
@@ -169,57 +167,85 @@ class V8_EXPORT_PRIVATE DateCache {
 
  private:
   // The implementation relies on the fact that no time zones have
-  // more than one daylight savings offset change per 19 days.
+  // more than one offset change per 19 days.
   // In Egypt in 2010 they decided to suspend DST during Ramadan. This
   // led to a short interval where DST is in effect from September 10 to
   // September 30.
-  static const int kDefaultDSTDeltaInSec = 19 * kSecPerDay;
-
-  // Size of the Daylight Savings Time cache.
-  static const int kDSTSize = 32;
-
-  // Daylight Savings Time segment stores a segment of time where
-  // daylight savings offset does not change.
-  struct DST {
-    int start_sec;
-    int end_sec;
-    int offset_ms;
-    int last_used;
-  };
+  static const int64_t kDefaultOffsetDeltaInMs = 19 * kMsPerDay;
+
+  // Any two local offsets differ by less than this, so all UTC times that
+  // correspond to a given local time lie within this distance of each other.
+  static const int64_t kMaxLocalOffsetDistanceInMs = 2 * kMsPerDay;
+
+  // Caches a time zone offset as a set of segments of time in which the
+  // offset does not change. Logs and similar data tend to contain times from
+  // a few years, which need a couple of segments per year each.
+  class SegmentCache {
+   public:
+    SegmentCache() { Reset(); }
+
+    void Reset();
+
+    // Returns the offset at the given time, computing it with
+    // {query(time_ms)} if the cache cannot answer the request.
+    template <typename Query>
+    int Get(int64_t time_ms, Query query);
+
+    // Returns true if the segment used by the last call of {Get} is known to
+    // have the same offset from {start_ms} to {end_ms}.
+    bool LastSegmentCovers(int64_t start_ms, int64_t end_ms) const {
+      return before_->start_ms <= start_ms && end_ms <= before_->end_ms;
+    }
 
-  // Computes the daylight savings offset for the given time.
-  // ECMA 262 - 15.9.1.8
-  int DaylightSavingsOffsetInMs(int64_t time_ms);
+   private:
+    static const int kSize = 128;
 
-  // Sets the before_ and the after_ segments from the DST cache such that
-  // the before_ segment starts earlier than the given time and
-  // the after_ segment start later than the given time.
-  // Both segments might be invalid.
-  // The last_used counters of the before_ and after_ are updated.
-  void ProbeDST(int time_sec);
+    struct Segment {
+      int64_t start_ms;
+      int64_t end_ms;
+      int offset_ms;
+      int last_used;
+    };
 
-  // Finds the least recently used segment from the DST cache that is not
-  // equal to the given 'skip' segment.
-  DST* LeastRecentlyUsedDST(DST* skip);
+    // Sets the before_ and the after_ segments from the cache such that
+    // the before_ segment starts earlier than the given time and
+    // the after_ segment start later than the given time.
+    // Both segments might be invalid.
+    // The last_used counters of the before_ and after_ are updated.
+    void Probe(int64_t time_ms);
 
-  // Extends the after_ segment with the given point or resets it
-  // if it starts later than the given time + kDefaultDSTDeltaInSec.
-  inline void ExtendTheAfterSegment(int time_sec, int offset_ms);
+    // Finds the least recently used segment from the cache that is not
+    // equal to the given 'skip' segment.
+    Segment* LeastRecentlyUsed(Segment* skip);
 
-  // Makes the given segment invalid.
-  inline void ClearSegment(DST* segment);
+    // Extends the after_ segment with the given point or resets it
+    // if it starts later than the given time + kDefaultOffsetDeltaInMs.
+    inline void ExtendTheAfterSegment(int64_t time_ms, int offset_ms);
 
-  bool InvalidSegment(DST* segment) {
-    return segment->start_sec > segment->end_sec;
-  }
+    // Makes the given segment invalid.
+    inline void ClearSegment(Segment* segment);
+
+    bool InvalidSegment(Segment* segment) {
+      return segment->start_ms > segment->end_ms;
+    }
+
+    Segment segments_[kSize];
+    int usage_counter_;
+    Segment* before_;
+    Segment* after_;
+  };
+
+  // Computes the daylight savings offset for the given time.
+  // ECMA 262 - 15.9.1.8
+  int DaylightSavingsOffsetInMs(int64_t time_ms);
 
   Tagged<Smi> stamp_;
 
-  // Daylight Saving Time cache.
-  DST dst_[kDSTSize];
-  int dst_usage_counter_;
-  DST* before_;
-  DST* after_;
+  // Daylight Saving Time cache, used for timezone names and when ICU
+  // timezone data is not used.
+  SegmentCache dst_cache_;
+  // Cache of the complete local offset of UTC times.
+  SegmentCache local_offset_cache_;
 
   int local_offset_ms_;
 
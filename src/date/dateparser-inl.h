@@ -14,6 +14,8 @@ namespace internal {
 
 template <typename Char>
 bool DateParser::Parse(Isolate* isolate, base::Vector<Char> str, double* out) {
+  if (ParseISODateTimeFast(str, out)) return true;
+
   InputReader<Char> in(str);
   DateStringTokenizer<Char> scanner(&in);
   TimeZoneComposer tz;
@@ -233,6 +235,100 @@ bool DateParser::InputReader<Char>::SkipParentheses() {
   return true;
 }
 
+template <typename Char>
+bool DateParser::ParseISODateTimeFast(base::Vector<Char> str, double* out) {
+  const Char* s = str.begin();
+  const int length = str.length();
+  int year;
+  int month = 1;
+  int day = 1;
+  if (length < 4 || !ReadFixedDigits(s, 4, &year)) return false;
+  int pos = 4;
+  if (pos < length && s[pos] == '-') {
+    if (length < pos + 3 || !ReadFixedDigits(s + pos + 1, 2, &month) ||
+        !DayComposer::IsMonth(month)) {
+      return false;
+    }
+    pos += 3;
+    if (pos < length && s[pos] == '-') {
+      if (length < pos + 3 || !ReadFixedDigits(s + pos + 1, 2, &day) ||
+          !DayComposer::IsDay(day)) {
+        return false;
+      }
+      pos += 3;
+    }
+  }
+  out[YEAR] = year;
+  out[MONTH] = month - 1;  // 0-based
+  out[DAY] = day;
+  if (pos == length) {
+    // Date-only forms are UTC.
+    out[HOUR] = out[MINUTE] = out[SECOND] = out[MILLISECOND] = 0;
+    out[UTC_OFFSET] = 0;
+    return true;
+  }
+
+  if (s[pos] != 'T' && s[pos] != 't') return false;
+  int hour;
+  int minute;
+  int second = 0;
+  int millisecond = 0;
+  if (length < pos + 6 || !ReadFixedDigits(s + pos + 1, 2, &hour) ||
+      s[pos + 3] != ':' || !ReadFixedDigits(s + pos + 4, 2, &minute)) {
+    return false;
+  }
+  pos += 6;
+  if (pos < length && s[pos] == ':') {
+    if (length < pos + 3 || !ReadFixedDigits(s + pos + 1, 2, &second)) {
+      return false;
+    }
+    pos += 3;
+    if (pos < length && s[pos] == '.') {
+      // Other numbers of fractional digits are handled by the general parser.
+      if (length < pos + 4 || !ReadFixedDigits(s + pos + 1, 3, &millisecond) ||
+          (pos + 4 < length && IsDecimalDigit(s[pos + 4]))) {
+        return false;
+      }
+      pos += 4;
+    }
+  }
+  if (!TimeComposer::IsMinute(minute) || !TimeComposer::IsSecond(second)) {
+    return false;
+  }
+  // Allow 24:00:00.000, but no other time starting with 24.
+  if (!TimeComposer::IsHour(hour) &&
+      (hour != 24 || minute != 0 || second != 0 || millisecond != 0)) {
+    return false;
+  }
+  out[HOUR] = hour;
+  out[MINUTE] = minute;
+  out[SECOND] = second;
+  out[MILLISECOND] = millisecond;
+
+  if (pos == length) {
+    // Date-time forms without an offset are local time.
+    out[UTC_OFFSET] = std::numeric_limits<double>::quiet_NaN();
+    return true;
+  }
+  if (s[pos] == 'Z' || s[pos] == 'z') {
+    if (pos + 1 != length) return false;
+    out[UTC_OFFSET] = 0;
+    return true;
+  }
+  if (s[pos] != '+' && s[pos] != '-') return false;
+  int offset_hour;
+  int offset_minute;
+  if (length != pos + 6 || !ReadFixedDigits(s + pos + 1, 2, &offset_hour) ||
+      s[pos + 3] != ':' || !ReadFixedDigits(s + pos + 4, 2, &offset_minute) ||
+      !TimeComposer::IsHour(offset_hour) ||
+      !TimeComposer::IsMinute(offset_minute)) {
+    return false;
+  }
+  int offset = offset_hour * 3600 + offset_minute * 60;
+  out[UTC_OFFSET] = s[pos] == '-' ? -offset : offset;
+  return true;
+}
+
 template <typename Char>
 DateParser::DateToken DateParser::ParseES5DateTime(
     DateStringTokenizer<Char>* scanner, DayComposer* day, TimeComposer* time,
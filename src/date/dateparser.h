@@ -351,6 +351,26 @@ class DateParser : public AllStatic {
     bool is_iso_date_;
   };
 
+  // Reads exactly {count} decimal digits starting at {s}.
+  template <typename Char>
+  static bool ReadFixedDigits(const Char* s, int count, int* value) {
+    int n = 0;
+    for (int i = 0; i < count; i++) {
+      if (!IsDecimalDigit(s[i])) return false;
+      n = n * 10 + s[i] - '0';
+    }
+    *value = n;
+    return true;
+  }
+
+  // Parses the fixed-width form of the ES5 Date Time String that is used by
+  // Date.prototype.toISOString and most serialization formats,
+  //   yyyy[-MM[-DD]][THH:mm[:ss[.sss]][Z|(+|-)hh:mm]],
+  // directly into {out}. Returns false for any other string, including
+  // invalid ones, which are then left to the tokenizing parser.
+  template <typename Char>
+  static bool ParseISODateTimeFast(base::Vector<Char> str, double* out);
+
   // Tries to parse an ES5 Date Time String. Returns the next token
   // to continue with in the legacy date string parser. If parsing is
   // complete, returns DateToken::EndOfInput(). If terminally unsuccessful,
@@ -321,6 +321,7 @@ bool DebugEvaluate::IsSideEffectFreeIntrinsic(Runtime::FunctionId id) {
   V(GetPrivateMember)                    \
   V(GetProperty)                         \
   /* Arrays */                           \
+  V(ArraySortWithNumericComparator)      \
   V(ArraySpeciesConstructor)             \
   V(HasFastPackedElements)               \
   V(NewArray)                            \
@@ -377,6 +378,7 @@ bool DebugEvaluate::IsSideEffectFreeIntrinsic(Runtime::FunctionId id) {
   V(StringAdd)                           \
   V(StringCharCodeAt)                    \
   V(StringEqual)                         \
+  V(StringIndexOfUnchecked)              \
   V(StringParseFloat)                    \
   V(StringParseInt)                      \
   V(SymbolDescriptiveString)             \
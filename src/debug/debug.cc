@@ -1743,9 +1743,11 @@ void Debug::PrepareFunctionForDebugExecution(
   // Have to discard baseline code before installing debug bytecode, since the
   // bytecode array field on the baseline code object is immutable.
   if (debug_info->CanBreakAtEntry()) {
-    // Deopt everything in case the function is inlined anywhere.
+    // Deopt everything in case the function is inlined anywhere. Baseline
+    // code never inlines or lowers calls, so callers compiled by Sparkplug
+    // reach the debug break trampoline without being discarded.
     Deoptimizer::DeoptimizeAll(isolate_);
-    DiscardAllBaselineCode();
+    if (shared->HasBaselineCode()) DiscardBaselineCode(*shared);
   } else {
     DeoptimizeFunction(shared);
   }
@@ -15,6 +15,7 @@
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate.h"
 #include "src/execution/pointer-authentication.h"
+#include "src/execution/shared-tiering-decisions.h"
 #include "src/execution/v8threads.h"
 #include "src/handles/handles-inl.h"
 #include "src/heap/heap-inl.h"
@@ -438,6 +439,8 @@ void Deoptimizer::DeoptimizeFunction(Tagged<JSFunction> function,
   if (v8_flags.profile_guided_optimization) {
     function->shared()->set_cached_tiering_decision(
         CachedTieringDecision::kNormal);
+    SharedTieringDecisions::Record(function->shared(),
+                                   CachedTieringDecision::kNormal);
   }
   function->ResetIfCodeFlushed(isolate);
   if (code.is_null()) code = function->code(isolate);
@@ -808,8 +811,9 @@ void Deoptimizer::DoComputeOutputFrames() {
 
   FILE* trace_file =
       verbose_tracing_enabled() ? trace_scope()->file() : nullptr;
-  DeoptimizationFrameTranslation::Iterator state_iterator(translations,
-                                                          translation_index);
+  DeoptimizationFrameTranslation::Iterator state_iterator(
+      translations, translation_index,
+      isolate()->uncompressed_frame_translation_cache());
   translated_state_.Init(
       isolate_, input_->GetFramePointerAddress(), stack_fp_, &state_iterator,
       input_data->LiteralArray(), input_->GetRegisterValues(), trace_file,
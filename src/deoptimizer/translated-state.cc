@@ -1618,7 +1618,8 @@ TranslatedState::TranslatedState(const JavaScriptFrame* frame)
           &deopt_index);
   DCHECK(!data.is_null() && deopt_index != SafepointEntry::kNoDeoptIndex);
   DeoptimizationFrameTranslation::Iterator it(
-      data->FrameTranslation(), data->TranslationIndex(deopt_index).value());
+      data->FrameTranslation(), data->TranslationIndex(deopt_index).value(),
+      frame->isolate()->uncompressed_frame_translation_cache());
   int actual_argc = frame->GetActualArgumentCount();
   Init(frame->isolate(), frame->fp(), frame->fp(), &it, data->LiteralArray(),
        nullptr /* registers */, nullptr /* trace file */,
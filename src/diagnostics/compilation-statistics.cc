@@ -71,6 +71,7 @@ std::string CompilationStatistics::BasicStats::AsJSON() {
   std::stringstream stream;
   stream << DICT(
     MEMBER("function_name") << QUOTE(function_name_) << ","
+    MEMBER("duration_us") << delta_.InMicroseconds() << ","
     MEMBER("total_allocated_bytes") << total_allocated_bytes_ << ","
     MEMBER("max_allocated_bytes") << max_allocated_bytes_ << ","
     MEMBER("absolute_max_allocated_bytes") << absolute_max_allocated_bytes_);
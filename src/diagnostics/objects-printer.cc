@@ -2704,6 +2704,7 @@ void JSCollator::JSCollatorPrint(std::ostream& os) {
   JSObjectPrintHeader(os, *this, "JSCollator");
   os << "\n - icu collator: " << Brief(icu_collator());
   os << "\n - bound compare: " << Brief(bound_compare());
+  os << "\n - allows fast comparison: " << allows_fast_comparison();
   JSObjectPrintBody(os, *this);
 }
 
@@ -333,7 +333,9 @@ SourcePositionInfo GetSourcePositionInfo(Isolate* isolate, Tagged<Code> code,
                                          Handle<SharedFunctionInfo> function,
                                          SourcePosition pos) {
   DisallowGarbageCollection disallow;
-  if (code->is_turbofanned()) {
+  // Optimized code (Maglev and Turbofan) can contain inlined functions, whose
+  // positions are relative to the inlined function's script.
+  if (code->is_optimized_code()) {
     return pos.FirstInfo(isolate, code);
   } else {
     return SourcePositionInfo(isolate, pos, function);
@@ -362,6 +364,8 @@ void LinuxPerfJitLogger::LogWriteDebugInfo(Tagged<Code> code,
   Tagged<Object> last_script = Smi::zero();
   size_t last_script_name_size = 0;
   std::vector<base::Vector<const char>> script_names;
+  // Keeps flattened script names alive until they have been written.
+  std::vector<std::unique_ptr<char[]>> script_name_storage;
   for (SourcePositionTableIterator iterator(source_position_table);
        !iterator.done(); iterator.Advance()) {
     SourcePositionInfo info(GetSourcePositionInfo(isolate_, code, shared,
@@ -369,8 +373,9 @@ void LinuxPerfJitLogger::LogWriteDebugInfo(Tagged<Code> code,
     Tagged<Object> current_script = *info.script;
     if (current_script != last_script) {
       std::unique_ptr<char[]> name_storage;
-      auto name = GetScriptName(raw_shared->script(), &name_storage, no_gc);
+      auto name = GetScriptName(current_script, &name_storage, no_gc);
       script_names.push_back(name);
+      if (name_storage) script_name_storage.push_back(std::move(name_storage));
       // Add the size of the name after each entry.
       last_script_name_size = name.size() + sizeof(kStringTerminator);
       size += last_script_name_size;
@@ -412,14 +417,14 @@ void LinuxPerfJitLogger::LogWriteDebugInfo(Tagged<Code> code,
     entry.column_ = info.column + 1;
     LogWriteBytes(reinterpret_cast<const char*>(&entry), sizeof(entry));
     Tagged<Object> current_script = *info.script;
-    auto name_string = script_names[script_names_index];
-    LogWriteBytes(name_string.begin(),
-                  static_cast<uint32_t>(name_string.size()));
-    LogWriteBytes(kStringTerminator, sizeof(kStringTerminator));
     if (current_script != last_script) {
       if (last_script != Smi::zero()) script_names_index++;
       last_script = current_script;
     }
+    auto name_string = script_names[script_names_index];
+    LogWriteBytes(name_string.begin(),
+                  static_cast<uint32_t>(name_string.size()));
+    LogWriteBytes(kStringTerminator, sizeof(kStringTerminator));
   }
   char padding_bytes[8] = {0};
   LogWriteBytes(padding_bytes, padding);
@@ -907,6 +907,11 @@ int DisassemblerX64::AVXInstruction(uint8_t* data) {
         AppendToBuffer("vbroadcastsd %s,", NameOfAVXRegister(regop));
         current += PrintRightXMMOperand(current);
         break;
+      case 0x50:
+        AppendToBuffer("vpdpbusd %s,%s,", NameOfAVXRegister(regop),
+                       NameOfAVXRegister(vvvv));
+        current += PrintRightAVXOperand(current);
+        break;
       case 0xF7:
         AppendToBuffer("shlx%c %s,", operand_size_code(),
                        NameOfCPURegister(regop));
@@ -34,17 +34,30 @@ class InnerPointerToCodeCache final {
   InnerPointerToCodeCache(const InnerPointerToCodeCache&) = delete;
   InnerPointerToCodeCache& operator=(const InnerPointerToCodeCache&) = delete;
 
-  void Flush() { memset(static_cast<void*>(&cache_[0]), 0, sizeof(cache_)); }
+  void Flush() {
+    memset(static_cast<void*>(&cache_[0]), 0, sizeof(cache_));
+    memset(&most_recently_used_way_[0], 0, sizeof(most_recently_used_way_));
+  }
 
   InnerPointerToCodeCacheEntry* GetCacheEntry(Address inner_pointer);
 
  private:
-  InnerPointerToCodeCacheEntry* cache(int index) { return &cache_[index]; }
+  InnerPointerToCodeCacheEntry* cache(int set, int way) {
+    return &cache_[set * kInnerPointerToCodeCacheWays + way];
+  }
 
   Isolate* const isolate_;
 
-  static const int kInnerPointerToCodeCacheSize = 1024;
+  // The cache is two-way set associative, so that two hot return addresses
+  // hashing to the same set (common in deep, recursive stacks) do not keep
+  // evicting each other.
+  static const int kInnerPointerToCodeCacheWays = 2;
+  static const int kInnerPointerToCodeCacheSets = 1024;
+  static const int kInnerPointerToCodeCacheSize =
+      kInnerPointerToCodeCacheWays * kInnerPointerToCodeCacheSets;
   InnerPointerToCodeCacheEntry cache_[kInnerPointerToCodeCacheSize];
+  // The way to keep on the next miss in each set.
+  uint8_t most_recently_used_way_[kInnerPointerToCodeCacheSets];
 };
 
 inline Address StackHandler::address() const {
@@ -1880,7 +1880,8 @@ BytecodeOffset MaglevFrame::GetBytecodeOffsetForOSR() const {
   }
 
   DeoptimizationFrameTranslation::Iterator it(
-      data->FrameTranslation(), data->TranslationIndex(deopt_index).value());
+      data->FrameTranslation(), data->TranslationIndex(deopt_index).value(),
+      isolate()->uncompressed_frame_translation_cache());
   // Search the innermost interpreter frame and get its bailout id. The
   // translation stores frames bottom up.
   int js_frames = it.EnterBeginOpcode().js_frame_count;
@@ -2824,7 +2825,8 @@ void OptimizedFrame::GetFunctions(
   Tagged<DeoptimizationLiteralArray> const literal_array = data->LiteralArray();
 
   DeoptimizationFrameTranslation::Iterator it(
-      data->FrameTranslation(), data->TranslationIndex(deopt_index).value());
+      data->FrameTranslation(), data->TranslationIndex(deopt_index).value(),
+      isolate()->uncompressed_frame_translation_cache());
   int jsframe_count = it.EnterBeginOpcode().js_frame_count;
 
   // We insert the frames in reverse order because the frames
@@ -3468,12 +3470,21 @@ uint32_t PcAddressForHashing(Isolate* isolate, Address address) {
 
 InnerPointerToCodeCache::InnerPointerToCodeCacheEntry*
 InnerPointerToCodeCache::GetCacheEntry(Address inner_pointer) {
-  DCHECK(base::bits::IsPowerOfTwo(kInnerPointerToCodeCacheSize));
+  DCHECK(base::bits::IsPowerOfTwo(kInnerPointerToCodeCacheSets));
   uint32_t hash =
       ComputeUnseededHash(PcAddressForHashing(isolate_, inner_pointer));
-  uint32_t index = hash & (kInnerPointerToCodeCacheSize - 1);
-  InnerPointerToCodeCacheEntry* entry = cache(index);
-  if (entry->inner_pointer == inner_pointer) {
+  int set = static_cast<int>(hash & (kInnerPointerToCodeCacheSets - 1));
+  int way = 0;
+  for (; way < kInnerPointerToCodeCacheWays; ++way) {
+    if (cache(set, way)->inner_pointer == inner_pointer) break;
+  }
+  bool hit = way < kInnerPointerToCodeCacheWays;
+  // On a miss, replace the entry that was not used most recently.
+  static_assert(kInnerPointerToCodeCacheWays == 2);
+  if (!hit) way = most_recently_used_way_[set] ^ 1;
+  most_recently_used_way_[set] = static_cast<uint8_t>(way);
+  InnerPointerToCodeCacheEntry* entry = cache(set, way);
+  if (hit) {
     // Why this DCHECK holds is nontrivial:
     //
     // - the cache is filled lazily on calls to this function.
@@ -3490,7 +3501,9 @@ InnerPointerToCodeCache::GetCacheEntry(Address inner_pointer) {
     // Because this code may be interrupted by a profiling signal that
     // also queries the cache, we cannot update inner_pointer before the code
     // has been set. Otherwise, we risk trying to use a cache entry before
-    // the code has been computed.
+    // the code has been computed. The old key is cleared first so that the
+    // entry is not mistaken for the evicted pointer in the meantime.
+    entry->inner_pointer = kNullAddress;
     entry->code =
         isolate_->heap()->GcSafeFindCodeForInnerPointer(inner_pointer);
     if (entry->code.value()->is_maglevved()) {
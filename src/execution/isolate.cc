@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <fstream>
@@ -15,6 +16,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include "include/v8-platform.h"
 #include "include/v8-template.h"
 #include "src/api/api-inl.h"
 #include "src/ast/ast-value-factory.h"
@@ -78,7 +80,9 @@
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/backing-store.h"
 #include "src/objects/call-site-info-inl.h"
+#include "src/objects/deoptimization-data.h"
 #include "src/objects/elements.h"
+#include "src/objects/external-string-region-table.h"
 #include "src/objects/feedback-vector.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/instance-type-inl.h"
@@ -783,24 +787,26 @@ class CallSiteBuilder {
     elements_ = isolate->factory()->NewFixedArray(std::min(64, limit));
   }
 
+  // Returns false once the stack trace is full, so that the caller can stop
+  // summarizing the remaining frames.
   bool Visit(FrameSummary const& summary) {
     if (Full()) return false;
 #if V8_ENABLE_WEBASSEMBLY
     if (summary.IsWasm()) {
       AppendWasmFrame(summary.AsWasm());
-      return true;
+      return !Full();
     }
     if (summary.IsWasmInlined()) {
       AppendWasmInlinedFrame(summary.AsWasmInlined());
-      return true;
+      return !Full();
     }
     if (summary.IsBuiltin()) {
       AppendBuiltinFrame(summary.AsBuiltin());
-      return true;
+      return !Full();
     }
 #endif  // V8_ENABLE_WEBASSEMBLY
     AppendJavaScriptFrame(summary.AsJavaScript());
-    return true;
+    return !Full();
   }
 
   void AppendAsyncFrame(Handle<JSGeneratorObject> generator_object) {
@@ -1204,6 +1210,7 @@ template <typename Visitor>
 void VisitStack(Isolate* isolate, Visitor* visitor,
                 StackTrace::StackTraceOptions options = StackTrace::kDetailed) {
   DisallowJavascriptExecution no_js(isolate);
+  std::vector<FrameSummary> summaries;
   for (StackFrameIterator it(isolate); !it.done(); it.Advance()) {
     StackFrame* frame = it.frame();
     switch (frame->type()) {
@@ -1223,7 +1230,7 @@ void VisitStack(Isolate* isolate, Visitor* visitor,
       {
         // A standard frame may include many summarized frames (due to
         // inlining).
-        std::vector<FrameSummary> summaries;
+        summaries.clear();
         CommonFrame::cast(frame)->Summarize(&summaries);
         for (auto rit = summaries.rbegin(); rit != summaries.rend(); ++rit) {
           FrameSummary& summary = *rit;
@@ -1255,12 +1262,14 @@ Handle<FixedArray> CaptureSimpleStackTrace(Isolate* isolate, int limit,
 #endif  // V8_ENABLE_WEBASSEMBLY
 
   CallSiteBuilder builder(isolate, mode, limit, caller);
-  VisitStack(isolate, &builder);
+  // Summarizing frames (especially optimized ones) is the expensive part, so
+  // don't walk the stack at all if no frames are requested.
+  if (!builder.Full()) VisitStack(isolate, &builder);
 
   // If --async-stack-traces are enabled and the "current microtask" is a
   // PromiseReactionJobTask, we try to enrich the stack trace with async
   // frames.
-  if (v8_flags.async_stack_traces) {
+  if (v8_flags.async_stack_traces && !builder.Full()) {
     CaptureAsyncStackTrace(isolate, &builder);
   }
 
@@ -1735,6 +1744,44 @@ void Isolate::InvokeApiInterruptCallbacks() {
   }
 }
 
+namespace {
+
+class ExecutionDeadlineTask final : public CancelableTask {
+ public:
+  explicit ExecutionDeadlineTask(Isolate* isolate)
+      : CancelableTask(isolate), isolate_(isolate) {}
+
+  void RunInternal() override {
+    isolate_->stack_guard()->RequestTerminateExecution();
+  }
+
+ private:
+  Isolate* const isolate_;
+};
+
+static_assert(std::is_same_v<CancelableTaskManager::Id, uint64_t>);
+
+}  // namespace
+
+void Isolate::SetExecutionDeadline(base::TimeDelta timeout) {
+  ClearExecutionDeadline();
+  auto task = std::make_unique<ExecutionDeadlineTask>(this);
+  execution_deadline_task_id_ = task->id();
+  V8::GetCurrentPlatform()->CallDelayedOnWorkerThread(std::move(task),
+                                                      timeout.InSecondsF());
+}
+
+void Isolate::ClearExecutionDeadline() {
+  if (execution_deadline_task_id_ == CancelableTaskManager::kInvalidTaskId) {
+    return;
+  }
+  // If the task has already started running, the termination request may
+  // still arrive; there's nothing to wait for since it doesn't touch anything
+  // but the stack guard.
+  cancelable_task_manager()->TryAbort(execution_deadline_task_id_);
+  execution_deadline_task_id_ = CancelableTaskManager::kInvalidTaskId;
+}
+
 void Isolate::RequestInvalidateNoProfilingProtector() {
   // This request might be triggered from arbitrary thread but protector
   // invalidation must happen on the main thread, so use Api interrupt
@@ -3914,6 +3961,10 @@ void Isolate::Deinit() {
 
   heap_.TearDown();
 
+  // Tearing down the heap released the remaining array buffers, some of which
+  // may have been pooled.
+  BackingStore::ReleasePooledMemory(array_buffer_allocator());
+
   delete inner_pointer_to_code_cache_;
   inner_pointer_to_code_cache_ = nullptr;
 
@@ -4047,6 +4098,12 @@ Isolate::~Isolate() {
   delete descriptor_lookup_cache_;
   descriptor_lookup_cache_ = nullptr;
 
+  delete dictionary_keys_cache_;
+  dictionary_keys_cache_ = nullptr;
+
+  delete uncompressed_frame_translation_cache_;
+  uncompressed_frame_translation_cache_ = nullptr;
+
   delete load_stub_cache_;
   load_stub_cache_ = nullptr;
   delete store_stub_cache_;
@@ -4204,6 +4261,20 @@ bool IsolateIsCompatibleWithEmbeddedBlob(Isolate* isolate) {
 }
 #endif  // DEBUG
 
+// Embedded blobs generated with --embedded-blob-huge-page-alignment start on
+// a huge page boundary. Ask the kernel to back their whole huge pages with
+// transparent huge pages. Kernels that don't support this for read-only file
+// mappings simply ignore the advice.
+void AdviseHugePagesForEmbeddedBlobCode(const uint8_t* code,
+                                        uint32_t code_size) {
+  if constexpr (base::OS::IsHugePagesSupported()) {
+    const Address start = reinterpret_cast<Address>(code);
+    const size_t size = RoundDown(size_t{code_size}, base::OS::kHugePageSize);
+    if (!IsAligned(start, base::OS::kHugePageSize) || size == 0) return;
+    USE(base::OS::AdviseHugePages(reinterpret_cast<void*>(start), size));
+  }
+}
+
 }  // namespace
 
 void Isolate::InitializeDefaultEmbeddedBlob() {
@@ -4227,6 +4298,9 @@ void Isolate::InitializeDefaultEmbeddedBlob() {
   if (code_size == 0) {
     CHECK_EQ(0, data_size);
   } else {
+    if (code == DefaultEmbeddedBlobCode()) {
+      AdviseHugePagesForEmbeddedBlobCode(code, code_size);
+    }
     SetEmbeddedBlob(code, code_size, data, data_size);
   }
 }
@@ -4271,6 +4345,13 @@ void Isolate::InitializeIsShortBuiltinCallsEnabled() {
     // On Android, the check is not operative to detect memory, and re-embedded
     // builtins don't have a memory cost.
     is_short_builtin_calls_enabled_ = true;
+#elif defined(V8_OS_LINUX)
+    // Re-embedded builtins are either remapped from the binary or share a
+    // single process-wide copy (see CodeRange::RemapEmbeddedBuiltins), so they
+    // don't have a per-isolate memory cost either.
+    is_short_builtin_calls_enabled_ =
+        base::OS::IsRemapSharedCopySupported() ||
+        heap_.MaxOldGenerationSize() >= kShortBuiltinCallsOldSpaceSizeThreshold;
 #else
     // Check if the system has more than 4GB of physical memory by comparing the
     // old space size with respective threshold value.
@@ -4422,6 +4503,32 @@ using MapOfLoadsAndStoresPerFunction =
              std::pair<uint64_t /* loads */, uint64_t /* stores */>>;
 MapOfLoadsAndStoresPerFunction* stack_access_count_map = nullptr;
 
+// Runs the parts of a bigint::Platform::ParallelTask, see
+// BigIntPlatform::RunInParallel.
+class BigIntParallelJob final : public JobTask {
+ public:
+  BigIntParallelJob(bigint::Platform::ParallelTask* task, int count)
+      : task_(task), count_(count) {}
+
+  void Run(JobDelegate* delegate) override {
+    do {
+      int index = next_index_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= count_) return;
+      task_->Run(index);
+    } while (!delegate->ShouldYield());
+  }
+
+  size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+    int next_index = next_index_.load(std::memory_order_relaxed);
+    return std::max(0, count_ - next_index);
+  }
+
+ private:
+  bigint::Platform::ParallelTask* const task_;
+  const int count_;
+  std::atomic<int> next_index_{0};
+};
+
 class BigIntPlatform : public bigint::Platform {
  public:
   explicit BigIntPlatform(Isolate* isolate) : isolate_(isolate) {}
@@ -4433,6 +4540,20 @@ class BigIntPlatform : public bigint::Platform {
             isolate_->stack_guard()->HasTerminationRequest());
   }
 
+  int NumberOfWorkerThreads() override {
+    if (!v8_flags.parallel_bigint_multiplication) return 0;
+    return V8::GetCurrentPlatform()->NumberOfWorkerThreads();
+  }
+
+  void RunInParallel(ParallelTask* task, int count) override {
+    // Joining lets this thread contribute, which is where interrupt requests
+    // are checked.
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking,
+                    std::make_unique<BigIntParallelJob>(task, count))
+        ->Join();
+  }
+
  private:
   Isolate* isolate_;
 };
@@ -4444,7 +4565,8 @@ VirtualMemoryCage* Isolate::GetPtrComprCodeCageForTesting() {
 
 void Isolate::VerifyStaticRoots() {
 #if V8_STATIC_ROOTS_BOOL
-  static_assert(ReadOnlyHeap::IsReadOnlySpaceShared(),
+  static_assert(V8_SHARED_RO_HEAP_BOOL &&
+                    !COMPRESS_POINTERS_IN_ISOLATE_CAGE_BOOL,
                 "Static read only roots are only supported when there is one "
                 "shared read only space per cage");
 #define STATIC_ROOTS_FAILED_MSG                                            \
@@ -4610,6 +4732,9 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
 
   compilation_cache_ = new CompilationCache(this);
   descriptor_lookup_cache_ = new DescriptorLookupCache();
+  dictionary_keys_cache_ = new DictionaryKeysCache();
+  uncompressed_frame_translation_cache_ =
+      new UncompressedFrameTranslationCache();
   global_handles_ = new GlobalHandles(this);
   eternal_handles_ = new EternalHandles();
   bootstrapper_ = new Bootstrapper(this);
@@ -5074,6 +5199,14 @@ void Isolate::Exit() {
   SetIsolateThreadLocals(previous_isolate, previous_thread_data);
 }
 
+ExternalStringRegionTable* Isolate::external_string_region_table() {
+  if (!external_string_region_table_) {
+    external_string_region_table_ =
+        std::make_unique<ExternalStringRegionTable>();
+  }
+  return external_string_region_table_.get();
+}
+
 std::unique_ptr<PersistentHandles> Isolate::NewPersistentHandles() {
   return std::make_unique<PersistentHandles>(this);
 }
@@ -6295,21 +6428,32 @@ void Isolate::ResetDefaultLocale() {
 
 icu::UMemory* Isolate::get_cached_icu_object(ICUObjectCacheType cache_type,
                                              Handle<Object> locales) {
-  const ICUObjectCacheEntry& entry =
+  std::vector<ICUObjectCacheEntry>& entries =
       icu_object_cache_[static_cast<int>(cache_type)];
-  return StringEqualsLocales(this, entry.locales, locales) ? entry.obj.get()
-                                                           : nullptr;
+  for (auto it = entries.begin(); it != entries.end(); ++it) {
+    if (StringEqualsLocales(this, it->locales, locales)) {
+      // Move the entry to the front, so that the least recently used one is
+      // evicted first.
+      std::rotate(entries.begin(), it, it + 1);
+      return entries.front().obj.get();
+    }
+  }
+  return nullptr;
 }
 
 void Isolate::set_icu_object_in_cache(ICUObjectCacheType cache_type,
                                       Handle<Object> locales,
                                       std::shared_ptr<icu::UMemory> obj) {
-  icu_object_cache_[static_cast<int>(cache_type)] = {
-      GetStringFromLocales(this, locales), std::move(obj)};
+  std::vector<ICUObjectCacheEntry>& entries =
+      icu_object_cache_[static_cast<int>(cache_type)];
+  size_t capacity = std::max(v8_flags.icu_object_cache_size.value(), 1u);
+  if (entries.size() >= capacity) entries.resize(capacity - 1);
+  entries.emplace(entries.begin(), GetStringFromLocales(this, locales),
+                  std::move(obj));
 }
 
 void Isolate::clear_cached_icu_object(ICUObjectCacheType cache_type) {
-  icu_object_cache_[static_cast<int>(cache_type)] = ICUObjectCacheEntry{};
+  icu_object_cache_[static_cast<int>(cache_type)].clear();
 }
 
 void Isolate::clear_cached_icu_objects() {
@@ -121,8 +121,10 @@ class Counters;
 class Debug;
 class Deoptimizer;
 class DescriptorLookupCache;
+class DictionaryKeysCache;
 class EmbeddedFileWriterInterface;
 class EternalHandles;
+class ExternalStringRegionTable;
 class GlobalHandles;
 class GlobalSafepoint;
 class HandleScopeImplementer;
@@ -154,6 +156,7 @@ class ThreadState;
 class ThreadVisitor;  // Defined in v8threads.h
 class TieringManager;
 class TracingCpuProfilerImpl;
+class UncompressedFrameTranslationCache;
 class UnicodeCache;
 struct ManagedPtrDestructor;
 
@@ -764,6 +767,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
                : shared_space_isolate()->string_forwarding_table_.get();
   }
 
+  // The table of regions backing external strings created through
+  // v8::String::NewExternalOneByte/TwoByte(region, ...). Created on first use.
+  ExternalStringRegionTable* external_string_region_table();
+
   SharedStructTypeRegistry* shared_struct_type_registry() const {
     return is_shared_space_isolate()
                ? shared_struct_type_registry_.get()
@@ -1091,6 +1098,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   void RequestInterrupt(InterruptCallback callback, void* data);
   void InvokeApiInterruptCallbacks();
 
+  // Terminates execution once {timeout} has passed, replacing any previous
+  // deadline. The deadline is enforced by a delayed worker thread task.
+  void SetExecutionDeadline(base::TimeDelta timeout);
+  void ClearExecutionDeadline();
+
   void RequestInvalidateNoProfilingProtector();
 
   // Administration
@@ -1325,6 +1337,15 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return descriptor_lookup_cache_;
   }
 
+  DictionaryKeysCache* dictionary_keys_cache() const {
+    return dictionary_keys_cache_;
+  }
+
+  UncompressedFrameTranslationCache* uncompressed_frame_translation_cache()
+      const {
+    return uncompressed_frame_translation_cache_;
+  }
+
   V8_INLINE HandleScopeData* handle_scope_data() {
     return &isolate_data_.handle_scope_data_;
   }
@@ -2148,6 +2169,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 #ifdef V8_ENABLE_WEBASSEMBLY
   bool IsOnCentralStack();
   wasm::StackMemory*& wasm_stacks() { return wasm_stacks_; }
+  wasm::StackPool& stack_pool() { return stack_pool_; }
   // Update the thread local's Stack object so that it is aware of the new stack
   // start and the inactive stacks.
   void UpdateCentralStackInfo();
@@ -2355,6 +2377,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   // These are guaranteed empty when !OwnsStringTables().
   std::unique_ptr<StringTable> string_table_;
   std::unique_ptr<StringForwardingTable> string_forwarding_table_;
+  std::unique_ptr<ExternalStringRegionTable> external_string_region_table_;
 
   const int id_;
   std::atomic<EntryStackItem*> entry_stack_ = nullptr;
@@ -2384,6 +2407,9 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   StackTrace::StackTraceOptions stack_trace_for_uncaught_exceptions_options_ =
       StackTrace::kOverview;
   DescriptorLookupCache* descriptor_lookup_cache_ = nullptr;
+  DictionaryKeysCache* dictionary_keys_cache_ = nullptr;
+  UncompressedFrameTranslationCache* uncompressed_frame_translation_cache_ =
+      nullptr;
   HandleScopeImplementer* handle_scope_implementer_ = nullptr;
   UnicodeCache* unicode_cache_ = nullptr;
   AccountingAllocator* allocator_ = nullptr;
@@ -2444,8 +2470,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 #ifdef V8_INTL_SUPPORT
   std::string default_locale_;
 
-  // The cache stores the most recently accessed {locales,obj} pair for each
-  // cache type.
+  // The cache stores the --icu-object-cache-size most recently accessed
+  // {locales,obj} pairs for each cache type, most recently used first.
   struct ICUObjectCacheEntry {
     std::string locales;
     std::shared_ptr<icu::UMemory> obj;
@@ -2455,7 +2481,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
         : locales(locales), obj(std::move(obj)) {}
   };
 
-  ICUObjectCacheEntry icu_object_cache_[kICUObjectCacheTypeCount];
+  std::vector<ICUObjectCacheEntry> icu_object_cache_[kICUObjectCacheTypeCount];
 #endif  // V8_INTL_SUPPORT
 
   // Whether the isolate has been created for snapshotting.
@@ -2521,6 +2547,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   using InterruptEntry = std::pair<InterruptCallback, void*>;
   std::queue<InterruptEntry> api_interrupts_queue_;
 
+  // The CancelableTaskManager::Id of the pending execution deadline task, if
+  // any.
+  uint64_t execution_deadline_task_id_ = 0;
+
 #define GLOBAL_BACKING_STORE(type, name, initialvalue) type name##_;
   ISOLATE_INIT_LIST(GLOBAL_BACKING_STORE)
 #undef GLOBAL_BACKING_STORE
@@ -2699,6 +2729,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 #ifdef V8_ENABLE_WEBASSEMBLY
   wasm::WasmCodeLookupCache* wasm_code_look_up_cache_ = nullptr;
   wasm::StackMemory* wasm_stacks_;
+  wasm::StackPool stack_pool_;
 #endif
 
   // Enables the host application to provide a mechanism for recording a
@@ -90,6 +90,9 @@ class V8_EXPORT_PRIVATE LocalIsolate final : private HiddenLocalFactory {
   bool is_precise_binary_code_coverage() const {
     return isolate_->is_precise_binary_code_coverage();
   }
+  bool is_block_binary_code_coverage() const {
+    return isolate_->is_block_binary_code_coverage();
+  }
 
   v8::internal::LocalFactory* factory() {
     // Upcast to the privately inherited base-class using c-style casts to avoid
@@ -28,6 +28,8 @@ const size_t MicrotaskQueue::kSizeOffset = OFFSET_OF(MicrotaskQueue, size_);
 const size_t MicrotaskQueue::kStartOffset = OFFSET_OF(MicrotaskQueue, start_);
 const size_t MicrotaskQueue::kFinishedMicrotaskCountOffset =
     OFFSET_OF(MicrotaskQueue, finished_microtask_count_);
+const size_t MicrotaskQueue::kSizeHighWaterMarkOffset =
+    OFFSET_OF(MicrotaskQueue, size_high_water_mark_);
 
 const intptr_t MicrotaskQueue::kMinimumCapacity = 8;
 
@@ -109,6 +111,7 @@ void MicrotaskQueue::EnqueueMicrotask(Tagged<Microtask> microtask) {
   DCHECK_LT(size_, capacity_);
   ring_buffer_[(start_ + size_) % capacity_] = microtask.ptr();
   ++size_;
+  size_high_water_mark_ = std::max(size_high_water_mark_, size_);
 }
 
 void MicrotaskQueue::PerformCheckpointInternal(v8::Isolate* v8_isolate) {
@@ -177,8 +180,9 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
       processed_microtask_count =
           static_cast<int>(finished_microtask_count_ - base_count);
     }
-    TRACE_EVENT_END1("v8.execute", "RunMicrotasks", "microtask_count",
-                     processed_microtask_count);
+    TRACE_EVENT_END2("v8.execute", "RunMicrotasks", "microtask_count",
+                     processed_microtask_count, "size_high_water_mark",
+                     size_high_water_mark_);
   }
 
   if (isolate->is_execution_terminating()) {
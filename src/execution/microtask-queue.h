@@ -102,6 +102,13 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   intptr_t size() const { return size_; }
   intptr_t start() const { return start_; }
 
+  // The number of microtasks run by this queue so far, and the largest number
+  // of microtasks that were pending in it at once.
+  intptr_t finished_microtask_count() const {
+    return finished_microtask_count_;
+  }
+  intptr_t size_high_water_mark() const { return size_high_water_mark_; }
+
   Tagged<Microtask> get(intptr_t index) const;
 
   MicrotaskQueue* next() const { return next_; }
@@ -112,6 +119,7 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   static const size_t kSizeOffset;
   static const size_t kStartOffset;
   static const size_t kFinishedMicrotaskCountOffset;
+  static const size_t kSizeHighWaterMarkOffset;
 
   static const intptr_t kMinimumCapacity;
 
@@ -134,6 +142,9 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   // The number of finished microtask.
   intptr_t finished_microtask_count_ = 0;
 
+  // The maximum value |size_| has reached.
+  intptr_t size_high_water_mark_ = 0;
+
   // MicrotaskQueue instances form a doubly linked list loop, so that all
   // instances are reachable through |next_|.
   MicrotaskQueue* next_ = nullptr;
@@ -0,0 +1,205 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/shared-tiering-decisions.h"
+
+#include <cinttypes>
+#include <cstring>
+#include <unordered_map>
+
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
+#include "src/flags/flags.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/objects/string-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+struct FunctionKey {
+  int start_position;
+  int length;
+  size_t source_hash;
+
+  bool operator==(const FunctionKey& other) const {
+    return start_position == other.start_position && length == other.length &&
+           source_hash == other.source_hash;
+  }
+};
+
+struct FunctionKeyHash {
+  size_t operator()(const FunctionKey& key) const {
+    return base::hash_combine(key.start_position, key.length, key.source_hash);
+  }
+};
+
+// Computes a key from the source text of |shared|, which is the same in every
+// isolate that compiles the same script.
+bool ComputeKey(Tagged<SharedFunctionInfo> shared, FunctionKey* key) {
+  DisallowGarbageCollection no_gc;
+  if (!shared->HasSourceCode()) return false;
+  Tagged<Object> source = Script::cast(shared->script())->source();
+  if (!IsString(source)) return false;
+  Tagged<String> source_string = String::cast(source);
+  if (!source_string->IsFlat()) return false;
+  const int start = shared->StartPosition();
+  const int length = shared->EndPosition() - start;
+  if (start < 0 || length <= 0 || start + length > source_string->length()) {
+    return false;
+  }
+  String::FlatContent content = source_string->GetFlatContent(no_gc);
+  size_t hash;
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars =
+        content.ToOneByteVector().SubVector(start, start + length);
+    hash = base::hash_range(chars.begin(), chars.end());
+  } else {
+    base::Vector<const base::uc16> chars =
+        content.ToUC16Vector().SubVector(start, start + length);
+    hash = base::hash_range(chars.begin(), chars.end());
+  }
+  *key = {start, length, hash};
+  return true;
+}
+
+constexpr const char kFileHeader[] = "v8-tiering-decisions 1";
+
+class DecisionTable final {
+ public:
+  // Bounds the memory used by the table; further decisions are dropped.
+  static constexpr size_t kMaxEntries = 64 * 1024;
+
+  DecisionTable() {
+    if (v8_flags.tiering_decisions_file) {
+      LoadFromFile(v8_flags.tiering_decisions_file);
+    }
+  }
+
+  void Record(const FunctionKey& key, CachedTieringDecision decision) {
+    base::MutexGuard guard(&mutex_);
+    if (decision == CachedTieringDecision::kEarlyMaglev ||
+        decision == CachedTieringDecision::kEarlyTurbofan) {
+      auto it = decisions_.find(key);
+      if (it != decisions_.end()) {
+        it->second = decision;
+      } else if (decisions_.size() < kMaxEntries) {
+        decisions_.emplace(key, decision);
+      }
+    } else {
+      decisions_.erase(key);
+    }
+  }
+
+  bool Lookup(const FunctionKey& key, CachedTieringDecision* decision) {
+    base::MutexGuard guard(&mutex_);
+    auto it = decisions_.find(key);
+    if (it == decisions_.end()) return false;
+    *decision = it->second;
+    return true;
+  }
+
+  void Clear() {
+    base::MutexGuard guard(&mutex_);
+    decisions_.clear();
+  }
+
+  // The file has a header line followed by one line per entry. It only holds
+  // hints, so unreadable or stale files are ignored.
+  void LoadFromFile(const char* filename) {
+    FILE* file = base::OS::FOpen(filename, "r");
+    if (file == nullptr) return;
+    char header[sizeof(kFileHeader)] = {};
+    if (fgets(header, sizeof(header), file) != nullptr &&
+        strcmp(header, kFileHeader) == 0) {
+      base::MutexGuard guard(&mutex_);
+      int start, length, decision;
+      uint64_t hash;
+      while (decisions_.size() < kMaxEntries &&
+             fscanf(file, "%d %d %" SCNx64 " %d", &start, &length, &hash,
+                    &decision) == 4) {
+        if (decision != static_cast<int>(CachedTieringDecision::kEarlyMaglev) &&
+            decision !=
+                static_cast<int>(CachedTieringDecision::kEarlyTurbofan)) {
+          continue;
+        }
+        decisions_.emplace(
+            FunctionKey{start, length, static_cast<size_t>(hash)},
+            static_cast<CachedTieringDecision>(decision));
+      }
+    }
+    base::Fclose(file);
+  }
+
+  void StoreToFile(const char* filename) {
+    FILE* file = base::OS::FOpen(filename, "w");
+    if (file == nullptr) return;
+    base::MutexGuard guard(&mutex_);
+    fprintf(file, "%s\n", kFileHeader);
+    for (const auto& [key, decision] : decisions_) {
+      fprintf(file, "%d %d %" PRIx64 " %d\n", key.start_position, key.length,
+              static_cast<uint64_t>(key.source_hash),
+              static_cast<int>(decision));
+    }
+    base::Fclose(file);
+  }
+
+ private:
+  base::Mutex mutex_;
+  std::unordered_map<FunctionKey, CachedTieringDecision, FunctionKeyHash>
+      decisions_;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(DecisionTable, GetDecisionTable)
+
+}  // namespace
+
+// static
+void SharedTieringDecisions::Record(Tagged<SharedFunctionInfo> shared,
+                                    CachedTieringDecision decision) {
+  if (!v8_flags.shared_tiering_decisions) return;
+  FunctionKey key;
+  if (!ComputeKey(shared, &key)) return;
+  GetDecisionTable()->Record(key, decision);
+}
+
+// static
+bool SharedTieringDecisions::Apply(Tagged<SharedFunctionInfo> shared) {
+  if (!v8_flags.shared_tiering_decisions) return false;
+  if (shared->cached_tiering_decision() != CachedTieringDecision::kPending) {
+    return false;
+  }
+  FunctionKey key;
+  if (!ComputeKey(shared, &key)) return false;
+  CachedTieringDecision decision;
+  if (!GetDecisionTable()->Lookup(key, &decision)) return false;
+  shared->set_cached_tiering_decision(decision);
+  return true;
+}
+
+// static
+void SharedTieringDecisions::StoreToFileIfNeeded() {
+  if (!v8_flags.tiering_decisions_file) return;
+  GetDecisionTable()->StoreToFile(v8_flags.tiering_decisions_file);
+}
+
+// static
+void SharedTieringDecisions::LoadFromFileForTesting(const char* filename) {
+  GetDecisionTable()->LoadFromFile(filename);
+}
+
+// static
+void SharedTieringDecisions::StoreToFileForTesting(const char* filename) {
+  GetDecisionTable()->StoreToFile(filename);
+}
+
+// static
+void SharedTieringDecisions::ClearForTesting() { GetDecisionTable()->Clear(); }
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,49 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_EXECUTION_SHARED_TIERING_DECISIONS_H_
+#define V8_EXECUTION_SHARED_TIERING_DECISIONS_H_
+
+#include "src/common/globals.h"
+#include "src/objects/tagged.h"
+
+namespace v8 {
+namespace internal {
+
+class SharedFunctionInfo;
+
+// A process-wide table of the cached tiering decisions made for functions, so
+// that isolates running the same scripts can start optimizing them early
+// instead of re-learning that they are hot (--shared-tiering-decisions).
+//
+// Entries are keyed by the function's source text and position within its
+// script, which is stable across isolates, unlike SharedFunctionInfos or
+// string hashes. Optimized code itself is isolate-specific and is not shared.
+//
+// With --tiering-decisions-file the table is loaded from that file when it is
+// first used and written back when V8 is disposed, so that a restarted process
+// starts out with the decisions of the previous run.
+class SharedTieringDecisions final : public AllStatic {
+ public:
+  // Records the decision made for |shared| in the current isolate. kNormal
+  // drops a previously recorded early decision, e.g. after a deopt.
+  static void Record(Tagged<SharedFunctionInfo> shared,
+                     CachedTieringDecision decision);
+
+  // Seeds the cached tiering decision of a still pending |shared| from a
+  // decision recorded in any isolate. Returns true if it was updated.
+  static bool Apply(Tagged<SharedFunctionInfo> shared);
+
+  // Writes the table to --tiering-decisions-file, if set.
+  static void StoreToFileIfNeeded();
+
+  static void LoadFromFileForTesting(const char* filename);
+  static void StoreToFileForTesting(const char* filename);
+  static void ClearForTesting();
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_EXECUTION_SHARED_TIERING_DECISIONS_H_
@@ -162,6 +162,11 @@ void StackGuard::RequestInterrupt(InterruptFlag flag) {
     return;
   }
 
+  // If the interrupt is already pending, the stack limits are already set and
+  // a futex wait has already been interrupted. Skip notifying the futex wait
+  // list again, since its mutex is shared by all isolates in the process.
+  if (thread_local_.interrupt_flags_ & flag) return;
+
   // Not intercepted.  Set as active interrupt flag.
   thread_local_.interrupt_flags_ |= flag;
   update_interrupt_requests_and_stack_limits(access);
@@ -4,6 +4,8 @@
 
 #include "src/execution/tiering-manager.h"
 
+#include <algorithm>
+
 #include "src/base/platform/platform.h"
 #include "src/baseline/baseline.h"
 #include "src/codegen/assembler.h"
@@ -11,6 +13,7 @@
 #include "src/codegen/compiler.h"
 #include "src/codegen/pending-optimization-table.h"
 #include "src/common/globals.h"
+#include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/execution.h"
 #include "src/execution/frames-inl.h"
@@ -182,10 +185,18 @@ bool TiersUpToMaglev(base::Optional<CodeKind> code_kind) {
   return code_kind.has_value() && TiersUpToMaglev(code_kind.value());
 }
 
+int ScaleBudget(int budget, int scale_percent) {
+  if (scale_percent == 100) return budget;
+  return static_cast<int>(
+      std::min<int64_t>(static_cast<int64_t>(budget) * scale_percent / 100,
+                        INT_MAX / 2));
+}
+
 int InterruptBudgetFor(base::Optional<CodeKind> code_kind,
                        TieringState tiering_state,
                        CachedTieringDecision cached_tiering_decision,
-                       int bytecode_length) {
+                       int bytecode_length, int maglev_scale_percent,
+                       int turbofan_scale_percent) {
   if (IsRequestTurbofan(tiering_state) ||
       (code_kind.has_value() && code_kind.value() == CodeKind::TURBOFAN)) {
     return v8_flags.invocation_count_for_osr * bytecode_length;
@@ -202,9 +213,11 @@ int InterruptBudgetFor(base::Optional<CodeKind> code_kind,
          cached_tiering_decision == CachedTieringDecision::kEarlyTurbofan)) {
       return v8_flags.invocation_count_for_early_optimization * bytecode_length;
     }
-    return v8_flags.invocation_count_for_maglev * bytecode_length;
+    return ScaleBudget(v8_flags.invocation_count_for_maglev * bytecode_length,
+                       maglev_scale_percent);
   }
-  return v8_flags.invocation_count_for_turbofan * bytecode_length;
+  return ScaleBudget(v8_flags.invocation_count_for_turbofan * bytecode_length,
+                     turbofan_scale_percent);
 }
 
 }  // namespace
@@ -228,11 +241,62 @@ int TieringManager::InterruptBudgetFor(
     // operation for forward jump.
     return INT_MAX / 2;
   }
+  TieringManager* const manager = isolate->tiering_manager();
   return ::i::InterruptBudgetFor(
       override_active_tier ? override_active_tier
                            : function->GetActiveTier(isolate),
       function->tiering_state(), function->shared()->cached_tiering_decision(),
-      bytecode_length);
+      bytecode_length, manager->maglev_budget_scale_percent(),
+      manager->turbofan_budget_scale_percent());
+}
+
+void TieringManager::NotifyOptimizedCompileFinished(CodeKind code_kind,
+                                                    double compile_ms) {
+  if (!v8_flags.adaptive_tiering_budget) return;
+  DCHECK(code_kind == CodeKind::MAGLEV || code_kind == CodeKind::TURBOFAN);
+  const bool is_maglev = code_kind == CodeKind::MAGLEV;
+  AdaptiveBudget& budget = is_maglev ? maglev_budget_ : turbofan_budget_;
+  const double target_ms =
+      is_maglev ? v8_flags.adaptive_tiering_budget_maglev_target_ms
+                : v8_flags.adaptive_tiering_budget_turbofan_target_ms;
+
+  // Exponential moving average, so that a few outliers do not swing the
+  // budgets around.
+  constexpr double kDecay = 0.75;
+  budget.average_compile_ms =
+      budget.average_compile_ms == 0
+          ? compile_ms
+          : kDecay * budget.average_compile_ms + (1 - kDecay) * compile_ms;
+
+  // Expensive compiles make tier-up wait for more evidence that a function is
+  // hot; cheap ones let it happen earlier. A saturated Turbofan queue means
+  // the background threads cannot keep up, so Turbofan requests back off
+  // further.
+  double scale = target_ms > 0 ? budget.average_compile_ms / target_ms : 1;
+  const bool queue_saturated =
+      !is_maglev && isolate_->concurrent_recompilation_enabled() &&
+      !isolate_->optimizing_compile_dispatcher()->IsQueueAvailable();
+  if (queue_saturated) scale *= 2;
+  const int scale_percent =
+      std::clamp(static_cast<int>(scale * 100), kMinBudgetScalePercent,
+                 kMaxBudgetScalePercent);
+  if (scale_percent == budget.scale_percent) return;
+  budget.scale_percent = scale_percent;
+
+  if (V8_UNLIKELY(v8_flags.trace_adaptive_tiering_budget)) {
+    PrintF("[adaptive tiering budget: %s budget %d%% (%d invocations), "
+           "average compile %.2f ms%s]\n",
+           CodeKindToString(code_kind), scale_percent,
+           ScaleBudget(is_maglev ? v8_flags.invocation_count_for_maglev
+                                 : v8_flags.invocation_count_for_turbofan,
+                       scale_percent),
+           budget.average_compile_ms,
+           queue_saturated ? ", queue saturated" : "");
+  }
+  TRACE_EVENT_INSTANT2(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                       "V8.AdaptiveTieringBudget", TRACE_EVENT_SCOPE_THREAD,
+                       "tier", CodeKindToString(code_kind), "scale_percent",
+                       scale_percent);
 }
 
 namespace {
@@ -325,7 +389,15 @@ void TieringManager::MaybeOptimizeFrame(Tagged<JSFunction> function,
 
     // OSR kicks in only once we've previously decided to tier up, but we are
     // still in a lower-tier frame (this implies a long-running loop).
-    TryIncrementOsrUrgency(isolate_, function);
+    if (v8_flags.early_osr_for_single_invocation &&
+        function->feedback_vector()->invocation_count() <= 1) {
+      // All of the interrupt budget was spent on back edges of the current
+      // invocation, so waiting for the urgency to reach the innermost loop
+      // one budget at a time only delays OSR.
+      TryRequestOsrAtNextOpportunity(isolate_, function);
+    } else {
+      TryIncrementOsrUrgency(isolate_, function);
+    }
 
     // Return unconditionally and don't run through the optimization decision
     // again; we've already decided to tier up previously.
@@ -42,7 +42,30 @@ class TieringManager {
 
   void MarkForTurboFanOptimization(Tagged<JSFunction> function);
 
+  // Feeds the adaptive budget controller (--adaptive-tiering-budget) with the
+  // total duration of a finished Maglev or Turbofan compile.
+  void NotifyOptimizedCompileFinished(CodeKind code_kind, double compile_ms);
+
+  // The percentages by which the Maglev and Turbofan invocation budgets are
+  // currently scaled; 100 unless --adaptive-tiering-budget is enabled.
+  int maglev_budget_scale_percent() const {
+    return maglev_budget_.scale_percent;
+  }
+  int turbofan_budget_scale_percent() const {
+    return turbofan_budget_.scale_percent;
+  }
+
  private:
+  // Tracks a moving average of the compile times of one tier and derives the
+  // budget scale from it.
+  struct AdaptiveBudget {
+    double average_compile_ms = 0;
+    int scale_percent = 100;
+  };
+
+  static constexpr int kMinBudgetScalePercent = 50;
+  static constexpr int kMaxBudgetScalePercent = 400;
+
   // Make the decision whether to optimize the given function, and mark it for
   // optimization if the decision was 'yes'.
   // This function is also responsible for bumping the OSR urgency.
@@ -65,6 +88,8 @@ class TieringManager {
   };
 
   Isolate* const isolate_;
+  AdaptiveBudget maglev_budget_;
+  AdaptiveBudget turbofan_budget_;
 };
 
 }  // namespace internal
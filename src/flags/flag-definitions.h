@@ -349,6 +349,10 @@ DEFINE_NEG_NEG_IMPLICATION(harmony_shipping, js_shipping)
 DEFINE_BOOL(builtin_subclassing, true,
             "subclassing support in built-in methods")
 
+DEFINE_BOOL(js_finalization_registry_batch_cleanup, false,
+            "let FinalizationRegistries created with {batch: true} pass all "
+            "held values of a cleanup to a single callback call as an array")
+
 // If the following flag is set to `true`, the SharedArrayBuffer constructor is
 // enabled per context depending on the callback set via
 // `SetSharedArrayBufferConstructorEnabledCallback`. If no callback is set, the
@@ -358,6 +362,9 @@ DEFINE_BOOL(enable_sharedarraybuffer_per_context, false,
 
 #ifdef V8_INTL_SUPPORT
 DEFINE_BOOL(icu_timezone_data, true, "get information about timezones from ICU")
+DEFINE_UINT(icu_object_cache_size, 64,
+            "number of locales for which ICU formatters and collators used by "
+            "toLocaleString and localeCompare are cached")
 #endif
 
 #ifdef V8_ENABLE_DOUBLE_CONST_STORE_CHECK
@@ -575,6 +582,7 @@ DEFINE_BOOL(maglev_inline_api_calls, false,
 DEFINE_WEAK_NEG_IMPLICATION(maglev_future, maglev_loop_peeling_only_trivial)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_speculative_hoist_phi_untagging)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_inline_api_calls)
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_regalloc_split_around_loops)
 // This might be too big of a hammer but we must prohibit moving the C++
 // trampolines while we are executing a C++ code.
 DEFINE_NEG_IMPLICATION(maglev_inline_api_calls, compact_code_space_with_stack)
@@ -616,6 +624,9 @@ DEFINE_EXPERIMENTAL_FEATURE(
     "enable phi untagging to hoist untagging of loop phi inputs (could "
     "still cause deopt loops)")
 DEFINE_BOOL(maglev_cse, false, "common subexpression elimination")
+DEFINE_BOOL(maglev_regalloc_split_around_loops, false,
+            "keep values that are live across loops but unused in them "
+            "spilled for the duration of the loop")
 
 DEFINE_STRING(maglev_filter, "*", "optimization filter for the maglev compiler")
 DEFINE_BOOL(maglev_assert, false, "insert extra assertion in maglev code")
@@ -817,6 +828,9 @@ DEFINE_BOOL_READONLY(enable_sealed_frozen_elements_kind, true,
 // Flags for data representation optimizations
 DEFINE_BOOL(unbox_double_arrays, true, "automatically unbox arrays of doubles")
 DEFINE_BOOL_READONLY(string_slices, true, "use string slices")
+DEFINE_BOOL(string_search_without_flattening, true,
+            "search large cons strings segment by segment instead of "
+            "flattening them first")
 
 // Tiering: Sparkplug / feedback vector allocation.
 DEFINE_INT(invocation_count_for_feedback_allocation, 8,
@@ -844,6 +858,18 @@ DEFINE_INT(minimum_invocations_after_ic_update, 500,
 DEFINE_INT(minimum_invocations_before_optimization, 2,
            "Minimum number of invocations we need before non-OSR optimization")
 
+// Tiering: adaptive budgets.
+DEFINE_BOOL(adaptive_tiering_budget, false,
+            "scale the Maglev and Turbofan invocation budgets by the measured "
+            "cost of optimizing compiles and the load of the Turbofan queue")
+DEFINE_FLOAT(adaptive_tiering_budget_maglev_target_ms, 1.0,
+             "Maglev compile time at which the Maglev budget is not scaled")
+DEFINE_FLOAT(adaptive_tiering_budget_turbofan_target_ms, 10.0,
+             "Turbofan compile time at which the Turbofan budget is not "
+             "scaled")
+DEFINE_BOOL(trace_adaptive_tiering_budget, false,
+            "trace changes of the adaptive tiering budget scales")
+
 // Tiering: JIT fuzzing.
 //
 // When --jit-fuzzing is enabled, various tiering related thresholds are
@@ -968,6 +994,9 @@ DEFINE_WEAK_IMPLICATION(trace_baseline, trace_baseline_batch_compilation)
 
 // Internalize into a shared string table in the shared isolate
 DEFINE_BOOL(shared_string_table, false, "internalize strings into shared table")
+DEFINE_BOOL(lock_free_string_table_insertion, true,
+            "insert into the string table without taking its lock unless it "
+            "needs to be resized")
 DEFINE_IMPLICATION(harmony_struct, shared_string_table)
 DEFINE_EXPERIMENTAL_FEATURE(
     always_use_string_forwarding_table,
@@ -999,6 +1028,12 @@ DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
+DEFINE_BOOL(concurrent_recompilation_prioritize, false,
+            "pick the next concurrent compilation job based on its hotness "
+            "and size instead of in FIFO order")
+DEFINE_INT(concurrent_recompilation_large_bytecode_size, 4096,
+           "bytecode size above which the priority of concurrent compilation "
+           "jobs is reduced")
 DEFINE_UINT(
     concurrent_turbofan_max_threads, 0,
     "max number of threads that concurrent Turbofan can use (0 for unbounded)")
@@ -1163,6 +1198,9 @@ DEFINE_WEAK_VALUE_IMPLICATION(maglev_osr, osr_from_maglev, true)
 DEFINE_NEG_VALUE_IMPLICATION(use_osr, maglev_osr, false)
 DEFINE_NEG_VALUE_IMPLICATION(turbofan, osr_from_maglev, false)
 DEFINE_BOOL(concurrent_osr, true, "enable concurrent OSR")
+DEFINE_BOOL(early_osr_for_single_invocation, false,
+            "request OSR at the next back edge once a function that has only "
+            "been invoked once decides to tier up")
 
 // TODO(dmercadier): fix and re-enable string builder.
 DEFINE_BOOL_READONLY(turbo_string_builder, false,
@@ -1205,10 +1243,21 @@ DEFINE_STRING(
 DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
             "verify register allocation in TurboFan")
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
+DEFINE_BOOL(turbo_parallel_commit_assignment, false,
+            "commit register assignments of large functions on several "
+            "threads in TurboFan")
+DEFINE_INT(turbo_parallel_commit_assignment_min_live_ranges, 20000,
+           "minimum number of live ranges for committing register "
+           "assignments on several threads")
+DEFINE_UINT(turbo_parallel_commit_assignment_max_threads, 4,
+            "maximum number of threads used to commit register assignments")
+DEFINE_NEG_IMPLICATION(single_threaded, turbo_parallel_commit_assignment)
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "TurboFan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "TurboFan loop rotation")
+DEFINE_BOOL(turbo_defer_deoptimize_and_throw_blocks, true,
+            "move blocks ending in a deoptimization or throw out of line")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "TurboFan allocation folding")
@@ -1278,6 +1327,15 @@ DEFINE_BOOL(turboshaft_machine_lowering_opt, false,
 DEFINE_BOOL(turboshaft_loop_peeling, false, "enable Turboshaft's loop peeling")
 DEFINE_BOOL(turboshaft_loop_unrolling, false,
             "enable Turboshaft's loop unrolling")
+DEFINE_BOOL(turboshaft_licm, false,
+            "enable Turboshaft's loop-invariant code motion")
+DEFINE_BOOL(turboshaft_bounds_check_elimination, false,
+            "enable Turboshaft's elimination of bounds checks in loops")
+DEFINE_BOOL(turboshaft_js_loop_vectorization, false,
+            "enable vectorization of element-wise typed array loops in "
+            "Turboshaft")
+DEFINE_IMPLICATION(turboshaft_js_loop_vectorization,
+                   turboshaft_bounds_check_elimination)
 
 DEFINE_EXPERIMENTAL_FEATURE(turboshaft_typed_optimizations,
                             "enable an additional Turboshaft phase that "
@@ -1305,6 +1363,9 @@ DEFINE_WEAK_IMPLICATION(turboshaft_future, turboshaft_load_elimination)
 DEFINE_WEAK_IMPLICATION(turboshaft_future, turboshaft_machine_lowering_opt)
 DEFINE_WEAK_IMPLICATION(turboshaft_future, turboshaft_loop_unrolling)
 DEFINE_WEAK_IMPLICATION(turboshaft_future, turboshaft_loop_peeling)
+DEFINE_WEAK_IMPLICATION(turboshaft_future, turboshaft_licm)
+DEFINE_WEAK_IMPLICATION(turboshaft_future,
+                        turboshaft_bounds_check_elimination)
 DEFINE_WEAK_IMPLICATION(turboshaft_future, turboshaft_wasm)
 #if V8_TARGET_ARCH_X64 or V8_TARGET_ARCH_ARM64 or V8_TARGET_ARCH_ARM or \
     V8_TARGET_ARCH_IA32
@@ -1344,6 +1405,14 @@ DEFINE_BOOL(profile_guided_optimization_for_empty_feedback_vector, false,
             "profile guided optimization for empty feedback vector")
 DEFINE_INT(invocation_count_for_early_optimization, 20,
            "invocation count threshold for early optimization")
+DEFINE_BOOL(shared_tiering_decisions, false,
+            "share profile guided tiering decisions between isolates of the "
+            "process running the same scripts")
+DEFINE_IMPLICATION(shared_tiering_decisions, profile_guided_optimization)
+DEFINE_STRING(tiering_decisions_file, nullptr,
+              "load shared tiering decisions from this file on first use and "
+              "store them to it when V8 is disposed")
+DEFINE_IMPLICATION(tiering_decisions_file, shared_tiering_decisions)
 
 // Favor memory over execution speed.
 DEFINE_BOOL(optimize_for_size, false,
@@ -1360,6 +1429,9 @@ DEFINE_BOOL(wasm_generic_wrapper, true,
 DEFINE_BOOL(wasm_to_js_generic_wrapper, false,
             "allow use of the generic wasm-to-js wrapper instead of "
             "per-signature wrappers")
+DEFINE_BOOL(wasm_shared_import_wrapper_cache, false,
+            "share compiled wasm-to-JS wrappers between all modules and "
+            "isolates of the process")
 DEFINE_BOOL(wasm_js_js_generic_wrapper, true,
             "allow use of the generic js-to-js wrapper instead of "
             "per-signature wrappers")
@@ -1419,6 +1491,11 @@ DEFINE_INT(
     wasm_caching_timeout_ms, 0,
     "only trigger caching if no new code was compiled within this timeout (0 "
     "to disable this logic and only use --wasm-caching-threshold)")
+DEFINE_STRING(wasm_code_cache_dir, nullptr,
+              "directory in which compiled wasm modules are cached across "
+              "processes (keyed on the wire bytes)")
+DEFINE_UINT(wasm_code_cache_dir_max_entries, 256,
+            "maximum number of modules kept in --wasm-code-cache-dir")
 DEFINE_BOOL(trace_wasm_compilation_times, false,
             "print how long it took to compile each wasm function")
 DEFINE_INT(wasm_tier_up_filter, -1, "only tier-up function with this index")
@@ -1430,6 +1507,9 @@ DEFINE_DEBUG_BOOL(trace_wasm_stack_switching, false,
                   "trace wasm stack switching")
 DEFINE_INT(wasm_stack_switching_stack_size, V8_DEFAULT_STACK_SIZE_KB,
            "default size of stacks for wasm stack-switching (in kB)")
+DEFINE_INT(wasm_stack_pool_size, 16 * MB / KB,
+           "maximum size of the pool of unused stacks for wasm stack-switching "
+           "(in kB)")
 DEFINE_BOOL(liftoff, true,
             "enable Liftoff, the baseline compiler for WebAssembly")
 DEFINE_BOOL(liftoff_only, false,
@@ -1438,6 +1518,12 @@ DEFINE_IMPLICATION(liftoff_only, liftoff)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_tier_up)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_dynamic_tiering)
 DEFINE_NEG_IMPLICATION(fuzzing, liftoff_only)
+DEFINE_BOOL(liftoff_cache_loop_locals, false,
+            "keep locals which are not assigned inside a loop in their "
+            "registers when entering the loop in Liftoff")
+DEFINE_INT(liftoff_loop_analysis_budget, 4,
+           "number of loop body bytes Liftoff may pre-analyze for "
+           "--liftoff-cache-loop-locals, per byte of function body")
 DEFINE_DEBUG_BOOL(
     enable_testing_opcode_in_wasm, false,
     "enables a testing opcode in wasm that is only implemented in TurboFan")
@@ -1542,6 +1628,9 @@ DEFINE_SIZE_T(
 DEFINE_SIZE_T(wasm_inlining_min_budget, 50,
               "minimum graph size budget (in TF nodes) for which the "
               "wasm_inlinining_factor does not apply")
+DEFINE_BOOL(wasm_inlining_call_indirect, false,
+            "collect call_indirect feedback in Liftoff and speculatively "
+            "inline the target seen most often")
 DEFINE_BOOL(trace_wasm_inlining, false, "trace wasm inlining")
 DEFINE_BOOL(trace_wasm_typer, false, "trace wasm typer")
 
@@ -1564,11 +1653,20 @@ DEFINE_BOOL(asm_wasm_lazy_compilation, true,
             "--validate-asm)")
 DEFINE_BOOL(wasm_lazy_compilation, true,
             "enable lazy compilation for all wasm modules")
+DEFINE_BOOL(wasm_lazy_deserialization, false,
+            "defer copying and relocating deserialized wasm code to the first "
+            "call of each function")
 DEFINE_DEBUG_BOOL(trace_wasm_lazy_compilation, false,
                   "trace lazy compilation of wasm functions")
 DEFINE_BOOL(wasm_lazy_validation, false,
             "enable lazy validation for lazily compiled wasm functions")
 DEFINE_WEAK_IMPLICATION(wasm_lazy_validation, wasm_lazy_compilation)
+DEFINE_BOOL(wasm_streaming_background_validation, false,
+            "validate lazily compiled functions on background threads during "
+            "streaming compilation, even with --wasm-lazy-validation")
+DEFINE_BOOL(wasm_background_validation_during_decoding, true,
+            "validate function bodies on background threads while the sections "
+            "after the code section are still being decoded")
 DEFINE_BOOL(wasm_simd_ssse3_codegen, false, "allow wasm SIMD SSSE3 codegen")
 
 DEFINE_BOOL(wasm_code_gc, true, "enable garbage collection of wasm code")
@@ -1620,6 +1718,10 @@ DEFINE_BOOL(wasm_memory64_trap_handling, false,
 DEFINE_BOOL_READONLY(wasm_memory64_trap_handling, false,
                      "Use trap handling for Wasm memory64 bounds checks")
 #endif  // V8_TARGET_ARCH_ARM64 || V8_TARGET_ARCH_X64
+DEFINE_UINT(wasm_memory64_guard_regions_max_pages, kMaxUInt32,
+            "maximum size (in 64k pages) of memory64 memories that use guard "
+            "regions for bounds checks; each such memory reserves twice this "
+            "size (rounded up to a power of two) of address space")
 
 #endif  // V8_ENABLE_WEBASSEMBLY
 
@@ -1636,6 +1738,9 @@ DEFINE_SIZE_T(max_semi_space_size, 0,
               "max size of a semi-space (in MBytes), the new space consists of "
               "two semi-spaces")
 DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
+DEFINE_BOOL(predictive_new_space_sizing, true,
+            "size the new space based on the predicted new space allocation "
+            "throughput in addition to survival")
 DEFINE_SIZE_T(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_SIZE_T(
     max_heap_size, 0,
@@ -1735,6 +1840,9 @@ DEFINE_IMPLICATION(cppgc_young_generation, minor_ms)
 // Unified young generation disables the unmodified wrapper reclamation
 // optimization.
 DEFINE_NEG_IMPLICATION(cppgc_young_generation, reclaim_unmodified_wrappers)
+DEFINE_BOOL(trace_cppgc_collection_totals, false,
+            "print the accumulated cost and yield of minor and major Oilpan "
+            "garbage collections after each cycle")
 DEFINE_BOOL(optimize_gc_for_battery, false, "optimize GC for battery")
 #if defined(V8_ATOMIC_OBJECT_FIELD_WRITES)
 DEFINE_BOOL(concurrent_marking, true, "use concurrent marking")
@@ -1746,8 +1854,15 @@ DEFINE_BOOL(concurrent_marking, false, "use concurrent marking")
 DEFINE_INT(
     concurrent_marking_max_worker_num, 7,
     "max worker number of concurrent marking, 0 for NumberOfWorkerThreads")
+DEFINE_UINT(concurrent_marking_prefetch_distance, 0,
+            "number of upcoming worklist entries (at most 16) concurrent "
+            "marking tasks prefetch ahead of visiting, 0 to disable")
 DEFINE_BOOL(concurrent_array_buffer_sweeping, true,
             "concurrently sweep array buffers")
+DEFINE_UINT(array_buffer_pool_size_kb, 0,
+            "keep up to this many KB of released 4-64 KB array buffer backing "
+            "stores for reuse by new array buffers of the same length (only "
+            "for shared array buffer allocators)")
 DEFINE_BOOL(stress_concurrent_allocation, false,
             "start background threads that allocate memory")
 DEFINE_BOOL(parallel_marking, true, "use parallel marking in atomic pause")
@@ -1763,6 +1878,8 @@ DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
 DEFINE_BOOL(parallel_weak_ref_clearing, true,
             "use parallel threads to clear weak refs in the atomic pause.")
+DEFINE_BOOL(parallel_external_pointer_table_sweeping, true,
+            "sweep the segments of the external pointer table in parallel")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
             "trigger out-of-memory failure to avoid GC storm near heap limit")
 DEFINE_BOOL(trace_incremental_marking, false,
@@ -1773,6 +1890,9 @@ DEFINE_BOOL(track_gc_object_stats, false,
             "track object counts and memory usage")
 DEFINE_BOOL(trace_gc_object_stats, false,
             "trace object counts and memory usage")
+DEFINE_BOOL(track_gc_instance_type_stats, false,
+            "track object counts and memory usage by instance type during "
+            "marking")
 DEFINE_BOOL(trace_zone_stats, false, "trace zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_stats,
@@ -1781,6 +1901,9 @@ DEFINE_GENERIC_IMPLICATION(
 DEFINE_SIZE_T(
     zone_stats_tolerance, 1 * MB,
     "report a tick only when allocated zone memory changes by this amount")
+DEFINE_SIZE_T(zone_segment_pool_size, 1 * MB,
+              "maximum number of bytes of freed zone segments kept per "
+              "allocator for reuse (0 disables pooling)")
 DEFINE_BOOL(trace_zone_type_stats, false, "trace per-type zone memory usage")
 DEFINE_GENERIC_IMPLICATION(
     trace_zone_type_stats,
@@ -1820,6 +1943,12 @@ DEFINE_BOOL_READONLY(verify_heap, false,
 #endif
 DEFINE_BOOL(move_object_start, true, "enable moving of object starts")
 DEFINE_BOOL(memory_reducer, true, "use memory reducer")
+DEFINE_BOOL(container_memory_pressure, false,
+            "treat the heap as being under memory pressure while the memory "
+            "usage of the process' control group approaches its limit")
+DEFINE_UINT(container_memory_pressure_threshold_percent, 85,
+            "control group memory usage in percent of its limit at which "
+            "--container-memory-pressure kicks in")
 DEFINE_BOOL(memory_reducer_for_small_heaps, true,
             "use memory reducer for small heaps")
 DEFINE_BOOL(memory_reducer_single_gc, false,
@@ -1830,6 +1959,15 @@ DEFINE_INT(memory_reducer_gc_count, 3,
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(mergeable_read_only_heap, false,
+            "allow the OS to deduplicate read-only heap pages with identical "
+            "pages of other processes (Linux KSM)")
+DEFINE_BOOL(transparent_huge_pages, false,
+            "ask the OS to back the code range and old space pages with "
+            "transparent huge pages (Linux THP)")
+DEFINE_SIZE_T(large_page_pool_size, 16,
+              "max size (in Mbytes) of the memory of dead large pages that is "
+              "kept committed for reuse by large object allocations")
 DEFINE_BOOL(allocation_buffer_parking, true, "allocation buffer parking")
 DEFINE_BOOL(compact, true,
             "Perform compaction on full GCs based on V8's default heuristics")
@@ -1837,6 +1975,10 @@ DEFINE_BOOL(compact_code_space, true,
             "Perform code space compaction on full collections.")
 DEFINE_BOOL(compact_on_every_full_gc, false,
             "Perform compaction on every full GC")
+DEFINE_UINT(compaction_time_budget_ms, 0,
+            "if non-zero, limit the bytes evacuated from a space in a single "
+            "full GC to what the traced compaction speed can move within "
+            "this many milliseconds")
 DEFINE_BOOL(compact_with_stack, true,
             "Perform compaction when finalizing a full GC with stack")
 DEFINE_BOOL(
@@ -1855,6 +1997,10 @@ DEFINE_BOOL(flush_baseline_code, false,
 DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
 DEFINE_INT(bytecode_old_age, 6, "number of gcs before we flush code")
+DEFINE_BOOL(adaptive_bytecode_flushing, false,
+            "adjust --bytecode-old-age: flush sooner in GCs that reduce memory "
+            "and later for functions which were already re-compiled after "
+            "being flushed")
 DEFINE_BOOL(flush_code_based_on_time, false,
             "Use time-base code flushing instead of age.")
 DEFINE_BOOL(flush_code_based_on_tab_visibility, false,
@@ -1958,6 +2104,8 @@ DEFINE_BOOL(enable_sahf, true,
 DEFINE_BOOL(enable_avx, true, "enable use of AVX instructions if available")
 DEFINE_BOOL(enable_avx2, true, "enable use of AVX2 instructions if available")
 DEFINE_BOOL(enable_fma3, true, "enable use of FMA3 instructions if available")
+DEFINE_BOOL(enable_avx_vnni, true,
+            "enable use of AVX-VNNI instructions if available")
 DEFINE_BOOL(enable_bmi1, true, "enable use of BMI1 instructions if available")
 DEFINE_BOOL(enable_bmi2, true, "enable use of BMI2 instructions if available")
 DEFINE_BOOL(enable_lzcnt, true, "enable use of LZCNT instruction if available")
@@ -2138,6 +2286,21 @@ DEFINE_IMPLICATION(parallel_compile_tasks_for_eager_toplevel,
 DEFINE_BOOL(parallel_compile_tasks_for_lazy, false,
             "spawn parallel compile tasks for all lazily compiled functions")
 DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, lazy_compile_dispatcher)
+DEFINE_BOOL(parallel_compile_tasks_for_lazy_toplevel, false,
+            "spawn parallel compile tasks for lazily compiled, top-level "
+            "functions")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy_toplevel,
+                   lazy_compile_dispatcher)
+// Top-level function declarations and IIFEs are the functions most likely to
+// run during startup, so compile both on background threads while the rest of
+// the script is being parsed.
+DEFINE_BOOL(parallel_compile_tasks_for_toplevel, false,
+            "spawn parallel compile tasks for all top-level functions, "
+            "eagerly or lazily compiled")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_toplevel,
+                   parallel_compile_tasks_for_eager_toplevel)
+DEFINE_IMPLICATION(parallel_compile_tasks_for_toplevel,
+                   parallel_compile_tasks_for_lazy_toplevel)
 
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
@@ -2318,6 +2481,8 @@ DEFINE_BOOL(adjust_os_scheduling_parameters, true,
             "adjust OS specific scheduling params for the isolate")
 DEFINE_BOOL(experimental_flush_embedded_blob_icache, true,
             "Used in an experiment to evaluate icache flushing on certain CPUs")
+DEFINE_BOOL(parallel_bigint_multiplication, true,
+            "use worker threads for multiplying very large BigInts")
 
 // Flags for short builtin calls feature
 #if V8_SHORT_BUILTIN_CALLS
@@ -2350,6 +2515,15 @@ DEFINE_BOOL(abort_on_far_code_range, false,
             "Abort if code range is allocated further away than 4GB from the"
             ".text section")
 
+// runtime-typedarray.cc
+DEFINE_SIZE_T(typed_array_parallel_sort_threshold, size_t{1} << 20,
+              "minimum length of typed arrays that are sorted in parallel "
+              "chunks on worker threads (0 disables parallel sorting)")
+DEFINE_SIZE_T(typed_array_parallel_copy_threshold, size_t{64} * MB,
+              "minimum byte length of non-shared typed array copies that are "
+              "split into chunks copied on worker threads (0 disables "
+              "parallel copying)")
+
 // runtime.cc
 DEFINE_BOOL(runtime_call_stats, false, "report runtime call counts and times")
 DEFINE_GENERIC_IMPLICATION(
@@ -2358,6 +2532,14 @@ DEFINE_GENERIC_IMPLICATION(
         v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
 DEFINE_BOOL(rcs, false, "report runtime call counts and times")
 DEFINE_IMPLICATION(rcs, runtime_call_stats)
+DEFINE_BOOL(runtime_call_stats_sampling, false,
+            "only track the active runtime call counter, without counting or "
+            "timing calls, so that CPU profiler samples are attributed to "
+            "runtime call counters")
+DEFINE_GENERIC_IMPLICATION(
+    runtime_call_stats_sampling,
+    TracingFlags::runtime_stats.fetch_or(
+        v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING))
 
 DEFINE_BOOL(rcs_cpu_time, false,
             "report runtime times in cpu time (the default is wall time)")
@@ -2368,10 +2550,21 @@ DEFINE_BOOL(verify_snapshot_checksum, DEBUG_BOOL,
             "Verify snapshot checksums when deserializing snapshots. Enable "
             "checksum creation and verification for code caches. Enabled by "
             "default in debug builds and once per process for Android.")
+DEFINE_BOOL(cache_decompressed_snapshot, false,
+            "Keep decompressed snapshot data alive for the rest of the process "
+            "so that isolates and contexts created later from the same, "
+            "unchanged snapshot blob skip decompression.")
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
+
+// code-cache-store.cc
+DEFINE_STRING(code_cache_dir, nullptr,
+              "directory of a persistent code cache that is used for scripts "
+              "compiled without embedder-provided cached data")
+DEFINE_UINT(code_cache_dir_max_entries, 1024,
+            "maximum number of scripts kept in --code-cache-dir")
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 DEFINE_BOOL(regexp_interpret_all, false, "interpret all regexp code")
@@ -2387,8 +2580,13 @@ DEFINE_NEG_IMPLICATION(regexp_interpret_all, regexp_tier_up)
 DEFINE_INT(regexp_tier_up_ticks, 1,
            "set the number of executions for the regexp interpreter before "
            "tiering-up to the compiler")
+DEFINE_BOOL(regexp_process_wide_cache, true,
+            "share regexp bytecode and tier-up decisions between isolates")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
+DEFINE_BOOL(regexp_simd, true,
+            "use SIMD instructions to skip ahead in generated regexp code "
+            "where supported")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
             "trace regexp bytecode peephole optimization")
 DEFINE_BOOL(trace_regexp_bytecodes, false, "trace regexp bytecode execution")
@@ -2406,6 +2604,12 @@ DEFINE_IMPLICATION(default_to_experimental_regexp_engine,
                    enable_experimental_regexp_engine)
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
+DEFINE_BOOL(experimental_regexp_engine_lazy_dfa, true,
+            "use a lazily constructed DFA to reject subjects without a match "
+            "before running the experimental regexp engine")
+DEFINE_INT(experimental_regexp_engine_dfa_max_states, 1000,
+           "maximum number of DFA states per execution of the experimental "
+           "regexp engine before falling back to the NFA")
 
 DEFINE_BOOL(enable_experimental_regexp_engine_on_excessive_backtracks, false,
             "fall back to a breadth-first regexp engine on excessive "
@@ -2487,6 +2691,9 @@ DEFINE_STRING(startup_blob, nullptr,
 DEFINE_STRING(target_arch, nullptr,
               "The mksnapshot target arch. (mksnapshot only)")
 DEFINE_STRING(target_os, nullptr, "The mksnapshot target os. (mksnapshot only)")
+DEFINE_BOOL(embedded_blob_huge_page_alignment, false,
+            "Align the embedded blob code to huge pages so that the kernel "
+            "can map it with few iTLB entries. (mksnapshot only, ELF only)")
 DEFINE_BOOL(target_is_simulator, false,
             "Instruct mksnapshot that the target is meant to run in the "
             "simulator and it can generate simulator-specific instructions. "
@@ -2532,6 +2739,13 @@ DEFINE_UINT(minor_ms_concurrent_marking_trigger, 90,
             "minor ms concurrent marking trigger in percent of the current new "
             "space capacity")
 
+DEFINE_BOOL(minor_ms_defer_finalization, false,
+            "postpone the atomic pause of a young generation cycle while "
+            "concurrent marking is still making progress")
+DEFINE_UINT(minor_ms_max_finalization_deferrals, 10,
+            "maximum number of times the young generation GC task postpones "
+            "finalization, see --minor-ms-defer-finalization")
+
 DEFINE_SIZE_T(minor_ms_min_lab_size_kb, 0,
               "override for the minimum lab size in KB to be used for new "
               "space allocations with minor ms. ")
@@ -2654,6 +2868,9 @@ DEFINE_STRING(logfile, "v8.log",
               "Specify the name of the log file, use '-' for console, '+' for "
               "a temporary file.")
 DEFINE_BOOL(logfile_per_isolate, true, "Separate log files for each isolate.")
+DEFINE_BOOL(logfile_line_buffered, false,
+            "Flush the log file after every line instead of writing it in "
+            "large chunks.")
 
 DEFINE_BOOL(log, false,
             "Minimal logging (no API, code, GC, suspect, or handles samples).")
@@ -2841,6 +3058,7 @@ DEFINE_NEG_IMPLICATION(predictable, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(predictable, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_lazy_toplevel)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(predictable, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(predictable, maglev_build_code_on_background)
@@ -2868,6 +3086,9 @@ DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded,
+                       parallel_compile_tasks_for_lazy_toplevel)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_bigint_multiplication)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_build_code_on_background)
@@ -2883,6 +3104,8 @@ DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_compaction)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_marking)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_pointer_update)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_weak_ref_clearing)
+DEFINE_NEG_IMPLICATION(single_threaded_gc,
+                       parallel_external_pointer_table_sweeping)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_scavenge)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_array_buffer_sweeping)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, stress_concurrent_allocation)
@@ -578,6 +578,10 @@ uint32_t ComputeFlagListHash() {
     // We want to be able to flip --profile-deserialization without
     // causing the code cache to get invalidated by this hash.
     if (flag.PointsTo(&v8_flags.profile_deserialization)) continue;
+#if V8_ENABLE_WEBASSEMBLY
+    // Lazy deserialization doesn't change the serialization format.
+    if (flag.PointsTo(&v8_flags.wasm_lazy_deserialization)) continue;
+#endif  // V8_ENABLE_WEBASSEMBLY
     // Skip v8_flags.random_seed and v8_flags.predictable to allow predictable
     // code caching.
     if (flag.PointsTo(&v8_flags.random_seed)) continue;
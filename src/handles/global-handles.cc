@@ -16,6 +16,7 @@
 #include "src/base/sanitizer/asan.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
+#include "src/common/ptr-compr.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/heap/base/stack.h"
 #include "src/heap/gc-tracer-inl.h"
@@ -40,6 +41,11 @@ namespace {
 
 constexpr size_t kBlockSize = 256;
 
+// Weak nodes are filtered on background threads in chunks of this many
+// blocks, and only if there are at least two such chunks.
+constexpr size_t kBlocksPerWeakNodeFilteringChunk = 32;
+constexpr size_t kMaxWeakNodeFilteringTasks = 8;
+
 }  // namespace
 
 // Various internal weakness types for Persistent and Global handles.
@@ -211,6 +217,9 @@ class GlobalHandles::NodeSpace final {
   iterator begin() { return iterator(first_used_block_); }
   iterator end() { return iterator(nullptr); }
 
+  BlockType* first_used_block() const { return first_used_block_; }
+  size_t blocks() const { return blocks_; }
+
   size_t TotalSize() const { return blocks_ * sizeof(NodeType) * kBlockSize; }
   size_t handles_count() const { return handles_count_; }
 
@@ -695,6 +704,13 @@ V8_INLINE bool GlobalHandles::ResetWeakNodeIfDead(
 
   if (!should_reset_handle(isolate()->heap(), node->location())) return false;
 
+  ResetDeadWeakNode(node);
+  return true;
+}
+
+V8_INLINE void GlobalHandles::ResetDeadWeakNode(Node* node) {
+  DCHECK(node->IsWeakRetainer());
+
   switch (node->weakness_type()) {
     case WeaknessType::kNoCallback:
       node->ResetPhantomHandle();
@@ -705,12 +721,96 @@ V8_INLINE bool GlobalHandles::ResetWeakNodeIfDead(
       node->CollectPhantomCallbackData(&pending_phantom_callbacks_);
       break;
   }
-  return true;
 }
 
+// Finds the dead weak nodes of a snapshot of the used node blocks. Tasks claim
+// disjoint chunks of blocks and only evaluate the liveness predicate, which
+// reads marking state. Resetting nodes releases them to the free list and
+// collects callbacks, so that is left to the main thread, which processes the
+// dead nodes chunk by chunk in the same order as a serial iteration would.
+class GlobalHandles::WeakNodeFilteringJob final : public v8::JobTask {
+ public:
+  using BlockType = NodeBlock<Node>;
+
+  // |dead_nodes| must hold one (empty) vector per chunk of blocks.
+  WeakNodeFilteringJob(Heap* heap, const std::vector<BlockType*>* blocks,
+                       WeakSlotCallbackWithHeap should_reset_handle,
+                       std::vector<std::vector<Node*>>* dead_nodes)
+      : heap_(heap),
+        blocks_(blocks),
+        should_reset_handle_(should_reset_handle),
+        dead_nodes_(dead_nodes) {
+    DCHECK_EQ(dead_nodes->size(),
+              (blocks->size() + kBlocksPerWeakNodeFilteringChunk - 1) /
+                  kBlocksPerWeakNodeFilteringChunk);
+  }
+
+  WeakNodeFilteringJob(const WeakNodeFilteringJob&) = delete;
+  WeakNodeFilteringJob& operator=(const WeakNodeFilteringJob&) = delete;
+
+  void Run(JobDelegate* delegate) override {
+    // In case multi-cage pointer compression mode is enabled ensure that
+    // current thread's cage base values are properly initialized.
+    PtrComprCageAccessScope ptr_compr_cage_access_scope(heap_->isolate());
+    while (!delegate->ShouldYield()) {
+      const size_t chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= dead_nodes_->size()) break;
+      const size_t start = chunk * kBlocksPerWeakNodeFilteringChunk;
+      const size_t end = std::min(start + kBlocksPerWeakNodeFilteringChunk,
+                                  blocks_->size());
+      std::vector<Node*>& dead_nodes = (*dead_nodes_)[chunk];
+      for (size_t i = start; i < end; ++i) {
+        BlockType* block = (*blocks_)[i];
+        for (size_t index = 0; index < kBlockSize; ++index) {
+          Node* node = block->at(index);
+          if (node->IsWeakRetainer() &&
+              should_reset_handle_(heap_, node->location())) {
+            dead_nodes.push_back(node);
+          }
+        }
+      }
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    const size_t claimed = next_chunk_.load(std::memory_order_relaxed);
+    if (claimed >= dead_nodes_->size()) return 0;
+    return std::min(dead_nodes_->size() - claimed, kMaxWeakNodeFilteringTasks);
+  }
+
+ private:
+  Heap* const heap_;
+  const std::vector<BlockType*>* const blocks_;
+  const WeakSlotCallbackWithHeap should_reset_handle_;
+  std::vector<std::vector<Node*>>* const dead_nodes_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
 DISABLE_CFI_PERF
 void GlobalHandles::IterateWeakRootsForPhantomHandles(
-    WeakSlotCallbackWithHeap should_reset_handle) {
+    WeakSlotCallbackWithHeap should_reset_handle, bool use_background_threads) {
+  if (use_background_threads &&
+      regular_nodes_->blocks() >= 2 * kBlocksPerWeakNodeFilteringChunk) {
+    std::vector<NodeBlock<Node>*> blocks;
+    blocks.reserve(regular_nodes_->blocks());
+    for (NodeBlock<Node>* block = regular_nodes_->first_used_block();
+         block != nullptr; block = block->next_used()) {
+      blocks.push_back(block);
+    }
+    std::vector<std::vector<Node*>> dead_nodes_per_chunk(
+        (blocks.size() + kBlocksPerWeakNodeFilteringChunk - 1) /
+        kBlocksPerWeakNodeFilteringChunk);
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking,
+                    std::make_unique<WeakNodeFilteringJob>(
+                        isolate()->heap(), &blocks, should_reset_handle,
+                        &dead_nodes_per_chunk))
+        ->Join();
+    for (const std::vector<Node*>& dead_nodes : dead_nodes_per_chunk) {
+      for (Node* node : dead_nodes) ResetDeadWeakNode(node);
+    }
+    return;
+  }
   for (Node* node : *regular_nodes_) {
     if (node->IsWeakRetainer()) ResetWeakNodeIfDead(node, should_reset_handle);
   }
@@ -91,9 +91,12 @@ class V8_EXPORT_PRIVATE GlobalHandles final {
   void IterateAllYoungRoots(RootVisitor* v);
 
   // Marks handles that are phantom or have callbacks based on the predicate
-  // |should_reset_handle| as pending.
+  // |should_reset_handle| as pending. With |use_background_threads| the
+  // predicate is evaluated on GC helper threads, so it must only read
+  // marking state.
   void IterateWeakRootsForPhantomHandles(
-      WeakSlotCallbackWithHeap should_reset_handle);
+      WeakSlotCallbackWithHeap should_reset_handle,
+      bool use_background_threads = false);
 
   //  Note: The following *Young* methods are used for the Scavenger to
   //  identify and process handles in the young generation. The set of young
@@ -140,6 +143,7 @@ class V8_EXPORT_PRIVATE GlobalHandles final {
   template <class NodeType>
   class NodeSpace;
   class PendingPhantomCallback;
+  class WeakNodeFilteringJob;
 
   void ApplyPersistentHandleVisitor(v8::PersistentHandleVisitor* visitor,
                                     Node* node);
@@ -150,6 +154,8 @@ class V8_EXPORT_PRIVATE GlobalHandles final {
   // processing, and true in all other cases (e.g. also strong nodes).
   bool ResetWeakNodeIfDead(Node* node,
                            WeakSlotCallbackWithHeap should_reset_node);
+  // Clears a weak `node` that is known to be dead.
+  void ResetDeadWeakNode(Node* node);
 
   Isolate* const isolate_;
 
@@ -34,7 +34,7 @@ void AllocationCounter::AddAllocationObserver(AllocationObserver* observer) {
     DCHECK_EQ(current_counter_, next_counter_);
     next_counter_ = observer_next_counter;
   } else {
-    size_t missing_bytes = next_counter_ - current_counter_;
+    size_t missing_bytes = NextBytes();
     next_counter_ = current_counter_ +
                     std::min(static_cast<intptr_t>(missing_bytes), step_size);
   }
@@ -58,22 +58,32 @@ void AllocationCounter::RemoveAllocationObserver(AllocationObserver* observer) {
   if (observers_.empty()) {
     current_counter_ = next_counter_ = 0;
   } else {
-    size_t step_size = 0;
+    size_t step_size = SIZE_MAX;
 
     for (AllocationObserverCounter& observer_counter : observers_) {
-      size_t left_in_step = observer_counter.next_counter_ - current_counter_;
-      DCHECK_GT(left_in_step, 0);
-      step_size = step_size ? std::min(step_size, left_in_step) : left_in_step;
+      // Only lazy observers may be past their step.
+      DCHECK_IMPLIES(!observer_counter.observer_->IsLazy(),
+                     LeftInStep(observer_counter) > 0);
+      step_size = std::min(step_size, LeftInStep(observer_counter));
     }
 
     next_counter_ = current_counter_ + step_size;
   }
 }
 
+size_t AllocationCounter::NextPreciseBytes() const {
+  size_t result = SIZE_MAX;
+  for (const AllocationObserverCounter& aoc : observers_) {
+    if (aoc.observer_->IsLazy()) continue;
+    result = std::min(result, LeftInStep(aoc));
+  }
+  return result;
+}
+
 void AllocationCounter::AdvanceAllocationObservers(size_t allocated) {
   if (observers_.empty()) return;
   DCHECK(!step_in_progress_);
-  DCHECK_LT(allocated, next_counter_ - current_counter_);
+  DCHECK_LT(allocated, NextPreciseBytes());
   current_counter_ += allocated;
 }
 
@@ -82,7 +92,7 @@ void AllocationCounter::InvokeAllocationObservers(Address soon_object,
                                                   size_t aligned_object_size) {
   if (observers_.empty()) return;
   DCHECK(!step_in_progress_);
-  DCHECK_GE(aligned_object_size, next_counter_ - current_counter_);
+  DCHECK_GE(aligned_object_size, NextBytes());
   DCHECK(soon_object);
   bool step_run = false;
   step_in_progress_ = true;
@@ -92,7 +102,7 @@ void AllocationCounter::InvokeAllocationObservers(Address soon_object,
   DCHECK(pending_removed_.empty());
 
   for (AllocationObserverCounter& aoc : observers_) {
-    if (aoc.next_counter_ - current_counter_ <= aligned_object_size) {
+    if (aoc.next_counter_ <= current_counter_ + aligned_object_size) {
       {
         DisallowGarbageCollection no_gc;
         aoc.observer_->Step(
@@ -100,6 +110,13 @@ void AllocationCounter::InvokeAllocationObservers(Address soon_object,
             object_size);
       }
       size_t observer_step_size = aoc.observer_->GetNextStepSize();
+      if (aoc.next_counter_ < current_counter_) {
+        // A lazy observer missed its step; the bytes allocated since count
+        // towards the next one.
+        DCHECK(aoc.observer_->IsLazy());
+        observer_step_size -= std::min(observer_step_size,
+                                       current_counter_ - aoc.next_counter_);
+      }
 
       aoc.prev_counter_ = current_counter_;
       aoc.next_counter_ =
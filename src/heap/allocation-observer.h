@@ -44,6 +44,12 @@ class AllocationObserver {
     return step_size_;
   }
 
+  // Lazy observers don't limit the size of linear allocation areas. They are
+  // invoked for the first allocation on the allocation slow path after their
+  // step was reached instead. The bytes allocated in the meantime are taken
+  // off the following step, which keeps the average step size intact.
+  virtual bool IsLazy() const { return false; }
+
  private:
   const intptr_t step_size_;
 
@@ -74,9 +80,14 @@ class AllocationCounter final {
 
   size_t NextBytes() const {
     if (observers_.empty()) return SIZE_MAX;
-    return next_counter_ - current_counter_;
+    return next_counter_ > current_counter_ ? next_counter_ - current_counter_
+                                            : 0;
   }
 
+  // Like NextBytes() but ignores lazy observers. Linear allocation areas must
+  // not extend beyond this.
+  V8_EXPORT_PRIVATE size_t NextPreciseBytes() const;
+
 #if DEBUG
   bool HasAllocationObservers() const {
     return !observers_.empty() || !pending_added_.empty() ||
@@ -97,6 +108,12 @@ class AllocationCounter final {
     size_t next_counter_;
   };
 
+  size_t LeftInStep(const AllocationObserverCounter& aoc) const {
+    return aoc.next_counter_ > current_counter_
+               ? aoc.next_counter_ - current_counter_
+               : 0;
+  }
+
   std::vector<AllocationObserverCounter> observers_;
   std::vector<AllocationObserverCounter> pending_added_;
   std::unordered_set<AllocationObserver*> pending_removed_;
@@ -4,9 +4,12 @@
 
 #include "src/heap/code-range.h"
 
+#include <algorithm>
+
 #include "src/base/bits.h"
 #include "src/base/lazy-instance.h"
 #include "src/base/once.h"
+#include "src/base/platform/platform.h"
 #include "src/codegen/constants-arch.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
@@ -113,9 +116,16 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
   // not cross the 4Gb boundary and thus the default compression scheme of
   // truncating the InstructionStream pointers to 32-bits still works. It's
   // achieved by specifying base_alignment parameter.
-  const size_t base_alignment = V8_EXTERNAL_CODE_SPACE_BOOL
-                                    ? base::bits::RoundUpToPowerOfTwo(requested)
-                                    : kPageSize;
+  size_t base_alignment = V8_EXTERNAL_CODE_SPACE_BOOL
+                              ? base::bits::RoundUpToPowerOfTwo(requested)
+                              : kPageSize;
+  // The range's page allocator packs code pages tightly, so aligning the range
+  // to the huge page size lets neighbouring code pages fill whole huge pages.
+  size_t min_alignment = kPageSize;
+  if (base::OS::IsHugePagesSupported() && v8_flags.transparent_huge_pages) {
+    min_alignment = std::max(min_alignment, base::OS::kHugePageSize);
+    base_alignment = std::max(base_alignment, min_alignment);
+  }
 
   DCHECK_IMPLIES(kPlatformRequiresCodeRange,
                  requested <= kMaximalCodeRangeSize);
@@ -151,7 +161,7 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
   if (kShouldTryHarder) {
     // Relax alignment requirement while trying to allocate code range inside
     // preferred region.
-    params.base_alignment = kPageSize;
+    params.base_alignment = min_alignment;
 
     // TODO(v8:11880): consider using base::OS::GetFreeMemoryRangesWithin()
     // to avoid attempts that's going to fail anyway.
@@ -162,9 +172,9 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
     // towards the start in steps.
     const int kAllocationTries = 16;
     params.requested_start_hint =
-        RoundDown(preferred_region.end() - requested, kPageSize);
+        RoundDown(preferred_region.end() - requested, min_alignment);
     Address step =
-        RoundDown(preferred_region.size() / kAllocationTries, kPageSize);
+        RoundDown(preferred_region.size() / kAllocationTries, min_alignment);
     for (int i = 0; i < kAllocationTries; i++) {
       TRACE("=== Attempt #%d, hint=%p\n", i,
             reinterpret_cast<void*>(params.requested_start_hint));
@@ -416,6 +426,19 @@ uint8_t* CodeRange::RemapEmbeddedBuiltins(Isolate* isolate,
     }
   }
 
+  if constexpr (base::OS::IsRemapSharedCopySupported()) {
+    // If the builtins can't be remapped from the binary, e.g. because the
+    // sandbox doesn't allow opening it, map a copy of them that is shared by
+    // all code ranges in the process instead.
+    if (base::OS::RemapSharedCopy(embedded_blob_code, embedded_blob_code_size,
+                                  embedded_blob_code_copy,
+                                  base::OS::MemoryPermission::kReadExecute)) {
+      embedded_blob_code_copy_.store(embedded_blob_code_copy,
+                                     std::memory_order_release);
+      return embedded_blob_code_copy;
+    }
+  }
+
   if (V8_HEAP_USE_PTHREAD_JIT_WRITE_PROTECT) {
     if (!page_allocator()->RecommitPages(embedded_blob_code_copy, code_size,
                                          PageAllocator::kReadWriteExecute)) {
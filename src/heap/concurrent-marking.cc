@@ -31,6 +31,7 @@
 #include "src/heap/minor-mark-sweep-inl.h"
 #include "src/heap/minor-mark-sweep.h"
 #include "src/heap/object-lock.h"
+#include "src/heap/object-stats.h"
 #include "src/heap/objects-visiting-inl.h"
 #include "src/heap/objects-visiting.h"
 #include "src/heap/pretenuring-handler.h"
@@ -130,6 +131,9 @@ struct ConcurrentMarking::TaskState {
   size_t marked_bytes = 0;
   MemoryChunkDataMap memory_chunk_data;
   NativeContextStats native_context_stats;
+  // Allocated by the first marking task that runs with
+  // --track-gc-instance-type-stats.
+  std::unique_ptr<InstanceTypeStats> instance_type_stats;
   PretenuringHandler::PretenuringFeedbackMap local_pretenuring_feedback{
       PretenuringHandler::kInitialFeedbackCapacity};
 };
@@ -255,6 +259,80 @@ ConcurrentMarking::ConcurrentMarking(Heap* heap, WeakObjects* weak_objects)
 
 ConcurrentMarking::~ConcurrentMarking() = default;
 
+namespace {
+
+V8_INLINE void PrefetchForRead(Address address) {
+#if V8_CC_GNU
+  __builtin_prefetch(reinterpret_cast<const void*>(address), 0, 3);
+#endif  // V8_CC_GNU
+}
+
+// Pops objects from the marking worklist through a small ring buffer. Headers
+// of objects entering the ring are prefetched, and the map of the object at the
+// front of the ring is prefetched while the current object is being visited,
+// which hides part of the memory latency of walking a large heap.
+class PrefetchingWorklistPopper final {
+ public:
+  static constexpr size_t kMaxDistance = 16;
+
+  PrefetchingWorklistPopper(MarkingWorklists::Local* worklists,
+                            size_t distance, PtrComprCageBase cage_base)
+      : worklists_(worklists),
+        distance_(std::min(distance, kMaxDistance)),
+        cage_base_(cage_base) {}
+
+  ~PrefetchingWorklistPopper() { DCHECK_EQ(0, size_); }
+
+  bool Pop(Tagged<HeapObject>* object) {
+    if (distance_ == 0) return worklists_->Pop(object);
+    Refill();
+    if (size_ == 0) return false;
+    *object = ring_[head_];
+    head_ = (head_ + 1) % kMaxDistance;
+    size_--;
+    if (size_ > 0) PrefetchMap(ring_[head_]);
+    return true;
+  }
+
+  // Returns the objects that were taken from the worklist but not handed out
+  // yet.
+  void Flush() {
+    while (size_ > 0) {
+      worklists_->Push(ring_[head_]);
+      head_ = (head_ + 1) % kMaxDistance;
+      size_--;
+    }
+  }
+
+ private:
+  void Refill() {
+    while (size_ < distance_) {
+      Tagged<HeapObject> object;
+      if (!worklists_->Pop(&object)) return;
+      PrefetchForRead(object.address());
+      ring_[(head_ + size_) % kMaxDistance] = object;
+      size_++;
+    }
+  }
+
+  void PrefetchMap(Tagged<HeapObject> object) {
+    // Young objects may still be in a linear allocation area and thus not be
+    // initialized yet. The marker checks for that before loading the map, so
+    // don't speculatively load it here.
+    if (Heap::InYoungGeneration(object)) return;
+    PrefetchForRead(object->map(cage_base_, kAcquireLoad).address());
+  }
+
+  MarkingWorklists::Local* const worklists_;
+  const size_t distance_;
+  const PtrComprCageBase cage_base_;
+  Tagged<HeapObject> ring_[kMaxDistance];
+  size_t head_ = 0;
+  size_t size_ = 0;
+};
+
+}  // namespace
+
 void ConcurrentMarking::RunMajor(JobDelegate* delegate,
                                  base::EnumSet<CodeFlushMode> code_flush_mode,
                                  unsigned mark_compact_epoch,
@@ -275,6 +353,12 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
       heap_->tracer()->CodeFlushingIncrease(), &task_state->memory_chunk_data);
   NativeContextInferrer native_context_inferrer;
   NativeContextStats& native_context_stats = task_state->native_context_stats;
+  if (v8_flags.track_gc_instance_type_stats &&
+      !task_state->instance_type_stats) {
+    task_state->instance_type_stats = std::make_unique<InstanceTypeStats>();
+  }
+  InstanceTypeStats* const instance_type_stats =
+      task_state->instance_type_stats.get();
   double time_ms;
   size_t marked_bytes = 0;
   Isolate* isolate = heap_->isolate();
@@ -299,6 +383,14 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
     }
     PtrComprCageBase cage_base(isolate);
     bool is_per_context_mode = local_marking_worklists.IsPerContextMode();
+    // Objects in the ring were popped from the worklist of the context that
+    // was active at that time, so prefetching is off in per-context mode to
+    // keep the attribution of native context stats exact.
+    PrefetchingWorklistPopper popper(
+        &local_marking_worklists,
+        is_per_context_mode ? 0
+                            : v8_flags.concurrent_marking_prefetch_distance,
+        cage_base);
     bool done = false;
     CodePageHeaderModificationScope rwx_write_scope(
         "Marking a InstructionStream object requires write access to the "
@@ -309,7 +401,7 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
       while (current_marked_bytes < kBytesUntilInterruptCheck &&
              objects_processed < kObjectsUntilInterruptCheck) {
         Tagged<HeapObject> object;
-        if (!local_marking_worklists.Pop(&object)) {
+        if (!popper.Pop(&object)) {
           done = true;
           break;
         }
@@ -355,6 +447,9 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
             native_context_stats.IncrementSize(
                 local_marking_worklists.Context(), map, object, visited_size);
           }
+          if (instance_type_stats) {
+            instance_type_stats->Increment(map->instance_type(), visited_size);
+          }
           current_marked_bytes += visited_size;
         }
       }
@@ -377,6 +472,7 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
       }
     }
 
+    popper.Flush();
     local_marking_worklists.Publish();
     local_weak_objects.Publish();
     base::AsAtomicWord::Relaxed_Store<size_t>(&task_state->marked_bytes, 0);
@@ -727,6 +823,16 @@ void ConcurrentMarking::FlushNativeContexts(NativeContextStats* main_stats) {
   }
 }
 
+void ConcurrentMarking::FlushInstanceTypeStats(InstanceTypeStats* main_stats) {
+  DCHECK(!job_handle_ || !job_handle_->IsValid());
+  for (size_t i = 1; i < task_state_.size(); i++) {
+    InstanceTypeStats* stats = task_state_[i]->instance_type_stats.get();
+    if (!stats) continue;
+    main_stats->Merge(*stats);
+    stats->Clear();
+  }
+}
+
 void ConcurrentMarking::FlushMemoryChunkData() {
   DCHECK(!job_handle_ || !job_handle_->IsValid());
   for (size_t i = 1; i < task_state_.size(); i++) {
@@ -28,6 +28,7 @@ namespace v8 {
 namespace internal {
 
 class Heap;
+class InstanceTypeStats;
 class Isolate;
 class NonAtomicMarkingState;
 class MemoryChunk;
@@ -137,6 +138,8 @@ class V8_EXPORT_PRIVATE ConcurrentMarking {
       TaskPriority priority = TaskPriority::kUserVisible);
   // Flushes native context sizes to the given table of the main thread.
   void FlushNativeContexts(NativeContextStats* main_stats);
+  // Flushes instance type stats to the given table of the main thread.
+  void FlushInstanceTypeStats(InstanceTypeStats* main_stats);
   // Flushes memory chunk data.
   void FlushMemoryChunkData();
   // This function is called for a new space page that was cleared after
@@ -4,6 +4,8 @@
 
 #include "src/heap/conservative-stack-visitor.h"
 
+#include <algorithm>
+
 #include "src/execution/isolate-inl.h"
 #include "src/heap/basic-memory-chunk.h"
 #include "src/heap/marking-inl.h"
@@ -55,17 +57,33 @@ Address ConservativeStackVisitor::FindBasePtr(Address maybe_inner_ptr) const {
   // If it is in the young generation "from" semispace, it is not used and we
   // must ignore it, as its markbits may not be clean.
   if (page->IsFromPage()) return kNullAddress;
+  PtrComprCageBase cage_base{page->heap()->isolate()};
   // Try to find the address of a previous valid object on this page.
   Address base_ptr =
       MarkingBitmap::FindPreviousValidObject(page, maybe_inner_ptr);
+  // Objects found by earlier lookups either contain maybe_inner_ptr or give a
+  // closer starting point for the walk below.
+  auto it = object_ends_.upper_bound(maybe_inner_ptr);
+  if (it != object_ends_.begin()) {
+    --it;
+    const Address start = it->first;
+    const Address end = it->second;
+    if (start >= page->area_start()) {
+      if (maybe_inner_ptr < end) {
+        Tagged<HeapObject> obj(HeapObject::FromAddress(start));
+        return IsFreeSpaceOrFiller(obj, cage_base) ? kNullAddress : start;
+      }
+      base_ptr = std::max(base_ptr, end);
+    }
+  }
   // Iterate through the objects in the page forwards, until we find the object
   // containing maybe_inner_ptr.
   DCHECK_LE(base_ptr, maybe_inner_ptr);
-  PtrComprCageBase cage_base{page->heap()->isolate()};
   while (true) {
     Tagged<HeapObject> obj(HeapObject::FromAddress(base_ptr));
     const int size = obj->Size(cage_base);
     DCHECK_LT(0, size);
+    object_ends_.emplace(base_ptr, base_ptr + size);
     if (maybe_inner_ptr < base_ptr + size)
       return IsFreeSpaceOrFiller(obj, cage_base) ? kNullAddress : base_ptr;
     base_ptr += size;
@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_CONSERVATIVE_STACK_VISITOR_H_
 #define V8_HEAP_CONSERVATIVE_STACK_VISITOR_H_
 
+#include <map>
+
 #include "include/v8-internal.h"
 #include "src/common/globals.h"
 #include "src/heap/base/stack.h"
@@ -46,6 +48,10 @@ class V8_EXPORT_PRIVATE ConservativeStackVisitor
   RootVisitor* const delegate_;
   MemoryAllocator* const allocator_;
   const GarbageCollector collector_;
+  // Start and end addresses of the objects on regular pages walked over by
+  // FindBasePtr. Stacks typically hold many pointers into the same pages,
+  // which then only need to be walked once per stack scan.
+  mutable std::map<Address, Address> object_ends_;
 };
 
 }  // namespace internal
@@ -322,6 +322,20 @@ UnifiedHeapMarker::UnifiedHeapMarker(Heap* v8_heap,
       mutator_unified_heap_marking_state_, config.collection_type);
 }
 
+void CppHeap::PrintCollectionTotals() const {
+  auto print = [this](const char* name, CollectionType type) {
+    const auto& totals = stats_collector()->GetCollectionTotals(type);
+    const double time_ms = totals.main_thread_time.InMillisecondsF();
+    isolate_->PrintWithTimestamp(
+        "[CppHeap] %s GCs: %zu cycles, %.1f ms main thread, %zu KB freed "
+        "(%.1f KB/ms)\n",
+        name, totals.cycles, time_ms, totals.freed_object_bytes / KB,
+        time_ms > 0 ? totals.freed_object_bytes / KB / time_ms : 0.0);
+  };
+  print("Minor", CollectionType::kMinor);
+  print("Major", CollectionType::kMajor);
+}
+
 void CppHeap::MetricRecorderAdapter::AddMainThreadEvent(
     const GCCycle& cppgc_event) {
   auto* tracer = GetIsolate()->heap()->tracer();
@@ -334,6 +348,9 @@ void CppHeap::MetricRecorderAdapter::AddMainThreadEvent(
     last_full_gc_event_ = cppgc_event;
     tracer->NotifyFullCppGCCompleted();
   }
+  if (V8_UNLIKELY(v8_flags.trace_cppgc_collection_totals)) {
+    cpp_heap_.PrintCollectionTotals();
+  }
 }
 
 void CppHeap::MetricRecorderAdapter::AddMainThreadEvent(
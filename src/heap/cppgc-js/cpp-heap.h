@@ -202,6 +202,10 @@ class V8_EXPORT_PRIVATE CppHeap final
 
   void ReportBufferedAllocationSizeIfPossible();
 
+  // Prints the per-collection-type totals of the stats collector, used with
+  // --trace-cppgc-collection-totals.
+  void PrintCollectionTotals() const;
+
   void StartIncrementalGarbageCollectionForTesting() final;
   void FinalizeIncrementalGarbageCollectionForTesting(
       cppgc::EmbedderStackState) final;
@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_CPPGC_JS_CPP_MARKING_STATE_INL_H_
 #define V8_HEAP_CPPGC_JS_CPP_MARKING_STATE_INL_H_
 
+#include <algorithm>
+
 #include "src/heap/cppgc-js/cpp-marking-state.h"
 #include "src/heap/cppgc-js/wrappable-info-inl.h"
 #include "src/heap/cppgc-js/wrappable-info.h"
@@ -16,13 +18,20 @@ namespace internal {
 
 bool CppMarkingState::ExtractEmbedderDataSnapshot(
     Tagged<Map> map, Tagged<JSObject> object, EmbedderDataSnapshot& snapshot) {
-  if (JSObject::GetEmbedderFieldCount(map) < 2) return false;
+  const int min_field_count =
+      1 + std::max(wrapper_descriptor_.wrappable_type_index,
+                   wrapper_descriptor_.wrappable_instance_index);
+  if (JSObject::GetEmbedderFieldCount(map) < min_field_count) return false;
 
-  EmbedderDataSlot::PopulateEmbedderDataSnapshot(
-      map, object, wrapper_descriptor_.wrappable_type_index, snapshot.first);
   EmbedderDataSlot::PopulateEmbedderDataSnapshot(
       map, object, wrapper_descriptor_.wrappable_instance_index,
       snapshot.second);
+  if (wrapper_descriptor_.IsCompact()) {
+    snapshot.first = snapshot.second;
+  } else {
+    EmbedderDataSlot::PopulateEmbedderDataSnapshot(
+        map, object, wrapper_descriptor_.wrappable_type_index, snapshot.first);
+  }
   return true;
 }
 
@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_CPPGC_JS_WRAPPABLE_INFO_INL_H_
 #define V8_HEAP_CPPGC_JS_WRAPPABLE_INFO_INL_H_
 
+#include <algorithm>
+
 #include "src/base/optional.h"
 #include "src/heap/cppgc-js/wrappable-info.h"
 #include "src/objects/embedder-data-slot.h"
@@ -17,7 +19,10 @@ base::Optional<WrappableInfo> WrappableInfo::From(
     Isolate* isolate, Tagged<JSObject> wrapper,
     const WrapperDescriptor& wrapper_descriptor) {
   DCHECK(wrapper->MayHaveEmbedderFields());
-  return wrapper->GetEmbedderFieldCount() < 2
+  const int min_field_count =
+      1 + std::max(wrapper_descriptor.wrappable_type_index,
+                   wrapper_descriptor.wrappable_instance_index);
+  return wrapper->GetEmbedderFieldCount() < min_field_count
              ? base::Optional<WrappableInfo>()
              : From(isolate,
                     EmbedderDataSlot(wrapper,
@@ -34,6 +39,13 @@ base::Optional<WrappableInfo> WrappableInfo::From(
     const WrapperDescriptor& wrapper_descriptor) {
   void* type;
   void* instance;
+  if (wrapper_descriptor.IsCompact()) {
+    // Compact wrappers only store the instance; there is no type to check.
+    if (instance_slot.ToAlignedPointer(isolate, &instance) && instance) {
+      return base::Optional<WrappableInfo>(base::in_place, nullptr, instance);
+    }
+    return {};
+  }
   if (type_slot.ToAlignedPointer(isolate, &type) && type &&
       instance_slot.ToAlignedPointer(isolate, &instance) && instance &&
       (wrapper_descriptor.embedder_id_for_garbage_collected ==
@@ -269,6 +269,15 @@ void StatsCollector::NotifySweepingCompleted(SweepingType sweeping_type) {
   DCHECK_IMPLIES(
       previous_.sweeping_type == StatsCollector::SweepingType::kAtomic,
       previous_.scope_data[kIncrementalSweep].IsZero());
+  CollectionTotals& totals =
+      previous_.collection_type == CollectionType::kMajor ? major_totals_
+                                                          : minor_totals_;
+  totals.cycles++;
+  for (const v8::base::TimeDelta& scope_time : previous_.scope_data) {
+    totals.main_thread_time += scope_time;
+  }
+  totals.freed_object_bytes +=
+      previous_.object_size_before_sweep_bytes - marked_bytes_so_far_;
   if (metric_recorder_) {
     MetricRecorder::GCCycle event = GetCycleEventForMetricRecorder(
         previous_.collection_type, previous_.marking_type,
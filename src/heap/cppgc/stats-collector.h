@@ -122,6 +122,15 @@ class V8_EXPORT_PRIVATE StatsCollector final {
     size_t memory_size_before_sweep_bytes = -1;
   };
 
+  // Totals accumulated over all completed cycles of one collection type, e.g.
+  // to compare the cost and yield of minor and major GCs.
+  struct CollectionTotals final {
+    size_t cycles = 0;
+    // Main thread time spent in the histogram scopes.
+    v8::base::TimeDelta main_thread_time;
+    size_t freed_object_bytes = 0;
+  };
+
  private:
 #if defined(CPPGC_CASE)
   static_assert(false, "CPPGC_CASE macro is already defined");
@@ -312,6 +321,10 @@ class V8_EXPORT_PRIVATE StatsCollector final {
 
   const Event& GetPreviousEventForTesting() const { return previous_; }
 
+  const CollectionTotals& GetCollectionTotals(CollectionType type) const {
+    return type == CollectionType::kMajor ? major_totals_ : minor_totals_;
+  }
+
   void NotifyAllocatedMemory(int64_t);
   void NotifyFreedMemory(int64_t);
 
@@ -382,6 +395,9 @@ class V8_EXPORT_PRIVATE StatsCollector final {
   // The previous GC event which is populated at NotifySweepingFinished.
   Event previous_;
 
+  CollectionTotals major_totals_;
+  CollectionTotals minor_totals_;
+
   std::unique_ptr<MetricRecorder> metric_recorder_;
 
   // |platform_| is used by the TRACE_EVENT_* macros.
@@ -4223,6 +4223,7 @@ Handle<JSAtomicsMutex> Factory::NewJSAtomicsMutex() {
       NewJSObjectFromMap(map, AllocationType::kSharedOld));
   mutex->set_state(JSAtomicsMutex::kUnlocked);
   mutex->set_owner_thread_id(ThreadId::Invalid().ToInteger());
+  mutex->set_spin_count_estimate(0);
   return mutex;
 }
 
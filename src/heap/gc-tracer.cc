@@ -954,6 +954,7 @@ void GCTracer::PrintNVP() const {
           "clear.dependent_code=%.1f "
           "clear.maps=%.1f "
           "clear.slots_buffer=%.1f "
+          "clear.weak_cells=%.1f "
           "clear.weak_collections=%.1f "
           "clear.weak_lists=%.1f "
           "clear.weak_references=%.1f "
@@ -1043,6 +1044,7 @@ void GCTracer::PrintNVP() const {
           current_scope(Scope::MC_CLEAR_DEPENDENT_CODE),
           current_scope(Scope::MC_CLEAR_MAPS),
           current_scope(Scope::MC_CLEAR_SLOTS_BUFFER),
+          current_scope(Scope::MC_CLEAR_WEAK_CELLS),
           current_scope(Scope::MC_CLEAR_WEAK_COLLECTIONS),
           current_scope(Scope::MC_CLEAR_WEAK_LISTS),
           current_scope(Scope::MC_CLEAR_WEAK_REFERENCES),
@@ -1736,6 +1738,37 @@ void GCTracer::ReportYoungCycleToRecorder() {
       current_.scopes[Scope::MINOR_MARK_SWEEPER];
   event.main_thread_wall_clock_duration_in_us =
       main_thread_wall_clock_duration.InMicroseconds();
+  // MainThread phases:
+  v8::metrics::GarbageCollectionYoungPhases& phases = event.main_thread_phases;
+  if (current_.type == Event::Type::SCAVENGER) {
+    phases.roots_wall_clock_duration_in_us =
+        (current_.scopes[Scope::SCAVENGER_SCAVENGE_ROOTS] +
+         current_.scopes[Scope::SCAVENGER_SCAVENGE_STACK_ROOTS])
+            .InMicroseconds();
+    phases.copy_or_mark_wall_clock_duration_in_us =
+        current_.scopes[Scope::SCAVENGER_SCAVENGE_PARALLEL_PHASE]
+            .InMicroseconds();
+    phases.weak_wall_clock_duration_in_us =
+        (current_.scopes
+             [Scope::SCAVENGER_SCAVENGE_WEAK_GLOBAL_HANDLES_IDENTIFY] +
+         current_.scopes[Scope::SCAVENGER_SCAVENGE_WEAK_GLOBAL_HANDLES_PROCESS])
+            .InMicroseconds();
+    phases.update_references_wall_clock_duration_in_us =
+        current_.scopes[Scope::SCAVENGER_SCAVENGE_UPDATE_REFS]
+            .InMicroseconds();
+  } else {
+    phases.roots_wall_clock_duration_in_us =
+        current_.scopes[Scope::MINOR_MS_MARK_SEED].InMicroseconds();
+    // Seeding the roots is nested in the marking scope.
+    phases.copy_or_mark_wall_clock_duration_in_us =
+        (current_.scopes[Scope::MINOR_MS_MARK] -
+         current_.scopes[Scope::MINOR_MS_MARK_SEED])
+            .InMicroseconds();
+    phases.weak_wall_clock_duration_in_us =
+        current_.scopes[Scope::MINOR_MS_CLEAR].InMicroseconds();
+    phases.sweep_wall_clock_duration_in_us =
+        current_.scopes[Scope::MINOR_MS_SWEEP].InMicroseconds();
+  }
   // Collection Rate:
   if (current_.young_object_size == 0) {
     event.collection_rate_in_percent = 0;
@@ -367,7 +367,7 @@ void HeapVerification::VerifyPage(const BasicMemoryChunk* chunk) {
   CHECK(!current_chunk_.has_value());
   CHECK(!chunk->IsFlagSet(Page::PAGE_NEW_OLD_PROMOTION));
   CHECK(!chunk->IsFlagSet(Page::FROM_PAGE));
-  if (V8_SHARED_RO_HEAP_BOOL && chunk->InReadOnlySpace()) {
+  if (ReadOnlyHeap::IsReadOnlySpaceShared() && chunk->InReadOnlySpace()) {
     CHECK_NULL(chunk->owner());
   } else {
     CHECK_EQ(chunk->heap(), heap());
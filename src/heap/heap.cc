@@ -21,6 +21,7 @@
 #include "src/base/optional.h"
 #include "src/base/platform/memory.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/sys-info.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/builtins/accessors.h"
 #include "src/codegen/assembler-inl.h"
@@ -99,12 +100,15 @@
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/numbers/conversions.h"
+#include "src/objects/backing-store.h"
 #include "src/objects/data-handler.h"
+#include "src/objects/deoptimization-data.h"
 #include "src/objects/feedback-vector.h"
 #include "src/objects/free-space-inl.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/hash-table.h"
 #include "src/objects/instance-type.h"
+#include "src/objects/lookup-cache.h"
 #include "src/objects/maybe-object.h"
 #include "src/objects/objects.h"
 #include "src/objects/shared-function-info.h"
@@ -122,6 +126,7 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/zone/accounting-allocator.h"
 
 #ifdef V8_ENABLE_CONSERVATIVE_STACK_SCANNING
 #include "src/heap/conservative-stack-visitor.h"
@@ -707,6 +712,11 @@ void Heap::PrintShortHeapStatistics() {
   PrintIsolate(isolate_, "Pool buffering %zu chunks of committed: %6zu KB\n",
                memory_allocator()->pool()->NumberOfCommittedChunks(),
                CommittedMemoryOfPool() / KB);
+  PrintIsolate(isolate_,
+               "Large page pool buffering %d chunks of committed: %6zu KB\n",
+               memory_allocator()->large_page_pool()->NumberOfChunks(),
+               memory_allocator()->large_page_pool()->CommittedBufferedMemory() /
+                   KB);
   PrintIsolate(isolate_, "External memory reported: %6" PRId64 " KB\n",
                external_memory_.total() / KB);
   PrintIsolate(isolate_, "Backing store memory: %6" PRIu64 " KB\n",
@@ -1190,6 +1200,9 @@ void Heap::GarbageCollectionPrologue(
     minor_gc_job()->CancelTaskIfScheduled();
   }
 
+  // The cached key snapshots hold raw pointers to objects that may move.
+  isolate_->dictionary_keys_cache()->Clear();
+
   // Reset GC statistics.
   promoted_objects_size_ = 0;
   previous_new_space_surviving_object_size_ = new_space_surviving_object_size_;
@@ -1396,6 +1409,7 @@ void Heap::GarbageCollectionEpilogueInSafepoint(GarbageCollector collector) {
     // Discard pooled pages for scavenger if needed.
     if (ShouldReduceMemory()) {
       memory_allocator_->pool()->ReleasePooledChunks();
+      memory_allocator_->large_page_pool()->ReleasePooledChunks();
     }
   }
 
@@ -1891,6 +1905,11 @@ void Heap::CollectGarbage(AllocationSpace space,
     if (collector == GarbageCollector::MARK_COMPACTOR) {
       if (memory_reducer_ != nullptr) {
         memory_reducer_->NotifyMarkCompact(committed_memory_before);
+        // Keep the memory reducer going while the container is close to its
+        // limit, as the cgroup would OOM-kill us before V8 reaches its own.
+        if (container_memory_pressure_.load(std::memory_order_relaxed)) {
+          memory_reducer_->NotifyPossibleGarbage();
+        }
       }
       if (initial_max_old_generation_size_ < max_old_generation_size() &&
           OldGenerationSizeOfObjects() <
@@ -2562,7 +2581,26 @@ void Heap::EnsureSweepingCompletedForObject(Tagged<HeapObject> object) {
   sweeper()->EnsurePageIsSwept(page);
 }
 
+void Heap::UpdateContainerMemoryPressure() {
+  if (!v8_flags.container_memory_pressure) return;
+  const int64_t limit = base::SysInfo::AmountOfContainerMemoryLimit();
+  const int64_t usage = base::SysInfo::AmountOfContainerMemoryUsage();
+  const bool pressure =
+      limit > 0 &&
+      usage >= limit / 100 *
+                   v8_flags.container_memory_pressure_threshold_percent;
+  container_memory_pressure_.store(pressure, std::memory_order_relaxed);
+  if (v8_flags.trace_gc_verbose && pressure) {
+    isolate()->PrintWithTimestamp(
+        "Container memory pressure: usage=%" PRId64 "KB limit=%" PRId64
+        "KB\n",
+        usage / KB, limit / KB);
+  }
+}
+
 void Heap::RecomputeLimits(GarbageCollector collector, base::TimeTicks time) {
+  UpdateContainerMemoryPressure();
+
   if (!((collector == GarbageCollector::MARK_COMPACTOR) ||
         (HasLowYoungGenerationAllocationRate() &&
          old_generation_allocation_limit_configured()))) {
@@ -2728,6 +2766,7 @@ void Heap::MarkCompactEpilogue() {
 void Heap::MarkCompactPrologue() {
   TRACE_GC(tracer(), GCTracer::Scope::MC_PROLOGUE);
   isolate_->descriptor_lookup_cache()->Clear();
+  isolate_->uncompressed_frame_translation_cache()->Clear();
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
 
@@ -3799,7 +3838,9 @@ bool Heap::HasHighFragmentation() {
 bool Heap::ShouldOptimizeForMemoryUsage() {
   const size_t kOldGenerationSlack = max_old_generation_size() / 8;
   return v8_flags.optimize_for_size || isolate()->IsIsolateInBackground() ||
-         HighMemoryPressure() || !CanExpandOldGeneration(kOldGenerationSlack);
+         HighMemoryPressure() ||
+         container_memory_pressure_.load(std::memory_order_relaxed) ||
+         !CanExpandOldGeneration(kOldGenerationSlack);
 }
 
 class ActivateMemoryReducerTask : public CancelableTask {
@@ -3849,14 +3890,42 @@ Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpace() {
   static const size_t kLowAllocationThroughput = 1000;
   const double allocation_throughput =
       tracer_->CurrentAllocationThroughputInBytesPerMillisecond();
-  const bool should_shrink = !v8_flags.predictable &&
-                             (allocation_throughput != 0) &&
-                             (allocation_throughput < kLowAllocationThroughput);
+  bool should_shrink = !v8_flags.predictable &&
+                       (allocation_throughput != 0) &&
+                       (allocation_throughput < kLowAllocationThroughput);
 
-  const bool should_grow =
+  bool should_grow =
       (new_space_->TotalCapacity() < new_space_->MaximumCapacity()) &&
       (survived_since_last_expansion_ > new_space_->TotalCapacity());
 
+  if (v8_flags.predictive_new_space_sizing && !v8_flags.predictable) {
+    // Aim for no more than one scavenge per this interval at the predicted
+    // new space allocation throughput.
+    static constexpr double kTargetScavengeIntervalInMs = 100;
+    const size_t capacity = new_space_->TotalCapacity();
+    // Scavenges are currently more frequent than the target, so grow even if
+    // little survives.
+    const double current_throughput =
+        tracer_->NewSpaceAllocationThroughputInBytesPerMillisecond(
+            GCTracer::kThroughputTimeFrame);
+    if (capacity < new_space_->MaximumCapacity() &&
+        current_throughput * kTargetScavengeIntervalInMs > capacity) {
+      should_grow = true;
+    }
+    // An idle period doesn't predict the next burst. Only shrink if the
+    // halved new space would still meet the target at the throughput
+    // observed over the whole recorded history, and never while the embedder
+    // signals that a load is in progress.
+    if (should_shrink) {
+      const double predicted_throughput =
+          tracer_->NewSpaceAllocationThroughputInBytesPerMillisecond();
+      if (ShouldOptimizeForLoadTime() ||
+          predicted_throughput * kTargetScavengeIntervalInMs > capacity / 2) {
+        should_shrink = false;
+      }
+    }
+  }
+
   if (should_grow) survived_since_last_expansion_ = 0;
 
   if (should_grow == should_shrink) return ResizeNewSpaceMode::kNone;
@@ -4170,6 +4239,7 @@ void Heap::CheckMemoryPressure() {
   if (HighMemoryPressure()) {
     // The optimizing compiler may be unnecessarily holding on to memory.
     isolate()->AbortConcurrentOptimization(BlockingBehavior::kDontBlock);
+    isolate()->allocator()->ReleasePooledSegments();
   }
   // Reset the memory pressure level to avoid recursive GCs triggered by
   // CheckMemoryPressure from AdjustAmountOfExternalMemory called by
@@ -4179,6 +4249,7 @@ void Heap::CheckMemoryPressure() {
   if (memory_pressure_level == MemoryPressureLevel::kCritical) {
     TRACE_EVENT0("devtools.timeline,v8", "V8.CheckMemoryPressure");
     CollectGarbageOnMemoryPressure();
+    BackingStore::ReleasePooledMemory(isolate()->array_buffer_allocator());
   } else if (memory_pressure_level == MemoryPressureLevel::kModerate) {
     if (v8_flags.incremental_marking && incremental_marking()->IsStopped()) {
       TRACE_EVENT0("devtools.timeline,v8", "V8.CheckMemoryPressure");
@@ -6835,14 +6906,26 @@ size_t Heap::NumberOfTrackedHeapObjectTypes() {
 }
 
 size_t Heap::ObjectCountAtLastGC(size_t index) {
-  if (live_object_stats_ == nullptr || index >= ObjectStats::OBJECT_STATS_COUNT)
-    return 0;
+  if (live_object_stats_ == nullptr) {
+    // Fall back to the cheaper stats gathered during marking, which only
+    // cover the actual instance types.
+    const InstanceTypeStats* stats =
+        mark_compact_collector()->instance_type_stats_at_last_gc();
+    if (stats == nullptr || index >= InstanceTypeStats::kCount) return 0;
+    return stats->object_count(index);
+  }
+  if (index >= ObjectStats::OBJECT_STATS_COUNT) return 0;
   return live_object_stats_->object_count_last_gc(index);
 }
 
 size_t Heap::ObjectSizeAtLastGC(size_t index) {
-  if (live_object_stats_ == nullptr || index >= ObjectStats::OBJECT_STATS_COUNT)
-    return 0;
+  if (live_object_stats_ == nullptr) {
+    const InstanceTypeStats* stats =
+        mark_compact_collector()->instance_type_stats_at_last_gc();
+    if (stats == nullptr || index >= InstanceTypeStats::kCount) return 0;
+    return stats->object_size(index);
+  }
+  if (index >= ObjectStats::OBJECT_STATS_COUNT) return 0;
   return live_object_stats_->object_size_last_gc(index);
 }
 
@@ -6881,6 +6964,14 @@ size_t Heap::NumberOfNativeContexts() {
   return result;
 }
 
+size_t Heap::NumberOfMaps() {
+  return mark_compact_collector()->live_maps();
+}
+
+size_t Heap::NumberOfDeprecatedMaps() {
+  return mark_compact_collector()->live_deprecated_maps();
+}
+
 std::vector<Handle<NativeContext>> Heap::FindAllNativeContexts() {
   std::vector<Handle<NativeContext>> result;
   Tagged<Object> context = native_contexts_list();
@@ -1203,6 +1203,10 @@ class Heap final {
   // The total number of native contexts that were detached but were not
   // garbage collected yet.
   size_t NumberOfDetachedContexts();
+  // The number of maps, and of deprecated maps, that were live after the last
+  // full garbage collection.
+  size_t NumberOfMaps();
+  size_t NumberOfDeprecatedMaps();
 
   // ===========================================================================
   // Code statistics.
@@ -1948,6 +1952,9 @@ class Heap final {
 
   void RecomputeLimits(GarbageCollector collector, base::TimeTicks time);
 
+  // Samples the memory limit and usage of the control group of the process.
+  void UpdateContainerMemoryPressure();
+
   // ===========================================================================
   // GC Tasks. =================================================================
   // ===========================================================================
@@ -2102,6 +2109,10 @@ class Heap final {
   // and reset by a mark-compact garbage collection.
   std::atomic<v8::MemoryPressureLevel> memory_pressure_level_;
 
+  // Set after a GC when the control group of the process is close to its
+  // memory limit, see --container-memory-pressure.
+  std::atomic<bool> container_memory_pressure_{false};
+
   std::vector<std::pair<v8::NearHeapLimitCallback, void*>>
       near_heap_limit_callbacks_;
 
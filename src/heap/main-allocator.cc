@@ -146,9 +146,12 @@ void MainAllocator::InvokeAllocationObservers(Address soon_object,
     DCHECK_EQ(soon_object, allocation_info().start() + aligned_size_in_bytes -
                                size_in_bytes);
 
-    // Right now the LAB only contains that one object.
-    DCHECK_EQ(allocation_info().top() + allocation_size - aligned_size_in_bytes,
-              allocation_info().limit());
+    // Right now the LAB only contains that one object, unless only lazy
+    // observers reached their step.
+    DCHECK_IMPLIES(
+        allocation_size >= allocation_counter().NextPreciseBytes(),
+        allocation_info().top() + allocation_size - aligned_size_in_bytes ==
+            allocation_info().limit());
 
     // Ensure that there is a valid object
     space_heap()->CreateFillerObjectAt(soon_object,
@@ -171,7 +174,7 @@ void MainAllocator::InvokeAllocationObservers(Address soon_object,
   }
 
   DCHECK_LT(allocation_info().limit() - allocation_info().start(),
-            allocation_counter().NextBytes());
+            allocation_counter().NextPreciseBytes());
 }
 
 AllocationResult MainAllocator::AllocateRawSlow(int size_in_bytes,
@@ -356,13 +359,17 @@ Address MainAllocator::ComputeLimit(Address start, Address end,
     // Ensure there are no unaccounted allocations.
     DCHECK_EQ(allocation_info().start(), allocation_info().top());
 
-    size_t step = allocation_counter().NextBytes();
+    // Lazy observers are only invoked from the slow path and don't need to
+    // limit the LAB.
+    size_t step = allocation_counter().NextPreciseBytes();
     DCHECK_NE(step, 0);
-    // Generated code may allocate inline from the linear allocation area. To
-    // make sure we can observe these allocations, we use a lower limit.
-    size_t rounded_step = static_cast<size_t>(
-        RoundDown(static_cast<int>(step - 1), ObjectAlignment()));
-    step_size = std::min(step_size, rounded_step);
+    if (step != SIZE_MAX) {
+      // Generated code may allocate inline from the linear allocation area. To
+      // make sure we can observe these allocations, we use a lower limit.
+      size_t rounded_step = static_cast<size_t>(
+          RoundDown(static_cast<int>(step - 1), ObjectAlignment()));
+      step_size = std::min(step_size, rounded_step);
+    }
   }
 
   if (v8_flags.stress_marking) {
@@ -765,8 +772,16 @@ bool PagedSpaceAllocatorPolicy::TryAllocationFromFreeList(
   FreeLinearAllocationAreaUnsynchronized();
 
   size_t new_node_size = 0;
-  Tagged<FreeSpace> new_node =
-      space_->free_list_->Allocate(size_in_bytes, &new_node_size, origin);
+  Tagged<FreeSpace> new_node;
+  if (allocator_->identity() == SHARED_SPACE && !allocator_->in_gc() &&
+      size_in_bytes < kMinSharedSpaceLabSize) {
+    new_node = space_->free_list_->Allocate(kMinSharedSpaceLabSize,
+                                            &new_node_size, origin);
+  }
+  if (new_node.is_null()) {
+    new_node =
+        space_->free_list_->Allocate(size_in_bytes, &new_node_size, origin);
+  }
   if (new_node.is_null()) return false;
   DCHECK_GE(new_node_size, size_in_bytes);
 
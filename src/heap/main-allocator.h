@@ -75,6 +75,12 @@ class PagedSpaceAllocatorPolicy final : public AllocatorPolicy {
   void FreeLinearAllocationArea() final;
 
  private:
+  // All client isolates refill their shared space LABs from the same free list
+  // under the space mutex. Refilling with at least this many bytes when
+  // possible keeps the small allocations (e.g. shared strings) from taking
+  // that lock over and over.
+  static constexpr size_t kMinSharedSpaceLabSize = 4 * KB;
+
   bool RefillLab(int size_in_bytes, AllocationOrigin origin);
 
   void ContributeToSweeping(int max_pages);
@@ -374,6 +374,15 @@ void MarkCompactCollector::StartMarking() {
     }
   }
   heap_->tracer()->NotifyMarkingStart();
+  marked_maps_.store(0, std::memory_order_relaxed);
+  marked_deprecated_maps_.store(0, std::memory_order_relaxed);
+  if (v8_flags.track_gc_instance_type_stats) {
+    if (!instance_type_stats_) {
+      instance_type_stats_ = std::make_unique<InstanceTypeStats>();
+      instance_type_stats_at_last_gc_ = std::make_unique<InstanceTypeStats>();
+    }
+    instance_type_stats_->Clear();
+  }
   code_flush_mode_ = Heap::GetCodeFlushMode(heap_->isolate());
   marking_worklists_.CreateContextWorklists(contexts);
   auto* cpp_heap = CppHeap::From(heap_->cpp_heap_);
@@ -407,6 +416,13 @@ void MarkCompactCollector::CollectGarbage() {
   DCHECK(state_ == PREPARE_GC);
 
   MarkLiveObjects();
+  live_maps_ = marked_maps_.load(std::memory_order_relaxed);
+  live_deprecated_maps_ =
+      marked_deprecated_maps_.load(std::memory_order_relaxed);
+  if (instance_type_stats_) {
+    std::swap(instance_type_stats_, instance_type_stats_at_last_gc_);
+    instance_type_stats_->Clear();
+  }
   // This will walk dead object graphs and so requires that all references are
   // still intact.
   RecordObjectStats();
@@ -508,6 +524,19 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
     }
     *max_evacuated_bytes = kMaxEvacuatedBytes;
   }
+
+  if (v8_flags.compaction_time_budget_ms > 0) {
+    // Bound the evacuation work of the atomic pause. Pages that are not
+    // selected remain fragmented and become candidates again in later cycles.
+    const double estimated_compaction_speed =
+        heap_->tracer()->CompactionSpeedInBytesPerMillisecond();
+    if (estimated_compaction_speed != 0) {
+      const size_t budget_bytes = static_cast<size_t>(
+          estimated_compaction_speed * v8_flags.compaction_time_budget_ms);
+      *max_evacuated_bytes =
+          std::min(*max_evacuated_bytes, std::max(budget_bytes, area_size));
+    }
+  }
 }
 
 void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
@@ -706,6 +735,10 @@ void MarkCompactCollector::FinishConcurrentMarking() {
     heap_->concurrent_marking()->Join();
     heap_->concurrent_marking()->FlushMemoryChunkData();
     heap_->concurrent_marking()->FlushNativeContexts(&native_context_stats_);
+    if (instance_type_stats_) {
+      heap_->concurrent_marking()->FlushInstanceTypeStats(
+          instance_type_stats_.get());
+    }
   }
   if (auto* cpp_heap = CppHeap::From(heap_->cpp_heap_)) {
     cpp_heap->FinishConcurrentMarkingIfNeeded();
@@ -2060,14 +2093,94 @@ bool MarkCompactCollector::ProcessEphemerons() {
   return another_ephemeron_iteration;
 }
 
+namespace {
+
+using EphemeronKeyToValues =
+    std::unordered_multimap<Tagged<HeapObject>, Tagged<HeapObject>,
+                            Object::Hasher>;
+
+// Looks up the objects discovered in a round of the linear ephemeron
+// algorithm in its key-to-values index and marks the values of all ephemerons
+// whose key got discovered. Neither the index nor the discovered objects
+// change while the job runs, so tasks only need to claim disjoint chunks of
+// the discovered objects. Values are marked atomically and pushed onto
+// task-local marking worklists that are published to the main thread.
+class EphemeronKeyDiscoveryJob final : public v8::JobTask {
+ public:
+  EphemeronKeyDiscoveryJob(
+      Heap* heap, const EphemeronKeyToValues* key_to_values,
+      const std::vector<Tagged<HeapObject>>* discovered, size_t chunk_size,
+      size_t num_tasks)
+      : heap_(heap),
+        key_to_values_(key_to_values),
+        discovered_(discovered),
+        chunk_size_(chunk_size),
+        num_chunks_((discovered->size() + chunk_size - 1) / chunk_size),
+        num_tasks_(num_tasks) {}
+
+  EphemeronKeyDiscoveryJob(const EphemeronKeyDiscoveryJob&) = delete;
+  EphemeronKeyDiscoveryJob& operator=(const EphemeronKeyDiscoveryJob&) =
+      delete;
+
+  void Run(JobDelegate* delegate) override {
+    // In case multi-cage pointer compression mode is enabled ensure that
+    // current thread's cage base values are properly initialized.
+    PtrComprCageAccessScope ptr_compr_cage_access_scope(heap_->isolate());
+    MarkingWorklists::Local local_marking_worklists(
+        heap_->mark_compact_collector()->marking_worklists());
+    MarkingState* marking_state = heap_->marking_state();
+    while (!delegate->ShouldYield()) {
+      const size_t chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= num_chunks_) break;
+      const size_t start = chunk * chunk_size_;
+      const size_t end = std::min(start + chunk_size_, discovered_->size());
+      for (size_t i = start; i < end; ++i) {
+        auto range = key_to_values_->equal_range((*discovered_)[i]);
+        for (auto it = range.first; it != range.second; ++it) {
+          if (marking_state->TryMark(it->second)) {
+            local_marking_worklists.Push(it->second);
+          }
+        }
+      }
+    }
+    local_marking_worklists.Publish();
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    const size_t claimed = next_chunk_.load(std::memory_order_relaxed);
+    if (claimed >= num_chunks_) return 0;
+    return std::min(num_chunks_ - claimed, num_tasks_);
+  }
+
+ private:
+  Heap* const heap_;
+  const EphemeronKeyToValues* const key_to_values_;
+  const std::vector<Tagged<HeapObject>>* const discovered_;
+  const size_t chunk_size_;
+  const size_t num_chunks_;
+  const size_t num_tasks_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+}  // namespace
+
+int MarkCompactCollector::NumberOfParallelEphemeronVisitingTasks(
+    size_t elements) {
+  if (!parallel_marking_ || !UseBackgroundThreadsInCycle()) return 1;
+  // Retainers are recorded in a plain hash map on the heap.
+  if (V8_UNLIKELY(v8_flags.track_retaining_path)) return 1;
+  const size_t wanted_tasks = elements / kEphemeronChunkSize;
+  return static_cast<int>(std::min<size_t>(
+      wanted_tasks, static_cast<size_t>(NumberOfAvailableCores())));
+}
+
 void MarkCompactCollector::MarkTransitiveClosureLinear() {
   TRACE_GC(heap_->tracer(),
            GCTracer::Scope::MC_MARK_WEAK_CLOSURE_EPHEMERON_LINEAR);
-  // This phase doesn't support parallel marking.
+  // This phase doesn't support concurrent marking. Lookups of discovered
+  // keys may still be spread across a short-lived parallel job.
   DCHECK(heap_->concurrent_marking()->IsStopped());
-  std::unordered_multimap<Tagged<HeapObject>, Tagged<HeapObject>,
-                          Object::Hasher>
-      key_to_values;
+  EphemeronKeyToValues key_to_values;
   Ephemeron ephemeron;
 
   DCHECK(
@@ -2123,11 +2236,25 @@ void MarkCompactCollector::MarkTransitiveClosureLinear() {
       // This is the good case: newly_discovered stores all discovered
       // objects. Now use key_to_values to see if discovered objects keep more
       // objects alive due to ephemeron semantics.
-      for (Tagged<HeapObject> object : ephemeron_marking_.newly_discovered) {
-        auto range = key_to_values.equal_range(object);
-        for (auto it = range.first; it != range.second; ++it) {
-          Tagged<HeapObject> value = it->second;
-          MarkObject(object, value);
+      const int num_tasks = NumberOfParallelEphemeronVisitingTasks(
+          ephemeron_marking_.newly_discovered.size());
+      if (num_tasks > 1) {
+        V8::GetCurrentPlatform()
+            ->CreateJob(v8::TaskPriority::kUserBlocking,
+                        std::make_unique<EphemeronKeyDiscoveryJob>(
+                            heap_, &key_to_values,
+                            &ephemeron_marking_.newly_discovered,
+                            static_cast<size_t>(kEphemeronChunkSize),
+                            static_cast<size_t>(num_tasks)))
+            ->Join();
+      } else {
+        for (Tagged<HeapObject> object :
+             ephemeron_marking_.newly_discovered) {
+          auto range = key_to_values.equal_range(object);
+          for (auto it = range.first; it != range.second; ++it) {
+            Tagged<HeapObject> value = it->second;
+            MarkObject(object, value);
+          }
         }
       }
     }
@@ -2217,6 +2344,9 @@ std::pair<size_t, size_t> MarkCompactCollector::ProcessMarkingWorklist(
       native_context_stats_.IncrementSize(local_marking_worklists_->Context(),
                                           map, object, visited_size);
     }
+    if (instance_type_stats_) {
+      instance_type_stats_->Increment(map->instance_type(), visited_size);
+    }
     bytes_processed += visited_size;
     objects_processed++;
     static_assert(base::bits::IsPowerOfTwo(kDeadlineCheckInterval),
@@ -2337,6 +2467,12 @@ bool ShouldRetainMap(MarkingState* marking_state, Tagged<Map> map, int age) {
     // The map has aged. Do not retain this map.
     return false;
   }
+  if (map->is_deprecated()) {
+    // New objects never get a deprecated map and the transitions to it have
+    // been replaced, so retaining it only keeps garbage alive. Do not retain
+    // this map.
+    return false;
+  }
   Tagged<Object> constructor = map->GetConstructor();
   if (!IsHeapObject(constructor) ||
       (!InReadOnlySpace(HeapObject::cast(constructor)) &&
@@ -2772,6 +2908,36 @@ class ClearSharedStructTypeRegistryJobItem final
   Isolate* const isolate_;
 };
 
+// Number of ClearWeakCellsJobItems when clearing weak references in parallel.
+constexpr int kMaxWeakCellClearingTasks = 4;
+
+class ClearWeakCellsJobItem final : public ParallelClearingJob::ClearingItem {
+ public:
+  explicit ClearWeakCellsJobItem(MarkCompactCollector* collector)
+      : collector_(collector),
+        trace_id_(reinterpret_cast<uint64_t>(this) ^
+                  collector->heap()->tracer()->CurrentEpoch(
+                      GCTracer::Scope::MC_CLEAR_WEAK_CELLS)) {}
+
+  void Run(JobDelegate* delegate) final {
+    // In case multi-cage pointer compression mode is enabled ensure that
+    // current thread's cage base values are properly initialized.
+    PtrComprCageAccessScope ptr_compr_cage_access_scope(
+        collector_->heap()->isolate());
+
+    TRACE_GC1_WITH_FLOW(collector_->heap()->tracer(),
+                        GCTracer::Scope::MC_CLEAR_WEAK_CELLS,
+                        delegate->IsJoiningThread() ? ThreadKind::kMain
+                                                    : ThreadKind::kBackground,
+                        trace_id_, TRACE_EVENT_FLAG_FLOW_IN);
+    collector_->FilterWeakCells();
+  }
+
+ private:
+  MarkCompactCollector* const collector_;
+  const uint64_t trace_id_;
+};
+
 }  // namespace
 
 void MarkCompactCollector::ClearNonLiveReferences() {
@@ -2819,6 +2985,17 @@ void MarkCompactCollector::ClearNonLiveReferences() {
         std::make_unique<ClearSharedStructTypeRegistryJobItem>(isolate);
     clearing_job->Add(std::move(clear_shared_struct_type_registry_job_item));
   }
+  // WeakCells are filtered by several items at once, which all take cells from
+  // the shared worklist.
+  local_weak_objects()->weak_cells_local.Publish();
+  DCHECK(dead_weak_cells_.empty());
+  const int weak_cell_items =
+      v8_flags.parallel_weak_ref_clearing && UseBackgroundThreadsInCycle()
+          ? kMaxWeakCellClearingTasks
+          : 1;
+  for (int i = 0; i < weak_cell_items; i++) {
+    clearing_job->Add(std::make_unique<ClearWeakCellsJobItem>(this));
+  }
   auto clearing_job_handle = V8::GetCurrentPlatform()->CreateJob(
       TaskPriority::kUserBlocking, std::move(clearing_job));
   if (v8_flags.parallel_weak_ref_clearing && UseBackgroundThreadsInCycle()) {
@@ -2838,16 +3015,19 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     // We depend on `IterateWeakRootsForPhantomHandles()` being called before
     // `ProcessOldCodeCandidates()` in order to identify flushed bytecode in the
     // CPU profiler.
+    const bool use_background_threads =
+        v8_flags.parallel_weak_ref_clearing && UseBackgroundThreadsInCycle();
     isolate->global_handles()->IterateWeakRootsForPhantomHandles(
-        &IsUnmarkedHeapObject);
+        &IsUnmarkedHeapObject, use_background_threads);
     isolate->traced_handles()->ResetDeadNodes(&IsUnmarkedHeapObject);
 
     if (isolate->is_shared_space_isolate()) {
-      isolate->global_safepoint()->IterateClientIsolates([](Isolate* client) {
-        client->global_handles()->IterateWeakRootsForPhantomHandles(
-            &IsUnmarkedSharedHeapObject);
-        // No need to reset traced handles since they are always strong.
-      });
+      isolate->global_safepoint()->IterateClientIsolates(
+          [use_background_threads](Isolate* client) {
+            client->global_handles()->IterateWeakRootsForPhantomHandles(
+                &IsUnmarkedSharedHeapObject, use_background_threads);
+            // No need to reset traced handles since they are always strong.
+          });
     }
   }
 
@@ -2932,6 +3112,11 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     clearing_job_handle->Join();
   }
 
+  {
+    TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_CELLS);
+    ClearDeadWeakCells();
+  }
+
   DCHECK(weak_objects_.transition_arrays.IsEmpty());
   DCHECK(weak_objects_.weak_references.IsEmpty());
   DCHECK(weak_objects_.weak_objects_in_code.IsEmpty());
@@ -2995,6 +3180,10 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
     Tagged<SharedFunctionInfo> shared_info) {
   DCHECK(shared_info->HasBytecodeArray());
 
+  // Remember the flush so that the next bytecode of this function ages more
+  // slowly, see MarkingVisitorBase::BytecodeOldAge.
+  shared_info->set_bytecode_was_flushed(true);
+
   // Retain objects required for uncompiled data.
   Tagged<String> inferred_name = shared_info->inferred_name();
   int start_position = shared_info->StartPosition();
@@ -3518,8 +3707,41 @@ void MarkCompactCollector::ClearJSWeakRefs() {
       RecordSlot(weak_ref, slot, target);
     }
   }
+}
+
+void MarkCompactCollector::FilterWeakCells() {
+  WeakObjects::WeakObjectWorklist<Tagged<WeakCell>>::Local weak_cells(
+      weak_objects_.weak_cells);
+  std::vector<Tagged<WeakCell>> dead_weak_cells;
+  auto is_dead = [this](Tagged<HeapObject> object) {
+    return !InReadOnlySpace(object) &&
+           !non_atomic_marking_state_->IsMarked(object);
+  };
   Tagged<WeakCell> weak_cell;
-  while (local_weak_objects()->weak_cells_local.Pop(&weak_cell)) {
+  while (weak_cells.Pop(&weak_cell)) {
+    // Clearing a cell modifies its FinalizationRegistry, which other cells may
+    // share, so that is left to the main thread.
+    if (is_dead(HeapObject::cast(weak_cell->target())) ||
+        is_dead(weak_cell->unregister_token())) {
+      dead_weak_cells.push_back(weak_cell);
+      continue;
+    }
+    // The target and the unregister token are alive.
+    ObjectSlot slot = weak_cell->RawField(WeakCell::kTargetOffset);
+    RecordSlot(weak_cell, slot, HeapObject::cast(*slot));
+    slot = weak_cell->RawField(WeakCell::kUnregisterTokenOffset);
+    RecordSlot(weak_cell, slot, HeapObject::cast(*slot));
+  }
+  if (dead_weak_cells.empty()) return;
+  base::MutexGuard guard(&dead_weak_cells_mutex_);
+  dead_weak_cells_.insert(dead_weak_cells_.end(), dead_weak_cells.begin(),
+                          dead_weak_cells.end());
+}
+
+void MarkCompactCollector::ClearDeadWeakCells() {
+  DCHECK(weak_objects_.weak_cells.IsEmpty());
+  Isolate* const isolate = heap_->isolate();
+  for (Tagged<WeakCell> weak_cell : dead_weak_cells_) {
     auto gc_notify_updated_slot = [](Tagged<HeapObject> object, ObjectSlot slot,
                                      Tagged<Object> target) {
       if (IsHeapObject(target)) {
@@ -3570,6 +3792,7 @@ void MarkCompactCollector::ClearJSWeakRefs() {
       RecordSlot(weak_cell, slot, HeapObject::cast(*slot));
     }
   }
+  dead_weak_cells_.clear();
   heap_->PostFinalizationRegistryCleanupTaskIfNeeded();
 }
 
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_MARK_COMPACT_H_
 #define V8_HEAP_MARK_COMPACT_H_
 
+#include <atomic>
 #include <vector>
 
 #include "include/v8-internal.h"
@@ -23,6 +24,7 @@ namespace internal {
 
 // Forward declarations.
 class HeapObjectVisitor;
+class InstanceTypeStats;
 class LargeObjectSpace;
 class LargePage;
 class MainMarkingVisitor;
@@ -129,6 +131,26 @@ class MarkCompactCollector final {
 
   unsigned epoch() const { return epoch_; }
 
+  // Called by the main and concurrent marking visitors for every map.
+  void RecordMarkedMap(bool is_deprecated) {
+    marked_maps_.fetch_add(1, std::memory_order_relaxed);
+    if (is_deprecated) {
+      marked_deprecated_maps_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  // The number of maps, and of deprecated maps, found live by the last full
+  // GC. Maps allocated while it was marking are not included.
+  size_t live_maps() const { return live_maps_; }
+  size_t live_deprecated_maps() const { return live_deprecated_maps_; }
+
+  // Object counts and sizes by instance type found live by the last full GC,
+  // or nullptr if --track-gc-instance-type-stats is disabled. Like the map
+  // counts above, objects allocated while marking are not included.
+  const InstanceTypeStats* instance_type_stats_at_last_gc() const {
+    return instance_type_stats_at_last_gc_.get();
+  }
+
   base::EnumSet<CodeFlushMode> code_flush_mode() const {
     return code_flush_mode_;
   }
@@ -162,6 +184,11 @@ class MarkCompactCollector final {
     return use_background_threads_in_cycle_;
   }
 
+  // Goes through the list of encountered WeakCells and records the slots of
+  // those whose target and unregister token are both alive. The remaining
+  // cells are left for ClearDeadWeakCells. Runs on several threads at once.
+  void FilterWeakCells();
+
   Heap* heap() { return heap_; }
 
   explicit MarkCompactCollector(Heap* heap);
@@ -301,10 +328,14 @@ class MarkCompactCollector final {
   // transition.
   void ClearWeakReferences();
 
-  // Goes through the list of encountered JSWeakRefs and WeakCells and clears
-  // those with dead values.
+  // Goes through the list of encountered JSWeakRefs and clears those with dead
+  // values.
   void ClearJSWeakRefs();
 
+  // Clears the WeakCells with a dead target or unregister token that were left
+  // by FilterWeakCells, and schedules cleanup of their FinalizationRegistries.
+  void ClearDeadWeakCells();
+
   // Starts sweeping of spaces by contributing on the main thread and setting
   // up other pages for sweeping. Does not start sweeper tasks.
   void Sweep();
@@ -326,6 +357,8 @@ class MarkCompactCollector final {
 
   static const int kEphemeronChunkSize = 8 * KB;
 
+  // Returns the number of tasks used to look up |elements| newly discovered
+  // objects in the key-to-values index of the linear ephemeron algorithm.
   int NumberOfParallelEphemeronVisitingTasks(size_t elements);
 
   void RightTrimDescriptorArray(Tagged<DescriptorArray> array,
@@ -375,9 +408,22 @@ class MarkCompactCollector final {
   NativeContextInferrer native_context_inferrer_;
   NativeContextStats native_context_stats_;
 
+  std::atomic<size_t> marked_maps_{0};
+  std::atomic<size_t> marked_deprecated_maps_{0};
+  size_t live_maps_ = 0;
+  size_t live_deprecated_maps_ = 0;
+
+  // Allocated by the first marking cycle with --track-gc-instance-type-stats.
+  std::unique_ptr<InstanceTypeStats> instance_type_stats_;
+  std::unique_ptr<InstanceTypeStats> instance_type_stats_at_last_gc_;
+
   std::vector<GlobalHandleVector<DescriptorArray>> strong_descriptor_arrays_;
   base::Mutex strong_descriptor_arrays_mutex_;
 
+  // WeakCells found by FilterWeakCells to need clearing.
+  std::vector<Tagged<WeakCell>> dead_weak_cells_;
+  base::Mutex dead_weak_cells_mutex_;
+
   // Candidates for pages that should be evacuated.
   std::vector<Page*> evacuation_candidates_;
   // Pages that are actually processed during evacuation.
@@ -7,6 +7,7 @@
 
 #include "src/common/globals.h"
 #include "src/heap/ephemeron-remembered-set.h"
+#include "src/heap/mark-compact.h"
 #include "src/heap/marking-state-inl.h"
 #include "src/heap/marking-visitor.h"
 #include "src/heap/marking-worklist-inl.h"
@@ -361,10 +362,25 @@ bool MarkingVisitorBase<ConcreteVisitor>::IsOld(
     return isolate_in_background_ ||
            V8_UNLIKELY(sfi->age() == SharedFunctionInfo::kMaxAge);
   } else {
-    return sfi->age() >= v8_flags.bytecode_old_age;
+    return sfi->age() >= BytecodeOldAge(sfi);
   }
 }
 
+template <typename ConcreteVisitor>
+uint16_t MarkingVisitorBase<ConcreteVisitor>::BytecodeOldAge(
+    Tagged<SharedFunctionInfo> sfi) const {
+  int old_age = v8_flags.bytecode_old_age;
+  if (!v8_flags.adaptive_bytecode_flushing) return old_age;
+  // Functions which were needed again after their bytecode was flushed are
+  // likely to be needed again, so back off to avoid paying for the re-compile
+  // over and over.
+  if (sfi->bytecode_was_flushed()) old_age *= kFlushedBytecodeOldAgeFactor;
+  // GCs triggered by the memory reducer or by memory pressure notifications
+  // trade re-compiles for memory.
+  if (should_reduce_memory_) old_age = std::max(1, old_age / 2);
+  return old_age;
+}
+
 template <typename ConcreteVisitor>
 void MarkingVisitorBase<ConcreteVisitor>::MakeOlder(
     Tagged<SharedFunctionInfo> sfi) const {
@@ -388,11 +404,17 @@ void MarkingVisitorBase<ConcreteVisitor>::MakeOlder(
   } else if (v8_flags.flush_code_based_on_tab_visibility) {
     // No need to increment age.
   } else {
+    // Ages are capped at the largest old age any SFI can have rather than at
+    // this SFI's own, since the latter can change from one GC to the next.
+    const int max_age = v8_flags.adaptive_bytecode_flushing
+                            ? kFlushedBytecodeOldAgeFactor *
+                                  v8_flags.bytecode_old_age
+                            : v8_flags.bytecode_old_age;
     uint16_t age = sfi->age();
-    if (age < v8_flags.bytecode_old_age) {
+    if (age < max_age) {
       sfi->CompareExchangeAge(age, age + 1);
     }
-    DCHECK_LE(sfi->age(), v8_flags.bytecode_old_age);
+    DCHECK_LE(sfi->age(), max_age);
   }
 }
 
@@ -773,6 +795,14 @@ int MarkingVisitorBase<ConcreteVisitor>::VisitMap(Tagged<Map> meta_map,
   return size;
 }
 
+template <typename ConcreteVisitor>
+int FullMarkingVisitorBase<ConcreteVisitor>::VisitMap(Tagged<Map> meta_map,
+                                                      Tagged<Map> map) {
+  this->heap_->mark_compact_collector()->RecordMarkedMap(
+      map->is_deprecated());
+  return MarkingVisitorBase<ConcreteVisitor>::VisitMap(meta_map, map);
+}
+
 template <typename ConcreteVisitor>
 int MarkingVisitorBase<ConcreteVisitor>::VisitTransitionArray(
     Tagged<Map> map, Tagged<TransitionArray> array) {
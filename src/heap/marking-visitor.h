@@ -64,7 +64,8 @@ class MarkingVisitorBase : public ConcurrentHeapVisitor<int, ConcreteVisitor> {
         should_keep_ages_unchanged_(should_keep_ages_unchanged),
         should_mark_shared_heap_(heap->isolate()->is_shared_space_isolate()),
         code_flushing_increase_(code_flushing_increase),
-        isolate_in_background_(heap->isolate()->IsIsolateInBackground())
+        isolate_in_background_(heap->isolate()->IsIsolateInBackground()),
+        should_reduce_memory_(heap->ShouldReduceMemory())
 #ifdef V8_ENABLE_SANDBOX
         ,
         external_pointer_table_(&heap->isolate()->external_pointer_table()),
@@ -216,6 +217,11 @@ class MarkingVisitorBase : public ConcurrentHeapVisitor<int, ConcreteVisitor> {
   bool HasBytecodeArrayForFlushing(Tagged<SharedFunctionInfo> sfi) const;
   bool IsOld(Tagged<SharedFunctionInfo> sfi) const;
   void MakeOlder(Tagged<SharedFunctionInfo> sfi) const;
+  // The age at which |sfi|'s bytecode is flushed in age-based flushing.
+  uint16_t BytecodeOldAge(Tagged<SharedFunctionInfo> sfi) const;
+  // With --adaptive-bytecode-flushing, bytecode which was re-compiled after
+  // a flush is kept this many times longer.
+  static constexpr int kFlushedBytecodeOldAgeFactor = 2;
 
   MarkingWorklists::Local* const local_marking_worklists_;
   WeakObjects::Local* const local_weak_objects_;
@@ -227,6 +233,7 @@ class MarkingVisitorBase : public ConcurrentHeapVisitor<int, ConcreteVisitor> {
   const bool should_mark_shared_heap_;
   const uint16_t code_flushing_increase_;
   const bool isolate_in_background_;
+  const bool should_reduce_memory_;
 #ifdef V8_ENABLE_SANDBOX
   ExternalPointerTable* const external_pointer_table_;
   ExternalPointerTable* const shared_external_pointer_table_;
@@ -253,6 +260,8 @@ class FullMarkingVisitorBase : public MarkingVisitorBase<ConcreteVisitor> {
             mark_compact_epoch, code_flush_mode, trace_embedder_fields,
             should_keep_ages_unchanged, code_flushing_increase) {}
 
+  V8_INLINE int VisitMap(Tagged<Map> meta_map, Tagged<Map> map);
+
   V8_INLINE void AddStrongReferenceForReferenceSummarizer(
       Tagged<HeapObject> host, Tagged<HeapObject> obj) {}
 
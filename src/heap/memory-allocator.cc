@@ -7,6 +7,7 @@
 #include <cinttypes>
 
 #include "src/base/address-region.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -48,6 +49,7 @@ MemoryAllocator::MemoryAllocator(Isolate* isolate,
 
 void MemoryAllocator::TearDown() {
   pool()->ReleasePooledChunks();
+  large_page_pool()->ReleasePooledChunks();
 
   // Check that spaces were torn down before MemoryAllocator.
   DCHECK_EQ(size_, 0u);
@@ -92,6 +94,61 @@ size_t MemoryAllocator::Pool::CommittedBufferedMemory() const {
   return NumberOfCommittedChunks() * Page::kPageSize;
 }
 
+bool MemoryAllocator::LargePagePool::TryAdd(MemoryChunk* chunk) {
+  DCHECK_NOT_NULL(chunk);
+  DCHECK(chunk->IsLargePage());
+  DCHECK(chunk->IsFlagSet(MemoryChunk::PRE_FREED));
+  // Only data pages can be handed out again without changing permissions.
+  if (chunk->executable() == EXECUTABLE || chunk->IsTrusted()) return false;
+  VirtualMemory* reservation = chunk->reserved_memory();
+  if (!reservation->IsReserved()) return false;
+  const size_t size = reservation->size();
+  base::MutexGuard guard(&mutex_);
+  if (committed_ + size > v8_flags.large_page_pool_size * MB) return false;
+  chunk->ReleaseAllAllocatedMemory();
+  pooled_chunks_.emplace(size, chunk);
+  committed_ += size;
+  return true;
+}
+
+void* MemoryAllocator::LargePagePool::TryGetPooled(size_t chunk_size,
+                                                   size_t* pooled_size) {
+  base::MutexGuard guard(&mutex_);
+  auto it = pooled_chunks_.lower_bound(chunk_size);
+  if (it == pooled_chunks_.end()) return nullptr;
+  if (it->first - chunk_size > it->first / kMaxSlackFraction) return nullptr;
+  MemoryChunk* chunk = it->second;
+  *pooled_size = it->first;
+  committed_ -= it->first;
+  pooled_chunks_.erase(it);
+  return chunk;
+}
+
+void MemoryAllocator::LargePagePool::ReleasePooledChunks() {
+  std::multimap<size_t, MemoryChunk*> copied_pooled;
+  {
+    base::MutexGuard guard(&mutex_);
+    std::swap(copied_pooled, pooled_chunks_);
+    committed_ = 0;
+  }
+  for (auto& entry : copied_pooled) {
+    VirtualMemory* reservation = entry.second->reserved_memory();
+    DCHECK(reservation->IsReserved());
+    DCHECK_EQ(entry.first, reservation->size());
+    reservation->Free();
+  }
+}
+
+int MemoryAllocator::LargePagePool::NumberOfChunks() const {
+  base::MutexGuard guard(&mutex_);
+  return static_cast<int>(pooled_chunks_.size());
+}
+
+size_t MemoryAllocator::LargePagePool::CommittedBufferedMemory() const {
+  base::MutexGuard guard(&mutex_);
+  return committed_;
+}
+
 bool MemoryAllocator::CommitMemory(VirtualMemory* reservation,
                                    Executability executable) {
   Address base = reservation->address();
@@ -117,6 +174,20 @@ void MemoryAllocator::FreeMemoryRegion(v8::PageAllocator* page_allocator,
   FreePages(page_allocator, reinterpret_cast<void*>(base), size);
 }
 
+void MemoryAllocator::AdviseHugePages(Address base, size_t size,
+                                      AllocationSpace space) {
+  if constexpr (base::OS::IsHugePagesSupported()) {
+    if (!v8_flags.transparent_huge_pages) return;
+    if (space != OLD_SPACE && space != CODE_SPACE) return;
+    if (base::OS::AdviseHugePages(reinterpret_cast<void*>(base), size)) {
+      isolate_->counters()->huge_page_advised_kb()->Increment(
+          static_cast<int>(size / KB));
+    } else {
+      isolate_->counters()->huge_page_advice_failures()->Increment();
+    }
+  }
+}
+
 Address MemoryAllocator::AllocateAlignedMemory(
     size_t chunk_size, size_t area_size, size_t alignment,
     AllocationSpace space, Executability executable, void* hint,
@@ -143,6 +214,7 @@ Address MemoryAllocator::AllocateAlignedMemory(
   }
 
   Address base = reservation.address();
+  AdviseHugePages(base, chunk_size, space);
 
   if (executable == EXECUTABLE) {
     if (!SetPermissionsOnExecutableMemoryChunk(&reservation, base, area_size,
@@ -430,6 +502,11 @@ void MemoryAllocator::Free(MemoryAllocator::FreeMode mode, MemoryChunk* chunk) {
       queued_pages_to_be_freed_.push_back(chunk);
       break;
     case FreeMode::kPool:
+      if (chunk->IsLargePage()) {
+        PreFreeMemory(chunk);
+        if (!large_page_pool()->TryAdd(chunk)) PerformFreeMemory(chunk);
+        break;
+      }
       DCHECK_EQ(chunk->size(), static_cast<size_t>(MemoryChunk::kPageSize));
       DCHECK_EQ(chunk->executable(), NOT_EXECUTABLE);
       PreFreeMemory(chunk);
@@ -491,9 +568,15 @@ MemoryAllocator::RemapSharedPage(
 LargePage* MemoryAllocator::AllocateLargePage(LargeObjectSpace* space,
                                               size_t object_size,
                                               Executability executable) {
-  base::Optional<MemoryChunkAllocationResult> chunk_info =
-      AllocateUninitializedChunk(space, object_size, executable,
-                                 PageSize::kLarge);
+  base::Optional<MemoryChunkAllocationResult> chunk_info;
+  if (executable == NOT_EXECUTABLE && space->identity() != TRUSTED_LO_SPACE) {
+    chunk_info = AllocateUninitializedLargePageFromPool(space, object_size);
+  }
+
+  if (!chunk_info) {
+    chunk_info = AllocateUninitializedChunk(space, object_size, executable,
+                                            PageSize::kLarge);
+  }
 
   if (!chunk_info) return nullptr;
 
@@ -533,6 +616,39 @@ MemoryAllocator::AllocateUninitializedPageFromPool(Space* space) {
   };
 }
 
+base::Optional<MemoryAllocator::MemoryChunkAllocationResult>
+MemoryAllocator::AllocateUninitializedLargePageFromPool(LargeObjectSpace* space,
+                                                        size_t object_size) {
+  const size_t chunk_size =
+      ComputeChunkSize(object_size, space->identity(), NOT_EXECUTABLE);
+  size_t pooled_size = 0;
+  void* chunk = large_page_pool()->TryGetPooled(chunk_size, &pooled_size);
+  if (chunk == nullptr) {
+    isolate_->counters()->large_page_pool_misses()->Increment();
+    return {};
+  }
+  isolate_->counters()->large_page_pool_hits()->Increment();
+  DCHECK_GE(pooled_size, chunk_size);
+  const Address start = reinterpret_cast<Address>(chunk);
+  // Pooled large pages are always data pages.
+  VirtualMemory reservation(data_page_allocator(), start, pooled_size);
+  // Give the part of the chunk that the new page does not need back to the OS.
+  if (pooled_size > chunk_size) reservation.Release(start + chunk_size);
+  DCHECK_EQ(chunk_size, reservation.size());
+  if (heap::ShouldZapGarbage()) {
+    heap::ZapBlock(start, chunk_size, kZapValue);
+  }
+  const Address area_start =
+      start +
+      MemoryChunkLayout::ObjectStartOffsetInMemoryChunk(space->identity());
+  const Address area_end = area_start + object_size;
+
+  size_ += chunk_size;
+  return MemoryChunkAllocationResult{
+      chunk, chunk_size, area_start, area_end, std::move(reservation),
+  };
+}
+
 void MemoryAllocator::InitializeOncePerProcess() {
   commit_page_size_ = v8_flags.v8_os_page_size > 0
                           ? v8_flags.v8_os_page_size * KB
@@ -723,6 +839,8 @@ void MemoryAllocator::RecordLargePageDestroyed(const LargePage& page) {
 
 void MemoryAllocator::ReleaseQueuedPages() {
   for (auto* chunk : queued_pages_to_be_freed_) {
+    // Dead large pages are kept around for reuse if the pool has room.
+    if (chunk->IsLargePage() && large_page_pool()->TryAdd(chunk)) continue;
     PerformFreeMemory(chunk);
   }
   queued_pages_to_be_freed_.clear();
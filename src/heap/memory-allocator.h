@@ -6,6 +6,7 @@
 #define V8_HEAP_MEMORY_ALLOCATOR_H_
 
 #include <atomic>
+#include <map>
 #include <memory>
 #include <set>
 #include <unordered_set>
@@ -84,6 +85,40 @@ class MemoryAllocator {
     friend class MemoryAllocator;
   };
 
+  // LargePagePool keeps the memory of dead large data pages committed, so
+  // that large object allocations of a similar size can reuse it instead of
+  // mapping fresh memory. The pool is bounded by --large-page-pool-size.
+  class V8_EXPORT_PRIVATE LargePagePool {
+   public:
+    // A pooled chunk serves requests of up to 1/kMaxSlackFraction less than
+    // its own size. The unused tail is released when the chunk is reused.
+    static constexpr size_t kMaxSlackFraction = 4;
+
+    LargePagePool() = default;
+
+    LargePagePool(const LargePagePool&) = delete;
+    LargePagePool& operator=(const LargePagePool&) = delete;
+
+    // Returns false if the chunk cannot be pooled, in which case the caller
+    // remains responsible for freeing it.
+    bool TryAdd(MemoryChunk* chunk);
+
+    // Returns the start of a pooled chunk of at least |chunk_size| bytes and
+    // stores its size in |pooled_size|, or nullptr if there is none.
+    void* TryGetPooled(size_t chunk_size, size_t* pooled_size);
+
+    void ReleasePooledChunks();
+
+    int NumberOfChunks() const;
+    size_t CommittedBufferedMemory() const;
+
+   private:
+    // Pooled chunks, keyed by their reservation size.
+    std::multimap<size_t, MemoryChunk*> pooled_chunks_;
+    size_t committed_ = 0;
+    mutable base::Mutex mutex_;
+  };
+
   enum class AllocationMode {
     // Regular allocation path. Does not use pool.
     kRegular,
@@ -101,7 +136,8 @@ class MemoryAllocator {
     // dead memory.
     kPostpone,
 
-    // Pool page.
+    // Pool page. Large pages are only pooled if they fit into the large page
+    // pool and are freed immediately otherwise.
     kPool,
   };
 
@@ -232,11 +268,16 @@ class MemoryAllocator {
   }
 
   Pool* pool() { return &pool_; }
+  LargePagePool* large_page_pool() { return &large_page_pool_; }
 
   void UnregisterReadOnlyPage(ReadOnlyPage* page);
 
   Address HandleAllocationFailure(Executability executable);
 
+  // Under --transparent-huge-pages, advises the OS to back old and code space
+  // chunks with huge pages and records the outcome in the counters.
+  void AdviseHugePages(Address base, size_t size, AllocationSpace space);
+
 #if defined(V8_ENABLE_CONSERVATIVE_STACK_SCANNING) || defined(DEBUG)
   // Return the normal or large page that contains this address, if it is owned
   // by this heap, otherwise a nullptr.
@@ -322,6 +363,12 @@ class MemoryAllocator {
   base::Optional<MemoryChunkAllocationResult> AllocateUninitializedPageFromPool(
       Space* space);
 
+  // Tries to serve a large page allocation from the large page pool. Only
+  // supports NOT_EXECUTABLE pages outside of trusted space.
+  base::Optional<MemoryChunkAllocationResult>
+  AllocateUninitializedLargePageFromPool(LargeObjectSpace* space,
+                                         size_t object_size);
+
   // Initializes pages in a chunk. Returns the first page address.
   // This function and GetChunkId() are provided for the mark-compact
   // collector to rebuild page headers in the from space, which is
@@ -435,6 +482,7 @@ class MemoryAllocator {
 
   base::Optional<VirtualMemory> reserved_chunk_at_virtual_memory_limit_;
   Pool pool_;
+  LargePagePool large_page_pool_;
   std::vector<MemoryChunk*> queued_pages_to_be_freed_;
 
 #ifdef DEBUG
@@ -10,8 +10,10 @@
 #include "src/execution/isolate.h"
 #include "src/execution/vm-state-inl.h"
 #include "src/flags/flags.h"
+#include "src/heap/concurrent-marking.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
+#include "src/heap/incremental-marking.h"
 #include "src/init/v8.h"
 #include "src/tasks/cancelable-task.h"
 
@@ -61,7 +63,30 @@ void MinorGCJob::ScheduleTask() {
   }
 }
 
+bool MinorGCJob::TryDeferFinalization() {
+  // Give background markers a chance to finish the transitive closure so that
+  // the atomic pause only re-scans roots and sweeps. Allocation still forces
+  // the GC once new space is full, so deferring never grows the heap.
+  static constexpr double kFinalizationDelayInSeconds = 0.001;
+  if (!v8_flags.minor_ms_defer_finalization) return false;
+  if (!heap_->incremental_marking()->IsMinorMarking()) return false;
+  if (finalization_deferrals_ >= v8_flags.minor_ms_max_finalization_deferrals)
+    return false;
+  ConcurrentMarking* concurrent_marking = heap_->concurrent_marking();
+  if (concurrent_marking->IsStopped() || !concurrent_marking->IsWorkLeft())
+    return false;
+  std::shared_ptr<v8::TaskRunner> taskrunner = heap_->GetForegroundTaskRunner();
+  if (!taskrunner->NonNestableDelayedTasksEnabled()) return false;
+  finalization_deferrals_++;
+  std::unique_ptr<Task> task = std::make_unique<Task>(heap_->isolate(), this);
+  current_task_id_ = task->id();
+  taskrunner->PostNonNestableDelayedTask(std::move(task),
+                                         kFinalizationDelayInSeconds);
+  return true;
+}
+
 void MinorGCJob::CancelTaskIfScheduled() {
+  finalization_deferrals_ = 0;
   if (current_task_id_ == CancelableTaskManager::kInvalidTaskId) return;
   // The task may have ran and bailed out already if major incremental marking
   // was running, in which `TryAbort` will return `kTaskRemoved`.
@@ -83,6 +108,9 @@ void MinorGCJob::Task::RunInternal() {
     return;
   }
 
+  if (job_->TryDeferFinalization()) return;
+  job_->finalization_deferrals_ = 0;
+
   heap->CollectGarbage(NEW_SPACE, GarbageCollectionReason::kTask);
 }
 
@@ -31,9 +31,15 @@ class MinorGCJob {
 
   static bool YoungGenerationSizeTaskTriggerReached(Heap* heap);
 
+  // Re-posts the task with a short delay instead of finalizing concurrent
+  // young generation marking right away. Returns false if the task should
+  // finalize now.
+  bool TryDeferFinalization();
+
   Heap* const heap_;
   CancelableTaskManager::Id current_task_id_ =
       CancelableTaskManager::kInvalidTaskId;
+  unsigned finalization_deferrals_ = 0;
 };
 }  // namespace internal
 }  // namespace v8
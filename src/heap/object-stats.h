@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_OBJECT_STATS_H_
 #define V8_HEAP_OBJECT_STATS_H_
 
+#include <algorithm>
+
 #include "src/objects/code.h"
 #include "src/objects/objects.h"
 
@@ -173,6 +175,42 @@ class ObjectStats {
   friend class ObjectStatsCollectorImpl;
 };
 
+// Object counts and sizes by InstanceType, accumulated by the main and
+// concurrent marking visitors for the objects they visit. In contrast to
+// ObjectStats this requires no additional heap walk and no virtual type
+// classification, so it is cheap enough to be enabled in production.
+class InstanceTypeStats final {
+ public:
+  static constexpr int kCount = LAST_TYPE + 1;
+
+  InstanceTypeStats() { Clear(); }
+
+  void Increment(InstanceType type, size_t size) {
+    DCHECK_LT(type, kCount);
+    object_counts_[type]++;
+    object_sizes_[type] += size;
+  }
+
+  void Merge(const InstanceTypeStats& other) {
+    for (int i = 0; i < kCount; i++) {
+      object_counts_[i] += other.object_counts_[i];
+      object_sizes_[i] += other.object_sizes_[i];
+    }
+  }
+
+  void Clear() {
+    std::fill_n(object_counts_, kCount, 0);
+    std::fill_n(object_sizes_, kCount, 0);
+  }
+
+  size_t object_count(size_t index) const { return object_counts_[index]; }
+  size_t object_size(size_t index) const { return object_sizes_[index]; }
+
+ private:
+  size_t object_counts_[kCount];
+  size_t object_sizes_[kCount];
+};
+
 class ObjectStatsCollector {
  public:
   ObjectStatsCollector(Heap* heap, ObjectStats* live, ObjectStats* dead)
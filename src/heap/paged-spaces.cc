@@ -566,14 +566,23 @@ void PagedSpaceBase::RefillFreeList() {
   DCHECK_IMPLIES(identity() == NEW_SPACE, heap_->IsMainThread());
   DCHECK(!is_compaction_space());
 
-  for (Page* p : heap()->sweeper()->GetAllSweptPagesSafe(this)) {
+  Sweeper::SweptList swept_pages =
+      heap()->sweeper()->GetAllSweptPagesSafe(this);
+  if (swept_pages.empty()) return;
+
+  for (Page* p : swept_pages) {
     // We regularly sweep NEVER_ALLOCATE_ON_PAGE pages. We drop the freelist
     // entries here to make them unavailable for allocations.
     if (p->IsFlagSet(Page::NEVER_ALLOCATE_ON_PAGE)) {
       DropFreeListCategories(p, free_list());
     }
+  }
 
-    ConcurrentAllocationMutex guard(this);
+  // Publish the whole batch under a single acquisition of the space mutex so
+  // that background allocators contend on it once per refill rather than once
+  // per swept page.
+  ConcurrentAllocationMutex guard(this);
+  for (Page* p : swept_pages) {
     DCHECK_EQ(this, p->owner());
     RefineAllocatedBytesAfterSweeping(p);
     RelinkFreeListCategories(p);
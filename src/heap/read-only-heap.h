@@ -89,10 +89,13 @@ class ReadOnlyHeap {
 #endif
 
   // Returns whether the ReadOnlySpace will actually be shared taking into
-  // account whether shared memory is available with pointer compression.
-  static constexpr bool IsReadOnlySpaceShared() {
+  // account whether shared memory is available with pointer compression. With
+  // per-isolate cages, the read-only pages are shared by remapping them into
+  // each cage.
+  static bool IsReadOnlySpaceShared() {
     return V8_SHARED_RO_HEAP_BOOL &&
-           (!COMPRESS_POINTERS_BOOL || COMPRESS_POINTERS_IN_SHARED_CAGE_BOOL);
+           (!COMPRESS_POINTERS_IN_ISOLATE_CAGE_BOOL ||
+            IsSharedMemoryAvailable());
   }
 
   virtual void InitializeIsolateRoots(Isolate* isolate) {}
@@ -9,6 +9,7 @@
 #include "include/v8-internal.h"
 #include "include/v8-platform.h"
 #include "src/base/logging.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/common/ptr-compr-inl.h"
 #include "src/execution/isolate.h"
@@ -381,6 +382,18 @@ void ReadOnlySpace::Seal(SealMode ro_mode) {
   }
 
   SetPermissionsForPages(memory_allocator, PageAllocator::kRead);
+
+  if constexpr (base::OS::IsMergeablePagesSupported()) {
+    if (v8_flags.mergeable_read_only_heap) {
+      // The contents of read-only pages are identical across processes that
+      // deserialize the same snapshot (modulo the page headers), so let the
+      // OS share them instead of keeping a private copy per process.
+      for (BasicMemoryChunk* chunk : pages_) {
+        USE(base::OS::MarkPagesMergeable(
+            reinterpret_cast<void*>(chunk->address()), chunk->size()));
+      }
+    }
+  }
 }
 
 void ReadOnlySpace::Unseal() {
@@ -54,6 +54,11 @@ void Scavenger::PromotionList::Local::Publish() {
   large_object_promotion_list_local_.Publish();
 }
 
+bool Scavenger::PromotionList::Local::IsLocalEmpty() const {
+  return regular_object_promotion_list_local_.IsLocalEmpty() &&
+         large_object_promotion_list_local_.IsLocalEmpty();
+}
+
 bool Scavenger::PromotionList::Local::IsGlobalPoolEmpty() const {
   return regular_object_promotion_list_local_.IsGlobalEmpty() &&
          large_object_promotion_list_local_.IsGlobalEmpty();
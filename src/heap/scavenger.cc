@@ -773,7 +773,13 @@ void Scavenger::Process(JobDelegate* delegate) {
       scavenge_visitor.Visit(object_and_size.first);
       done = false;
       if (delegate && ((++objects % kInterruptThreshold) == 0)) {
+        // Local segments only become visible to other tasks once they are
+        // full. Publish them early when the global pool ran dry so that idle
+        // tasks can steal work instead of waiting for this task to finish.
         if (!copied_list_local_.IsLocalEmpty()) {
+          if (copied_list_local_.IsGlobalEmpty()) {
+            copied_list_local_.Publish();
+          }
           delegate->NotifyConcurrencyIncrease();
         }
       }
@@ -785,6 +791,10 @@ void Scavenger::Process(JobDelegate* delegate) {
       IterateAndScavengePromotedObject(target, entry.map, entry.size);
       done = false;
       if (delegate && ((++objects % kInterruptThreshold) == 0)) {
+        if (promotion_list_local_.IsGlobalPoolEmpty() &&
+            !promotion_list_local_.IsLocalEmpty()) {
+          promotion_list_local_.Publish();
+        }
         if (!promotion_list_local_.IsGlobalPoolEmpty()) {
           delegate->NotifyConcurrencyIncrease();
         }
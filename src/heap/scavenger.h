@@ -66,6 +66,7 @@ class Scavenger {
                                   int size);
       inline size_t LocalPushSegmentSize() const;
       inline bool Pop(struct PromotionListEntry* entry);
+      inline bool IsLocalEmpty() const;
       inline bool IsGlobalPoolEmpty() const;
       inline bool ShouldEagerlyProcessPromotionList() const;
       inline void Publish();
@@ -325,6 +325,9 @@ void Sweeper::SweepingState<scope>::FinishSweeping() {
   // Discard all pooled pages on memory-reducing GCs.
   if (should_reduce_memory_) {
     sweeper_->heap_->memory_allocator()->pool()->ReleasePooledChunks();
+    sweeper_->heap_->memory_allocator()
+        ->large_page_pool()
+        ->ReleasePooledChunks();
   }
 
   concurrent_sweepers_.clear();
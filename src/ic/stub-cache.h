@@ -85,10 +85,21 @@ class V8_EXPORT_PRIVATE StubCache {
   // the static_assert below, in {entry(...)}).
   static const int kCacheIndexShift = Name::HashBits::kShift;
 
+#ifdef V8_STUB_CACHE_PRIMARY_TABLE_BITS
+  static const int kPrimaryTableBits = V8_STUB_CACHE_PRIMARY_TABLE_BITS;
+#else
   static const int kPrimaryTableBits = 11;
+#endif
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
+#ifdef V8_STUB_CACHE_SECONDARY_TABLE_BITS
+  static const int kSecondaryTableBits = V8_STUB_CACHE_SECONDARY_TABLE_BITS;
+#else
   static const int kSecondaryTableBits = 9;
+#endif
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  // The scaled table offsets are computed in 32 bits.
+  static_assert(kPrimaryTableBits + kCacheIndexShift < 31);
+  static_assert(kSecondaryTableBits + kCacheIndexShift < 31);
 
   static int PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
   static int SecondaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
@@ -652,6 +652,7 @@
   F(MC_CLEAR_MAPS)                              \
   F(MC_CLEAR_SLOTS_BUFFER)                      \
   F(MC_CLEAR_STRING_TABLE)                      \
+  F(MC_CLEAR_WEAK_CELLS)                        \
   F(MC_CLEAR_WEAK_COLLECTIONS)                  \
   F(MC_CLEAR_WEAK_GLOBAL_HANDLES)               \
   F(MC_CLEAR_WEAK_LISTS)                        \
@@ -18,6 +18,7 @@
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/frames.h"
 #include "src/execution/isolate.h"
+#include "src/execution/shared-tiering-decisions.h"
 #include "src/execution/simulator.h"
 #include "src/init/bootstrapper.h"
 #include "src/libsampler/sampler.h"
@@ -301,6 +302,7 @@ void V8::Initialize() {
 void V8::Dispose() {
   AdvanceStartupState(V8StartupState::kV8Disposing);
   CHECK(platform_);
+  SharedTieringDecisions::StoreToFileIfNeeded();
 #if V8_ENABLE_WEBASSEMBLY
   wasm::WasmEngine::GlobalTearDown();
 #endif  // V8_ENABLE_WEBASSEMBLY
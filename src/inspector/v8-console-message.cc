@@ -292,10 +292,15 @@ V8ConsoleMessage::wrapArguments(V8InspectorSessionImpl* session,
       args = nullptr;
     }
   } else {
+    // Previews of all arguments share the session's budget. Once it is used
+    // up, the remaining arguments are only reported by object id.
+    int previewBudget = session->consolePreviewBudget();
+    int* budget = previewBudget >= 0 ? &previewBudget : nullptr;
     for (size_t i = 0; i < m_arguments.size(); ++i) {
       std::unique_ptr<protocol::Runtime::RemoteObject> wrapped =
           session->wrapObject(context, m_arguments[i]->Get(isolate), "console",
-                              generatePreview);
+                              generatePreview && (!budget || *budget > 0),
+                              budget);
       inspectedContext = inspector->getContext(contextGroupId, contextId);
       if (!inspectedContext) return nullptr;
       if (!wrapped) {
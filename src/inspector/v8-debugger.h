@@ -41,6 +41,9 @@ struct WrapSerializationOptions {
 struct WrapOptions {
   WrapMode mode;
   WrapSerializationOptions serializationOptions = {};
+  // Remaining number of properties that previews may generate, shared between
+  // all values wrapped for one protocol message. Unlimited if null.
+  int* previewBudget = nullptr;
 };
 
 using protocol::Response;
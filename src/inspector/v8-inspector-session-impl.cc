@@ -318,15 +318,16 @@ std::unique_ptr<protocol::Runtime::RemoteObject>
 V8InspectorSessionImpl::wrapObject(v8::Local<v8::Context> context,
                                    v8::Local<v8::Value> value,
                                    const String16& groupName,
-                                   bool generatePreview) {
+                                   bool generatePreview, int* previewBudget) {
   InjectedScript* injectedScript = nullptr;
   findInjectedScript(InspectedContext::contextId(context), injectedScript);
   if (!injectedScript) return nullptr;
   std::unique_ptr<protocol::Runtime::RemoteObject> result;
-  injectedScript->wrapObject(value, groupName,
-                             generatePreview ? WrapOptions({WrapMode::kPreview})
-                                             : WrapOptions({WrapMode::kIdOnly}),
-                             &result);
+  injectedScript->wrapObject(
+      value, groupName,
+      generatePreview ? WrapOptions({WrapMode::kPreview, {}, previewBudget})
+                      : WrapOptions({WrapMode::kIdOnly}),
+      &result);
   return result;
 }
 
@@ -500,6 +501,10 @@ void V8InspectorSessionImpl::triggerPreciseCoverageDeltaUpdate(
   m_profilerAgent->triggerPreciseCoverageDeltaUpdate(toString16(occasion));
 }
 
+void V8InspectorSessionImpl::setConsolePreviewBudget(int maxPreviewProperties) {
+  m_consolePreviewBudget = maxPreviewProperties;
+}
+
 V8InspectorSession::EvaluateResult V8InspectorSessionImpl::evaluate(
     v8::Local<v8::Context> context, StringView expression,
     bool includeCommandLineAPI) {
@@ -62,7 +62,7 @@ class V8InspectorSessionImpl : public V8InspectorSession,
   void setCustomObjectFormatterEnabled(bool);
   std::unique_ptr<protocol::Runtime::RemoteObject> wrapObject(
       v8::Local<v8::Context>, v8::Local<v8::Value>, const String16& groupName,
-      bool generatePreview);
+      bool generatePreview, int* previewBudget = nullptr);
   std::unique_ptr<protocol::Runtime::RemoteObject> wrapTable(
       v8::Local<v8::Context>, v8::Local<v8::Object> table,
       v8::MaybeLocal<v8::Array> columns);
@@ -100,6 +100,8 @@ class V8InspectorSessionImpl : public V8InspectorSession,
   static const unsigned kInspectedObjectBufferSize = 5;
 
   void triggerPreciseCoverageDeltaUpdate(StringView occasion) override;
+  void setConsolePreviewBudget(int maxPreviewProperties) override;
+  int consolePreviewBudget() const { return m_consolePreviewBudget; }
   EvaluateResult evaluate(v8::Local<v8::Context> context, StringView expression,
                           bool includeCommandLineAPI = false) override;
   void stop() override;
@@ -144,6 +146,7 @@ class V8InspectorSessionImpl : public V8InspectorSession,
   std::vector<std::unique_ptr<V8InspectorSession::Inspectable>>
       m_inspectedObjects;
   bool use_binary_protocol_ = false;
+  int m_consolePreviewBudget = -1;
   V8Inspector::ClientTrustLevel m_clientTrustLevel = V8Inspector::kUntrusted;
 };
 
@@ -1157,8 +1157,18 @@ class ObjectMirror final : public ValueMirrorBase {
         std::unique_ptr<ObjectPreview> previewValue;
         int nameLimit = 5;
         int indexLimit = 100;
+        int* budget = wrapOptions.previewBudget;
+        if (budget) {
+          nameLimit = std::min(nameLimit, *budget);
+          indexLimit = std::min(indexLimit, *budget);
+        }
+        const int initialLimit = nameLimit + indexLimit;
         buildObjectPreview(context, false, &nameLimit, &indexLimit,
                            &previewValue);
+        if (budget) {
+          *budget = std::max(0, *budget - (initialLimit - nameLimit -
+                                           indexLimit));
+        }
         (*result)->setPreview(std::move(previewValue));
       }
     }
@@ -978,7 +978,10 @@ class BytecodeGenerator::FeedbackSlotCache : public ZoneObject {
     kStoreGlobalStrict,
     kSetNamedStrict,
     kSetNamedSloppy,
+    kSetNamedThisStrict,
+    kSetNamedThisSloppy,
     kLoadProperty,
+    kLoadThisProperty,
     kLoadSuperProperty,
     kLoadGlobalNotInsideTypeof,
     kLoadGlobalInsideTypeof,
@@ -7922,19 +7925,26 @@ FeedbackSlot BytecodeGenerator::GetCachedLoadICSlot(const Expression* expr,
   if (!v8_flags.ignition_share_named_property_feedback) {
     return feedback_spec()->AddLoadICSlot();
   }
-  FeedbackSlotCache::SlotKind slot_kind =
-      FeedbackSlotCache::SlotKind::kLoadProperty;
-  if (!expr->IsVariableProxy()) {
+  FeedbackSlotCache::SlotKind slot_kind;
+  int receiver_index;
+  if (expr->IsVariableProxy()) {
+    slot_kind = FeedbackSlotCache::SlotKind::kLoadProperty;
+    receiver_index = expr->AsVariableProxy()->var()->index();
+  } else if (expr->IsThisExpression()) {
+    // The receiver is the same for the whole function, so repeated loads of
+    // this.name (common in methods) can share a slot as well.
+    slot_kind = FeedbackSlotCache::SlotKind::kLoadThisProperty;
+    receiver_index = 0;
+  } else {
     return feedback_spec()->AddLoadICSlot();
   }
-  const VariableProxy* proxy = expr->AsVariableProxy();
   FeedbackSlot slot(
-      feedback_slot_cache()->Get(slot_kind, proxy->var()->index(), name));
+      feedback_slot_cache()->Get(slot_kind, receiver_index, name));
   if (!slot.IsInvalid()) {
     return slot;
   }
   slot = feedback_spec()->AddLoadICSlot();
-  feedback_slot_cache()->Put(slot_kind, proxy->var()->index(), name,
+  feedback_slot_cache()->Put(slot_kind, receiver_index, name,
                              feedback_index(slot));
   return slot;
 }
@@ -7961,20 +7971,28 @@ FeedbackSlot BytecodeGenerator::GetCachedStoreICSlot(const Expression* expr,
   if (!v8_flags.ignition_share_named_property_feedback) {
     return feedback_spec()->AddStoreICSlot(language_mode());
   }
-  FeedbackSlotCache::SlotKind slot_kind =
-      is_strict(language_mode()) ? FeedbackSlotCache::SlotKind::kSetNamedStrict
-                                 : FeedbackSlotCache::SlotKind::kSetNamedSloppy;
-  if (!expr->IsVariableProxy()) {
+  FeedbackSlotCache::SlotKind slot_kind;
+  int receiver_index;
+  if (expr->IsVariableProxy()) {
+    slot_kind = is_strict(language_mode())
+                    ? FeedbackSlotCache::SlotKind::kSetNamedStrict
+                    : FeedbackSlotCache::SlotKind::kSetNamedSloppy;
+    receiver_index = expr->AsVariableProxy()->var()->index();
+  } else if (expr->IsThisExpression()) {
+    slot_kind = is_strict(language_mode())
+                    ? FeedbackSlotCache::SlotKind::kSetNamedThisStrict
+                    : FeedbackSlotCache::SlotKind::kSetNamedThisSloppy;
+    receiver_index = 0;
+  } else {
     return feedback_spec()->AddStoreICSlot(language_mode());
   }
-  const VariableProxy* proxy = expr->AsVariableProxy();
   FeedbackSlot slot(
-      feedback_slot_cache()->Get(slot_kind, proxy->var()->index(), name));
+      feedback_slot_cache()->Get(slot_kind, receiver_index, name));
   if (!slot.IsInvalid()) {
     return slot;
   }
   slot = feedback_spec()->AddStoreICSlot(language_mode());
-  feedback_slot_cache()->Put(slot_kind, proxy->var()->index(), name,
+  feedback_slot_cache()->Put(slot_kind, receiver_index, name,
                              feedback_index(slot));
   return slot;
 }
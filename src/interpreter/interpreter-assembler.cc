@@ -1265,6 +1265,54 @@ void InterpreterAssembler::InlineShortStar(TNode<WordT> target_bytecode) {
   implicit_register_use_ = previous_acc_use;
 }
 
+void InterpreterAssembler::JumpIfDispatchLookahead(
+    TNode<WordT> target_bytecode) {
+  Label do_inline_jump_if_true(this), do_inline_jump_if_false(this),
+      done(this);
+
+  // Tests and the conditional jumps consuming their result usually come in
+  // pairs, so fuse the dispatch of the jump into the test's handler.
+  TNode<Int32T> target = TruncateWordToInt32(target_bytecode);
+  GotoIf(Word32Equal(target,
+                     Int32Constant(static_cast<int>(Bytecode::kJumpIfFalse))),
+         &do_inline_jump_if_false);
+  Branch(Word32Equal(target,
+                     Int32Constant(static_cast<int>(Bytecode::kJumpIfTrue))),
+         &do_inline_jump_if_true, &done);
+
+  BIND(&do_inline_jump_if_false);
+  InlineJumpIf(false);
+
+  BIND(&do_inline_jump_if_true);
+  InlineJumpIf(true);
+
+  BIND(&done);
+}
+
+void InterpreterAssembler::InlineJumpIf(bool jump_if_true) {
+  Bytecode previous_bytecode = bytecode_;
+  ImplicitRegisterUse previous_acc_use = implicit_register_use_;
+
+  bytecode_ = jump_if_true ? Bytecode::kJumpIfTrue : Bytecode::kJumpIfFalse;
+  implicit_register_use_ = ImplicitRegisterUse::kNone;
+
+#ifdef V8_TRACE_UNOPTIMIZED
+  TraceBytecode(Runtime::kTraceUnoptimizedBytecodeEntry);
+#endif
+
+  TNode<Object> accumulator = GetAccumulator();
+  CSA_DCHECK(this, IsBoolean(CAST(accumulator)));
+  TNode<Object> expected = jump_if_true ? TNode<Object>(TrueConstant())
+                                        : TNode<Object>(FalseConstant());
+  JumpIfTaggedEqual(accumulator, expected, 0);
+
+  DCHECK_EQ(implicit_register_use_,
+            Bytecodes::GetImplicitRegisterUse(bytecode_));
+
+  bytecode_ = previous_bytecode;
+  implicit_register_use_ = previous_acc_use;
+}
+
 void InterpreterAssembler::Dispatch() {
   Comment("========= Dispatch");
   DCHECK_IMPLIES(Bytecodes::MakesCallAlongCriticalPath(bytecode_), made_call_);
@@ -1277,6 +1325,8 @@ void InterpreterAssembler::DispatchToBytecodeWithOptionalStarLookahead(
     TNode<WordT> target_bytecode) {
   if (Bytecodes::IsStarLookahead(bytecode_, operand_scale_)) {
     StarDispatchLookahead(target_bytecode);
+  } else if (Bytecodes::IsJumpIfLookahead(bytecode_, operand_scale_)) {
+    JumpIfDispatchLookahead(target_bytecode);
   }
   DispatchToBytecode(target_bytecode, BytecodeOffset());
 }
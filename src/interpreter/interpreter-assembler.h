@@ -449,6 +449,15 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // the next dispatch offset.
   void InlineShortStar(TNode<WordT> target_bytecode);
 
+  // Look ahead for JumpIfTrue or JumpIfFalse with a single-byte operand and
+  // inline it in a branch, including subsequent dispatch. Anything after this
+  // point can assume that the following instruction was neither of them.
+  void JumpIfDispatchLookahead(TNode<WordT> target_bytecode);
+
+  // Build code for the JumpIfTrue (or JumpIfFalse, if |jump_if_true| is false)
+  // at the current BytecodeOffset(), including the dispatch to its successor.
+  void InlineJumpIf(bool jump_if_true);
+
   // Dispatch to the bytecode handler with code entry point |handler_entry|.
   void DispatchToBytecodeHandlerEntry(TNode<RawPtrT> handler_entry,
                                       TNode<IntPtrT> bytecode_offset);
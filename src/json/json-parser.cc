@@ -4,6 +4,8 @@
 
 #include "src/json/json-parser.h"
 
+#include <utility>
+
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
@@ -18,10 +20,22 @@
 #include "src/objects/map-updater.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/property-descriptor.h"
+#include "src/objects/transitions-inl.h"
 #include "src/roots/roots.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
 
+#if (defined(__SSE2__) || \
+     (defined(_MSC_VER) && \
+      (defined(_M_X64) || (defined(_M_IX86) && _M_IX86_FP >= 2))))
+#define V8_JSON_PARSER_USE_SSE2 1
+#include <emmintrin.h>
+#elif defined(V8_HOST_ARCH_ARM64)
+// Note that ARM64 is guaranteed to have Neon.
+#define V8_JSON_PARSER_USE_NEON 1
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -122,6 +136,84 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// Skips over all complete 16-byte blocks starting at |cursor| that contain no
+// character which may terminate a JSON string, i.e. no '"', no '\\' and no
+// control character, and returns the start of the first block that does (or of
+// the incomplete block at the end of the input). The exact position of the
+// terminating character is then found by the scalar loop in ScanJsonString.
+// For two-byte input, |bits| is updated such that it exceeds
+// unibrow::Latin1::kMaxChar iff any of the skipped characters does.
+template <typename Char>
+V8_INLINE const Char* SkipPlainJsonStringCharacters(const Char* cursor,
+                                                    const Char* end,
+                                                    base::uc32* bits) {
+#if defined(V8_JSON_PARSER_USE_SSE2)
+  constexpr int kStride = sizeof(__m128i) / sizeof(Char);
+  if constexpr (sizeof(Char) == 1) {
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i max_control = _mm_set1_epi8(0x1F);
+    const __m128i zero = _mm_setzero_si128();
+    for (; end - cursor >= kStride; cursor += kStride) {
+      __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+      __m128i special = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(chars, quote),
+                       _mm_cmpeq_epi8(chars, backslash)),
+          _mm_cmpeq_epi8(_mm_subs_epu8(chars, max_control), zero));
+      if (_mm_movemask_epi8(special) != 0) break;
+    }
+  } else {
+    const __m128i quote = _mm_set1_epi16('"');
+    const __m128i backslash = _mm_set1_epi16('\\');
+    const __m128i max_control = _mm_set1_epi16(0x1F);
+    const __m128i zero = _mm_setzero_si128();
+    __m128i seen = zero;
+    for (; end - cursor >= kStride; cursor += kStride) {
+      __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+      __m128i special = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi16(chars, quote),
+                       _mm_cmpeq_epi16(chars, backslash)),
+          _mm_cmpeq_epi16(_mm_subs_epu16(chars, max_control), zero));
+      if (_mm_movemask_epi8(special) != 0) break;
+      seen = _mm_or_si128(seen, chars);
+    }
+    seen = _mm_or_si128(seen, _mm_srli_si128(seen, 8));
+    seen = _mm_or_si128(seen, _mm_srli_si128(seen, 4));
+    seen = _mm_or_si128(seen, _mm_srli_si128(seen, 2));
+    *bits |= static_cast<base::uc32>(_mm_cvtsi128_si32(seen)) & 0xFF00;
+  }
+#elif defined(V8_JSON_PARSER_USE_NEON)
+  constexpr int kStride = sizeof(uint8x16_t) / sizeof(Char);
+  if constexpr (sizeof(Char) == 1) {
+    const uint8x16_t quote = vdupq_n_u8('"');
+    const uint8x16_t backslash = vdupq_n_u8('\\');
+    const uint8x16_t min_plain = vdupq_n_u8(0x20);
+    for (; end - cursor >= kStride; cursor += kStride) {
+      uint8x16_t chars = vld1q_u8(cursor);
+      uint8x16_t special =
+          vorrq_u8(vorrq_u8(vceqq_u8(chars, quote), vceqq_u8(chars, backslash)),
+                   vcltq_u8(chars, min_plain));
+      if (vmaxvq_u8(special) != 0) break;
+    }
+  } else {
+    const uint16x8_t quote = vdupq_n_u16('"');
+    const uint16x8_t backslash = vdupq_n_u16('\\');
+    const uint16x8_t min_plain = vdupq_n_u16(0x20);
+    uint16x8_t seen = vdupq_n_u16(0);
+    for (; end - cursor >= kStride; cursor += kStride) {
+      uint16x8_t chars = vld1q_u16(cursor);
+      uint16x8_t special = vorrq_u16(
+          vorrq_u16(vceqq_u16(chars, quote), vceqq_u16(chars, backslash)),
+          vcltq_u16(chars, min_plain));
+      if (vmaxvq_u16(special) != 0) break;
+      seen = vmaxq_u16(seen, chars);
+    }
+    *bits |= vmaxvq_u16(seen);
+  }
+#endif
+  return cursor;
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(
@@ -653,8 +745,44 @@ Handle<Map> ParentOfDescriptorOwner(Isolate* isolate, Handle<Map> maybe_root,
   return handle(source->FindFieldOwner(isolate, InternalIndex(descriptor - 1)),
                 isolate);
 }
+
+// Returns how many properties objects with |map| were given after being
+// created, following the chain of single field transitions out of |map|.
+int CountExpectedFieldTransitions(Isolate* isolate, Tagged<Map> map,
+                                  int limit) {
+  HandleScope scope(isolate);
+  int count = 0;
+  while (count < limit) {
+    TransitionsAccessor transitions(isolate, map);
+    if (transitions.ExpectedTransitionKey().is_null()) break;
+    map = transitions.GetTarget(0);
+    if (map->is_deprecated()) break;
+    count++;
+  }
+  return count;
+}
 }  // namespace
 
+// Objects parsed from JSON start out with exactly as many in-object properties
+// as they have named properties. If objects with the same transition path were
+// given more properties afterwards, those ended up in a PropertyArray. Much
+// like in-object slack tracking does for constructors, this learns from the
+// transition tree how many properties to expect and returns a root map with
+// in-object space for them, or a null handle.
+template <typename Char>
+Handle<Map> JsonParser<Char>::PredictedRootMap(Handle<Map> map,
+                                               int named_length) {
+  const int max_properties =
+      std::min(JSObject::kMapCacheSize - 1, JSObject::kMaxInObjectProperties);
+  const int unused = map->UnusedInObjectProperties();
+  const int limit = max_properties - named_length;
+  if (limit <= unused) return Handle<Map>::null();
+  const int expected = CountExpectedFieldTransitions(isolate_, *map, limit);
+  if (expected <= unused) return Handle<Map>::null();
+  return factory()->ObjectLiteralMapFromCache(isolate_->native_context(),
+                                              named_length + expected);
+}
+
 template <typename Char>
 Handle<Object> JsonParser<Char>::BuildJsonObject(
     const JsonContinuation& cont,
@@ -710,96 +838,120 @@ Handle<Object> JsonParser<Char>::BuildJsonObject(
     elements = factory()->empty_fixed_array();
   }
 
-  int feedback_descriptors = 0;
-  if (!feedback.is_null()) {
-    DisallowGarbageCollection no_gc;
-    Tagged<Map> raw_feedback = *feedback;
-    Tagged<Map> raw_map = *map;
-    feedback_descriptors =
-        (raw_feedback->elements_kind() != raw_map->elements_kind() ||
-         raw_feedback->instance_size() != raw_map->instance_size())
-            ? 0
-            : raw_feedback->NumberOfOwnDescriptors();
+  // Siblings of an object that was allocated from a predicted root map start
+  // from the same root map.
+  if (!feedback.is_null() && cont.elements == 0 &&
+      !initial_map->is_dictionary_map() &&
+      feedback->NumberOfOwnDescriptors() == named_length &&
+      feedback->GetInObjectProperties() >
+          initial_map->GetInObjectProperties()) {
+    initial_map = map = handle(feedback->FindRootMap(isolate_), isolate_);
   }
 
   int i;
-  int descriptor = 0;
-  int new_mutable_double = 0;
-  for (i = 0; i < length; i++) {
-    const JsonProperty& property = property_stack[start + i];
-    if (property.string.is_index()) continue;
-    Handle<String> expected;
-    Handle<Map> target;
-    InternalIndex descriptor_index(descriptor);
-    if (descriptor < feedback_descriptors) {
-      expected =
-          handle(String::cast(feedback->instance_descriptors(isolate_)->GetKey(
-                     descriptor_index)),
-                 isolate_);
-    } else {
-      TransitionsAccessor transitions(isolate(), *map);
-      expected = transitions.ExpectedTransitionKey();
-      if (!expected.is_null()) {
-        // Directly read out the target while reading out the key, otherwise it
-        // might die while building the string below.
-        target =
-            TransitionsAccessor(isolate(), *map).ExpectedTransitionTarget();
-      }
+  int descriptor;
+  int feedback_descriptors;
+  int new_mutable_double;
+  for (bool predicted = false;; predicted = true) {
+    feedback_descriptors = 0;
+    if (!feedback.is_null()) {
+      DisallowGarbageCollection no_gc;
+      Tagged<Map> raw_feedback = *feedback;
+      Tagged<Map> raw_map = *map;
+      feedback_descriptors =
+          (raw_feedback->elements_kind() != raw_map->elements_kind() ||
+           raw_feedback->instance_size() != raw_map->instance_size())
+              ? 0
+              : raw_feedback->NumberOfOwnDescriptors();
     }
 
-    Handle<String> key = MakeString(property.string, expected);
-    if (key.is_identical_to(expected)) {
-      if (descriptor < feedback_descriptors) target = feedback;
-    } else {
+    descriptor = 0;
+    new_mutable_double = 0;
+    for (i = 0; i < length; i++) {
+      const JsonProperty& property = property_stack[start + i];
+      if (property.string.is_index()) continue;
+      Handle<String> expected;
+      Handle<Map> target;
+      InternalIndex descriptor_index(descriptor);
       if (descriptor < feedback_descriptors) {
-        map = ParentOfDescriptorOwner(isolate_, map, feedback, descriptor);
-        feedback_descriptors = 0;
+        expected = handle(
+            String::cast(feedback->instance_descriptors(isolate_)->GetKey(
+                descriptor_index)),
+            isolate_);
+      } else {
+        TransitionsAccessor transitions(isolate(), *map);
+        expected = transitions.ExpectedTransitionKey();
+        if (!expected.is_null()) {
+          // Directly read out the target while reading out the key,
+          // otherwise it might die while building the string below.
+          target =
+              TransitionsAccessor(isolate(), *map).ExpectedTransitionTarget();
+        }
       }
-      if (!TransitionsAccessor(isolate(), *map)
-               .FindTransitionToField(key)
-               .ToHandle(&target)) {
-        break;
+
+      Handle<String> key = MakeString(property.string, expected);
+      if (key.is_identical_to(expected)) {
+        if (descriptor < feedback_descriptors) target = feedback;
+      } else {
+        if (descriptor < feedback_descriptors) {
+          map = ParentOfDescriptorOwner(isolate_, map, feedback, descriptor);
+          feedback_descriptors = 0;
+        }
+        if (!TransitionsAccessor(isolate(), *map)
+                 .FindTransitionToField(key)
+                 .ToHandle(&target)) {
+          break;
+        }
       }
-    }
 
-    Handle<Object> value = property.value;
+      Handle<Object> value = property.value;
 
-    PropertyDetails details =
-        target->instance_descriptors(isolate_)->GetDetails(descriptor_index);
-    Representation expected_representation = details.representation();
+      PropertyDetails details = target->instance_descriptors(isolate_)
+                                    ->GetDetails(descriptor_index);
+      Representation expected_representation = details.representation();
 
-    if (!Object::FitsRepresentation(*value, expected_representation)) {
-      Representation representation =
-          Object::OptimalRepresentation(*value, isolate());
-      representation = representation.generalize(expected_representation);
-      if (!expected_representation.CanBeInPlaceChangedTo(representation)) {
-        map = ParentOfDescriptorOwner(isolate_, map, target, descriptor);
-        break;
+      if (!Object::FitsRepresentation(*value, expected_representation)) {
+        Representation representation =
+            Object::OptimalRepresentation(*value, isolate());
+        representation = representation.generalize(expected_representation);
+        if (!expected_representation.CanBeInPlaceChangedTo(representation)) {
+          map = ParentOfDescriptorOwner(isolate_, map, target, descriptor);
+          break;
+        }
+        Handle<FieldType> value_type =
+            Object::OptimalType(*value, isolate(), representation);
+        MapUpdater::GeneralizeField(isolate(), target, descriptor_index,
+                                    details.constness(), representation,
+                                    value_type);
+      } else if (expected_representation.IsHeapObject() &&
+                 !FieldType::NowContains(
+                     target->instance_descriptors(isolate())->GetFieldType(
+                         descriptor_index),
+                     value)) {
+        Handle<FieldType> value_type =
+            Object::OptimalType(*value, isolate(), expected_representation);
+        MapUpdater::GeneralizeField(isolate(), target, descriptor_index,
+                                    details.constness(),
+                                    expected_representation, value_type);
+      } else if (expected_representation.IsDouble() && IsSmi(*value)) {
+        new_mutable_double++;
       }
-      Handle<FieldType> value_type =
-          Object::OptimalType(*value, isolate(), representation);
-      MapUpdater::GeneralizeField(isolate(), target, descriptor_index,
-                                  details.constness(), representation,
-                                  value_type);
-    } else if (expected_representation.IsHeapObject() &&
-               !FieldType::NowContains(
-                   target->instance_descriptors(isolate())->GetFieldType(
-                       descriptor_index),
-                   value)) {
-      Handle<FieldType> value_type =
-          Object::OptimalType(*value, isolate(), expected_representation);
-      MapUpdater::GeneralizeField(isolate(), target, descriptor_index,
-                                  details.constness(), expected_representation,
-                                  value_type);
-    } else if (expected_representation.IsDouble() && IsSmi(*value)) {
-      new_mutable_double++;
+
+      DCHECK(FieldType::NowContains(
+          target->instance_descriptors(isolate())->GetFieldType(
+              descriptor_index),
+          value));
+      map = target;
+      descriptor++;
     }
 
-    DCHECK(FieldType::NowContains(
-        target->instance_descriptors(isolate())->GetFieldType(descriptor_index),
-        value));
-    map = target;
-    descriptor++;
+    // If objects of this shape tend to get more properties after parsing,
+    // retry from a root map with in-object space for those.
+    if (predicted || i != length || cont.elements > 0) break;
+    Handle<Map> predicted_root = PredictedRootMap(map, named_length);
+    if (predicted_root.is_null()) break;
+    initial_map = map = predicted_root;
+    feedback = Handle<Map>::null();
   }
 
   // Fast path: Write all transitioned named properties.
@@ -1579,6 +1731,7 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    cursor_ = SkipPlainJsonStringCharacters(cursor_, end_, &bits);
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -1665,5 +1818,77 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
 template class JsonParser<uint8_t>;
 template class JsonParser<uint16_t>;
 
+namespace {
+
+class ExternalOneByteJsonSource final
+    : public v8::String::ExternalOneByteStringResource {
+ public:
+  explicit ExternalOneByteJsonSource(std::vector<uint8_t> chars)
+      : chars_(std::move(chars)) {}
+
+  const char* data() const override {
+    return reinterpret_cast<const char*>(chars_.data());
+  }
+  size_t length() const override { return chars_.size(); }
+
+ private:
+  std::vector<uint8_t> chars_;
+};
+
+class ExternalTwoByteJsonSource final
+    : public v8::String::ExternalStringResource {
+ public:
+  explicit ExternalTwoByteJsonSource(std::vector<base::uc16> chars)
+      : chars_(std::move(chars)) {}
+
+  const uint16_t* data() const override { return chars_.data(); }
+  size_t length() const override { return chars_.size(); }
+
+ private:
+  std::vector<base::uc16> chars_;
+};
+
+}  // namespace
+
+void JsonStreamingData::Append(const uint8_t* data, size_t length) {
+  if (is_one_byte_) {
+    one_byte_chars_.insert(one_byte_chars_.end(), data, data + length);
+  } else {
+    two_byte_chars_.insert(two_byte_chars_.end(), data, data + length);
+  }
+}
+
+void JsonStreamingData::Append(const base::uc16* data, size_t length) {
+  if (is_one_byte_) {
+    two_byte_chars_.reserve(one_byte_chars_.size() + length);
+    two_byte_chars_.assign(one_byte_chars_.begin(), one_byte_chars_.end());
+    one_byte_chars_ = std::vector<uint8_t>();
+    is_one_byte_ = false;
+  }
+  two_byte_chars_.insert(two_byte_chars_.end(), data, data + length);
+}
+
+MaybeHandle<String> JsonStreamingData::TakeSource(Isolate* isolate) {
+  Factory* factory = isolate->factory();
+  MaybeHandle<String> result;
+  if (is_one_byte_) {
+    if (one_byte_chars_.empty()) return factory->empty_string();
+    auto* resource =
+        new ExternalOneByteJsonSource(std::exchange(one_byte_chars_, {}));
+    result = factory->NewExternalStringFromOneByte(resource);
+    if (result.is_null()) delete resource;
+  } else {
+    auto* resource =
+        new ExternalTwoByteJsonSource(std::exchange(two_byte_chars_, {}));
+    result = factory->NewExternalStringFromTwoByte(resource);
+    if (result.is_null()) delete resource;
+    is_one_byte_ = true;
+  }
+  return result;
+}
+
+#undef V8_JSON_PARSER_USE_SSE2
+#undef V8_JSON_PARSER_USE_NEON
+
 }  // namespace internal
 }  // namespace v8
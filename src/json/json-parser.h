@@ -5,6 +5,8 @@
 #ifndef V8_JSON_JSON_PARSER_H_
 #define V8_JSON_JSON_PARSER_H_
 
+#include <vector>
+
 #include "include/v8-callbacks.h"
 #include "src/base/small-vector.h"
 #include "src/base/strings.h"
@@ -327,6 +329,7 @@ class JsonParser final {
   Handle<Object> BuildJsonObject(
       const JsonContinuation& cont,
       const SmallVector<JsonProperty>& property_stack, Handle<Map> feedback);
+  Handle<Map> PredictedRootMap(Handle<Map> map, int named_length);
   Handle<Object> BuildJsonArray(
       const JsonContinuation& cont,
       const SmallVector<Handle<Object>>& element_stack);
@@ -411,6 +414,24 @@ class JsonParser final {
 extern template class JsonParser<uint8_t>;
 extern template class JsonParser<uint16_t>;
 
+// Backing store of v8::JSON::StreamingParser. The appended chunks are kept in
+// a single buffer which is handed over to an external string once the text is
+// complete, so that the source is never copied onto the V8 heap.
+class JsonStreamingData final {
+ public:
+  void Append(const uint8_t* data, size_t length);
+  void Append(const base::uc16* data, size_t length);
+
+  // Transfers the characters appended so far to a new external string and
+  // resets the buffer.
+  V8_WARN_UNUSED_RESULT MaybeHandle<String> TakeSource(Isolate* isolate);
+
+ private:
+  std::vector<uint8_t> one_byte_chars_;
+  std::vector<base::uc16> two_byte_chars_;
+  bool is_one_byte_ = true;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -4,6 +4,9 @@
 
 #include "src/json/json-stringifier.h"
 
+#include <memory>
+#include <vector>
+
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
 #include "src/common/message-template.h"
@@ -21,6 +24,17 @@
 #include "src/objects/tagged.h"
 #include "src/strings/string-builder-inl.h"
 
+#if (defined(__SSE2__) || \
+     (defined(_MSC_VER) && \
+      (defined(_M_X64) || (defined(_M_IX86) && _M_IX86_FP >= 2))))
+#define V8_JSON_STRINGIFIER_USE_SSE2 1
+#include <emmintrin.h>
+#elif defined(V8_HOST_ARCH_ARM64)
+// Note that ARM64 is guaranteed to have Neon.
+#define V8_JSON_STRINGIFIER_USE_NEON 1
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -246,7 +260,8 @@ class JsonStringifier {
     // Appends all of the chars from the provided span, but only increases the
     // cursor by `length`. This allows oversizing the span to the nearest
     // convenient multiple, allowing CopyChars to run slightly faster.
-    V8_INLINE void AppendChars(base::Vector<const uint8_t> chars,
+    template <typename SrcChar>
+    V8_INLINE void AppendChars(base::Vector<const SrcChar> chars,
                                size_t length) {
       DCHECK_GE(chars.size(), length);
       CopyChars(cursor_, chars.begin(), chars.size());
@@ -323,6 +338,83 @@ class JsonStringifier {
     Tagged_t keys_[kSize];
   };
 
+  // The own properties of a fast-mode map that JSON.stringify serializes,
+  // i.e. the enumerable, string-keyed ones, in descriptor order. If all of
+  // them are data fields, |fields_only| is set and objects with this map can
+  // be serialized with plain field loads instead of a descriptor walk.
+  struct SerializationPlan {
+    struct Field {
+      InternalIndex descriptor;
+      FieldIndex field_index;
+      // Only whether the field is a double is recorded: fields can be
+      // generalized in-place to other representations without changing the
+      // map, but never to or from double.
+      bool is_double;
+    };
+    std::vector<Field> fields;
+    bool fields_only = true;
+  };
+
+  // A cache of serialization plans for recently seen maps. Serializing arrays
+  // of records means serializing many objects with the same few maps; this
+  // saves looking up and checking each of their descriptors again for every
+  // object. Like SimplePropertyKeyCache, it is keyed on raw map pointers and
+  // therefore cleared on GC. Plans are reference counted, so that a plan in
+  // use by an outer object survives clearing or replacement while nested
+  // objects are serialized.
+  class SerializationPlanCache
+      : public Isolate::ToDestroyBeforeSuddenShutdown {
+   public:
+    explicit SerializationPlanCache(Isolate* isolate)
+        : Isolate::ToDestroyBeforeSuddenShutdown(isolate) {
+      isolate->main_thread_local_heap()->AddGCEpilogueCallback(
+          UpdatePointersCallback, this);
+    }
+
+    ~SerializationPlanCache() {
+      isolate()->main_thread_local_heap()->RemoveGCEpilogueCallback(
+          UpdatePointersCallback, this);
+    }
+
+    std::shared_ptr<const SerializationPlan> Lookup(Tagged<Map> map) {
+      Entry& entry = entries_[GetIndex(map)];
+      if (entry.map != map.ptr()) return nullptr;
+      return entry.plan;
+    }
+
+    void Insert(Tagged<Map> map,
+                std::shared_ptr<const SerializationPlan> plan) {
+      entries_[GetIndex(map)] = {map.ptr(), std::move(plan)};
+    }
+
+   private:
+    struct Entry {
+      Address map = kNullAddress;
+      std::shared_ptr<const SerializationPlan> plan;
+    };
+
+    size_t GetIndex(Tagged<Map> map) {
+      return (map.ptr() >> kTaggedSizeLog2) & kIndexMask;
+    }
+
+    void Clear() {
+      for (Entry& entry : entries_) entry = Entry();
+    }
+
+    static void UpdatePointersCallback(void* cache) {
+      reinterpret_cast<SerializationPlanCache*>(cache)->Clear();
+    }
+
+    static constexpr size_t kSizeBits = 3;
+    static constexpr size_t kSize = 1 << kSizeBits;
+    static constexpr size_t kIndexMask = kSize - 1;
+
+    Entry entries_[kSize];
+  };
+
+  std::shared_ptr<const SerializationPlan> GetSerializationPlan(
+      Tagged<Map> map);
+
   // Returns whether any escape sequences were used.
   template <typename SrcChar, typename DestChar, bool raw_json>
   V8_INLINE static bool SerializeStringUnchecked_(
@@ -342,6 +434,12 @@ class JsonStringifier {
   template <typename Char>
   V8_INLINE static bool DoNotEscape(Char c);
 
+  // Returns the index of the first character in |src| at or after |from| for
+  // which DoNotEscape is false, or the length of |src| if there is none.
+  template <typename Char>
+  V8_INLINE static int FindCharacterToEscape(base::Vector<const Char> src,
+                                             int from);
+
   V8_INLINE void NewLine();
   V8_NOINLINE void NewLineOutline();
   V8_INLINE void Indent() { indent_++; }
@@ -391,6 +489,7 @@ class JsonStringifier {
   std::vector<KeyObject> stack_;
 
   SimplePropertyKeyCache key_cache_;
+  SerializationPlanCache plan_cache_;
   uint8_t one_byte_array_[kInitialPartLength];
 
   static const int kJsonEscapeTableEntrySize = 8;
@@ -458,7 +557,8 @@ JsonStringifier::JsonStringifier(Isolate* isolate)
       overflowed_(false),
       need_stack_(false),
       stack_(),
-      key_cache_(isolate) {
+      key_cache_(isolate),
+      plan_cache_(isolate) {
   one_byte_ptr_ = one_byte_array_;
   part_ptr_ = one_byte_ptr_;
 }
@@ -1225,6 +1325,30 @@ V8_INLINE bool CanFastSerializeJSObject(PtrComprCageBase cage_base,
 }
 }  // namespace
 
+std::shared_ptr<const JsonStringifier::SerializationPlan>
+JsonStringifier::GetSerializationPlan(Tagged<Map> map) {
+  std::shared_ptr<const SerializationPlan> cached = plan_cache_.Lookup(map);
+  if (cached) return cached;
+
+  DisallowGarbageCollection no_gc;
+  auto plan = std::make_shared<SerializationPlan>();
+  Tagged<DescriptorArray> descriptors = map->instance_descriptors(isolate_);
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    if (!IsString(descriptors->GetKey(i), isolate_)) continue;
+    PropertyDetails details = descriptors->GetDetails(i);
+    if (details.IsDontEnum()) continue;
+    if (details.location() != PropertyLocation::kField) {
+      plan->fields_only = false;
+      break;
+    }
+    DCHECK_EQ(PropertyKind::kData, details.kind());
+    plan->fields.push_back({i, FieldIndex::ForDetails(map, details),
+                            details.representation().IsDouble()});
+  }
+  plan_cache_.Insert(map, plan);
+  return plan;
+}
+
 JsonStringifier::Result JsonStringifier::SerializeJSObject(
     Handle<JSObject> object, Handle<Object> key) {
   PtrComprCageBase cage_base(isolate_);
@@ -1254,11 +1378,46 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
     return SUCCESS;
   }
 
+  std::shared_ptr<const SerializationPlan> plan = GetSerializationPlan(*map);
+
   Result stack_push = StackPush(object, key);
   if (stack_push != SUCCESS) return stack_push;
   AppendCharacter('{');
   Indent();
   bool comma = false;
+  if (plan->fields_only) {
+    for (const SerializationPlan::Field& field : plan->fields) {
+      Handle<String> key_name(
+          String::cast(
+              map->instance_descriptors(cage_base)->GetKey(field.descriptor)),
+          isolate_);
+      Handle<Object> property;
+      if (*map == object->map(cage_base)) {
+        property = JSObject::FastPropertyAt(
+            isolate_, object,
+            field.is_double ? Representation::Double()
+                            : Representation::Tagged(),
+            field.field_index);
+      } else {
+        if (!need_stack_) {
+          need_stack_ = true;
+          return NEED_STACK;
+        }
+        ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+            isolate_, property,
+            Object::GetPropertyOrElement(isolate_, object, key_name),
+            EXCEPTION);
+      }
+      Result result = SerializeProperty(property, comma, key_name);
+      if (!comma && result == SUCCESS) comma = true;
+      if (result == EXCEPTION || result == NEED_STACK) return result;
+    }
+    Unindent();
+    if (comma) NewLine();
+    AppendCharacter('}');
+    StackPop();
+    return SUCCESS;
+  }
   for (InternalIndex i : map->IterateOwnDescriptors()) {
     Handle<String> key_name;
     PropertyDetails details = PropertyDetails::Empty();
@@ -1373,11 +1532,18 @@ bool JsonStringifier::SerializeStringUnchecked_(
   // Assert that base::uc16 character is not truncated down to 8 bit.
   // The <base::uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
+  if constexpr (raw_json) {
+    dest->AppendChars(src, src.size());
+    return false;
+  }
   bool required_escaping = false;
   for (int i = 0; i < src.length(); i++) {
     SrcChar c = src[i];
-    if (raw_json || DoNotEscape(c)) {
-      dest->Append(c);
+    if (DoNotEscape(c)) {
+      // Copy the whole run of characters that need no escaping at once.
+      int run_end = FindCharacterToEscape(src, i + 1);
+      dest->AppendChars(src.SubVector(i, run_end), run_end - i);
+      i = run_end - 1;
     } else if (sizeof(SrcChar) != 1 &&
                base::IsInRange(c, static_cast<SrcChar>(0xD800),
                                static_cast<SrcChar>(0xDFFF))) {
@@ -1564,6 +1730,80 @@ bool JsonStringifier::DoNotEscape(uint16_t c) {
          (c >= 0x23 && c != 0x5C && (c < 0xD800 || c > 0xDFFF));
 }
 
+template <typename Char>
+int JsonStringifier::FindCharacterToEscape(base::Vector<const Char> src,
+                                           int from) {
+  const Char* cursor = src.begin() + from;
+  const Char* end = src.end();
+  // Skip over all complete 16-byte blocks that contain no character which
+  // needs to be escaped, i.e. no control character, '"', '\\' and, for
+  // two-byte strings, no surrogate.
+#if defined(V8_JSON_STRINGIFIER_USE_SSE2)
+  constexpr int kStride = sizeof(__m128i) / sizeof(Char);
+  const __m128i zero = _mm_setzero_si128();
+  if constexpr (sizeof(Char) == 1) {
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i max_control = _mm_set1_epi8(0x1F);
+    for (; end - cursor >= kStride; cursor += kStride) {
+      __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+      __m128i escape = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(chars, quote),
+                       _mm_cmpeq_epi8(chars, backslash)),
+          _mm_cmpeq_epi8(_mm_subs_epu8(chars, max_control), zero));
+      if (_mm_movemask_epi8(escape) != 0) break;
+    }
+  } else {
+    const __m128i quote = _mm_set1_epi16('"');
+    const __m128i backslash = _mm_set1_epi16('\\');
+    const __m128i max_control = _mm_set1_epi16(0x1F);
+    const __m128i surrogate_mask = _mm_set1_epi16(static_cast<int16_t>(0xF800));
+    const __m128i surrogate = _mm_set1_epi16(static_cast<int16_t>(0xD800));
+    for (; end - cursor >= kStride; cursor += kStride) {
+      __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+      __m128i escape = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi16(chars, quote),
+                       _mm_cmpeq_epi16(chars, backslash)),
+          _mm_or_si128(
+              _mm_cmpeq_epi16(_mm_subs_epu16(chars, max_control), zero),
+              _mm_cmpeq_epi16(_mm_and_si128(chars, surrogate_mask),
+                              surrogate)));
+      if (_mm_movemask_epi8(escape) != 0) break;
+    }
+  }
+#elif defined(V8_JSON_STRINGIFIER_USE_NEON)
+  constexpr int kStride = sizeof(uint8x16_t) / sizeof(Char);
+  if constexpr (sizeof(Char) == 1) {
+    const uint8x16_t quote = vdupq_n_u8('"');
+    const uint8x16_t backslash = vdupq_n_u8('\\');
+    const uint8x16_t min_plain = vdupq_n_u8(0x20);
+    for (; end - cursor >= kStride; cursor += kStride) {
+      uint8x16_t chars = vld1q_u8(cursor);
+      uint8x16_t escape =
+          vorrq_u8(vorrq_u8(vceqq_u8(chars, quote), vceqq_u8(chars, backslash)),
+                   vcltq_u8(chars, min_plain));
+      if (vmaxvq_u8(escape) != 0) break;
+    }
+  } else {
+    const uint16x8_t quote = vdupq_n_u16('"');
+    const uint16x8_t backslash = vdupq_n_u16('\\');
+    const uint16x8_t min_plain = vdupq_n_u16(0x20);
+    const uint16x8_t surrogate_mask = vdupq_n_u16(0xF800);
+    const uint16x8_t surrogate = vdupq_n_u16(0xD800);
+    for (; end - cursor >= kStride; cursor += kStride) {
+      uint16x8_t chars = vld1q_u16(cursor);
+      uint16x8_t escape = vorrq_u16(
+          vorrq_u16(vceqq_u16(chars, quote), vceqq_u16(chars, backslash)),
+          vorrq_u16(vcltq_u16(chars, min_plain),
+                    vceqq_u16(vandq_u16(chars, surrogate_mask), surrogate)));
+      if (vmaxvq_u16(escape) != 0) break;
+    }
+  }
+#endif
+  while (cursor < end && DoNotEscape(*cursor)) ++cursor;
+  return static_cast<int>(cursor - src.begin());
+}
+
 void JsonStringifier::NewLine() {
   if (gap_ == nullptr) return;
   NewLineOutline();
@@ -1659,5 +1899,8 @@ void JsonStringifier::ChangeEncoding() {
   one_byte_ptr_ = nullptr;
 }
 
+#undef V8_JSON_STRINGIFIER_USE_SSE2
+#undef V8_JSON_STRINGIFIER_USE_NEON
+
 }  // namespace internal
 }  // namespace v8
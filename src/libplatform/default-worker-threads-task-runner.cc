@@ -4,16 +4,24 @@
 
 #include "src/libplatform/default-worker-threads-task-runner.h"
 
+#include <algorithm>
+
 #include "src/base/platform/time.h"
 #include "src/libplatform/delayed-task-queue.h"
 
 namespace v8 {
 namespace platform {
 
+thread_local DefaultWorkerThreadsTaskRunner::WorkerThread*
+    DefaultWorkerThreadsTaskRunner::WorkerThread::current_ = nullptr;
+
 DefaultWorkerThreadsTaskRunner::DefaultWorkerThreadsTaskRunner(
     uint32_t thread_pool_size, TimeFunction time_function,
     base::Thread::Priority priority)
     : queue_(time_function), time_function_(time_function) {
+  // Workers must not start looking at each other's queues before all of them
+  // have been created.
+  base::MutexGuard guard(&lock_);
   for (uint32_t i = 0; i < thread_pool_size; ++i) {
     thread_pool_.push_back(std::make_unique<WorkerThread>(this, priority));
   }
@@ -28,35 +36,46 @@ double DefaultWorkerThreadsTaskRunner::MonotonicallyIncreasingTime() {
 void DefaultWorkerThreadsTaskRunner::Terminate() {
   {
     base::MutexGuard guard(&lock_);
-    terminated_ = true;
+    terminated_.store(true, std::memory_order_relaxed);
     queue_.Terminate();
     idle_threads_.clear();
+    idle_thread_count_.store(0, std::memory_order_relaxed);
   }
-  // Clearing the thread pool lets all worker threads join.
+  // Workers steal from each other, so all of them have to stop before any of
+  // them is destroyed.
+  for (auto& thread : thread_pool_) thread->Notify();
+  for (auto& thread : thread_pool_) thread->Join();
   thread_pool_.clear();
 }
 
 void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
+  if (WorkerThread* worker = WorkerThread::GetCurrent(this)) {
+    // Tasks posted from worker threads go to the worker's local queue, from
+    // where idle workers steal them. With a single worker this would only
+    // reorder tasks.
+    if (thread_pool_.size() > 1) {
+      if (terminated_.load(std::memory_order_relaxed)) return;
+      worker->PushLocal(std::move(task));
+      if (idle_thread_count_.load(std::memory_order_seq_cst) > 0) {
+        base::MutexGuard guard(&lock_);
+        NotifyIdleThread();
+      }
+      return;
+    }
+  }
+
   base::MutexGuard guard(&lock_);
-  if (terminated_) return;
+  if (terminated_.load(std::memory_order_relaxed)) return;
   queue_.Append(std::move(task));
-
-  if (!idle_threads_.empty()) {
-    idle_threads_.back()->Notify();
-    idle_threads_.pop_back();
-  }
+  NotifyIdleThread();
 }
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
                                                      double delay_in_seconds) {
   base::MutexGuard guard(&lock_);
-  if (terminated_) return;
+  if (terminated_.load(std::memory_order_relaxed)) return;
   queue_.AppendDelayed(std::move(task), delay_in_seconds);
-
-  if (!idle_threads_.empty()) {
-    idle_threads_.back()->Notify();
-    idle_threads_.pop_back();
-  }
+  NotifyIdleThread();
 }
 
 void DefaultWorkerThreadsTaskRunner::PostIdleTask(
@@ -70,51 +89,164 @@ bool DefaultWorkerThreadsTaskRunner::IdleTasksEnabled() {
   return false;
 }
 
-DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
-    DefaultWorkerThreadsTaskRunner* runner, base::Thread::Priority priority)
-    : Thread(
-          Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread", priority)),
-      runner_(runner) {
-  CHECK(Start());
+void DefaultWorkerThreadsTaskRunner::NotifyIdleThread() {
+  lock_.AssertHeld();
+  if (idle_threads_.empty()) return;
+  idle_threads_.back()->Notify();
+  idle_threads_.pop_back();
+  idle_thread_count_.store(idle_threads_.size(), std::memory_order_seq_cst);
 }
 
-DefaultWorkerThreadsTaskRunner::WorkerThread::~WorkerThread() {
-  condition_var_.NotifyAll();
-  Join();
+void DefaultWorkerThreadsTaskRunner::RemoveIdleThread(WorkerThread* worker) {
+  lock_.AssertHeld();
+  auto it = std::find(idle_threads_.begin(), idle_threads_.end(), worker);
+  if (it == idle_threads_.end()) return;
+  idle_threads_.erase(it);
+  idle_thread_count_.store(idle_threads_.size(), std::memory_order_seq_cst);
 }
 
-void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
-  base::MutexGuard guard(&runner_->lock_);
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::TrySteal(
+    WorkerThread* thief) {
+  if (local_task_count_.load(std::memory_order_relaxed) == 0) return {};
+  auto it = std::find_if(thread_pool_.begin(), thread_pool_.end(),
+                         [thief](const std::unique_ptr<WorkerThread>& thread) {
+                           return thread.get() == thief;
+                         });
+  DCHECK(it != thread_pool_.end());
+  // Start with the next thread so that thieves spread over victims.
+  size_t start = std::distance(thread_pool_.begin(), it) + 1;
+  for (size_t i = 0; i < thread_pool_.size() - 1; ++i) {
+    WorkerThread* victim =
+        thread_pool_[(start + i) % thread_pool_.size()].get();
+    if (std::unique_ptr<Task> task = victim->StealLocal()) return task;
+  }
+  return {};
+}
+
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::GetNext(
+    WorkerThread* worker) {
   while (true) {
-    DelayedTaskQueue::MaybeNextTask next_task = runner_->queue_.TryGetNext();
+    if (terminated_.load(std::memory_order_relaxed)) return {};
+
+    if (worker->local_tasks_in_a_row_ < kMaxLocalTasksInARow) {
+      if (std::unique_ptr<Task> task = worker->PopLocal()) {
+        worker->local_tasks_in_a_row_++;
+        return task;
+      }
+    }
+    worker->local_tasks_in_a_row_ = 0;
+
+    {
+      base::MutexGuard guard(&lock_);
+      DelayedTaskQueue::MaybeNextTask next_task = queue_.TryGetNext();
+      if (next_task.state == DelayedTaskQueue::MaybeNextTask::kTask) {
+        return std::move(next_task.task);
+      }
+      if (next_task.state == DelayedTaskQueue::MaybeNextTask::kTerminated) {
+        return {};
+      }
+    }
+
+    if (std::unique_ptr<Task> task = worker->PopLocal()) return task;
+    if (std::unique_ptr<Task> task = TrySteal(worker)) return task;
+
+    base::MutexGuard guard(&lock_);
+    // The shared queue may have changed while the lock was released.
+    DelayedTaskQueue::MaybeNextTask next_task = queue_.TryGetNext();
     switch (next_task.state) {
       case DelayedTaskQueue::MaybeNextTask::kTask:
-        runner_->lock_.Unlock();
-        next_task.task->Run();
-        runner_->lock_.Lock();
-        continue;
+        return std::move(next_task.task);
       case DelayedTaskQueue::MaybeNextTask::kTerminated:
-        return;
+        return {};
       case DelayedTaskQueue::MaybeNextTask::kWaitIndefinite:
-        runner_->idle_threads_.push_back(this);
-        condition_var_.Wait(&runner_->lock_);
-        continue;
       case DelayedTaskQueue::MaybeNextTask::kWaitDelayed:
-        // WaitFor unfortunately doesn't care about our fake time and will wait
-        // the 'real' amount of time, based on whatever clock the system call
-        // uses.
-        runner_->idle_threads_.push_back(this);
-        bool notified =
-            condition_var_.WaitFor(&runner_->lock_, next_task.wait_time);
-        USE(notified);
-        continue;
+        break;
+    }
+    idle_threads_.push_back(worker);
+    idle_thread_count_.store(idle_threads_.size(), std::memory_order_seq_cst);
+    // A task may have been pushed to a local queue by a thread that didn't see
+    // this thread as idle yet.
+    if (local_task_count_.load(std::memory_order_seq_cst) > 0) {
+      RemoveIdleThread(worker);
+      continue;
     }
+    if (next_task.state == DelayedTaskQueue::MaybeNextTask::kWaitIndefinite) {
+      worker->condition_var_.Wait(&lock_);
+    } else {
+      // WaitFor unfortunately doesn't care about our fake time and will wait
+      // the 'real' amount of time, based on whatever clock the system call
+      // uses.
+      bool notified = worker->condition_var_.WaitFor(&lock_,
+                                                     next_task.wait_time);
+      USE(notified);
+    }
+    // Notifying threads remove the thread from |idle_threads_|, but it is
+    // still in there after timeouts and spurious wake-ups.
+    RemoveIdleThread(worker);
+  }
+}
+
+DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
+    DefaultWorkerThreadsTaskRunner* runner, base::Thread::Priority priority)
+    : Thread(
+          Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread", priority)),
+      runner_(runner) {
+  CHECK(Start());
+}
+
+// Threads are joined by DefaultWorkerThreadsTaskRunner::Terminate().
+DefaultWorkerThreadsTaskRunner::WorkerThread::~WorkerThread() = default;
+
+void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
+  current_ = this;
+  {
+    // Wait for the runner to finish creating workers.
+    base::MutexGuard guard(&runner_->lock_);
   }
+  while (std::unique_ptr<Task> task = runner_->GetNext(this)) {
+    task->Run();
+  }
+  current_ = nullptr;
 }
 
 void DefaultWorkerThreadsTaskRunner::WorkerThread::Notify() {
   condition_var_.NotifyAll();
 }
 
+// static
+DefaultWorkerThreadsTaskRunner::WorkerThread*
+DefaultWorkerThreadsTaskRunner::WorkerThread::GetCurrent(
+    DefaultWorkerThreadsTaskRunner* runner) {
+  WorkerThread* current = current_;
+  if (current == nullptr || current->runner_ != runner) return nullptr;
+  return current;
+}
+
+void DefaultWorkerThreadsTaskRunner::WorkerThread::PushLocal(
+    std::unique_ptr<Task> task) {
+  base::MutexGuard guard(&local_lock_);
+  local_queue_.push_back(std::move(task));
+  runner_->local_task_count_.fetch_add(1, std::memory_order_seq_cst);
+}
+
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::WorkerThread::PopLocal() {
+  base::MutexGuard guard(&local_lock_);
+  if (local_queue_.empty()) return {};
+  std::unique_ptr<Task> task = std::move(local_queue_.front());
+  local_queue_.pop_front();
+  runner_->local_task_count_.fetch_sub(1, std::memory_order_relaxed);
+  return task;
+}
+
+std::unique_ptr<Task>
+DefaultWorkerThreadsTaskRunner::WorkerThread::StealLocal() {
+  base::MutexGuard guard(&local_lock_);
+  if (local_queue_.empty()) return {};
+  std::unique_ptr<Task> task = std::move(local_queue_.back());
+  local_queue_.pop_back();
+  runner_->local_task_count_.fetch_sub(1, std::memory_order_relaxed);
+  return task;
+}
+
 }  // namespace platform
 }  // namespace v8
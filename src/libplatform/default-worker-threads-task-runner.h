@@ -5,6 +5,8 @@
 #ifndef V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 #define V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <vector>
 
@@ -58,20 +60,61 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
     void Notify();
 
+    // Returns the worker thread of |runner| that the calling thread runs on,
+    // or nullptr if it is not one of |runner|'s worker threads.
+    static WorkerThread* GetCurrent(DefaultWorkerThreadsTaskRunner* runner);
+
    private:
+    friend class DefaultWorkerThreadsTaskRunner;
+
+    void PushLocal(std::unique_ptr<Task> task);
+    // The owning thread takes tasks from the front of its local queue, other
+    // workers steal from the back.
+    std::unique_ptr<Task> PopLocal();
+    std::unique_ptr<Task> StealLocal();
+
+    static thread_local WorkerThread* current_;
+
     DefaultWorkerThreadsTaskRunner* runner_;
     base::ConditionVariable condition_var_;
+    // Tasks posted by tasks running on this thread. They are protected by a
+    // lock of their own, so that workers posting many small tasks (e.g. job
+    // workers) don't contend on |lock_|.
+    base::Mutex local_lock_;
+    std::deque<std::unique_ptr<Task>> local_queue_;
+    // Number of tasks this thread took from its own local queue since it last
+    // looked at the shared queue.
+    int local_tasks_in_a_row_ = 0;
   };
 
-  // Called by the WorkerThread. Gets the next take (delayed or immediate) to be
-  // executed. Blocks if no task is available.
-  std::unique_ptr<Task> GetNext();
+  // Tasks taken from local queues in a row before a worker looks at the shared
+  // queue again, so that tasks reposting themselves can't starve it.
+  static constexpr int kMaxLocalTasksInARow = 61;
 
-  bool terminated_ = false;
+  // Called by the WorkerThread. Gets the next take (delayed or immediate) to be
+  // executed: from the worker's local queue, the shared queue, or stolen from
+  // another worker's local queue. Blocks if no task is available and returns
+  // nullptr once the runner is terminated.
+  std::unique_ptr<Task> GetNext(WorkerThread* worker);
+  std::unique_ptr<Task> TrySteal(WorkerThread* thief);
+  // Wakes up the most recently idle thread, if any. Requires |lock_|.
+  void NotifyIdleThread();
+  // Removes |worker| from |idle_threads_| if it is still in there. Requires
+  // |lock_|.
+  void RemoveIdleThread(WorkerThread* worker);
+
+  std::atomic<bool> terminated_{false};
   base::Mutex lock_;
   // Vector of idle threads -- these are pushed in LIFO order, so that the most
   // recently active thread is the first to be reactivated.
   std::vector<WorkerThread*> idle_threads_;
+  // Mirrors |idle_threads_.size()| for threads posting to their local queue,
+  // which only take |lock_| when there is an idle thread to wake up.
+  std::atomic<size_t> idle_thread_count_{0};
+  // Number of tasks in all local queues. Threads going idle check it after
+  // registering in |idle_threads_|, which pairs with posting threads checking
+  // |idle_thread_count_| after incrementing it, so no wake-up is lost.
+  std::atomic<size_t> local_task_count_{0};
   std::vector<std::unique_ptr<WorkerThread>> thread_pool_;
   // Worker threads access this queue, so we can only destroy it after all
   // workers stopped.
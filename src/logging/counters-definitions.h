@@ -378,10 +378,17 @@ namespace internal {
   SC(lo_space_bytes_available, V8.MemoryLoSpaceBytesAvailable)                 \
   SC(lo_space_bytes_committed, V8.MemoryLoSpaceBytesCommitted)                 \
   SC(lo_space_bytes_used, V8.MemoryLoSpaceBytesUsed)                           \
+  SC(huge_page_advised_kb, V8.MemoryHugePageAdvisedKB)                         \
+  SC(huge_page_advice_failures, V8.MemoryHugePageAdviceFailures)               \
+  SC(large_page_pool_hits, V8.MemoryLargePagePoolHits)                         \
+  SC(large_page_pool_misses, V8.MemoryLargePagePoolMisses)                     \
   SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes)                      \
   SC(wasm_reloc_size, V8.WasmRelocBytes)                                       \
   SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions)           \
-  SC(wasm_compiled_export_wrapper, V8.WasmCompiledExportWrappers)
+  SC(wasm_compiled_export_wrapper, V8.WasmCompiledExportWrappers)              \
+  SC(wasm_stack_pool_hits, V8.WasmStackPoolHits)                               \
+  SC(wasm_stack_pool_misses, V8.WasmStackPoolMisses)                           \
+  SC(wasm_stack_peak_committed_kb, V8.WasmStackPeakCommittedKiB)
 
 // List of counters that can be incremented from generated code. We need them in
 // a separate list to be able to relocate them.
@@ -55,9 +55,17 @@ LogFile::LogFile(V8FileLogger* logger, std::string file_name)
     : logger_(logger),
       file_name_(file_name),
       output_handle_(LogFile::CreateOutputHandle(file_name)),
+      flush_each_line_(v8_flags.logfile_line_buffered ||
+                       LogFile::IsLoggingToConsole(file_name)),
       os_(output_handle_ == nullptr ? stdout : output_handle_),
       format_buffer_(NewArray<char>(kMessageBufferSize)) {
-  if (output_handle_) WriteLogHeader();
+  if (output_handle_ == nullptr) return;
+  // Flushing each line costs a write to the file for every logged event, e.g.
+  // every code creation with --log-code. Let the stream collect lines instead.
+  if (!flush_each_line_) {
+    setvbuf(output_handle_, nullptr, _IOFBF, kOutputBufferSize);
+  }
+  WriteLogHeader();
 }
 
 void LogFile::WriteLogHeader() {
@@ -249,7 +257,10 @@ void LogFile::MessageBuilder::AppendRawString(const char* str) {
 
 void LogFile::MessageBuilder::AppendRawCharacter(char c) { log_->os_ << c; }
 
-void LogFile::MessageBuilder::WriteToLogFile() { log_->os_ << std::endl; }
+void LogFile::MessageBuilder::WriteToLogFile() {
+  log_->os_ << '\n';
+  if (log_->flush_each_line_) log_->os_.flush();
+}
 
 template <>
 LogFile::MessageBuilder& LogFile::MessageBuilder::operator<<<const char*>(
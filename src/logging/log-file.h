@@ -15,6 +15,7 @@
 #include "src/base/optional.h"
 #include "src/base/platform/mutex.h"
 #include "src/common/assert-scope.h"
+#include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/utils/ostreams.h"
@@ -50,6 +51,9 @@ class LogFile {
   // Size of buffer used for formatting log messages.
   static const int kMessageBufferSize = 2048;
 
+  // Size of the stdio buffer of log files that are not line buffered.
+  static const size_t kOutputBufferSize = 64 * KB;
+
   // This mode is only used in tests, as temporary files are automatically
   // deleted on close and thus can't be accessed afterwards.
   V8_EXPORT_PRIVATE static const char* const kLogToTemporaryFile;
@@ -122,6 +126,10 @@ class LogFile {
   // destination.  mutex_ should be acquired before using output_handle_.
   FILE* output_handle_;
 
+  // Whether every log line is flushed to the output immediately. Otherwise,
+  // lines are written out whenever the output buffer is full and on Close().
+  const bool flush_each_line_;
+
   OFStream os_;
 
   // mutex_ is a Mutex used for enforcing exclusive
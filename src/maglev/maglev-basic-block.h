@@ -166,9 +166,15 @@ class BasicBlock {
   ZonePtrList<ValueNode>& reload_hints() { return reload_hints_; }
   ZonePtrList<ValueNode>& spill_hints() { return spill_hints_; }
 
+  // Only relevant for loop headers: whether the loop body (excluding inner
+  // loops) contains calls.
+  bool loop_has_calls() const { return loop_has_calls_; }
+  void set_loop_has_calls() { loop_has_calls_ = true; }
+
  private:
   enum : uint8_t { kMerge, kEdgeSplit, kOther } type_ = kMerge;
   bool is_start_block_of_switch_case_ = false;
+  bool loop_has_calls_ = false;
   Node::List nodes_;
   ControlNode* control_node_;
   union {
@@ -303,6 +303,9 @@ class LiveRangeAndNextUseProcessor {
     }
 
     DCHECK_EQ(loop_used_nodes.header, target);
+    if (loop_used_nodes.first_call != kInvalidNodeId) {
+      target->set_loop_has_calls();
+    }
     if (!loop_used_nodes.used_nodes.empty()) {
       // Try to avoid unnecessary reloads or spills across the back-edge based
       // on use positions and calls inside the loop.
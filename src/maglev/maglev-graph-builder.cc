@@ -39,12 +39,15 @@
 #include "src/maglev/maglev-interpreter-frame-state.h"
 #include "src/maglev/maglev-ir.h"
 #include "src/numbers/conversions.h"
+#include "src/objects/debug-objects.h"
 #include "src/objects/elements-kind.h"
 #include "src/objects/feedback-vector.h"
 #include "src/objects/fixed-array.h"
 #include "src/objects/heap-number-inl.h"
+#include "src/objects/js-collection.h"
 #include "src/objects/literal-objects-inl.h"
 #include "src/objects/name-inl.h"
+#include "src/objects/ordered-hash-table.h"
 #include "src/objects/property-cell.h"
 #include "src/objects/property-details.h"
 #include "src/objects/shared-function-info.h"
@@ -84,6 +87,9 @@ bool IsSupported(CpuOperation op) {
   }
 }
 
+// Block contexts with fewer slots than this are allocated inline.
+constexpr int kBlockContextAllocationLimit = 16;
+
 ValueNode* TryGetParentContext(ValueNode* node) {
   if (CreateFunctionContext* n = node->TryCast<CreateFunctionContext>()) {
     return n->context().node();
@@ -1746,6 +1752,33 @@ void MaglevGraphBuilder::BuildGenericBinarySmiOperationNode() {
       {left, right}, compiler::FeedbackSource{feedback(), slot_index}));
 }
 
+template <Operation kOperation>
+void MaglevGraphBuilder::BuildBigIntBinaryOperationNode() {
+  // Both inputs are known to be BigInts, so call the BigInt builtins directly
+  // rather than going through the generic, feedback collecting operation.
+  ValueNode* left = LoadRegisterTagged(0);
+  ValueNode* right = GetAccumulatorTagged();
+  BuildCheckBigInt(left);
+  BuildCheckBigInt(right);
+  ValueNode* result;
+  switch (kOperation) {
+    case Operation::kAdd:
+      result = BuildCallBuiltin<Builtin::kBigIntAdd>({left, right});
+      break;
+    case Operation::kSubtract:
+      result = BuildCallBuiltin<Builtin::kBigIntSubtract>({left, right});
+      break;
+    case Operation::kMultiply:
+      result = BuildCallBuiltin<Builtin::kBigIntMultiply>({left, right});
+      break;
+    default:
+      UNREACHABLE();
+  }
+  known_node_aspects().GetOrCreateInfoFor(result)->CombineType(
+      NodeType::kBigInt);
+  SetAccumulator(result);
+}
+
 template <Operation kOperation>
 void MaglevGraphBuilder::BuildInt32UnaryOperationNode() {
   // Use BuildTruncatingInt32BitwiseNotForToNumber with Smi input hint
@@ -2027,12 +2060,18 @@ void MaglevGraphBuilder::VisitBinaryOperation() {
         ValueNode* right = GetAccumulatorTagged();
         BuildCheckString(left);
         BuildCheckString(right);
-        SetAccumulator(AddNewNode<StringConcat>({left, right}));
+        SetAccumulator(BuildStringConcat(left, right));
         return;
       }
       break;
     case BinaryOperationHint::kBigInt:
     case BinaryOperationHint::kBigInt64:
+      if constexpr (kOperation == Operation::kAdd ||
+                    kOperation == Operation::kSubtract ||
+                    kOperation == Operation::kMultiply) {
+        return BuildBigIntBinaryOperationNode<kOperation>();
+      }
+      break;
     case BinaryOperationHint::kAny:
       // Fallback to generic node.
       break;
@@ -2285,9 +2324,47 @@ void MaglevGraphBuilder::VisitCompareOperation() {
       SetAccumulator(result);
       return;
     }
-    case CompareOperationHint::kAny:
     case CompareOperationHint::kBigInt64:
-    case CompareOperationHint::kBigInt:
+    case CompareOperationHint::kBigInt: {
+      ValueNode* left = LoadRegisterTagged(0);
+      ValueNode* right = GetAccumulatorTagged();
+      BuildCheckBigInt(left);
+      BuildCheckBigInt(right);
+
+      ValueNode* result;
+      if (left == right) {
+        SetAccumulator(
+            GetBooleanConstant(kOperation == Operation::kEqual ||
+                               kOperation == Operation::kStrictEqual ||
+                               kOperation == Operation::kLessThanOrEqual ||
+                               kOperation == Operation::kGreaterThanOrEqual));
+        return;
+      }
+      switch (kOperation) {
+        case Operation::kEqual:
+        case Operation::kStrictEqual:
+          result = BuildCallBuiltin<Builtin::kBigIntEqual>({left, right});
+          break;
+        case Operation::kLessThan:
+          result = BuildCallBuiltin<Builtin::kBigIntLessThan>({left, right});
+          break;
+        case Operation::kLessThanOrEqual:
+          result =
+              BuildCallBuiltin<Builtin::kBigIntLessThanOrEqual>({left, right});
+          break;
+        case Operation::kGreaterThan:
+          result = BuildCallBuiltin<Builtin::kBigIntGreaterThan>({left, right});
+          break;
+        case Operation::kGreaterThanOrEqual:
+          result = BuildCallBuiltin<Builtin::kBigIntGreaterThanOrEqual>(
+              {left, right});
+          break;
+      }
+
+      SetAccumulator(result);
+      return;
+    }
+    case CompareOperationHint::kAny:
     case CompareOperationHint::kNumberOrBoolean:
     case CompareOperationHint::kNumberOrOddball:
     case CompareOperationHint::kReceiverOrNullOrUndefined:
@@ -2763,8 +2840,27 @@ ReduceResult MaglevGraphBuilder::TryBuildPropertyCellLoad(
   }
 
   ValueNode* property_cell_node = GetConstant(property_cell.AsHeapObject());
-  return AddNewNode<LoadTaggedField>({property_cell_node},
-                                     PropertyCell::kValueOffset);
+  ValueNode* value = AddNewNode<LoadTaggedField>({property_cell_node},
+                                                 PropertyCell::kValueOffset);
+  // A constant-type cell keeps holding either Smis or heap objects with the
+  // (stable) map of its current value, as long as the dependency on the cell
+  // holds.
+  if (property_cell_type == PropertyCellType::kConstantType) {
+    NodeInfo* known_info = known_node_aspects().GetOrCreateInfoFor(value);
+    if (property_cell_value.IsHeapObject()) {
+      compiler::MapRef map = property_cell_value.AsHeapObject().map(broker());
+      if (map.is_stable()) {
+        broker()->dependencies()->DependOnStableMap(map);
+        known_info->SetPossibleMaps(PossibleMaps{map}, false,
+                                    StaticTypeForMap(map));
+      } else {
+        known_info->CombineType(NodeType::kAnyHeapObject);
+      }
+    } else {
+      known_info->CombineType(NodeType::kSmi);
+    }
+  }
+  return value;
 }
 
 ReduceResult MaglevGraphBuilder::TryBuildGlobalStore(
@@ -3147,6 +3243,22 @@ void MaglevGraphBuilder::BuildCheckString(ValueNode* object) {
   AddNewNode<CheckString>({object}, GetCheckType(known_type));
 }
 
+bool MaglevGraphBuilder::IsEmptyStringConstant(ValueNode* node) {
+  compiler::OptionalHeapObjectRef constant = TryGetConstant(node);
+  return constant.has_value() && constant->IsString() &&
+         constant->AsString().length() == 0;
+}
+
+ValueNode* MaglevGraphBuilder::BuildStringConcat(ValueNode* left,
+                                                 ValueNode* right) {
+  // Both inputs are known to be strings, so concatenating with the empty
+  // string is the identity (e.g. `"" + s`, or the first step of building up
+  // a string from an empty initial value).
+  if (IsEmptyStringConstant(left)) return right;
+  if (IsEmptyStringConstant(right)) return left;
+  return AddNewNode<StringConcat>({left, right});
+}
+
 void MaglevGraphBuilder::BuildCheckNumber(ValueNode* object) {
   if (EnsureType(object, NodeType::kNumber)) return;
   AddNewNode<CheckNumber>({object}, Object::Conversion::kToNumber);
@@ -3158,6 +3270,13 @@ void MaglevGraphBuilder::BuildCheckSymbol(ValueNode* object) {
   AddNewNode<CheckSymbol>({object}, GetCheckType(known_type));
 }
 
+void MaglevGraphBuilder::BuildCheckBigInt(ValueNode* object) {
+  NodeType known_type;
+  if (EnsureType(object, NodeType::kBigInt, &known_type)) return;
+  AddNewNode<CheckInstanceType>({object}, GetCheckType(known_type),
+                                BIGINT_TYPE);
+}
+
 void MaglevGraphBuilder::BuildCheckJSReceiver(ValueNode* object) {
   NodeType known_type;
   if (EnsureType(object, NodeType::kJSReceiver, &known_type)) return;
@@ -3752,6 +3871,15 @@ void MaglevGraphBuilder::BuildStoreReceiverMap(ValueNode* receiver,
   }
 }
 
+namespace {
+bool IsSharedStructAccess(compiler::PropertyAccessInfo const& access_info) {
+  const ZoneVector<compiler::MapRef>& maps =
+      access_info.lookup_start_object_maps();
+  return !maps.empty() &&
+         InstanceTypeChecker::IsJSSharedStruct(maps[0].instance_type());
+}
+}  // namespace
+
 ReduceResult MaglevGraphBuilder::TryBuildStoreField(
     compiler::PropertyAccessInfo const& access_info, ValueNode* receiver,
     compiler::AccessMode access_mode) {
@@ -3802,6 +3930,12 @@ ReduceResult MaglevGraphBuilder::TryBuildStoreField(
       GET_VALUE_OR_ABORT(value, GetAccumulatorSmi());
     } else {
       value = GetAccumulatorTagged();
+      if (IsSharedStructAccess(access_info)) {
+        // Values stored into shared structs must be shareable across
+        // isolates, which may require copying them into the shared heap.
+        DCHECK(field_representation.IsTagged());
+        value = BuildCallBuiltin<Builtin::kSharedValueBarrier>({value});
+      }
       if (field_representation.IsHeapObject()) {
         // Emit a map check for the field type, if needed, otherwise just a
         // HeapObject check.
@@ -3921,9 +4055,14 @@ ReduceResult MaglevGraphBuilder::TryBuildPropertyStore(
     DCHECK(access_info.IsDataField() || access_info.IsFastDataConstant());
     ReduceResult res = TryBuildStoreField(access_info, receiver, access_mode);
     if (res.IsDone()) {
-      RecordKnownProperty(receiver, name,
-                          current_interpreter_frame_.accumulator(),
-                          AccessInfoGuaranteedConst(access_info), access_mode);
+      // The value stored into a shared struct can be a shared copy of the
+      // accumulator.
+      if (!IsSharedStructAccess(access_info)) {
+        RecordKnownProperty(receiver, name,
+                            current_interpreter_frame_.accumulator(),
+                            AccessInfoGuaranteedConst(access_info),
+                            access_mode);
+      }
       return res;
     }
     return ReduceResult::Fail();
@@ -3949,6 +4088,30 @@ ReduceResult MaglevGraphBuilder::TryBuildPropertyAccess(
   }
 }
 
+ReduceResult MaglevGraphBuilder::TryBuildNamedAccessOnProxy(
+    ValueNode* receiver, compiler::NameRef name,
+    base::Vector<const compiler::MapRef> maps,
+    compiler::AccessMode access_mode) {
+  // Private symbols never reach the proxy traps.
+  if (name.object()->IsPrivate()) return ReduceResult::Fail();
+  // The traps themselves are only known at runtime, but calling the proxy
+  // builtins directly avoids dispatching through the IC on every access.
+  switch (access_mode) {
+    case compiler::AccessMode::kLoad:
+      RETURN_IF_ABORT(BuildCheckMaps(receiver, maps));
+      return BuildCallBuiltin<Builtin::kProxyGetProperty>(
+          {receiver, GetConstant(name), receiver,
+           GetSmiConstant(static_cast<int>(OnNonExistent::kReturnUndefined))});
+    case compiler::AccessMode::kStore:
+      RETURN_IF_ABORT(BuildCheckMaps(receiver, maps));
+      BuildCallBuiltin<Builtin::kProxySetProperty>(
+          {receiver, GetConstant(name), GetAccumulatorTagged(), receiver});
+      return ReduceResult::Done();
+    default:
+      return ReduceResult::Fail();
+  }
+}
+
 ReduceResult MaglevGraphBuilder::TryBuildNamedAccess(
     ValueNode* receiver, ValueNode* lookup_start_object,
     compiler::NamedAccessFeedback const& feedback,
@@ -4002,16 +4165,39 @@ ReduceResult MaglevGraphBuilder::TryBuildNamedAccess(
       return EmitUnconditionalDeopt(DeoptimizeReason::kWrongMap);
     }
 
+    if (receiver == lookup_start_object &&
+        std::all_of(feedback.maps().begin(), feedback.maps().end(),
+                    [](compiler::MapRef map) {
+                      return InstanceTypeChecker::IsJSProxy(
+                          map.instance_type());
+                    })) {
+      return TryBuildNamedAccessOnProxy(receiver, feedback.name(),
+                                        base::VectorOf(feedback.maps()),
+                                        access_mode);
+    }
+
+    bool has_shared_struct_map = false;
+    bool has_unshared_map = false;
     for (compiler::MapRef map : inferred_maps) {
       if (map.is_deprecated()) continue;
 
-      // TODO(v8:12547): Support writing to objects in shared space, which
-      // need a write barrier that calls Object::Share to ensure the RHS is
-      // shared.
-      if (InstanceTypeChecker::IsAlwaysSharedSpaceJSObject(
-              map.instance_type()) &&
-          access_mode == compiler::AccessMode::kStore) {
-        return ReduceResult::Fail();
+      if (access_mode == compiler::AccessMode::kStore) {
+        // Stores to shared struct fields pass the value through a
+        // SharedValueBarrier in TryBuildStoreField. That must not happen for
+        // unshared receivers, so don't mix both kinds of maps.
+        // TODO(v8:12547): Support writing to other objects in shared space.
+        InstanceType instance_type = map.instance_type();
+        if (InstanceTypeChecker::IsJSSharedStruct(instance_type)) {
+          has_shared_struct_map = true;
+        } else if (InstanceTypeChecker::IsAlwaysSharedSpaceJSObject(
+                       instance_type)) {
+          return ReduceResult::Fail();
+        } else {
+          has_unshared_map = true;
+        }
+        if (has_shared_struct_map && has_unshared_map) {
+          return ReduceResult::Fail();
+        }
       }
 
       compiler::PropertyAccessInfo access_info =
@@ -6371,6 +6557,25 @@ ReduceResult MaglevGraphBuilder::TryReduceDataViewPrototypeSetInt8(
         return value ? GetInt32(value) : GetInt32Constant(0);
       });
 }
+ReduceResult MaglevGraphBuilder::TryReduceDataViewPrototypeGetUint8(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  ReduceResult result = TryBuildLoadDataView<LoadSignedIntDataViewElement>(
+      args, ExternalArrayType::kExternalInt8Array);
+  if (!result.IsDoneWithValue()) return result;
+  // Zero-extend the sign-extended load.
+  return AddNewNode<Int32BitwiseAnd>({result.value(), GetInt32Constant(0xFF)});
+}
+ReduceResult MaglevGraphBuilder::TryReduceDataViewPrototypeSetUint8(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  // Only the low byte is stored, which is the same for signed and unsigned
+  // values.
+  return TryBuildStoreDataView<StoreSignedIntDataViewElement>(
+      args, ExternalArrayType::kExternalInt8Array, [&](ValueNode* value) {
+        return value ? GetTruncatedInt32ForToNumber(
+                           value, ToNumberHint::kAssumeNumberOrOddball)
+                     : GetInt32Constant(0);
+      });
+}
 ReduceResult MaglevGraphBuilder::TryReduceDataViewPrototypeGetInt16(
     compiler::JSFunctionRef target, CallArguments& args) {
   return TryBuildLoadDataView<LoadSignedIntDataViewElement>(
@@ -6383,6 +6588,24 @@ ReduceResult MaglevGraphBuilder::TryReduceDataViewPrototypeSetInt16(
         return value ? GetInt32(value) : GetInt32Constant(0);
       });
 }
+ReduceResult MaglevGraphBuilder::TryReduceDataViewPrototypeGetUint16(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  ReduceResult result = TryBuildLoadDataView<LoadSignedIntDataViewElement>(
+      args, ExternalArrayType::kExternalInt16Array);
+  if (!result.IsDoneWithValue()) return result;
+  // Zero-extend the sign-extended (and possibly byte swapped) load.
+  return AddNewNode<Int32BitwiseAnd>(
+      {result.value(), GetInt32Constant(0xFFFF)});
+}
+ReduceResult MaglevGraphBuilder::TryReduceDataViewPrototypeSetUint16(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  return TryBuildStoreDataView<StoreSignedIntDataViewElement>(
+      args, ExternalArrayType::kExternalInt16Array, [&](ValueNode* value) {
+        return value ? GetTruncatedInt32ForToNumber(
+                           value, ToNumberHint::kAssumeNumberOrOddball)
+                     : GetInt32Constant(0);
+      });
+}
 ReduceResult MaglevGraphBuilder::TryReduceDataViewPrototypeGetInt32(
     compiler::JSFunctionRef target, CallArguments& args) {
   return TryBuildLoadDataView<LoadSignedIntDataViewElement>(
@@ -6395,6 +6618,17 @@ ReduceResult MaglevGraphBuilder::TryReduceDataViewPrototypeSetInt32(
         return value ? GetInt32(value) : GetInt32Constant(0);
       });
 }
+ReduceResult MaglevGraphBuilder::TryReduceDataViewPrototypeSetUint32(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  // Values in the upper half of the uint32 range are not int32s, so truncate
+  // instead of checking, as ToUint32 would.
+  return TryBuildStoreDataView<StoreSignedIntDataViewElement>(
+      args, ExternalArrayType::kExternalInt32Array, [&](ValueNode* value) {
+        return value ? GetTruncatedInt32ForToNumber(
+                           value, ToNumberHint::kAssumeNumberOrOddball)
+                     : GetInt32Constant(0);
+      });
+}
 ReduceResult MaglevGraphBuilder::TryReduceDataViewPrototypeGetFloat64(
     compiler::JSFunctionRef target, CallArguments& args) {
   return TryBuildLoadDataView<LoadDoubleDataViewElement>(
@@ -6433,6 +6667,50 @@ ReduceResult MaglevGraphBuilder::TryReduceFunctionPrototypeCall(
   return ReduceCall(receiver, args, source, call_feedback.speculation_mode());
 }
 
+ReduceResult MaglevGraphBuilder::TryReduceFunctionPrototypeApply(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  // We can't reduce Function#apply when there is no receiver function.
+  if (args.receiver_mode() == ConvertReceiverMode::kNullOrUndefined) {
+    return ReduceResult::Fail();
+  }
+  ValueNode* receiver = GetTaggedOrUndefined(args.receiver());
+  args.PopReceiver(ConvertReceiverMode::kAny);
+
+  compiler::FeedbackSource source = current_speculation_feedback_;
+  SpeculationMode speculation_mode = SpeculationMode::kDisallowSpeculation;
+  if (source.IsValid()) {
+    // Reset speculation feedback source to no feedback.
+    current_speculation_feedback_ = compiler::FeedbackSource();
+    const compiler::ProcessedFeedback& processed_feedback =
+        broker()->GetFeedbackForCall(source);
+    DCHECK_EQ(processed_feedback.kind(), compiler::ProcessedFeedback::kCall);
+    speculation_mode = processed_feedback.AsCall().speculation_mode();
+  }
+
+  // Function#apply only considers two arguments, the new receiver and an
+  // array-like arguments list. All others are ignored.
+  args.Truncate(2);
+
+  auto is_null_or_undefined = [](ValueNode* node) {
+    RootConstant* constant = node->TryCast<RootConstant>();
+    return constant != nullptr &&
+           (constant->index() == RootIndex::kNullValue ||
+            constant->index() == RootIndex::kUndefinedValue);
+  };
+  if (args.count() < 2 || is_null_or_undefined(args[1])) {
+    // No need for an arguments list, we only have the new receiver.
+    args.Truncate(1);
+    return ReduceCall(receiver, args, source, speculation_mode);
+  }
+
+  // The arguments list is only known at runtime, so call through
+  // CallWithArrayLike, which copies arrays and arguments objects directly.
+  CallArguments new_args(ConvertReceiverMode::kAny,
+                         {GetTaggedValue(args[0]), GetTaggedValue(args[1])},
+                         CallArguments::kWithArrayLike);
+  return BuildGenericCall(receiver, Call::TargetType::kAny, new_args);
+}
+
 namespace {
 
 template <size_t MaxKindCount, typename KindsToIndexFunc>
@@ -6836,6 +7114,89 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayPrototypePop(
   return sub_graph.get(var_value);
 }
 
+ReduceResult MaglevGraphBuilder::TryReduceMapPrototypeGet(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  if (args.receiver_mode() == ConvertReceiverMode::kNullOrUndefined) {
+    if (v8_flags.trace_maglev_graph_building) {
+      std::cout << "  ! Failed to reduce Map.prototype.get - no receiver"
+                << std::endl;
+    }
+    return ReduceResult::Fail();
+  }
+  if (args.count() != 1) {
+    if (v8_flags.trace_maglev_graph_building) {
+      std::cout << "  ! Failed to reduce Map.prototype.get - invalid "
+                   "argument count"
+                << std::endl;
+    }
+    return ReduceResult::Fail();
+  }
+
+  ValueNode* receiver = GetTaggedOrUndefined(args.receiver());
+  auto receiver_info = known_node_aspects().TryGetInfoFor(receiver);
+  // If the map set is not found, then we don't know anything about the map of
+  // the receiver, so bail.
+  if (!receiver_info || !receiver_info->possible_maps_are_known()) {
+    if (v8_flags.trace_maglev_graph_building) {
+      std::cout
+          << "  ! Failed to reduce Map.prototype.get - unknown receiver map"
+          << std::endl;
+    }
+    return ReduceResult::Fail();
+  }
+
+  const PossibleMaps& possible_receiver_maps = receiver_info->possible_maps();
+  // If the set of possible maps is empty, then there's no possible map for
+  // this receiver, therefore this path is unreachable at runtime. We're
+  // unlikely to ever hit this case, BuildCheckMaps should already
+  // unconditionally deopt, but check it in case another checking operation
+  // fails to statically unconditionally deopt.
+  if (possible_receiver_maps.is_empty()) {
+    // TODO(leszeks): Add an unreachable assert here.
+    return ReduceResult::DoneWithAbort();
+  }
+
+  for (compiler::MapRef map : possible_receiver_maps) {
+    if (map.instance_type() != JS_MAP_TYPE) {
+      if (v8_flags.trace_maglev_graph_building) {
+        std::cout << "  ! Failed to reduce Map.prototype.get - receiver is "
+                     "not a JSMap"
+                  << std::endl;
+      }
+      return ReduceResult::Fail();
+    }
+  }
+
+  ValueNode* key = GetTaggedValue(args[0]);
+  ValueNode* table =
+      AddNewNode<LoadTaggedField>({receiver}, JSMap::kTableOffset);
+  ValueNode* entry =
+      BuildCallBuiltin<Builtin::kFindOrderedHashMapEntry>({table, key});
+
+  MaglevSubGraphBuilder sub_graph(this, 1);
+  MaglevSubGraphBuilder::Variable var_value(0);
+  MaglevSubGraphBuilder::Label done(
+      &sub_graph, 2,
+      std::initializer_list<MaglevSubGraphBuilder::Variable*>{&var_value});
+
+  // FindOrderedHashMapEntry returns -1 if the key isn't in the table.
+  sub_graph.set(var_value, GetRootConstant(RootIndex::kUndefinedValue));
+  sub_graph.GotoIfTrue<BranchIfReferenceEqual>(&done,
+                                               {entry, GetSmiConstant(-1)});
+
+  // Otherwise, it returns the start of the entry, relative to the start of
+  // the hash table.
+  ValueNode* index = AddNewNode<Int32AddWithOverflow>(
+      {AddNewNode<UnsafeSmiUntag>({entry}),
+       GetInt32Constant(OrderedHashMap::HashTableStartIndex() +
+                        OrderedHashMap::kValueOffset)});
+  sub_graph.set(var_value, AddNewNode<LoadFixedArrayElement>({table, index}));
+  sub_graph.Goto(&done);
+
+  sub_graph.Bind(&done);
+  return sub_graph.get(var_value);
+}
+
 ReduceResult MaglevGraphBuilder::TryReduceFunctionPrototypeHasInstance(
     compiler::JSFunctionRef target, CallArguments& args) {
   // We can't reduce Function#hasInstance when there is no receiver function.
@@ -7309,19 +7670,23 @@ ReduceResult MaglevGraphBuilder::TryBuildCallKnownJSFunction(
   }
   return TryBuildCallKnownJSFunction(context, closure, new_target, shared,
                                      function.feedback_vector(broker()), args,
-                                     feedback_source);
+                                     feedback_source, function);
 }
 
 ReduceResult MaglevGraphBuilder::TryBuildCallKnownJSFunction(
     ValueNode* context, ValueNode* function, ValueNode* new_target,
     compiler::SharedFunctionInfoRef shared,
     compiler::OptionalFeedbackVectorRef feedback_vector, CallArguments& args,
-    const compiler::FeedbackSource& feedback_source) {
+    const compiler::FeedbackSource& feedback_source,
+    compiler::OptionalJSFunctionRef known_function) {
   if (v8_flags.maglev_inlining) {
     RETURN_IF_DONE(TryBuildInlinedCall(context, function, new_target, shared,
                                        feedback_vector, args, feedback_source));
   }
   ValueNode* receiver = GetConvertReceiver(shared, args);
+  bool enter_through_interpreter =
+      known_function.has_value() && !shared.HasBuiltinId() &&
+      broker()->dependencies()->DependOnInterpreterEntry(*known_function);
   size_t input_count = args.count() + CallKnownJSFunction::kFixedInputCount;
   return AddNewNode<CallKnownJSFunction>(
       input_count,
@@ -7330,7 +7695,8 @@ ReduceResult MaglevGraphBuilder::TryBuildCallKnownJSFunction(
           call->set_arg(i, GetTaggedValue(args[i]));
         }
       },
-      shared, function, context, receiver, new_target);
+      shared, function, context, receiver, new_target,
+      enter_through_interpreter);
 }
 
 ReduceResult MaglevGraphBuilder::BuildCheckValue(ValueNode* node,
@@ -7584,6 +7950,37 @@ void MaglevGraphBuilder::BuildCallWithFeedback(
       DCHECK_EQ(CallFeedbackContent::kTarget, content);
     }
     RETURN_VOID_IF_ABORT(BuildCheckValue(target_node, feedback_target));
+  } else if (call_feedback.target().has_value() &&
+             call_feedback.target()->IsFeedbackCell() &&
+             call_feedback.call_feedback_content() ==
+                 CallFeedbackContent::kTarget) {
+    // Several closures of the same function have been called here. They all
+    // share the feedback cell, which gives us the SharedFunctionInfo and the
+    // feedback vector, so that the call can still be inlined.
+    compiler::FeedbackCellRef feedback_cell =
+        call_feedback.target()->AsFeedbackCell();
+    compiler::OptionalFeedbackVectorRef feedback_vector =
+        feedback_cell.feedback_vector(broker());
+    if (feedback_vector.has_value()) {
+      NodeType known_type;
+      EnsureType(target_node, NodeType::kCallable, &known_type);
+      AddNewNode<CheckInstanceType>({target_node}, GetCheckType(known_type),
+                                    FIRST_JS_FUNCTION_TYPE,
+                                    LAST_JS_FUNCTION_TYPE);
+      ValueNode* target_feedback_cell = AddNewNode<LoadTaggedField>(
+          {target_node}, JSFunction::kFeedbackCellOffset);
+      RETURN_VOID_IF_ABORT(
+          BuildCheckValue(target_feedback_cell, feedback_cell));
+      ValueNode* target_context = AddNewNode<LoadTaggedField>(
+          {target_node}, JSFunction::kContextOffset);
+      PROCESS_AND_RETURN_IF_DONE(
+          ReduceCallForNewClosure(
+              target_node, target_context,
+              feedback_vector->shared_function_info(broker()),
+              feedback_vector, args, feedback_source,
+              call_feedback.speculation_mode()),
+          SetAccumulator);
+    }
   }
 
   PROCESS_AND_RETURN_IF_DONE(ReduceCall(target_node, args, feedback_source,
@@ -8756,6 +9153,8 @@ void MaglevGraphBuilder::VisitCreateEmptyArrayLiteral() {
   }
   compiler::AllocationSiteRef site = processed_feedback.AsLiteral().value();
 
+  AllocationType allocation_type =
+      broker()->dependencies()->DependOnPretenureMode(site);
   broker()->dependencies()->DependOnElementsKind(site);
   ElementsKind kind = site.GetElementsKind();
 
@@ -8763,7 +9162,7 @@ void MaglevGraphBuilder::VisitCreateEmptyArrayLiteral() {
   compiler::MapRef map = native_context.GetInitialJSArrayMap(broker(), kind);
   FastObject literal(map, zone(), {});
   literal.js_array_length = MakeRef(broker(), Object::cast(Smi::zero()));
-  SetAccumulator(BuildAllocateFastObject(literal, AllocationType::kYoung));
+  SetAccumulator(BuildAllocateFastObject(literal, allocation_type));
   // TODO(leszeks): Don't eagerly clear the raw allocation, have the next side
   // effect clear it.
   ClearCurrentRawAllocation();
@@ -9222,12 +9621,46 @@ void MaglevGraphBuilder::VisitCreateClosure() {
 }
 
 void MaglevGraphBuilder::VisitCreateBlockContext() {
-  // TODO(v8:7700): Inline allocation when context is small.
-  // TODO(v8:7700): Update TryGetParentContext if this ever emits its own Node
-  // type.
   // CreateBlockContext <scope_info_idx>
-  ValueNode* scope_info = GetConstant(GetRefOperand<ScopeInfo>(0));
-  SetAccumulator(BuildCallRuntime(Runtime::kPushBlockContext, {scope_info}));
+  compiler::ScopeInfoRef scope_info = GetRefOperand<ScopeInfo>(0);
+  int context_length = scope_info.ContextLength();
+  if (context_length >= kBlockContextAllocationLimit || !v8_flags.inline_new) {
+    // TODO(v8:7700): Update TryGetParentContext if this ever emits its own
+    // Node type.
+    SetAccumulator(BuildCallRuntime(Runtime::kPushBlockContext,
+                                    {GetConstant(scope_info)}));
+    return;
+  }
+
+  // Inline allocation of small block contexts. The previous context and the
+  // initial slot values are recorded as known context slots, so that loads
+  // through the new context (including walks up the context chain) are
+  // resolved at graph building time.
+  ValueNode* previous = GetContext();
+  ValueNode* context = ExtendOrReallocateCurrentRawAllocation(
+      Context::SizeFor(context_length), AllocationType::kYoung);
+  AddNewNode<StoreMap>(
+      {context},
+      broker()->target_native_context().block_context_map(broker()));
+  AddNewNode<StoreTaggedFieldNoWriteBarrier>(
+      {context, GetSmiConstant(context_length)}, Context::kLengthOffset);
+  BuildStoreTaggedField(
+      context, GetConstant(scope_info),
+      Context::OffsetOfElementAt(Context::SCOPE_INFO_INDEX));
+  BuildStoreTaggedField(context, previous,
+                        Context::OffsetOfElementAt(Context::PREVIOUS_INDEX));
+  known_node_aspects().loaded_context_constants[{
+      context, Context::OffsetOfElementAt(Context::PREVIOUS_INDEX)}] = previous;
+  static_assert(Context::MIN_CONTEXT_SLOTS == 2);  // Ensure fully covered.
+  for (int i = Context::MIN_CONTEXT_SLOTS; i < context_length; ++i) {
+    ValueNode* undefined = GetRootConstant(RootIndex::kUndefinedValue);
+    AddNewNode<StoreTaggedFieldNoWriteBarrier>({context, undefined},
+                                               Context::OffsetOfElementAt(i));
+    known_node_aspects().loaded_context_slots[{
+        context, Context::OffsetOfElementAt(i)}] = undefined;
+  }
+  ClearCurrentRawAllocation();
+  SetAccumulator(context);
 }
 
 void MaglevGraphBuilder::VisitCreateCatchContext() {
@@ -10252,7 +10685,16 @@ void MaglevGraphBuilder::VisitSuspendGenerator() {
   interpreter::RegisterList args = iterator_.GetRegisterListOperand(1);
   uint32_t suspend_id = iterator_.GetUnsignedImmediateOperand(3);
 
-  int input_count = parameter_count_without_receiver() + args.register_count() +
+  // Registers past the last live one don't need to be stored at all, since
+  // the resumed code never reads them.
+  const compiler::BytecodeLivenessState* liveness = GetOutLiveness();
+  int register_count = args.register_count();
+  while (register_count > 0 &&
+         !liveness->RegisterIsLive(args[register_count - 1].index())) {
+    register_count--;
+  }
+
+  int input_count = parameter_count_without_receiver() + register_count +
                     GeneratorStore::kFixedInputCount;
   int debug_pos_offset = iterator_.current_offset() +
                          (BytecodeArray::kHeaderSize - kHeapObjectTag);
@@ -10263,8 +10705,7 @@ void MaglevGraphBuilder::VisitSuspendGenerator() {
         for (int i = 1 /* skip receiver */; i < parameter_count(); ++i) {
           node->set_parameters_and_registers(arg_index++, GetTaggedArgument(i));
         }
-        const compiler::BytecodeLivenessState* liveness = GetOutLiveness();
-        for (int i = 0; i < args.register_count(); ++i) {
+        for (int i = 0; i < register_count; ++i) {
           ValueNode* value = liveness->RegisterIsLive(args[i].index())
                                  ? GetTaggedValue(args[i])
                                  : GetRootConstant(RootIndex::kOptimizedOut);
@@ -10326,9 +10767,17 @@ void MaglevGraphBuilder::VisitDebugger() {
 }
 
 void MaglevGraphBuilder::VisitIncBlockCounter() {
-  ValueNode* closure = GetClosure();
-  ValueNode* coverage_array_slot = GetSmiConstant(iterator_.GetIndexOperand(0));
-  BuildCallBuiltin<Builtin::kIncBlockCounter>({closure, coverage_array_slot});
+  int coverage_array_slot = iterator_.GetIndexOperand(0);
+  // Without coverage info the IncBlockCounter builtin is a no-op. Coverage
+  // infos are only installed together with bytecode, and switching to a block
+  // coverage mode deoptimizes all code, so the counter can be dropped.
+  compiler::OptionalHeapObjectRef coverage_info =
+      compilation_unit_->shared_function_info().coverage_info(broker());
+  if (!coverage_info.has_value()) return;
+  AddNewNode<IncrementBlockCounter>(
+      {GetConstant(coverage_info.value())},
+      CoverageInfo::BlockCountOffset(coverage_array_slot),
+      local_isolate()->is_block_binary_code_coverage());
 }
 
 void MaglevGraphBuilder::VisitAbort() {
@@ -1748,15 +1748,22 @@ class MaglevGraphBuilder {
   V(ArrayForEach)                  \
   V(DataViewPrototypeGetInt8)      \
   V(DataViewPrototypeSetInt8)      \
+  V(DataViewPrototypeGetUint8)     \
+  V(DataViewPrototypeSetUint8)     \
   V(DataViewPrototypeGetInt16)     \
   V(DataViewPrototypeSetInt16)     \
+  V(DataViewPrototypeGetUint16)    \
+  V(DataViewPrototypeSetUint16)    \
   V(DataViewPrototypeGetInt32)     \
   V(DataViewPrototypeSetInt32)     \
+  V(DataViewPrototypeSetUint32)    \
   V(DataViewPrototypeGetFloat64)   \
   V(DataViewPrototypeSetFloat64)   \
+  V(FunctionPrototypeApply)        \
   V(FunctionPrototypeCall)         \
   V(FunctionPrototypeHasInstance)  \
   V(ObjectPrototypeHasOwnProperty) \
+  V(MapPrototypeGet)               \
   V(MathCeil)                      \
   V(MathFloor)                     \
   V(MathPow)                       \
@@ -1808,7 +1815,8 @@ class MaglevGraphBuilder {
       ValueNode* context, ValueNode* function, ValueNode* new_target,
       compiler::SharedFunctionInfoRef shared,
       compiler::OptionalFeedbackVectorRef feedback_vector, CallArguments& args,
-      const compiler::FeedbackSource& feedback_source);
+      const compiler::FeedbackSource& feedback_source,
+      compiler::OptionalJSFunctionRef known_function = {});
   bool ShouldInlineCall(compiler::SharedFunctionInfoRef shared,
                         compiler::OptionalFeedbackVectorRef feedback_vector,
                         float call_frequency);
@@ -1901,7 +1909,10 @@ class MaglevGraphBuilder {
   void BuildCheckHeapObject(ValueNode* object);
   void BuildCheckJSReceiver(ValueNode* object);
   void BuildCheckString(ValueNode* object);
+  bool IsEmptyStringConstant(ValueNode* node);
+  ValueNode* BuildStringConcat(ValueNode* left, ValueNode* right);
   void BuildCheckSymbol(ValueNode* object);
+  void BuildCheckBigInt(ValueNode* object);
   ReduceResult BuildCheckMaps(ValueNode* object,
                               base::Vector<const compiler::MapRef> maps);
   ReduceResult BuildTransitionElementsKindOrCheckMap(
@@ -1980,6 +1991,10 @@ class MaglevGraphBuilder {
       ValueNode* receiver, ValueNode* lookup_start_object,
       compiler::NameRef name, compiler::PropertyAccessInfo const& access_info,
       compiler::AccessMode access_mode);
+  ReduceResult TryBuildNamedAccessOnProxy(
+      ValueNode* receiver, compiler::NameRef name,
+      base::Vector<const compiler::MapRef> maps,
+      compiler::AccessMode access_mode);
   ReduceResult TryBuildNamedAccess(
       ValueNode* receiver, ValueNode* lookup_start_object,
       compiler::NamedAccessFeedback const& feedback,
@@ -2085,6 +2100,8 @@ class MaglevGraphBuilder {
   void BuildGenericBinaryOperationNode();
   template <Operation kOperation>
   void BuildGenericBinarySmiOperationNode();
+  template <Operation kOperation>
+  void BuildBigIntBinaryOperationNode();
 
   template <Operation kOperation>
   bool TryReduceCompareEqualAgainstConstant();
@@ -3885,6 +3885,16 @@ void GeneratorStore::GenerateCode(MaglevAssembler* masm,
     // it's not in the register snapshot, but that's ok, and a clobberable value
     // register lets the write barrier emit slightly better code.
     Input value_input = parameters_and_registers(i);
+    // Dead registers are stored as read-only roots, which need no write
+    // barrier.
+    if (RootConstant* root = value_input.node()->TryCast<RootConstant>();
+        root != nullptr && RootsTable::IsReadOnly(root->index())) {
+      Register value = WriteBarrierDescriptor::SlotAddressRegister();
+      __ LoadRoot(value, root->index());
+      __ StoreTaggedFieldNoWriteBarrier(array, FixedArray::OffsetOfElementAt(i),
+                                        value);
+      continue;
+    }
     Register value = __ FromAnyToRegister(
         value_input, WriteBarrierDescriptor::SlotAddressRegister());
     // Include the value register in the live set, in case it is used by future
@@ -4109,6 +4119,24 @@ void StoreTaggedFieldNoWriteBarrier::GenerateCode(
   __ StoreTaggedFieldNoWriteBarrier(object, offset(), value);
 }
 
+void IncrementBlockCounter::SetValueLocationConstraints() {
+  UseRegister(coverage_info_input());
+}
+void IncrementBlockCounter::GenerateCode(MaglevAssembler* masm,
+                                         const ProcessingState& state) {
+  Register coverage_info = ToRegister(coverage_info_input());
+  if (binary()) {
+    __ StoreInt32Field(coverage_info, offset(), 1);
+    return;
+  }
+  MaglevAssembler::ScratchRegisterScope temps(masm);
+  Register count = temps.GetDefaultScratchRegister();
+  MemOperand operand = FieldMemOperand(coverage_info, offset());
+  __ LoadSignedField(count, operand, sizeof(int32_t));
+  __ IncrementInt32(count);
+  __ StoreField(operand, count, sizeof(int32_t));
+}
+
 int StringAt::MaxCallStackArgs() const {
   DCHECK_EQ(Runtime::FunctionForId(Runtime::kStringCharCodeAt)->nargs, 2);
   return std::max(2, AllocateDescriptor::GetStackParameterCount());
@@ -5020,6 +5048,8 @@ void CallKnownJSFunction::GenerateCode(MaglevAssembler* masm,
   __ Move(kJavaScriptCallArgCountRegister, actual_parameter_count);
   if (shared_function_info().HasBuiltinId()) {
     __ CallBuiltin(shared_function_info().builtin_id());
+  } else if (enter_through_interpreter()) {
+    __ CallBuiltin(Builtin::kInterpreterEntryTrampoline);
   } else {
     __ CallJSFunction(kJavaScriptCallTargetRegister);
   }
@@ -6513,6 +6543,13 @@ void StoreFloat64::PrintParams(std::ostream& os,
   os << "(0x" << std::hex << offset() << std::dec << ")";
 }
 
+void IncrementBlockCounter::PrintParams(
+    std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
+  os << "(0x" << std::hex << offset() << std::dec;
+  if (binary()) os << ", binary";
+  os << ")";
+}
+
 void StoreTaggedFieldNoWriteBarrier::PrintParams(
     std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
   os << "(0x" << std::hex << offset() << std::dec << ")";
@@ -6638,7 +6675,9 @@ void CallSelf::PrintParams(std::ostream& os,
 
 void CallKnownJSFunction::PrintParams(
     std::ostream& os, MaglevGraphLabeller* graph_labeller) const {
-  os << "(" << shared_function_info_.object() << ")";
+  os << "(" << shared_function_info_.object();
+  if (enter_through_interpreter_) os << ", interpreter entry";
+  os << ")";
 }
 
 void CallKnownApiFunction::PrintParams(
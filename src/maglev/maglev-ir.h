@@ -306,6 +306,7 @@ class MergePointInterpreterFrameState;
   V(StoreTaggedFieldNoWriteBarrier)         \
   V(StoreTaggedFieldWithWriteBarrier)       \
   V(HandleNoHeapWritesInterrupt)            \
+  V(IncrementBlockCounter)                  \
   V(ReduceInterruptBudgetForLoop)           \
   V(ReduceInterruptBudgetForReturn)         \
   V(ThrowReferenceErrorIfHole)              \
@@ -494,7 +495,7 @@ inline constexpr bool IsDoubleRepresentation(ValueRepresentation repr) {
  * Here is a diagram of the relations between the types, where (*) means that
  * they have the kAnyHeapObject bit set.
  *
- *    NumberOrOddball              JsReceiver*            Name*
+ *    NumberOrOddball              JsReceiver*            Name*         BigInt*
  *     /         \                     |                 /    \
  *  Oddball*     Number             Callable*        String*  Symbol*
  *    |          /    \                                |
@@ -516,6 +517,7 @@ inline constexpr bool IsDoubleRepresentation(ValueRepresentation repr) {
   V(Symbol, (1 << 11) | kName)                             \
   V(JSReceiver, (1 << 12) | kAnyHeapObject)                \
   V(Callable, (1 << 13) | kJSReceiver | kAnyHeapObject)    \
+  V(BigInt, (1 << 14) | kAnyHeapObject)                    \
   V(HeapNumber, kAnyHeapObject | kNumber)
 
 enum class NodeType : uint16_t {
@@ -542,6 +544,7 @@ inline NodeType StaticTypeForMap(compiler::MapRef map) {
   if (map.IsInternalizedStringMap()) return NodeType::kInternalizedString;
   if (map.IsStringMap()) return NodeType::kString;
   if (map.IsJSReceiverMap()) return NodeType::kJSReceiver;
+  if (map.IsBigIntMap()) return NodeType::kBigInt;
   return NodeType::kAnyHeapObject;
 }
 
@@ -582,6 +585,8 @@ inline bool IsInstanceOfNodeType(compiler::MapRef map, NodeType type,
       return map.IsJSReceiverMap();
     case NodeType::kCallable:
       return map.is_callable();
+    case NodeType::kBigInt:
+      return map.IsBigIntMap();
   }
 
     // This is some composed type. We could speed this up by exploiting the tree
@@ -7756,12 +7761,14 @@ class CallKnownJSFunction : public ValueNodeT<CallKnownJSFunction> {
   CallKnownJSFunction(uint64_t bitfield,
                       compiler::SharedFunctionInfoRef shared_function_info,
                       ValueNode* closure, ValueNode* context,
-                      ValueNode* receiver, ValueNode* new_target)
+                      ValueNode* receiver, ValueNode* new_target,
+                      bool enter_through_interpreter = false)
       : Base(bitfield),
         shared_function_info_(shared_function_info),
         expected_parameter_count_(
             shared_function_info
-                .internal_formal_parameter_count_with_receiver()) {
+                .internal_formal_parameter_count_with_receiver()),
+        enter_through_interpreter_(enter_through_interpreter) {
     set_input(kClosureIndex, closure);
     set_input(kContextIndex, context);
     set_input(kReceiverIndex, receiver);
@@ -7789,6 +7796,9 @@ class CallKnownJSFunction : public ValueNodeT<CallKnownJSFunction> {
   compiler::SharedFunctionInfoRef shared_function_info() const {
     return shared_function_info_;
   }
+  // Whether the callee is called through the InterpreterEntryTrampoline
+  // directly, see CompilationDependencies::DependOnInterpreterEntry.
+  bool enter_through_interpreter() const { return enter_through_interpreter_; }
 
   void VerifyInputs(MaglevGraphLabeller* graph_labeller) const;
 #ifdef V8_COMPRESS_POINTERS
@@ -7804,6 +7814,7 @@ class CallKnownJSFunction : public ValueNodeT<CallKnownJSFunction> {
   // Cache the expected parameter count so that we can access it in
   // MaxCallStackArgs without needing to unpark the local isolate.
   int expected_parameter_count_;
+  const bool enter_through_interpreter_;
 };
 
 class CallKnownApiFunction : public ValueNodeT<CallKnownApiFunction> {
@@ -8104,6 +8115,34 @@ class ReduceInterruptBudgetForLoop
   const int amount_;
 };
 
+// Updates a block coverage counter in place, replacing a call to the
+// IncBlockCounter builtin. In binary mode, only a non-zero count is stored.
+class IncrementBlockCounter : public FixedInputNodeT<1, IncrementBlockCounter> {
+  using Base = FixedInputNodeT<1, IncrementBlockCounter>;
+
+ public:
+  explicit IncrementBlockCounter(uint64_t bitfield, int offset, bool binary)
+      : Base(bitfield), offset_(offset), binary_(binary) {}
+
+  static constexpr OpProperties kProperties = OpProperties::CanWrite();
+  static constexpr typename Base::InputTypes kInputTypes{
+      ValueRepresentation::kTagged};
+
+  int offset() const { return offset_; }
+  bool binary() const { return binary_; }
+
+  Input& coverage_info_input() { return input(0); }
+
+  int MaxCallStackArgs() const { return 0; }
+  void SetValueLocationConstraints();
+  void GenerateCode(MaglevAssembler*, const ProcessingState&);
+  void PrintParams(std::ostream&, MaglevGraphLabeller*) const;
+
+ private:
+  const int offset_;
+  const bool binary_;
+};
+
 class ReduceInterruptBudgetForReturn
     : public FixedInputNodeT<0, ReduceInterruptBudgetForReturn> {
   using Base = FixedInputNodeT<0, ReduceInterruptBudgetForReturn>;
@@ -24,6 +24,13 @@ MaglevPipelineStatistics::MaglevPipelineStatistics(
 
 MaglevPipelineStatistics::~MaglevPipelineStatistics() {
   if (Base::InPhaseKind()) EndPhaseKind();
+  // Report per-job totals so that outlier compilations (in time or zone
+  // memory) can be identified from a trace.
+  CompilationStatistics::BasicStats diff;
+  Base::EndTotal(&diff);
+  TRACE_EVENT_INSTANT2(kTraceCategory, "V8.MaglevJobStats", TRACE_EVENT_SCOPE_THREAD,
+                       "kind", CodeKindToString(code_kind()), "stats",
+                       TRACE_STR_COPY(diff.AsJSON().c_str()));
 }
 
 void MaglevPipelineStatistics::BeginPhaseKind(const char* name) {
@@ -2171,6 +2171,47 @@ void StraightForwardRegisterAllocator::HoistLoopSpills(BasicBlock* target) {
   }
 }
 
+// Values that are live across a loop but not used in it would otherwise keep
+// a register for the whole loop or, if the loop contains calls, be reloaded on
+// every back-edge to match the register state of the loop header. Instead,
+// split their live range: keep them spilled while in the loop, and reload them
+// at their first use after the loop. Without calls, this is only done when the
+// registers are needed for values that are used in the loop.
+template <typename RegisterT>
+void StraightForwardRegisterAllocator::SpillValuesUnusedInLoop(
+    BasicBlock* target, RegisterFrameState<RegisterT>& registers) {
+  DCHECK(target->is_loop());
+  if (target->state()->is_resumable_loop()) return;
+  BasicBlock* back_edge =
+      target->predecessor_at(target->predecessor_count() - 1);
+  DCHECK(back_edge->control_node()->Is<JumpLoop>());
+  NodeIdT loop_end = back_edge->control_node()->id();
+
+  int needed = 0;
+  if (!target->loop_has_calls()) {
+    for (ValueNode* node : target->reload_hints()) {
+      if (node->has_register() || !node->is_loadable()) continue;
+      if (node->use_double_register() !=
+          std::is_same_v<RegisterT, DoubleRegister>) {
+        continue;
+      }
+      needed++;
+    }
+    needed -= static_cast<int>(registers.free().Count());
+    if (needed <= 0) return;
+  }
+
+  // Nodes that are used in the loop have a use on the JumpLoop at the latest,
+  // so the other ones are the nodes whose next use is after the loop.
+  const bool kForceSpill = true;
+  for (RegisterT reg : registers.used()) {
+    ValueNode* node = registers.GetValue(reg);
+    if (node->current_next_use() <= loop_end) continue;
+    DropRegisterValueAtEnd(reg, kForceSpill);
+    if (!target->loop_has_calls() && --needed == 0) break;
+  }
+}
+
 void StraightForwardRegisterAllocator::InitializeBranchTargetRegisterValues(
     ControlNode* source, BasicBlock* target) {
   MergePointRegisterState& target_state = target->state()->register_state();
@@ -2184,6 +2225,10 @@ void StraightForwardRegisterAllocator::InitializeBranchTargetRegisterValues(
     }
     state = {node, initialized_node};
   };
+  if (v8_flags.maglev_regalloc_split_around_loops && target->is_loop()) {
+    SpillValuesUnusedInLoop(target, general_registers_);
+    SpillValuesUnusedInLoop(target, double_registers_);
+  }
   HoistLoopReloads(target, general_registers_);
   HoistLoopReloads(target, double_registers_);
   HoistLoopSpills(target);
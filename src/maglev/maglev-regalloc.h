@@ -273,6 +273,9 @@ class StraightForwardRegisterAllocator {
   void HoistLoopReloads(BasicBlock* target,
                         RegisterFrameState<RegisterT>& registers);
   void HoistLoopSpills(BasicBlock* target);
+  template <typename RegisterT>
+  void SpillValuesUnusedInLoop(BasicBlock* target,
+                               RegisterFrameState<RegisterT>& registers);
   void InitializeBranchTargetRegisterValues(ControlNode* source,
                                             BasicBlock* target);
   void InitializeEmptyBlockRegisterValues(ControlNode* source,
@@ -4,9 +4,15 @@
 
 #include "src/objects/backing-store.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <unordered_map>
+#include <vector>
 
 #include "src/base/bits.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/execution/isolate.h"
 #include "src/handles/global-handles.h"
 #include "src/logging/counters.h"
@@ -36,7 +42,6 @@ constexpr uint64_t kNegativeGuardSize = uint64_t{2} * GB;
 
 #if V8_TARGET_ARCH_64_BIT
 constexpr uint64_t kFullGuardSize32 = uint64_t{10} * GB;
-constexpr uint64_t kFullGuardSize64 = uint64_t{32} * GB;
 #endif
 
 #endif  // V8_ENABLE_WEBASSEMBLY
@@ -67,13 +72,11 @@ base::AddressRegion GetReservedRegion(bool has_guard_regions,
     DCHECK_EQ(0, start % AllocatePageSize());
     if (is_wasm_memory64) {
       DCHECK(v8_flags.wasm_memory64_trap_handling);
-      static_assert(kFullGuardSize64 ==
-                    2 * wasm::kV8MaxWasmMemory64Pages * wasm::kWasmPageSize);
       DCHECK_LE(byte_capacity,
-                wasm::kV8MaxWasmMemory64Pages * wasm::kWasmPageSize);
+                wasm::WasmMemory::GetMemory64GuardRegionsMaxSize());
       return base::AddressRegion(
-          start,
-          1ULL << wasm::WasmMemory::GetMemory64GuardsShift(byte_capacity));
+          start, static_cast<size_t>(
+                     wasm::WasmMemory::GetMemory64GuardsSize()));
     } else {
       // Guard regions always look like this:
       // |xxx(2GiB)xxx|.......(4GiB)..xxxxx|xxxxxx(4GiB)xxxxxx|
@@ -98,11 +101,9 @@ size_t GetReservationSize(bool has_guard_regions, size_t byte_capacity,
   if (has_guard_regions) {
     if (is_wasm_memory64) {
       DCHECK(v8_flags.wasm_memory64_trap_handling);
-      static_assert(kFullGuardSize64 ==
-                    2 * wasm::kV8MaxWasmMemory64Pages * wasm::kWasmPageSize);
       DCHECK_LE(byte_capacity,
-                wasm::kV8MaxWasmMemory64Pages * wasm::kWasmPageSize);
-      return 1ULL << wasm::WasmMemory::GetMemory64GuardsShift(byte_capacity);
+                wasm::WasmMemory::GetMemory64GuardRegionsMaxSize());
+      return static_cast<size_t>(wasm::WasmMemory::GetMemory64GuardsSize());
     } else {
       static_assert(kFullGuardSize32 >= size_t{4} * GB);
       DCHECK_LE(byte_capacity, size_t{4} * GB);
@@ -123,6 +124,101 @@ void RecordStatus(Isolate* isolate, AllocationStatus status) {
 
 }  // namespace
 
+namespace {
+
+// Keeps recently released JSArrayBuffer backing stores of small and medium
+// size around so that new array buffers of the same length can reuse them
+// instead of going through the embedder's allocator, see
+// --array-buffer-pool-size-kb. Buffers are zeroed when they are returned to
+// the pool, which usually happens on a background thread of the
+// ArrayBufferSweeper. Entries hold a reference to their allocator, so only
+// backing stores allocated through a shared allocator are pooled.
+class BackingStorePool {
+ public:
+  static constexpr size_t kMinPooledLength = 4 * KB;
+  static constexpr size_t kMaxPooledLength = 64 * KB;
+
+  static bool IsPoolable(size_t byte_length) {
+    return v8_flags.array_buffer_pool_size_kb > 0 &&
+           byte_length >= kMinPooledLength && byte_length <= kMaxPooledLength;
+  }
+
+  // Returns true if the pool took ownership of {buffer}.
+  bool Put(const std::shared_ptr<v8::ArrayBuffer::Allocator>& allocator,
+           void* buffer, size_t byte_length) {
+    DCHECK(IsPoolable(byte_length));
+    if (!HasCapacityFor(byte_length)) return false;
+    memset(buffer, 0, byte_length);
+    base::MutexGuard guard(&mutex_);
+    if (!HasCapacityFor(byte_length)) return false;
+    entries_by_length_[byte_length].push_back({allocator, buffer});
+    pooled_bytes_.fetch_add(byte_length, std::memory_order_relaxed);
+    return true;
+  }
+
+  // Returns a zero-initialized buffer of exactly {byte_length} bytes that was
+  // allocated by {allocator}, or nullptr.
+  void* Take(v8::ArrayBuffer::Allocator* allocator, size_t byte_length) {
+    DCHECK(IsPoolable(byte_length));
+    if (pooled_bytes_.load(std::memory_order_relaxed) == 0) return nullptr;
+    base::MutexGuard guard(&mutex_);
+    auto it = entries_by_length_.find(byte_length);
+    if (it == entries_by_length_.end()) return nullptr;
+    std::vector<Entry>& entries = it->second;
+    for (auto entry = entries.rbegin(); entry != entries.rend(); ++entry) {
+      if (entry->allocator.get() != allocator) continue;
+      void* buffer = entry->buffer;
+      entries.erase(std::next(entry).base());
+      pooled_bytes_.fetch_sub(byte_length, std::memory_order_relaxed);
+      return buffer;
+    }
+    return nullptr;
+  }
+
+  // Frees all pooled buffers allocated by {allocator}, or all pooled buffers
+  // if {allocator} is nullptr.
+  void Release(v8::ArrayBuffer::Allocator* allocator) {
+    std::vector<std::pair<Entry, size_t>> released;
+    {
+      base::MutexGuard guard(&mutex_);
+      for (auto& [byte_length, entries] : entries_by_length_) {
+        auto keep = std::partition(
+            entries.begin(), entries.end(), [allocator](const Entry& entry) {
+              return allocator != nullptr && entry.allocator.get() != allocator;
+            });
+        for (auto it = keep; it != entries.end(); ++it) {
+          released.emplace_back(std::move(*it), byte_length);
+          pooled_bytes_.fetch_sub(byte_length, std::memory_order_relaxed);
+        }
+        entries.erase(keep, entries.end());
+      }
+    }
+    // Call into the embedder outside of the lock.
+    for (auto& [entry, byte_length] : released) {
+      entry.allocator->Free(entry.buffer, byte_length);
+    }
+  }
+
+ private:
+  struct Entry {
+    std::shared_ptr<v8::ArrayBuffer::Allocator> allocator;
+    void* buffer;
+  };
+
+  bool HasCapacityFor(size_t byte_length) const {
+    return pooled_bytes_.load(std::memory_order_relaxed) + byte_length <=
+           static_cast<size_t>(v8_flags.array_buffer_pool_size_kb) * KB;
+  }
+
+  base::Mutex mutex_;
+  std::unordered_map<size_t, std::vector<Entry>> entries_by_length_;
+  std::atomic<size_t> pooled_bytes_{0};
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(BackingStorePool, GetBackingStorePool)
+
+}  // namespace
+
 // The backing store for a Wasm shared memory remembers all the isolates
 // with which it has been shared.
 struct SharedWasmMemoryData {
@@ -226,6 +322,15 @@ BackingStore::~BackingStore() {
   }
 
   // JSArrayBuffer backing store. Deallocate through the embedder's allocator.
+  if (holds_shared_ptr_to_allocator_ && !is_shared_ &&
+      BackingStorePool::IsPoolable(byte_length_) &&
+      GetBackingStorePool()->Put(
+          type_specific_data_.v8_api_array_buffer_allocator_shared,
+          buffer_start_, byte_length_)) {
+    TRACE_BS("BS:pool   bs=%p mem=%p (length=%zu)\n", this, buffer_start_,
+             byte_length());
+    return;
+  }
   auto allocator = get_v8_api_array_buffer_allocator();
   TRACE_BS("BS:free   bs=%p mem=%p (length=%zu, capacity=%zu)\n", this,
            buffer_start_, byte_length(), byte_capacity_);
@@ -248,7 +353,16 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
     if (shared == SharedFlag::kShared) {
       counters->shared_array_allocations()->AddSample(mb_length);
     }
-    auto allocate_buffer = [allocator, initialized](size_t byte_length) {
+    auto allocate_buffer = [allocator, initialized,
+                            shared](size_t byte_length) -> void* {
+      // Pooled buffers are always zero-initialized.
+      if (shared == SharedFlag::kNotShared &&
+          BackingStorePool::IsPoolable(byte_length)) {
+        if (void* pooled =
+                GetBackingStorePool()->Take(allocator, byte_length)) {
+          return pooled;
+        }
+      }
       if (initialized == InitializedFlag::kUninitialized) {
         return allocator->AllocateUninitialized(byte_length);
       }
@@ -291,6 +405,11 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
   return std::unique_ptr<BackingStore>(result);
 }
 
+// static
+void BackingStore::ReleasePooledMemory(v8::ArrayBuffer::Allocator* allocator) {
+  GetBackingStorePool()->Release(allocator);
+}
+
 void BackingStore::SetAllocatorFromIsolate(Isolate* isolate) {
   if (auto allocator_shared = isolate->array_buffer_allocator_shared()) {
     holds_shared_ptr_to_allocator_ = true;
@@ -319,9 +438,14 @@ std::unique_ptr<BackingStore> BackingStore::TryAllocateAndPartiallyCommitMemory(
 
 #if V8_ENABLE_WEBASSEMBLY
   bool is_wasm_memory64 = wasm_memory == WasmMemoryFlag::kWasmMemory64;
+  // Memory64 memories only get guard regions if their maximum fits into the
+  // configured guard region size; this has to match the bounds check strategy
+  // chosen in {wasm::UpdateComputedInformation}.
   bool guards = trap_handler::IsTrapHandlerEnabled() &&
                 (wasm_memory == WasmMemoryFlag::kWasmMemory32 ||
-                 (is_wasm_memory64 && v8_flags.wasm_memory64_trap_handling));
+                 (is_wasm_memory64 && v8_flags.wasm_memory64_trap_handling &&
+                  maximum_pages * page_size <=
+                      wasm::WasmMemory::GetMemory64GuardRegionsMaxSize()));
 #else
   CHECK_EQ(WasmMemoryFlag::kNotWasm, wasm_memory);
   constexpr bool is_wasm_memory64 = false;
@@ -604,15 +728,6 @@ BackingStore::ResizeOrGrowResult BackingStore::ResizeInPlace(
   DCHECK(!is_shared());
 
   if (new_byte_length < byte_length_) {
-    // Zero the memory so that in case the buffer is grown later, we have
-    // zeroed the contents already. This is especially needed for the portion of
-    // the memory we're not going to decommit below (since it belongs to a
-    // committed page). In addition, we don't rely on all platforms always
-    // zeroing decommitted-then-recommitted memory, but zero the memory
-    // explicitly here.
-    memset(reinterpret_cast<uint8_t*>(buffer_start_) + new_byte_length, 0,
-           byte_length_ - new_byte_length);
-
     // Check if we can un-commit some pages.
     size_t old_committed_pages;
     round_return_value =
@@ -621,13 +736,20 @@ BackingStore::ResizeOrGrowResult BackingStore::ResizeInPlace(
     CHECK(round_return_value);
     DCHECK_LE(new_committed_pages, old_committed_pages);
 
+    // Zero the memory that stays committed so that in case the buffer is grown
+    // later, we have zeroed the contents already. Pages beyond that are
+    // decommitted below, which guarantees that they read as zero once they
+    // are committed again, so there is no need to touch (and thereby fault
+    // in) them first. This keeps shrinking a large buffer cheap.
+    size_t zeroed_end = std::min(byte_length_, new_committed_length);
+    memset(reinterpret_cast<uint8_t*>(buffer_start_) + new_byte_length, 0,
+           zeroed_end - new_byte_length);
+
     if (new_committed_pages < old_committed_pages) {
       size_t old_committed_length = old_committed_pages * page_size;
-      if (!i::SetPermissions(
-              GetPlatformPageAllocator(),
+      if (!GetArrayBufferPageAllocator()->DecommitPages(
               reinterpret_cast<uint8_t*>(buffer_start_) + new_committed_length,
-              old_committed_length - new_committed_length,
-              PageAllocator::kNoAccess)) {
+              old_committed_length - new_committed_length)) {
         return kFailure;
       }
     }
@@ -644,10 +766,17 @@ BackingStore::ResizeOrGrowResult BackingStore::ResizeInPlace(
     return kSuccess;
   }
 
-  // Try to adjust the permissions on the memory.
-  if (!i::SetPermissions(GetPlatformPageAllocator(), buffer_start_,
-                         new_committed_length, PageAllocator::kReadWrite)) {
-    return kFailure;
+  // Try to adjust the permissions on the memory. If committing fails, signal
+  // critical memory pressure (which frees unreachable buffers and returns
+  // their pages to the OS) and try once more before giving up.
+  auto commit = [&] {
+    return i::SetPermissions(GetPlatformPageAllocator(), buffer_start_,
+                             new_committed_length, PageAllocator::kReadWrite);
+  };
+  if (!commit()) {
+    isolate->heap()->MemoryPressureNotification(MemoryPressureLevel::kCritical,
+                                                true);
+    if (!commit()) return kFailure;
   }
 
   // Do per-isolate accounting for non-shared backing stores.
@@ -142,6 +142,11 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
   static void UpdateSharedWasmMemoryObjects(Isolate* isolate);
 #endif  // V8_ENABLE_WEBASSEMBLY
 
+  // Frees the memory of released backing stores that are kept for reuse, see
+  // --array-buffer-pool-size-kb, and that were allocated by {allocator}.
+  // Passing nullptr frees all of them.
+  static void ReleasePooledMemory(v8::ArrayBuffer::Allocator* allocator);
+
   // Returns the size of the external memory owned by this backing store.
   // It is used for triggering GCs based on the external memory pressure.
   size_t PerIsolateAccountingLength() {
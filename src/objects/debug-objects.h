@@ -186,6 +186,12 @@ class CoverageInfo
     return OBJECT_POINTER_ALIGN(kHeaderSize + slot_count * Slot::kSize);
   }
 
+  // Offset of the block counter of the given slot, used by optimized code to
+  // update counters without calling into the IncBlockCounter builtin.
+  static int BlockCountOffset(int slot_index) {
+    return kHeaderSize + slot_index * Slot::kSize + Slot::kBlockCountOffset;
+  }
+
   // Print debug info.
   void CoverageInfoPrint(std::ostream& os,
                          std::unique_ptr<char[]> function_name = nullptr);
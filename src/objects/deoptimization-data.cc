@@ -156,24 +156,45 @@ void DeoptimizationData::PrintDeoptimizationData(std::ostream& os) const {
 
 #endif  // ENABLE_DISASSEMBLER
 
+UncompressedFrameTranslationCache::Contents
+UncompressedFrameTranslationCache::Lookup(
+    Tagged<DeoptimizationFrameTranslation> buffer) const {
+  auto it = entries_.find(buffer.ptr());
+  return it == entries_.end() ? nullptr : it->second;
+}
+
+void UncompressedFrameTranslationCache::Insert(
+    Tagged<DeoptimizationFrameTranslation> buffer, Contents contents) {
+  if (entries_.size() >= kMaxEntries) entries_.clear();
+  entries_[buffer.ptr()] = std::move(contents);
+}
+
 DeoptimizationFrameTranslation::Iterator::Iterator(
-    Tagged<DeoptimizationFrameTranslation> buffer, int index)
+    Tagged<DeoptimizationFrameTranslation> buffer, int index,
+    UncompressedFrameTranslationCache* cache)
     : buffer_(buffer), index_(index) {
 #ifdef V8_USE_ZLIB
   if (V8_UNLIKELY(v8_flags.turbo_compress_frame_translations)) {
-    const int size = buffer_->get_int(kUncompressedSizeOffset);
-    uncompressed_contents_.insert(uncompressed_contents_.begin(), size, 0);
-
-    uLongf uncompressed_size =
-        size * kDeoptimizationFrameTranslationElementSize;
-
-    CHECK_EQ(zlib_internal::UncompressHelper(
-                 zlib_internal::ZRAW,
-                 reinterpret_cast<Bytef*>(uncompressed_contents_.data()),
-                 &uncompressed_size, buffer_->begin() + kCompressedDataOffset,
-                 buffer_->DataSize()),
-             Z_OK);
-    DCHECK(index >= 0 && index < size);
+    if (cache != nullptr) uncompressed_contents_ = cache->Lookup(buffer);
+    if (!uncompressed_contents_) {
+      const int size = buffer_->get_int(kUncompressedSizeOffset);
+      auto contents = std::make_shared<std::vector<int32_t>>(size, 0);
+
+      uLongf uncompressed_size =
+          size * kDeoptimizationFrameTranslationElementSize;
+
+      CHECK_EQ(zlib_internal::UncompressHelper(
+                   zlib_internal::ZRAW,
+                   reinterpret_cast<Bytef*>(contents->data()),
+                   &uncompressed_size,
+                   buffer_->begin() + kCompressedDataOffset,
+                   buffer_->DataSize()),
+               Z_OK);
+      uncompressed_contents_ = std::move(contents);
+      if (cache != nullptr) cache->Insert(buffer, uncompressed_contents_);
+    }
+    DCHECK(index >= 0 &&
+           index < static_cast<int>(uncompressed_contents_->size()));
     return;
   }
 #endif  // V8_USE_ZLIB
@@ -187,7 +208,7 @@ DeoptimizationFrameTranslation::Iterator::Iterator(
 
 int32_t DeoptimizationFrameTranslation::Iterator::NextOperand() {
   if (V8_UNLIKELY(v8_flags.turbo_compress_frame_translations)) {
-    return uncompressed_contents_[index_++];
+    return (*uncompressed_contents_)[index_++];
   } else if (remaining_ops_to_use_from_previous_translation_) {
     int32_t value = base::VLQDecode(buffer_->begin(), &previous_index_);
     DCHECK_LT(previous_index_, index_);
@@ -218,7 +239,7 @@ DeoptimizationFrameTranslation::Iterator::NextUnsignedOperandAtPreviousIndex() {
 
 uint32_t DeoptimizationFrameTranslation::Iterator::NextOperandUnsigned() {
   if (V8_UNLIKELY(v8_flags.turbo_compress_frame_translations)) {
-    return uncompressed_contents_[index_++];
+    return (*uncompressed_contents_)[index_++];
   } else if (remaining_ops_to_use_from_previous_translation_) {
     return NextUnsignedOperandAtPreviousIndex();
   } else {
@@ -328,7 +349,7 @@ TranslationOpcode DeoptimizationFrameTranslation::Iterator::SeekNextFrame() {
 
 bool DeoptimizationFrameTranslation::Iterator::HasNextOpcode() const {
   if (V8_UNLIKELY(v8_flags.turbo_compress_frame_translations)) {
-    return index_ < static_cast<int>(uncompressed_contents_.size());
+    return index_ < static_cast<int>(uncompressed_contents_->size());
   } else {
     return index_ < buffer_->length() ||
            remaining_ops_to_use_from_previous_translation_ > 1;
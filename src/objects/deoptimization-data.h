@@ -5,6 +5,8 @@
 #ifndef V8_OBJECTS_DEOPTIMIZATION_DATA_H_
 #define V8_OBJECTS_DEOPTIMIZATION_DATA_H_
 
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "src/objects/bytecode-array.h"
@@ -74,9 +76,31 @@ class DeoptimizationFrameTranslation : public ByteArray {
   OBJECT_CONSTRUCTORS(DeoptimizationFrameTranslation, ByteArray);
 };
 
+// Keeps the inflated contents of recently used compressed translations (see
+// --turbo-compress-frame-translations), so that repeated deopts and frame
+// inspections of the same code do not inflate the whole buffer every time.
+// Entries are keyed by the buffer's address, so the cache is cleared before
+// every full GC, which may move or free the buffers.
+class UncompressedFrameTranslationCache final {
+ public:
+  using Contents = std::shared_ptr<const std::vector<int32_t>>;
+
+  Contents Lookup(Tagged<DeoptimizationFrameTranslation> buffer) const;
+  void Insert(Tagged<DeoptimizationFrameTranslation> buffer,
+              Contents contents);
+  void Clear() { entries_.clear(); }
+
+ private:
+  static constexpr size_t kMaxEntries = 16;
+
+  std::unordered_map<Address, Contents> entries_;
+};
+
 class DeoptimizationFrameTranslation::Iterator {
  public:
-  Iterator(Tagged<DeoptimizationFrameTranslation> buffer, int index);
+  // The {cache} is optional and must belong to the isolate owning {buffer}.
+  Iterator(Tagged<DeoptimizationFrameTranslation> buffer, int index,
+           UncompressedFrameTranslationCache* cache = nullptr);
 
   int32_t NextOperand();
 
@@ -100,7 +124,7 @@ class DeoptimizationFrameTranslation::Iterator {
   uint32_t NextUnsignedOperandAtPreviousIndex();
   void SkipOpcodeAndItsOperandsAtPreviousIndex();
 
-  std::vector<int32_t> uncompressed_contents_;
+  UncompressedFrameTranslationCache::Contents uncompressed_contents_;
   Tagged<DeoptimizationFrameTranslation> buffer_;
   int index_;
 
@@ -234,6 +234,26 @@ void BaseDictionaryShape<Key>::DetailsAtPut(Tagged<Dictionary> dict,
             value.AsSmi());
 }
 
+template <typename Dictionary>
+void NameDictionaryShape::DetailsAtPut(Tagged<Dictionary> dict,
+                                       InternalIndex entry,
+                                       PropertyDetails value) {
+  static_assert(Dictionary::kEntrySize == 3);
+  int index = Dictionary::EntryToIndex(entry) + Dictionary::kEntryDetailsIndex;
+  Tagged<Object> old_details = dict->get(index);
+  if (IsSmi(old_details) &&
+      PropertyDetails(Smi::cast(old_details)).IsDontEnum() !=
+          value.IsDontEnum()) {
+    // Once the index is out of range, the next addition regenerates all
+    // enumeration indices and DictionaryKeysCache no longer caches the keys.
+    int next_index = dict->next_enumeration_index();
+    if (PropertyDetails::IsValidIndex(next_index)) {
+      dict->set_next_enumeration_index(next_index + 1);
+    }
+  }
+  dict->set(index, value.AsSmi());
+}
+
 Tagged<Object> GlobalDictionaryShape::Unwrap(Tagged<Object> object) {
   return PropertyCell::cast(object)->name();
 }
@@ -166,6 +166,12 @@ class NameDictionaryShape : public BaseNameDictionaryShape {
   static const int kPrefixSize = 3;
   static const int kEntrySize = 3;
   static const bool kMatchNeedsHoleCheck = false;
+
+  // Also bumps the next enumeration index when the enumerability of the entry
+  // changes, which invalidates the entry in the DictionaryKeysCache.
+  template <typename Dictionary>
+  static inline void DetailsAtPut(Tagged<Dictionary> dict, InternalIndex entry,
+                                  PropertyDetails value);
 };
 
 template <typename Derived, typename Shape>
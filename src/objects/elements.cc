@@ -14,6 +14,7 @@
 #include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"  // For MaxNumberToStringCacheSize.
 #include "src/heap/heap-write-barrier-inl.h"
+#include "src/heap/incremental-marking.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/arguments-inl.h"
 #include "src/objects/hash-table-inl.h"
@@ -24,6 +25,7 @@
 #include "src/objects/objects-inl.h"
 #include "src/objects/slots-atomic-inl.h"
 #include "src/objects/slots.h"
+#include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 
 // Each concrete ElementsAccessor can handle exactly one ElementsKind,
@@ -421,6 +423,41 @@ void CopyPackedSmiToDoubleElements(Tagged<FixedArrayBase> from_base,
   }
 }
 
+// Smis and doubles take up the same space when pointers are not compressed,
+// so a Smi backing store can be turned into a double backing store in place
+// instead of being copied. This is only done for backing stores in large
+// object space, where the copy is most expensive.
+bool TryConvertSmiToDoubleElementsInPlace(Isolate* isolate,
+                                          Tagged<FixedArrayBase> elements) {
+  if (kTaggedSize != kDoubleSize) return false;
+  Heap* heap = isolate->heap();
+  // Concurrent markers visit FixedArrays without taking the object lock, so
+  // they must not be running while the body changes its meaning.
+  if (heap->incremental_marking()->IsMarking()) return false;
+  // Copy-on-write backing stores are shared and must not be modified.
+  ReadOnlyRoots roots(isolate);
+  if (elements->map() != roots.fixed_array_map()) return false;
+  if (!Heap::IsLargeObject(elements)) return false;
+
+  DisallowGarbageCollection no_gc;
+  Tagged<FixedArray> from = FixedArray::cast(elements);
+  heap->NotifyObjectLayoutChange(from, no_gc, InvalidateRecordedSlots::kYes,
+                                 InvalidateExternalPointerSlots::kNo,
+                                 from->Size());
+  from->set_map(roots.fixed_double_array_map());
+  Tagged<FixedDoubleArray> to = FixedDoubleArray::cast(elements);
+  Tagged<Object> the_hole = roots.the_hole_value();
+  for (int i = 0, length = to->length(); i < length; i++) {
+    Tagged<Object> hole_or_smi = from->get(i);
+    if (hole_or_smi == the_hole) {
+      to->set_the_hole(i);
+    } else {
+      to->set(i, Smi::ToInt(hole_or_smi));
+    }
+  }
+  return true;
+}
+
 void CopyObjectToDoubleElements(Tagged<FixedArrayBase> from_base,
                                 uint32_t from_start,
                                 Tagged<FixedArrayBase> to_base,
@@ -895,6 +932,14 @@ class ElementsAccessorBase : public InternalElementsAccessor {
       ElementsKind from_kind, uint32_t capacity, uint32_t src_index,
       uint32_t dst_index) {
     Isolate* isolate = object->GetIsolate();
+    if (IsDoubleElementsKind(kind()) && IsSmiElementsKind(from_kind) &&
+        src_index == 0 && dst_index == 0 &&
+        capacity == static_cast<uint32_t>(old_elements->length()) &&
+        TryConvertSmiToDoubleElementsInPlace(isolate, *old_elements)) {
+      // The caller must install a double elements map on {object} before the
+      // next allocation.
+      return old_elements;
+    }
     Handle<FixedArrayBase> new_elements;
     // TODO(victorgomes): Retrieve native context in optimized code
     // and remove the check isolate->context().is_null().
@@ -992,16 +1037,18 @@ class ElementsAccessorBase : public InternalElementsAccessor {
   static Maybe<bool> BasicGrowCapacityAndConvertImpl(
       Handle<JSObject> object, Handle<FixedArrayBase> old_elements,
       ElementsKind from_kind, ElementsKind to_kind, uint32_t capacity) {
+    if (IsHoleyElementsKind(from_kind)) {
+      to_kind = GetHoleyElementsKind(to_kind);
+    }
+    // Look up the map first, since the elements may be converted in place.
+    Handle<Map> new_map = JSObject::GetElementsTransitionMap(object, to_kind);
+
     Handle<FixedArrayBase> elements;
     ASSIGN_RETURN_ON_EXCEPTION_VALUE(
         object->GetIsolate(), elements,
         ConvertElementsWithCapacity(object, old_elements, from_kind, capacity),
         Nothing<bool>());
 
-    if (IsHoleyElementsKind(from_kind)) {
-      to_kind = GetHoleyElementsKind(to_kind);
-    }
-    Handle<Map> new_map = JSObject::GetElementsTransitionMap(object, to_kind);
     JSObject::SetMapAndElements(object, new_map, elements);
 
     // Transition through the allocation site as well if present.
@@ -2543,8 +2590,23 @@ class FastElementsAccessor : public ElementsAccessorBase<Subclass, KindTraits> {
     Handle<Object> result =
         Subclass::GetImpl(isolate, *backing_store, InternalIndex(remove_index));
     if (remove_position == AT_START) {
-      Subclass::MoveElements(isolate, receiver, backing_store, 0, 1, new_length,
-                             0, 0);
+      if (new_length > JSArray::kMaxCopyElements &&
+          Heap::IsLargeObject(*backing_store) &&
+          BackingStore::SizeFor(new_length) <= kMaxRegularHeapObjectSize) {
+        // Backing stores in large object space cannot be left-trimmed, so
+        // every shift would move all remaining elements. Once they fit into a
+        // regular object, copy them out so that subsequent shifts can
+        // left-trim instead.
+        ASSIGN_RETURN_ON_EXCEPTION(
+            isolate, backing_store,
+            Subclass::ConvertElementsWithCapacity(receiver, backing_store, kind,
+                                                  new_length, 1, 0),
+            Object);
+        receiver->set_elements(*backing_store);
+      } else {
+        Subclass::MoveElements(isolate, receiver, backing_store, 0, 1,
+                               new_length, 0, 0);
+      }
     }
     MAYBE_RETURN_NULL(
         Subclass::SetLengthImpl(isolate, receiver, new_length, backing_store));
@@ -3815,6 +3877,19 @@ class TypedElementsAccessor
                                        ElementType* dest_data_ptr,
                                        size_t length,
                                        IsSharedBuffer is_shared) {
+    if (!is_shared) {
+      // Keep the unshared loop free of the per-element atomicity checks so
+      // that the compiler can vectorize the conversion (e.g. Float32 to
+      // Uint8Clamped).
+      for (size_t i = 0; i < length; ++i) {
+        SourceElementType source_elem =
+            base::ReadUnalignedValue<SourceElementType>(
+                reinterpret_cast<Address>(source_data_ptr + i));
+        base::WriteUnalignedValue(reinterpret_cast<Address>(dest_data_ptr + i),
+                                  FromScalar(source_elem));
+      }
+      return;
+    }
     for (; length > 0; --length, ++source_data_ptr, ++dest_data_ptr) {
       // We use scalar accessors to avoid boxing/unboxing, so there are no
       // allocations.
@@ -3868,8 +3943,8 @@ class TypedElementsAccessor
             reinterpret_cast<base::Atomic8*>(source_data),
             length * element_size);
       } else {
-        std::memmove(dest_data + offset * element_size, source_data,
-                     length * element_size);
+        ParallelMemMove(dest_data + offset * element_size, source_data,
+                        length * element_size);
       }
     } else {
       std::unique_ptr<uint8_t[]> cloned_source_elements;
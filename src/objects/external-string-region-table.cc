@@ -0,0 +1,119 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/objects/external-string-region-table.h"
+
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/objects/string.h"
+
+namespace v8 {
+namespace internal {
+
+ExternalStringRegionTable::~ExternalStringRegionTable() {
+  // All strings, and hence all slices, die with the heap, which is torn down
+  // before the table.
+  DCHECK_EQ(0u, live_slice_count());
+}
+
+ExternalStringRegionTable::RegionEntry* ExternalStringRegionTable::Acquire(
+    const std::shared_ptr<v8::String::ExternalStringRegion>& region) {
+  mutex_.AssertHeld();
+  auto it = regions_.find(region.get());
+  if (it == regions_.end()) {
+    it = regions_.emplace(region.get(), RegionEntry{region, 0}).first;
+  }
+  return &it->second;
+}
+
+template <typename SliceType>
+SliceType* ExternalStringRegionTable::AllocateSlice(
+    SlicePool<SliceType>& pool, RegionEntry* entry,
+    const typename SliceType::CharType* data, size_t length) {
+  mutex_.AssertHeld();
+  SliceType* slice;
+  if (pool.free_list.empty()) {
+    slice = &pool.slices.emplace_back(this);
+  } else {
+    slice = pool.free_list.back();
+    pool.free_list.pop_back();
+  }
+  slice->Init(entry, data, length);
+  entry->live_slices++;
+  return slice;
+}
+
+template <typename SliceType>
+void ExternalStringRegionTable::ReleaseSlice(SlicePool<SliceType>& pool,
+                                             SliceType* slice) {
+  base::MutexGuard guard(&mutex_);
+  RegionEntry* entry = slice->entry();
+  DCHECK_LT(0, entry->live_slices);
+  slice->Init(nullptr, nullptr, 0);
+  pool.free_list.push_back(slice);
+  // Drop the table's reference once the region no longer backs any string.
+  if (--entry->live_slices == 0) regions_.erase(entry->region.get());
+}
+
+void ExternalStringRegionTable::Release(OneByteSlice* slice) {
+  ReleaseSlice(one_byte_slices_, slice);
+}
+
+void ExternalStringRegionTable::Release(TwoByteSlice* slice) {
+  ReleaseSlice(two_byte_slices_, slice);
+}
+
+MaybeHandle<String> ExternalStringRegionTable::NewOneByteString(
+    Isolate* isolate,
+    const std::shared_ptr<v8::String::ExternalStringRegion>& region,
+    size_t byte_offset, size_t length) {
+  DCHECK_LT(0, length);
+  DCHECK_LE(byte_offset + length, region->byte_length());
+  OneByteSlice* slice;
+  {
+    base::MutexGuard guard(&mutex_);
+    slice = AllocateSlice(
+        one_byte_slices_, Acquire(region),
+        static_cast<const char*>(region->data()) + byte_offset, length);
+  }
+  MaybeHandle<String> result =
+      isolate->factory()->NewExternalStringFromOneByte(slice);
+  if (result.is_null()) Release(slice);
+  return result;
+}
+
+MaybeHandle<String> ExternalStringRegionTable::NewTwoByteString(
+    Isolate* isolate,
+    const std::shared_ptr<v8::String::ExternalStringRegion>& region,
+    size_t byte_offset, size_t length) {
+  DCHECK_LT(0, length);
+  DCHECK_LE(byte_offset + length * sizeof(uint16_t), region->byte_length());
+  const uint8_t* start =
+      static_cast<const uint8_t*>(region->data()) + byte_offset;
+  DCHECK(IsAligned(reinterpret_cast<Address>(start), alignof(uint16_t)));
+  TwoByteSlice* slice;
+  {
+    base::MutexGuard guard(&mutex_);
+    slice = AllocateSlice(two_byte_slices_, Acquire(region),
+                          reinterpret_cast<const uint16_t*>(start), length);
+  }
+  MaybeHandle<String> result =
+      isolate->factory()->NewExternalStringFromTwoByte(slice);
+  if (result.is_null()) Release(slice);
+  return result;
+}
+
+size_t ExternalStringRegionTable::region_count() const {
+  base::MutexGuard guard(&mutex_);
+  return regions_.size();
+}
+
+size_t ExternalStringRegionTable::live_slice_count() const {
+  base::MutexGuard guard(&mutex_);
+  return one_byte_slices_.slices.size() - one_byte_slices_.free_list.size() +
+         two_byte_slices_.slices.size() - two_byte_slices_.free_list.size();
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,118 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OBJECTS_EXTERNAL_STRING_REGION_TABLE_H_
+#define V8_OBJECTS_EXTERNAL_STRING_REGION_TABLE_H_
+
+#include <deque>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "include/v8-primitive.h"
+#include "src/base/platform/mutex.h"
+#include "src/handles/maybe-handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class String;
+
+// Tracks the v8::String::ExternalStringRegions that back external strings of
+// an isolate. Each string references a slice descriptor owned by this table
+// instead of an embedder-allocated resource. Slices are recycled when their
+// string dies, and the table holds a single reference per region for as long
+// as any of the region's slices is in use, so finalizing such a string neither
+// frees memory nor touches the region's reference count.
+class ExternalStringRegionTable final {
+ public:
+  ExternalStringRegionTable() = default;
+  ~ExternalStringRegionTable();
+
+  ExternalStringRegionTable(const ExternalStringRegionTable&) = delete;
+  ExternalStringRegionTable& operator=(const ExternalStringRegionTable&) =
+      delete;
+
+  MaybeHandle<String> NewOneByteString(
+      Isolate* isolate,
+      const std::shared_ptr<v8::String::ExternalStringRegion>& region,
+      size_t byte_offset, size_t length);
+  MaybeHandle<String> NewTwoByteString(
+      Isolate* isolate,
+      const std::shared_ptr<v8::String::ExternalStringRegion>& region,
+      size_t byte_offset, size_t length);
+
+  size_t region_count() const;
+  size_t live_slice_count() const;
+
+ private:
+  struct RegionEntry {
+    std::shared_ptr<v8::String::ExternalStringRegion> region;
+    size_t live_slices = 0;
+  };
+
+  // An external string resource describing a range of characters within a
+  // region. Disposing a slice returns it to its table for reuse.
+  template <typename Resource, typename Char>
+  class Slice final : public Resource {
+   public:
+    using CharType = Char;
+
+    explicit Slice(ExternalStringRegionTable* table) : table_(table) {}
+
+    void Init(RegionEntry* entry, const Char* data, size_t length) {
+      entry_ = entry;
+      data_ = data;
+      length_ = length;
+    }
+
+    const Char* data() const override { return data_; }
+    size_t length() const override { return length_; }
+    RegionEntry* entry() const { return entry_; }
+
+   protected:
+    void Dispose() override { table_->Release(this); }
+
+   private:
+    ExternalStringRegionTable* const table_;
+    RegionEntry* entry_ = nullptr;
+    const Char* data_ = nullptr;
+    size_t length_ = 0;
+  };
+
+  using OneByteSlice =
+      Slice<v8::String::ExternalOneByteStringResource, char>;
+  using TwoByteSlice = Slice<v8::String::ExternalStringResource, uint16_t>;
+
+  template <typename SliceType>
+  struct SlicePool {
+    std::deque<SliceType> slices;
+    std::vector<SliceType*> free_list;
+  };
+
+  RegionEntry* Acquire(
+      const std::shared_ptr<v8::String::ExternalStringRegion>& region);
+  template <typename SliceType>
+  SliceType* AllocateSlice(SlicePool<SliceType>& pool, RegionEntry* entry,
+                           const typename SliceType::CharType* data,
+                           size_t length);
+  template <typename SliceType>
+  void ReleaseSlice(SlicePool<SliceType>& pool, SliceType* slice);
+  void Release(OneByteSlice* slice);
+  void Release(TwoByteSlice* slice);
+
+  // Slices are released whenever their strings are finalized, which is not
+  // necessarily on the thread that created them.
+  mutable base::Mutex mutex_;
+  std::unordered_map<const v8::String::ExternalStringRegion*, RegionEntry>
+      regions_;
+  SlicePool<OneByteSlice> one_byte_slices_;
+  SlicePool<TwoByteSlice> two_byte_slices_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_OBJECTS_EXTERNAL_STRING_REGION_TABLE_H_
@@ -316,9 +316,9 @@ Tagged<String> Intl::ConvertOneByteToLower(Tagged<String> src,
 
     // If not ASCII, we keep the result up to index_to_first_unprocessed and
     // process the rest.
-    for (int index = index_to_first_unprocessed; index < length; ++index) {
-      dst_data[index] = ToLatin1Lower(static_cast<uint16_t>(src_data[index]));
-    }
+    FastLatin1ToLower(dst_data + index_to_first_unprocessed,
+                      src_data + index_to_first_unprocessed,
+                      length - index_to_first_unprocessed);
   } else {
     DCHECK(src_flat.IsTwoByte());
     int index_to_first_unprocessed = FindFirstUpperOrNonAscii(src, length);
@@ -389,7 +389,12 @@ MaybeHandle<String> Intl::ConvertToUpper(Isolate* isolate, Handle<String> s) {
           return has_changed_character ? result : s;
         }
         // If not ASCII, we keep the result up to index_to_first_unprocessed and
-        // process the rest.
+        // process the rest, vectorized up to the first character that needs
+        // special handling.
+        index_to_first_unprocessed += FastLatin1ToUpper(
+            dest + index_to_first_unprocessed,
+            src.begin() + index_to_first_unprocessed,
+            length - index_to_first_unprocessed);
         is_result_single_byte =
             ToUpperOneByte(src.SubVector(index_to_first_unprocessed, length),
                            dest + index_to_first_unprocessed, &sharp_s_count);
@@ -1455,6 +1460,52 @@ int Intl::CompareStrings(Isolate* isolate, const icu::Collator& icu_collator,
   return result;
 }
 
+namespace {
+
+// Whether numbers are formatted with the English defaults: ASCII digits
+// grouped in threes by commas and an ASCII minus sign.
+bool IsEnglishNumberLocale(Isolate* isolate, Handle<Object> locales) {
+  static const char* const kEnglishLocales[] = {"en-US", "en"};
+  if (IsUndefined(*locales, isolate)) {
+    const std::string& default_locale = isolate->DefaultLocale();
+    for (const char* english_locale : kEnglishLocales) {
+      if (strcmp(english_locale, default_locale.c_str()) == 0) return true;
+    }
+    return false;
+  }
+  Handle<String> locales_string = Handle<String>::cast(locales);
+  for (const char* english_locale : kEnglishLocales) {
+    if (locales_string->IsEqualTo(base::CStrVector(english_locale), isolate)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Formats {value} like an English icu::number::LocalizedNumberFormatter with
+// default options would.
+Handle<String> FormatSmiInEnglish(Isolate* isolate, int value) {
+  // "-2,147,483,648" is the longest result.
+  char buffer[16];
+  char* const end = buffer + arraysize(buffer);
+  char* p = end;
+  uint32_t magnitude = value < 0 ? 0u - static_cast<uint32_t>(value)
+                                 : static_cast<uint32_t>(value);
+  int digits = 0;
+  do {
+    if (digits > 0 && digits % 3 == 0) *--p = ',';
+    *--p = '0' + magnitude % 10;
+    magnitude /= 10;
+    digits++;
+  } while (magnitude != 0);
+  if (value < 0) *--p = '-';
+  return isolate->factory()
+      ->NewStringFromOneByte(base::OneByteVector(p, end - p))
+      .ToHandleChecked();
+}
+
+}  // namespace
+
 // ecma402/#sup-properties-of-the-number-prototype-object
 MaybeHandle<String> Intl::NumberToLocaleString(Isolate* isolate,
                                                Handle<Object> num,
@@ -1470,6 +1521,10 @@ MaybeHandle<String> Intl::NumberToLocaleString(Isolate* isolate,
   // side-effects of examining those arguments are unobservable.
   bool can_cache = (IsString(*locales) || IsUndefined(*locales, isolate)) &&
                    IsUndefined(*options, isolate);
+  if (can_cache && IsSmi(*numeric_obj) &&
+      IsEnglishNumberLocale(isolate, locales)) {
+    return FormatSmiInEnglish(isolate, Smi::ToInt(*numeric_obj));
+  }
   if (can_cache) {
     icu::number::LocalizedNumberFormatter* cached_number_format =
         static_cast<icu::number::LocalizedNumberFormatter*>(
@@ -107,6 +107,17 @@ class JSArray : public TorqueGeneratedJSArray<JSArray, JSObject> {
                                                    Address raw_separator,
                                                    Address raw_dest);
 
+  // Joins the first {length} elements of the elements backing store of a
+  // packed array with the separator, where each element is either a String or
+  // a Smi (written as its decimal representation). Like
+  // ArrayJoinConcatToSequentialString, {raw_dest} must have the exact length
+  // of the result.
+  static Address ArrayJoinPackedToSequentialString(Isolate* isolate,
+                                                   Address raw_elements,
+                                                   intptr_t length,
+                                                   Address raw_separator,
+                                                   Address raw_dest);
+
   // Checks whether the Array has the current realm's Array.prototype as its
   // prototype. This function is best-effort and only gives a conservative
   // approximation, erring on the side of false, in particular with respect
@@ -137,6 +137,12 @@ std::atomic<int32_t>* JSAtomicsMutex::AtomicOwnerThreadIdPtr() {
   return base::AsAtomicPtr(owner_thread_id_ptr);
 }
 
+std::atomic<int32_t>* JSAtomicsMutex::AtomicSpinCountEstimatePtr() {
+  int32_t* spin_count_estimate_ptr =
+      reinterpret_cast<int32_t*>(field_address(kSpinCountEstimateOffset));
+  return base::AsAtomicPtr(spin_count_estimate_ptr);
+}
+
 TQ_OBJECT_CONSTRUCTORS_IMPL(JSAtomicsCondition)
 
 CAST_ACCESSOR(JSAtomicsCondition)
@@ -14,11 +14,37 @@
 #include "src/objects/js-atomics-synchronization-inl.h"
 #include "src/sandbox/external-pointer-inl.h"
 
+#if V8_OS_LINUX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif  // V8_OS_LINUX
+
 namespace v8 {
 namespace internal {
 
 namespace detail {
 
+#if V8_OS_LINUX
+namespace {
+
+// Waiting threads are only ever woken up by threads of the same process, so
+// the cheaper process-private futexes can be used.
+void FutexWait(std::atomic<uint32_t>* word, uint32_t expected,
+               const struct timespec* rel_timeout) {
+  static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT_PRIVATE,
+          expected, rel_timeout, nullptr, 0);
+}
+
+void FutexWakeOne(std::atomic<uint32_t>* word) {
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE_PRIVATE, 1,
+          nullptr, nullptr, 0);
+}
+
+}  // namespace
+#endif  // V8_OS_LINUX
+
 // To manage waiting threads, there is a process-wide doubly-linked intrusive
 // list per waiter (i.e. mutex or condition variable). There is a per-thread
 // node allocated on the stack when the thread goes to sleep during
@@ -224,11 +250,66 @@ class V8_NODISCARD WaiterQueueNode final {
     return len;
   }
 
+  void set_should_wait(bool should_wait) {
+#if V8_OS_LINUX
+    should_wait_.store(should_wait ? 1 : 0, std::memory_order_relaxed);
+#else
+    should_wait_ = should_wait;
+#endif  // V8_OS_LINUX
+  }
+
+#if V8_OS_LINUX
+  // On Linux, threads park directly on a futex on {should_wait_}, which saves
+  // the mutex and condition variable round trips on both sides.
+  void Wait() {
+    AllowGarbageCollection allow_before_parking;
+    requester_->main_thread_local_heap()->BlockWhileParked([this]() {
+      while (should_wait_.load(std::memory_order_acquire)) {
+        FutexWait(&should_wait_, 1, nullptr);
+      }
+    });
+  }
+
+  // Returns false if timed out, true otherwise.
+  bool WaitFor(const base::TimeDelta& rel_time) {
+    bool result;
+    AllowGarbageCollection allow_before_parking;
+    requester_->main_thread_local_heap()->BlockWhileParked([this, rel_time,
+                                                            &result]() {
+      base::TimeTicks timeout_time = base::TimeTicks::Now() + rel_time;
+      for (;;) {
+        if (!should_wait_.load(std::memory_order_acquire)) {
+          result = true;
+          return;
+        }
+        base::TimeTicks current_time = base::TimeTicks::Now();
+        if (current_time >= timeout_time) {
+          result = false;
+          return;
+        }
+        struct timespec rel_timeout =
+            (timeout_time - current_time).ToTimespec();
+        // The wake up may have been spurious, so loop again.
+        FutexWait(&should_wait_, 1, &rel_timeout);
+      }
+    });
+    return result;
+  }
+
+  void Notify() {
+    // The waiter may return and destroy this node as soon as {should_wait_}
+    // is cleared, so that must be the last access to it. Waking up the futex
+    // afterwards only uses its address.
+    SetNotInListForVerification();
+    should_wait_.store(0, std::memory_order_release);
+    FutexWakeOne(&should_wait_);
+  }
+#else
   void Wait() {
     AllowGarbageCollection allow_before_parking;
     requester_->main_thread_local_heap()->BlockWhileParked([this]() {
       base::MutexGuard guard(&wait_lock_);
-      while (should_wait) {
+      while (should_wait_) {
         wait_cond_var_.Wait(&wait_lock_);
       }
     });
@@ -244,7 +325,7 @@ class V8_NODISCARD WaiterQueueNode final {
       base::TimeTicks current_time = base::TimeTicks::Now();
       base::TimeTicks timeout_time = current_time + rel_time;
       for (;;) {
-        if (!should_wait) {
+        if (!should_wait_) {
           result = true;
           return;
         }
@@ -264,10 +345,11 @@ class V8_NODISCARD WaiterQueueNode final {
 
   void Notify() {
     base::MutexGuard guard(&wait_lock_);
-    should_wait = false;
+    should_wait_ = false;
     wait_cond_var_.NotifyOne();
     SetNotInListForVerification();
   }
+#endif  // V8_OS_LINUX
 
   uint32_t NotifyAllInList() {
     WaiterQueueNode* cur = this;
@@ -281,8 +363,6 @@ class V8_NODISCARD WaiterQueueNode final {
     return count;
   }
 
-  bool should_wait = false;
-
  private:
   void VerifyNotInList() {
     DCHECK_NULL(next_);
@@ -306,8 +386,13 @@ class V8_NODISCARD WaiterQueueNode final {
   WaiterQueueNode* next_ = nullptr;
   WaiterQueueNode* prev_ = nullptr;
 
+#if V8_OS_LINUX
+  std::atomic<uint32_t> should_wait_{0};
+#else
+  bool should_wait_ = false;
   base::Mutex wait_lock_;
   base::ConditionVariable wait_cond_var_;
+#endif  // V8_OS_LINUX
 };
 
 }  // namespace detail
@@ -423,15 +508,28 @@ bool JSAtomicsMutex::LockSlowPath(Isolate* requester,
     // Spin for a little bit to try to acquire the lock, so as to be fast under
     // microcontention.
     //
-    // The backoff algorithm is copied from PartitionAlloc's SpinningMutex.
-    constexpr int kSpinCount = 64;
+    // The backoff algorithm is copied from PartitionAlloc's SpinningMutex. The
+    // number of spins adapts to how long the lock has recently been contended,
+    // similar to glibc's adaptive mutexes: the estimate is a moving average of
+    // the number of spins previous slow path acquisitions needed, and spinning
+    // goes on for up to twice that.
+    constexpr int kMinSpinCount = 16;
+    constexpr int kMaxSpinCount = 256;
     constexpr int kMaxBackoff = 16;
 
+    std::atomic<int32_t>* spin_count_estimate =
+        mutex->AtomicSpinCountEstimatePtr();
+    int estimate = spin_count_estimate->load(std::memory_order_relaxed);
+    int max_spins = std::min(kMaxSpinCount, estimate * 2 + kMinSpinCount);
     int tries = 0;
     int backoff = 1;
     StateT current_state = state->load(std::memory_order_relaxed);
+    bool acquired = false;
     do {
-      if (TryLockExplicit(state, current_state)) return true;
+      if (TryLockExplicit(state, current_state)) {
+        acquired = true;
+        break;
+      }
 
       for (int yields = 0; yields < backoff; yields++) {
         YIELD_PROCESSOR;
@@ -439,7 +537,12 @@ bool JSAtomicsMutex::LockSlowPath(Isolate* requester,
       }
 
       backoff = std::min(kMaxBackoff, backoff << 1);
-    } while (tries < kSpinCount);
+    } while (tries < max_spins);
+
+    // The estimate is only a heuristic, so racy updates are fine.
+    spin_count_estimate->store(estimate + (tries - estimate) / 8,
+                               std::memory_order_relaxed);
+    if (acquired) return true;
 
     // At this point the lock is considered contended, so try to go to sleep and
     // put the requester thread on the waiter queue.
@@ -463,7 +566,7 @@ bool JSAtomicsMutex::LockSlowPath(Isolate* requester,
       }
 
       // With the queue lock held, enqueue the requester onto the waiter queue.
-      this_waiter.should_wait = true;
+      this_waiter.set_should_wait(true);
       WaiterQueueNode* waiter_head =
           WaiterQueueNode::DestructivelyDecodeHead<JSAtomicsMutex>(
               requester, current_state);
@@ -571,7 +674,7 @@ bool JSAtomicsCondition::WaitFor(Isolate* requester,
     }
 
     // With the queue lock held, enqueue the requester onto the waiter queue.
-    this_waiter.should_wait = true;
+    this_waiter.set_should_wait(true);
     WaiterQueueNode* waiter_head =
         WaiterQueueNode::DestructivelyDecodeHead<JSAtomicsCondition>(
             requester, current_state);
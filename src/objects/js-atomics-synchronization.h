@@ -149,6 +149,7 @@ class JSAtomicsMutex
   inline void ClearOwnerThread();
 
   inline std::atomic<int32_t>* AtomicOwnerThreadIdPtr();
+  inline std::atomic<int32_t>* AtomicSpinCountEstimatePtr();
 
   static bool TryLockExplicit(std::atomic<StateT>* state, StateT& expected);
   static bool TryLockWaiterQueueExplicit(std::atomic<StateT>* state,
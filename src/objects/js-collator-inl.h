@@ -25,6 +25,14 @@ TQ_OBJECT_CONSTRUCTORS_IMPL(JSCollator)
 ACCESSORS(JSCollator, icu_collator, Tagged<Managed<icu::Collator>>,
           kIcuCollatorOffset)
 
+inline void JSCollator::set_allows_fast_comparison(bool value) {
+  set_flags(AllowsFastComparisonBit::update(flags(), value));
+}
+
+inline bool JSCollator::allows_fast_comparison() const {
+  return AllowsFastComparisonBit::decode(flags());
+}
+
 }  // namespace internal
 }  // namespace v8
 
@@ -547,12 +547,19 @@ MaybeHandle<JSCollator> JSCollator::New(Isolate* isolate, Handle<Map> map,
   // We only need to do so if it is different from the collator would return.
   Handle<String> locale_str = isolate->factory()->NewStringFromAsciiChecked(
       (collator_locale != icu_locale) ? r.locale.c_str() : "");
+  // The same locales that let String.prototype.localeCompare skip ICU for
+  // ASCII strings also apply to collators created with default options.
+  const bool allows_fast_comparison =
+      Intl::CompareStringsOptionsFor(isolate, locales, options_obj) ==
+      Intl::CompareStringsOptions::kTryFastPath;
   // Now all properties are ready, so we can allocate the result object.
   Handle<JSCollator> collator = Handle<JSCollator>::cast(
       isolate->factory()->NewFastOrSlowJSObjectFromMap(map));
   DisallowGarbageCollection no_gc;
   collator->set_icu_collator(*managed_collator);
   collator->set_locale(*locale_str);
+  collator->set_flags(0);
+  collator->set_allows_fast_comparison(allows_fast_comparison);
 
   // 29. Return collator.
   return collator;
@@ -46,6 +46,14 @@ class JSCollator : public TorqueGeneratedJSCollator<JSCollator, JSObject> {
 
   DECL_PRINTER(JSCollator)
 
+  // Whether the collator is known to agree with the ASCII collation weights
+  // tables, see Intl::CompareStringsOptionsFor.
+  inline void set_allows_fast_comparison(bool value);
+  inline bool allows_fast_comparison() const;
+
+  // Bit positions in |flags|.
+  DEFINE_TORQUE_GENERATED_JS_COLLATOR_FLAGS()
+
   DECL_ACCESSORS(icu_collator, Tagged<Managed<icu::Collator>>)
 
   TQ_OBJECT_CONSTRUCTORS(JSCollator)
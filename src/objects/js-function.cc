@@ -11,6 +11,7 @@
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate.h"
+#include "src/execution/shared-tiering-decisions.h"
 #include "src/execution/tiering-manager.h"
 #include "src/heap/heap-inl.h"
 #include "src/ic/ic.h"
@@ -587,6 +588,9 @@ void JSFunction::CreateAndAttachFeedbackVector(
 
   Handle<SharedFunctionInfo> shared(function->shared(), isolate);
   DCHECK(function->shared()->HasBytecodeArray());
+  // Pick up a decision another isolate made for the same function before the
+  // interrupt budget below is computed from it.
+  SharedTieringDecisions::Apply(*shared);
 
   EnsureClosureFeedbackCellArray(function, false);
   Handle<ClosureFeedbackCellArray> closure_feedback_cell_array =
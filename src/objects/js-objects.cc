@@ -5395,6 +5395,41 @@ JSObject::UpdateAllocationSite<AllocationSiteUpdateMode::kCheckOnly>(
 template bool JSObject::UpdateAllocationSite<AllocationSiteUpdateMode::kUpdate>(
     Handle<JSObject> object, ElementsKind to_kind);
 
+// static
+ElementsKind JSObject::GetAllocationSiteTransitionTarget(
+    Handle<JSObject> object, ElementsKind to_kind) {
+  if (!IsJSArray(*object)) return to_kind;
+
+  if (!Heap::InYoungGeneration(*object)) return to_kind;
+
+  if (Heap::IsLargeObject(*object)) return to_kind;
+
+  DisallowGarbageCollection no_gc;
+  Heap* heap = object->GetHeap();
+  Tagged<AllocationMemento> memento =
+      heap->pretenuring_handler()
+          ->FindAllocationMemento<PretenuringHandler::kForRuntime>(
+              object->map(), *object);
+  if (memento.is_null()) return to_kind;
+
+  Tagged<AllocationSite> site = memento->GetAllocationSite();
+  ElementsKind site_kind;
+  if (site->PointsToLiteral()) {
+    if (!IsJSArray(site->boilerplate())) return to_kind;
+    site_kind = site->boilerplate()->GetElementsKind();
+  } else {
+    site_kind = site->GetElementsKind();
+  }
+  if (!IsFastElementsKind(site_kind)) return to_kind;
+
+  // Only the representation of the elements is predicted, whether the array
+  // has holes is still up to the array itself.
+  site_kind = IsHoleyElementsKind(to_kind) ? GetHoleyElementsKind(site_kind)
+                                           : GetPackedElementsKind(site_kind);
+  return IsMoreGeneralElementsKindTransition(to_kind, site_kind) ? site_kind
+                                                                 : to_kind;
+}
+
 void JSObject::TransitionElementsKind(Handle<JSObject> object,
                                       ElementsKind to_kind) {
   ElementsKind from_kind = object->GetElementsKind();
@@ -609,6 +609,12 @@ class JSObject : public TorqueGeneratedJSObject<JSObject, JSReceiver> {
   static bool UpdateAllocationSite(Handle<JSObject> object,
                                    ElementsKind to_kind);
 
+  // Returns the elements kind that {object} should transition to instead of
+  // {to_kind} if its allocation site already knows that instances end up in a
+  // more general kind. This saves converting the backing store twice.
+  static ElementsKind GetAllocationSiteTransitionTarget(Handle<JSObject> object,
+                                                       ElementsKind to_kind);
+
   // Lookup interceptors are used for handling properties controlled by host
   // objects.
   DECL_GETTER(HasNamedInterceptor, bool)
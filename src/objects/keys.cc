@@ -15,6 +15,7 @@
 #include "src/objects/elements-inl.h"
 #include "src/objects/field-index-inl.h"
 #include "src/objects/hash-table-inl.h"
+#include "src/objects/lookup-cache-inl.h"
 #include "src/objects/module-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/ordered-hash-table-inl.h"
@@ -914,6 +915,45 @@ void CopyEnumKeysTo(Isolate* isolate, Handle<SwissNameDictionary> dictionary,
   // now contains the actual values from |dictionary|, rather than indices.
 }
 
+bool HasNonEnumerableStringKeys(Isolate* isolate,
+                                Tagged<NameDictionary> dictionary,
+                                int enumerable_length) {
+  ReadOnlyRoots roots(isolate);
+  int string_keys = 0;
+  for (InternalIndex i : dictionary->IterateEntries()) {
+    Tagged<Object> key;
+    if (!dictionary->ToKey(roots, i, &key)) continue;
+    if (!IsSymbol(key)) string_keys++;
+  }
+  return string_keys != enumerable_length;
+}
+
+// Dictionary-mode objects that are enumerated repeatedly (e.g. maps of
+// configuration values) would otherwise collect and sort their keys again on
+// every Object.keys or for-in. The cached keys are never handed out directly,
+// since callers may turn the result into the backing store of a JSArray.
+Handle<FixedArray> GetCachedOwnEnumPropertyDictionaryKeys(
+    Isolate* isolate, KeyCollectionMode mode, KeyAccumulator* accumulator,
+    Handle<NameDictionary> dictionary) {
+  DictionaryKeysCache* cache = isolate->dictionary_keys_cache();
+  bool has_non_enumerable_strings = false;
+  Tagged<FixedArray> cached =
+      cache->Lookup(*dictionary, &has_non_enumerable_strings);
+  // Non-enumerable keys have to be recorded as shadowing keys when the
+  // prototype chain is included.
+  if (!cached.is_null() && (mode == KeyCollectionMode::kOwnOnly ||
+                            !has_non_enumerable_strings)) {
+    return isolate->factory()->CopyFixedArray(handle(cached, isolate));
+  }
+  int length = dictionary->NumberOfEnumerableProperties();
+  Handle<FixedArray> storage = isolate->factory()->NewFixedArray(length);
+  CopyEnumKeysTo(isolate, dictionary, storage, mode, accumulator);
+  Handle<FixedArray> result = isolate->factory()->CopyFixedArray(storage);
+  cache->Update(*dictionary, *storage,
+                HasNonEnumerableStringKeys(isolate, *dictionary, length));
+  return result;
+}
+
 template <class T>
 Handle<FixedArray> GetOwnEnumPropertyDictionaryKeys(Isolate* isolate,
                                                     KeyCollectionMode mode,
@@ -924,10 +964,15 @@ Handle<FixedArray> GetOwnEnumPropertyDictionaryKeys(Isolate* isolate,
   if (dictionary->NumberOfElements() == 0) {
     return isolate->factory()->empty_fixed_array();
   }
-  int length = dictionary->NumberOfEnumerableProperties();
-  Handle<FixedArray> storage = isolate->factory()->NewFixedArray(length);
-  CopyEnumKeysTo(isolate, dictionary, storage, mode, accumulator);
-  return storage;
+  if constexpr (std::is_same_v<T, NameDictionary>) {
+    return GetCachedOwnEnumPropertyDictionaryKeys(isolate, mode, accumulator,
+                                                  dictionary);
+  } else {
+    int length = dictionary->NumberOfEnumerableProperties();
+    Handle<FixedArray> storage = isolate->factory()->NewFixedArray(length);
+    CopyEnumKeysTo(isolate, dictionary, storage, mode, accumulator);
+    return storage;
+  }
 }
 
 // Collect the keys from |dictionary| into |keys|, in ascending chronological
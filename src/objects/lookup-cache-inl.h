@@ -5,6 +5,7 @@
 #ifndef V8_OBJECTS_LOOKUP_CACHE_INL_H_
 #define V8_OBJECTS_LOOKUP_CACHE_INL_H_
 
+#include "src/objects/dictionary-inl.h"
 #include "src/objects/lookup-cache.h"
 #include "src/objects/map.h"
 #include "src/objects/name-inl.h"
@@ -41,6 +42,45 @@ void DescriptorLookupCache::Update(Tagged<Map> source, Tagged<Name> name,
   results_[index] = result;
 }
 
+// static
+int DictionaryKeysCache::Hash(Tagged<NameDictionary> dictionary) {
+  // Uses only lower 32 bits if pointers are larger.
+  uint32_t hash = static_cast<uint32_t>(dictionary.ptr()) >> kTaggedSizeLog2;
+  return hash % kLength;
+}
+
+Tagged<FixedArray> DictionaryKeysCache::Lookup(
+    Tagged<NameDictionary> dictionary, bool* has_non_enumerable_strings) {
+  Entry& entry = entries_[Hash(dictionary)];
+  // Pointers in the table might be stale, so use SafeEquals.
+  if (!entry.dictionary.SafeEquals(dictionary) ||
+      entry.next_enumeration_index != dictionary->next_enumeration_index() ||
+      entry.number_of_elements != dictionary->NumberOfElements() ||
+      entry.number_of_deleted_elements !=
+          dictionary->NumberOfDeletedElements()) {
+    return Tagged<FixedArray>();
+  }
+  *has_non_enumerable_strings = entry.has_non_enumerable_strings;
+  return entry.keys;
+}
+
+void DictionaryKeysCache::Update(Tagged<NameDictionary> dictionary,
+                                 Tagged<FixedArray> keys,
+                                 bool has_non_enumerable_strings) {
+  // Enumerability changes can only be tracked while the next enumeration
+  // index is valid, see NameDictionaryShape::DetailsAtPut.
+  if (!PropertyDetails::IsValidIndex(dictionary->next_enumeration_index())) {
+    return;
+  }
+  Entry& entry = entries_[Hash(dictionary)];
+  entry.dictionary = dictionary;
+  entry.next_enumeration_index = dictionary->next_enumeration_index();
+  entry.number_of_elements = dictionary->NumberOfElements();
+  entry.number_of_deleted_elements = dictionary->NumberOfDeletedElements();
+  entry.has_non_enumerable_strings = has_non_enumerable_strings;
+  entry.keys = keys;
+}
+
 }  // namespace internal
 }  // namespace v8
 
@@ -11,5 +11,12 @@ void DescriptorLookupCache::Clear() {
   for (int index = 0; index < kLength; index++) keys_[index].source = Map();
 }
 
+void DictionaryKeysCache::Clear() {
+  for (int index = 0; index < kLength; index++) {
+    entries_[index].dictionary = Tagged<NameDictionary>();
+    entries_[index].keys = Tagged<FixedArray>();
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
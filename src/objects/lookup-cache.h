@@ -5,6 +5,7 @@
 #ifndef V8_OBJECTS_LOOKUP_CACHE_H_
 #define V8_OBJECTS_LOOKUP_CACHE_H_
 
+#include "src/objects/dictionary.h"
 #include "src/objects/map.h"
 #include "src/objects/name.h"
 #include "src/objects/objects.h"
@@ -55,6 +56,51 @@ class DescriptorLookupCache {
   friend class Isolate;
 };
 
+// Cache of the enumerable string keys of dictionary-mode objects, in
+// enumeration order, as computed for Object.keys/values/entries and for-in.
+// An entry is only valid as long as the dictionary's next enumeration index
+// and its element counts are unchanged; adding or deleting a key and changing
+// the enumerability of a key each update at least one of them.
+// Cleared at startup and prior to any gc.
+class DictionaryKeysCache {
+ public:
+  DictionaryKeysCache(const DictionaryKeysCache&) = delete;
+  DictionaryKeysCache& operator=(const DictionaryKeysCache&) = delete;
+
+  // Returns the cached keys of {dictionary}, or an empty Tagged if absent.
+  // {has_non_enumerable_strings} is set to whether the dictionary has string
+  // keys that are not enumerable (and thus shadow prototype keys in for-in).
+  inline Tagged<FixedArray> Lookup(Tagged<NameDictionary> dictionary,
+                                   bool* has_non_enumerable_strings);
+
+  // Update an element in the cache. The cache takes over {keys}, which must
+  // not be modified afterwards.
+  inline void Update(Tagged<NameDictionary> dictionary, Tagged<FixedArray> keys,
+                     bool has_non_enumerable_strings);
+
+  // Clear the cache.
+  void Clear();
+
+ private:
+  DictionaryKeysCache() { Clear(); }
+
+  static inline int Hash(Tagged<NameDictionary> dictionary);
+
+  static const int kLength = 16;
+  struct Entry {
+    Tagged<NameDictionary> dictionary;
+    int next_enumeration_index;
+    int number_of_elements;
+    int number_of_deleted_elements;
+    bool has_non_enumerable_strings;
+    Tagged<FixedArray> keys;
+  };
+
+  Entry entries_[kLength];
+
+  friend class Isolate;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -246,7 +246,7 @@ Tagged<Object> HeapObject::SeqCst_CompareAndSwapField(
 }
 
 bool InAnySharedSpace(Tagged<HeapObject> obj) {
-  if (IsReadOnlyHeapObject(obj)) return V8_SHARED_RO_HEAP_BOOL;
+  if (IsReadOnlyHeapObject(obj)) return ReadOnlyHeap::IsReadOnlySpaceShared();
   return InWritableSharedSpace(obj);
 }
 
@@ -4116,6 +4116,72 @@ void WriteFixedArrayToFlat(Tagged<FixedArray> fixed_array, int length,
   DCHECK_EQ(sink, sink_end);
 }
 
+// Writes the decimal representation of {value} and returns the position
+// following it.
+template <typename sinkchar>
+sinkchar* WriteSmiToFlat(int value, sinkchar* sink) {
+  uint32_t magnitude = static_cast<uint32_t>(value);
+  if (value < 0) {
+    *sink++ = '-';
+    magnitude = 0u - magnitude;
+  }
+  sinkchar* end = sink;
+  for (uint32_t rest = magnitude; rest >= 10; rest /= 10) end++;
+  end++;
+  sinkchar* cursor = end;
+  do {
+    *--cursor = static_cast<sinkchar>('0' + magnitude % 10);
+    magnitude /= 10;
+  } while (magnitude != 0);
+  return end;
+}
+
+template <typename sinkchar>
+void WritePackedElementsToFlat(Tagged<FixedArray> elements, int length,
+                               Tagged<String> separator, sinkchar* sink,
+                               int sink_length) {
+  DisallowGarbageCollection no_gc;
+  CHECK_GT(length, 0);
+  CHECK_LE(length, elements->length());
+#ifdef DEBUG
+  sinkchar* sink_end = sink + sink_length;
+#endif
+
+  const int separator_length = separator->length();
+  const bool use_one_char_separator_fast_path =
+      separator_length == 1 && StringShape(separator).IsSequentialOneByte();
+  uint8_t separator_one_char = 0;
+  if (use_one_char_separator_fast_path) {
+    separator_one_char = SeqOneByteString::cast(separator)->GetChars(no_gc)[0];
+  }
+
+  for (int i = 0; i < length; i++) {
+    if (i > 0) {
+      if (use_one_char_separator_fast_path) {
+        DCHECK_LT(sink, sink_end);
+        *sink++ = separator_one_char;
+      } else if (separator_length > 0) {
+        DCHECK_LE(sink + separator_length, sink_end);
+        String::WriteToFlat(separator, sink, 0, separator_length);
+        sink += separator_length;
+      }
+    }
+
+    Tagged<Object> element = elements->get(i);
+    if (IsSmi(element)) {
+      sink = WriteSmiToFlat(Smi::ToInt(element), sink);
+    } else {
+      Tagged<String> string = String::cast(element);
+      const int string_length = string->length();
+      DCHECK_LE(sink + string_length, sink_end);
+      String::WriteToFlat(string, sink, 0, string_length);
+      sink += string_length;
+    }
+  }
+
+  DCHECK_EQ(sink, sink_end);
+}
+
 }  // namespace
 
 // static
@@ -4147,6 +4213,33 @@ Address JSArray::ArrayJoinConcatToSequentialString(Isolate* isolate,
   return dest.ptr();
 }
 
+// static
+Address JSArray::ArrayJoinPackedToSequentialString(Isolate* isolate,
+                                                   Address raw_elements,
+                                                   intptr_t length,
+                                                   Address raw_separator,
+                                                   Address raw_dest) {
+  DisallowGarbageCollection no_gc;
+  DisallowJavascriptExecution no_js(isolate);
+  Tagged<FixedArray> elements = FixedArray::cast(Tagged<Object>(raw_elements));
+  Tagged<String> separator = String::cast(Tagged<Object>(raw_separator));
+  Tagged<String> dest = String::cast(Tagged<Object>(raw_dest));
+  DCHECK(StringShape(dest).IsSequentialOneByte() ||
+         StringShape(dest).IsSequentialTwoByte());
+
+  if (StringShape(dest).IsSequentialOneByte()) {
+    WritePackedElementsToFlat(elements, static_cast<int>(length), separator,
+                              SeqOneByteString::cast(dest)->GetChars(no_gc),
+                              dest->length());
+  } else {
+    DCHECK(StringShape(dest).IsSequentialTwoByte());
+    WritePackedElementsToFlat(elements, static_cast<int>(length), separator,
+                              SeqTwoByteString::cast(dest)->GetChars(no_gc),
+                              dest->length());
+  }
+  return dest.ptr();
+}
+
 uint32_t StringHasher::MakeArrayIndexHash(uint32_t value, int length) {
   // For array indexes mix the length into the hash as an array index could
   // be zero.
@@ -27,7 +27,10 @@ void OffHeapHashTableBase<Derived>::RehashInto(PtrComprCageBase cage_base,
   DCHECK(new_table->HasSufficientCapacityToAdd(number_of_elements()));
 
   Derived* derived_this = static_cast<Derived*>(this);
-  // Rehash the elements and copy them into new_table.
+  // Rehash the elements and copy them into new_table. The elements are
+  // counted rather than taking number_of_elements(), which may include
+  // concurrent insertions that will fail.
+  int copied_elements = 0;
   for (InternalIndex i : InternalIndex::Range(capacity())) {
     Tagged<Object> key = derived_this->GetKey(cage_base, i);
     if (!IsKey(key)) continue;
@@ -37,8 +40,11 @@ void OffHeapHashTableBase<Derived>::RehashInto(PtrComprCageBase cage_base,
     new_table->SetKey(insertion_index, key);
     derived_this->CopyEntryExcludingKeyInto(cage_base, i, new_table,
                                             insertion_index);
+    copied_elements++;
   }
-  new_table->number_of_elements_ = number_of_elements();
+  DCHECK_LE(copied_elements, number_of_elements());
+  new_table->number_of_elements_.store(copied_elements,
+                                       std::memory_order_relaxed);
 }
 
 template <typename Derived>
@@ -49,15 +55,16 @@ inline bool OffHeapHashTableBase<Derived>::ShouldResizeToAdd(
   // is sufficiently empty; otherwise we make sure to grow it so that it has
   // enough space.
   int capacity_after_shrinking = ComputeCapacityWithShrink(
-      capacity_, number_of_elements_ + additional_elements);
+      capacity_, number_of_elements() + additional_elements);
 
   if (capacity_after_shrinking < capacity_) {
-    DCHECK(HasSufficientCapacityToAdd(
-        capacity_after_shrinking, number_of_elements_, 0, additional_elements));
+    DCHECK(HasSufficientCapacityToAdd(capacity_after_shrinking,
+                                      number_of_elements(), 0,
+                                      additional_elements));
     *new_capacity = capacity_after_shrinking;
     return true;
   } else if (!HasSufficientCapacityToAdd(additional_elements)) {
-    *new_capacity = ComputeCapacity(number_of_elements_ + additional_elements);
+    *new_capacity = ComputeCapacity(number_of_elements() + additional_elements);
     return true;
   } else {
     *new_capacity = -1;
@@ -130,7 +137,9 @@ InternalIndex OffHeapHashTableBase<Derived>::FindEntry(IsolateT* isolate,
     // TODO(leszeks): Consider delaying the decompression until after the
     // comparisons against empty/deleted.
     Tagged<Object> element = derived_this->GetKey(isolate, entry);
-    if (element == empty_element()) return InternalIndex::NotFound();
+    if (element == empty_element() || element == sealed_element()) {
+      return InternalIndex::NotFound();
+    }
     if (element == deleted_element()) continue;
     if (Derived::KeyIsMatch(isolate, key, element)) return entry;
   }
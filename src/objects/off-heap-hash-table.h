@@ -5,6 +5,8 @@
 #ifndef V8_OBJECTS_OFF_HEAP_HASH_TABLE_H_
 #define V8_OBJECTS_OFF_HEAP_HASH_TABLE_H_
 
+#include <atomic>
+
 #include "src/common/globals.h"
 #include "src/execution/isolate-utils.h"
 #include "src/objects/compressed-slots.h"
@@ -70,13 +72,20 @@ class OffHeapHashTableBase {
  public:
   static constexpr Tagged<Smi> empty_element() { return Smi::FromInt(0); }
   static constexpr Tagged<Smi> deleted_element() { return Smi::FromInt(1); }
+  // Tables that support concurrent insertion replace all empty elements of a
+  // table that is being resized by sealed elements, so that insertions into
+  // it fail. Lookups treat them like empty elements.
+  static constexpr Tagged<Smi> sealed_element() { return Smi::FromInt(2); }
 
   static bool IsKey(Tagged<Object> k) {
-    return k != empty_element() && k != deleted_element();
+    return k != empty_element() && k != deleted_element() &&
+           k != sealed_element();
   }
 
   int capacity() const { return capacity_; }
-  int number_of_elements() const { return number_of_elements_; }
+  int number_of_elements() const {
+    return number_of_elements_.load(std::memory_order_relaxed);
+  }
   int number_of_deleted_elements() const { return number_of_deleted_elements_; }
 
   OffHeapObjectSlot slot(InternalIndex index, int offset = 0) const {
@@ -90,11 +99,11 @@ class OffHeapHashTableBase {
     Derived* derived_this = static_cast<Derived*>(this);
 
     DCHECK_EQ(derived_this->GetKey(cage_base, entry), empty_element());
-    DCHECK_LT(number_of_elements_ + 1, capacity());
+    DCHECK_LT(number_of_elements() + 1, capacity());
     DCHECK(HasSufficientCapacityToAdd(1));
 
     derived_this->Set(entry, std::forward<Args>(args)...);
-    number_of_elements_++;
+    number_of_elements_.fetch_add(1, std::memory_order_relaxed);
   }
 
   template <typename... Args>
@@ -103,18 +112,18 @@ class OffHeapHashTableBase {
     Derived* derived_this = static_cast<Derived*>(this);
 
     DCHECK_EQ(derived_this->GetKey(cage_base, entry), deleted_element());
-    DCHECK_LT(number_of_elements_ + 1, capacity());
+    DCHECK_LT(number_of_elements() + 1, capacity());
     DCHECK(HasSufficientCapacityToAdd(capacity(), number_of_elements(),
                                       number_of_deleted_elements() - 1, 1));
 
     derived_this->Set(entry, std::forward<Args>(args)...);
-    number_of_elements_++;
+    number_of_elements_.fetch_add(1, std::memory_order_relaxed);
     number_of_deleted_elements_--;
   }
 
   void ElementsRemoved(int count) {
-    DCHECK_LE(count, number_of_elements_);
-    number_of_elements_ -= count;
+    DCHECK_LE(count, number_of_elements());
+    number_of_elements_.fetch_sub(count, std::memory_order_relaxed);
     number_of_deleted_elements_ += count;
   }
 
@@ -180,7 +189,9 @@ class OffHeapHashTableBase {
 
   static inline void Free(void* container);
 
-  int number_of_elements_;
+  // The number of elements may be updated concurrently by tables that support
+  // lock-free insertion, where it also counts insertions in progress.
+  std::atomic<int> number_of_elements_;
   int number_of_deleted_elements_;
   const int capacity_;
   Tagged_t elements_[1];
@@ -101,7 +101,12 @@ Handle<Derived> OrderedHashTable<Derived, entrysize>::Shrink(
   int nof = table->NumberOfElements();
   int capacity = table->Capacity();
   if (nof >= (capacity >> 2)) return table;
-  return Derived::Rehash(isolate, table, capacity / 2).ToHandleChecked();
+  // Shrink to fit rather than halving, so that tables that were presized for
+  // many more elements than they ended up holding (e.g. when constructing a
+  // collection from an array with duplicates) shrink in a single step. The
+  // result is still at least half empty, so this doesn't cause a regrowth on
+  // the next addition.
+  return Derived::Rehash(isolate, table, nof * 2).ToHandleChecked();
 }
 
 template <class Derived, int entrysize>
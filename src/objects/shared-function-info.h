@@ -538,6 +538,10 @@ class SharedFunctionInfo
 
   DECL_BOOLEAN_ACCESSORS(sparkplug_compiled)
 
+  // Indicates that the bytecode of this function was flushed at least once,
+  // i.e. that its current bytecode (if any) comes from a re-compile.
+  DECL_BOOLEAN_ACCESSORS(bytecode_was_flushed)
+
   CachedTieringDecision cached_tiering_decision();
   void set_cached_tiering_decision(CachedTieringDecision decision);
 
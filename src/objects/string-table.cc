@@ -65,6 +65,95 @@ class StringTable::OffHeapStringHashSet
     // Do nothing, since the entry size is 1 (just the key).
   }
 
+  // Reserves room for one more element without holding the write mutex.
+  // Fails if the table has to be resized first.
+  bool TryReserveElement() {
+    int elements = number_of_elements_.load(std::memory_order_relaxed);
+    do {
+      if (!HasSufficientCapacityToAdd(capacity(), elements,
+                                      number_of_deleted_elements(), 1)) {
+        return false;
+      }
+    } while (!number_of_elements_.compare_exchange_weak(
+        elements, elements + 1, std::memory_order_relaxed));
+    return true;
+  }
+  void ReleaseReservedElement() {
+    number_of_elements_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  // Looks up {key}, and inserts {new_string} for it if it isn't in the table
+  // yet, without holding the write mutex. Entries only ever go from empty to
+  // a string here, with a compare-and-swap, so that concurrent insertions of
+  // equal keys, which follow the same probe sequence, see each other.
+  //
+  // Returns the string in the table for {key}, or a null string if the
+  // insertion has to be retried while holding the write mutex: when the
+  // probe sequence reaches a sealed entry, or a deleted entry, which may have
+  // been claimed by a locked insertion (see FindEntryOrClaimEntry).
+  template <typename IsolateT, typename StringTableKey>
+  Tagged<String> TryLookupOrInsertLockFree(IsolateT* isolate,
+                                           StringTableKey* key,
+                                           Tagged<String> new_string) {
+    DCHECK(HasSufficientCapacityToAdd(0));
+    uint32_t count = 1;
+    for (InternalIndex entry = FirstProbe(key->hash(), capacity());;
+         entry = NextProbe(entry, count++, capacity())) {
+      Tagged<Object> element = GetKey(isolate, entry);
+      if (element == empty_element()) {
+        slot(entry).Release_CompareAndSwap(empty_element(), new_string);
+        // Once written, entries can only change in GCs, so reloading tells
+        // whether the swap succeeded.
+        element = GetKey(isolate, entry);
+        if (element == new_string) return new_string;
+      }
+      if (element == deleted_element() || element == sealed_element()) {
+        return Tagged<String>();
+      }
+      if (KeyIsMatch(isolate, key, element)) return String::cast(element);
+    }
+  }
+
+  // Finds the entry for {key}, or claims the empty entry for inserting it by
+  // marking it as deleted. Must be called while holding the write mutex. The
+  // claimed entry makes concurrent lock-free insertions of equal keys retry
+  // while holding the mutex, so they see the string once it is stored with
+  // SetKey.
+  template <typename IsolateT, typename StringTableKey>
+  InternalIndex FindEntryOrClaimEntry(IsolateT* isolate, StringTableKey* key,
+                                      bool* claimed) {
+    DCHECK(HasSufficientCapacityToAdd(0));
+    *claimed = false;
+    uint32_t count = 1;
+    for (InternalIndex entry = FirstProbe(key->hash(), capacity());;
+         entry = NextProbe(entry, count++, capacity())) {
+      Tagged<Object> element = GetKey(isolate, entry);
+      if (element == empty_element()) {
+        slot(entry).Release_CompareAndSwap(empty_element(), deleted_element());
+        element = GetKey(isolate, entry);
+        if (element == deleted_element()) {
+          *claimed = true;
+          return entry;
+        }
+      }
+      DCHECK_NE(element, sealed_element());
+      if (element == deleted_element()) continue;
+      if (KeyIsMatch(isolate, key, element)) return entry;
+    }
+  }
+
+  // Replaces all empty entries by sealed ones, so that lock-free insertions
+  // into this table fail instead of being lost when the table is copied by a
+  // resize. Must be called while holding the write mutex.
+  void Seal(PtrComprCageBase cage_base) {
+    for (InternalIndex i : InternalIndex::Range(capacity())) {
+      if (GetKey(cage_base, i) != empty_element()) continue;
+      // If the swap fails, a lock-free insertion wrote a string, which will be
+      // copied.
+      slot(i).Release_CompareAndSwap(empty_element(), sealed_element());
+    }
+  }
+
  private:
   friend class StringTable::Data;
 };
@@ -195,6 +284,10 @@ class InternalizedStringKey final : public StringTableKey {
     return string_->SlowEquals(string);
   }
 
+  // In-place internalization changes the map of the string, which is only
+  // safe once the string is known to be inserted (see GetHandleForInsertion).
+  bool InsertsInPlace() const { return !maybe_internalized_map_.is_null(); }
+
   void PrepareForInsertion(Isolate* isolate) {
     StringTransitionStrategy strategy =
         isolate->factory()->ComputeInternalizationStrategyForString(
@@ -259,7 +352,7 @@ class InternalizedStringKey final : public StringTableKey {
       // It is always safe to overwrite the map. The only transition possible
       // is another thread migrated the string to internalized already.
       // Migrations to thin are impossible, as we only call this method on table
-      // misses inside the critical section.
+      // misses inside the critical section, after claiming the table entry.
       string_->set_map_safe_transition_no_write_barrier(*internalized_map);
       DCHECK(IsInternalizedString(*string_));
       return string_;
@@ -329,6 +422,15 @@ void SetInternalizedReference(Isolate* isolate, Tagged<String> string,
   }
 }
 
+template <typename StringTableKey>
+bool CanInsertWithoutLock(StringTableKey* key) {
+  return true;
+}
+
+bool CanInsertWithoutLock(InternalizedStringKey* key) {
+  return !key->InsertsInPlace();
+}
+
 }  // namespace
 
 Handle<String> StringTable::LookupString(Isolate* isolate,
@@ -391,10 +493,11 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   //
   //   - The Heap access is allowed to be concurrent (using LocalHeap or
   //     similar),
-  //   - All writes to the string table are guarded by the Isolate string table
-  //     mutex,
-  //   - Resizes of the string table first copies the old contents to the new
-  //     table, and only then sets the new string table pointer to the new
+  //   - Writes to the string table only turn empty entries into strings, with
+  //     a compare-and-swap,
+  //   - Resizes of the string table are guarded by the Isolate string table
+  //     mutex, first seal the old table and copy its contents to the new
+  //     table, and only then set the new string table pointer to the new
   //     table,
   //   - Only GCs can remove elements from the string table.
   //
@@ -410,9 +513,13 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   // equality.
   //
   // We therefore try to optimistically read from the string table without
-  // taking the lock (both here and in the NoAllocate version of the lookup),
-  // and on a miss we take the lock and try to write the entry, with a second
-  // read lookup in case the non-locked read missed a write.
+  // taking the lock (both here and in the NoAllocate version of the lookup).
+  // On a miss, the string is inserted with a compare-and-swap, still without
+  // taking the lock, as long as the table doesn't need to be resized. A
+  // concurrent insertion of the same string follows the same probe sequence,
+  // so one of the two swaps fails and that thread finds the other's string.
+  // Resizes, and insertions that have side effects on the inserted string
+  // (in-place internalization), take the lock.
   //
   // One complication is allocation -- we don't want to allocate while holding
   // the string table lock. This applies to both allocation of new strings, and
@@ -441,35 +548,47 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
 
   // No entry found, so adding new string.
   key->PrepareForInsertion(isolate);
+
+  if (v8_flags.lock_free_string_table_insertion &&
+      CanInsertWithoutLock(key) && current_table.TryReserveElement()) {
+    Handle<String> new_string = key->GetHandleForInsertion();
+    DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
+    Tagged<String> result =
+        current_table.TryLookupOrInsertLockFree(isolate, key, *new_string);
+    if (result == *new_string) return new_string;
+    current_table.ReleaseReservedElement();
+    if (!result.is_null()) return handle(result, isolate);
+    // Otherwise the table is being resized, or another insertion of the key
+    // may be in progress, so retry while holding the lock.
+  }
+
   {
     base::MutexGuard table_write_guard(&write_mutex_);
 
     Data* data = EnsureCapacity(isolate, 1);
+    // Lock-free insertions may fill up the table concurrently.
+    while (!data->table().TryReserveElement()) {
+      data = EnsureCapacity(isolate, 1);
+    }
     OffHeapStringHashSet& table = data->table();
 
     // Check one last time if the key is present in the table, in case it was
     // added after the check.
-    entry = table.FindEntryOrInsertionEntry(isolate, key, key->hash());
-
-    Tagged<Object> element = table.GetKey(isolate, entry);
-    if (element == OffHeapStringHashSet::empty_element()) {
-      // This entry is empty, so write it and register that we added an
-      // element.
-      Handle<String> new_string = key->GetHandleForInsertion();
-      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
-      table.AddAt(isolate, entry, *new_string);
-      return new_string;
-    } else if (element == OffHeapStringHashSet::deleted_element()) {
-      // This entry was deleted, so overwrite it and register that we
-      // overwrote a deleted element.
-      Handle<String> new_string = key->GetHandleForInsertion();
-      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
-      table.OverwriteDeletedAt(isolate, entry, *new_string);
-      return new_string;
-    } else {
+    bool claimed;
+    entry = table.FindEntryOrClaimEntry(isolate, key, &claimed);
+    if (!claimed) {
       // Return the existing string as a handle.
-      return handle(String::cast(element), isolate);
+      table.ReleaseReservedElement();
+      return handle(String::cast(table.GetKey(isolate, entry)), isolate);
     }
+
+    // Write the claimed entry. Deleted entries are not reused, since lock-free
+    // insertions can't tell them from claimed ones; they are dropped by the
+    // next resize.
+    Handle<String> new_string = key->GetHandleForInsertion();
+    DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
+    table.SetKey(entry, *new_string);
+    return new_string;
   }
 }
 
@@ -503,6 +622,7 @@ StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
 
   int new_capacity;
   if (data->table().ShouldResizeToAdd(additional_elements, &new_capacity)) {
+    data->table().Seal(cage_base);
     std::unique_ptr<Data> new_data =
         Data::Resize(cage_base, std::unique_ptr<Data>(data), new_capacity);
     // `new_data` is the new owner of `data`.
@@ -1311,6 +1311,106 @@ int SearchString(Isolate* isolate, String::FlatContent receiver_content,
                       start_index);
 }
 
+// Patterns that straddle segment boundaries are matched in a small window
+// buffer, which bounds the length of patterns searched without flattening.
+constexpr int kMaxPatternLengthForSegmentedSearch = 32;
+// Ropes built by appending short pieces have too many segments for searching
+// them one by one to pay off. The shape of the rope is checked once this many
+// segments have been visited, and the search gives up unless the segments are
+// long enough on average.
+constexpr int kMinSegmentsForShapeCheck = 16;
+constexpr int kMinAverageSegmentLength = 64;
+
+bool ShouldSearchWithoutFlattening(Tagged<String> receiver, int search_length) {
+  if (!v8_flags.string_search_without_flattening) return false;
+  if (!IsConsString(receiver)) return false;
+  if (ConsString::cast(receiver)->IsFlat()) return false;
+  return receiver->length() >= String::kMinLengthForSegmentedSearch &&
+         search_length <= kMaxPatternLengthForSegmentedSearch;
+}
+
+// Searches {cons} segment by segment, without flattening it. Returns the
+// index of the first match, or -1 if there is none. If the rope turns out to
+// be too fragmented, returns -1 and sets {resume_index} to the index from
+// which the search has to be continued on the flattened string.
+template <typename PatternChar>
+int SearchConsString(Isolate* isolate, Tagged<ConsString> cons,
+                     base::Vector<const PatternChar> pattern, int start_index,
+                     int* resume_index, const DisallowGarbageCollection& no_gc) {
+  const int pattern_length = pattern.length();
+  DCHECK_LE(pattern_length, kMaxPatternLengthForSegmentedSearch);
+  StringSearch<PatternChar, uint8_t> one_byte_search(isolate, pattern);
+  StringSearch<PatternChar, base::uc16> two_byte_search(isolate, pattern);
+
+  // The last {pattern_length - 1} characters before the current segment,
+  // followed by the first characters of the current segment. Only matches
+  // starting in the carried over part need to be looked for in there.
+  base::uc16 window[2 * kMaxPatternLengthForSegmentedSearch];
+  int carry_length = 0;
+
+  *resume_index = -1;
+  int position = start_index;
+  int segment_count = 0;
+  int offset;
+  ConsStringIterator iter(cons, start_index);
+  for (Tagged<String> segment = iter.Next(&offset); !segment.is_null();
+       segment = iter.Next(&offset)) {
+    String::FlatContent content = segment->GetFlatContent(no_gc);
+    DCHECK(content.IsFlat());
+    const int segment_length = content.length() - offset;
+
+    const int head_length = std::min(segment_length, pattern_length - 1);
+    for (int i = 0; i < head_length; i++) {
+      window[carry_length + i] = content.Get(offset + i);
+    }
+    if (carry_length > 0) {
+      int index = two_byte_search.Search(
+          base::Vector<const base::uc16>(window, carry_length + head_length),
+          0);
+      if (index != -1) {
+        DCHECK_LT(index, carry_length);
+        return position - carry_length + index;
+      }
+    }
+
+    if (segment_length >= pattern_length) {
+      int index =
+          content.IsOneByte()
+              ? one_byte_search.Search(
+                    content.ToOneByteVector().SubVector(offset,
+                                                        content.length()),
+                    0)
+              : two_byte_search.Search(
+                    content.ToUC16Vector().SubVector(offset, content.length()),
+                    0);
+      if (index != -1) return position + index;
+    }
+
+    // Carry over the characters that may start a match straddling the next
+    // segment boundary.
+    if (segment_length >= pattern_length - 1) {
+      carry_length = pattern_length - 1;
+      for (int i = 0; i < carry_length; i++) {
+        window[i] = content.Get(content.length() - carry_length + i);
+      }
+    } else {
+      int kept = std::min(carry_length + segment_length, pattern_length - 1);
+      std::copy(window + carry_length + segment_length - kept,
+                window + carry_length + segment_length, window);
+      carry_length = kept;
+    }
+    position += segment_length;
+
+    if (++segment_count == kMinSegmentsForShapeCheck &&
+        position - start_index <
+            kMinSegmentsForShapeCheck * kMinAverageSegmentLength) {
+      *resume_index = position - carry_length;
+      return -1;
+    }
+  }
+  return -1;
+}
+
 }  // namespace
 
 int String::IndexOf(Isolate* isolate, Handle<String> receiver,
@@ -1324,9 +1424,27 @@ int String::IndexOf(Isolate* isolate, Handle<String> receiver,
   uint32_t receiver_length = receiver->length();
   if (start_index + search_length > receiver_length) return -1;
 
-  receiver = String::Flatten(isolate, receiver);
   search = String::Flatten(isolate, search);
 
+  if (ShouldSearchWithoutFlattening(*receiver, search_length)) {
+    // Flattening copies the whole rope even if the match is close to the
+    // start, so search its segments in place instead.
+    DisallowGarbageCollection no_gc;
+    Tagged<ConsString> cons = ConsString::cast(*receiver);
+    String::FlatContent search_content = search->GetFlatContent(no_gc);
+    int resume_index;
+    int index =
+        search_content.IsOneByte()
+            ? SearchConsString(isolate, cons, search_content.ToOneByteVector(),
+                               start_index, &resume_index, no_gc)
+            : SearchConsString(isolate, cons, search_content.ToUC16Vector(),
+                               start_index, &resume_index, no_gc);
+    if (resume_index == -1) return index;
+    start_index = resume_index;
+  }
+
+  receiver = String::Flatten(isolate, receiver);
+
   DisallowGarbageCollection no_gc;  // ensure vectors stay valid
   // Extract flattened substrings of cons strings before getting encoding.
   String::FlatContent receiver_content = receiver->GetFlatContent(no_gc);
@@ -509,6 +509,10 @@ V8_OBJECT class String : public Name {
   // Limit for truncation in short printing.
   static const int kMaxShortPrintLength = 1024;
 
+  // Cons strings at least this long are searched segment by segment rather
+  // than flattened first by String::IndexOf.
+  static const int kMinLengthForSegmentedSearch = 4 * KB;
+
   // Helper function for flattening strings.
   template <typename sinkchar>
   EXPORT_TEMPLATE_DECLARE(V8_EXPORT_PRIVATE)
@@ -40,6 +40,17 @@
 #error "Bad configuration!"
 #endif
 
+// Neon is only used on 64-bit ARM, where it is always available. Its group
+// width is 8, which matches the portable implementation used by the builtins,
+// so no target-specific selection is needed here.
+#ifndef V8_SWISS_TABLE_HAVE_NEON_HOST
+#if V8_HOST_ARCH_ARM64 && V8_TARGET_ARCH_ARM64 && defined(__ARM_NEON)
+#define V8_SWISS_TABLE_HAVE_NEON_HOST 1
+#else
+#define V8_SWISS_TABLE_HAVE_NEON_HOST 0
+#endif
+#endif
+
 // Unlike Abseil, we cannot select SSE purely by host capabilities. When
 // creating a snapshot, the group width must be compatible. The SSE
 // implementation uses a group width of 16, whereas the non-SSE version uses 8.
@@ -64,6 +75,10 @@
 #include <tmmintrin.h>
 #endif
 
+#if V8_SWISS_TABLE_HAVE_NEON_HOST
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 namespace swiss_table {
@@ -322,8 +337,42 @@ struct GroupPortableImpl {
   uint64_t ctrl;
 };
 
+#if V8_SWISS_TABLE_HAVE_NEON_HOST
+// Neon version of GroupPortableImpl, following Abseil's GroupAArch64Impl. It
+// produces the same byte masks as the portable implementation (but without its
+// false positives), so both can be used on the same tables.
+struct GroupNeonImpl {
+  static constexpr size_t kWidth = 8;  // the number of slots per group
+
+  explicit GroupNeonImpl(const ctrl_t* pos) {
+    ctrl = vld1_u8(reinterpret_cast<const uint8_t*>(pos));
+  }
+
+  static constexpr uint64_t kMsbs = 0x8080808080808080ULL;
+
+  // Returns a bitmask representing the positions of slots that match |hash|.
+  BitMask<uint64_t, kWidth, 3> Match(h2_t hash) const {
+    uint8x8_t dup = vdup_n_u8(hash);
+    uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vceq_u8(ctrl, dup)), 0);
+    return BitMask<uint64_t, kWidth, 3>(mask & kMsbs);
+  }
+
+  // Returns a bitmask representing the positions of empty slots.
+  BitMask<uint64_t, kWidth, 3> MatchEmpty() const {
+    return Match(static_cast<h2_t>(kEmpty));
+  }
+
+  uint8x8_t ctrl;
+};
+#endif  // V8_SWISS_TABLE_HAVE_NEON_HOST
+
 // Determine which Group implementation SwissNameDictionary uses.
-#if defined(V8_ENABLE_SWISS_NAME_DICTIONARY) && DEBUG
+#if V8_SWISS_TABLE_HAVE_NEON_HOST
+// The Neon group is only selected when building for arm64 on arm64, and uses
+// the same group width as the portable implementation the builtins use, so
+// the workaround below does not apply to it.
+using Group = GroupNeonImpl;
+#elif defined(V8_ENABLE_SWISS_NAME_DICTIONARY) && DEBUG
 // TODO(v8:11388) If v8_enable_swiss_name_dictionary is enabled, we are supposed
 // to use SwissNameDictionary as the dictionary backing store. If we want to use
 // the SIMD version of SwissNameDictionary, that would require us to compile SSE
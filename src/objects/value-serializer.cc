@@ -6,6 +6,7 @@
 
 #include <type_traits>
 
+#include "include/v8-array-buffer.h"
 #include "include/v8-maybe.h"
 #include "include/v8-value-serializer-version.h"
 #include "include/v8-value-serializer.h"
@@ -56,6 +57,7 @@ namespace internal {
 //             unknown tags)
 // Version 14: flags for JSArrayBufferViews
 // Version 15: support for shared objects with an explicit tag
+// Version 16: objects sharing a shape write their property names once
 //
 // WARNING: Increasing this value is a change which cannot safely be rolled
 // back without breaking compatibility with data stored on disk. It is
@@ -64,7 +66,7 @@ namespace internal {
 //
 // Recent changes are routinely reverted in preparation for branch, and this
 // has been the cause of at least one bug in the past.
-static const uint32_t kLatestVersion = 15;
+static const uint32_t kLatestVersion = 16;
 static_assert(kLatestVersion == v8::CurrentValueSerializerFormatVersion(),
               "Exported format version must match latest version.");
 
@@ -77,6 +79,36 @@ using JSArrayBufferViewIsLengthTracking = base::BitField<bool, 0, 1>;
 using JSArrayBufferViewIsBackedByRab =
     JSArrayBufferViewIsLengthTracking::Next<bool, 1>;
 
+// Strings of at least this many bytes are created as external strings when
+// the deserializer knows the backing store of its data.
+constexpr size_t kMinExternalStringByteLength = 1 * KB;
+
+// An external string resource pointing into the data being deserialized,
+// which keeps the backing store of that data alive.
+template <typename Resource, typename Char>
+class BackingStoreStringResource final : public Resource {
+ public:
+  BackingStoreStringResource(std::shared_ptr<v8::BackingStore> backing_store,
+                             const Char* data, size_t length)
+      : backing_store_(std::move(backing_store)),
+        data_(data),
+        length_(length) {}
+
+  const Char* data() const override { return data_; }
+  size_t length() const override { return length_; }
+
+ private:
+  std::shared_ptr<v8::BackingStore> backing_store_;
+  const Char* const data_;
+  const size_t length_;
+};
+
+using BackingStoreOneByteStringResource =
+    BackingStoreStringResource<v8::String::ExternalOneByteStringResource,
+                               char>;
+using BackingStoreTwoByteStringResource =
+    BackingStoreStringResource<v8::String::ExternalStringResource, uint16_t>;
+
 }  // namespace
 
 template <typename T>
@@ -125,6 +157,11 @@ enum class SerializationTag : uint8_t {
   kBeginJSObject = 'o',
   // End of a JS object. numProperties:uint32_t
   kEndJSObject = '{',
+  // A JS object whose own properties are described by a shape. shapeID:uint32_t
+  // If shapeID is the next unused shape ID, the shape is defined inline:
+  // numProperties:uint32_t, then that many property names. The property
+  // values follow, in shape order, with no end tag.
+  kShapedJSObject = 'O',
   // Beginning of a sparse JS array. length:uint32_t
   // Elements and properties are written as key/value pairs, like objects.
   kBeginSparseJSArray = 'a',
@@ -269,7 +306,8 @@ ValueSerializer::ValueSerializer(Isolate* isolate,
       zone_(isolate->allocator(), ZONE_NAME),
       id_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)),
       array_buffer_transfer_map_(isolate->heap(),
-                                 ZoneAllocationPolicy(&zone_)) {
+                                 ZoneAllocationPolicy(&zone_)),
+      shape_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)) {
   if (delegate_) {
     v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
     has_custom_host_objects_ = delegate_->HasCustomHostObject(v8_isolate);
@@ -648,6 +686,16 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   if (!can_serialize_fast) return WriteJSObjectSlow(object);
 
   Handle<Map> map(object->map(), isolate_);
+  if (CanWriteJSObjectWithShape(object)) {
+    auto find_result = shape_map_.FindOrInsert(map);
+    if (find_result.already_exists) {
+      return WriteJSObjectWithShape(object, find_result.entry);
+    }
+    // Only define a shape once it is seen a second time, so that objects with
+    // unique shapes are written as before.
+    *find_result.entry = 0;
+  }
+
   WriteTag(SerializationTag::kBeginJSObject);
 
   // Write out fast properties as long as they are only data properties and the
@@ -690,6 +738,68 @@ Maybe<bool> ValueSerializer::WriteJSObject(Handle<JSObject> object) {
   return ThrowIfOutOfMemory();
 }
 
+bool ValueSerializer::CanWriteJSObjectWithShape(Handle<JSObject> object) {
+  DisallowGarbageCollection no_gc;
+  Tagged<Map> map = object->map(isolate_);
+  if (map->NumberOfOwnDescriptors() == 0) return false;
+  Tagged<DescriptorArray> descriptors = map->instance_descriptors(isolate_);
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    if (!IsString(descriptors->GetKey(i), isolate_)) return false;
+    PropertyDetails details = descriptors->GetDetails(i);
+    if (details.IsDontEnum() || details.kind() != PropertyKind::kData ||
+        details.location() != PropertyLocation::kField) {
+      return false;
+    }
+    // Only primitive values are allowed: writing them cannot run script, so
+    // the object is guaranteed to keep its map while it is being written.
+    Tagged<Object> value =
+        object->RawFastPropertyAt(FieldIndex::ForDetails(map, details));
+    if (!IsSmi(value) && !IsHeapNumber(value, isolate_) &&
+        !IsString(value, isolate_) && !IsBigInt(value, isolate_) &&
+        !IsUndefined(value, isolate_) && !IsNull(value, isolate_) &&
+        !IsBoolean(value, isolate_)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+Maybe<bool> ValueSerializer::WriteJSObjectWithShape(Handle<JSObject> object,
+                                                    uint32_t* shape_entry) {
+  // As with {id_map_}, ID+1 is stored in {shape_map_}; zero means the shape
+  // has been seen but not defined yet. Read the entry before allocating.
+  bool define_shape = *shape_entry == 0;
+  uint32_t shape_id;
+  if (define_shape) {
+    shape_id = next_shape_id_++;
+    *shape_entry = shape_id + 1;
+  } else {
+    shape_id = *shape_entry - 1;
+  }
+
+  Handle<Map> map(object->map(), isolate_);
+  WriteTag(SerializationTag::kShapedJSObject);
+  WriteVarint<uint32_t>(shape_id);
+  if (define_shape) {
+    WriteVarint<uint32_t>(map->NumberOfOwnDescriptors());
+    for (InternalIndex i : map->IterateOwnDescriptors()) {
+      Handle<Name> key(map->instance_descriptors(isolate_)->GetKey(i),
+                       isolate_);
+      if (!WriteObject(key).FromMaybe(false)) return Nothing<bool>();
+    }
+  }
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    DCHECK_EQ(*map, object->map());
+    PropertyDetails details =
+        map->instance_descriptors(isolate_)->GetDetails(i);
+    FieldIndex field_index = FieldIndex::ForDetails(*map, details);
+    Handle<Object> value = JSObject::FastPropertyAt(
+        isolate_, object, details.representation(), field_index);
+    if (!WriteObject(value).FromMaybe(false)) return Nothing<bool>();
+  }
+  return ThrowIfOutOfMemory();
+}
+
 Maybe<bool> ValueSerializer::WriteJSObjectSlow(Handle<JSObject> object) {
   WriteTag(SerializationTag::kBeginJSObject);
   Handle<FixedArray> keys;
@@ -1260,6 +1370,8 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate,
       position_(data.begin()),
       end_(data.end()),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      shape_map_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::ValueDeserializer(Isolate* isolate, const uint8_t* data,
@@ -1269,11 +1381,14 @@ ValueDeserializer::ValueDeserializer(Isolate* isolate, const uint8_t* data,
       position_(data),
       end_(data + size),
       id_map_(isolate->global_handles()->Create(
+          ReadOnlyRoots(isolate_).empty_fixed_array())),
+      shape_map_(isolate->global_handles()->Create(
           ReadOnlyRoots(isolate_).empty_fixed_array())) {}
 
 ValueDeserializer::~ValueDeserializer() {
   DCHECK_LE(position_, end_);
   GlobalHandles::Destroy(id_map_.location());
+  GlobalHandles::Destroy(shape_map_.location());
 
   Handle<Object> transfer_map_handle;
   if (array_buffer_transfer_map_.ToHandle(&transfer_map_handle)) {
@@ -1640,6 +1755,12 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
       // If the data doesn't support shared values because it is from an older
       // version, treat the tag as unknown.
       V8_FALLTHROUGH;
+    case SerializationTag::kShapedJSObject:
+      // Likewise for shapes, which were introduced in version 16.
+      if (version_ >= 16 && tag == SerializationTag::kShapedJSObject) {
+        return ReadShapedJSObject();
+      }
+      V8_FALLTHROUGH;
     default:
       // Before there was an explicit tag for host objects, all unknown tags
       // were delegated to the host.
@@ -1689,6 +1810,10 @@ MaybeHandle<String> ValueDeserializer::ReadOneByteString(
   if (!ReadVarint<uint32_t>().To(&byte_length)) return {};
   // byte_length is checked in ReadRawBytes.
   if (!ReadRawBytes(byte_length).To(&bytes)) return {};
+  Handle<String> external;
+  if (TryReadExternalString(bytes, true, allocation).ToHandle(&external)) {
+    return external;
+  }
   return isolate_->factory()->NewStringFromOneByte(bytes, allocation);
 }
 
@@ -1703,6 +1828,11 @@ MaybeHandle<String> ValueDeserializer::ReadTwoByteString(
     return MaybeHandle<String>();
   }
 
+  Handle<String> external;
+  if (TryReadExternalString(bytes, false, allocation).ToHandle(&external)) {
+    return external;
+  }
+
   // Allocate an uninitialized string so that we can do a raw memcpy into the
   // string on the heap (regardless of alignment).
   if (byte_length == 0) return isolate_->factory()->empty_string();
@@ -1720,6 +1850,45 @@ MaybeHandle<String> ValueDeserializer::ReadTwoByteString(
   return string;
 }
 
+void ValueDeserializer::SetDataBackingStore(
+    std::shared_ptr<v8::BackingStore> backing_store) {
+  const uint8_t* start = static_cast<const uint8_t*>(backing_store->Data());
+  CHECK(start <= position_ && end_ <= start + backing_store->ByteLength());
+  data_backing_store_ = std::move(backing_store);
+}
+
+MaybeHandle<String> ValueDeserializer::TryReadExternalString(
+    base::Vector<const uint8_t> bytes, bool one_byte,
+    AllocationType allocation) {
+  if (!data_backing_store_ || allocation != AllocationType::kYoung ||
+      bytes.size() < kMinExternalStringByteLength) {
+    return {};
+  }
+  if (one_byte) {
+    if (bytes.size() > static_cast<size_t>(String::kMaxLength)) return {};
+    auto* resource = new BackingStoreOneByteStringResource(
+        data_backing_store_, reinterpret_cast<const char*>(bytes.begin()),
+        bytes.size());
+    return isolate_->factory()
+        ->NewExternalStringFromOneByte(resource)
+        .ToHandleChecked();
+  }
+  // External two-byte strings must be aligned. The serializer pads two-byte
+  // strings relative to the start of its buffer, so this normally holds.
+  if (!IsAligned(reinterpret_cast<Address>(bytes.begin()),
+                 sizeof(base::uc16)) ||
+      bytes.size() / sizeof(base::uc16) >
+          static_cast<size_t>(String::kMaxLength)) {
+    return {};
+  }
+  auto* resource = new BackingStoreTwoByteStringResource(
+      data_backing_store_, reinterpret_cast<const uint16_t*>(bytes.begin()),
+      bytes.size() / sizeof(base::uc16));
+  return isolate_->factory()
+      ->NewExternalStringFromTwoByte(resource)
+      .ToHandleChecked();
+}
+
 bool ValueDeserializer::ReadExpectedString(Handle<String> expected) {
   DisallowGarbageCollection no_gc;
   // In the case of failure, the position in the stream is reset.
@@ -2457,6 +2626,32 @@ static void CommitProperties(Handle<JSObject> object, Handle<Map> map,
   }
 }
 
+// Returns whether {value} can be stored in the field described by
+// {descriptor} of {target}, generalizing the field type if necessary.
+static bool PrepareFieldForValue(Isolate* isolate, Handle<Map> target,
+                                 InternalIndex descriptor,
+                                 Handle<Object> value) {
+  PropertyDetails details =
+      target->instance_descriptors(isolate)->GetDetails(descriptor);
+  Representation expected_representation = details.representation();
+  if (!Object::FitsRepresentation(*value, expected_representation)) {
+    return false;
+  }
+  if (expected_representation.IsHeapObject() &&
+      !FieldType::NowContains(
+          target->instance_descriptors(isolate)->GetFieldType(descriptor),
+          value)) {
+    Handle<FieldType> value_type =
+        Object::OptimalType(*value, isolate, expected_representation);
+    MapUpdater::GeneralizeField(isolate, target, descriptor,
+                                details.constness(), expected_representation,
+                                value_type);
+  }
+  DCHECK(FieldType::NowContains(
+      target->instance_descriptors(isolate)->GetFieldType(descriptor), value));
+  return true;
+}
+
 static bool IsValidObjectKey(Tagged<Object> value, Isolate* isolate) {
   if (IsSmi(value)) return true;
   auto instance_type = HeapObject::cast(value)->map(isolate)->instance_type();
@@ -2531,31 +2726,12 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
         // Deserializaton of |value| might have deprecated current |target|,
         // ensure we are working with the up-to-date version.
         target = Map::Update(isolate_, target);
-        if (!target->is_dictionary_map()) {
-          InternalIndex descriptor(properties.size());
-          PropertyDetails details =
-              target->instance_descriptors(isolate_)->GetDetails(descriptor);
-          Representation expected_representation = details.representation();
-          if (Object::FitsRepresentation(*value, expected_representation)) {
-            if (expected_representation.IsHeapObject() &&
-                !FieldType::NowContains(
-                    target->instance_descriptors(isolate_)->GetFieldType(
-                        descriptor),
-                    value)) {
-              Handle<FieldType> value_type = Object::OptimalType(
-                  *value, isolate_, expected_representation);
-              MapUpdater::GeneralizeField(isolate_, target, descriptor,
-                                          details.constness(),
-                                          expected_representation, value_type);
-            }
-            DCHECK(FieldType::NowContains(
-                target->instance_descriptors(isolate_)->GetFieldType(
-                    descriptor),
-                value));
-            properties.push_back(value);
-            map = target;
-            continue;
-          }
+        if (!target->is_dictionary_map() &&
+            PrepareFieldForValue(isolate_, target,
+                                 InternalIndex(properties.size()), value)) {
+          properties.push_back(value);
+          map = target;
+          continue;
         }
         transitioning = false;
       }
@@ -2613,6 +2789,102 @@ Maybe<uint32_t> ValueDeserializer::ReadJSObjectProperties(
   }
 }
 
+MaybeHandle<JSObject> ValueDeserializer::ReadShapedJSObject() {
+  // If we are at the end of the stack, abort. This function may recurse.
+  STACK_CHECK(isolate_, MaybeHandle<JSObject>());
+
+  uint32_t id = next_id_++;
+  HandleScope scope(isolate_);
+  Handle<JSObject> object =
+      isolate_->factory()->NewJSObject(isolate_->object_function());
+  AddObjectWithID(id, object);
+
+  uint32_t shape_id;
+  if (!ReadVarint<uint32_t>().To(&shape_id) || shape_id > next_shape_id_) {
+    return MaybeHandle<JSObject>();
+  }
+  Handle<FixedArray> shape;
+  if (shape_id == next_shape_id_) {
+    if (!ReadShape().ToHandle(&shape)) return MaybeHandle<JSObject>();
+  } else {
+    shape = handle(FixedArray::cast(shape_map_->get(shape_id)), isolate_);
+  }
+
+  int num_properties = shape->length() - kShapeFirstKeyIndex;
+  std::vector<Handle<Object>> properties;
+  properties.reserve(num_properties);
+  for (int i = 0; i < num_properties; i++) {
+    Handle<Object> value;
+    if (!ReadObject().ToHandle(&value)) return MaybeHandle<JSObject>();
+    properties.push_back(value);
+  }
+
+  // Fast path: create the object directly in the map built for an earlier
+  // object of the same shape.
+  Tagged<Object> cached_map = shape->get(kShapeMapIndex);
+  if (IsMap(cached_map)) {
+    Handle<Map> map =
+        Map::Update(isolate_, handle(Map::cast(cached_map), isolate_));
+    bool fits = !map->is_dictionary_map() &&
+                map->NumberOfOwnDescriptors() == num_properties;
+    for (int i = 0; fits && i < num_properties; i++) {
+      fits = PrepareFieldForValue(isolate_, map, InternalIndex(i),
+                                  properties[i]);
+    }
+    if (fits) {
+      CommitProperties(object, map, properties);
+      return scope.CloseAndEscape(object);
+    }
+  }
+
+  // Slow path: define the properties one by one and remember the resulting
+  // map for the next object of this shape.
+  for (int i = 0; i < num_properties; i++) {
+    PropertyKey lookup_key(
+        isolate_, handle(shape->get(kShapeFirstKeyIndex + i), isolate_));
+    LookupIterator it(isolate_, object, lookup_key, LookupIterator::OWN);
+    if (it.state() != LookupIterator::NOT_FOUND ||
+        JSObject::DefineOwnPropertyIgnoreAttributes(&it, properties[i], NONE)
+            .is_null()) {
+      return MaybeHandle<JSObject>();
+    }
+  }
+  if (!object->map()->is_dictionary_map()) {
+    shape->set(kShapeMapIndex, object->map());
+  }
+
+  DCHECK(HasObjectWithID(id));
+  return scope.CloseAndEscape(object);
+}
+
+MaybeHandle<FixedArray> ValueDeserializer::ReadShape() {
+  uint32_t num_properties;
+  // Each property name takes at least two bytes.
+  if (!ReadVarint<uint32_t>().To(&num_properties) ||
+      num_properties > static_cast<size_t>(end_ - position_) / 2) {
+    return MaybeHandle<FixedArray>();
+  }
+  Handle<FixedArray> shape = isolate_->factory()->NewFixedArray(
+      kShapeFirstKeyIndex + static_cast<int>(num_properties));
+  for (uint32_t i = 0; i < num_properties; i++) {
+    Handle<Object> key;
+    if (!ReadObject().ToHandle(&key) || !IsString(*key, isolate_)) {
+      return MaybeHandle<FixedArray>();
+    }
+    key = isolate_->factory()->InternalizeString(Handle<String>::cast(key));
+    shape->set(kShapeFirstKeyIndex + static_cast<int>(i), *key);
+  }
+
+  Handle<FixedArray> new_array =
+      FixedArray::SetAndGrow(isolate_, shape_map_, next_shape_id_++, shape);
+  // If the array was reallocated, update the global handle.
+  if (!new_array.is_identical_to(shape_map_)) {
+    GlobalHandles::Destroy(shape_map_.location());
+    shape_map_ = isolate_->global_handles()->Create(*new_array);
+  }
+  return shape;
+}
+
 bool ValueDeserializer::HasObjectWithID(uint32_t id) {
   return id < static_cast<unsigned>(id_map_->length()) &&
          !IsTheHole(id_map_->get(id), isolate_);
@@ -6,6 +6,7 @@
 #define V8_OBJECTS_VALUE_SERIALIZER_H_
 
 #include <cstdint>
+#include <memory>
 
 #include "include/v8-value-serializer.h"
 #include "src/base/compiler-specific.h"
@@ -122,6 +123,10 @@ class ValueSerializer {
       V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObject(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSObjectSlow(Handle<JSObject> object) V8_WARN_UNUSED_RESULT;
+  bool CanWriteJSObjectWithShape(Handle<JSObject> object);
+  Maybe<bool> WriteJSObjectWithShape(Handle<JSObject> object,
+                                     uint32_t* shape_entry)
+      V8_WARN_UNUSED_RESULT;
   Maybe<bool> WriteJSArray(Handle<JSArray> array) V8_WARN_UNUSED_RESULT;
   void WriteJSDate(Tagged<JSDate> date);
   Maybe<bool> WriteJSPrimitiveWrapper(Handle<JSPrimitiveWrapper> value)
@@ -188,6 +193,11 @@ class ValueSerializer {
   // A similar map, for transferred array buffers.
   IdentityMap<uint32_t, ZoneAllocationPolicy> array_buffer_transfer_map_;
 
+  // Maps of objects written with kShapedJSObject, to their shape ID+1 (or zero
+  // if the map was seen once but no shape has been defined for it yet).
+  IdentityMap<uint32_t, ZoneAllocationPolicy> shape_map_;
+  uint32_t next_shape_id_ = 0;
+
   // The conveyor used to keep shared objects alive.
   SharedObjectConveyorHandles* shared_object_conveyor_ = nullptr;
 };
@@ -217,6 +227,12 @@ class ValueDeserializer {
    */
   uint32_t GetWireFormatVersion() const { return version_; }
 
+  /*
+   * Declares that the data lives in |backing_store|, so that large strings can
+   * be created as external strings pointing into it rather than copies.
+   */
+  void SetDataBackingStore(std::shared_ptr<v8::BackingStore> backing_store);
+
   /*
    * Deserializes a V8 object from the buffer.
    */
@@ -288,6 +304,8 @@ class ValueDeserializer {
   MaybeHandle<String> ReadTwoByteString(
       AllocationType allocation = AllocationType::kYoung) V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadJSObject() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<JSObject> ReadShapedJSObject() V8_WARN_UNUSED_RESULT;
+  MaybeHandle<FixedArray> ReadShape() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadSparseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadDenseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSDate> ReadJSDate() V8_WARN_UNUSED_RESULT;
@@ -313,6 +331,12 @@ class ValueDeserializer {
   MaybeHandle<HeapObject> ReadSharedObject() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadHostObject() V8_WARN_UNUSED_RESULT;
 
+  // Creates an external string pointing into {data_backing_store_}, if one was
+  // provided and the string is large enough to be worth it.
+  MaybeHandle<String> TryReadExternalString(base::Vector<const uint8_t> bytes,
+                                            bool one_byte,
+                                            AllocationType allocation);
+
   /*
    * Reads key-value pairs into the object until the specified end tag is
    * encountered. If successful, returns the number of properties read.
@@ -332,15 +356,26 @@ class ValueDeserializer {
   const uint8_t* const end_;
   uint32_t version_ = 0;
   uint32_t next_id_ = 0;
+  uint32_t next_shape_id_ = 0;
   bool version_13_broken_data_mode_ = false;
   bool suppress_deserialization_errors_ = false;
 
+  // Shapes are stored in {shape_map_} as FixedArrays holding the map of the
+  // last object created from the shape (or undefined) followed by the
+  // property names.
+  static constexpr int kShapeMapIndex = 0;
+  static constexpr int kShapeFirstKeyIndex = 1;
+
   // Always global handles.
   Handle<FixedArray> id_map_;
+  Handle<FixedArray> shape_map_;
   MaybeHandle<SimpleNumberDictionary> array_buffer_transfer_map_;
 
   // The conveyor used to keep shared objects alive.
   const SharedObjectConveyorHandles* shared_object_conveyor_ = nullptr;
+
+  // The backing store containing the data, if any.
+  std::shared_ptr<v8::BackingStore> data_backing_store_;
 };
 
 }  // namespace internal
@@ -2723,7 +2723,9 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
       can_post_parallel_task && !flags().is_reparse() &&
       ((is_eager_top_level_function &&
         flags().post_parallel_compile_tasks_for_eager_toplevel()) ||
-       (is_lazy && flags().post_parallel_compile_tasks_for_lazy()));
+       (is_lazy && flags().post_parallel_compile_tasks_for_lazy()) ||
+       (is_lazy && is_top_level &&
+        flags().post_parallel_compile_tasks_for_lazy_toplevel()));
 
   // Determine whether we should lazy parse the inner function. This will be
   // when either the function is lazy by inspection, or when we force it to be
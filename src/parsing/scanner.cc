@@ -18,9 +18,125 @@
 #include "src/parsing/scanner-inl.h"
 #include "src/zone/zone.h"
 
+#ifdef V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#elif defined(V8_HOST_ARCH_ARM64)
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Comments are skipped by looking for a handful of code units, which is done
+// eight code units at a time where SIMD is available. The functions below
+// return the start of the first block of eight code units that may contain
+// one of them; the caller scans that block one code unit at a time.
+#ifdef V8_HOST_ARCH_X64
+using CodeUnitBlock = __m128i;
+
+V8_INLINE CodeUnitBlock LoadBlock(const uint16_t* chars) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+}
+V8_INLINE CodeUnitBlock MatchCodeUnit(CodeUnitBlock block, uint16_t c) {
+  return _mm_cmpeq_epi16(block, _mm_set1_epi16(static_cast<int16_t>(c)));
+}
+V8_INLINE CodeUnitBlock MatchEither(CodeUnitBlock a, CodeUnitBlock b) {
+  return _mm_or_si128(a, b);
+}
+V8_INLINE CodeUnitBlock MatchLineTerminators(CodeUnitBlock block) {
+  // U+2028 and U+2029 only differ in their lowest bit.
+  CodeUnitBlock ls_or_ps = _mm_cmpeq_epi16(
+      _mm_and_si128(block, _mm_set1_epi16(static_cast<int16_t>(0xFFFE))),
+      _mm_set1_epi16(0x2028));
+  return MatchEither(
+      MatchEither(MatchCodeUnit(block, '\n'), MatchCodeUnit(block, '\r')),
+      ls_or_ps);
+}
+V8_INLINE bool AnyMatch(CodeUnitBlock matches) {
+  return _mm_movemask_epi8(matches) != 0;
+}
+#define V8_SCANNER_HAVE_SIMD 1
+#elif defined(V8_HOST_ARCH_ARM64)
+using CodeUnitBlock = uint16x8_t;
+
+V8_INLINE CodeUnitBlock LoadBlock(const uint16_t* chars) {
+  return vld1q_u16(chars);
+}
+V8_INLINE CodeUnitBlock MatchCodeUnit(CodeUnitBlock block, uint16_t c) {
+  return vceqq_u16(block, vdupq_n_u16(c));
+}
+V8_INLINE CodeUnitBlock MatchEither(CodeUnitBlock a, CodeUnitBlock b) {
+  return vorrq_u16(a, b);
+}
+V8_INLINE CodeUnitBlock MatchLineTerminators(CodeUnitBlock block) {
+  // U+2028 and U+2029 only differ in their lowest bit.
+  CodeUnitBlock ls_or_ps = vceqq_u16(vandq_u16(block, vdupq_n_u16(0xFFFE)),
+                                     vdupq_n_u16(0x2028));
+  return MatchEither(
+      MatchEither(MatchCodeUnit(block, '\n'), MatchCodeUnit(block, '\r')),
+      ls_or_ps);
+}
+V8_INLINE bool AnyMatch(CodeUnitBlock matches) {
+  return vmaxvq_u16(matches) != 0;
+}
+#define V8_SCANNER_HAVE_SIMD 1
+#else
+#define V8_SCANNER_HAVE_SIMD 0
+#endif
+
+#if V8_SCANNER_HAVE_SIMD
+template <typename MatchFunction>
+V8_INLINE const uint16_t* SkipBlocksWithoutMatch(const uint16_t* start,
+                                                 const uint16_t* end,
+                                                 MatchFunction match) {
+  constexpr int kCodeUnitBlockSize = 8;
+  while (end - start >= kCodeUnitBlockSize) {
+    if (AnyMatch(match(LoadBlock(start)))) break;
+    start += kCodeUnitBlockSize;
+  }
+  return start;
+}
+#endif
+
+V8_INLINE const uint16_t* SkipToLineTerminator(const uint16_t* start,
+                                               const uint16_t* end) {
+#if V8_SCANNER_HAVE_SIMD
+  return SkipBlocksWithoutMatch(start, end, [](CodeUnitBlock block) {
+    return MatchLineTerminators(block);
+  });
+#else
+  return start;
+#endif
+}
+
+V8_INLINE const uint16_t* SkipToAsteriskOrLineTerminator(
+    const uint16_t* start, const uint16_t* end) {
+#if V8_SCANNER_HAVE_SIMD
+  return SkipBlocksWithoutMatch(start, end, [](CodeUnitBlock block) {
+    return MatchEither(MatchCodeUnit(block, '*'), MatchLineTerminators(block));
+  });
+#else
+  return start;
+#endif
+}
+
+V8_INLINE const uint16_t* SkipToAsterisk(const uint16_t* start,
+                                         const uint16_t* end) {
+#if V8_SCANNER_HAVE_SIMD
+  return SkipBlocksWithoutMatch(start, end, [](CodeUnitBlock block) {
+    return MatchCodeUnit(block, '*');
+  });
+#else
+  return start;
+#endif
+}
+
+#undef V8_SCANNER_HAVE_SIMD
+
+}  // namespace
+
 class Scanner::ErrorState {
  public:
   ErrorState(MessageTemplate* message_stack, Scanner::Location* location_stack)
@@ -210,7 +326,9 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
+  AdvanceUntil(SkipToLineTerminator, [](base::uc32 c0) {
+    return unibrow::IsLineTerminator(c0);
+  });
 
   return Token::WHITESPACE;
 }
@@ -290,7 +408,7 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
-      AdvanceUntil([](base::uc32 c0) {
+      AdvanceUntil(SkipToAsteriskOrLineTerminator, [](base::uc32 c0) {
         if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
           return unibrow::IsLineTerminator(c0);
         }
@@ -315,7 +433,7 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
+    AdvanceUntil(SkipToAsterisk, [](base::uc32 c0) { return c0 == '*'; });
 
     while (c0_ == '*') {
       Advance();
@@ -75,9 +75,23 @@ class Utf16CharacterStream {
   // returns kEndOfInput.
   template <typename FunctionType>
   V8_INLINE base::uc32 AdvanceUntil(FunctionType check) {
+    return AdvanceUntil(
+        [](const uint16_t* start, const uint16_t* end) { return start; },
+        check);
+  }
+
+  // Same as above, but {skip} is first used to fast-forward over the
+  // code units of each buffer. {skip} is given the buffered range [start, end)
+  // and must return a position within it such that no code unit before that
+  // position meets {check}.
+  template <typename SkipFunction, typename FunctionType>
+  V8_INLINE base::uc32 AdvanceUntil(SkipFunction skip, FunctionType check) {
     while (true) {
+      const uint16_t* skipped = skip(buffer_cursor_, buffer_end_);
+      DCHECK_LE(buffer_cursor_, skipped);
+      DCHECK_LE(skipped, buffer_end_);
       auto next_cursor_pos =
-          std::find_if(buffer_cursor_, buffer_end_, [&check](uint16_t raw_c0_) {
+          std::find_if(skipped, buffer_end_, [&check](uint16_t raw_c0_) {
             base::uc32 c0_ = static_cast<base::uc32>(raw_c0_);
             return check(c0_);
           });
@@ -549,6 +563,11 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename SkipFunction, typename FunctionType>
+  V8_INLINE void AdvanceUntil(SkipFunction skip, FunctionType check) {
+    c0_ = source_->AdvanceUntil(skip, check);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
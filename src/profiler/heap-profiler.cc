@@ -145,10 +145,14 @@ void HeapProfiler::WriteSnapshotToDiskAfterGC() {
     v8::HeapProfiler::HeapSnapshotOptions options;
     std::unique_ptr<HeapSnapshot> result(
         new HeapSnapshot(this, options.snapshot_mode, options.numerics_mode));
-    HeapSnapshotGenerator generator(result.get(), options.control,
-                                    options.global_object_name_resolver, heap(),
-                                    options.stack_state);
-    if (!generator.GenerateSnapshotAfterGC()) return;
+    {
+      // Release the generator's object-to-entry maps before serializing, so
+      // they don't add to the peak memory of writing the snapshot.
+      HeapSnapshotGenerator generator(result.get(), options.control,
+                                      options.global_object_name_resolver,
+                                      heap(), options.stack_state);
+      if (!generator.GenerateSnapshotAfterGC()) return;
+    }
     FileOutputStream stream(filename.c_str());
     HeapSnapshotJSONSerializer serializer(result.get());
     serializer.Serialize(&stream);
@@ -159,9 +163,15 @@ void HeapProfiler::WriteSnapshotToDiskAfterGC() {
 void HeapProfiler::TakeSnapshotToFile(
     const v8::HeapProfiler::HeapSnapshotOptions options, std::string filename) {
   HeapSnapshot* snapshot = TakeSnapshot(options);
-  FileOutputStream stream(filename.c_str());
-  HeapSnapshotJSONSerializer serializer(snapshot);
-  serializer.Serialize(&stream);
+  if (!snapshot) return;
+  {
+    FileOutputStream stream(filename.c_str());
+    HeapSnapshotJSONSerializer serializer(snapshot);
+    serializer.Serialize(&stream);
+  }
+  // The snapshot is never handed out to the embedder, so don't keep the whole
+  // graph alive until the next DeleteAllSnapshots().
+  snapshot->Delete();
 }
 
 bool HeapProfiler::StartSamplingHeapProfiler(
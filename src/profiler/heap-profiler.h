@@ -63,7 +63,8 @@ class HeapProfiler : public HeapObjectAllocationTracker {
 
   // Implementation of --heap-snapshot-on-oom.
   void WriteSnapshotToDiskAfterGC();
-  // Just takes a snapshot performing GC as part of the snapshot.
+  // Just takes a snapshot performing GC as part of the snapshot. The snapshot
+  // is written to |filename| and then discarded.
   void TakeSnapshotToFile(const v8::HeapProfiler::HeapSnapshotOptions options,
                           std::string filename);
 
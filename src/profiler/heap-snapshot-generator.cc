@@ -4,6 +4,9 @@
 
 #include "src/profiler/heap-snapshot-generator.h"
 
+#include <algorithm>
+#include <map>
+#include <string>
 #include <utility>
 
 #include "src/api/api-inl.h"
@@ -510,6 +513,105 @@ HeapEntry* HeapSnapshot::GetEntryById(SnapshotObjectId id) {
 
 void HeapSnapshot::Print(int max_depth) { root()->Print("", "", max_depth, 0); }
 
+namespace {
+
+// Mirrors the grouping of the DevTools summary view.
+std::string ClassNameForDiff(const HeapEntry* entry) {
+  switch (entry->type()) {
+    case HeapEntry::kObject:
+    case HeapEntry::kNative:
+      return entry->name();
+    case HeapEntry::kHidden:
+      return "(system)";
+    case HeapEntry::kArray:
+      return "(array)";
+    case HeapEntry::kString:
+      return "(string)";
+    case HeapEntry::kCode:
+      return "(compiled code)";
+    case HeapEntry::kClosure:
+      return "(closure)";
+    case HeapEntry::kRegExp:
+      return "(regexp)";
+    case HeapEntry::kHeapNumber:
+      return "(number)";
+    case HeapEntry::kSynthetic:
+      return "(synthetic)";
+    case HeapEntry::kConsString:
+      return "(concatenated string)";
+    case HeapEntry::kSlicedString:
+      return "(sliced string)";
+    case HeapEntry::kSymbol:
+      return "(symbol)";
+    case HeapEntry::kBigInt:
+      return "(bigint)";
+    case HeapEntry::kObjectShape:
+      return "(object shape)";
+    case HeapEntry::kNumTypes:
+      break;
+  }
+  UNREACHABLE();
+}
+
+std::vector<const HeapEntry*> EntriesSortedById(
+    const std::deque<HeapEntry>& entries) {
+  std::vector<const HeapEntry*> sorted;
+  sorted.reserve(entries.size());
+  for (const HeapEntry& entry : entries) sorted.push_back(&entry);
+  std::sort(sorted.begin(), sorted.end(),
+            [](const HeapEntry* a, const HeapEntry* b) {
+              return a->id() < b->id();
+            });
+  return sorted;
+}
+
+}  // namespace
+
+std::vector<v8::HeapSnapshotClassDelta> HeapSnapshot::DiffByClassName(
+    const HeapSnapshot& base) const {
+  std::vector<const HeapEntry*> current = EntriesSortedById(entries_);
+  std::vector<const HeapEntry*> previous = EntriesSortedById(base.entries_);
+
+  std::map<std::string, v8::HeapSnapshotClassDelta> deltas;
+  auto added = [&deltas](const HeapEntry* entry) {
+    v8::HeapSnapshotClassDelta& delta = deltas[ClassNameForDiff(entry)];
+    delta.added_count++;
+    delta.added_size += entry->self_size();
+  };
+  auto removed = [&deltas](const HeapEntry* entry) {
+    v8::HeapSnapshotClassDelta& delta = deltas[ClassNameForDiff(entry)];
+    delta.removed_count++;
+    delta.removed_size += entry->self_size();
+  };
+
+  // Both lists are sorted by id, so a single merge pass finds the entries
+  // present in only one of the snapshots.
+  auto current_it = current.begin();
+  auto previous_it = previous.begin();
+  while (current_it != current.end() && previous_it != previous.end()) {
+    SnapshotObjectId current_id = (*current_it)->id();
+    SnapshotObjectId previous_id = (*previous_it)->id();
+    if (current_id < previous_id) {
+      added(*current_it++);
+    } else if (previous_id < current_id) {
+      removed(*previous_it++);
+    } else {
+      ++current_it;
+      ++previous_it;
+    }
+  }
+  std::for_each(current_it, current.end(), added);
+  std::for_each(previous_it, previous.end(), removed);
+
+  std::vector<v8::HeapSnapshotClassDelta> result;
+  result.reserve(deltas.size());
+  for (auto& [class_name, delta] : deltas) {
+    delta.class_name = class_name;
+    result.push_back(std::move(delta));
+  }
+  return result;
+}
+
 // We split IDs on evens for embedder objects (see
 // HeapObjectsMap::GenerateId) and odds for native objects.
 const SnapshotObjectId HeapObjectsMap::kInternalRootObjectId = 1;
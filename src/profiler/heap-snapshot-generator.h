@@ -264,6 +264,12 @@ class HeapSnapshot {
   HeapEntry* GetEntryById(SnapshotObjectId id);
   void FillChildren();
 
+  // Per-class differences between |base| and this snapshot, with entries
+  // matched by id. Only reads the snapshots, so it is safe off the main
+  // thread.
+  std::vector<v8::HeapSnapshotClassDelta> DiffByClassName(
+      const HeapSnapshot& base) const;
+
   void Print(int max_depth);
 
  private:
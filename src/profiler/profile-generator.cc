@@ -958,12 +958,14 @@ void InstructionStreamMap::Clear() {
   }
 
   code_map_.clear();
+  generation_++;
 }
 
 void InstructionStreamMap::AddCode(Address addr, CodeEntry* entry,
                                    unsigned size) {
   code_map_.emplace(addr, CodeEntryMapInfo{entry, size});
   entry->set_instruction_start(addr);
+  generation_++;
 }
 
 bool InstructionStreamMap::RemoveCode(CodeEntry* entry) {
@@ -972,6 +974,7 @@ bool InstructionStreamMap::RemoveCode(CodeEntry* entry) {
     if (i->second.entry == entry) {
       code_entries_.DecRef(entry);
       code_map_.erase(i);
+      generation_++;
       return true;
     }
   }
@@ -989,6 +992,7 @@ void InstructionStreamMap::ClearCodesInRange(Address start, Address end) {
     code_entries_.DecRef(right->second.entry);
   }
   code_map_.erase(left, right);
+  generation_++;
 }
 
 CodeEntry* InstructionStreamMap::FindEntry(Address addr,
@@ -1028,6 +1032,7 @@ void InstructionStreamMap::MoveCode(Address from, Address to) {
   }
 
   code_map_.erase(range.first, it);
+  generation_++;
 }
 
 void InstructionStreamMap::Print() {
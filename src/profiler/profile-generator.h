@@ -503,6 +503,10 @@ class V8_EXPORT_PRIVATE InstructionStreamMap {
   void Print();
   size_t size() const { return code_map_.size(); }
 
+  // Incremented whenever the mapping changes, so that lookup results can be
+  // cached. Never 0, which can be used for invalid cache entries.
+  uint64_t generation() const { return generation_; }
+
   size_t GetEstimatedMemoryUsage() const;
 
   CodeEntryStorage& code_entries() { return code_entries_; }
@@ -517,6 +521,7 @@ class V8_EXPORT_PRIVATE InstructionStreamMap {
 
   std::multimap<Address, CodeEntryMapInfo> code_map_;
   CodeEntryStorage& code_entries_;
+  uint64_t generation_ = 1;
 };
 
 // Manages the lifetime of CodeEntry objects, and stores shared resources
@@ -112,6 +112,7 @@ void SamplingHeapProfiler::OnWeakCallback(
              v8::HeapProfiler::kSamplingIncludeObjectsCollectedByMajorGC);
   if (should_keep_sample) {
     sample->global.Reset();
+    sample->gc_count_at_collection = heap->gc_count();
     return;
   }
   AllocationNode* node = sample->owner;
@@ -303,9 +304,17 @@ SamplingHeapProfiler::BuildSamples() const {
   samples.reserve(samples_.size());
   for (const auto& it : samples_) {
     const Sample* sample = it.second.get();
+    // The GC counter is bumped at the start of every GC, so the collecting GC
+    // is already included in |gc_count_at_collection|.
+    int survived_gc_count =
+        sample->gc_count_at_collection
+            ? *sample->gc_count_at_collection - 1 -
+                  sample->gc_count_at_allocation
+            : heap_->gc_count() - sample->gc_count_at_allocation;
     samples.emplace_back(v8::AllocationProfile::Sample{
         sample->owner->id_, sample->size, ScaleSample(sample->size, 1).count,
-        sample->sample_id});
+        sample->sample_id, static_cast<unsigned int>(survived_gc_count),
+        sample->allocation_time_ms});
   }
   return samples;
 }
@@ -11,6 +11,7 @@
 #include <unordered_map>
 
 #include "include/v8-profiler.h"
+#include "src/base/optional.h"
 #include "src/heap/heap.h"
 #include "src/profiler/strings-storage.h"
 
@@ -106,7 +107,10 @@ class SamplingHeapProfiler {
           owner(owner_),
           global(reinterpret_cast<v8::Isolate*>(profiler_->isolate_), local_),
           profiler(profiler_),
-          sample_id(sample_id) {}
+          sample_id(sample_id),
+          gc_count_at_allocation(profiler_->heap_->gc_count()),
+          allocation_time_ms(
+              profiler_->heap_->MonotonicallyIncreasingTimeInMs()) {}
     Sample(const Sample&) = delete;
     Sample& operator=(const Sample&) = delete;
     const size_t size;
@@ -114,6 +118,10 @@ class SamplingHeapProfiler {
     Global<Value> global;
     SamplingHeapProfiler* const profiler;
     const uint64_t sample_id;
+    const int gc_count_at_allocation;
+    const double allocation_time_ms;
+    // Set once the sampled object is collected while the sample is kept.
+    base::Optional<int> gc_count_at_collection;
   };
 
   SamplingHeapProfiler(Heap* heap, StringsStorage* names, uint64_t rate,
@@ -150,7 +158,13 @@ class SamplingHeapProfiler {
 
     intptr_t GetNextStepSize() override { return GetNextSampleInterval(rate_); }
 
+    // Sampling at large intervals tolerates picking the first object allocated
+    // after the interval ended, which keeps LABs at full size.
+    bool IsLazy() const override { return rate_ >= kMinLazySampleInterval; }
+
    private:
+    static constexpr uint64_t kMinLazySampleInterval = 64 * KB;
+
     intptr_t GetNextSampleInterval(uint64_t rate);
     SamplingHeapProfiler* const profiler_;
     Heap* const heap_;
@@ -4,6 +4,7 @@
 
 #include "src/profiler/symbolizer.h"
 
+#include "src/base/bits.h"
 #include "src/execution/vm-state.h"
 #include "src/profiler/profile-generator.h"
 #include "src/profiler/profiler-stats.h"
@@ -17,7 +18,20 @@ Symbolizer::Symbolizer(InstructionStreamMap* instruction_stream_map)
 
 CodeEntry* Symbolizer::FindEntry(Address address,
                                  Address* out_instruction_start) {
-  return code_map_->FindEntry(address, out_instruction_start);
+  static_assert(base::bits::IsPowerOfTwo(kLookupCacheSize));
+  size_t index = ((address >> 2) ^ (address >> 12)) & (kLookupCacheSize - 1);
+  LookupCacheEntry& cached = lookup_cache_[index];
+  if (cached.address != address ||
+      cached.generation != code_map_->generation()) {
+    cached.address = address;
+    cached.generation = code_map_->generation();
+    cached.instruction_start = kNullAddress;
+    cached.entry = code_map_->FindEntry(address, &cached.instruction_start);
+  }
+  if (cached.entry && out_instruction_start) {
+    *out_instruction_start = cached.instruction_start;
+  }
+  return cached.entry;
 }
 
 namespace {
@@ -5,6 +5,8 @@
 #ifndef V8_PROFILER_SYMBOLIZER_H_
 #define V8_PROFILER_SYMBOLIZER_H_
 
+#include <array>
+
 #include "src/base/macros.h"
 #include "src/profiler/profile-generator.h"
 
@@ -35,7 +37,19 @@ class V8_EXPORT_PRIVATE Symbolizer {
   CodeEntry* FindEntry(Address address,
                        Address* out_instruction_start = nullptr);
 
+  // Samples mostly hit the same few return addresses, so lookups in the
+  // InstructionStreamMap are cached in a small direct-mapped table. Entries
+  // are only valid for the generation of the map they were looked up in.
+  struct LookupCacheEntry {
+    Address address = kNullAddress;
+    uint64_t generation = 0;
+    CodeEntry* entry = nullptr;
+    Address instruction_start = kNullAddress;
+  };
+  static constexpr size_t kLookupCacheSize = 256;
+
   InstructionStreamMap* const code_map_;
+  std::array<LookupCacheEntry, kLookupCacheSize> lookup_cache_;
 };
 
 }  // namespace internal
@@ -4,6 +4,9 @@
 
 #include "src/regexp/experimental/experimental-interpreter.h"
 
+#include <algorithm>
+#include <array>
+
 #include "src/base/optional.h"
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
@@ -12,6 +15,7 @@
 #include "src/regexp/experimental/experimental.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/zone/zone-allocator.h"
+#include "src/zone/zone-containers.h"
 #include "src/zone/zone-list-inl.h"
 
 namespace v8 {
@@ -86,6 +90,277 @@ base::Vector<const base::uc16> ToCharacterVector<base::uc16>(
   return content.ToUC16Vector();
 }
 
+// A lazily constructed deterministic automaton for the experimental bytecode,
+// used to find out quickly whether there is any match at all.
+//
+// A DFA state is the set of CONSUME_RANGE instructions at which NFA threads
+// are blocked after the previous input character. States and transitions are
+// computed on demand while scanning the input, so the cost of the subset
+// construction is only paid for states that are actually visited. Since the
+// DFA only answers "is there a match?", thread priorities and registers are
+// irrelevant, and a state that contains an ACCEPT is a match.
+//
+// The input alphabet is partitioned into character classes such that all
+// characters of a class are either contained in or disjoint from every
+// CONSUME_RANGE of the program, so that transitions can be stored per class.
+//
+// The number of states is bounded. Once the bound is reached, the DFA gives up
+// and the caller has to fall back to the `NfaInterpreter`.
+template <class Character>
+class LazyDfa {
+ public:
+  enum class Result { kContinue, kMatch, kNoMatch, kCacheFull };
+
+  // Returns whether the DFA can handle `bytecode`. Only assertions that don't
+  // depend on the input characters are supported, since the DFA doesn't track
+  // the previous or next character. Lookbehinds aren't supported either.
+  static bool CanHandle(base::Vector<const RegExpInstruction> bytecode) {
+    for (const RegExpInstruction& inst : bytecode) {
+      switch (inst.opcode) {
+        case RegExpInstruction::ASSERTION:
+          if (inst.payload.assertion_type !=
+              RegExpAssertion::Type::START_OF_INPUT) {
+            return false;
+          }
+          break;
+        case RegExpInstruction::WRITE_LOOKBEHIND_TABLE:
+        case RegExpInstruction::READ_LOOKBEHIND_TABLE:
+          return false;
+        default:
+          break;
+      }
+    }
+    return true;
+  }
+
+  LazyDfa(base::Vector<const RegExpInstruction> bytecode, int max_states,
+          Zone* zone)
+      : max_states_(max_states),
+        class_boundaries_(zone),
+        state_ids_(zone),
+        states_(zone),
+        transitions_(zone),
+        visited_(static_cast<size_t>(2 * bytecode.length()), 0, zone),
+        worklist_(zone),
+        blocked_pcs_(zone),
+        zone_(zone) {
+    DCHECK(CanHandle(bytecode));
+    class_boundaries_.push_back(0);
+    for (const RegExpInstruction& inst : bytecode) {
+      if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+      RegExpInstruction::Uc16Range range = inst.payload.consume_range;
+      if (range.min > range.max) continue;
+      class_boundaries_.push_back(range.min);
+      if (range.max != String::kMaxUtf16CodeUnit) {
+        class_boundaries_.push_back(range.max + 1);
+      }
+    }
+    std::sort(class_boundaries_.begin(), class_boundaries_.end());
+    class_boundaries_.erase(
+        std::unique(class_boundaries_.begin(), class_boundaries_.end()),
+        class_boundaries_.end());
+    if constexpr (sizeof(Character) == 1) {
+      for (int c = 0; c < static_cast<int>(one_byte_classes_.size()); ++c) {
+        one_byte_classes_[c] = ComputeClass(c);
+      }
+    }
+  }
+
+  // Starts a new search from the initial state of the program.
+  Result Start(base::Vector<const RegExpInstruction> bytecode,
+               bool at_start_of_input) {
+    DCHECK(worklist_.empty());
+    worklist_.push_back(Thread(0, true));
+    return Enter(AddState(bytecode, at_start_of_input));
+  }
+
+  // Feeds the characters of `input` from `*index` up to `end` to the DFA and
+  // updates `*index` to the position of the next unconsumed character.
+  // Returns kContinue if all characters were consumed without deciding the
+  // search.
+  Result Run(base::Vector<const RegExpInstruction> bytecode,
+             base::Vector<const Character> input, int* index, int end) {
+    DCHECK_GE(current_state_, 0);
+    const size_t class_count = class_boundaries_.size();
+    int state = current_state_;
+    int i = *index;
+    for (; i != end; ++i) {
+      const int char_class = ClassOf(input[i]);
+      const size_t slot = state * class_count + char_class;
+      int next = transitions_[slot];
+      if (next == kUnknownState) {
+        next = ComputeTransition(bytecode, state, char_class);
+        if (next == kCacheFull) break;
+        transitions_[slot] = next;
+      }
+      if (next < 0) {
+        *index = i + 1;
+        return Enter(next);
+      }
+      state = next;
+    }
+    *index = i;
+    return i == end ? Enter(state) : Result::kCacheFull;
+  }
+
+ private:
+  static constexpr int kUnknownState = -1;
+  static constexpr int kMatchState = -2;
+  static constexpr int kDeadState = -3;
+  static constexpr int kCacheFull = -4;
+
+  static int Thread(int pc, bool consumed) {
+    return 2 * pc + (consumed ? 1 : 0);
+  }
+
+  int ComputeClass(int c) const {
+    return static_cast<int>(std::upper_bound(class_boundaries_.begin(),
+                                             class_boundaries_.end(), c) -
+                            class_boundaries_.begin()) -
+           1;
+  }
+
+  int ClassOf(Character c) const {
+    if constexpr (sizeof(Character) == 1) {
+      return one_byte_classes_[c];
+    } else {
+      return ComputeClass(c);
+    }
+  }
+
+  Result Enter(int state) {
+    switch (state) {
+      case kMatchState:
+        return Result::kMatch;
+      case kDeadState:
+        return Result::kNoMatch;
+      case kCacheFull:
+        return Result::kCacheFull;
+      default:
+        DCHECK_GE(state, 0);
+        current_state_ = state;
+        return Result::kContinue;
+    }
+  }
+
+  // Computes the successor of `state` on characters of class `char_class`.
+  int ComputeTransition(base::Vector<const RegExpInstruction> bytecode,
+                        int state, int char_class) {
+    DCHECK(worklist_.empty());
+    const int c = class_boundaries_[char_class];
+    for (int pc : *states_[state]) {
+      RegExpInstruction::Uc16Range range = bytecode[pc].payload.consume_range;
+      if (c >= range.min && c <= range.max) {
+        worklist_.push_back(Thread(pc + 1, true));
+      }
+    }
+    return AddState(bytecode, false);
+  }
+
+  // Runs the threads in `worklist_` until they block on a CONSUME_RANGE and
+  // returns the id of the state given by the blocked threads. As in
+  // `NfaInterpreter`, threads are identified by their pc and whether they have
+  // consumed a character since entering the last quantifier.
+  int AddState(base::Vector<const RegExpInstruction> bytecode,
+               bool at_start_of_input) {
+    ++generation_;
+    blocked_pcs_.clear();
+    bool accepting = false;
+    while (!worklist_.empty()) {
+      const int thread = worklist_.back();
+      worklist_.pop_back();
+      if (visited_[thread] == generation_) continue;
+      visited_[thread] = generation_;
+
+      const int pc = thread / 2;
+      const bool consumed = thread % 2 == 1;
+      const RegExpInstruction& inst = bytecode[pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+          if (inst.payload.consume_range.min <=
+              inst.payload.consume_range.max) {
+            blocked_pcs_.push_back(pc);
+          }
+          break;
+        case RegExpInstruction::ASSERTION:
+          DCHECK_EQ(inst.payload.assertion_type,
+                    RegExpAssertion::Type::START_OF_INPUT);
+          if (at_start_of_input) worklist_.push_back(Thread(pc + 1, consumed));
+          break;
+        case RegExpInstruction::FORK:
+          worklist_.push_back(Thread(inst.payload.pc, consumed));
+          worklist_.push_back(Thread(pc + 1, consumed));
+          break;
+        case RegExpInstruction::JMP:
+          worklist_.push_back(Thread(inst.payload.pc, consumed));
+          break;
+        case RegExpInstruction::ACCEPT:
+          accepting = true;
+          break;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::CLEAR_REGISTER:
+          worklist_.push_back(Thread(pc + 1, consumed));
+          break;
+        case RegExpInstruction::BEGIN_LOOP:
+          worklist_.push_back(Thread(pc + 1, false));
+          break;
+        case RegExpInstruction::END_LOOP:
+          if (consumed) worklist_.push_back(Thread(pc + 1, true));
+          break;
+        case RegExpInstruction::WRITE_LOOKBEHIND_TABLE:
+        case RegExpInstruction::READ_LOOKBEHIND_TABLE:
+          UNREACHABLE();
+      }
+    }
+    if (accepting) return kMatchState;
+    if (blocked_pcs_.empty()) return kDeadState;
+
+    std::sort(blocked_pcs_.begin(), blocked_pcs_.end());
+    blocked_pcs_.erase(std::unique(blocked_pcs_.begin(), blocked_pcs_.end()),
+                       blocked_pcs_.end());
+    auto it = state_ids_.find(blocked_pcs_);
+    if (it != state_ids_.end()) return it->second;
+    if (states_.size() >= static_cast<size_t>(max_states_)) return kCacheFull;
+
+    const int id = static_cast<int>(states_.size());
+    it = state_ids_
+             .emplace(ZoneVector<int>(blocked_pcs_.begin(), blocked_pcs_.end(),
+                                      zone_),
+                      id)
+             .first;
+    states_.push_back(&it->first);
+    transitions_.resize(transitions_.size() + class_boundaries_.size(),
+                        kUnknownState);
+    return id;
+  }
+
+  const int max_states_;
+
+  // Sorted lower bounds of the character classes.
+  ZoneVector<int> class_boundaries_;
+  // Character classes of all one-byte characters, only used for one-byte
+  // subjects.
+  std::array<int, String::kMaxOneByteCharCode + 1> one_byte_classes_;
+
+  // Maps the sorted pcs of the blocked threads of a state to its id.
+  ZoneMap<ZoneVector<int>, int> state_ids_;
+  // The blocked pcs of each state, indexed by state id.
+  ZoneVector<const ZoneVector<int>*> states_;
+  // transitions_[id * class count + class] is the successor state of `id`,
+  // or one of the negative k*State constants.
+  ZoneVector<int> transitions_;
+  int current_state_ = kUnknownState;
+
+  // Scratch space for `AddState`. `visited_[thread] == generation_` iff
+  // `thread` has already been seen while computing the current state.
+  ZoneVector<int> visited_;
+  int generation_ = 0;
+  ZoneVector<int> worklist_;
+  ZoneVector<int> blocked_pcs_;
+
+  Zone* zone_;
+};
+
 template <class Character>
 class NfaInterpreter {
   // Executes a bytecode program in breadth-first mode, without backtracking.
@@ -158,6 +433,11 @@ class NfaInterpreter {
         lookbehind_table_(0, zone),
         zone_(zone) {
     DCHECK(!bytecode_.empty());
+    if (v8_flags.experimental_regexp_engine_lazy_dfa &&
+        LazyDfa<Character>::CanHandle(bytecode_)) {
+      dfa_.emplace(bytecode_,
+                   v8_flags.experimental_regexp_engine_dfa_max_states, zone);
+    }
     DCHECK_GE(input_index_, 0);
     DCHECK_LE(input_index_, input_.length());
 
@@ -363,6 +643,16 @@ class NfaInterpreter {
       best_match_registers_ = base::nullopt;
     }
 
+    // Most subjects don't match most patterns, so we first find out whether
+    // there is a match at all. The NFA is only run to compute the capture
+    // registers of a match that is known to exist.
+    if (dfa_.has_value()) {
+      bool may_match;
+      int err_code = RunDfa(&may_match);
+      if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      if (!may_match) return RegExp::kInternalRegExpSuccess;
+    }
+
     // The lookbehind threads need to be executed before the thread of their
     // parent (lookbehind or main expression). The order of the bytecode (see
     // also `BytecodeAssembler`) ensures that they need to be executed from last
@@ -414,6 +704,36 @@ class NfaInterpreter {
     return RegExp::kInternalRegExpSuccess;
   }
 
+  // Runs `dfa_` from the current input index. Sets `*may_match` to false if
+  // there is no match starting at or after the current input index, and to
+  // true if there is one or if the DFA gave up. Returns
+  // RegExp::kInternalRegExpSuccess unless execution was interrupted.
+  int RunDfa(bool* may_match) {
+    using Result = typename LazyDfa<Character>::Result;
+    Result result = dfa_->Start(bytecode_, input_index_ == 0);
+    int index = input_index_;
+    while (result == Result::kContinue) {
+      if (index == input_.length()) {
+        result = Result::kNoMatch;
+        break;
+      }
+      static constexpr int kCharactersBetweenInterruptHandling = 1024;
+      const int chunk_end =
+          std::min(input_.length(), index + kCharactersBetweenInterruptHandling);
+      result = dfa_->Run(bytecode_, input_, &index, chunk_end);
+      if (result == Result::kContinue) {
+        int err_code = HandleInterrupts();
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      }
+    }
+    if (result == Result::kCacheFull) {
+      // Subsequent searches would most likely run out of states as well.
+      dfa_.reset();
+    }
+    *may_match = result != Result::kNoMatch;
+    return RegExp::kInternalRegExpSuccess;
+  }
+
   // Run an active thread `t` until it executes a CONSUME_RANGE or ACCEPT
   // instruction, or its PC value was already processed.
   // - If processing of `t` can't continue because of CONSUME_RANGE, it is
@@ -688,6 +1008,10 @@ class NfaInterpreter {
   // lookbehind of index k did complete a match on the current position.
   ZoneList<bool> lookbehind_table_;
 
+  // Used to reject subjects without a match before running the NFA, if the
+  // program can be handled by a DFA.
+  base::Optional<LazyDfa<Character>> dfa_;
+
   Zone* zone_;
 };
 
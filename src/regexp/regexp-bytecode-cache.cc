@@ -0,0 +1,169 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-bytecode-cache.h"
+
+#include <deque>
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+#include "src/heap/factory.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/objects/string-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Bounds on the memory used by the cache.
+constexpr size_t kMaxEntries = 512;
+constexpr int kMaxPatternLength = 1024;
+constexpr int kMaxBytecodeLength = 64 * KB;
+
+struct Key {
+  std::vector<base::uc16> source;
+  int flags;
+  bool is_one_byte;
+  uint32_t backtrack_limit;
+
+  bool operator<(const Key& other) const {
+    return std::tie(source, flags, is_one_byte, backtrack_limit) <
+           std::tie(other.source, other.flags, other.is_one_byte,
+                    other.backtrack_limit);
+  }
+};
+
+struct Entry {
+  // Empty if only the tier-up has been recorded.
+  std::vector<uint8_t> bytecode;
+  int register_count = 0;
+  bool tiered_up = false;
+};
+
+class BytecodeCache {
+ public:
+  base::Mutex* mutex() { return &mutex_; }
+
+  Entry* Find(const Key& key) {
+    mutex_.AssertHeld();
+    auto it = entries_.find(key);
+    return it == entries_.end() ? nullptr : &it->second;
+  }
+
+  Entry* FindOrInsert(Key key) {
+    mutex_.AssertHeld();
+    auto [it, inserted] = entries_.emplace(std::move(key), Entry{});
+    if (inserted) {
+      insertion_order_.push_back(it);
+      if (entries_.size() > kMaxEntries) {
+        entries_.erase(insertion_order_.front());
+        insertion_order_.pop_front();
+      }
+    }
+    return &it->second;
+  }
+
+  void Clear() {
+    mutex_.AssertHeld();
+    insertion_order_.clear();
+    entries_.clear();
+  }
+
+ private:
+  base::Mutex mutex_;
+  std::map<Key, Entry> entries_;
+  std::deque<std::map<Key, Entry>::iterator> insertion_order_;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(BytecodeCache, GetBytecodeCache)
+
+// Returns false if the pattern is too long to be cached.
+bool MakeKey(Tagged<String> pattern, RegExpFlags flags, bool is_one_byte,
+             uint32_t backtrack_limit, Key* key) {
+  if (pattern->length() > kMaxPatternLength) return false;
+  key->source.resize(pattern->length());
+  String::WriteToFlat(pattern, key->source.data(), 0, pattern->length());
+  key->flags = static_cast<int>(flags);
+  key->is_one_byte = is_one_byte;
+  key->backtrack_limit = backtrack_limit;
+  return true;
+}
+
+}  // namespace
+
+// static
+MaybeHandle<ByteArray> RegExpBytecodeCache::Lookup(
+    Isolate* isolate, Tagged<String> pattern, RegExpFlags flags,
+    bool is_one_byte, uint32_t backtrack_limit, int* register_count) {
+  Key key;
+  if (!MakeKey(pattern, flags, is_one_byte, backtrack_limit, &key)) {
+    return {};
+  }
+  BytecodeCache* cache = GetBytecodeCache();
+  base::MutexGuard guard(cache->mutex());
+  Entry* entry = cache->Find(key);
+  if (entry == nullptr || entry->bytecode.empty()) return {};
+
+  const int length = static_cast<int>(entry->bytecode.size());
+  Handle<ByteArray> bytecode = isolate->factory()->NewByteArray(length);
+  MemCopy(bytecode->begin(), entry->bytecode.data(), length);
+  *register_count = entry->register_count;
+  return bytecode;
+}
+
+// static
+void RegExpBytecodeCache::Insert(Tagged<String> pattern, RegExpFlags flags,
+                                 bool is_one_byte, uint32_t backtrack_limit,
+                                 Tagged<ByteArray> bytecode,
+                                 int register_count) {
+  if (bytecode->length() == 0 || bytecode->length() > kMaxBytecodeLength) {
+    return;
+  }
+  Key key;
+  if (!MakeKey(pattern, flags, is_one_byte, backtrack_limit, &key)) return;
+  BytecodeCache* cache = GetBytecodeCache();
+  base::MutexGuard guard(cache->mutex());
+  Entry* entry = cache->FindOrInsert(std::move(key));
+  entry->bytecode.assign(bytecode->begin(), bytecode->end());
+  entry->register_count = register_count;
+}
+
+// static
+void RegExpBytecodeCache::RecordTierUp(Tagged<String> pattern,
+                                       RegExpFlags flags, bool is_one_byte,
+                                       uint32_t backtrack_limit) {
+  Key key;
+  if (!MakeKey(pattern, flags, is_one_byte, backtrack_limit, &key)) return;
+  BytecodeCache* cache = GetBytecodeCache();
+  base::MutexGuard guard(cache->mutex());
+  cache->FindOrInsert(std::move(key))->tiered_up = true;
+}
+
+// static
+bool RegExpBytecodeCache::HasTieredUp(Tagged<String> pattern,
+                                      RegExpFlags flags, bool is_one_byte,
+                                      uint32_t backtrack_limit) {
+  Key key;
+  if (!MakeKey(pattern, flags, is_one_byte, backtrack_limit, &key)) {
+    return false;
+  }
+  BytecodeCache* cache = GetBytecodeCache();
+  base::MutexGuard guard(cache->mutex());
+  Entry* entry = cache->Find(key);
+  return entry != nullptr && entry->tiered_up;
+}
+
+// static
+void RegExpBytecodeCache::ClearForTesting() {
+  BytecodeCache* cache = GetBytecodeCache();
+  base::MutexGuard guard(cache->mutex());
+  cache->Clear();
+}
+
+}  // namespace internal
+}  // namespace v8
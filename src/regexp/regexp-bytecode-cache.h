@@ -0,0 +1,58 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+#define V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+
+#include "src/common/globals.h"
+#include "src/handles/maybe-handles.h"
+#include "src/regexp/regexp-flags.h"
+
+namespace v8 {
+namespace internal {
+
+class ByteArray;
+class String;
+
+// A process-wide cache of irregexp compilation results, shared by all
+// isolates. Every isolate otherwise recompiles the same patterns, which is
+// costly for short-lived isolates that run the same framework code.
+//
+// Native code lives on the heap of a single isolate and can't be shared, but
+// regexp bytecode is position-independent and doesn't reference heap objects,
+// so a copy of it can be installed in any isolate. In addition, the cache
+// records which patterns were hot enough to tier up to native code, so that
+// other isolates can skip the interpreter for them.
+//
+// Entries are keyed by pattern source, flags, subject encoding and backtrack
+// limit. Patterns with named captures aren't cached, since their capture name
+// map is only available from the parser.
+class RegExpBytecodeCache final : public AllStatic {
+ public:
+  // Returns a copy of the cached bytecode allocated in {isolate}, or an empty
+  // handle. On success, {register_count} is set to the number of registers
+  // used by the bytecode.
+  static MaybeHandle<ByteArray> Lookup(Isolate* isolate,
+                                       Tagged<String> pattern,
+                                       RegExpFlags flags, bool is_one_byte,
+                                       uint32_t backtrack_limit,
+                                       int* register_count);
+
+  static void Insert(Tagged<String> pattern, RegExpFlags flags,
+                     bool is_one_byte, uint32_t backtrack_limit,
+                     Tagged<ByteArray> bytecode, int register_count);
+
+  // Records that the pattern was tiered up to native code in some isolate.
+  static void RecordTierUp(Tagged<String> pattern, RegExpFlags flags,
+                           bool is_one_byte, uint32_t backtrack_limit);
+  static bool HasTieredUp(Tagged<String> pattern, RegExpFlags flags,
+                          bool is_one_byte, uint32_t backtrack_limit);
+
+  static void ClearForTesting();
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
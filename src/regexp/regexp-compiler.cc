@@ -2877,13 +2877,27 @@ int BoyerMooreLookahead::FindBestInterval(int max_number_of_chars,
 // max_lookahead (inclusive) measured from the current position.  If the
 // character at max_lookahead offset is not one of these characters, then we
 // can safely skip forwards by the number of characters in the range.
+//
+// If {nibble_table} is given, it is filled with the same set of characters
+// in a layout that allows a SIMD lookup of 16 characters at once: the table
+// is indexed by the low nibble of the (masked) character, and bit i of an
+// entry is set if the character with high nibble i is in the set. A lookup
+// thus needs two shuffles (table[lo] and 1 << (hi & 7)) and a bitwise test.
+// Since kTableSize is 128, the high nibble is at most 7; masking it with 7
+// gives the same result as masking the character with kTableMask.
 int BoyerMooreLookahead::GetSkipTable(int min_lookahead, int max_lookahead,
-                                      Handle<ByteArray> boolean_skip_table) {
+                                      Handle<ByteArray> boolean_skip_table,
+                                      Handle<ByteArray> nibble_table) {
   const int kSkipArrayEntry = 0;
   const int kDontSkipArrayEntry = 1;
+  static_assert(RegExpMacroAssembler::kTableSize == 128);
 
   std::memset(boolean_skip_table->begin(), kSkipArrayEntry,
               boolean_skip_table->length());
+  const bool fill_nibble_table = !nibble_table.is_null();
+  if (fill_nibble_table) {
+    std::memset(nibble_table->begin(), 0, nibble_table->length());
+  }
 
   for (int i = max_lookahead; i >= min_lookahead; i--) {
     BoyerMoorePositionInfo::Bitset bitset = bitmaps_->at(i)->raw_bitset();
@@ -2893,6 +2907,12 @@ int BoyerMooreLookahead::GetSkipTable(int min_lookahead, int max_lookahead,
     while ((j = BitsetFirstSetBit(bitset)) != -1) {
       DCHECK(bitset[j]);  // Sanity check.
       boolean_skip_table->set(j, kDontSkipArrayEntry);
+      if (fill_nibble_table) {
+        int lo_nibble = j & 0x0f;
+        int hi_nibble = (j >> 4) & 0x07;
+        nibble_table->set(lo_nibble,
+                          nibble_table->get(lo_nibble) | (1 << hi_nibble));
+      }
       bitset.reset(j);
     }
   }
@@ -2939,7 +2959,8 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
     return;
   }
 
-  if (found_single_character) {
+  const bool use_simd = masm->SkipUntilBitInTableUseSimd(lookahead_width);
+  if (found_single_character && !use_simd) {
     Label cont, again;
     masm->Bind(&again);
     masm->LoadCurrentCharacter(max_lookahead, &cont, true);
@@ -2958,17 +2979,17 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
   Factory* factory = masm->isolate()->factory();
   Handle<ByteArray> boolean_skip_table =
       factory->NewByteArray(kSize, AllocationType::kOld);
-  int skip_distance =
-      GetSkipTable(min_lookahead, max_lookahead, boolean_skip_table);
+  Handle<ByteArray> nibble_table;
+  if (use_simd) {
+    nibble_table = factory->NewByteArray(RegExpMacroAssembler::kNibbleTableSize,
+                                         AllocationType::kOld);
+  }
+  int skip_distance = GetSkipTable(min_lookahead, max_lookahead,
+                                   boolean_skip_table, nibble_table);
   DCHECK_NE(0, skip_distance);
 
-  Label cont, again;
-  masm->Bind(&again);
-  masm->LoadCurrentCharacter(max_lookahead, &cont, true);
-  masm->CheckBitInTable(boolean_skip_table, &cont);
-  masm->AdvanceCurrentPosition(skip_distance);
-  masm->GoTo(&again);
-  masm->Bind(&cont);
+  masm->SkipUntilBitInTable(max_lookahead, boolean_skip_table, nibble_table,
+                            skip_distance);
 }
 
 /* Code generation for choice nodes.
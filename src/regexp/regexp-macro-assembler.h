@@ -38,6 +38,8 @@ class RegExpMacroAssembler {
   static constexpr int kTableSizeBits = 7;
   static constexpr int kTableSize = 1 << kTableSizeBits;
   static constexpr int kTableMask = kTableSize - 1;
+  // The nibble table for SkipUntilBitInTable has one entry per low nibble.
+  static constexpr int kNibbleTableSize = 16;
 
   static constexpr int kUseCharactersValue = -1;
 
@@ -108,6 +110,20 @@ class RegExpMacroAssembler {
   // array, and if the found byte is non-zero, we jump to the on_bit_set label.
   virtual void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set) = 0;
 
+  // Advances the current position by {advance_by} characters until the
+  // character at {cp_offset} from the current position is set in {table}
+  // (looked up like in CheckBitInTable), or until that character is beyond
+  // the end of the subject. May clobber the current loaded character.
+  // {nibble_table} is only used if SkipUntilBitInTableUseSimd() returns true
+  // and is null otherwise. See BoyerMooreLookahead::GetSkipTable for its
+  // layout.
+  virtual void SkipUntilBitInTable(int cp_offset, Handle<ByteArray> table,
+                                   Handle<ByteArray> nibble_table,
+                                   int advance_by);
+  // Whether SkipUntilBitInTable can check multiple characters at once with
+  // SIMD instructions, which needs {nibble_table}.
+  virtual bool SkipUntilBitInTableUseSimd(int advance_by) { return false; }
+
   // Checks whether the given offset from the current position is before
   // the end of the string.  May overwrite the current character.
   virtual void CheckPosition(int cp_offset, Label* on_outside_input);
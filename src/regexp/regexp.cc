@@ -11,6 +11,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/regexp/experimental/experimental.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -553,15 +554,22 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
 
   Handle<String> pattern(re->source(), isolate);
   pattern = String::Flatten(isolate, pattern);
+  uint32_t backtrack_limit = re->backtrack_limit();
   RegExpCompileData compile_data;
-  if (!RegExpParser::ParseRegExpFromHeapString(isolate, &zone, pattern, flags,
-                                               &compile_data)) {
-    // Throw an exception if we fail to parse the pattern.
-    // THIS SHOULD NOT HAPPEN. We already pre-parsed it successfully once.
-    USE(RegExp::ThrowRegExpException(isolate, re, flags, pattern,
-                                     compile_data.error));
-    return false;
+
+  if (v8_flags.regexp_process_wide_cache && re->ShouldProduceBytecode() &&
+      !v8_flags.regexp_interpret_all &&
+      RegExpBytecodeCache::HasTieredUp(*pattern, flags, is_one_byte,
+                                       backtrack_limit)) {
+    // The pattern has tiered up before, possibly in another isolate, so it is
+    // likely to tier up again. Skip the interpreter.
+    if (v8_flags.trace_regexp_tier_up) {
+      PrintF("JSRegExp object %p has tiered up before, skipping bytecode\n",
+             reinterpret_cast<void*>(re->ptr()));
+    }
+    re->MarkTierUpForNextExec();
   }
+
   // The compilation target is a kBytecode if we're interpreting all regexp
   // objects, or if we're using the tier-up strategy but the tier-up hasn't
   // happened yet. The compilation target is a kNative if we're using the
@@ -570,14 +578,47 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   compile_data.compilation_target = re->ShouldProduceBytecode()
                                         ? RegExpCompilationTarget::kBytecode
                                         : RegExpCompilationTarget::kNative;
-  uint32_t backtrack_limit = re->backtrack_limit();
-  const bool compilation_succeeded =
-      Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
-              is_one_byte, backtrack_limit);
-  if (!compilation_succeeded) {
-    DCHECK(compile_data.error != RegExpError::kNone);
-    RegExp::ThrowRegExpException(isolate, re, compile_data.error);
-    return false;
+
+  Handle<ByteArray> cached_bytecode;
+  if (v8_flags.regexp_process_wide_cache &&
+      compile_data.compilation_target == RegExpCompilationTarget::kBytecode &&
+      RegExpBytecodeCache::Lookup(isolate, *pattern, flags, is_one_byte,
+                                  backtrack_limit, &compile_data.register_count)
+          .ToHandle(&cached_bytecode)) {
+    // Cached entries never have named captures, so there's nothing else that
+    // we'd need from the parser.
+    compile_data.code = cached_bytecode;
+  } else {
+    if (!RegExpParser::ParseRegExpFromHeapString(isolate, &zone, pattern, flags,
+                                                 &compile_data)) {
+      // Throw an exception if we fail to parse the pattern.
+      // THIS SHOULD NOT HAPPEN. We already pre-parsed it successfully once.
+      USE(RegExp::ThrowRegExpException(isolate, re, flags, pattern,
+                                       compile_data.error));
+      return false;
+    }
+    const bool compilation_succeeded =
+        Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
+                is_one_byte, backtrack_limit);
+    if (!compilation_succeeded) {
+      DCHECK(compile_data.error != RegExpError::kNone);
+      RegExp::ThrowRegExpException(isolate, re, compile_data.error);
+      return false;
+    }
+
+    if (v8_flags.regexp_process_wide_cache) {
+      if (compile_data.compilation_target ==
+          RegExpCompilationTarget::kBytecode) {
+        if (compile_data.named_captures == nullptr) {
+          RegExpBytecodeCache::Insert(
+              *pattern, flags, is_one_byte, backtrack_limit,
+              ByteArray::cast(*compile_data.code), compile_data.register_count);
+        }
+      } else if (v8_flags.regexp_tier_up) {
+        RegExpBytecodeCache::RecordTierUp(*pattern, flags, is_one_byte,
+                                          backtrack_limit);
+      }
+    }
   }
 
   Handle<FixedArray> data =
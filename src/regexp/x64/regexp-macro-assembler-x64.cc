@@ -603,6 +603,83 @@ void RegExpMacroAssemblerX64::CheckBitInTable(
   BranchOrBacktrack(not_equal, on_bit_set);
 }
 
+void RegExpMacroAssemblerX64::SkipUntilBitInTable(
+    int cp_offset, Handle<ByteArray> table, Handle<ByteArray> nibble_table,
+    int advance_by) {
+  Label cont;
+
+  if (SkipUntilBitInTableUseSimd(advance_by)) {
+    // Look at 16 characters at a time, using the nibble table to emulate the
+    // bit table lookup for each of them (see
+    // BoyerMooreLookahead::GetSkipTable). Note that all 16 positions are
+    // tested, so the result doesn't depend on {advance_by}.
+    DCHECK(!nibble_table.is_null());
+    DCHECK_EQ(mode_, LATIN1);
+    static constexpr int kVectorSize = 16;
+    Label simd_repeat, found, scalar;
+    CpuFeatureScope ssse3_scope(&masm_, SSSE3);
+
+    // Fall back to the scalar loop once fewer than kVectorSize characters
+    // are left in the subject.
+    CheckPosition(cp_offset + kVectorSize - 1, &scalar);
+
+    // Only xmm0-xmm5 are used: the others are callee-saved on Win64.
+    const XMMRegister nibble_table_reg = xmm0;
+    const XMMRegister nibble_mask = xmm1;
+    const XMMRegister hi_nibble_lookup_mask = xmm2;
+    const XMMRegister input = xmm3;
+    const XMMRegister lo_nibbles = xmm4;
+    const XMMRegister row = xmm5;
+    __ Move(rax, nibble_table);
+    __ movdqu(nibble_table_reg, FieldOperand(rax, ByteArray::kHeaderSize));
+    __ Move(nibble_mask, uint64_t{0x0f0f0f0f0f0f0f0f},
+            uint64_t{0x0f0f0f0f0f0f0f0f});
+    __ Move(hi_nibble_lookup_mask, uint64_t{0x8040201008040201},
+            uint64_t{0x8040201008040201});
+
+    __ bind(&simd_repeat);
+    __ movdqu(input, Operand(rsi, rdi, times_1, cp_offset));
+    __ movdqa(lo_nibbles, input);
+    __ pand(lo_nibbles, nibble_mask);
+    // There is no byte-wise shift. The bits shifted in from the neighbouring
+    // byte are cleared by the mask.
+    __ psrlw(input, 4);
+    __ pand(input, nibble_mask);
+    // row[i] = nibble_table[lo(c[i])], bitmask[i] = 1 << (hi(c[i]) & 7).
+    __ movdqa(row, nibble_table_reg);
+    __ pshufb(row, lo_nibbles);
+    const XMMRegister bitmask = lo_nibbles;
+    __ movdqa(bitmask, hi_nibble_lookup_mask);
+    __ pshufb(bitmask, input);
+    __ pand(row, bitmask);
+    __ pcmpeqb(row, bitmask);
+    __ pmovmskb(rax, row);
+    __ testl(rax, rax);
+    __ j(not_zero, &found);
+    AdvanceCurrentPosition(kVectorSize);
+    CheckPosition(cp_offset + kVectorSize - 1, &scalar);
+    __ jmp(&simd_repeat);
+
+    __ bind(&found);
+    __ bsfl(rax, rax);
+    __ addq(rdi, rax);
+    __ jmp(&cont);
+
+    __ bind(&scalar);
+  }
+
+  RegExpMacroAssembler::SkipUntilBitInTable(cp_offset, table, nibble_table,
+                                            advance_by);
+  __ bind(&cont);
+}
+
+bool RegExpMacroAssemblerX64::SkipUntilBitInTableUseSimd(int advance_by) {
+  // The nibble table only covers the 128 entries of the bit table, which is
+  // exact for one-byte subjects only.
+  return v8_flags.regexp_simd && mode_ == LATIN1 &&
+         CpuFeatures::IsSupported(SSSE3);
+}
+
 bool RegExpMacroAssemblerX64::CheckSpecialClassRanges(StandardCharacterSet type,
                                                       Label* on_no_match) {
   // Range checks (c in min..max) are generally implemented by an unsigned
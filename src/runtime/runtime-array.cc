@@ -2,11 +2,18 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+#include "src/debug/debug.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/isolate-inl.h"
 #include "src/execution/protectors-inl.h"
 #include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"  // For ToBoolean. TODO(jkummerow): Drop.
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/elements.h"
 #include "src/objects/js-array-inl.h"
@@ -195,6 +202,116 @@ RUNTIME_FUNCTION(Runtime_GrowArrayElements) {
 }
 
 // ES6 22.1.2.2 Array.isArray
+namespace {
+
+enum class NumericComparator { kNone, kAscending, kDescending };
+
+// Recognizes comparators whose bytecode is exactly that of (a, b) => a - b or
+// (a, b) => b - a. For numbers, these have no side effects and order by value,
+// so sorting with them doesn't need to call them.
+NumericComparator MatchNumericComparator(Isolate* isolate,
+                                         Handle<JSFunction> comparefn) {
+  // Breakpoints and stepping must observe the comparator being called.
+  if (isolate->debug()->is_active()) return NumericComparator::kNone;
+  Tagged<SharedFunctionInfo> shared = comparefn->shared();
+  if (!shared->HasBytecodeArray()) return NumericComparator::kNone;
+  if (shared->internal_formal_parameter_count_without_receiver() != 2) {
+    return NumericComparator::kNone;
+  }
+
+  interpreter::BytecodeArrayIterator it(
+      handle(shared->GetBytecodeArray(isolate), isolate));
+  // Ldar <rhs>; Sub <lhs>, [slot]; Return computes lhs - rhs.
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kLdar) {
+    return NumericComparator::kNone;
+  }
+  interpreter::Register rhs = it.GetRegisterOperand(0);
+  it.Advance();
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kSub) {
+    return NumericComparator::kNone;
+  }
+  interpreter::Register lhs = it.GetRegisterOperand(0);
+  it.Advance();
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kReturn) {
+    return NumericComparator::kNone;
+  }
+  it.Advance();
+  if (!it.done()) return NumericComparator::kNone;
+
+  const interpreter::Register a = interpreter::Register::FromParameterIndex(1);
+  const interpreter::Register b = interpreter::Register::FromParameterIndex(2);
+  if (lhs == a && rhs == b) return NumericComparator::kAscending;
+  if (lhs == b && rhs == a) return NumericComparator::kDescending;
+  return NumericComparator::kNone;
+}
+
+template <typename T>
+void SortNumbers(std::vector<T>* values, NumericComparator comparator) {
+  // The comparator treats -0 and 0 as equal, so keep their relative order as
+  // the stable generic sort would.
+  if (comparator == NumericComparator::kAscending) {
+    std::stable_sort(values->begin(), values->end(), std::less<T>());
+  } else {
+    std::stable_sort(values->begin(), values->end(), std::greater<T>());
+  }
+}
+
+}  // namespace
+
+// Sorts the packed Smi or double elements of {array} without calling
+// {comparefn}, if the latter is a plain numeric comparator. Returns false if
+// the generic sort has to be used instead.
+RUNTIME_FUNCTION(Runtime_ArraySortWithNumericComparator) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  Handle<JSArray> array = args.at<JSArray>(0);
+  Handle<JSFunction> comparefn = args.at<JSFunction>(1);
+  ReadOnlyRoots roots(isolate);
+
+  NumericComparator comparator = MatchNumericComparator(isolate, comparefn);
+  if (comparator == NumericComparator::kNone) return roots.false_value();
+
+  uint32_t length;
+  if (!Object::ToArrayLength(array->length(), &length)) {
+    return roots.false_value();
+  }
+  ElementsKind kind = array->GetElementsKind();
+  if (kind == PACKED_SMI_ELEMENTS) {
+    JSObject::EnsureWritableFastElements(array);
+    DisallowGarbageCollection no_gc;
+    Tagged<FixedArray> elements = FixedArray::cast(array->elements());
+    DCHECK_LE(length, elements->length());
+    std::vector<int> values(length);
+    for (uint32_t i = 0; i < length; i++) {
+      values[i] = Smi::ToInt(elements->get(i));
+    }
+    SortNumbers(&values, comparator);
+    for (uint32_t i = 0; i < length; i++) {
+      elements->set(i, Smi::FromInt(values[i]), SKIP_WRITE_BARRIER);
+    }
+    return roots.true_value();
+  }
+  if (kind == PACKED_DOUBLE_ELEMENTS) {
+    DisallowGarbageCollection no_gc;
+    Tagged<FixedDoubleArray> elements =
+        FixedDoubleArray::cast(array->elements());
+    DCHECK_LE(length, elements->length());
+    std::vector<double> values(length);
+    for (uint32_t i = 0; i < length; i++) {
+      values[i] = elements->get_scalar(i);
+      // NaN - x is NaN and is treated as "equal", which doesn't define a
+      // consistent order.
+      if (std::isnan(values[i])) return roots.false_value();
+    }
+    SortNumbers(&values, comparator);
+    for (uint32_t i = 0; i < length; i++) {
+      elements->set(i, values[i]);
+    }
+    return roots.true_value();
+  }
+  return roots.false_value();
+}
+
 RUNTIME_FUNCTION(Runtime_ArrayIsArray) {
   HandleScope shs(isolate);
   DCHECK_EQ(1, args.length());
@@ -12,6 +12,7 @@
 #include "src/execution/arguments-inl.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate-inl.h"
+#include "src/logging/metrics.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
@@ -371,6 +372,19 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   JavaScriptFrame* top_frame = top_it.frame();
   isolate->set_context(Context::cast(top_frame->context()));
 
+  if (isolate->metrics_recorder()->HasEmbedderRecorder()) {
+    v8::metrics::JavaScriptDeoptimization event;
+    event.script_id = Script::cast(function->shared()->script())->id();
+    event.function_start_position = function->shared()->StartPosition();
+    event.bytecode_offset = deopt_exit_offset.ToInt();
+    event.reason = DeoptimizeReasonToString(deopt_reason);
+    event.lazy = deopt_kind == DeoptimizeKind::kLazy;
+    event.maglev = optimized_code->is_maglevved();
+    isolate->metrics_recorder()->AddMainThreadEvent(
+        event, isolate->GetOrRegisterRecorderContextId(
+                   handle(function->native_context(), isolate)));
+  }
+
   // Lazy deopts don't invalidate the underlying optimized code since the code
   // object itself is still valid (as far as we know); the called function
   // caused the deopt, not the function we're currently looking at.
@@ -2,10 +2,15 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <atomic>
+
+#include "include/v8-platform.h"
 #include "src/base/atomicops.h"
 #include "src/common/message-template.h"
 #include "src/execution/arguments-inl.h"
 #include "src/heap/factory.h"
+#include "src/init/v8.h"
 #include "src/objects/elements.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/objects-inl.h"
@@ -95,6 +100,87 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Sorts equally sized chunks of {data} concurrently. The chunks are merged
+// afterwards by {ParallelSort}.
+template <typename T, typename Compare>
+class SortChunksJob final : public JobTask {
+ public:
+  SortChunksJob(T* data, size_t length, size_t chunk_size, Compare compare)
+      : data_(data),
+        length_(length),
+        chunk_size_(chunk_size),
+        chunk_count_((length + chunk_size - 1) / chunk_size),
+        compare_(compare) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      size_t index = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= chunk_count_) return;
+      size_t start = index * chunk_size_;
+      size_t end = std::min(start + chunk_size_, length_);
+      std::sort(data_ + start, data_ + end, compare_);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next = next_chunk_.load(std::memory_order_relaxed);
+    return chunk_count_ - std::min(next, chunk_count_);
+  }
+
+ private:
+  T* const data_;
+  const size_t length_;
+  const size_t chunk_size_;
+  const size_t chunk_count_;
+  const Compare compare_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+bool ShouldSortInParallel(size_t length) {
+  if (v8_flags.single_threaded) return false;
+  if (v8_flags.typed_array_parallel_sort_threshold == 0) return false;
+  return length >= v8_flags.typed_array_parallel_sort_threshold;
+}
+
+// Sorts one chunk per available thread (the main thread joins the job) and
+// merges the sorted chunks pairwise on the main thread.
+template <typename T, typename Compare>
+void ParallelSort(T* data, size_t length, Compare compare) {
+  size_t thread_count = V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1;
+  if (thread_count == 1) {
+    std::sort(data, data + length, compare);
+    return;
+  }
+  size_t chunk_size = (length + thread_count - 1) / thread_count;
+  V8::GetCurrentPlatform()
+      ->PostJob(TaskPriority::kUserBlocking,
+                std::make_unique<SortChunksJob<T, Compare>>(
+                    data, length, chunk_size, compare))
+      ->Join();
+  for (size_t width = chunk_size; width < length; width *= 2) {
+    for (size_t start = 0; start + width < length; start += 2 * width) {
+      std::inplace_merge(data + start, data + start + width,
+                         data + std::min(start + 2 * width, length), compare);
+    }
+  }
+}
+
+template <typename T, typename Compare>
+void SortTypedArrayElements(T* data, size_t length, Compare compare) {
+  if (COMPRESS_POINTERS_BOOL && alignof(T) > kTaggedSize &&
+      !IsAligned(reinterpret_cast<Address>(data), alignof(T))) {
+    // TODO(ishell, v8:8875): See UnalignedSlot<T> for details.
+    std::sort(UnalignedSlot<T>(data), UnalignedSlot<T>(data + length),
+              compare);
+    return;
+  }
+  if (ShouldSortInParallel(length)) {
+    ParallelSort(data, length, compare);
+    return;
+  }
+  std::sort(data, data + length, compare);
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -145,29 +231,17 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
   DisallowGarbageCollection no_gc;
 
   switch (array->type()) {
-#define TYPED_ARRAY_SORT(Type, type, TYPE, ctype)                          \
-  case kExternal##Type##Array: {                                           \
-    ctype* data = copy_data ? reinterpret_cast<ctype*>(data_copy_ptr)      \
-                            : static_cast<ctype*>(array->DataPtr());       \
-    if (kExternal##Type##Array == kExternalFloat64Array ||                 \
-        kExternal##Type##Array == kExternalFloat32Array) {                 \
-      if (COMPRESS_POINTERS_BOOL && alignof(ctype) > kTaggedSize) {        \
-        /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */     \
-        std::sort(UnalignedSlot<ctype>(data),                              \
-                  UnalignedSlot<ctype>(data + length), CompareNum<ctype>); \
-      } else {                                                             \
-        std::sort(data, data + length, CompareNum<ctype>);                 \
-      }                                                                    \
-    } else {                                                               \
-      if (COMPRESS_POINTERS_BOOL && alignof(ctype) > kTaggedSize) {        \
-        /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */     \
-        std::sort(UnalignedSlot<ctype>(data),                              \
-                  UnalignedSlot<ctype>(data + length));                    \
-      } else {                                                             \
-        std::sort(data, data + length);                                    \
-      }                                                                    \
-    }                                                                      \
-    break;                                                                 \
+#define TYPED_ARRAY_SORT(Type, type, TYPE, ctype)                     \
+  case kExternal##Type##Array: {                                      \
+    ctype* data = copy_data ? reinterpret_cast<ctype*>(data_copy_ptr) \
+                            : static_cast<ctype*>(array->DataPtr());  \
+    if (kExternal##Type##Array == kExternalFloat64Array ||            \
+        kExternal##Type##Array == kExternalFloat32Array) {            \
+      SortTypedArrayElements(data, length, CompareNum<ctype>);        \
+    } else {                                                          \
+      SortTypedArrayElements(data, length, std::less<ctype>());       \
+    }                                                                 \
+    break;                                                            \
   }
 
     TYPED_ARRAYS(TYPED_ARRAY_SORT)
@@ -11,6 +11,7 @@
 #include "src/execution/frames.h"
 #include "src/heap/factory.h"
 #include "src/numbers/conversions.h"
+#include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/strings/unicode-inl.h"
 #include "src/trap-handler/trap-handler.h"
@@ -1340,6 +1341,65 @@ RUNTIME_FUNCTION(Runtime_WasmCastToSpecialPrimitiveArray) {
   return obj;
 }
 
+// Copies {length} bytes between the (array i8) {args[0]}, starting at element
+// {args[1]}, and the byte-sized typed array {args[2]}, starting at element
+// {args[3]}. {args[5]} specifies the direction.
+// Used by WebAssembly.Array.* builtins.
+RUNTIME_FUNCTION(Runtime_WasmArrayCopyTypedArray) {
+  ClearThreadInWasmScope flag_scope(isolate);
+  HandleScope scope(isolate);
+  DCHECK_EQ(6, args.length());
+  Tagged<WasmArray> array = WasmArray::cast(args[0]);
+  double array_index = Object::NumberValue(args[1]);
+  double typed_array_index = Object::NumberValue(args[3]);
+  double length = Object::NumberValue(args[4]);
+  bool to_typed_array = args.smi_value_at(5) != 0;
+
+  if (!IsJSTypedArray(args[2])) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kNotTypedArray));
+  }
+  Tagged<JSTypedArray> typed_array = JSTypedArray::cast(args[2]);
+  if (ElementsKindToByteSize(typed_array->GetElementsKind()) != 1) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kNotTypedArray));
+  }
+  bool out_of_bounds = false;
+  size_t typed_array_length =
+      typed_array->GetLengthOrOutOfBounds(out_of_bounds);
+  if (typed_array->WasDetached() || out_of_bounds) {
+    Handle<String> operation = isolate->factory()->NewStringFromAsciiChecked(
+        to_typed_array ? "WebAssembly.Array.copyToTypedArray"
+                       : "WebAssembly.Array.copyFromTypedArray");
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewTypeError(MessageTemplate::kDetachedOperation, operation));
+  }
+
+  // The indexes are integers, but might be negative or huge.
+  if (array_index < 0 || typed_array_index < 0 || length < 0 ||
+      array_index + length > array->length() ||
+      typed_array_index + length > typed_array_length) {
+    return ThrowWasmError(isolate, MessageTemplate::kWasmTrapArrayOutOfBounds);
+  }
+  size_t size = static_cast<size_t>(length);
+  if (size == 0) return ReadOnlyRoots(isolate).undefined_value();
+
+  uint8_t* array_data = reinterpret_cast<uint8_t*>(
+      array->ElementAddress(static_cast<uint32_t>(array_index)));
+  uint8_t* typed_array_data = static_cast<uint8_t*>(typed_array->DataPtr()) +
+                              static_cast<size_t>(typed_array_index);
+  uint8_t* dst = to_typed_array ? typed_array_data : array_data;
+  uint8_t* src = to_typed_array ? array_data : typed_array_data;
+  if (typed_array->buffer()->is_shared()) {
+    base::Relaxed_Memcpy(reinterpret_cast<base::Atomic8*>(dst),
+                         reinterpret_cast<base::Atomic8*>(src), size);
+  } else {
+    // The array and the typed array's backing store never overlap.
+    MemCopy(dst, src, size);
+  }
+  return ReadOnlyRoots(isolate).undefined_value();
+}
+
 // Returns the new string if the operation succeeds.  Otherwise throws an
 // exception and returns an empty result.
 RUNTIME_FUNCTION(Runtime_WasmStringNewWtf8) {
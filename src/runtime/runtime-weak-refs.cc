@@ -9,6 +9,25 @@
 namespace v8 {
 namespace internal {
 
+// Returns whether the options passed to the FinalizationRegistry constructor
+// ask for batched cleanup.
+RUNTIME_FUNCTION(Runtime_FinalizationRegistryBatchCleanupOption) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  Handle<JSReceiver> options = args.at<JSReceiver>(0);
+  if (!v8_flags.js_finalization_registry_batch_cleanup) {
+    return ReadOnlyRoots(isolate).false_value();
+  }
+
+  Handle<Object> batch;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+      isolate, batch,
+      JSReceiver::GetProperty(
+          isolate, options,
+          isolate->factory()->InternalizeUtf8String("batch")));
+  return isolate->heap()->ToBoolean(Object::BooleanValue(*batch, isolate));
+}
+
 RUNTIME_FUNCTION(Runtime_ShrinkFinalizationRegistryUnregisterTokenMap) {
   HandleScope scope(isolate);
   DCHECK_EQ(1, args.length());
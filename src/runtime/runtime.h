@@ -37,16 +37,17 @@ namespace internal {
 // inline), use the F macro below. To declare the runtime version and the inline
 // version simultaneously, use the I macro below.
 
-#define FOR_EACH_INTRINSIC_ARRAY(F, I) \
-  F(ArrayIncludes_Slow, 3, 1)          \
-  F(ArrayIndexOf, 3, 1)                \
-  F(ArrayIsArray, 1, 1)                \
-  F(ArraySpeciesConstructor, 1, 1)     \
-  F(GrowArrayElements, 2, 1)           \
-  F(IsArray, 1, 1)                     \
-  F(NewArray, -1 /* >= 3 */, 1)        \
-  F(NormalizeElements, 1, 1)           \
-  F(TransitionElementsKind, 2, 1)      \
+#define FOR_EACH_INTRINSIC_ARRAY(F, I)    \
+  F(ArrayIncludes_Slow, 3, 1)             \
+  F(ArrayIndexOf, 3, 1)                   \
+  F(ArrayIsArray, 1, 1)                   \
+  F(ArraySortWithNumericComparator, 2, 1) \
+  F(ArraySpeciesConstructor, 1, 1)        \
+  F(GrowArrayElements, 2, 1)              \
+  F(IsArray, 1, 1)                        \
+  F(NewArray, -1 /* >= 3 */, 1)           \
+  F(NormalizeElements, 1, 1)              \
+  F(TransitionElementsKind, 2, 1)         \
   F(TransitionElementsKindWithKind, 2, 1)
 
 #define FOR_EACH_INTRINSIC_ATOMICS(F, I)               \
@@ -471,6 +472,7 @@ namespace internal {
   F(StringEscapeQuotes, 1, 1)             \
   F(StringGreaterThan, 2, 1)              \
   F(StringGreaterThanOrEqual, 2, 1)       \
+  F(StringIndexOfUnchecked, 3, 1)         \
   F(StringIsWellFormed, 1, 1)             \
   F(StringLastIndexOf, 2, 1)              \
   F(StringLessThan, 2, 1)                 \
@@ -666,6 +668,7 @@ namespace internal {
   F(WasmArrayInitSegment, 6, 1)               \
   F(WasmAllocateSuspender, 0, 1)              \
   F(WasmCastToSpecialPrimitiveArray, 2, 1)    \
+  F(WasmArrayCopyTypedArray, 6, 1)            \
   F(WasmStringNewSegmentWtf8, 4, 1)           \
   F(WasmStringNewWtf8, 5, 1)                  \
   F(WasmStringNewWtf8Array, 4, 1)             \
@@ -721,6 +724,7 @@ namespace internal {
   F(CheckIsOnCentralStack, 0, 1)
 
 #define FOR_EACH_INTRINSIC_WEAKREF(F, I)                             \
+  F(FinalizationRegistryBatchCleanupOption, 1, 1)                    \
   F(JSFinalizationRegistryRegisterWeakCellWithUnregisterToken, 4, 1) \
   F(JSWeakRefAddToKeptObjects, 1, 1)                                 \
   F(ShrinkFinalizationRegistryUnregisterTokenMap, 1, 1)
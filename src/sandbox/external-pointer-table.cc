@@ -4,8 +4,14 @@
 
 #include "src/sandbox/external-pointer-table.h"
 
+#include <memory>
+
+#include "include/v8-platform.h"
+#include "src/base/vector.h"
 #include "src/execution/isolate.h"
+#include "src/flags/flags.h"
 #include "src/heap/read-only-spaces.h"
+#include "src/init/v8.h"
 #include "src/logging/counters.h"
 #include "src/sandbox/external-pointer-table-inl.h"
 
@@ -24,6 +30,58 @@ void ExternalPointerTable::SetUpFromReadOnlyArtifacts(
   }
 }
 
+// Sweeps the segments of a space in parallel. Each task claims the next few
+// segments that have not been swept yet.
+class ExternalPointerTable::SegmentSweepingJob final : public v8::JobTask {
+ public:
+  static constexpr size_t kMinSegmentsPerTask = 4;
+  static constexpr size_t kMaxTasks = 8;
+
+  SegmentSweepingJob(ExternalPointerTable* table, Space* space,
+                     base::Vector<const Segment> segments,
+                     base::Vector<SegmentSweepingResult> results,
+                     uint32_t start_of_evacuation_area)
+      : table_(table),
+        space_(space),
+        segments_(segments),
+        results_(results),
+        start_of_evacuation_area_(start_of_evacuation_area),
+        remaining_segments_(segments.size()) {
+    DCHECK_EQ(segments_.size(), results_.size());
+  }
+
+  void Run(JobDelegate* delegate) override {
+    // Sweeping must not be interrupted as the table would otherwise be left
+    // in an inconsistent state, so don't yield.
+    while (true) {
+      size_t start = next_segment_.fetch_add(kMinSegmentsPerTask,
+                                             std::memory_order_relaxed);
+      if (start >= segments_.size()) return;
+      size_t end = std::min(start + kMinSegmentsPerTask, segments_.size());
+      for (size_t i = start; i < end; i++) {
+        results_[i] = table_->SweepSegment(space_, segments_[i],
+                                           start_of_evacuation_area_);
+      }
+      remaining_segments_.fetch_sub(end - start, std::memory_order_relaxed);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t segments = remaining_segments_.load(std::memory_order_relaxed);
+    return std::min(kMaxTasks,
+                    (segments + kMinSegmentsPerTask - 1) / kMinSegmentsPerTask);
+  }
+
+ private:
+  ExternalPointerTable* const table_;
+  Space* const space_;
+  const base::Vector<const Segment> segments_;
+  const base::Vector<SegmentSweepingResult> results_;
+  const uint32_t start_of_evacuation_area_;
+  std::atomic<size_t> next_segment_{0};
+  std::atomic<size_t> remaining_segments_;
+};
+
 uint32_t ExternalPointerTable::SweepAndCompact(Space* space,
                                                Counters* counters) {
   DCHECK(space->BelongsTo(this));
@@ -71,96 +129,62 @@ uint32_t ExternalPointerTable::SweepAndCompact(Space* space,
         static_cast<int>(outcome));
   }
 
-  // Sweep top to bottom and rebuild the freelist from newly dead and
+  // Sweep every segment and rebuild the freelist from newly dead and
   // previously freed entries while also clearing the marking bit on live
-  // entries and resolving evacuation entries table when compacting the table.
-  // This way, the freelist ends up sorted by index which already makes the
-  // table somewhat self-compacting and is required for the compaction
-  // algorithm so that evacuated entries are evacuated to the start of a space.
-  // This method must run either on the mutator thread or while the mutator is
-  // stopped.
-  uint32_t current_freelist_head = 0;
-  uint32_t current_freelist_length = 0;
-  auto AddToFreelist = [&](uint32_t entry_index) {
-    at(entry_index).MakeFreelistEntry(current_freelist_head);
-    current_freelist_head = entry_index;
-    current_freelist_length++;
-  };
-
+  // entries and resolving evacuation entries when compacting the table.
+  // Segments are swept independently, potentially in parallel, and their
+  // freelists are then linked together so that the freelist ends up sorted by
+  // index. This makes the table somewhat self-compacting and is required for
+  // the compaction algorithm so that evacuated entries are evacuated to the
+  // start of a space. This method must run either on the mutator thread or
+  // while the mutator is stopped.
+  std::vector<Segment> segments_to_sweep;
   std::vector<Segment> segments_to_deallocate;
-  for (auto segment : base::Reversed(space->segments_)) {
+  segments_to_sweep.reserve(space->segments_.size());
+  for (auto segment : space->segments_) {
     // If we evacuated all live entries in this segment then we can skip it
-    // here and directly deallocate it after this loop.
+    // here and directly deallocate it after sweeping.
     if (evacuation_was_successful &&
         segment.first_entry() >= start_of_evacuation_area) {
       segments_to_deallocate.push_back(segment);
       continue;
     }
+    segments_to_sweep.push_back(segment);
+  }
 
-    // Remember the state of the freelist before this segment in case this
-    // segment turns out to be completely empty and we deallocate it.
-    uint32_t previous_freelist_head = current_freelist_head;
-    uint32_t previous_freelist_length = current_freelist_length;
-
-    // Process every entry in this segment, again going top to bottom.
-    for (uint32_t i = segment.last_entry(); i >= segment.first_entry(); i--) {
-      auto payload = at(i).GetRawPayload();
-      if (payload.ContainsEvacuationEntry()) {
-        bool entry_was_resolved = false;
-        // Resolve the evacuation entry: take the pointer to the handle from the
-        // evacuation entry, copy the entry to its new location, and finally
-        // update the handle to point to the new entry.
-        // While we now know that the entry being evacuated is free, we don't
-        // add it to (the start of) the freelist because that would immediately
-        // cause new fragmentation when the next entry is allocated. Instead, we
-        // assume that the segments out of which entries are evacuated will all
-        // be decommitted anyway after this loop, which is usually the case
-        // unless compaction was already aborted during marking.
-        Address handle_location =
-            payload.ExtractEvacuationEntryHandleLocation();
-
-        // The field may have been invalidated in the meantime (for example if
-        // the host object has been in-place converted to a different type of
-        // object). In that case, handle_location is invalid so we can't
-        // evacuate the old entry, but that is also not necessary since it is
-        // guaranteed to be dead.
-        if (!space->FieldWasInvalidated(handle_location)) {
-          entry_was_resolved = TryResolveEvacuationEntryDuringSweeping(
-              i, reinterpret_cast<ExternalPointerHandle*>(handle_location),
-              start_of_evacuation_area);
-        }
-
-        // If the evacuation entry hasn't been resolved (for whatever reason),
-        // we must clear it now as we would otherwise have a stale evacuation
-        // entry that we'd try to process again during the next GC.
-        if (!entry_was_resolved) {
-          AddToFreelist(i);
-        }
-      } else if (!payload.HasMarkBitSet()) {
-        AddToFreelist(i);
-      } else {
-        auto new_payload = payload;
-        new_payload.ClearMarkBit();
-        at(i).SetRawPayload(new_payload);
-      }
-
-      // We must have resolved all evacuation entries. Otherwise, we'll try to
-      // process them again during the next GC, which would cause problems.
-      DCHECK(!at(i).HasEvacuationEntry());
+  std::vector<SegmentSweepingResult> results(segments_to_sweep.size());
+  if (v8_flags.parallel_external_pointer_table_sweeping &&
+      segments_to_sweep.size() >= SegmentSweepingJob::kMinSegmentsPerTask * 2) {
+    V8::GetCurrentPlatform()
+        ->CreateJob(v8::TaskPriority::kUserBlocking,
+                    std::make_unique<SegmentSweepingJob>(
+                        this, space, base::VectorOf(segments_to_sweep),
+                        base::VectorOf(results), start_of_evacuation_area))
+        ->Join();
+  } else {
+    for (size_t i = 0; i < segments_to_sweep.size(); i++) {
+      results[i] =
+          SweepSegment(space, segments_to_sweep[i], start_of_evacuation_area);
     }
+  }
 
+  // Link the freelists of all segments, top to bottom.
+  uint32_t current_freelist_head = 0;
+  uint32_t current_freelist_length = 0;
+  for (size_t i = segments_to_sweep.size(); i-- > 0;) {
+    const SegmentSweepingResult& result = results[i];
     // If a segment is completely empty, free it.
-    uint32_t free_entries = current_freelist_length - previous_freelist_length;
-    bool segment_is_empty = free_entries == kEntriesPerSegment;
-    if (segment_is_empty) {
-      segments_to_deallocate.push_back(segment);
-      // Restore the state of the freelist before this segment.
-      current_freelist_head = previous_freelist_head;
-      current_freelist_length = previous_freelist_length;
+    if (result.freelist_length == kEntriesPerSegment) {
+      segments_to_deallocate.push_back(segments_to_sweep[i]);
+      continue;
     }
+    if (result.freelist_length == 0) continue;
+    at(result.freelist_tail).MakeFreelistEntry(current_freelist_head);
+    current_freelist_head = result.freelist_head;
+    current_freelist_length += result.freelist_length;
   }
 
-  // We cannot deallocate the segments during the above loop, so do it now.
+  // We cannot deallocate the segments while iterating over them, so do it now.
   for (auto segment : segments_to_deallocate) {
     FreeTableSegment(segment);
     space->segments_.erase(segment);
@@ -212,6 +236,68 @@ void ExternalPointerTable::Space::StartCompactingIfNeeded() {
   }
 }
 
+ExternalPointerTable::SegmentSweepingResult ExternalPointerTable::SweepSegment(
+    Space* space, Segment segment, uint32_t start_of_evacuation_area) {
+  SegmentSweepingResult result;
+  auto AddToFreelist = [&](uint32_t entry_index) {
+    at(entry_index).MakeFreelistEntry(result.freelist_head);
+    if (result.freelist_length == 0) result.freelist_tail = entry_index;
+    result.freelist_head = entry_index;
+    result.freelist_length++;
+  };
+
+  // Process every entry in this segment, going top to bottom.
+  for (uint32_t i = segment.last_entry(); i >= segment.first_entry(); i--) {
+    auto payload = at(i).GetRawPayload();
+    if (payload.ContainsEvacuationEntry()) {
+      bool entry_was_resolved = false;
+      // Resolve the evacuation entry: take the pointer to the handle from the
+      // evacuation entry, copy the entry to its new location, and finally
+      // update the handle to point to the new entry.
+      // While we now know that the entry being evacuated is free, we don't
+      // add it to (the start of) the freelist because that would immediately
+      // cause new fragmentation when the next entry is allocated. Instead, we
+      // assume that the segments out of which entries are evacuated will all
+      // be decommitted anyway after sweeping, which is usually the case
+      // unless compaction was already aborted during marking.
+      // Every evacuated entry is referenced by exactly one evacuation entry,
+      // and sweeping its segment (if compaction was aborted) only clears its
+      // marking bit, so this is safe while other segments are being swept.
+      Address handle_location = payload.ExtractEvacuationEntryHandleLocation();
+
+      // The field may have been invalidated in the meantime (for example if
+      // the host object has been in-place converted to a different type of
+      // object). In that case, handle_location is invalid so we can't
+      // evacuate the old entry, but that is also not necessary since it is
+      // guaranteed to be dead.
+      if (!space->FieldWasInvalidated(handle_location)) {
+        entry_was_resolved = TryResolveEvacuationEntryDuringSweeping(
+            i, reinterpret_cast<ExternalPointerHandle*>(handle_location),
+            start_of_evacuation_area);
+      }
+
+      // If the evacuation entry hasn't been resolved (for whatever reason),
+      // we must clear it now as we would otherwise have a stale evacuation
+      // entry that we'd try to process again during the next GC.
+      if (!entry_was_resolved) {
+        AddToFreelist(i);
+      }
+    } else if (!payload.HasMarkBitSet()) {
+      AddToFreelist(i);
+    } else {
+      auto new_payload = payload;
+      new_payload.ClearMarkBit();
+      at(i).SetRawPayload(new_payload);
+    }
+
+    // We must have resolved all evacuation entries. Otherwise, we'll try to
+    // process them again during the next GC, which would cause problems.
+    DCHECK(!at(i).HasEvacuationEntry());
+  }
+
+  return result;
+}
+
 bool ExternalPointerTable::TryResolveEvacuationEntryDuringSweeping(
     uint32_t new_index, ExternalPointerHandle* handle_location,
     uint32_t start_of_evacuation_area) {
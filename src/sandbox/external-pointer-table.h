@@ -237,7 +237,8 @@ static_assert(sizeof(ExternalPointerTableEntry) == 8);
  *    marking bit using an atomic CAS operation.
  *  - When marking is finished, SweepAndCompact() iterates over a Space once
  *    while the mutator is stopped and builds a freelist from all dead entries
- *    while also removing the marking bit from any live entry.
+ *    while also removing the marking bit from any live entry. The segments of
+ *    a space are swept in parallel, after which their freelists are linked.
  *
  * Table compaction:
  * -----------------
@@ -446,6 +447,21 @@ class V8_EXPORT_PRIVATE ExternalPointerTable
       uint32_t index, ExternalPointerHandle* handle_location,
       uint32_t start_of_evacuation_area);
 
+  // The free entries of a swept segment, linked into a freelist sorted by
+  // index. The entry at freelist_tail is the last one on that list.
+  struct SegmentSweepingResult {
+    uint32_t freelist_head = 0;
+    uint32_t freelist_tail = 0;
+    uint32_t freelist_length = 0;
+  };
+
+  // Sweeps a single segment of the given space. Segments are independent of
+  // each other, so this may run on multiple threads at once.
+  SegmentSweepingResult SweepSegment(Space* space, Segment segment,
+                                     uint32_t start_of_evacuation_area);
+
+  class SegmentSweepingJob;
+
 #ifdef DEBUG
   // In debug builds during GC marking, this value is ORed into
   // ExternalPointerHandles whose entries are marked for evacuation. During
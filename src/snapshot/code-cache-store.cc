@@ -0,0 +1,132 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/code-cache-store.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "src/base/platform/platform.h"
+#include "src/flags/flags.h"
+#include "src/objects/string-inl.h"
+#include "src/utils/version.h"
+
+namespace v8 {
+namespace internal {
+
+// static
+CodeCacheStore::Key CodeCacheStore::ComputeKey(
+    Isolate* isolate, Handle<String> source,
+    ScriptOriginOptions origin_options) {
+  source = String::Flatten(isolate, source);
+  LITE_SHA256_CTX context;
+  SHA256_init(&context);
+  const uint32_t configuration[] = {
+      Version::Hash(), FlagList::Hash(),
+      static_cast<uint32_t>(origin_options.Flags())};
+  SHA256_update(&context, configuration, sizeof(configuration));
+  {
+    DisallowGarbageCollection no_gc;
+    String::FlatContent content = source->GetFlatContent(no_gc);
+    // Sources with the same contents but different representations get
+    // different keys; this merely costs a cache miss.
+    const uint8_t is_one_byte = content.IsOneByte();
+    SHA256_update(&context, &is_one_byte, sizeof(is_one_byte));
+    if (is_one_byte) {
+      base::Vector<const uint8_t> chars = content.ToOneByteVector();
+      SHA256_update(&context, chars.begin(), chars.length());
+    } else {
+      base::Vector<const base::uc16> chars = content.ToUC16Vector();
+      SHA256_update(&context, chars.begin(), chars.length() * sizeof(chars[0]));
+    }
+  }
+  Key key;
+  memcpy(key.digest, SHA256_final(&context), kSizeOfSha256Digest);
+  return key;
+}
+
+// static
+std::string CodeCacheStore::PathFor(const Key& key) {
+  uint64_t slot;
+  memcpy(&slot, key.digest, sizeof(slot));
+  slot %= std::max(v8_flags.code_cache_dir_max_entries.value(), 1u);
+  char name[32];
+  base::OS::SNPrintF(name, sizeof(name), "/%08" PRIx64 ".v8cache", slot);
+  return std::string(v8_flags.code_cache_dir) + name;
+}
+
+// static
+std::unique_ptr<CodeCacheStore::Entry> CodeCacheStore::Lookup(
+    Isolate* isolate, Handle<String> source,
+    ScriptOriginOptions origin_options) {
+  DCHECK(IsEnabled());
+  Key key = ComputeKey(isolate, source, origin_options);
+  std::string path = PathFor(key);
+  std::unique_ptr<base::OS::MemoryMappedFile> file(
+      base::OS::MemoryMappedFile::open(
+          path.c_str(), base::OS::MemoryMappedFile::FileMode::kReadOnly));
+  if (!file || file->size() < sizeof(Header)) return nullptr;
+  const Header* header = reinterpret_cast<const Header*>(file->memory());
+  // The slot may hold the entry of another script, or stale data.
+  if (header->magic != kMagic ||
+      memcmp(header->key.digest, key.digest, kSizeOfSha256Digest) != 0 ||
+      header->length != file->size() - sizeof(Header)) {
+    return nullptr;
+  }
+  // Mappings are page aligned, and so is the data following the header.
+  static_assert(sizeof(Header) % kPointerAlignment == 0);
+  const uint8_t* data =
+      reinterpret_cast<const uint8_t*>(file->memory()) + sizeof(Header);
+  int length = static_cast<int>(header->length);
+  return std::make_unique<Entry>(std::move(file), data, length);
+}
+
+// static
+void CodeCacheStore::Store(Isolate* isolate, Handle<String> source,
+                           ScriptOriginOptions origin_options,
+                           Handle<SharedFunctionInfo> toplevel) {
+  DCHECK(IsEnabled());
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      CodeSerializer::Serialize(isolate, toplevel));
+  if (!cached_data) return;
+
+  Header header;
+  header.magic = kMagic;
+  header.length = static_cast<uint32_t>(cached_data->length);
+  header.key = ComputeKey(isolate, source, origin_options);
+  std::string path = PathFor(header.key);
+
+  // Write to a file private to this thread first, then move it into place, so
+  // that readers only ever see complete entries.
+  std::string temp_path = path + "." +
+                          std::to_string(base::OS::GetCurrentProcessId()) +
+                          "." +
+                          std::to_string(base::OS::GetCurrentThreadId()) +
+                          ".tmp";
+  FILE* file = base::OS::FOpen(temp_path.c_str(), "wb");
+  if (file == nullptr) return;
+  bool success =
+      fwrite(&header, sizeof(header), 1, file) == 1 &&
+      fwrite(cached_data->data, cached_data->length, 1, file) == 1;
+  success = (fclose(file) == 0) && success;
+  if (success && rename(temp_path.c_str(), path.c_str()) != 0) {
+    // Renaming onto an existing file fails on some platforms.
+    base::OS::Remove(path.c_str());
+    success = rename(temp_path.c_str(), path.c_str()) == 0;
+  }
+  if (!success) base::OS::Remove(temp_path.c_str());
+}
+
+// static
+void CodeCacheStore::Remove(Isolate* isolate, Handle<String> source,
+                            ScriptOriginOptions origin_options) {
+  DCHECK(IsEnabled());
+  base::OS::Remove(PathFor(ComputeKey(isolate, source, origin_options)).c_str());
+}
+
+}  // namespace internal
+}  // namespace v8
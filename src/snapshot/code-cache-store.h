@@ -0,0 +1,85 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SNAPSHOT_CODE_CACHE_STORE_H_
+#define V8_SNAPSHOT_CODE_CACHE_STORE_H_
+
+#include <memory>
+#include <string>
+
+#include "src/base/platform/platform.h"
+#include "src/flags/flags.h"
+#include "src/handles/handles.h"
+#include "src/snapshot/code-serializer.h"
+#include "src/utils/sha-256.h"
+
+namespace v8 {
+namespace internal {
+
+// A persistent code cache in the directory given by --code-cache-dir, which
+// is consulted and updated automatically when compiling scripts for which the
+// embedder did not provide cached data.
+//
+// Entries are keyed by a SHA-256 digest of the source text, the V8 version
+// and the flag hash. The directory holds at most --code-cache-dir-max-entries
+// files: each key maps to one of that many slots, and storing an entry evicts
+// whatever entry previously occupied its slot. Entries are written to a
+// temporary file first and then renamed, so that concurrent readers in other
+// processes never see partially written data. Reads map the file into memory
+// and deserialize directly out of the mapping.
+class CodeCacheStore final {
+ public:
+  // The cached data of a single entry, backed by a mapping of its file.
+  class Entry final {
+   public:
+    Entry(std::unique_ptr<base::OS::MemoryMappedFile> file, const uint8_t* data,
+          int length)
+        : file_(std::move(file)), data_(data, length) {}
+
+    AlignedCachedData* data() { return &data_; }
+
+   private:
+    std::unique_ptr<base::OS::MemoryMappedFile> file_;
+    AlignedCachedData data_;
+  };
+
+  static bool IsEnabled() { return v8_flags.code_cache_dir != nullptr; }
+
+  // Returns the cached data for |source|, or nullptr if there is none.
+  static std::unique_ptr<Entry> Lookup(Isolate* isolate,
+                                       Handle<String> source,
+                                       ScriptOriginOptions origin_options);
+
+  // Serializes |toplevel| and stores the result for |source|.
+  static void Store(Isolate* isolate, Handle<String> source,
+                    ScriptOriginOptions origin_options,
+                    Handle<SharedFunctionInfo> toplevel);
+
+  // Drops the entry for |source|, e.g. after its data has been rejected.
+  static void Remove(Isolate* isolate, Handle<String> source,
+                     ScriptOriginOptions origin_options);
+
+ private:
+  struct Key {
+    uint8_t digest[kSizeOfSha256Digest];
+  };
+
+  // The header preceding the serialized data in each file.
+  struct Header {
+    uint32_t magic;
+    uint32_t length;
+    Key key;
+  };
+
+  static constexpr uint32_t kMagic = 0xC0DECAC4;
+
+  static Key ComputeKey(Isolate* isolate, Handle<String> source,
+                        ScriptOriginOptions origin_options);
+  static std::string PathFor(const Key& key);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SNAPSHOT_CODE_CACHE_STORE_H_
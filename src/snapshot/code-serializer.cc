@@ -427,6 +427,25 @@ const char* ToString(SerializedCodeSanityCheckResult result) {
       return "read-only snapshot checksum mismatch";
   }
 }
+// Merges a newly deserialized script into |cached_script|, the script with the
+// same source from the Isolate compilation cache, so that the
+// SharedFunctionInfos the cached script already has, together with their
+// bytecode and baseline code, are reused instead of duplicated. The merge runs
+// entirely on the main thread. Returns the top-level SharedFunctionInfo that
+// should be used.
+Handle<SharedFunctionInfo> MergeWithCachedScriptOnMainThread(
+    Isolate* isolate, Handle<Script> cached_script,
+    Handle<SharedFunctionInfo> new_toplevel) {
+  BackgroundMergeTask merge;
+  merge.SetUpOnMainThread(isolate, cached_script);
+  CHECK(merge.HasPendingBackgroundWork());
+  Handle<Script> new_script =
+      handle(Script::cast(new_toplevel->script()), isolate);
+  merge.BeginMergeInBackground(isolate->AsLocalIsolate(), new_script);
+  CHECK(merge.HasPendingForegroundWork());
+  return merge.CompleteMergeInForeground(isolate, new_script);
+}
+
 }  // namespace
 
 MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
@@ -481,13 +500,7 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
   // single-threaded.
   if (Handle<Script> cached_script;
       maybe_cached_script.ToHandle(&cached_script)) {
-    BackgroundMergeTask merge;
-    merge.SetUpOnMainThread(isolate, cached_script);
-    CHECK(merge.HasPendingBackgroundWork());
-    Handle<Script> new_script = handle(Script::cast(result->script()), isolate);
-    merge.BeginMergeInBackground(isolate->AsLocalIsolate(), new_script);
-    CHECK(merge.HasPendingForegroundWork());
-    result = merge.CompleteMergeInForeground(isolate, new_script);
+    result = MergeWithCachedScriptOnMainThread(isolate, cached_script, result);
   }
 
   Tagged<Script> script = Script::cast(result->script());
@@ -555,7 +568,8 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
     Isolate* isolate, OffThreadDeserializeData&& data,
     AlignedCachedData* cached_data, Handle<String> source,
     ScriptOriginOptions origin_options,
-    BackgroundMergeTask* background_merge_task) {
+    BackgroundMergeTask* background_merge_task,
+    MaybeHandle<Script> maybe_cached_script) {
   base::ElapsedTimer timer;
   if (v8_flags.profile_deserialization || v8_flags.log_function_events) {
     timer.Start();
@@ -634,6 +648,16 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
                                      MaybeObjectHandle::Weak(script));
     }
     isolate->heap()->SetRootScriptList(*list);
+
+    // The embedder did not merge in the background, but the Isolate
+    // compilation cache may hold a Script for the same source by now (e.g.
+    // from another context). Merge into it rather than keeping both.
+    if (Handle<Script> cached_script;
+        v8_flags.merge_background_deserialized_script_with_compilation_cache &&
+        maybe_cached_script.ToHandle(&cached_script)) {
+      result =
+          MergeWithCachedScriptOnMainThread(isolate, cached_script, result);
+    }
   }
 
   if (v8_flags.profile_deserialization) {
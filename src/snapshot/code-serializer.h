@@ -93,7 +93,8 @@ class CodeSerializer : public Serializer {
       Isolate* isolate, OffThreadDeserializeData&& data,
       AlignedCachedData* cached_data, Handle<String> source,
       ScriptOriginOptions origin_options,
-      BackgroundMergeTask* background_merge_task = nullptr);
+      BackgroundMergeTask* background_merge_task = nullptr,
+      MaybeHandle<Script> maybe_cached_script = {});
 
   uint32_t source_hash() const { return source_hash_; }
 
@@ -28,7 +28,7 @@ class V8_EXPORT_PRIVATE ContextDeserializer final
   explicit ContextDeserializer(Isolate* isolate, const SnapshotData* data,
                                bool can_rehash)
       : Deserializer(isolate, data->Payload(), data->GetMagicNumber(), false,
-                     can_rehash) {}
+                     can_rehash, data->NumberOfBackRefs()) {}
 
   // Deserialize a single object and the objects reachable from it.
   MaybeHandle<Object> Deserialize(
@@ -245,7 +245,8 @@ Deserializer<IsolateT>::Deserializer(IsolateT* isolate,
                                      base::Vector<const uint8_t> payload,
                                      uint32_t magic_number,
                                      bool deserializing_user_code,
-                                     bool can_rehash)
+                                     bool can_rehash,
+                                     uint32_t expected_back_refs)
     : isolate_(isolate),
       source_(payload),
       magic_number_(magic_number),
@@ -262,6 +263,10 @@ Deserializer<IsolateT>::Deserializer(IsolateT* isolate,
   static_assert(kEmptyBackingStoreRefSentinel == 0);
   backing_stores_.push_back({});
 
+  // Avoid repeatedly regrowing the back reference table while deserializing
+  // large snapshots when the serializer told us how many entries to expect.
+  back_refs_.reserve(expected_back_refs);
+
 #ifdef DEBUG
   num_api_references_ = GetNumApiReferences(isolate);
 #endif  // DEBUG
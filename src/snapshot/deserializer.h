@@ -51,7 +51,7 @@ class Deserializer : public SerializerDeserializer {
   // Create a deserializer from a snapshot byte source.
   Deserializer(IsolateT* isolate, base::Vector<const uint8_t> payload,
                uint32_t magic_number, bool deserializing_user_code,
-               bool can_rehash);
+               bool can_rehash, uint32_t expected_back_refs = 0);
 
   void DeserializeDeferredObjects();
 
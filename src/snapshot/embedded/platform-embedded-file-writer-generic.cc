@@ -7,6 +7,8 @@
 #include <algorithm>
 #include <cinttypes>
 
+#include "src/base/platform/platform.h"
+#include "src/flags/flags.h"
 #include "src/objects/instruction-stream.h"
 
 namespace v8 {
@@ -61,6 +63,12 @@ void PlatformEmbeddedFileWriterGeneric::DeclareSymbolGlobal(const char* name) {
 }
 
 void PlatformEmbeddedFileWriterGeneric::AlignToCodeAlignment() {
+  if (v8_flags.embedded_blob_huge_page_alignment) {
+    // Start the builtins on a huge page boundary so that the kernel can back
+    // them with huge pages. This is a multiple of all alignments below.
+    fprintf(fp_, ".balign %zu\n", base::OS::kHugePageSize);
+    return;
+  }
 #if (V8_OS_ANDROID || V8_OS_LINUX) && \
     (V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64)
   // On these architectures and platforms, we remap the builtins, so need these
@@ -82,6 +90,12 @@ void PlatformEmbeddedFileWriterGeneric::AlignToCodeAlignment() {
 }
 
 void PlatformEmbeddedFileWriterGeneric::AlignToPageSizeIfNeeded() {
+  if (v8_flags.embedded_blob_huge_page_alignment) {
+    // Pad until the next huge page boundary, so that no other code or data
+    // shares the last huge page with the builtins.
+    fprintf(fp_, ".balign %zu\n", base::OS::kHugePageSize);
+    return;
+  }
 #if (V8_OS_ANDROID || V8_OS_LINUX) && \
     (V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64)
   // Since the builtins are remapped, need to pad until the next page boundary.
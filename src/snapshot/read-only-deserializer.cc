@@ -144,7 +144,7 @@ ReadOnlyDeserializer::ReadOnlyDeserializer(Isolate* isolate,
                                            const SnapshotData* data,
                                            bool can_rehash)
     : Deserializer(isolate, data->Payload(), data->GetMagicNumber(), false,
-                   can_rehash) {}
+                   can_rehash, data->NumberOfBackRefs()) {}
 
 void ReadOnlyDeserializer::DeserializeIntoIsolate() {
   base::ElapsedTimer timer;
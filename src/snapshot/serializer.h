@@ -187,6 +187,7 @@ class Serializer : public SerializerDeserializer {
   Serializer& operator=(const Serializer&) = delete;
 
   const std::vector<uint8_t>* Payload() const { return sink_.data(); }
+  int num_back_refs() const { return num_back_refs_; }
 
   bool ReferenceMapContains(Handle<HeapObject> o) {
     return reference_map()->LookupReference(o) != nullptr;
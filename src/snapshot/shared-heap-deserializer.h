@@ -19,7 +19,8 @@ class SharedHeapDeserializer final : public Deserializer<Isolate> {
                                   const SnapshotData* shared_heap_data,
                                   bool can_rehash)
       : Deserializer(isolate, shared_heap_data->Payload(),
-                     shared_heap_data->GetMagicNumber(), false, can_rehash) {}
+                     shared_heap_data->GetMagicNumber(), false, can_rehash,
+                     shared_heap_data->NumberOfBackRefs()) {}
 
   // Depending on runtime flags, deserialize shared heap objects into the
   // Isolate.
@@ -4,7 +4,15 @@
 
 #include "src/snapshot/snapshot-compression.h"
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "include/v8-platform.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/flags/flags.h"
+#include "src/init/v8.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 #include "third_party/zlib/google/compression_utils_portable.h"
@@ -12,12 +20,73 @@
 namespace v8 {
 namespace internal {
 
-uint32_t GetUncompressedSize(const Bytef* compressed_data) {
-  uint32_t size;
-  MemCopy(&size, compressed_data, sizeof(size));
-  return size;
+namespace {
+
+// The compressed snapshot consists of uint32_t-sized header entries followed
+// by the compressed chunks:
+// [0] uncompressed size
+// [1] number of chunks N
+// [2 .. 2 + N) compressed size of each chunk
+// ... N independently compressed raw deflate streams
+// Every chunk but the last covers exactly kChunkSize uncompressed bytes, so
+// the chunks can be inflated independently and in parallel.
+constexpr uint32_t kUncompressedSizeOffset = 0;
+constexpr uint32_t kNumberOfChunksOffset =
+    kUncompressedSizeOffset + kUInt32Size;
+constexpr uint32_t kChunkSizesOffset = kNumberOfChunksOffset + kUInt32Size;
+constexpr uint32_t kChunkSize = 256 * KB;
+
+uint32_t GetHeaderValue(const uint8_t* data, uint32_t offset) {
+  uint32_t value;
+  MemCopy(&value, data + offset, sizeof(value));
+  return value;
+}
+
+void SetHeaderValue(uint8_t* data, uint32_t offset, uint32_t value) {
+  MemCopy(data + offset, &value, sizeof(value));
+}
+
+struct Chunk {
+  const Bytef* input;
+  uLong input_size;
+  Bytef* output;
+  uLongf output_size;
+};
+
+void DecompressChunk(const Chunk& chunk) {
+  uLongf uncompressed_size = chunk.output_size;
+  CHECK_EQ(zlib_internal::UncompressHelper(
+               zlib_internal::ZRAW, chunk.output, &uncompressed_size,
+               chunk.input, chunk.input_size),
+           Z_OK);
+  CHECK_EQ(uncompressed_size, chunk.output_size);
 }
 
+class DecompressChunksJob final : public JobTask {
+ public:
+  explicit DecompressChunksJob(const std::vector<Chunk>* chunks)
+      : chunks_(chunks) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      size_t index = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= chunks_->size()) return;
+      DecompressChunk((*chunks_)[index]);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next = next_chunk_.load(std::memory_order_relaxed);
+    return chunks_->size() - std::min(next, chunks_->size());
+  }
+
+ private:
+  const std::vector<Chunk>* const chunks_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+}  // namespace
+
 SnapshotData SnapshotCompression::Compress(
     const SnapshotData* uncompressed_data) {
   SnapshotData snapshot_data;
@@ -25,40 +94,56 @@ SnapshotData SnapshotCompression::Compress(
   if (v8_flags.profile_deserialization) timer.Start();
 
   static_assert(sizeof(Bytef) == 1, "");
-  const uLongf input_size =
-      static_cast<uLongf>(uncompressed_data->RawData().size());
+  const Bytef* input =
+      reinterpret_cast<const Bytef*>(uncompressed_data->RawData().begin());
   uint32_t payload_length =
       static_cast<uint32_t>(uncompressed_data->RawData().size());
-
-  uLongf compressed_data_size = compressBound(input_size);
+  uint32_t num_chunks =
+      std::max(1u, (payload_length + kChunkSize - 1) / kChunkSize);
+  uint32_t header_size = kChunkSizesOffset + num_chunks * kUInt32Size;
 
   // Allocating >= the final amount we will need.
-  snapshot_data.AllocateData(
-      static_cast<uint32_t>(sizeof(payload_length) + compressed_data_size));
+  size_t allocation_size = header_size;
+  for (uint32_t i = 0; i < num_chunks; i++) {
+    uint32_t chunk_size =
+        std::min(kChunkSize, payload_length - i * kChunkSize);
+    allocation_size += compressBound(chunk_size);
+  }
+  snapshot_data.AllocateData(static_cast<uint32_t>(allocation_size));
 
   uint8_t* compressed_data =
       const_cast<uint8_t*>(snapshot_data.RawData().begin());
   // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually store the uncompressed size.
-  MemCopy(compressed_data, &payload_length, sizeof(payload_length));
-
-  CHECK_EQ(
-      zlib_internal::CompressHelper(
-          zlib_internal::ZRAW, compressed_data + sizeof(payload_length),
-          &compressed_data_size,
-          reinterpret_cast<const Bytef*>(uncompressed_data->RawData().begin()),
-          input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
-      Z_OK);
+  // manually store the uncompressed size and the chunk boundaries.
+  SetHeaderValue(compressed_data, kUncompressedSizeOffset, payload_length);
+  SetHeaderValue(compressed_data, kNumberOfChunksOffset, num_chunks);
+
+  size_t output_offset = header_size;
+  for (uint32_t i = 0; i < num_chunks; i++) {
+    uint32_t chunk_size =
+        std::min(kChunkSize, payload_length - i * kChunkSize);
+    uLongf compressed_chunk_size =
+        static_cast<uLongf>(allocation_size - output_offset);
+    CHECK_EQ(zlib_internal::CompressHelper(
+                 zlib_internal::ZRAW, compressed_data + output_offset,
+                 &compressed_chunk_size, input + i * kChunkSize, chunk_size,
+                 Z_DEFAULT_COMPRESSION, nullptr, nullptr),
+             Z_OK);
+    SetHeaderValue(compressed_data, kChunkSizesOffset + i * kUInt32Size,
+                   static_cast<uint32_t>(compressed_chunk_size));
+    output_offset += compressed_chunk_size;
+  }
 
   // Reallocating to exactly the size we need.
-  snapshot_data.Resize(static_cast<uint32_t>(compressed_data_size) +
-                       sizeof(payload_length));
+  snapshot_data.Resize(static_cast<uint32_t>(output_offset));
   DCHECK_EQ(payload_length,
-            GetUncompressedSize(snapshot_data.RawData().begin()));
+            GetHeaderValue(snapshot_data.RawData().begin(),
+                           kUncompressedSizeOffset));
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Compressing %d bytes took %0.3f ms]\n", payload_length, ms);
+    PrintF("[Compressing %d bytes in %d chunks took %0.3f ms]\n",
+           payload_length, num_chunks, ms);
   }
   return snapshot_data;
 }
@@ -69,29 +154,48 @@ SnapshotData SnapshotCompression::Decompress(
   base::ElapsedTimer timer;
   if (v8_flags.profile_deserialization) timer.Start();
 
-  const Bytef* input_bytef =
-      reinterpret_cast<const Bytef*>(compressed_data.begin());
-
-  // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually retrieve the uncompressed size.
-  uint32_t uncompressed_payload_length = GetUncompressedSize(input_bytef);
-  input_bytef += sizeof(uncompressed_payload_length);
+  const uint8_t* input = compressed_data.begin();
+  uint32_t uncompressed_payload_length =
+      GetHeaderValue(input, kUncompressedSizeOffset);
+  uint32_t num_chunks = GetHeaderValue(input, kNumberOfChunksOffset);
+  CHECK_EQ(num_chunks,
+           std::max(1u, (uncompressed_payload_length + kChunkSize - 1) /
+                            kChunkSize));
+  uint32_t header_size = kChunkSizesOffset + num_chunks * kUInt32Size;
+  CHECK_LE(header_size, compressed_data.size());
 
   snapshot_data.AllocateData(uncompressed_payload_length);
+  Bytef* output = const_cast<Bytef*>(snapshot_data.RawData().begin());
+
+  std::vector<Chunk> chunks;
+  chunks.reserve(num_chunks);
+  size_t input_offset = header_size;
+  for (uint32_t i = 0; i < num_chunks; i++) {
+    uint32_t compressed_chunk_size =
+        GetHeaderValue(input, kChunkSizesOffset + i * kUInt32Size);
+    CHECK_LE(input_offset + compressed_chunk_size, compressed_data.size());
+    uint32_t chunk_size =
+        std::min(kChunkSize, uncompressed_payload_length - i * kChunkSize);
+    chunks.push_back({input + input_offset, compressed_chunk_size,
+                      output + i * kChunkSize, chunk_size});
+    input_offset += compressed_chunk_size;
+  }
 
-  uLongf uncompressed_size = uncompressed_payload_length;
-  CHECK_EQ(zlib_internal::UncompressHelper(
-               zlib_internal::ZRAW,
-               const_cast<Bytef*>(snapshot_data.RawData().begin()),
-               &uncompressed_size, input_bytef,
-               static_cast<uLong>(compressed_data.size() -
-                                  sizeof(uncompressed_payload_length))),
-           Z_OK);
+  if (chunks.size() > 1 && !v8_flags.single_threaded) {
+    // The main thread joins the job, so this makes progress even when no
+    // worker threads are available.
+    V8::GetCurrentPlatform()
+        ->PostJob(TaskPriority::kUserBlocking,
+                    std::make_unique<DecompressChunksJob>(&chunks))
+        ->Join();
+  } else {
+    for (const Chunk& chunk : chunks) DecompressChunk(chunk);
+  }
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Decompressing %d bytes took %0.3f ms]\n",
-           uncompressed_payload_length, ms);
+    PrintF("[Decompressing %d bytes in %d chunks took %0.3f ms]\n",
+           uncompressed_payload_length, num_chunks, ms);
   }
   return snapshot_data;
 }
@@ -36,6 +36,7 @@ SnapshotData::SnapshotData(const Serializer* serializer) {
   // Set header values.
   SetMagicNumber();
   SetHeaderValue(kPayloadLengthOffset, static_cast<int>(payload->size()));
+  SetHeaderValue(kNumberOfBackRefsOffset, serializer->num_back_refs());
 
   // Copy serialized data.
   CopyBytes(data_ + kHeaderSize, payload->data(),
@@ -83,6 +83,12 @@ class V8_EXPORT_PRIVATE SnapshotData : public SerializedData {
     return base::Vector<const uint8_t>(data_, size_);
   }
 
+  // The number of back references the serializer emitted. The deserializer
+  // uses it to size its back reference table up front.
+  uint32_t NumberOfBackRefs() const {
+    return GetHeaderValue(kNumberOfBackRefsOffset);
+  }
+
  protected:
   // Empty constructor used by SnapshotCompression so it can manually allocate
   // memory.
@@ -96,9 +102,12 @@ class V8_EXPORT_PRIVATE SnapshotData : public SerializedData {
   // The data header consists of uint32_t-sized entries:
   // [0] magic number and (internal) external reference count
   // [1] payload length
+  // [2] number of back references
   // ... serialized payload
   static const uint32_t kPayloadLengthOffset = kMagicNumberOffset + kUInt32Size;
-  static const uint32_t kHeaderSize = kPayloadLengthOffset + kUInt32Size;
+  static const uint32_t kNumberOfBackRefsOffset =
+      kPayloadLengthOffset + kUInt32Size;
+  static const uint32_t kHeaderSize = kNumberOfBackRefsOffset + kUInt32Size;
 };
 
 }  // namespace internal
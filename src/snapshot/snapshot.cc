@@ -28,6 +28,11 @@
 #include "src/utils/version.h"
 
 #ifdef V8_SNAPSHOT_COMPRESSION
+#include <map>
+#include <memory>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/snapshot/snapshot-compression.h"
 #endif
 
@@ -130,16 +135,55 @@ class SnapshotImpl : public AllStatic {
   }
 };
 
+#ifdef V8_SNAPSHOT_COMPRESSION
+// Decompressed snapshot data, keyed by the compressed data it was produced
+// from. Only used with --cache-decompressed-snapshot, which requires the
+// snapshot blobs to outlive the process.
+class DecompressedSnapshotCache {
+ public:
+  SnapshotData Get(Isolate* isolate,
+                   base::Vector<const uint8_t> compressed_data) {
+    base::MutexGuard guard(&mutex_);
+    Key key{compressed_data.begin(), compressed_data.size()};
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      auto data = std::make_unique<SnapshotData>(
+          Decompress(isolate, compressed_data));
+      it = entries_.emplace(key, std::move(data)).first;
+    }
+    // The returned data doesn't own the cached buffer.
+    return SnapshotData(it->second->RawData());
+  }
+
+  static SnapshotData Decompress(Isolate* isolate,
+                                 base::Vector<const uint8_t> compressed_data) {
+    TRACE_EVENT0("v8", "V8.SnapshotDecompress");
+    RCS_SCOPE(isolate, RuntimeCallCounterId::kSnapshotDecompress);
+    NestedTimedHistogramScope histogram_timer(
+        isolate->counters()->snapshot_decompress());
+    return SnapshotCompression::Decompress(compressed_data);
+  }
+
+ private:
+  using Key = std::pair<const uint8_t*, size_t>;
+
+  base::Mutex mutex_;
+  std::map<Key, std::unique_ptr<SnapshotData>> entries_;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(DecompressedSnapshotCache,
+                                GetDecompressedSnapshotCache)
+#endif  // V8_SNAPSHOT_COMPRESSION
+
 }  // namespace
 
 SnapshotData MaybeDecompress(Isolate* isolate,
                              base::Vector<const uint8_t> snapshot_data) {
 #ifdef V8_SNAPSHOT_COMPRESSION
-  TRACE_EVENT0("v8", "V8.SnapshotDecompress");
-  RCS_SCOPE(isolate, RuntimeCallCounterId::kSnapshotDecompress);
-  NestedTimedHistogramScope histogram_timer(
-      isolate->counters()->snapshot_decompress());
-  return SnapshotCompression::Decompress(snapshot_data);
+  if (v8_flags.cache_decompressed_snapshot) {
+    return GetDecompressedSnapshotCache()->Get(isolate, snapshot_data);
+  }
+  return DecompressedSnapshotCache::Decompress(isolate, snapshot_data);
 #else
   return SnapshotData(snapshot_data);
 #endif
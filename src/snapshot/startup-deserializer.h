@@ -18,7 +18,8 @@ class StartupDeserializer final : public Deserializer<Isolate> {
                                const SnapshotData* startup_data,
                                bool can_rehash)
       : Deserializer(isolate, startup_data->Payload(),
-                     startup_data->GetMagicNumber(), false, can_rehash) {}
+                     startup_data->GetMagicNumber(), false, can_rehash,
+                     startup_data->NumberOfBackRefs()) {}
 
   // Deserialize the snapshot into an empty heap.
   void DeserializeIntoIsolate();
@@ -9,9 +9,102 @@
 #include "src/common/globals.h"
 #include "src/utils/utils.h"
 
+#ifdef _MSC_VER
+// MSVC doesn't define SSE3. However, it does define AVX, and AVX implies SSE3.
+#ifdef __AVX__
+#ifndef __SSE3__
+#define __SSE3__
+#endif
+#endif
+#endif
+
+#ifdef __SSE3__
+#include <immintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// We use Neon only on 64-bit ARM, where it is guaranteed to be available.
+#define NEON64
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Minimal helpers for processing 16 characters at a time. All comparisons are
+// unsigned and return masks with all bits set in every matching byte.
+#if defined(__SSE3__)
+#define V8_CASE_CONVERSION_SIMD 1
+using Simd128 = __m128i;
+
+inline Simd128 Load(const void* src) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+}
+inline void Store(void* dst, Simd128 v) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+}
+inline Simd128 Splat(uint8_t c) { return _mm_set1_epi8(static_cast<char>(c)); }
+inline Simd128 And(Simd128 a, Simd128 b) { return _mm_and_si128(a, b); }
+inline Simd128 Or(Simd128 a, Simd128 b) { return _mm_or_si128(a, b); }
+inline Simd128 Xor(Simd128 a, Simd128 b) { return _mm_xor_si128(a, b); }
+// Returns {v & ~mask}.
+inline Simd128 AndNot(Simd128 v, Simd128 mask) {
+  return _mm_andnot_si128(mask, v);
+}
+inline Simd128 Equals(Simd128 v, uint8_t c) {
+  return _mm_cmpeq_epi8(v, Splat(c));
+}
+inline Simd128 InRange(Simd128 v, uint8_t lo, uint8_t hi) {
+  // lo <= v <= hi iff v - lo <= hi - lo, in unsigned arithmetic.
+  Simd128 offset = _mm_sub_epi8(v, Splat(lo));
+  return _mm_cmpeq_epi8(_mm_min_epu8(offset, Splat(hi - lo)), offset);
+}
+inline bool AnyHighBit(Simd128 v) { return _mm_movemask_epi8(v) != 0; }
+#elif defined(NEON64)
+#define V8_CASE_CONVERSION_SIMD 1
+using Simd128 = uint8x16_t;
+
+inline Simd128 Load(const void* src) {
+  return vld1q_u8(reinterpret_cast<const uint8_t*>(src));
+}
+inline void Store(void* dst, Simd128 v) {
+  vst1q_u8(reinterpret_cast<uint8_t*>(dst), v);
+}
+inline Simd128 Splat(uint8_t c) { return vdupq_n_u8(c); }
+inline Simd128 And(Simd128 a, Simd128 b) { return vandq_u8(a, b); }
+inline Simd128 Or(Simd128 a, Simd128 b) { return vorrq_u8(a, b); }
+inline Simd128 Xor(Simd128 a, Simd128 b) { return veorq_u8(a, b); }
+// Returns {v & ~mask}.
+inline Simd128 AndNot(Simd128 v, Simd128 mask) { return vbicq_u8(v, mask); }
+inline Simd128 Equals(Simd128 v, uint8_t c) { return vceqq_u8(v, Splat(c)); }
+inline Simd128 InRange(Simd128 v, uint8_t lo, uint8_t hi) {
+  return vandq_u8(vcgeq_u8(v, Splat(lo)), vcleq_u8(v, Splat(hi)));
+}
+inline bool AnyHighBit(Simd128 v) { return vmaxvq_u8(v) >= 0x80; }
+#endif
+
+#ifdef V8_CASE_CONVERSION_SIMD
+// Masks are either all zeros or all ones in every byte.
+inline bool AnySet(Simd128 mask) { return AnyHighBit(mask); }
+#endif
+
+inline uint8_t Latin1ToLower(uint8_t c) {
+  bool is_upper =
+      ('A' <= c && c <= 'Z') || (0xC0 <= c && c <= 0xDE && c != 0xD7);
+  return c | (is_upper << 5);
+}
+
+inline uint8_t Latin1ToUpper(uint8_t c) {
+  DCHECK(c != 0xB5 && c != 0xDF && c != 0xFF);
+  bool is_lower =
+      ('a' <= c && c <= 'z') || (0xE0 <= c && c <= 0xFE && c != 0xF7);
+  return c & ~(is_lower << 5);
+}
+
+}  // namespace
+
 // FastAsciiConvert tries to do character processing on a word_t basis if
 // source and destination strings are properly aligned. Natural alignment of
 // string data depends on kTaggedSize so we define word_t via Tagged_t.
@@ -77,6 +170,19 @@ int FastAsciiConvert(char* dst, const char* src, int length,
 
   // dst is newly allocated and always aligned.
   DCHECK(IsAligned(reinterpret_cast<Address>(dst), sizeof(word_t)));
+#ifdef V8_CASE_CONVERSION_SIMD
+  // Convert 16 characters at a time. This keeps the alignment of src and dst
+  // for the word-at-a-time loops below.
+  while (limit - src >= kSimd128Size) {
+    const Simd128 v = Load(src);
+    if (AnyHighBit(v)) return static_cast<int>(src - saved_src);
+    const Simd128 convert = InRange(v, lo + 1, hi - 1);
+    if (AnySet(convert)) changed = true;
+    Store(dst, Xor(v, And(convert, Splat(1 << 5))));
+    src += kSimd128Size;
+    dst += kSimd128Size;
+  }
+#endif  // V8_CASE_CONVERSION_SIMD
   // Only attempt processing one word at a time if src is also aligned.
   if (IsAligned(reinterpret_cast<Address>(src), sizeof(word_t))) {
     // Process the prefix of the input that requires no conversion one aligned
@@ -132,5 +238,39 @@ template int FastAsciiConvert<false>(char* dst, const char* src, int length,
 template int FastAsciiConvert<true>(char* dst, const char* src, int length,
                                     bool* changed_out);
 
+void FastLatin1ToLower(uint8_t* dst, const uint8_t* src, int length) {
+  int i = 0;
+#ifdef V8_CASE_CONVERSION_SIMD
+  for (; length - i >= kSimd128Size; i += kSimd128Size) {
+    const Simd128 v = Load(src + i);
+    const Simd128 convert = Or(InRange(v, 'A', 'Z'),
+                               AndNot(InRange(v, 0xC0, 0xDE), Equals(v, 0xD7)));
+    Store(dst + i, Or(v, And(convert, Splat(1 << 5))));
+  }
+#endif  // V8_CASE_CONVERSION_SIMD
+  for (; i < length; i++) dst[i] = Latin1ToLower(src[i]);
+}
+
+int FastLatin1ToUpper(uint8_t* dst, const uint8_t* src, int length) {
+  int i = 0;
+#ifdef V8_CASE_CONVERSION_SIMD
+  for (; length - i >= kSimd128Size; i += kSimd128Size) {
+    const Simd128 v = Load(src + i);
+    if (AnySet(Or(Or(Equals(v, 0xB5), Equals(v, 0xDF)), Equals(v, 0xFF)))) {
+      break;
+    }
+    const Simd128 convert = Or(InRange(v, 'a', 'z'),
+                               AndNot(InRange(v, 0xE0, 0xFE), Equals(v, 0xF7)));
+    Store(dst + i, AndNot(v, And(convert, Splat(1 << 5))));
+  }
+#endif  // V8_CASE_CONVERSION_SIMD
+  for (; i < length; i++) {
+    const uint8_t c = src[i];
+    if (c == 0xB5 || c == 0xDF || c == 0xFF) return i;
+    dst[i] = Latin1ToUpper(c);
+  }
+  return length;
+}
+
 }  // namespace internal
 }  // namespace v8
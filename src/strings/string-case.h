@@ -5,12 +5,23 @@
 #ifndef V8_STRINGS_STRING_CASE_H_
 #define V8_STRINGS_STRING_CASE_H_
 
+#include <cstdint>
+
 namespace v8 {
 namespace internal {
 
 template <bool is_lower>
 int FastAsciiConvert(char* dst, const char* src, int length, bool* changed_out);
 
+// Converts Latin-1 characters to lower case, which maps them to Latin-1
+// characters of the same count.
+void FastLatin1ToLower(uint8_t* dst, const uint8_t* src, int length);
+
+// Converts Latin-1 characters to upper case up to the first character whose
+// upper case is not a single Latin-1 character (U+00B5, U+00DF and U+00FF).
+// Returns the number of characters converted.
+int FastLatin1ToUpper(uint8_t* dst, const uint8_t* src, int length);
+
 }  // namespace internal
 }  // namespace v8
 
@@ -10,6 +10,7 @@
 // Comment inserted to prevent header reordering.
 #include <type_traits>
 
+#include "src/base/bits.h"
 #include "src/objects/name-inl.h"
 #include "src/objects/string-inl.h"
 #include "src/strings/char-predicates-inl.h"
@@ -36,6 +37,78 @@ uint32_t StringHasher::GetHashCore(uint32_t running_hash) {
   return running_hash;
 }
 
+#ifdef V8_ENABLE_WIDE_STRING_HASH
+namespace detail {
+
+// Reads four characters as a 64-bit word of zero-extended 16-bit code units,
+// independently of the host's endianness.
+template <typename uchar>
+V8_INLINE uint64_t ReadFourCodeUnits(const uchar* chars) {
+  return static_cast<uint64_t>(chars[0]) |
+         (static_cast<uint64_t>(chars[1]) << 16) |
+         (static_cast<uint64_t>(chars[2]) << 32) |
+         (static_cast<uint64_t>(chars[3]) << 48);
+}
+
+// Multiplies {a} and {b} into a 128-bit product and folds it to 64 bits.
+V8_INLINE uint64_t WideMix(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+  __uint128_t product = static_cast<__uint128_t>(a) * b;
+  return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#else
+  return (a * b) ^ base::bits::UnsignedMulHigh64(a, b);
+#endif
+}
+
+constexpr uint64_t kWideHashSecret[] = {
+    0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull,
+    0x589965cc75374cc3ull};
+
+}  // namespace detail
+
+template <typename uchar>
+uint32_t StringHasher::GetWideHash(const uchar* chars, int length,
+                                   uint64_t seed) {
+  using detail::kWideHashSecret;
+  using detail::ReadFourCodeUnits;
+  using detail::WideMix;
+  DCHECK_GE(length, 8);
+  uint64_t hash = seed ^ WideMix(seed ^ kWideHashSecret[0], kWideHashSecret[1]);
+  const uchar* end = chars + length;
+
+  // Mix 16 characters per iteration on two independent lanes.
+  if (length > 16) {
+    uint64_t other = hash;
+    for (; end - chars > 16; chars += 16) {
+      hash = WideMix(ReadFourCodeUnits(chars) ^ kWideHashSecret[1],
+                     ReadFourCodeUnits(chars + 4) ^ hash);
+      other = WideMix(ReadFourCodeUnits(chars + 8) ^ kWideHashSecret[2],
+                      ReadFourCodeUnits(chars + 12) ^ other);
+    }
+    hash ^= other;
+  }
+  if (end - chars > 8) {
+    hash = WideMix(ReadFourCodeUnits(chars) ^ kWideHashSecret[1],
+                   ReadFourCodeUnits(chars + 4) ^ hash);
+  }
+  // The last 8 characters, which may overlap with characters that have
+  // already been mixed in.
+  uint64_t a = ReadFourCodeUnits(end - 8);
+  uint64_t b = ReadFourCodeUnits(end - 4);
+  hash = WideMix(a ^ kWideHashSecret[1] ^ static_cast<uint64_t>(length),
+                 b ^ hash);
+  hash = WideMix(hash ^ kWideHashSecret[0], hash ^ kWideHashSecret[3]);
+
+  uint32_t running_hash = static_cast<uint32_t>(hash ^ (hash >> 32));
+  int32_t masked_hash =
+      static_cast<int32_t>(running_hash & String::HashBits::kMax);
+  // Ensure that the hash is kZeroHash, if the computed value is 0.
+  int32_t mask = (masked_hash - 1) >> 31;
+  running_hash |= (kZeroHash & mask);
+  return running_hash;
+}
+#endif  // V8_ENABLE_WIDE_STRING_HASH
+
 uint32_t StringHasher::GetTrivialHash(int length) {
   DCHECK_GT(length, String::kMaxHashCalcLength);
   // The hash of a large string is simply computed from the length.
@@ -112,6 +185,12 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
   }
 
   // Non-index hash.
+#ifdef V8_ENABLE_WIDE_STRING_HASH
+  if (length >= kMinWideHashLength) {
+    return String::CreateHashFieldValue(GetWideHash(chars, length, seed),
+                                        String::HashFieldType::kHash);
+  }
+#endif  // V8_ENABLE_WIDE_STRING_HASH
   uint32_t running_hash = static_cast<uint32_t>(seed);
   const uchar* end = &chars[length];
   while (chars != end) {
@@ -39,6 +39,18 @@ class V8_EXPORT_PRIVATE StringHasher final {
   V8_INLINE static uint32_t AddCharacterCore(uint32_t running_hash, uint16_t c);
   V8_INLINE static uint32_t GetHashCore(uint32_t running_hash);
 
+#ifdef V8_ENABLE_WIDE_STRING_HASH
+  // Strings at least this long are hashed with GetWideHash.
+  static const int kMinWideHashLength = 16;
+
+  // A wyhash-style hash, which mixes 8 characters per step with a 64x64 to
+  // 128 bit multiplication. Characters are read as 16-bit code units, so that
+  // one-byte and two-byte strings with the same contents have the same hash.
+  template <typename uchar>
+  V8_INLINE static uint32_t GetWideHash(const uchar* chars, int length,
+                                        uint64_t seed);
+#endif  // V8_ENABLE_WIDE_STRING_HASH
+
   static inline uint32_t GetTrivialHash(int length);
 };
 
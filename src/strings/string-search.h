@@ -5,11 +5,17 @@
 #ifndef V8_STRINGS_STRING_SEARCH_H_
 #define V8_STRINGS_STRING_SEARCH_H_
 
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
 #include "src/base/strings.h"
 #include "src/base/vector.h"
 #include "src/execution/isolate.h"
 #include "src/objects/string.h"
 
+#ifdef V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -228,6 +234,73 @@ inline int FindFirstCharacter(base::Vector<const PatternChar> pattern,
   return -1;
 }
 
+#ifdef V8_HOST_ARCH_X64
+template <typename Char>
+inline __m128i SplatCharacter(Char c) {
+  if constexpr (sizeof(Char) == 1) {
+    return _mm_set1_epi8(static_cast<char>(c));
+  } else {
+    return _mm_set1_epi16(static_cast<int16_t>(c));
+  }
+}
+
+template <typename Char>
+inline __m128i CompareCharacters(__m128i a, __m128i b) {
+  if constexpr (sizeof(Char) == 1) {
+    return _mm_cmpeq_epi8(a, b);
+  } else {
+    return _mm_cmpeq_epi16(a, b);
+  }
+}
+#endif  // V8_HOST_ARCH_X64
+
+// Finds the first position at or after {index} where both the first and the
+// last character of {pattern} occur in {subject}, or returns -1. Comparing
+// two characters filters out many more candidate positions than comparing
+// only the first one. Where SIMD is available, 16 bytes worth of positions
+// are tested at once.
+template <typename PatternChar, typename SubjectChar>
+inline int FindFirstAndLastCharacter(base::Vector<const PatternChar> pattern,
+                                     base::Vector<const SubjectChar> subject,
+                                     int index) {
+  DCHECK_GE(pattern.length(), 2);
+  const int last_offset = pattern.length() - 1;
+  const SubjectChar last_char = static_cast<SubjectChar>(pattern[last_offset]);
+  const int max_n = subject.length() - pattern.length() + 1;
+  int i = index;
+
+#ifdef V8_HOST_ARCH_X64
+  constexpr int kLanes = sizeof(__m128i) / sizeof(SubjectChar);
+  if (max_n - i >= kLanes) {
+    const __m128i first =
+        SplatCharacter(static_cast<SubjectChar>(pattern[0]));
+    const __m128i last = SplatCharacter(last_char);
+    for (; i <= max_n - kLanes; i += kLanes) {
+      const __m128i block_first = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(subject.begin() + i));
+      const __m128i block_last = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(subject.begin() + i + last_offset));
+      uint32_t mask = _mm_movemask_epi8(
+          _mm_and_si128(CompareCharacters<SubjectChar>(block_first, first),
+                        CompareCharacters<SubjectChar>(block_last, last)));
+      // For two-byte characters, both bytes of a matching lane are set.
+      if (sizeof(SubjectChar) == 2) mask &= 0x5555;
+      if (mask != 0) {
+        return i + base::bits::CountTrailingZeros(mask) / sizeof(SubjectChar);
+      }
+    }
+  }
+#endif  // V8_HOST_ARCH_X64
+
+  while (i < max_n) {
+    i = FindFirstCharacter(pattern, subject, i);
+    if (i == -1) return -1;
+    if (subject[i + last_offset] == last_char) return i;
+    i++;
+  }
+  return -1;
+}
+
 //---------------------------------------------------------------------
 // Single Character Pattern Search Strategy
 //---------------------------------------------------------------------
@@ -275,16 +348,17 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   int i = index;
   int n = subject.length() - pattern_length;
   while (i <= n) {
-    i = FindFirstCharacter(pattern, subject, i);
+    i = FindFirstAndLastCharacter(pattern, subject, i);
     if (i == -1) return -1;
     DCHECK_LE(i, n);
-    i++;
-    // Loop extracted to separate function to allow using return to do
-    // a deeper break.
-    if (CharCompare(pattern.begin() + 1, subject.begin() + i,
-                    pattern_length - 1)) {
-      return i - 1;
+    // The first and the last character are known to match. Loop extracted to
+    // separate function to allow using return to do a deeper break.
+    if (pattern_length == 2 ||
+        CharCompare(pattern.begin() + 1, subject.begin() + i + 1,
+                    pattern_length - 2)) {
+      return i;
     }
+    i++;
   }
   return -1;
 }
@@ -505,22 +579,23 @@ int StringSearch<PatternChar, SubjectChar>::InitialSearch(
   // algorithm.
   int badness = -10 - (pattern_length << 2);
 
-  // We know our pattern is at least 2 characters, we cache the first so
-  // the common case of the first character not matching is faster.
+  // We know our pattern is at least 2 characters, we filter on the first and
+  // the last character so the common case of them not matching is faster.
   for (int i = index, n = subject.length() - pattern_length; i <= n; i++) {
     badness++;
     if (badness <= 0) {
-      i = FindFirstCharacter(pattern, subject, i);
+      i = FindFirstAndLastCharacter(pattern, subject, i);
       if (i == -1) return -1;
       DCHECK_LE(i, n);
+      // The first and the last character are known to match.
       int j = 1;
       do {
         if (pattern[j] != subject[i + j]) {
           break;
         }
         j++;
-      } while (j < pattern_length);
-      if (j == pattern_length) {
+      } while (j < pattern_length - 1);
+      if (j == pattern_length - 1) {
         return i;
       }
       badness += j;
@@ -4,6 +4,8 @@
 
 #include "src/strings/unicode-decoder.h"
 
+#include <algorithm>
+
 #include "src/strings/unicode-inl.h"
 #include "src/utils/memcopy.h"
 
@@ -54,6 +56,15 @@ struct DecoderTraits<StrictUtf8Decoder> {
   using DfaDecoder = Utf8DfaDecoder;
 };
 #endif  // V8_ENABLE_WEBASSEMBLY
+
+// Returns the length of the run of ASCII characters starting at {cursor},
+// which must point to an ASCII character.
+inline int AsciiRunLength(const uint8_t* cursor, const uint8_t* end) {
+  DCHECK_LE(*cursor, unibrow::Utf8::kMaxOneByteChar);
+  // NonAsciiStart may stop at the start of the word that contains the first
+  // non-ASCII character, but the first character is ASCII.
+  return std::max(1, NonAsciiStart(cursor, static_cast<int>(end - cursor)));
+}
 }  // namespace
 
 template <class Decoder>
@@ -76,9 +87,11 @@ Utf8DecoderBase<Decoder>::Utf8DecoderBase(base::Vector<const uint8_t> data)
                   state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
       DCHECK(!Traits::IsInvalidSurrogatePair(previous, *cursor));
-      previous = *cursor;
-      utf16_length_++;
-      cursor++;
+      // Skip over the whole run of ASCII characters at once.
+      int ascii_length = AsciiRunLength(cursor, end);
+      cursor += ascii_length;
+      previous = cursor[-1];
+      utf16_length_ += ascii_length;
       continue;
     }
 
@@ -144,8 +157,11 @@ void Utf8DecoderBase<Decoder>::Decode(Char* out,
     if (V8_LIKELY(*cursor <= unibrow::Utf8::kMaxOneByteChar &&
                   state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
-      *(out++) = static_cast<Char>(*cursor);
-      cursor++;
+      // Copy the whole run of ASCII characters at once.
+      int ascii_length = AsciiRunLength(cursor, end);
+      CopyChars(out, cursor, ascii_length);
+      out += ascii_length;
+      cursor += ascii_length;
       continue;
     }
 
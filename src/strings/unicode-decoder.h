@@ -5,9 +5,14 @@
 #ifndef V8_STRINGS_UNICODE_DECODER_H_
 #define V8_STRINGS_UNICODE_DECODER_H_
 
+#include "src/base/bits.h"
 #include "src/base/vector.h"
 #include "src/strings/unicode.h"
 
+#ifdef V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -19,7 +24,22 @@ inline int NonAsciiStart(const uint8_t* chars, int length) {
   const uint8_t* start = chars;
   const uint8_t* limit = chars + length;
 
-  if (static_cast<size_t>(length) >= kIntptrSize) {
+#ifdef V8_HOST_ARCH_X64
+  // Check 16 bytes at a time. The sign bits of the bytes are set exactly for
+  // the non-one-byte characters.
+  static_assert(unibrow::Utf8::kMaxOneByteChar == 0x7F);
+  while (chars + sizeof(__m128i) <= limit) {
+    int mask = _mm_movemask_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars)));
+    if (mask != 0) {
+      return static_cast<int>(chars - start) +
+             base::bits::CountTrailingZeros(static_cast<uint32_t>(mask));
+    }
+    chars += sizeof(__m128i);
+  }
+#endif  // V8_HOST_ARCH_X64
+
+  if (static_cast<size_t>(limit - chars) >= kIntptrSize) {
     // Check unaligned bytes.
     while (!IsAligned(reinterpret_cast<intptr_t>(chars), kIntptrSize)) {
       if (*chars > unibrow::Utf8::kMaxOneByteChar) {
@@ -28,7 +48,7 @@ inline int NonAsciiStart(const uint8_t* chars, int length) {
       ++chars;
     }
     // Check aligned words.
-    DCHECK_EQ(unibrow::Utf8::kMaxOneByteChar, 0x7F);
+    static_assert(unibrow::Utf8::kMaxOneByteChar == 0x7F);
     const uintptr_t non_one_byte_mask = kUintptrAllBitsSet / 0xFF * 0x80;
     while (chars + sizeof(uintptr_t) <= limit) {
       if (*reinterpret_cast<const uintptr_t*>(chars) & non_one_byte_mask) {
@@ -48,6 +68,29 @@ inline int NonAsciiStart(const uint8_t* chars, int length) {
   return static_cast<int>(chars - start);
 }
 
+// Copies the ASCII characters at the start of {chars} to {out}, and returns
+// their number. Used to write out runs of ASCII characters as UTF-8 at once.
+inline int CopyAsciiPrefix(const uint16_t* chars, int length, char* out) {
+  int i = 0;
+#ifdef V8_HOST_ARCH_X64
+  // Convert 8 characters at a time.
+  const __m128i non_ascii_bits = _mm_set1_epi16(static_cast<int16_t>(0xFF80));
+  for (; i + 8 <= length; i += 8) {
+    __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + i));
+    __m128i is_ascii = _mm_cmpeq_epi16(_mm_and_si128(block, non_ascii_bits),
+                                       _mm_setzero_si128());
+    if (_mm_movemask_epi8(is_ascii) != 0xFFFF) break;
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i),
+                     _mm_packus_epi16(block, block));
+  }
+#endif  // V8_HOST_ARCH_X64
+  for (; i < length && chars[i] <= unibrow::Utf8::kMaxOneByteChar; i++) {
+    out[i] = static_cast<char>(chars[i]);
+  }
+  return i;
+}
+
 template <class Decoder>
 class Utf8DecoderBase {
  public:
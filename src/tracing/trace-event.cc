@@ -20,6 +20,16 @@ v8::TracingController* TraceEventHelper::GetTracingController() {
   return v8::internal::V8::GetCurrentPlatform()->GetTracingController();
 }
 
+V8_NOINLINE const uint8_t* GetAndCacheCategoryGroupEnabled(
+    const char* category_group, TRACE_EVENT_API_ATOMIC_WORD* atomic) {
+  const uint8_t* category_group_enabled =
+      TRACE_EVENT_API_GET_CATEGORY_GROUP_ENABLED(category_group);
+  TRACE_EVENT_API_ATOMIC_STORE(
+      *atomic,
+      reinterpret_cast<TRACE_EVENT_API_ATOMIC_WORD>(category_group_enabled));
+  return category_group_enabled;
+}
+
 #ifdef V8_RUNTIME_CALL_STATS
 
 void CallStatsScopedTracer::AddEndTraceEvent() {
@@ -55,9 +55,9 @@ enum CategoryGroupEnabledFlags {
   v8::internal::tracing::TraceID::WithScope(scope, id)
 
 #define INTERNAL_TRACE_EVENT_CATEGORY_GROUP_ENABLED_FOR_RECORDING_MODE() \
-  TRACE_EVENT_API_LOAD_CATEGORY_GROUP_ENABLED() &                        \
-      (kEnabledForRecording_CategoryGroupEnabledFlags |                  \
-       kEnabledForEventCallback_CategoryGroupEnabledFlags)
+  V8_UNLIKELY(TRACE_EVENT_API_LOAD_CATEGORY_GROUP_ENABLED() &            \
+              (kEnabledForRecording_CategoryGroupEnabledFlags |          \
+               kEnabledForEventCallback_CategoryGroupEnabledFlags))
 
 // The following macro has no implementation, but it needs to exist since
 // it gets called from scoped trace events. It cannot call UNIMPLEMENTED()
@@ -154,6 +154,9 @@ enum CategoryGroupEnabledFlags {
 // No barriers are needed, because this code is designed to operate safely
 // even when the unsigned char* points to garbage data (which may be the case
 // on processors without cache coherency).
+// The lookup of the category is done out of line, so that a trace event site
+// only consists of the load of the cached category state and a single check
+// whether it is enabled.
 // TODO(fmeawad): This implementation contradicts that we can have a different
 // configuration for each isolate,
 // https://code.google.com/p/v8/issues/detail?id=4563
@@ -161,12 +164,10 @@ enum CategoryGroupEnabledFlags {
     category_group, atomic, category_group_enabled)                          \
   category_group_enabled =                                                   \
       reinterpret_cast<const uint8_t*>(TRACE_EVENT_API_ATOMIC_LOAD(atomic)); \
-  if (!category_group_enabled) {                                             \
+  if (V8_UNLIKELY(!category_group_enabled)) {                                \
     category_group_enabled =                                                 \
-        TRACE_EVENT_API_GET_CATEGORY_GROUP_ENABLED(category_group);          \
-    TRACE_EVENT_API_ATOMIC_STORE(                                            \
-        atomic, reinterpret_cast<TRACE_EVENT_API_ATOMIC_WORD>(               \
-                    category_group_enabled));                                \
+        v8::internal::tracing::GetAndCacheCategoryGroupEnabled(              \
+            category_group, &(atomic));                                      \
   }
 
 #define INTERNAL_TRACE_EVENT_GET_CATEGORY_INFO(category_group)             \
@@ -314,6 +315,10 @@ class TraceEventHelper {
   V8_EXPORT_PRIVATE static v8::TracingController* GetTracingController();
 };
 
+// Looks up the enabled state of |category_group| and caches it in |atomic|.
+V8_EXPORT_PRIVATE const uint8_t* GetAndCacheCategoryGroupEnabled(
+    const char* category_group, TRACE_EVENT_API_ATOMIC_WORD* atomic);
+
 // TraceID encapsulates an ID that can either be an integer or pointer.
 class TraceID {
  public:
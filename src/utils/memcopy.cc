@@ -4,6 +4,11 @@
 
 #include "src/utils/memcopy.h"
 
+#include <atomic>
+
+#include "include/v8-platform.h"
+#include "src/flags/flags.h"
+#include "src/init/v8.h"
 #include "src/snapshot/embedded/embedded-data-inl.h"
 
 namespace v8 {
@@ -55,5 +60,70 @@ void init_memcopy_functions() {
 #endif
 }
 
+namespace {
+
+// Chunks are large enough that the per-chunk memmove stays well above the
+// non-temporal store threshold of common C libraries.
+constexpr size_t kParallelMemMoveChunkSize = size_t{16} * MB;
+constexpr size_t kMaxParallelMemMoveTasks = 8;
+
+class ParallelMemMoveJob final : public JobTask {
+ public:
+  ParallelMemMoveJob(uint8_t* dest, const uint8_t* src, size_t size)
+      : dest_(dest),
+        src_(src),
+        size_(size),
+        chunk_count_((size + kParallelMemMoveChunkSize - 1) /
+                     kParallelMemMoveChunkSize) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      size_t index = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= chunk_count_) return;
+      size_t start = index * kParallelMemMoveChunkSize;
+      size_t length = std::min(kParallelMemMoveChunkSize, size_ - start);
+      memcpy(dest_ + start, src_ + start, length);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next = next_chunk_.load(std::memory_order_relaxed);
+    return std::min(kMaxParallelMemMoveTasks,
+                    chunk_count_ - std::min(next, chunk_count_));
+  }
+
+ private:
+  uint8_t* const dest_;
+  const uint8_t* const src_;
+  const size_t size_;
+  const size_t chunk_count_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+bool ShouldMemMoveInParallel(const uint8_t* dest, const uint8_t* src,
+                             size_t size) {
+  if (v8_flags.single_threaded) return false;
+  if (v8_flags.typed_array_parallel_copy_threshold == 0) return false;
+  if (size < v8_flags.typed_array_parallel_copy_threshold) return false;
+  if (size < 2 * kParallelMemMoveChunkSize) return false;
+  // Overlapping ranges have to be copied in order.
+  return dest + size <= src || src + size <= dest;
+}
+
+}  // namespace
+
+void ParallelMemMove(void* dest, const void* src, size_t size) {
+  uint8_t* dest_u = static_cast<uint8_t*>(dest);
+  const uint8_t* src_u = static_cast<const uint8_t*>(src);
+  if (!ShouldMemMoveInParallel(dest_u, src_u, size)) {
+    MemMove(dest, src, size);
+    return;
+  }
+  V8::GetCurrentPlatform()
+      ->CreateJob(TaskPriority::kUserBlocking,
+                  std::make_unique<ParallelMemMoveJob>(dest_u, src_u, size))
+      ->Join();
+}
+
 }  // namespace internal
 }  // namespace v8
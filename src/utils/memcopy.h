@@ -396,6 +396,15 @@ void CopyChars(DstType* dst, const SrcType* src, size_t count) {
   }
 }
 
+// Copies |size| bytes like MemMove, but splits copies of at least
+// --typed-array-parallel-copy-threshold bytes between non-overlapping ranges
+// into chunks that are copied concurrently on worker threads. The chunks stay
+// large enough for the C library to use its non-temporal store path. Must not
+// be used on memory that may be accessed concurrently (e.g. SharedArrayBuffer
+// backing stores).
+V8_EXPORT_PRIVATE void ParallelMemMove(void* dest, const void* src,
+                                       size_t size);
+
 }  // namespace internal
 }  // namespace v8
 
@@ -1247,13 +1247,50 @@ class LiftoffCompiler {
 
   void Block(FullDecoder* decoder, Control* block) { PushControl(block); }
 
+  // Spills the locals which are assigned inside the loop starting at the
+  // current pc, and keeps all others in their registers. Returns false if the
+  // loop was not analyzed, in which case nothing was spilled.
+  bool SpillLocalsAssignedInLoop(FullDecoder* decoder) {
+    if (for_debugging_) return false;
+    // The pre-analysis scans the loop body once more. Keep the total number of
+    // scanned bytes within a fixed multiple of the function body size, such
+    // that Liftoff stays linear in the size of its input.
+    if (loop_analysis_budget_ < 0) {
+      loop_analysis_budget_ = v8_flags.liftoff_loop_analysis_budget *
+                              static_cast<int64_t>(decoder->end() -
+                                                   decoder->start());
+    }
+    if (loop_analysis_budget_ == 0) return false;
+    const uint8_t* loop_end = nullptr;
+    BitVector* assigned = FullDecoder::AnalyzeLoopAssignment(
+        decoder, decoder->pc(), __ num_locals(), zone_, nullptr, &loop_end);
+    if (assigned == nullptr) return false;
+    loop_analysis_budget_ = std::max<int64_t>(
+        0, loop_analysis_budget_ - (loop_end - decoder->pc()));
+
+    LiftoffAssembler::CacheState* state = __ cache_state();
+    for (uint32_t i = 0; i < __ num_locals(); ++i) {
+      LiftoffAssembler::VarState* slot = &state->stack_state[i];
+      // Registers used more than once cannot be the target of a merge, and
+      // neither can constants.
+      if (slot->is_reg() && !assigned->Contains(i) &&
+          state->get_use_count(slot->reg()) == 1) {
+        continue;
+      }
+      __ Spill(slot);
+    }
+    return true;
+  }
+
   void Loop(FullDecoder* decoder, Control* loop) {
     // Before entering a loop, spill all locals to the stack, in order to free
     // the cache registers, and to avoid unnecessarily reloading stack values
-    // into registers at branches.
-    // TODO(clemensb): Come up with a better strategy here, involving
-    // pre-analysis of the function.
-    __ SpillLocals();
+    // into registers at branches. With --liftoff-cache-loop-locals, locals
+    // which are only read inside the loop stay in their registers instead.
+    if (!v8_flags.liftoff_cache_loop_locals ||
+        !SpillLocalsAssignedInLoop(decoder)) {
+      __ SpillLocals();
+    }
 
     __ PrepareLoopArgs(loop->start_merge.arity);
 
@@ -7896,6 +7933,29 @@ class LiftoffCompiler {
       if (!CheckSupportedType(decoder, ret, "return")) return;
     }
 
+    if (inlining_enabled(decoder) && v8_flags.wasm_inlining_call_indirect) {
+      // Record the called table entry before doing any checks; the IC ignores
+      // out-of-bounds entries.
+      LiftoffRegister vector = __ GetUnusedRegister(kGpReg, {});
+      __ Fill(vector, liftoff::kFeedbackVectorOffset, kRef);
+      VarState vector_var{kRef, vector, 0};
+      size_t vector_slot = encountered_call_instructions_.size() * 2;
+      encountered_call_instructions_.push_back(
+          FunctionTypeFeedback::kCallIndirect);
+      VarState index_var = __ cache_state()->stack_state.back();
+
+      // CallIndirectIC(vector: FixedArray, index: intptr, tableIndex: intptr,
+      //                entryIndex: uint32)
+      CallBuiltin(Builtin::kCallIndirectIC,
+                  MakeSig::Params(kRef, kIntPtrKind, kIntPtrKind, kI32),
+                  {vector_var,
+                   VarState{kIntPtrKind, static_cast<int>(vector_slot), 0},
+                   VarState{kIntPtrKind, static_cast<int>(imm.table_imm.index),
+                            0},
+                   index_var},
+                  decoder->position());
+    }
+
     Register index = __ PeekToRegister(0, {}).gp();
 
     LiftoffRegList pinned{index};
@@ -8593,13 +8653,18 @@ class LiftoffCompiler {
   // Current number of exception refs on the stack.
   int num_exceptions_ = 0;
 
+  // Remaining number of bytes which loop pre-analysis may scan (see
+  // {SpillLocalsAssignedInLoop}), or -1 if not computed yet.
+  int64_t loop_analysis_budget_ = -1;
+
   // The pc_offset of the last defined safepoint. -1 if no safepoint has been
   // defined yet.
   int last_safepoint_offset_ = -1;
 
-  // Updated during compilation on every "call" or "call_ref" instruction.
+  // Updated during compilation on every "call" or "call_ref" instruction, and
+  // on "call_indirect" with --wasm-inlining-call-indirect.
   // Holds the call target, or {FunctionTypeFeedback::kNonDirectCall} for
-  // "call_ref".
+  // "call_ref" and {FunctionTypeFeedback::kCallIndirect} for "call_indirect".
   // After compilation, this is transferred into {WasmModule::type_feedback}.
   std::vector<uint32_t> encountered_call_instructions_;
 
@@ -8621,7 +8686,8 @@ constexpr WasmOpcode LiftoffCompiler::kNoOutstandingOp;
 // static
 constexpr base::EnumSet<ValueKind> LiftoffCompiler::kUnconditionallySupported;
 
-std::unique_ptr<AssemblerBuffer> NewLiftoffAssemblerBuffer(int func_body_size) {
+std::unique_ptr<AssemblerBuffer> NewLiftoffAssemblerBuffer(
+    int func_body_size, LiftoffCompilationResources* resources) {
   size_t code_size_estimate =
       WasmCodeManager::EstimateLiftoffCodeSize(func_body_size);
   // Allocate the initial buffer a bit bigger to avoid reallocation during code
@@ -8630,11 +8696,49 @@ std::unique_ptr<AssemblerBuffer> NewLiftoffAssemblerBuffer(int func_body_size) {
   // have to grow more often.
   int initial_buffer_size = static_cast<int>(128 + code_size_estimate * 4 / 3);
 
+  if (resources) return resources->GetBuffer(initial_buffer_size);
   return NewAssemblerBuffer(initial_buffer_size);
 }
 
+// Resets a reused zone once everything allocated in it is dead.
+class V8_NODISCARD ZoneResetScope {
+ public:
+  explicit ZoneResetScope(Zone* zone) : zone_(zone) {}
+  ~ZoneResetScope() {
+    if (zone_) zone_->Reset();
+  }
+
+ private:
+  Zone* const zone_;
+};
+
 }  // namespace
 
+LiftoffCompilationResources::LiftoffCompilationResources(
+    AccountingAllocator* allocator)
+    : zone_(allocator, "LiftoffCompilationZone") {}
+
+LiftoffCompilationResources::~LiftoffCompilationResources() = default;
+
+std::unique_ptr<AssemblerBuffer> LiftoffCompilationResources::GetBuffer(
+    int min_size) {
+  for (auto it = recycled_buffers_.begin(); it != recycled_buffers_.end();
+       ++it) {
+    if ((*it)->size() < min_size) continue;
+    std::unique_ptr<AssemblerBuffer> buffer = std::move(*it);
+    recycled_buffers_.erase(it);
+    return buffer;
+  }
+  return NewAssemblerBuffer(min_size);
+}
+
+void LiftoffCompilationResources::RecycleBuffer(
+    std::unique_ptr<AssemblerBuffer> buffer) {
+  if (!buffer || buffer->size() > kMaxRecycledBufferSize) return;
+  if (recycled_buffers_.size() >= kMaxRecycledBuffers) return;
+  recycled_buffers_.emplace_back(std::move(buffer));
+}
+
 WasmCompilationResult ExecuteLiftoffCompilation(
     CompilationEnv* env, const FunctionBody& func_body,
     const LiftoffOptions& compiler_options) {
@@ -8650,7 +8754,13 @@ WasmCompilationResult ExecuteLiftoffCompilation(
                "wasm.CompileBaseline", "funcIndex", compiler_options.func_index,
                "bodySize", func_body_size);
 
-  Zone zone(GetWasmEngine()->allocator(), "LiftoffCompilationZone");
+  LiftoffCompilationResources* resources = compiler_options.resources;
+  base::Optional<Zone> own_zone;
+  Zone& zone = resources ? *resources->zone()
+                         : own_zone.emplace(GetWasmEngine()->allocator(),
+                                            "LiftoffCompilationZone");
+  // Declared before anything that uses the zone, so it is reset last.
+  ZoneResetScope zone_reset_scope(resources ? &zone : nullptr);
   auto call_descriptor = compiler::GetWasmCallDescriptor(&zone, func_body.sig);
 
   std::unique_ptr<DebugSideTableBuilder> debug_sidetable_builder;
@@ -8666,8 +8776,8 @@ WasmCompilationResult ExecuteLiftoffCompilation(
       compiler_options.detected_features ? compiler_options.detected_features
                                          : &unused_detected_features,
       func_body, call_descriptor, env, &zone,
-      NewLiftoffAssemblerBuffer(func_body_size), debug_sidetable_builder.get(),
-      compiler_options);
+      NewLiftoffAssemblerBuffer(func_body_size, resources),
+      debug_sidetable_builder.get(), compiler_options);
   decoder.Decode();
   LiftoffCompiler* compiler = &decoder.interface();
   if (decoder.failed()) compiler->OnFirstError(&decoder);
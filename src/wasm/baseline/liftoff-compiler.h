@@ -5,7 +5,11 @@
 #ifndef V8_WASM_BASELINE_LIFTOFF_COMPILER_H_
 #define V8_WASM_BASELINE_LIFTOFF_COMPILER_H_
 
+#include <memory>
+#include <vector>
+
 #include "src/wasm/function-compiler.h"
+#include "src/zone/zone.h"
 
 namespace v8 {
 namespace internal {
@@ -54,6 +58,37 @@ enum LiftoffBailoutReason : int8_t {
   kNumBailoutReasons
 };
 
+// A zone and assembler buffers which are reused across the Liftoff
+// compilations of one compilation task. For modules with many small functions,
+// setting these up anew for every function is a large part of the compile time.
+class V8_EXPORT_PRIVATE LiftoffCompilationResources {
+ public:
+  explicit LiftoffCompilationResources(AccountingAllocator* allocator);
+  ~LiftoffCompilationResources();
+
+  LiftoffCompilationResources(const LiftoffCompilationResources&) = delete;
+  LiftoffCompilationResources& operator=(const LiftoffCompilationResources&) =
+      delete;
+
+  // Reset at the end of each compilation.
+  Zone* zone() { return &zone_; }
+
+  // Returns an assembler buffer of at least {min_size} bytes, preferably a
+  // recycled one.
+  std::unique_ptr<AssemblerBuffer> GetBuffer(int min_size);
+
+  // Hands back the instruction buffer of a Liftoff compilation result after
+  // its code was copied to the code space.
+  void RecycleBuffer(std::unique_ptr<AssemblerBuffer> buffer);
+
+ private:
+  static constexpr size_t kMaxRecycledBuffers = 16;
+  static constexpr int kMaxRecycledBufferSize = 64 * KB;
+
+  Zone zone_;
+  std::vector<std::unique_ptr<AssemblerBuffer>> recycled_buffers_;
+};
+
 struct LiftoffOptions {
   int func_index = -1;
   ForDebugging for_debugging = kNotForDebugging;
@@ -64,6 +99,7 @@ struct LiftoffOptions {
   int dead_breakpoint = 0;
   int32_t* max_steps = nullptr;
   int32_t* nondeterminism = nullptr;
+  LiftoffCompilationResources* resources = nullptr;
 
   // Check that all non-optional fields have been initialized.
   bool is_initialized() const { return func_index >= 0; }
@@ -84,6 +120,7 @@ struct LiftoffOptions {
   SETTER(dead_breakpoint)
   SETTER(max_steps)
   SETTER(nondeterminism)
+  SETTER(resources)
 
 #undef SETTER
 
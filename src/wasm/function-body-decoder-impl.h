@@ -1601,7 +1601,8 @@ class WasmDecoder : public Decoder {
   static BitVector* AnalyzeLoopAssignment(WasmDecoder* decoder,
                                           const uint8_t* pc,
                                           uint32_t locals_count, Zone* zone,
-                                          bool* loop_is_innermost = nullptr) {
+                                          bool* loop_is_innermost = nullptr,
+                                          const uint8_t** loop_end = nullptr) {
     if (pc >= decoder->end()) return nullptr;
     if (*pc != kExprLoop) return nullptr;
     // The number of locals_count is augmented by 1 so that the 'locals_count'
@@ -1646,6 +1647,7 @@ class WasmDecoder : public Decoder {
       if (depth < 0) break;
       pc += OpcodeLength(decoder, pc);
     }
+    if (loop_end) *loop_end = pc;
     return VALIDATE(decoder->ok()) ? assigned : nullptr;
   }
 
@@ -22,13 +22,14 @@ namespace v8::internal::wasm {
 
 WasmCompilationResult WasmCompilationUnit::ExecuteCompilation(
     CompilationEnv* env, const WireBytesStorage* wire_bytes_storage,
-    Counters* counters, WasmFeatures* detected) {
+    Counters* counters, WasmFeatures* detected,
+    LiftoffCompilationResources* liftoff_resources) {
   WasmCompilationResult result;
   if (func_index_ < static_cast<int>(env->module->num_imported_functions)) {
     result = ExecuteImportWrapperCompilation(env);
   } else {
-    result =
-        ExecuteFunctionCompilation(env, wire_bytes_storage, counters, detected);
+    result = ExecuteFunctionCompilation(env, wire_bytes_storage, counters,
+                                        detected, liftoff_resources);
   }
 
   if (result.succeeded() && counters) {
@@ -58,7 +59,8 @@ WasmCompilationResult WasmCompilationUnit::ExecuteImportWrapperCompilation(
 
 WasmCompilationResult WasmCompilationUnit::ExecuteFunctionCompilation(
     CompilationEnv* env, const WireBytesStorage* wire_bytes_storage,
-    Counters* counters, WasmFeatures* detected) {
+    Counters* counters, WasmFeatures* detected,
+    LiftoffCompilationResources* liftoff_resources) {
   auto* func = &env->module->functions[func_index_];
   base::Vector<const uint8_t> code = wire_bytes_storage->GetCode(func->code);
   wasm::FunctionBody func_body{func->sig, func->code.offset(), code.begin(),
@@ -124,7 +126,8 @@ WasmCompilationResult WasmCompilationUnit::ExecuteFunctionCompilation(
                            .set_func_index(func_index_)
                            .set_for_debugging(for_debugging_)
                            .set_counters(counters)
-                           .set_detected_features(detected);
+                           .set_detected_features(detected)
+                           .set_resources(liftoff_resources);
         // We do not use the debug side table, we only (optionally) pass it to
         // cover different code paths in Liftoff for testing.
         std::unique_ptr<DebugSideTable> unused_debug_sidetable;
@@ -27,6 +27,7 @@ class TurbofanCompilationJob;
 
 namespace wasm {
 
+class LiftoffCompilationResources;
 class NativeModule;
 class WasmCode;
 class WasmEngine;
@@ -94,9 +95,12 @@ class V8_EXPORT_PRIVATE WasmCompilationUnit final {
                    tier_ == ExecutionTier::kLiftoff);
   }
 
-  WasmCompilationResult ExecuteCompilation(CompilationEnv*,
-                                           const WireBytesStorage*, Counters*,
-                                           WasmFeatures* detected);
+  // {liftoff_resources} are optional and reused if this unit is compiled with
+  // Liftoff.
+  WasmCompilationResult ExecuteCompilation(
+      CompilationEnv*, const WireBytesStorage*, Counters*,
+      WasmFeatures* detected,
+      LiftoffCompilationResources* liftoff_resources = nullptr);
 
   ExecutionTier tier() const { return tier_; }
   ForDebugging for_debugging() const { return for_debugging_; }
@@ -107,10 +111,9 @@ class V8_EXPORT_PRIVATE WasmCompilationUnit final {
                                   ExecutionTier);
 
  private:
-  WasmCompilationResult ExecuteFunctionCompilation(CompilationEnv*,
-                                                   const WireBytesStorage*,
-                                                   Counters*,
-                                                   WasmFeatures* detected);
+  WasmCompilationResult ExecuteFunctionCompilation(
+      CompilationEnv*, const WireBytesStorage*, Counters*,
+      WasmFeatures* detected, LiftoffCompilationResources* liftoff_resources);
 
   WasmCompilationResult ExecuteImportWrapperCompilation(CompilationEnv*);
 
@@ -967,15 +967,87 @@ class WasmGraphBuildingInterface {
   void CallIndirect(FullDecoder* decoder, const Value& index,
                     const CallIndirectImmediate& imm, const Value args[],
                     Value returns[]) {
+    const CallSiteFeedback* feedback = nullptr;
+    if (inlining_enabled(decoder) && v8_flags.wasm_inlining_call_indirect &&
+        !type_feedback_.empty()) {
+      feedback = &next_call_feedback();
+    }
+    if (feedback == nullptr || feedback->num_cases() == 0 ||
+        !IsInlineableIndirectCallTarget(decoder, imm,
+                                        feedback->function_index(0))) {
+      DoCall(decoder,
+             CallInfo::CallIndirect(index, imm.table_imm.index,
+                                    imm.sig_imm.index),
+             imm.sig, args, returns);
+      return;
+    }
+
+    // The IC only tracks the dominant target. Check whether the table entry
+    // holds it, and if so, emit a direct call (which may then get inlined).
+    const uint32_t expected_function_index = feedback->function_index(0);
+    if (v8_flags.trace_wasm_inlining) {
+      PrintF(
+          "[function %d: call_indirect #%d: graph support for inlining #%d]\n",
+          func_index_, feedback_instruction_index_ - 1,
+          expected_function_index);
+    }
+    TFNode* success_control;
+    TFNode* failure_control;
+    builder_->CompareToIndirectCallTargetAtIndex(
+        imm.table_imm.index, index.node, expected_function_index,
+        &success_control, &failure_control, true, decoder->position());
+    TFNode* initial_effect = effect();
+
+    builder_->SetControl(success_control);
+    ssa_env_->control = success_control;
+    size_t return_count = imm.sig->return_count();
+    Value* returns_direct = decoder->zone()->AllocateArray<Value>(return_count);
+    Value* returns_indirect =
+        decoder->zone()->AllocateArray<Value>(return_count);
+    for (size_t i = 0; i < return_count; i++) {
+      returns_direct[i].type = returns_indirect[i].type = returns[i].type;
+    }
+    DoCall(decoder,
+           CallInfo::CallDirect(expected_function_index,
+                                feedback->call_count(0)),
+           imm.sig, args, returns_direct);
+    TFNode* direct_control = control();
+    TFNode* direct_effect = effect();
+
+    builder_->SetEffectControl(initial_effect, failure_control);
+    ssa_env_->effect = initial_effect;
+    ssa_env_->control = failure_control;
     DoCall(
         decoder,
         CallInfo::CallIndirect(index, imm.table_imm.index, imm.sig_imm.index),
-        imm.sig, args, returns);
+        imm.sig, args, returns_indirect);
+
+    TFNode* control_args[] = {direct_control, control()};
+    TFNode* merge = builder_->Merge(2, control_args);
+    TFNode* effect_args[] = {direct_effect, effect(), merge};
+    TFNode* effect_phi = builder_->EffectPhi(2, effect_args);
+    ssa_env_->control = merge;
+    ssa_env_->effect = effect_phi;
+    builder_->SetEffectControl(effect_phi, merge);
+    // See {CallRef}: reload the instance cache once after the merge.
+    ReloadInstanceCacheIntoSsa(ssa_env_, decoder->module_);
+
+    for (size_t i = 0; i < return_count; i++) {
+      TFNode* phi_args[] = {returns_direct[i].node, returns_indirect[i].node,
+                            merge};
+      SetAndTypeNode(&returns[i],
+                     builder_->Phi(imm.sig->GetReturn(i), 2, phi_args));
+    }
   }
 
   void ReturnCallIndirect(FullDecoder* decoder, const Value& index,
                           const CallIndirectImmediate& imm,
                           const Value args[]) {
+    if (inlining_enabled(decoder) && v8_flags.wasm_inlining_call_indirect &&
+        !type_feedback_.empty()) {
+      // Only consume the feedback; return calls are not inlined.
+      next_call_feedback();
+    }
     DoReturnCall(
         decoder,
         CallInfo::CallIndirect(index, imm.table_imm.index, imm.sig_imm.index),
@@ -2571,6 +2643,17 @@ class WasmGraphBuildingInterface {
     }
   }
 
+  // Speculating on a call_indirect target only makes sense if the target
+  // passes the signature check, which can be decided statically.
+  static bool IsInlineableIndirectCallTarget(FullDecoder* decoder,
+                                             const CallIndirectImmediate& imm,
+                                             uint32_t function_index) {
+    const WasmModule* module = decoder->module_;
+    uint32_t sig_index = module->functions[function_index].sig_index;
+    return IsSubtypeOf(ValueType::Ref(sig_index),
+                       ValueType::Ref(imm.sig_imm.index), module);
+  }
+
   const CallSiteFeedback& next_call_feedback() {
     DCHECK_LT(feedback_instruction_index_, type_feedback_.size());
     return type_feedback_[feedback_instruction_index_++];
@@ -22,6 +22,7 @@
 #include "src/logging/counters-scopes.h"
 #include "src/logging/metrics.h"
 #include "src/tracing/trace-event.h"
+#include "src/wasm/baseline/liftoff-compiler.h"
 #include "src/wasm/code-space-access.h"
 #include "src/wasm/module-decoder.h"
 #include "src/wasm/pgo.h"
@@ -1204,11 +1205,29 @@ bool CompileLazy(Isolate* isolate,
 
   DCHECK(!native_module->lazy_compile_frozen());
 
+  DebugState is_in_debug_state = native_module->IsInDebugState();
+
+  // Prefer serialized code that was not deserialized yet over compiling the
+  // function again. In debug state, the function needs Liftoff code instead.
+  if (LazilyDeserializedCode* lazy_code =
+          native_module->lazily_deserialized_code();
+      lazy_code && !is_in_debug_state) {
+    WasmCodeRefScope code_ref_scope;
+    if (WasmCode* code = lazy_code->MaterializeFunction(native_module,
+                                                        func_index)) {
+      TRACE_LAZY("Deserialized wasm-function#%d.\n", func_index);
+      if (V8_UNLIKELY(native_module->log_code())) {
+        GetWasmEngine()->LogCode(base::VectorOf(&code, 1));
+        GetWasmEngine()->LogOutstandingCodesForIsolate(isolate);
+      }
+      return true;
+    }
+  }
+
   TRACE_LAZY("Compiling wasm-function#%d.\n", func_index);
 
   CompilationStateImpl* compilation_state =
       Impl(native_module->compilation_state());
-  DebugState is_in_debug_state = native_module->IsInDebugState();
   ExecutionTierPair tiers =
       GetLazyCompilationTiers(native_module, func_index, is_in_debug_state);
 
@@ -1364,6 +1383,13 @@ class FeedbackMaker {
     AddCall(function->function_index(), count);
   }
 
+  // {function_index} was determined by the call_indirect IC; it refers to a
+  // function in this instance.
+  void AddIndirectCallCandidate(int function_index, int count) {
+    if (function_index < num_imported_functions_) return;
+    AddCall(function_index, count);
+  }
+
   void AddCall(int target, int count) {
     // Keep the cache sorted (using insertion-sort), highest count first.
     int insertion_index = 0;
@@ -1433,7 +1459,18 @@ void TransitiveTypeFeedbackProcessor::ProcessFunction(int func_index) {
   FeedbackMaker fm(instance_data_, func_index, feedback->length() / 2);
   for (int i = 0; i < feedback->length(); i += 2) {
     Tagged<Object> value = feedback->get(i);
-    if (IsWasmInternalFunction(value)) {
+    if (call_direct_targets[i / 2] == FunctionTypeFeedback::kCallIndirect) {
+      // See the vector format in {CallIndirectIC}: -1 stands for calls to
+      // other instances or host functions, a count of 0 for uninitialized.
+      int target = Smi::cast(value).value();
+      int count = Smi::cast(feedback->get(i + 1)).value();
+      if (count > 0 && target >= 0) {
+        fm.AddIndirectCallCandidate(target, count);
+      } else if (v8_flags.trace_wasm_inlining) {
+        PrintF("[function %d: call_indirect #%d: no dominant target]\n",
+               func_index, i / 2);
+      }
+    } else if (IsWasmInternalFunction(value)) {
       // Monomorphic.
       int count = Smi::cast(feedback->get(i + 1)).value();
       fm.AddCandidate(value, count);
@@ -1588,6 +1625,8 @@ CompilationExecutionResult ExecuteCompilationUnits(
   }
   TRACE_COMPILE("ExecuteCompilationUnits (task id %d)\n", task_id);
 
+  // Reused by all Liftoff units executed by this task.
+  LiftoffCompilationResources liftoff_resources(GetWasmEngine()->allocator());
   std::vector<WasmCompilationResult> results_to_publish;
   while (true) {
     ExecutionTier current_tier = unit->tier();
@@ -1600,7 +1639,8 @@ CompilationExecutionResult ExecuteCompilationUnits(
       // (asynchronous): Execute the compilation.
       WasmCompilationResult result =
           unit->ExecuteCompilation(&env.value(), wire_bytes.get(), counters,
-                                   &per_function_detected_features);
+                                   &per_function_detected_features,
+                                   &liftoff_resources);
       global_detected_features.Add(per_function_detected_features);
       results_to_publish.emplace_back(std::move(result));
 
@@ -1647,6 +1687,12 @@ CompilationExecutionResult ExecuteCompilationUnits(
         std::vector<std::unique_ptr<WasmCode>> unpublished_code =
             compile_scope.native_module()->AddCompiledCode(
                 base::VectorOf(results_to_publish));
+        // The code was copied to the code space, so the Liftoff instruction
+        // buffers can be used for the next units.
+        for (WasmCompilationResult& result : results_to_publish) {
+          if (result.result_tier != ExecutionTier::kLiftoff) continue;
+          liftoff_resources.RecycleBuffer(std::move(result.instr_buffer));
+        }
         results_to_publish.clear();
         compile_scope.compilation_state()->SchedulePublishCompilationResults(
             std::move(unpublished_code), tier);
@@ -2288,6 +2334,9 @@ class ValidateFunctionsStreamingJob final : public JobTask {
                                  unit.code, enabled_features_);
 
       if (result.failed()) {
+        // With lazy validation, errors are only reported once the invalid
+        // function gets called; just leave it unvalidated and keep going.
+        if (v8_flags.wasm_lazy_validation) continue;
         data_->found_error.store(true, std::memory_order_relaxed);
         break;
       }
@@ -3024,8 +3073,12 @@ bool AsyncStreamingProcessor::ProcessFunctionBody(
   const bool lazy_module = v8_flags.wasm_lazy_compilation;
   CompileStrategy strategy =
       GetCompileStrategy(module, enabled_features, func_index, lazy_module);
+  // With {wasm_lazy_validation}, validation can still happen in the background
+  // while the module is downloading, so that the lazy compilation on first call
+  // does not need to validate the function on the main thread any more.
   bool validate_lazily_compiled_function =
-      !v8_flags.wasm_lazy_validation &&
+      (!v8_flags.wasm_lazy_validation ||
+       v8_flags.wasm_streaming_background_validation) &&
       (strategy == CompileStrategy::kLazy ||
        strategy == CompileStrategy::kLazyBaselineEagerTopTier);
   if (validate_lazily_compiled_function) {
@@ -9,6 +9,7 @@
 #ifndef V8_WASM_MODULE_DECODER_IMPL_H_
 #define V8_WASM_MODULE_DECODER_IMPL_H_
 
+#include "src/base/optional.h"
 #include "src/base/platform/wrappers.h"
 #include "src/logging/counters.h"
 #include "src/strings/unicode.h"
@@ -1689,6 +1690,13 @@ class ModuleDecoderImpl : public Decoder {
                                      kWasmHeaderSize);
     WasmSectionIterator section_iter(&section_iterator_decoder, tracer_);
 
+    // Function bodies are validated in the background once the code section
+    // was decoded, while the main thread continues with the remaining
+    // sections (data, names, other custom sections). For modules without the
+    // code section or in the error case, validation happens (or is skipped)
+    // below.
+    base::Optional<BackgroundFunctionValidation> background_validation;
+
     while (ok()) {
       if (section_iter.section_code() != SectionCode::kUnknownSectionCode) {
         uint32_t offset = static_cast<uint32_t>(section_iter.payload().begin() -
@@ -1696,6 +1704,13 @@ class ModuleDecoderImpl : public Decoder {
         DecodeSection(section_iter.section_code(), section_iter.payload(),
                       offset);
         if (!ok()) break;
+        if (validate_functions &&
+            section_iter.section_code() == kCodeSectionCode &&
+            v8_flags.wasm_background_validation_during_decoding &&
+            module_->num_declared_functions > 0) {
+          background_validation.emplace(module_.get(), enabled_features_,
+                                        wire_bytes);
+        }
       }
       if (!section_iter.more()) break;
       section_iter.advance(true);
@@ -1709,7 +1724,11 @@ class ModuleDecoderImpl : public Decoder {
     }
 
     ModuleResult result = FinishDecoding();
-    if (!result.failed() && validate_functions) {
+    if (!result.failed() && background_validation.has_value()) {
+      if (WasmError validation_error = background_validation->Join()) {
+        result = ModuleResult{validation_error};
+      }
+    } else if (!result.failed() && validate_functions) {
       // Pass nullptr for an "empty" filter function.
       if (WasmError validation_error = ValidateFunctions(
               module_.get(), enabled_features_, wire_bytes, nullptr)) {
@@ -524,6 +524,40 @@ WasmError ValidateFunctions(const WasmModule* module,
   return validation_error;
 }
 
+BackgroundFunctionValidation::BackgroundFunctionValidation(
+    const WasmModule* module, WasmFeatures enabled_features,
+    base::Vector<const uint8_t> wire_bytes)
+    : module_(module),
+      enabled_features_(enabled_features),
+      wire_bytes_(wire_bytes) {
+  DCHECK_EQ(kWasmOrigin, module->origin);
+  if (v8_flags.single_threaded) return;
+  TRACE_EVENT1(TRACE_DISABLED_BY_DEFAULT("v8.wasm.detailed"),
+               "wasm.StartBackgroundFunctionValidation",
+               "num_declared_functions", module->num_declared_functions);
+  job_handle_ = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserVisible,
+      std::make_unique<ValidateFunctionsTask>(wire_bytes, module,
+                                              enabled_features, nullptr,
+                                              &validation_error_));
+}
+
+BackgroundFunctionValidation::~BackgroundFunctionValidation() {
+  // The task accesses the module and the wire bytes; make sure it is done
+  // before they can go away.
+  if (job_handle_ && job_handle_->IsValid()) job_handle_->Cancel();
+}
+
+WasmError BackgroundFunctionValidation::Join() {
+  if (job_handle_) {
+    job_handle_->Join();
+    job_handle_.reset();
+    return std::move(validation_error_);
+  }
+  // In single-threaded mode, validate synchronously now.
+  return ValidateFunctions(module_, enabled_features_, wire_bytes_, nullptr);
+}
+
 WasmError GetWasmErrorWithName(base::Vector<const uint8_t> wire_bytes,
                                int func_index, const WasmModule* module,
                                WasmError error) {
@@ -11,6 +11,7 @@
 
 #include <memory>
 
+#include "include/v8-platform.h"
 #include "src/common/globals.h"
 #include "src/logging/metrics.h"
 #include "src/wasm/function-body-decoder.h"
@@ -156,6 +157,35 @@ WasmError GetWasmErrorWithName(base::Vector<const uint8_t> wire_bytes,
                                int func_index, const WasmModule* module,
                                WasmError error);
 
+// Validates all function bodies of a module on background threads, so that
+// the caller can do other work in the meantime (e.g. decode the sections
+// following the code section). {Join} blocks until all functions have been
+// validated and returns the first validation error (deterministically). If
+// {Join} is not called, the destructor cancels the validation.
+// The {module} and the {wire_bytes} need to outlive this object, and the
+// function bodies need to be decoded completely before construction.
+class V8_EXPORT_PRIVATE BackgroundFunctionValidation {
+ public:
+  BackgroundFunctionValidation(const WasmModule* module,
+                               WasmFeatures enabled_features,
+                               base::Vector<const uint8_t> wire_bytes);
+  ~BackgroundFunctionValidation();
+
+  BackgroundFunctionValidation(const BackgroundFunctionValidation&) = delete;
+  BackgroundFunctionValidation& operator=(const BackgroundFunctionValidation&) =
+      delete;
+
+  WasmError Join();
+
+ private:
+  const WasmModule* const module_;
+  const WasmFeatures enabled_features_;
+  const base::Vector<const uint8_t> wire_bytes_;
+  WasmError validation_error_;
+  // Nullptr in single-threaded mode, where all validation happens in {Join}.
+  std::unique_ptr<JobHandle> job_handle_;
+};
+
 class ModuleDecoderImpl;
 
 class ModuleDecoder {
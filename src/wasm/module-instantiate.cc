@@ -89,6 +89,40 @@ class CompileImportWrapperJob final : public JobTask {
   WasmImportWrapperCache::ModificationScope* const cache_scope_;
 };
 
+// Import wrappers can be shared between NativeModules if they do not depend on
+// the importing module. This excludes asm.js (which needs source positions),
+// signatures referring to module-specific types, and modules with a different
+// set of enabled features than the shared wrapper module.
+bool CanUseSharedImportWrapper(const NativeModule* native_module,
+                               const FunctionSig* sig) {
+  if (!v8_flags.wasm_shared_import_wrapper_cache) return false;
+  if (is_asmjs_module(native_module->module())) return false;
+  if (native_module->enabled_features() != WasmFeatures::FromFlags()) {
+    return false;
+  }
+  for (ValueType type : sig->all()) {
+    if (type.has_index()) return false;
+  }
+  return true;
+}
+
+// Returns the wrapper compiled by {InstanceBuilder::CompileImportWrappers},
+// which is either in the module's own cache or in the shared one.
+WasmCode* GetImportWrapper(Isolate* isolate, NativeModule* native_module,
+                           const FunctionSig* sig, ImportCallKind kind,
+                           uint32_t canonical_type_index, int expected_arity,
+                           Suspend suspend) {
+  if (WasmCode* code = native_module->import_wrapper_cache()->MaybeGet(
+          kind, canonical_type_index, expected_arity, suspend)) {
+    return code;
+  }
+  DCHECK(CanUseSharedImportWrapper(native_module, sig));
+  NativeModule* shared_module =
+      GetWasmEngine()->GetSharedImportWrapperModule(isolate);
+  return shared_module->import_wrapper_cache()->Get(
+      kind, canonical_type_index, expected_arity, suspend);
+}
+
 Handle<Map> CreateStructMap(Isolate* isolate, const WasmModule* module,
                             int struct_index, Handle<Map> opt_rtt_parent,
                             Handle<WasmInstanceObject> instance) {
@@ -1860,8 +1894,9 @@ bool InstanceBuilder::ProcessImportedFunction(
       uint32_t canonical_type_index =
           module_->isorecursive_canonical_type_ids
               [module_->functions[func_index].sig_index];
-      WasmCode* wasm_code = native_module->import_wrapper_cache()->Get(
-          kind, canonical_type_index, expected_arity, resolved.suspend());
+      WasmCode* wasm_code = GetImportWrapper(
+          isolate_, native_module, expected_sig, kind, canonical_type_index,
+          expected_arity, resolved.suspend());
       DCHECK_NOT_NULL(wasm_code);
       if (wasm_code->kind() == WasmCode::kWasmToJsWrapper) {
         // Wasm to JS wrappers are treated specially in the import table.
@@ -2204,6 +2239,10 @@ void InstanceBuilder::CompileImportWrappers(
       trusted_instance_data->module_object()->native_module();
   WasmImportWrapperCache::ModificationScope cache_scope(
       native_module->import_wrapper_cache());
+  // Wrappers which do not depend on this module are looked up in (and compiled
+  // into) the process-wide shared cache instead.
+  NativeModule* shared_module = nullptr;
+  base::Optional<WasmImportWrapperCache::ModificationScope> shared_cache_scope;
 
   // Compilation is done in two steps:
   // 1) Insert nullptr entries in the cache for wrappers that need to be
@@ -2211,6 +2250,7 @@ void InstanceBuilder::CompileImportWrappers(
   // ImportWrapperQueue. This way the cache won't invalidate other iterators
   // when inserting a new WasmCode, since the key will already be there.
   ImportWrapperQueue import_wrapper_queue;
+  ImportWrapperQueue shared_import_wrapper_queue;
   for (int index = 0; index < num_imports; ++index) {
     Handle<Object> value = sanitized_imports_[index].value;
     if (module_->import_table[index].kind != kExternalFunction ||
@@ -2246,10 +2286,21 @@ void InstanceBuilder::CompileImportWrappers(
     }
     WasmImportWrapperCache::CacheKey key(kind, canonical_type_index,
                                          expected_arity, resolved.suspend());
-    if (cache_scope[key] != nullptr) {
+    if (native_module->import_wrapper_cache()->MaybeGet(
+            kind, canonical_type_index, expected_arity, resolved.suspend())) {
       // Cache entry already exists, no need to compile it again.
       continue;
     }
+    if (CanUseSharedImportWrapper(native_module, sig)) {
+      if (!shared_module) {
+        shared_module = GetWasmEngine()->GetSharedImportWrapperModule(isolate_);
+        shared_cache_scope.emplace(shared_module->import_wrapper_cache());
+      }
+      if ((*shared_cache_scope)[key] != nullptr) continue;
+      shared_import_wrapper_queue.insert(key, sig);
+      continue;
+    }
+    if (cache_scope[key] != nullptr) continue;
     import_wrapper_queue.insert(key, sig);
   }
 
@@ -2257,9 +2308,18 @@ void InstanceBuilder::CompileImportWrappers(
       isolate_->counters(), native_module, &import_wrapper_queue, &cache_scope);
   auto compile_job = V8::GetCurrentPlatform()->CreateJob(
       TaskPriority::kUserVisible, std::move(compile_job_task));
+  std::unique_ptr<JobHandle> shared_compile_job;
+  if (shared_module) {
+    shared_compile_job = V8::GetCurrentPlatform()->CreateJob(
+        TaskPriority::kUserVisible,
+        std::make_unique<CompileImportWrapperJob>(
+            isolate_->counters(), shared_module, &shared_import_wrapper_queue,
+            &shared_cache_scope.value()));
+  }
 
-  // Wait for the job to finish, while contributing in this thread.
+  // Wait for the jobs to finish, while contributing in this thread.
   compile_job->Join();
+  if (shared_compile_job) shared_compile_job->Join();
 }
 
 // Process the imports, including functions, tables, globals, and memory, in
@@ -5,7 +5,9 @@
 #include "src/wasm/stacks.h"
 
 #include "src/base/platform/platform.h"
+#include "src/execution/isolate.h"
 #include "src/execution/simulator.h"
+#include "src/logging/counters.h"
 
 namespace v8::internal::wasm {
 
@@ -19,10 +21,7 @@ StackMemory::~StackMemory() {
   if (v8_flags.trace_wasm_stack_switching) {
     PrintF("Delete stack #%d\n", id_);
   }
-  PageAllocator* allocator = GetPlatformPageAllocator();
-  if (owned_ && !allocator->DecommitPages(limit_, size_)) {
-    V8::FatalProcessOutOfMemory(nullptr, "Decommit stack memory");
-  }
+  if (owned_) isolate_->stack_pool().Free(isolate_, limit_, size_);
   // We don't need to handle removing the last stack from the list (next_ ==
   // this). This only happens on isolate tear down, otherwise there is always
   // at least one reachable stack (the active stack).
@@ -45,9 +44,7 @@ StackMemory::StackMemory(Isolate* isolate) : isolate_(isolate), owned_(true) {
   int kJsStackSizeKB = v8_flags.wasm_stack_switching_stack_size;
   size_ = (kJsStackSizeKB + kJSLimitOffsetKB) * KB;
   size_ = RoundUp(size_, allocator->AllocatePageSize());
-  limit_ = static_cast<uint8_t*>(
-      allocator->AllocatePages(nullptr, size_, allocator->AllocatePageSize(),
-                               PageAllocator::kReadWrite));
+  limit_ = isolate->stack_pool().Allocate(isolate, size_);
   if (v8_flags.trace_wasm_stack_switching) {
     PrintF("Allocate stack #%d (limit: %p, base: %p)\n", id_, limit_,
            limit_ + size_);
@@ -60,4 +57,52 @@ StackMemory::StackMemory(Isolate* isolate, uint8_t* limit, size_t size)
   id_ = 0;
 }
 
+StackPool::~StackPool() {
+  PageAllocator* allocator = GetPlatformPageAllocator();
+  for (const Segment& segment : segments_) {
+    FreePages(allocator, segment.limit, segment.size);
+  }
+}
+
+uint8_t* StackPool::Allocate(Isolate* isolate, size_t size) {
+  committed_size_ += size;
+  if (committed_size_ > peak_committed_size_) {
+    peak_committed_size_ = committed_size_;
+    isolate->counters()->wasm_stack_peak_committed_kb()->Set(
+        static_cast<int>(peak_committed_size_ / KB));
+  }
+  for (auto it = segments_.rbegin(); it != segments_.rend(); ++it) {
+    if (it->size != size) continue;
+    uint8_t* limit = it->limit;
+    segments_.erase(std::next(it).base());
+    pooled_size_ -= size;
+    isolate->counters()->wasm_stack_pool_hits()->Increment();
+    return limit;
+  }
+  isolate->counters()->wasm_stack_pool_misses()->Increment();
+  PageAllocator* allocator = GetPlatformPageAllocator();
+  return static_cast<uint8_t*>(
+      allocator->AllocatePages(nullptr, size, allocator->AllocatePageSize(),
+                               PageAllocator::kReadWrite));
+}
+
+void StackPool::Free(Isolate* isolate, uint8_t* limit, size_t size) {
+  DCHECK_GE(committed_size_, size);
+  committed_size_ -= size;
+  PageAllocator* allocator = GetPlatformPageAllocator();
+  size_t max_pool_size =
+      static_cast<size_t>(v8_flags.wasm_stack_pool_size) * KB;
+  if (pooled_size_ + size > max_pool_size) {
+    FreePages(allocator, limit, size);
+    return;
+  }
+  // Keep the mapping, but release the physical pages. They get committed
+  // again on first access once the segment is reused.
+  if (!allocator->DiscardSystemPages(limit, size)) {
+    V8::FatalProcessOutOfMemory(nullptr, "Discard stack memory");
+  }
+  segments_.push_back({limit, size});
+  pooled_size_ += size;
+}
+
 }  // namespace v8::internal::wasm
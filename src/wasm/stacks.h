@@ -9,6 +9,8 @@
 #error This header should only be included if WebAssembly is enabled.
 #endif  // !V8_ENABLE_WEBASSEMBLY
 
+#include <vector>
+
 #include "src/common/globals.h"
 #include "src/utils/allocation.h"
 
@@ -83,6 +85,45 @@ class StackMemory {
   StackMemory* prev_ = this;
 };
 
+// A per-isolate pool of unused stack segments. Suspendable computations are
+// short-lived, and allocating a fresh mapping for each of them (and unmapping
+// it again once the continuation dies) is expensive. Instead, segments of
+// finished stacks are kept here and handed out again for new stacks of the
+// same size. Their pages are discarded when they enter the pool, so pooled
+// stacks only hold address space, and physical memory is committed lazily
+// again once the reused stack grows.
+class StackPool {
+ public:
+  StackPool() = default;
+  StackPool(const StackPool&) = delete;
+  StackPool& operator=(const StackPool&) = delete;
+  ~StackPool();
+
+  // Returns a read-write segment of {size} bytes, reusing a pooled segment of
+  // the same size if one is available.
+  uint8_t* Allocate(Isolate* isolate, size_t size);
+
+  // Returns a segment to the pool, or frees it if the pool is full.
+  void Free(Isolate* isolate, uint8_t* limit, size_t size);
+
+  size_t pooled_size() const { return pooled_size_; }
+  size_t peak_committed_size() const { return peak_committed_size_; }
+
+ private:
+  struct Segment {
+    uint8_t* limit;
+    size_t size;
+  };
+
+  // Segments are reused in LIFO order, so that the most recently used (and
+  // most likely still cached) stack is handed out first.
+  std::vector<Segment> segments_;
+  size_t pooled_size_ = 0;
+  // Size of all stacks that are currently in use.
+  size_t committed_size_ = 0;
+  size_t peak_committed_size_ = 0;
+};
+
 }  // namespace v8::internal::wasm
 
 #endif  // V8_WASM_STACKS_H_
@@ -1774,13 +1774,95 @@ class TurboshaftGraphBuildingInterface {
   void CallIndirect(FullDecoder* decoder, const Value& index,
                     const CallIndirectImmediate& imm, const Value args[],
                     Value returns[]) {
+    if (v8_flags.wasm_inlining_call_indirect) feedback_slot_++;
     auto [target, ref] = BuildIndirectCallTargetAndRef(decoder, index.op, imm);
-    BuildWasmCall(decoder, imm.sig, target, ref, args, returns);
+    InliningTree* tree = nullptr;
+    if (v8_flags.wasm_inlining_call_indirect && inlining_enabled(decoder) &&
+        inlining_decisions_ && inlining_decisions_->feedback_found() &&
+        should_inline(feedback_slot_, std::numeric_limits<int>::max())) {
+      // The call_indirect IC only tracks the dominant target.
+      tree = inlining_decisions_->function_calls()[feedback_slot_][0];
+    }
+    // Calls to a target of an incompatible signature would trap anyway.
+    if (tree == nullptr || !tree->is_inlined() ||
+        !IsSubtypeOf(
+            ValueType::Ref(
+                decoder->module_->functions[tree->function_index()].sig_index),
+            ValueType::Ref(imm.sig_imm.index), decoder->module_)) {
+      BuildWasmCall(decoder, imm.sig, target, ref, args, returns);
+      return;
+    }
+
+    // All instances of a module share its jump table, so both the target and
+    // the instance need to match.
+    uint32_t inlined_index = tree->function_index();
+    V<WordPtr> jump_table_start = LOAD_IMMUTABLE_INSTANCE_FIELD(
+        trusted_instance_data(), JumpTableStart,
+        MemoryRepresentation::PointerSized());
+    V<WordPtr> expected_target = __ WordPtrAdd(
+        jump_table_start,
+        __ IntPtrConstant(JumpTableOffset(decoder->module_, inlined_index)));
+    V<Word32> is_match =
+        __ Word32BitwiseAnd(__ WordPtrEqual(target, expected_target),
+                            __ TaggedEqual(ref, trusted_instance_data()));
+
+    size_t return_count = imm.sig->return_count();
+    uint32_t cached_fields = instance_cache_.num_mutable_fields();
+    BlockPhis merge_phis(decoder->zone_, instance_cache_);
+    InstanceCache::Snapshot saved_cache = instance_cache_.SaveState();
+    std::vector<base::SmallVector<OpIndex, 2>> case_returns(return_count);
+    TSBlock* inline_block = __ NewBlock();
+    TSBlock* no_inline_block = __ NewBlock();
+    TSBlock* merge = __ NewBlock();
+    __ Branch({is_match, BranchHint::kTrue}, inline_block, no_inline_block);
+
+    __ Bind(inline_block);
+    instance_cache_.RestoreFromSnapshot(saved_cache);
+    SmallZoneVector<Value, 4> direct_returns(return_count, decoder->zone_);
+    if (v8_flags.trace_wasm_inlining) {
+      PrintF(
+          "[function %d%s: Speculatively inlining call_indirect #%d to "
+          "function %d]\n",
+          func_index_, mode_ == kRegular ? "" : " (inlined)", feedback_slot_,
+          inlined_index);
+    }
+    InlineWasmCall(decoder, inlined_index, imm.sig, 0, args,
+                   direct_returns.data());
+    // See {CallRef}: the inlined body may unconditionally exit early.
+    if (__ current_block() != nullptr) {
+      for (size_t ret = 0; ret < return_count; ret++) {
+        case_returns[ret].push_back(direct_returns[ret].op);
+      }
+      merge_phis.AddPhiInputs(instance_cache_);
+      __ Goto(merge);
+    }
+
+    __ Bind(no_inline_block);
+    instance_cache_.RestoreFromSnapshot(saved_cache);
+    SmallZoneVector<Value, 4> indirect_returns(return_count, decoder->zone_);
+    BuildWasmCall(decoder, imm.sig, target, ref, args,
+                  indirect_returns.data());
+    for (size_t ret = 0; ret < return_count; ret++) {
+      case_returns[ret].push_back(indirect_returns[ret].op);
+    }
+    merge_phis.AddPhiInputs(instance_cache_);
+    __ Goto(merge);
+
+    __ Bind(merge);
+    for (size_t i = 0; i < return_count; i++) {
+      returns[i].op = __ Phi(base::VectorOf(case_returns[i]),
+                             RepresentationFor(imm.sig->GetReturn(i)));
+    }
+    for (uint32_t i = 0; i < cached_fields; i++) {
+      OpIndex phi = MaybePhi(merge_phis.phi_inputs(i), merge_phis.phi_type(i));
+      instance_cache_.set_mutable_field_value(i, phi);
+    }
   }
 
   void ReturnCallIndirect(FullDecoder* decoder, const Value& index,
                           const CallIndirectImmediate& imm,
                           const Value args[]) {
+    if (v8_flags.wasm_inlining_call_indirect) feedback_slot_++;
     auto [target, ref] = BuildIndirectCallTargetAndRef(decoder, index.op, imm);
     BuildWasmMaybeReturnCall(decoder, imm.sig, target, ref, args);
   }
@@ -0,0 +1,144 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/wasm-code-cache-store.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "src/utils/version.h"
+#include "src/wasm/compilation-environment.h"
+#include "src/wasm/wasm-code-manager.h"
+#include "src/wasm/wasm-serialization.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+namespace {
+
+class StoreOnTierUpCallback : public CompilationEventCallback {
+ public:
+  explicit StoreOnTierUpCallback(std::weak_ptr<NativeModule> native_module)
+      : native_module_(std::move(native_module)) {}
+
+  void call(CompilationEvent event) override {
+    if (event != CompilationEvent::kFinishedCompilationChunk) return;
+    if (std::shared_ptr<NativeModule> native_module = native_module_.lock()) {
+      WasmCodeCacheStore::Store(native_module.get());
+    }
+  }
+
+  ReleaseAfterFinalEvent release_after_final_event() override {
+    return kKeepAfterFinalEvent;
+  }
+
+ private:
+  const std::weak_ptr<NativeModule> native_module_;
+};
+
+}  // namespace
+
+// static
+WasmCodeCacheStore::Key WasmCodeCacheStore::ComputeKey(
+    base::Vector<const uint8_t> wire_bytes) {
+  LITE_SHA256_CTX context;
+  SHA256_init(&context);
+  const uint32_t configuration[] = {Version::Hash(), FlagList::Hash()};
+  SHA256_update(&context, configuration, sizeof(configuration));
+  SHA256_update(&context, wire_bytes.begin(), wire_bytes.size());
+  Key key;
+  memcpy(key.digest, SHA256_final(&context), kSizeOfSha256Digest);
+  return key;
+}
+
+// static
+std::string WasmCodeCacheStore::PathFor(const Key& key) {
+  uint64_t slot;
+  memcpy(&slot, key.digest, sizeof(slot));
+  slot %= std::max(v8_flags.wasm_code_cache_dir_max_entries.value(), 1u);
+  char name[32];
+  base::OS::SNPrintF(name, sizeof(name), "/%08" PRIx64 ".v8wasm", slot);
+  return std::string(v8_flags.wasm_code_cache_dir) + name;
+}
+
+// static
+std::unique_ptr<WasmCodeCacheStore::Entry> WasmCodeCacheStore::Lookup(
+    base::Vector<const uint8_t> wire_bytes) {
+  DCHECK(IsEnabled());
+  Key key = ComputeKey(wire_bytes);
+  std::string path = PathFor(key);
+  std::unique_ptr<base::OS::MemoryMappedFile> file(
+      base::OS::MemoryMappedFile::open(
+          path.c_str(), base::OS::MemoryMappedFile::FileMode::kReadOnly));
+  if (!file || file->size() < sizeof(Header)) return nullptr;
+  const Header* header = reinterpret_cast<const Header*>(file->memory());
+  // The slot may hold the entry of another module, or stale data.
+  if (header->magic != kMagic ||
+      memcmp(header->key.digest, key.digest, kSizeOfSha256Digest) != 0 ||
+      header->length != file->size() - sizeof(Header)) {
+    return nullptr;
+  }
+  base::Vector<const uint8_t> data{
+      reinterpret_cast<const uint8_t*>(file->memory()) + sizeof(Header),
+      header->length};
+  return std::make_unique<Entry>(std::move(file), data);
+}
+
+// static
+void WasmCodeCacheStore::Store(NativeModule* native_module) {
+  DCHECK(IsEnabled());
+  WasmSerializer serializer(native_module);
+  size_t size = serializer.GetSerializedNativeModuleSize();
+  if (size > std::numeric_limits<uint32_t>::max()) return;
+  auto buffer = base::OwnedVector<uint8_t>::NewForOverwrite(size);
+  if (!serializer.SerializeNativeModule(buffer.as_vector())) return;
+
+  Header header;
+  header.magic = kMagic;
+  header.length = static_cast<uint32_t>(size);
+  header.key = ComputeKey(native_module->wire_bytes());
+  std::string path = PathFor(header.key);
+
+  // Write to a file private to this thread first, then move it into place, so
+  // that readers only ever see complete entries.
+  std::string temp_path = path + "." +
+                          std::to_string(base::OS::GetCurrentProcessId()) +
+                          "." +
+                          std::to_string(base::OS::GetCurrentThreadId()) +
+                          ".tmp";
+  FILE* file = base::OS::FOpen(temp_path.c_str(), "wb");
+  if (file == nullptr) return;
+  bool success = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                 fwrite(buffer.begin(), size, 1, file) == 1;
+  success = (fclose(file) == 0) && success;
+  if (success && rename(temp_path.c_str(), path.c_str()) != 0) {
+    // Renaming onto an existing file fails on some platforms.
+    base::OS::Remove(path.c_str());
+    success = rename(temp_path.c_str(), path.c_str()) == 0;
+  }
+  if (!success) base::OS::Remove(temp_path.c_str());
+}
+
+// static
+void WasmCodeCacheStore::StoreOnTierUp(
+    std::shared_ptr<NativeModule> native_module) {
+  DCHECK(IsEnabled());
+  CompilationState* compilation_state = native_module->compilation_state();
+  compilation_state->AddCallback(
+      std::make_unique<StoreOnTierUpCallback>(std::move(native_module)));
+}
+
+// static
+void WasmCodeCacheStore::Remove(base::Vector<const uint8_t> wire_bytes) {
+  DCHECK(IsEnabled());
+  base::OS::Remove(PathFor(ComputeKey(wire_bytes)).c_str());
+}
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,91 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+#ifndef V8_WASM_WASM_CODE_CACHE_STORE_H_
+#define V8_WASM_WASM_CODE_CACHE_STORE_H_
+
+#include <memory>
+#include <string>
+
+#include "src/base/platform/platform.h"
+#include "src/base/vector.h"
+#include "src/flags/flags.h"
+#include "src/utils/sha-256.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+class NativeModule;
+
+// A persistent cache of serialized {NativeModule}s in the directory given by
+// --wasm-code-cache-dir, shared by all processes using that directory. It is
+// consulted by synchronous compilation before compiling a module, and updated
+// whenever more of a module's functions have been tiered up to TurboFan.
+//
+// Entries are keyed by a SHA-256 digest of the wire bytes, the V8 version and
+// the flag hash. Like the script {CodeCacheStore}, the directory holds at most
+// --wasm-code-cache-dir-max-entries files, entries are written to a temporary
+// file and then renamed into place, and reads deserialize directly out of a
+// read-only mapping of the file, whose pages are shared between processes.
+class WasmCodeCacheStore final {
+ public:
+  // The serialized module of a single entry, backed by a mapping of its file.
+  class Entry final {
+   public:
+    Entry(std::unique_ptr<base::OS::MemoryMappedFile> file,
+          base::Vector<const uint8_t> data)
+        : file_(std::move(file)), data_(data) {}
+
+    base::Vector<const uint8_t> data() const { return data_; }
+
+   private:
+    std::unique_ptr<base::OS::MemoryMappedFile> file_;
+    base::Vector<const uint8_t> data_;
+  };
+
+  static bool IsEnabled() { return v8_flags.wasm_code_cache_dir != nullptr; }
+
+  // Returns the serialized module for {wire_bytes}, or nullptr if there is
+  // none.
+  static std::unique_ptr<Entry> Lookup(base::Vector<const uint8_t> wire_bytes);
+
+  // Serializes {native_module} and stores the result. Does nothing if the
+  // module has no TurboFan code yet. Can be called from any thread.
+  static void Store(NativeModule* native_module);
+
+  // Stores {native_module} each time another chunk of its functions has been
+  // tiered up to TurboFan.
+  static void StoreOnTierUp(std::shared_ptr<NativeModule> native_module);
+
+  // Drops the entry for {wire_bytes}, e.g. after its data has been rejected.
+  static void Remove(base::Vector<const uint8_t> wire_bytes);
+
+ private:
+  struct Key {
+    uint8_t digest[kSizeOfSha256Digest];
+  };
+
+  // The header preceding the serialized module in each file.
+  struct Header {
+    uint32_t magic;
+    uint32_t length;
+    Key key;
+  };
+
+  static constexpr uint32_t kMagic = 0xC0DE3A5D;
+
+  static Key ComputeKey(base::Vector<const uint8_t> wire_bytes);
+  static std::string PathFor(const Key& key);
+};
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_WASM_WASM_CODE_CACHE_STORE_H_
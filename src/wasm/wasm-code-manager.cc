@@ -44,6 +44,7 @@
 #include "src/wasm/wasm-module.h"
 #include "src/wasm/wasm-objects-inl.h"
 #include "src/wasm/wasm-objects.h"
+#include "src/wasm/wasm-serialization.h"
 #include "src/wasm/well-known-imports.h"
 
 #if defined(V8_OS_WIN64)
@@ -1675,6 +1676,12 @@ void NativeModule::SetWireBytes(base::OwnedVector<const uint8_t> wire_bytes) {
   }
 }
 
+void NativeModule::set_lazily_deserialized_code(
+    std::unique_ptr<LazilyDeserializedCode> code) {
+  DCHECK_NULL(lazily_deserialized_code_);
+  lazily_deserialized_code_ = std::move(code);
+}
+
 void NativeModule::AddLazyCompilationTimeSample(int64_t sample_in_micro_sec) {
   num_lazy_compilations_.fetch_add(1, std::memory_order_relaxed);
   sum_lazy_compilation_time_in_micro_sec_.fetch_add(sample_in_micro_sec,
@@ -2425,7 +2432,7 @@ NamesProvider* NativeModule::GetNamesProvider() {
 }
 
 size_t NativeModule::EstimateCurrentMemoryConsumption() const {
-  UPDATE_WHEN_CLASS_CHANGES(NativeModule, 520);
+  UPDATE_WHEN_CLASS_CHANGES(NativeModule, 528);
   size_t result = sizeof(NativeModule);
   result += module_->EstimateCurrentMemoryConsumption();
 
@@ -2441,6 +2448,9 @@ size_t NativeModule::EstimateCurrentMemoryConsumption() const {
   result += import_wrapper_cache_.EstimateCurrentMemoryConsumption();
   // For {tiering_budgets_}.
   result += module_->num_declared_functions * sizeof(uint32_t);
+  if (lazily_deserialized_code_) {
+    result += lazily_deserialized_code_->EstimateCurrentMemoryConsumption();
+  }
 
   {
     base::RecursiveMutexGuard lock(&allocation_mutex_);
@@ -45,6 +45,7 @@ namespace wasm {
 class AssumptionsJournal;
 class DebugInfo;
 class NamesProvider;
+class LazilyDeserializedCode;
 class NativeModule;
 struct WasmCompilationResult;
 class WasmEngine;
@@ -617,6 +618,12 @@ class V8_EXPORT_PRIVATE NativeModule final {
   }
   void set_lazy_compile_frozen(bool frozen) { lazy_compile_frozen_ = frozen; }
   bool lazy_compile_frozen() const { return lazy_compile_frozen_; }
+  // Must be set before the module is shared, i.e. during deserialization.
+  void set_lazily_deserialized_code(
+      std::unique_ptr<LazilyDeserializedCode> code);
+  LazilyDeserializedCode* lazily_deserialized_code() const {
+    return lazily_deserialized_code_.get();
+  }
   base::Vector<const uint8_t> wire_bytes() const {
     return std::atomic_load(&wire_bytes_)->as_vector();
   }
@@ -876,6 +883,9 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // Array to handle number of function calls.
   std::unique_ptr<uint32_t[]> tiering_budgets_;
 
+  // Serialized code of functions that are deserialized on their first call.
+  std::unique_ptr<LazilyDeserializedCode> lazily_deserialized_code_;
+
   // This mutex protects concurrent calls to {AddCode} and friends.
   // TODO(dlehmann): Revert this to a regular {Mutex} again.
   // This needs to be a {RecursiveMutex} only because of {CodeSpaceWriteScope}
@@ -31,9 +31,11 @@
 #include "src/wasm/stacks.h"
 #include "src/wasm/std-object-sizes.h"
 #include "src/wasm/streaming-decoder.h"
+#include "src/wasm/wasm-code-cache-store.h"
 #include "src/wasm/wasm-debug.h"
 #include "src/wasm/wasm-limits.h"
 #include "src/wasm/wasm-objects-inl.h"
+#include "src/wasm/wasm-serialization.h"
 
 #ifdef V8_ENABLE_WASM_GDB_REMOTE_DEBUGGING
 #include "src/debug/wasm/gdb-server/gdb-server.h"
@@ -501,6 +503,14 @@ WasmEngine::~WasmEngine() {
     delete native_modules_kept_alive_for_pgo;
   }
 
+  // The shared import wrappers are not used by any module any more.
+  std::shared_ptr<NativeModule> shared_import_wrapper_module;
+  {
+    base::MutexGuard lock(&mutex_);
+    shared_import_wrapper_module = std::move(shared_import_wrapper_module_);
+  }
+  shared_import_wrapper_module.reset();
+
   operations_barrier_->CancelAndWait();
 
   // All AsyncCompileJobs have been canceled.
@@ -511,6 +521,7 @@ WasmEngine::~WasmEngine() {
   DCHECK(native_modules_.empty());
   // Native module cache does not leak.
   DCHECK(native_module_cache_.empty());
+  DCHECK(asm_js_module_cache_.empty());
 }
 
 bool WasmEngine::SyncValidate(Isolate* isolate, WasmFeatures enabled,
@@ -541,27 +552,35 @@ MaybeHandle<AsmWasmData> WasmEngine::SyncCompileTranslatedAsmJs(
   // the context id in here.
   v8::metrics::Recorder::ContextId context_id =
       v8::metrics::Recorder::ContextId::Empty();
-  ModuleResult result =
-      DecodeWasmModule(WasmFeatures::ForAsmjs(), bytes.module_bytes(), false,
-                       origin, isolate->counters(), isolate->metrics_recorder(),
-                       context_id, DecodingMethod::kSync);
-  if (result.failed()) {
-    // This happens once in a while when we have missed some limit check
-    // in the asm parser. Output an error message to help diagnose, but crash.
-    std::cout << result.error().message();
-    UNREACHABLE();
-  }
+  // Loading the same asm.js module again (e.g. in another isolate) yields the
+  // same translation, so decoding and compilation can be skipped.
+  std::shared_ptr<NativeModule> native_module = MaybeGetAsmJsNativeModule(
+      isolate, origin, bytes.module_bytes(), asm_js_offset_table_bytes);
+  if (!native_module) {
+    ModuleResult result = DecodeWasmModule(
+        WasmFeatures::ForAsmjs(), bytes.module_bytes(), false, origin,
+        isolate->counters(), isolate->metrics_recorder(), context_id,
+        DecodingMethod::kSync);
+    if (result.failed()) {
+      // This happens once in a while when we have missed some limit check
+      // in the asm parser. Output an error message to help diagnose, but
+      // crash.
+      std::cout << result.error().message();
+      UNREACHABLE();
+    }
 
-  result.value()->asm_js_offset_information =
-      std::make_unique<AsmJsOffsetInformation>(asm_js_offset_table_bytes);
+    result.value()->asm_js_offset_information =
+        std::make_unique<AsmJsOffsetInformation>(asm_js_offset_table_bytes);
 
-  // Transfer ownership of the WasmModule to the {Managed<WasmModule>} generated
-  // in {CompileToNativeModule}.
-  constexpr ProfileInformation* kNoProfileInformation = nullptr;
-  std::shared_ptr<NativeModule> native_module = CompileToNativeModule(
-      isolate, WasmFeatures::ForAsmjs(), thrower, std::move(result).value(),
-      bytes, compilation_id, context_id, kNoProfileInformation);
-  if (!native_module) return {};
+    // Transfer ownership of the WasmModule to the {Managed<WasmModule>}
+    // generated in {CompileToNativeModule}.
+    constexpr ProfileInformation* kNoProfileInformation = nullptr;
+    native_module = CompileToNativeModule(
+        isolate, WasmFeatures::ForAsmjs(), thrower, std::move(result).value(),
+        bytes, compilation_id, context_id, kNoProfileInformation);
+    if (!native_module) return {};
+    AddAsmJsNativeModuleToCache(native_module, asm_js_offset_table_bytes);
+  }
 
   native_module->LogWasmCodes(isolate, *script);
   {
@@ -580,6 +599,68 @@ MaybeHandle<AsmWasmData> WasmEngine::SyncCompileTranslatedAsmJs(
   return AsmWasmData::New(isolate, std::move(native_module), uses_bitset);
 }
 
+std::shared_ptr<NativeModule> WasmEngine::MaybeGetAsmJsNativeModule(
+    Isolate* isolate, ModuleOrigin origin,
+    base::Vector<const uint8_t> wire_bytes,
+    base::Vector<const uint8_t> asm_js_offset_table_bytes) {
+  DCHECK_NE(kWasmOrigin, origin);
+  if (!v8_flags.wasm_native_module_cache_enabled) return nullptr;
+  size_t hash = GetWireBytesHash(wire_bytes);
+  std::shared_ptr<NativeModule> native_module;
+  bool remove_all_code = false;
+  {
+    base::MutexGuard guard(&mutex_);
+    auto [begin, end] = asm_js_module_cache_.equal_range(hash);
+    for (auto it = begin; it != end; ++it) {
+      const AsmJsModuleCacheEntry& entry = it->second;
+      if (entry.origin != origin ||
+          entry.asm_js_offset_table_bytes.as_vector() !=
+              asm_js_offset_table_bytes ||
+          entry.native_module->wire_bytes() != wire_bytes) {
+        continue;
+      }
+      // Only take a strong reference on a match; dropping the last reference
+      // here would free the module while holding {mutex_}.
+      native_module = entry.weak_native_module.lock();
+      // A module that is currently dying cannot be reused.
+      if (native_module) break;
+    }
+    if (!native_module) return nullptr;
+    TRACE_EVENT0("v8.wasm", "AsmJsCacheHit");
+    native_modules_[native_module.get()]->isolates.insert(isolate);
+    DCHECK_EQ(1, isolates_.count(isolate));
+    auto* isolate_data = isolates_[isolate].get();
+    isolate_data->native_modules.insert(native_module.get());
+    if (isolate_data->keep_in_debug_state && !native_module->IsInDebugState()) {
+      remove_all_code = true;
+      native_module->SetDebugState(kDebugging);
+    }
+    if (isolate_data->log_codes && !native_module->log_code()) {
+      native_module->EnableCodeLogging();
+    }
+  }
+  if (remove_all_code) {
+    native_module->RemoveCompiledCode(
+        NativeModule::RemoveFilter::kRemoveNonDebugCode);
+  }
+  // Ensure that we have the right wrappers in this isolate.
+  CompileJsToWasmWrappers(isolate, native_module->module());
+  return native_module;
+}
+
+void WasmEngine::AddAsmJsNativeModuleToCache(
+    std::shared_ptr<NativeModule> native_module,
+    base::Vector<const uint8_t> asm_js_offset_table_bytes) {
+  if (!v8_flags.wasm_native_module_cache_enabled) return;
+  size_t hash = GetWireBytesHash(native_module->wire_bytes());
+  base::MutexGuard guard(&mutex_);
+  asm_js_module_cache_.emplace(
+      hash, AsmJsModuleCacheEntry{
+                native_module->module()->origin,
+                base::OwnedVector<const uint8_t>::Of(asm_js_offset_table_bytes),
+                native_module.get(), native_module});
+}
+
 Handle<WasmModuleObject> WasmEngine::FinalizeTranslatedAsmJs(
     Isolate* isolate, Handle<AsmWasmData> asm_wasm_data,
     Handle<Script> script) {
@@ -598,11 +679,41 @@ MaybeHandle<WasmModuleObject> WasmEngine::SyncCompile(Isolate* isolate,
   TRACE_EVENT1("v8.wasm", "wasm.SyncCompile", "id", compilation_id);
   v8::metrics::Recorder::ContextId context_id =
       isolate->GetOrRegisterRecorderContextId(isolate->native_context());
+
+  // Try to reuse a module compiled by another process before compiling it
+  // ourselves.
+  const bool use_code_cache_store =
+      WasmCodeCacheStore::IsEnabled() && !isolate->debug()->is_active();
+  if (use_code_cache_store) {
+    if (std::unique_ptr<WasmCodeCacheStore::Entry> entry =
+            WasmCodeCacheStore::Lookup(bytes.module_bytes())) {
+      Handle<WasmModuleObject> module_object;
+      if (DeserializeNativeModule(isolate, entry->data(), bytes.module_bytes(),
+                                  {})
+              .ToHandle(&module_object)) {
+        WasmCodeCacheStore::StoreOnTierUp(
+            module_object->shared_native_module());
+        return module_object;
+      }
+      // The entry was written by an incompatible configuration, or is
+      // corrupted; drop it so that it gets replaced below.
+      WasmCodeCacheStore::Remove(bytes.module_bytes());
+    }
+  }
+
   std::shared_ptr<WasmModule> module;
   {
+    // Without lazy validation, lazily compiled functions are validated before
+    // the module is returned anyway. Doing that during decoding overlaps it
+    // with the decoding of the remaining sections; functions validated there
+    // are skipped later.
+    const bool validate_functions =
+        !v8_flags.wasm_lazy_validation && v8_flags.wasm_lazy_compilation &&
+        v8_flags.wasm_background_validation_during_decoding;
     ModuleResult result = DecodeWasmModule(
-        enabled, bytes.module_bytes(), false, kWasmOrigin, isolate->counters(),
-        isolate->metrics_recorder(), context_id, DecodingMethod::kSync);
+        enabled, bytes.module_bytes(), validate_functions, kWasmOrigin,
+        isolate->counters(), isolate->metrics_recorder(), context_id,
+        DecodingMethod::kSync);
     if (result.failed()) {
       thrower->CompileFailed(result.error());
       return {};
@@ -622,6 +733,7 @@ MaybeHandle<WasmModuleObject> WasmEngine::SyncCompile(Isolate* isolate,
       CompileToNativeModule(isolate, enabled, thrower, std::move(module), bytes,
                             compilation_id, context_id, pgo_info.get());
   if (!native_module) return {};
+  if (use_code_cache_store) WasmCodeCacheStore::StoreOnTierUp(native_module);
 
 #ifdef DEBUG
   // Ensure that code GC will check this isolate for live code.
@@ -1403,6 +1515,28 @@ std::shared_ptr<NativeModule> WasmEngine::NewNativeModule(
   return native_module;
 }
 
+NativeModule* WasmEngine::GetSharedImportWrapperModule(Isolate* isolate) {
+  DCHECK(v8_flags.wasm_shared_import_wrapper_cache);
+  {
+    base::MutexGuard lock(&mutex_);
+    if (shared_import_wrapper_module_) {
+      return shared_import_wrapper_module_.get();
+    }
+  }
+  // The module does not contain any functions, it only provides the code space
+  // (and the jump tables for calling builtins) for the wrappers.
+  std::shared_ptr<NativeModule> native_module =
+      NewNativeModule(isolate, WasmFeatures::FromFlags(),
+                      std::make_shared<WasmModule>(kWasmOrigin), 0);
+  base::MutexGuard lock(&mutex_);
+  // If another thread won the race, {native_module} dies after releasing the
+  // lock (it unregisters itself from the engine).
+  if (!shared_import_wrapper_module_) {
+    shared_import_wrapper_module_ = std::move(native_module);
+  }
+  return shared_import_wrapper_module_.get();
+}
+
 std::shared_ptr<NativeModule> WasmEngine::MaybeGetNativeModule(
     ModuleOrigin origin, base::Vector<const uint8_t> wire_bytes,
     Isolate* isolate) {
@@ -1538,6 +1672,15 @@ void WasmEngine::FreeNativeModule(NativeModule* native_module) {
                   native_module, current_gc_info_->dead_code.size());
   }
   native_module_cache_.Erase(native_module);
+  if (is_asmjs_module(native_module->module())) {
+    auto [begin, end] = asm_js_module_cache_.equal_range(
+        GetWireBytesHash(native_module->wire_bytes()));
+    for (auto it = begin; it != end;) {
+      it = it->second.native_module == native_module
+               ? asm_js_module_cache_.erase(it)
+               : std::next(it);
+    }
+  }
   native_modules_.erase(module);
 }
 
@@ -1790,7 +1933,7 @@ void WasmEngine::PotentiallyFinishCurrentGC() {
 }
 
 size_t WasmEngine::EstimateCurrentMemoryConsumption() const {
-  UPDATE_WHEN_CLASS_CHANGES(WasmEngine, 720);
+  UPDATE_WHEN_CLASS_CHANGES(WasmEngine, 736);
   UPDATE_WHEN_CLASS_CHANGES(IsolateInfo, 192);
   UPDATE_WHEN_CLASS_CHANGES(NativeModuleInfo, 144);
   UPDATE_WHEN_CLASS_CHANGES(CurrentGCInfo, 96);
@@ -287,6 +287,11 @@ class V8_EXPORT_PRIVATE WasmEngine {
       Isolate* isolate, WasmFeatures enabled_features,
       std::shared_ptr<const WasmModule> module, size_t code_size_estimate);
 
+  // Returns the {NativeModule} which owns the import wrappers that are shared
+  // between all NativeModules (see {--wasm-shared-import-wrapper-cache}). It is
+  // created on first use and lives until the engine is torn down.
+  NativeModule* GetSharedImportWrapperModule(Isolate* isolate);
+
   // Try getting a cached {NativeModule}, or get ownership for its creation.
   // Return {nullptr} if no {NativeModule} exists for these bytes. In this case,
   // a {nullopt} entry is added to let other threads know that a {NativeModule}
@@ -385,6 +390,30 @@ class V8_EXPORT_PRIVATE WasmEngine {
   struct IsolateInfo;
   struct NativeModuleInfo;
 
+  // A translated asm.js module that can be shared between scripts and
+  // isolates. Besides the wire bytes (owned by the {NativeModule}), the origin
+  // and the asm.js offset table need to match, since they are baked into the
+  // module. The offset table is copied because the module drops its encoded
+  // version once decoded.
+  struct AsmJsModuleCacheEntry {
+    ModuleOrigin origin;
+    base::OwnedVector<const uint8_t> asm_js_offset_table_bytes;
+    // The entry is removed in {FreeNativeModule}, so {native_module} can be
+    // dereferenced while holding {mutex_}.
+    NativeModule* native_module;
+    std::weak_ptr<NativeModule> weak_native_module;
+  };
+
+  // Look up a previously compiled {NativeModule} for a translated asm.js
+  // module and register it with {isolate}. Returns {nullptr} on a miss.
+  std::shared_ptr<NativeModule> MaybeGetAsmJsNativeModule(
+      Isolate* isolate, ModuleOrigin origin,
+      base::Vector<const uint8_t> wire_bytes,
+      base::Vector<const uint8_t> asm_js_offset_table_bytes);
+  void AddAsmJsNativeModuleToCache(
+      std::shared_ptr<NativeModule> native_module,
+      base::Vector<const uint8_t> asm_js_offset_table_bytes);
+
   AsyncCompileJob* CreateAsyncCompileJob(
       Isolate* isolate, WasmFeatures enabled,
       base::OwnedVector<const uint8_t> bytes, Handle<Context> context,
@@ -453,6 +482,13 @@ class V8_EXPORT_PRIVATE WasmEngine {
 
   NativeModuleCache native_module_cache_;
 
+  // Translated asm.js modules, keyed by the hash of their wire bytes. Entries
+  // are removed when their {NativeModule} dies.
+  std::unordered_multimap<size_t, AsmJsModuleCacheEntry> asm_js_module_cache_;
+
+  // Owner of the import wrappers shared between NativeModules.
+  std::shared_ptr<NativeModule> shared_import_wrapper_module_;
+
   // End of fields protected by {mutex_}.
   //////////////////////////////////////////////////////////////////////////////
 };
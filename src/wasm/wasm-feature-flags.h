@@ -50,6 +50,10 @@
   /* Prototype spec: https://bit.ly/wasm-imported-strings */                   \
   /* V8 side owner: jkummerow */                                               \
   V(imported_strings, "imported strings", false)                               \
+                                                                               \
+  /* Non-specified, V8-only bulk copies between (array i8) and typed arrays */ \
+  V(js_array_copy, "WebAssembly.Array bulk copies to/from typed arrays",       \
+    false)                                                                     \
 
 // #############################################################################
 // Staged features (disabled by default, but enabled via --wasm-staging (also
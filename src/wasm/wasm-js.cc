@@ -3025,6 +3025,15 @@ void InstallStrings(Isolate* isolate, Handle<JSObject> webassembly) {
                         Builtin::kWebAssemblyStringCompare, 2, true);
 }
 
+void InstallArrays(Isolate* isolate, Handle<JSObject> webassembly) {
+  Handle<JSObject> array = isolate->factory()->NewJSObjectWithNullProto();
+  JSObject::AddProperty(isolate, webassembly, "Array", array, DONT_ENUM);
+  SimpleInstallFunction(isolate, array, "copyToTypedArray",
+                        Builtin::kWebAssemblyArrayCopyToTypedArray, 5, true);
+  SimpleInstallFunction(isolate, array, "copyFromTypedArray",
+                        Builtin::kWebAssemblyArrayCopyFromTypedArray, 5, true);
+}
+
 namespace {
 constexpr wasm::ValueType kWasmExceptionTagParams[] = {
     wasm::kWasmExternRef,
@@ -3313,6 +3322,11 @@ void WasmJs::Install(Isolate* isolate, bool exposed_on_global_object) {
   if (enabled_features.has_imported_strings()) {
     InstallStrings(isolate, webassembly);
   }
+
+  // Setup bulk copies between i8 arrays and typed arrays.
+  if (enabled_features.has_js_array_copy()) {
+    InstallArrays(isolate, webassembly);
+  }
 }
 
 // static
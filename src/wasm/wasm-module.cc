@@ -4,6 +4,7 @@
 
 #include "src/wasm/wasm-module.h"
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 
@@ -31,18 +32,28 @@ static_assert(
     std::numeric_limits<decltype(TypeDefinition().subtyping_depth)>::max());
 
 // static
-int WasmMemory::GetMemory64GuardsShift(uint64_t max_memory_size) {
-  // For memory64 we need a guard region that is at least twice the size of the
-  // maximum size of the Wasm memory. In order to speed-up bounds checks, we
-  // allocate the greater power-of-two size.
-  DCHECK_NE(max_memory_size, 0U);
-  size_t min_guards_size = 2 * max_memory_size;
-  int guards_shift = 63 - base::bits::CountLeadingZeros64(min_guards_size);
-  DCHECK_GE(guards_shift, 0);
-  if (!base::bits::IsPowerOfTwo(min_guards_size)) {
-    guards_shift++;
-  }
-  return guards_shift;
+uint64_t WasmMemory::GetMemory64GuardRegionsMaxSize() {
+  // Reserving zero pages is not possible, so use at least a single page.
+  uint64_t max_pages = std::clamp<uint64_t>(
+      v8_flags.wasm_memory64_guard_regions_max_pages, 1,
+      kV8MaxWasmMemory64Pages);
+  return max_pages * kWasmPageSize;
+}
+
+// static
+int WasmMemory::GetMemory64GuardsShift() {
+  // The smallest power of two that is not below the maximum memory size. This
+  // is what compiled code compares the index against.
+  uint64_t max_size = GetMemory64GuardRegionsMaxSize();
+  return 64 - base::bits::CountLeadingZeros64(max_size - 1);
+}
+
+// static
+uint64_t WasmMemory::GetMemory64GuardsSize() {
+  // Indexes are below {1 << shift}, and static offsets (plus access size) are
+  // below the maximum memory size, which itself is at most {1 << shift}. Hence
+  // twice that size covers every access that compiled code can emit.
+  return uint64_t{2} << GetMemory64GuardsShift();
 }
 
 template <class Value>
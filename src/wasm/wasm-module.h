@@ -132,10 +132,17 @@ struct WasmMemory {
   uintptr_t max_memory_size = 0;  // largest size of any memory in bytes
   BoundsCheckStrategy bounds_checks = kExplicitBoundsChecks;
 
-  inline int GetMemory64GuardsShift() const {
-    return GetMemory64GuardsShift(maximum_pages * kWasmPageSize);
-  }
-  static int GetMemory64GuardsShift(uint64_t max_memory_size);
+  // Memory64 memories whose maximum size is at most
+  // {GetMemory64GuardRegionsMaxSize()} can use guard regions. All of them get a
+  // reservation of the same size ({GetMemory64GuardsSize()}), so that code
+  // compiled for one such memory also works for any memory imported into it.
+  // Compiled code clamps indexes which are not below
+  // {1 << GetMemory64GuardsShift()} to a certainly inaccessible address; since
+  // static offsets are below the maximum memory size, every access then either
+  // stays inside the reservation or faults.
+  static uint64_t GetMemory64GuardRegionsMaxSize();
+  static int GetMemory64GuardsShift();
+  static uint64_t GetMemory64GuardsSize();
 };
 
 inline void UpdateComputedInformation(WasmMemory* memory, ModuleOrigin origin) {
@@ -156,8 +163,12 @@ inline void UpdateComputedInformation(WasmMemory* memory, ModuleOrigin origin) {
   } else if (origin != kWasmOrigin) {
     // Asm.js modules can't use trap handling.
     memory->bounds_checks = kExplicitBoundsChecks;
-  } else if (memory->is_memory64 && !v8_flags.wasm_memory64_trap_handling) {
-    // Memory64 currently always requires explicit bounds checks.
+  } else if (memory->is_memory64 &&
+             (!v8_flags.wasm_memory64_trap_handling ||
+              memory->max_memory_size >
+                  WasmMemory::GetMemory64GuardRegionsMaxSize())) {
+    // Memory64 requires explicit bounds checks unless trap handling is enabled
+    // for it and the memory fits into the configured guard regions.
     memory->bounds_checks = kExplicitBoundsChecks;
   } else if (trap_handler::IsTrapHandlerEnabled()) {
     if constexpr (kSystemPointerSize == 4) UNREACHABLE();
@@ -553,9 +564,10 @@ struct FunctionTypeFeedback {
   // feedback vector by {TransitiveTypeFeedbackProcessor}.
   std::vector<CallSiteFeedback> feedback_vector;
 
-  // {call_targets} has one entry per "call" and "call_ref" in the function.
+  // {call_targets} has one entry per "call" and "call_ref" in the function,
+  // and per "call_indirect" if --wasm-inlining-call-indirect is enabled.
   // For "call", it holds the index of the called function, for "call_ref" the
-  // value will be {kNonDirectCall}.
+  // value will be {kNonDirectCall}, and for "call_indirect" {kCallIndirect}.
   base::OwnedVector<uint32_t> call_targets;
 
   // {tierup_priority} is updated and used when triggering tier-up.
@@ -563,6 +575,7 @@ struct FunctionTypeFeedback {
   int tierup_priority = 0;
 
   static constexpr uint32_t kNonDirectCall = 0xFFFFFFFF;
+  static constexpr uint32_t kCallIndirect = 0xFFFFFFFE;
 };
 
 struct TypeFeedbackStorage {
@@ -522,6 +522,12 @@ bool NativeModuleSerializer::Write(Writer* writer) {
 
 WasmSerializer::WasmSerializer(NativeModule* native_module)
     : native_module_(native_module) {
+  // Functions whose deserialization was deferred have no code yet; materialize
+  // them so that serializing the module again doesn't drop their code.
+  if (LazilyDeserializedCode* lazy_code =
+          native_module->lazily_deserialized_code()) {
+    lazy_code->MaterializeAll(native_module);
+  }
   std::tie(code_table_, import_statuses_) = native_module->SnapshotCodeTable();
 }
 
@@ -598,6 +604,15 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
 
   bool Read(Reader* reader);
 
+  // Reads, relocates and publishes the code of a single function, which was
+  // skipped by {Read} with --wasm-lazy-deserialization.
+  WasmCode* ReadAndPublishFunction(int fn_index, size_t code_size,
+                                   Reader* reader);
+
+  std::unique_ptr<LazilyDeserializedCode> TakeLazilyDeserializedCode() {
+    return std::move(lazily_deserialized_code_);
+  }
+
   base::Vector<const int> lazy_functions() {
     return base::VectorOf(lazy_functions_);
   }
@@ -611,6 +626,8 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
 
   void ReadHeader(Reader* reader);
   DeserializationUnit ReadCode(int fn_index, Reader* reader);
+  // Skips over the code of a TurboFan function and returns its code size.
+  size_t SkipCode(Reader* reader);
   void ReadTieringBudget(Reader* reader);
   void CopyAndRelocate(const DeserializationUnit& unit);
   void Publish(std::vector<DeserializationUnit> batch);
@@ -627,6 +644,7 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
   NativeModule::JumpTablesRef current_jump_tables_;
   std::vector<int> lazy_functions_;
   std::vector<int> eager_functions_;
+  std::unique_ptr<LazilyDeserializedCode> lazily_deserialized_code_;
 };
 
 class DeserializeCodeTask : public JobTask {
@@ -723,9 +741,26 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
   size_t batch_limit =
       std::max(kMinBatchSizeInBytes, remaining_code_size_ / 100);
 
+  // With lazy deserialization, TurboFan code is only indexed here, and copied
+  // and relocated by {LazilyDeserializedCode} on the first call.
+  const bool lazy_deserialization = v8_flags.wasm_lazy_deserialization;
+  const uint8_t* code_section_start = reader->current_location();
+  std::vector<LazilyDeserializedCode::PendingFunction> pending_functions;
+  if (lazy_deserialization) {
+    pending_functions.resize(native_module_->module()->num_declared_functions);
+  }
+
   std::vector<DeserializationUnit> batch;
   size_t batch_size = 0;
   for (uint32_t i = first_wasm_fn; i < total_fns; ++i) {
+    if (lazy_deserialization && reader->current_size() > 0 &&
+        *reader->current_location() == kTurboFanFunction) {
+      LazilyDeserializedCode::PendingFunction& pending =
+          pending_functions[i - first_wasm_fn];
+      pending.offset = reader->current_location() - code_section_start;
+      pending.code_size = SkipCode(reader);
+      continue;
+    }
     DeserializationUnit unit = ReadCode(i, reader);
     if (!unit.code) continue;
     batch_size += unit.code->instructions().size();
@@ -751,6 +786,15 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
   // Wait for all tasks to finish, while participating in their work.
   job_handle->Join();
 
+  if (lazy_deserialization) {
+    base::Vector<const uint8_t> code_section{
+        code_section_start,
+        static_cast<size_t>(reader->current_location() - code_section_start)};
+    lazily_deserialized_code_ = std::make_unique<LazilyDeserializedCode>(
+        base::OwnedVector<const uint8_t>::Of(code_section),
+        std::move(pending_functions));
+  }
+
   ReadTieringBudget(reader);
   return reader->current_size() == 0;
 }
@@ -831,6 +875,42 @@ DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
   return unit;
 }
 
+size_t NativeModuleDeserializer::SkipCode(Reader* reader) {
+  uint8_t code_kind = reader->Read<uint8_t>();
+  DCHECK_EQ(kTurboFanFunction, code_kind);
+  USE(code_kind);
+  // Skip the table offsets, the binary size and the stack slots (see
+  // {ReadCode}).
+  reader->Skip(6 * sizeof(int) + sizeof(uint32_t));
+  int code_size = reader->Read<int>();
+  int reloc_size = reader->Read<int>();
+  int source_position_size = reader->Read<int>();
+  int inlining_position_size = reader->Read<int>();
+  int protected_instructions_size = reader->Read<int>();
+  reader->Skip(sizeof(WasmCode::Kind) + sizeof(ExecutionTier));
+  reader->Skip(code_size + reloc_size + source_position_size +
+               inlining_position_size + protected_instructions_size);
+
+  DCHECK(IsAligned(code_size, kCodeAlignment));
+  DCHECK_GE(remaining_code_size_, code_size);
+  remaining_code_size_ -= code_size;
+  return code_size;
+}
+
+WasmCode* NativeModuleDeserializer::ReadAndPublishFunction(int fn_index,
+                                                           size_t code_size,
+                                                           Reader* reader) {
+  remaining_code_size_ = code_size;
+  DeserializationUnit unit = ReadCode(fn_index, reader);
+  DCHECK_NOT_NULL(unit.code);
+  DCHECK_EQ(0, remaining_code_size_);
+  CopyAndRelocate(unit);
+  WasmCode* code = native_module_->PublishCode(std::move(unit.code));
+  code->MaybePrint();
+  code->Validate();
+  return code;
+}
+
 void NativeModuleDeserializer::CopyAndRelocate(
     const DeserializationUnit& unit) {
   WritableJitAllocation jit_allocation = ThreadIsolation::RegisterJitAllocation(
@@ -918,6 +998,44 @@ void NativeModuleDeserializer::Publish(std::vector<DeserializationUnit> batch) {
   }
 }
 
+LazilyDeserializedCode::LazilyDeserializedCode(
+    base::OwnedVector<const uint8_t> code_section,
+    std::vector<PendingFunction> pending_functions)
+    : code_section_(std::move(code_section)),
+      pending_functions_(std::move(pending_functions)) {}
+
+WasmCode* LazilyDeserializedCode::MaterializeFunction(
+    NativeModule* native_module, int func_index) {
+  PendingFunction pending;
+  {
+    base::MutexGuard guard(&mutex_);
+    PendingFunction& entry = pending_functions_[declared_function_index(
+        native_module->module(), func_index)];
+    if (entry.code_size == 0) return nullptr;
+    // Claim the function, so that concurrent callers compile it instead of
+    // deserializing it a second time.
+    pending = entry;
+    entry = PendingFunction{};
+  }
+  Reader reader(code_section_.as_vector() + pending.offset);
+  NativeModuleDeserializer deserializer(native_module);
+  return deserializer.ReadAndPublishFunction(func_index, pending.code_size,
+                                             &reader);
+}
+
+void LazilyDeserializedCode::MaterializeAll(NativeModule* native_module) {
+  uint32_t first_wasm_fn = native_module->num_imported_functions();
+  uint32_t total_fns = native_module->num_functions();
+  for (uint32_t i = first_wasm_fn; i < total_fns; ++i) {
+    MaterializeFunction(native_module, i);
+  }
+}
+
+size_t LazilyDeserializedCode::EstimateCurrentMemoryConsumption() const {
+  return sizeof(*this) + code_section_.size() +
+         pending_functions_.capacity() * sizeof(PendingFunction);
+}
+
 bool IsSupportedVersion(base::Vector<const uint8_t> header) {
   if (header.size() < WasmSerializer::kHeaderSize) return false;
   uint8_t current_version[WasmSerializer::kHeaderSize];
@@ -976,6 +1094,9 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
           error, std::move(shared_native_module), isolate);
       return {};
     }
+    if (auto lazy_code = deserializer.TakeLazilyDeserializedCode()) {
+      shared_native_module->set_lazily_deserialized_code(std::move(lazy_code));
+    }
     shared_native_module->compilation_state()->InitializeAfterDeserialization(
         deserializer.lazy_functions(), deserializer.eager_functions());
     wasm_engine->UpdateNativeModuleCache(error, shared_native_module, isolate);
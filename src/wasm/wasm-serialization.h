@@ -9,6 +9,7 @@
 #ifndef V8_WASM_WASM_SERIALIZATION_H_
 #define V8_WASM_WASM_SERIALIZATION_H_
 
+#include "src/base/platform/mutex.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-objects.h"
 
@@ -53,6 +54,38 @@ class V8_EXPORT_PRIVATE WasmSerializer {
   std::vector<WellKnownImport> import_statuses_;
 };
 
+// Holds the serialized TurboFan code of functions whose deserialization was
+// deferred to their first call (see --wasm-lazy-deserialization). Owned by the
+// {NativeModule}; the lazy compilation stub asks it for serialized code before
+// compiling a function.
+class V8_EXPORT_PRIVATE LazilyDeserializedCode {
+ public:
+  // The position of a serialized function in {code_section}. A {code_size} of
+  // 0 means that there is no (more) serialized code for the function.
+  struct PendingFunction {
+    size_t offset = 0;
+    size_t code_size = 0;
+  };
+
+  // {pending_functions} is indexed by declared function index.
+  LazilyDeserializedCode(base::OwnedVector<const uint8_t> code_section,
+                         std::vector<PendingFunction> pending_functions);
+
+  // If the code of {func_index} has not been deserialized yet, copies,
+  // relocates and publishes it. Returns nullptr otherwise.
+  WasmCode* MaterializeFunction(NativeModule*, int func_index);
+
+  // Materializes the code of all pending functions.
+  void MaterializeAll(NativeModule*);
+
+  size_t EstimateCurrentMemoryConsumption() const;
+
+ private:
+  const base::OwnedVector<const uint8_t> code_section_;
+  base::Mutex mutex_;
+  std::vector<PendingFunction> pending_functions_;
+};
+
 // Support for deserializing WebAssembly {NativeModule} objects.
 // Checks the version header of the data against the current version.
 bool IsSupportedVersion(base::Vector<const uint8_t> data);
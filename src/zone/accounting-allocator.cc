@@ -4,11 +4,14 @@
 
 #include "src/zone/accounting-allocator.h"
 
+#include <algorithm>
 #include <memory>
 
+#include "src/base/bits.h"
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/flags/flags.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -79,7 +82,7 @@ AccountingAllocator::AccountingAllocator()
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { ReleasePooledSegments(); }
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
@@ -89,6 +92,9 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
     memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
+  } else if (Segment* segment = GetSegmentFromPool(bytes)) {
+    memory = segment;
+    bytes = segment->total_size();
   } else {
     auto result = AllocAtLeastWithRetry(bytes);
     memory = result.ptr;
@@ -112,6 +118,16 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapContents();
   size_t segment_size = segment->total_size();
   current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
+  if (!(COMPRESS_ZONES_BOOL && supports_compression) &&
+      AddSegmentToPool(segment)) {
+    return;
+  }
+  FreeSegment(segment, supports_compression);
+}
+
+void AccountingAllocator::FreeSegment(Segment* segment,
+                                      bool supports_compression) {
+  size_t segment_size = segment->total_size();
   segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
     FreePages(bounded_page_allocator_.get(), segment, segment_size);
@@ -120,5 +136,79 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   }
 }
 
+Segment* AccountingAllocator::GetSegmentFromPool(size_t requested_size) {
+  if (requested_size > (size_t{1} << kMaxSegmentSizePower)) return nullptr;
+  size_t power = std::max(
+      kMinSegmentSizePower,
+      static_cast<size_t>(base::bits::WhichPowerOfTwo(
+          base::bits::RoundUpToPowerOfTwo64(requested_size))));
+  DCHECK_LE(power, kMaxSegmentSizePower);
+
+  Segment* segment;
+  {
+    base::MutexGuard guard(&segment_pool_mutex_);
+    size_t index = power - kMinSegmentSizePower;
+    segment = segment_pool_heads_[index];
+    if (segment == nullptr) {
+      segment_pool_misses_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    segment_pool_heads_[index] = segment->next();
+    pooled_memory_usage_.fetch_sub(segment->total_size(),
+                                   std::memory_order_relaxed);
+  }
+  segment_pool_hits_.fetch_add(1, std::memory_order_relaxed);
+  DCHECK_GE(segment->total_size(), requested_size);
+  segment->set_next(nullptr);
+  segment->set_zone(nullptr);
+  return segment;
+}
+
+bool AccountingAllocator::AddSegmentToPool(Segment* segment) {
+  size_t size = segment->total_size();
+  // Segments that are too small or much larger than the largest size class
+  // are not worth keeping.
+  if (size < (size_t{1} << kMinSegmentSizePower) ||
+      size >= (size_t{1} << (kMaxSegmentSizePower + 1))) {
+    return false;
+  }
+  // Bucket by the largest size class the segment can serve.
+  size_t power = kMinSegmentSizePower;
+  while (power < kMaxSegmentSizePower && (size_t{1} << (power + 1)) <= size) {
+    power++;
+  }
+
+  base::MutexGuard guard(&segment_pool_mutex_);
+  if (pooled_memory_usage_.load(std::memory_order_relaxed) + size >
+      v8_flags.zone_segment_pool_size) {
+    return false;
+  }
+  size_t index = power - kMinSegmentSizePower;
+  segment->set_zone(nullptr);
+  segment->set_next(segment_pool_heads_[index]);
+  segment_pool_heads_[index] = segment;
+  pooled_memory_usage_.fetch_add(size, std::memory_order_relaxed);
+  return true;
+}
+
+void AccountingAllocator::ReleasePooledSegments() {
+  Segment* segments[kNumberBuckets];
+  {
+    base::MutexGuard guard(&segment_pool_mutex_);
+    for (size_t i = 0; i < kNumberBuckets; i++) {
+      segments[i] = segment_pool_heads_[i];
+      segment_pool_heads_[i] = nullptr;
+    }
+    pooled_memory_usage_.store(0, std::memory_order_relaxed);
+  }
+  for (Segment* segment : segments) {
+    while (segment != nullptr) {
+      Segment* next = segment->next();
+      FreeSegment(segment, false);
+      segment = next;
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
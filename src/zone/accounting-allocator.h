@@ -10,6 +10,7 @@
 
 #include "include/v8-platform.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
@@ -46,6 +47,23 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  // Number of bytes held by segments that are kept in the pool for reuse.
+  // These are not included in GetCurrentMemoryUsage().
+  size_t GetPooledMemoryUsage() const {
+    return pooled_memory_usage_.load(std::memory_order_relaxed);
+  }
+
+  size_t GetSegmentPoolHits() const {
+    return segment_pool_hits_.load(std::memory_order_relaxed);
+  }
+
+  size_t GetSegmentPoolMisses() const {
+    return segment_pool_misses_.load(std::memory_order_relaxed);
+  }
+
+  // Frees all pooled segments, e.g. on memory pressure.
+  void ReleasePooledSegments();
+
   void TraceZoneCreation(const Zone* zone) {
     if (V8_LIKELY(!TracingFlags::is_zone_stats_enabled())) return;
     TraceZoneCreationImpl(zone);
@@ -67,8 +85,27 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  // Segments of 2^kMinSegmentSizePower to 2^kMaxSegmentSizePower bytes, which
+  // covers the sizes that Zone requests for regular expansion, are pooled
+  // (up to --zone-segment-pool-size bytes) instead of being freed right away.
+  // Each pool bucket holds segments at least as large as its size class.
+  static constexpr size_t kMinSegmentSizePower = 13;
+  static constexpr size_t kMaxSegmentSizePower = 15;
+  static constexpr size_t kNumberBuckets =
+      1 + kMaxSegmentSizePower - kMinSegmentSizePower;
+
+  Segment* GetSegmentFromPool(size_t requested_size);
+  bool AddSegmentToPool(Segment* segment);
+  void FreeSegment(Segment* segment, bool supports_compression);
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
+  std::atomic<size_t> pooled_memory_usage_{0};
+  std::atomic<size_t> segment_pool_hits_{0};
+  std::atomic<size_t> segment_pool_misses_{0};
+
+  base::Mutex segment_pool_mutex_;
+  Segment* segment_pool_heads_[kNumberBuckets] = {};
 
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
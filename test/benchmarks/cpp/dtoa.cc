@@ -4,12 +4,15 @@
 
 #include "src/base/macros.h"
 #include "src/base/numbers/fast-dtoa.h"
+#include "src/base/numbers/schubfach-dtoa.h"
 #include "src/base/vector.h"
 #include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
 
 using v8::base::FAST_DTOA_PRECISION;
 using v8::base::FAST_DTOA_SHORTEST;
 using v8::base::kFastDtoaMaximalLength;
+using v8::base::kSchubfachDtoaMaximalLength;
+using v8::base::SchubfachDtoa;
 using v8::base::Vector;
 
 // This is a dump from a benchmark (MotionMark suits).
@@ -1053,6 +1056,16 @@ static void BM_DtoaShortest(benchmark::State& state) {
   }
 }
 
+static void BM_DtoaShortestSchubfach(benchmark::State& state) {
+  char output[kSchubfachDtoaMaximalLength + 10];
+  Vector<char> buffer(output, sizeof(output));
+  int length, decimal_point;
+  unsigned idx = 0;
+  for (auto _ : state) {
+    SchubfachDtoa(kTestDoubles[idx++ % 4096], buffer, &length, &decimal_point);
+  }
+}
+
 static void BM_DtoaSixDigits(benchmark::State& state) {
   char output[kFastDtoaMaximalLength + 10];
   Vector<char> buffer(output, sizeof(output));
@@ -1066,4 +1079,5 @@ static void BM_DtoaSixDigits(benchmark::State& state) {
 }
 
 BENCHMARK(BM_DtoaShortest);
+BENCHMARK(BM_DtoaShortestSchubfach);
 BENCHMARK(BM_DtoaSixDigits);
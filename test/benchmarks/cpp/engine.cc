@@ -0,0 +1,242 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Microbenchmarks for core engine primitives, driven through the public API:
+// string internalization, property access, JSON, Map operations, object
+// allocation, young-generation GC and ValueSerializer round trips.
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-array-buffer.h"
+#include "include/v8-container.h"
+#include "include/v8-context.h"
+#include "include/v8-initialization.h"
+#include "include/v8-isolate.h"
+#include "include/v8-json.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-object.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "include/v8-value-serializer.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+std::unique_ptr<v8::Platform> g_platform;
+
+class EngineBenchmark : public benchmark::Fixture {
+ public:
+  static void InitializeProcess(const char* argv0) {
+    v8::V8::SetFlagsFromString("--expose-gc");
+    v8::V8::InitializeICUDefaultLocation(argv0);
+    v8::V8::InitializeExternalStartupData(argv0);
+    g_platform = v8::platform::NewDefaultPlatform();
+    v8::V8::InitializePlatform(g_platform.get());
+    v8::V8::Initialize();
+  }
+
+  static void ShutdownProcess() {
+    v8::V8::Dispose();
+    v8::V8::DisposePlatform();
+    g_platform.reset();
+  }
+
+  void SetUp(::benchmark::State&) override {
+    allocator_.reset(v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = allocator_.get();
+    isolate_ = v8::Isolate::New(create_params);
+    isolate_->Enter();
+    v8::HandleScope handle_scope(isolate_);
+    context_.Reset(isolate_, v8::Context::New(isolate_));
+  }
+
+  void TearDown(::benchmark::State&) override {
+    context_.Reset();
+    isolate_->Exit();
+    isolate_->Dispose();
+    isolate_ = nullptr;
+    allocator_.reset();
+  }
+
+ protected:
+  v8::Isolate* isolate() const { return isolate_; }
+  v8::Local<v8::Context> context() const {
+    return context_.Get(isolate_);
+  }
+
+  v8::Local<v8::String> NewString(const std::string& value) {
+    return v8::String::NewFromUtf8(isolate_, value.c_str(),
+                                   v8::NewStringType::kNormal,
+                                   static_cast<int>(value.size()))
+        .ToLocalChecked();
+  }
+
+  v8::Local<v8::Value> Run(const char* source) {
+    v8::Local<v8::Script> script =
+        v8::Script::Compile(context(), NewString(source)).ToLocalChecked();
+    return script->Run(context()).ToLocalChecked();
+  }
+
+ private:
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_;
+  v8::Isolate* isolate_ = nullptr;
+  v8::Global<v8::Context> context_;
+};
+
+// Representative JSON payload: an array of small, uniformly shaped records.
+std::string MakeJsonCorpus(int records) {
+  std::string json = "[";
+  for (int i = 0; i < records; i++) {
+    if (i) json += ",";
+    json += "{\"id\":" + std::to_string(i) + ",\"name\":\"item" +
+            std::to_string(i) +
+            "\",\"price\":" + std::to_string(i) + ".5,\"tags\":[\"a\",\"b\"]," +
+            "\"active\":" + (i % 2 ? "true" : "false") + "}";
+  }
+  json += "]";
+  return json;
+}
+
+}  // namespace
+
+BENCHMARK_F(EngineBenchmark, StringInternalization)(benchmark::State& st) {
+  std::vector<std::string> keys;
+  for (int i = 0; i < 1024; i++) keys.push_back("key" + std::to_string(i));
+  v8::HandleScope handle_scope(isolate());
+  for (auto _ : st) {
+    v8::HandleScope inner_scope(isolate());
+    for (const std::string& key : keys) {
+      benchmark::DoNotOptimize(
+          v8::String::NewFromUtf8(isolate(), key.c_str(),
+                                  v8::NewStringType::kInternalized,
+                                  static_cast<int>(key.size()))
+              .ToLocalChecked());
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * keys.size());
+}
+
+BENCHMARK_F(EngineBenchmark, NamedPropertyLoad)(benchmark::State& st) {
+  v8::HandleScope handle_scope(isolate());
+  v8::Context::Scope context_scope(context());
+  v8::Local<v8::Object> object =
+      Run("({a: 1, b: 2, c: 3, d: 4, e: 5, f: 6, g: 7, h: 8})").As<v8::Object>();
+  v8::Local<v8::String> key = v8::String::NewFromUtf8Literal(
+      isolate(), "g", v8::NewStringType::kInternalized);
+  for (auto _ : st) {
+    benchmark::DoNotOptimize(object->Get(context(), key).ToLocalChecked());
+  }
+}
+
+BENCHMARK_F(EngineBenchmark, JsonParse)(benchmark::State& st) {
+  v8::HandleScope handle_scope(isolate());
+  v8::Context::Scope context_scope(context());
+  v8::Local<v8::String> json = NewString(MakeJsonCorpus(1000));
+  for (auto _ : st) {
+    v8::HandleScope inner_scope(isolate());
+    benchmark::DoNotOptimize(
+        v8::JSON::Parse(context(), json).ToLocalChecked());
+  }
+  st.SetBytesProcessed(st.iterations() * json->Utf8Length(isolate()));
+}
+
+BENCHMARK_F(EngineBenchmark, JsonStringify)(benchmark::State& st) {
+  v8::HandleScope handle_scope(isolate());
+  v8::Context::Scope context_scope(context());
+  v8::Local<v8::Value> value =
+      v8::JSON::Parse(context(), NewString(MakeJsonCorpus(1000)))
+          .ToLocalChecked();
+  for (auto _ : st) {
+    v8::HandleScope inner_scope(isolate());
+    benchmark::DoNotOptimize(
+        v8::JSON::Stringify(context(), value).ToLocalChecked());
+  }
+}
+
+BENCHMARK_F(EngineBenchmark, MapSetGet)(benchmark::State& st) {
+  v8::HandleScope handle_scope(isolate());
+  v8::Context::Scope context_scope(context());
+  constexpr int kEntries = 1024;
+  for (auto _ : st) {
+    v8::HandleScope inner_scope(isolate());
+    v8::Local<v8::Map> map = v8::Map::New(isolate());
+    for (int i = 0; i < kEntries; i++) {
+      v8::Local<v8::Value> key = v8::Integer::New(isolate(), i);
+      map = map->Set(context(), key, key).ToLocalChecked();
+    }
+    for (int i = 0; i < kEntries; i++) {
+      benchmark::DoNotOptimize(
+          map->Get(context(), v8::Integer::New(isolate(), i))
+              .ToLocalChecked());
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * kEntries);
+}
+
+BENCHMARK_F(EngineBenchmark, ObjectAllocation)(benchmark::State& st) {
+  v8::HandleScope handle_scope(isolate());
+  v8::Context::Scope context_scope(context());
+  for (auto _ : st) {
+    v8::HandleScope inner_scope(isolate());
+    for (int i = 0; i < 1000; i++) {
+      benchmark::DoNotOptimize(v8::Object::New(isolate()));
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * 1000);
+}
+
+BENCHMARK_F(EngineBenchmark, ScavengeLinkedList)(benchmark::State& st) {
+  v8::HandleScope handle_scope(isolate());
+  v8::Context::Scope context_scope(context());
+  // Keep a synthetic graph of young objects alive so that each scavenge has
+  // to copy it.
+  Run("globalThis.list = null;"
+      "for (let i = 0; i < 10000; i++) list = {next: list, value: i};");
+  for (auto _ : st) {
+    isolate()->RequestGarbageCollectionForTesting(
+        v8::Isolate::kMinorGarbageCollection);
+  }
+}
+
+BENCHMARK_F(EngineBenchmark, ValueSerializerRoundTrip)(benchmark::State& st) {
+  v8::HandleScope handle_scope(isolate());
+  v8::Context::Scope context_scope(context());
+  v8::Local<v8::Value> value =
+      v8::JSON::Parse(context(), NewString(MakeJsonCorpus(100)))
+          .ToLocalChecked();
+  for (auto _ : st) {
+    v8::HandleScope inner_scope(isolate());
+    v8::ValueSerializer serializer(isolate());
+    serializer.WriteHeader();
+    serializer.WriteValue(context(), value).Check();
+    std::pair<uint8_t*, size_t> buffer = serializer.Release();
+    {
+      v8::ValueDeserializer deserializer(isolate(), buffer.first,
+                                         buffer.second);
+      deserializer.ReadHeader(context()).Check();
+      benchmark::DoNotOptimize(
+          deserializer.ReadValue(context()).ToLocalChecked());
+    }
+    free(buffer.first);
+  }
+}
+
+// Expanded macro BENCHMARK_MAIN() to allow per-process setup.
+int main(int argc, char** argv) {
+  EngineBenchmark::InitializeProcess(argv[0]);
+  // Contents of BENCHMARK_MAIN().
+  {
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+  }
+  EngineBenchmark::ShutdownProcess();
+  return 0;
+}
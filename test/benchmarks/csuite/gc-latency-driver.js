@@ -0,0 +1,61 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Allocation patterns modeled on server workloads, used by gc-latency.py to
+// measure GC pause distributions. Run with:
+//   d8 --trace-gc-nvp gc-latency-driver.js -- <requests>
+
+(function() {
+  const args = globalThis.arguments || [];
+  const requests = args.length > 0 ? parseInt(args[0]) : 20000;
+  const kCacheLimit = 50000;
+
+  const cache = new Map();
+  const weakState = new WeakMap();
+  let retainedBuffers = [];
+  let checksum = 0;
+
+  // Short-lived garbage scoped to a single request: parsed payloads,
+  // intermediate strings and arrays.
+  function handleRequest(i) {
+    const payload = {
+      id: i,
+      user: 'user' + (i % 1000),
+      items: [],
+    };
+    for (let j = 0; j < 20; j++) {
+      payload.items.push({sku: 'sku' + j, qty: j, price: j * 1.5});
+    }
+    const body = JSON.stringify(payload);
+    const parsed = JSON.parse(body);
+    weakState.set(parsed, {seen: i});
+    return parsed.items.length + body.length;
+  }
+
+  // A cache that grows until it hits its limit and then evicts its oldest
+  // entries, so old-generation objects keep dying.
+  function updateCache(i) {
+    cache.set('key' + i, {value: new Array(16).fill(i), stamp: i});
+    if (cache.size > kCacheLimit) {
+      const oldest = cache.keys().next().value;
+      cache.delete(oldest);
+    }
+  }
+
+  // Large backing stores with a short retention window.
+  function allocateBuffer(i) {
+    const buffer = new ArrayBuffer(256 * 1024);
+    new Uint8Array(buffer)[i % buffer.byteLength] = 1;
+    retainedBuffers.push(buffer);
+    if (retainedBuffers.length > 32) retainedBuffers = [];
+  }
+
+  for (let i = 0; i < requests; i++) {
+    checksum += handleRequest(i);
+    updateCache(i);
+    if (i % 50 == 0) allocateBuffer(i);
+  }
+
+  print('checksum=' + checksum);
+})();
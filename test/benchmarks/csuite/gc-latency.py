@@ -0,0 +1,127 @@
+#!/usr/bin/python3
+# Copyright 2024 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+'''
+python gc-latency.py [options] <d8 path>
+
+Runs gc-latency-driver.js with --trace-gc-nvp and reports the distribution
+of GC pauses as JSON. Unlike the throughput scores produced by csuite.py,
+this is meant to judge GC heuristic changes on tail latency.
+
+The output contains, per GC type and overall:
+  count:      number of GCs.
+  pause_ms:   p50/p90/p99/p999/max of the main-thread pause.
+  gc_cpu_ms:  total main-thread pause plus time spent in background GC
+              scopes, as reported by the GCTracer.
+  mutator_ms: total mutator time between GCs.
+
+Examples:
+  ./gc-latency.py ~/src/v8/out/x64.release/d8
+  ./gc-latency.py -r 5 -x="--single-threaded-gc" ./d8 > results.json
+'''
+
+# for py2/py3 compatibility
+from __future__ import print_function
+
+import json
+import os
+from optparse import OptionParser
+import subprocess
+import sys
+
+PERCENTILES = [50, 90, 99, 99.9]
+
+
+def ParseNvpLine(line):
+  '''Returns a dict of key=value pairs from a --trace-gc-nvp line.'''
+  result = {}
+  # Lines are prefixed with "[pid:isolate] time ms: ".
+  if 'pause=' not in line:
+    return None
+  for token in line[line.index('pause='):].split():
+    if '=' not in token:
+      continue
+    key, value = token.split('=', 1)
+    try:
+      result[key] = float(value)
+    except ValueError:
+      result[key] = value
+  return result
+
+
+def Percentile(sorted_values, percentile):
+  if not sorted_values:
+    return 0.0
+  index = int(round((percentile / 100.0) * (len(sorted_values) - 1)))
+  return sorted_values[index]
+
+
+def Summarize(events):
+  pauses = sorted(e['pause'] for e in events)
+  summary = {
+      'count': len(events),
+      'pause_ms': {
+          'p%s' % str(p).replace('.', ''): Percentile(pauses, p)
+          for p in PERCENTILES
+      },
+      'gc_cpu_ms': 0.0,
+      'mutator_ms': sum(e.get('mutator', 0.0) for e in events),
+  }
+  summary['pause_ms']['max'] = pauses[-1] if pauses else 0.0
+  for event in events:
+    background = sum(
+        value for key, value in event.items()
+        if key.startswith('background.') and isinstance(value, float))
+    summary['gc_cpu_ms'] += event['pause'] + background
+  return summary
+
+
+if __name__ == '__main__':
+  parser = OptionParser(usage=__doc__)
+  parser.add_option("-r", "--runs", dest="runs", type="int", default=3,
+      help="Number of d8 runs to aggregate (default 3).")
+  parser.add_option("-n", "--requests", dest="requests", type="int",
+      default=20000, help="Number of simulated requests per run.")
+  parser.add_option("-x", "--extra-arguments", dest="extra_args", default="",
+      help="Pass these extra arguments to d8.")
+  parser.add_option("-v", "--verbose", action="store_true", dest="verbose",
+      help="See more output about what is being run.")
+  (opts, args) = parser.parse_args()
+
+  if len(args) < 1:
+    print('not enough arguments')
+    sys.exit(1)
+
+  d8_path = os.path.abspath(args[0])
+  if not os.path.exists(d8_path):
+    print(d8_path + " is not valid.")
+    sys.exit(1)
+
+  csuite_path = os.path.dirname(os.path.abspath(__file__))
+  driver_path = os.path.join(csuite_path, "gc-latency-driver.js")
+
+  cmdline = [d8_path, "--trace-gc-nvp"] + opts.extra_args.split() + \
+      [driver_path, "--", str(opts.requests)]
+
+  events = []
+  for run in range(opts.runs):
+    if opts.verbose:
+      print("Run %d: %s" % (run, " ".join(cmdline)), file=sys.stderr)
+    output = subprocess.check_output(cmdline, universal_newlines=True)
+    for line in output.splitlines():
+      event = ParseNvpLine(line)
+      if event is not None:
+        events.append(event)
+
+  result = {
+      'runs': opts.runs,
+      'requests': opts.requests,
+      'total': Summarize(events),
+      'by_type': {},
+  }
+  for gc_type in sorted(set(str(e.get('gc')) for e in events)):
+    result['by_type'][gc_type] = Summarize(
+        [e for e in events if str(e.get('gc')) == gc_type])
+
+  print(json.dumps(result, indent=2, sort_keys=True))
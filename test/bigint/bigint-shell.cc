@@ -2,9 +2,12 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <atomic>
 #include <cmath>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "src/bigint/bigint-internal.h"
 #include "src/bigint/util.h"
@@ -33,6 +36,7 @@ int PrintHelp(char** argv) {
   V(kBarrett, "barrett")             \
   V(kBurnikel, "burnikel")           \
   V(kFFT, "fft")                     \
+  V(kFFTParallel, "fftparallel")     \
   V(kFromString, "fromstring")       \
   V(kFromStringBase2, "fromstring2") \
   V(kKaratsuba, "karatsuba")         \
@@ -123,6 +127,25 @@ std::string FormatHex(Digits X) {
   return std::string(result.get(), chars);
 }
 
+// Runs the parts of parallel computations on a few short-lived threads.
+class ThreadedPlatform : public Platform {
+ public:
+  static constexpr int kWorkerThreads = 3;
+
+  int NumberOfWorkerThreads() override { return kWorkerThreads; }
+
+  void RunInParallel(ParallelTask* task, int count) override {
+    std::atomic<int> next_index{0};
+    auto work = [&]() {
+      for (int i = next_index++; i < count; i = next_index++) task->Run(i);
+    };
+    std::vector<std::thread> workers;
+    for (int i = 0; i < kWorkerThreads; i++) workers.emplace_back(work);
+    work();
+    for (std::thread& worker : workers) worker.join();
+  }
+};
+
 class Runner {
  public:
   Runner() = default;
@@ -200,6 +223,10 @@ class Runner {
       for (int i = 0; i < runs_; i++) {
         TestFFT(&count);
       }
+    } else if (test_ == kFFTParallel) {
+      for (int i = 0; i < runs_; i++) {
+        TestFFTParallel(&count);
+      }
     } else if (test_ == kKaratsuba) {
       for (int i = 0; i < runs_; i++) {
         TestKaratsuba(&count);
@@ -311,6 +338,43 @@ class Runner {
 #endif  // V8_ADVANCED_BIGINT_ALGORITHMS
   }
 
+  void TestFFTParallel(int* count) {
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+    std::unique_ptr<Processor, Processor::Destroyer> parallel_processor(
+        Processor::New(new ThreadedPlatform()));
+    ProcessorImpl* parallel = static_cast<ProcessorImpl*>(
+        parallel_processor.get());
+    // Make sure the product is large enough for the pointwise multiplications
+    // to be split up.
+    uint64_t random_bits = rng_.NextUint64();
+    int right_size = kFftParallelThreshold / 2 + (random_bits & 4095);
+    random_bits >>= 12;
+    int left_size = right_size + (random_bits & 4095);
+    std::cout << "left " << left_size << " right " << right_size << "\n";
+    ScratchDigits A(left_size);
+    ScratchDigits B(right_size);
+    int result_len = MultiplyResultLength(A, B);
+    ScratchDigits result(result_len);
+    ScratchDigits result_single_threaded(result_len);
+    GenerateRandom(A);
+    GenerateRandom(B);
+    parallel->MultiplyFFT(result, A, B);
+    processor()->MultiplyFFT(result_single_threaded, A, B);
+    AssertEquals(A, B, result_single_threaded, result);
+    if (error_) return;
+    (*count)++;
+    // Squaring reads and writes the same parts.
+    int square_len = MultiplyResultLength(A, A);
+    ScratchDigits square(square_len);
+    ScratchDigits square_single_threaded(square_len);
+    parallel->MultiplyFFT(square, A, A);
+    processor()->MultiplyFFT(square_single_threaded, A, A);
+    AssertEquals(A, A, square_single_threaded, square);
+    if (error_) return;
+    (*count)++;
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+  }
+
   void TestBurnikel(int* count) {
     // Start small to save test execution time.
     constexpr int kMin = kBurnikelThreshold / 2;
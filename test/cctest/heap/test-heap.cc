@@ -1215,6 +1215,71 @@ static void TestMultiReferencedBytecodeFlushing(bool sparkplug_compile) {
   }
 }
 
+TEST(TestAdaptiveBytecodeFlushing) {
+#if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+  v8_flags.turbofan = false;
+  v8_flags.always_turbofan = false;
+  i::v8_flags.optimize_for_size = false;
+#endif  // !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+#ifdef V8_ENABLE_SPARKPLUG
+  v8_flags.always_sparkplug = false;
+#endif  // V8_ENABLE_SPARKPLUG
+  i::v8_flags.flush_bytecode = true;
+  i::v8_flags.adaptive_bytecode_flushing = true;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+  DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      CcTest::heap());
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+    {
+      v8::HandleScope new_scope(isolate);
+      CompileRun(source);
+    }
+
+    Handle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    CHECK(IsJSFunction(*func_value));
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    CHECK(function->shared()->is_compiled());
+    CHECK(!function->shared()->bytecode_was_flushed());
+
+    // Bytecode which was never flushed is flushed at the regular old age.
+    function->shared()->set_age(v8_flags.bytecode_old_age);
+    heap::InvokeMajorGC(CcTest::heap());
+    CHECK(!function->shared()->is_compiled());
+    CHECK(function->shared()->bytecode_was_flushed());
+
+    // Once re-compiled, it survives a regular GC at that age...
+    CompileRun("foo()");
+    CHECK(function->shared()->is_compiled());
+    function->shared()->set_age(v8_flags.bytecode_old_age);
+    heap::InvokeMajorGC(CcTest::heap());
+    CHECK(function->shared()->is_compiled());
+
+    // ... but not a GC which tries to reduce memory.
+    heap::InvokeMemoryReducingMajorGCs(CcTest::heap());
+    CHECK(!function->shared()->is_compiled());
+    CompileRun("foo()");
+    CHECK(function->shared()->is_compiled());
+  }
+}
+
 TEST(TestMultiReferencedBytecodeFlushing) {
   TestMultiReferencedBytecodeFlushing(/*sparkplug_compile=*/false);
 }
@@ -686,6 +686,43 @@ TEST(BackingStore_HoldAllocatorAlive_UntilIsolateShutdown) {
   CHECK(allocator_weak.expired());
 }
 
+TEST(BackingStore_PooledReuse) {
+  i::FlagScope<unsigned int> pool_scope(
+      &i::v8_flags.array_buffer_pool_size_kb, 256);
+  std::shared_ptr<DummyAllocator> allocator =
+      std::make_shared<DummyAllocator>();
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator_shared = allocator;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  isolate->Enter();
+
+  {
+    v8::HandleScope handle_scope(isolate);
+    v8::Context::Scope context_scope(Context::New(isolate));
+    const size_t kLength = 8 * i::KB;
+
+    v8::Local<v8::ArrayBuffer> first = v8::ArrayBuffer::New(isolate, kLength);
+    void* data = first->Data();
+    memset(data, 0xAB, kLength);
+    CHECK(first->Detach(v8::Local<v8::Value>()).FromJust());
+    // The detached backing store was returned to the pool instead of the
+    // allocator.
+    CHECK_EQ(allocator->allocation_count(), 1);
+
+    v8::Local<v8::ArrayBuffer> second = v8::ArrayBuffer::New(isolate, kLength);
+    CHECK_EQ(data, second->Data());
+    CHECK_EQ(allocator->allocation_count(), 1);
+    const uint8_t* bytes = static_cast<const uint8_t*>(second->Data());
+    for (size_t i = 0; i < kLength; i++) CHECK_EQ(0, bytes[i]);
+  }
+
+  isolate->Exit();
+  isolate->Dispose();
+  // Disposing the isolate frees the pooled memory of its allocator.
+  CHECK_EQ(allocator->allocation_count(), 0);
+}
+
 TEST(BackingStore_HoldAllocatorAlive_AfterIsolateShutdown) {
   std::shared_ptr<DummyAllocator> allocator =
       std::make_shared<DummyAllocator>();
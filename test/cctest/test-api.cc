@@ -16961,6 +16961,38 @@ TEST(NumberOfDetachedContexts) {
   }
 }
 
+TEST(NumberOfMaps) {
+  i::DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      CcTest::heap());
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapStatistics heap_statistics;
+  CHECK_EQ(0u, heap_statistics.number_of_maps());
+  i::heap::InvokeAtomicMajorGC(CcTest::heap());
+  CcTest::isolate()->GetHeapStatistics(&heap_statistics);
+  size_t maps_before = heap_statistics.number_of_maps();
+  CHECK_LT(0u, maps_before);
+
+  // Objects with distinct shapes, and an object whose map is deprecated by a
+  // field representation change on another object of the same shape.
+  CompileRun(
+      "var shapes = [];"
+      "for (var i = 0; i < 100; i++) {"
+      "  var o = {};"
+      "  o['p' + i] = i;"
+      "  shapes.push(o);"
+      "}"
+      "var stale = {smi_field: 1};"
+      "var updated = {smi_field: 1};"
+      "updated.smi_field = 1.5;");
+  i::heap::InvokeAtomicMajorGC(CcTest::heap());
+  CcTest::isolate()->GetHeapStatistics(&heap_statistics);
+  CHECK_LE(maps_before + 100, heap_statistics.number_of_maps());
+  CHECK_LE(1u, heap_statistics.number_of_deprecated_maps());
+  CHECK_LE(heap_statistics.number_of_deprecated_maps(),
+           heap_statistics.number_of_maps());
+}
+
 TEST(ExternalizeOldSpaceTwoByteCons) {
   v8::Isolate* isolate = CcTest::isolate();
   LocalContext env;
@@ -20747,6 +20779,47 @@ THREADED_TEST(JSONParseNumber) {
   ExpectString("JSON.stringify(obj)", "42");
 }
 
+THREADED_TEST(JSONStreamingParser) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  v8::JSON::StreamingParser parser;
+
+  const char* chunks[] = {"{\"a\": [1, 2", ", 3], \"b\"", ": \"xyz\"}"};
+  for (const char* chunk : chunks) {
+    parser.Append(reinterpret_cast<const uint8_t*>(chunk), strlen(chunk));
+  }
+  Local<Value> obj = parser.Finish(context.local()).ToLocalChecked();
+  context->Global()->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectString("JSON.stringify(obj)", "{\"a\":[1,2,3],\"b\":\"xyz\"}");
+
+  // One-byte chunks followed by a two-byte chunk.
+  const uint8_t one_byte[] = {'[', '"', 'a', 'b'};
+  const uint16_t two_byte[] = {0x1234, '"', ']'};
+  parser.Append(one_byte, arraysize(one_byte));
+  parser.Append(two_byte, arraysize(two_byte));
+  obj = parser.Finish(context.local()).ToLocalChecked();
+  context->Global()->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectTrue("obj[0] === 'ab\\u1234'");
+
+  // Errors are reported like in JSON::Parse and leave the parser reusable.
+  {
+    v8::TryCatch try_catch(isolate);
+    parser.Append(one_byte, arraysize(one_byte));
+    CHECK(parser.Finish(context.local()).IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+  {
+    v8::TryCatch try_catch(isolate);
+    CHECK(parser.Finish(context.local()).IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+  parser.Append(one_byte, 1);
+  parser.Append(reinterpret_cast<const uint8_t*>("]"), 1);
+  obj = parser.Finish(context.local()).ToLocalChecked();
+  CHECK(obj->IsArray());
+}
+
 namespace {
 void TestJSONParseArray(Local<Context> context, const char* input_str,
                         const char* expected_output_str,
@@ -21406,6 +21479,27 @@ TEST(RequestInterruptSmallScripts) {
   CHECK(interrupt_was_called);
 }
 
+static int coalesced_interrupt_count = 0;
+
+void CoalescedInterruptCallback(v8::Isolate* isolate, void* data) {
+  coalesced_interrupt_count++;
+}
+
+TEST(RequestInterruptWhilePending) {
+  LocalContext env;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+
+  // Requests made while an API interrupt is already pending share its stack
+  // guard flag, but every callback still has to run.
+  coalesced_interrupt_count = 0;
+  for (int i = 0; i < 3; i++) {
+    isolate->RequestInterrupt(&CoalescedInterruptCallback, nullptr);
+  }
+  CompileRun("(function(x){return x;})(1);");
+  CHECK_EQ(3, coalesced_interrupt_count);
+}
+
 static v8::Global<Value> function_new_expected_env_global;
 static void FunctionNewCallback(const v8::FunctionCallbackInfo<Value>& info) {
   v8::Isolate* isolate = info.GetIsolate();
@@ -29024,6 +29118,64 @@ TEST(TriggerDelayedMainThreadMetricsEvent) {
   CHECK_EQ(recorder->count_, 1);  // Unchanged.
 }
 
+namespace {
+
+class TieringMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  std::vector<v8::metrics::JavaScriptOptimization> optimizations_;
+  std::vector<v8::metrics::JavaScriptDeoptimization> deoptimizations_;
+
+  void AddMainThreadEvent(const v8::metrics::JavaScriptOptimization& event,
+                          v8::metrics::Recorder::ContextId id) override {
+    CHECK(!id.IsEmpty());
+    optimizations_.push_back(event);
+  }
+
+  void AddMainThreadEvent(const v8::metrics::JavaScriptDeoptimization& event,
+                          v8::metrics::Recorder::ContextId id) override {
+    CHECK(!id.IsEmpty());
+    deoptimizations_.push_back(event);
+  }
+};
+
+}  // namespace
+
+TEST(TriggerJavaScriptTieringMetricsEvents) {
+  if (!i::v8_flags.turbofan || i::v8_flags.always_turbofan) return;
+  i::v8_flags.allow_natives_syntax = true;
+
+  v8::Isolate* iso = CcTest::isolate();
+  std::shared_ptr<TieringMetricsRecorder> recorder =
+      std::make_shared<TieringMetricsRecorder>();
+  iso->SetMetricsRecorder(recorder);
+
+  LocalContext env;
+  v8::HandleScope scope(iso);
+  CompileRun(
+      "function f(o) { return o.x; }\n"
+      "%PrepareFunctionForOptimization(f);\n"
+      "f({x: 1}); f({x: 2});\n"
+      "%OptimizeFunctionOnNextCall(f);\n"
+      "f({x: 3});\n"
+      "f({y: 1, x: 4});\n");
+
+  CHECK(!recorder->optimizations_.empty());
+  const v8::metrics::JavaScriptOptimization& optimization =
+      recorder->optimizations_.back();
+  CHECK_GE(optimization.script_id, 0);
+  CHECK(!optimization.osr);
+
+  CHECK(!recorder->deoptimizations_.empty());
+  const v8::metrics::JavaScriptDeoptimization& deoptimization =
+      recorder->deoptimizations_.back();
+  CHECK_EQ(optimization.script_id, deoptimization.script_id);
+  CHECK_EQ(optimization.function_start_position,
+           deoptimization.function_start_position);
+  CHECK_GE(deoptimization.bytecode_offset, 0);
+  CHECK_NOT_NULL(deoptimization.reason);
+  CHECK(!deoptimization.lazy);
+}
+
 TEST(TriggerThreadSafeMetricsEvent) {
   // Set up isolate and context.
   v8::Isolate* iso = CcTest::isolate();
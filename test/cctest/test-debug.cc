@@ -1104,6 +1104,47 @@ TEST(BreakPointApiFunction) {
   CheckDebuggerUnloaded();
 }
 
+#if V8_ENABLE_SPARKPLUG
+TEST(BreakPointApiFunctionKeepsUnrelatedBaselineCode) {
+  i::v8_flags.allow_natives_syntax = true;
+  i::v8_flags.baseline_batch_compilation = false;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  if (!i::v8_flags.sparkplug) return;
+
+  DebugEventCounter delegate;
+  v8::debug::SetDebugDelegate(env->GetIsolate(), &delegate);
+
+  v8::Local<v8::FunctionTemplate> function_template =
+      v8::FunctionTemplate::New(env->GetIsolate(), NoOpFunctionCallback);
+  v8::Local<v8::Function> function =
+      function_template->GetFunction(env.local()).ToLocalChecked();
+  env->Global()->Set(env.local(), v8_str("f"), function).ToChecked();
+
+  v8::Local<v8::Function> g = CompileFunction(
+      &env, "function g() { return f(); }; %CompileBaseline(g);", "g");
+  i::Handle<i::SharedFunctionInfo> g_shared(
+      i::Handle<i::JSFunction>::cast(v8::Utils::OpenHandle(*g))->shared(),
+      CcTest::i_isolate());
+  CHECK(g_shared->HasBaselineCode());
+
+  // Breaking at entry of an API function only discards baseline code of the
+  // function itself; baseline callers still reach the breakpoint.
+  break_point_hit_count = 0;
+  i::Handle<i::BreakPoint> bp = SetBreakPoint(function, 0);
+  CHECK(g_shared->HasBaselineCode());
+  ExpectInt32("g()", 2);
+  CHECK_EQ(1, break_point_hit_count);
+
+  ClearBreakPoint(bp);
+  ExpectInt32("g()", 2);
+  CHECK_EQ(1, break_point_hit_count);
+
+  v8::debug::SetDebugDelegate(env->GetIsolate(), nullptr);
+  CheckDebuggerUnloaded();
+}
+#endif  // V8_ENABLE_SPARKPLUG
+
 TEST(BreakPointApiConstructor) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
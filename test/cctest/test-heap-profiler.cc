@@ -29,6 +29,7 @@
 
 #include <ctype.h>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -359,6 +360,63 @@ TEST(HeapSnapshotObjectSizes) {
 }
 
 
+namespace {
+
+const v8::HeapSnapshotClassDelta* FindClassDelta(
+    const std::vector<v8::HeapSnapshotClassDelta>& deltas,
+    const char* class_name) {
+  for (const v8::HeapSnapshotClassDelta& delta : deltas) {
+    if (delta.class_name == class_name) return &delta;
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+TEST(HeapSnapshotDiffByClassName) {
+  // Conservative stack scanning might keep the released objects alive.
+  i::DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      CcTest::heap());
+
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  CompileRun("function Leaky() {}\nleaks = [];\n");
+  const v8::HeapSnapshot* before = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(before));
+
+  CompileRun("for (let i = 0; i < 3; i++) leaks.push(new Leaky());");
+  const v8::HeapSnapshot* with_leaks = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(with_leaks));
+
+  std::vector<v8::HeapSnapshotClassDelta> deltas =
+      with_leaks->DiffByClassName(before);
+  const v8::HeapSnapshotClassDelta* leaky = FindClassDelta(deltas, "Leaky");
+  CHECK_NOT_NULL(leaky);
+  CHECK_EQ(3u, leaky->added_count);
+  CHECK_EQ(0u, leaky->removed_count);
+  CHECK_LT(0u, leaky->added_size);
+  CHECK(std::is_sorted(deltas.begin(), deltas.end(),
+                       [](const v8::HeapSnapshotClassDelta& a,
+                          const v8::HeapSnapshotClassDelta& b) {
+                         return a.class_name < b.class_name;
+                       }));
+
+  CompileRun("leaks = [];");
+  const v8::HeapSnapshot* after = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(after));
+
+  deltas = after->DiffByClassName(with_leaks);
+  leaky = FindClassDelta(deltas, "Leaky");
+  CHECK_NOT_NULL(leaky);
+  CHECK_EQ(0u, leaky->added_count);
+  CHECK_EQ(3u, leaky->removed_count);
+
+  // Identical snapshots have no differences.
+  CHECK(after->DiffByClassName(after).empty());
+}
+
 TEST(BoundFunctionInSnapshot) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
@@ -1568,6 +1626,24 @@ TEST(TakeHeapSnapshotAborting) {
   CHECK_GT(control.total(), 0);
 }
 
+TEST(TakeHeapSnapshotToFileDoesNotRetainSnapshot) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  i::HeapProfiler* i_heap_profiler =
+      reinterpret_cast<i::HeapProfiler*>(heap_profiler);
+  const int snapshots_count = heap_profiler->GetSnapshotCount();
+  const char* filename = "take-heap-snapshot-to-file.heapsnapshot";
+  i_heap_profiler->TakeSnapshotToFile(v8::HeapProfiler::HeapSnapshotOptions(),
+                                      filename);
+  CHECK_EQ(snapshots_count, heap_profiler->GetSnapshotCount());
+  FILE* file = fopen(filename, "r");
+  CHECK_NOT_NULL(file);
+  CHECK_NE(EOF, fgetc(file));
+  fclose(file);
+  remove(filename);
+}
+
 TEST(TakeHeapSnapshotReportFinishOnce) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
@@ -3882,6 +3958,37 @@ TEST(SamplingHeapProfilerApiSamples) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+TEST(SamplingHeapProfilerSampleLifetime) {
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Suppress randomness to avoid flakiness in tests.
+  i::v8_flags.sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(256);
+
+  CompileRun(
+      "var retained = [];\n"
+      "for (var i = 0; i < 4096; ++i) retained.push({i});\n");
+  i::heap::InvokeMajorGC(CcTest::heap());
+  i::heap::InvokeMajorGC(CcTest::heap());
+
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  CHECK(profile);
+  CHECK(!profile->GetSamples().empty());
+  unsigned int max_survived_gc_count = 0;
+  for (auto& sample : profile->GetSamples()) {
+    CHECK_GT(sample.allocation_time_ms, 0);
+    max_survived_gc_count =
+        std::max(max_survived_gc_count, sample.survived_gc_count);
+  }
+  CHECK_GE(max_survived_gc_count, 2);
+
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(SamplingHeapProfilerLeftTrimming) {
   v8::HandleScope scope(CcTest::isolate());
   LocalContext env;
@@ -1238,6 +1238,34 @@ TEST(OrderedHashSetDuplicateHashCodeDeletion) {
   CHECK(!OrderedHashSet::HasKey(isolate, *set, *key2));
 }
 
+TEST(OrderedHashSetShrinkToFit) {
+  LocalContext context;
+  Isolate* isolate = GetIsolateFrom(&context);
+  HandleScope scope(isolate);
+
+  Handle<OrderedHashSet> set =
+      OrderedHashSet::Allocate(isolate, 1024).ToHandleChecked();
+  CHECK_EQ(512, set->NumberOfBuckets());
+  for (int i = 0; i < 3; i++) {
+    Handle<Smi> key(Smi::FromInt(i), isolate);
+    set = OrderedHashSet::Add(isolate, set, key).ToHandleChecked();
+  }
+  CHECK_EQ(512, set->NumberOfBuckets());
+
+  // A table holding far fewer elements than its capacity shrinks in a single
+  // step, but keeps enough room to not regrow on the next addition.
+  set = OrderedHashSet::Shrink(isolate, set);
+  Verify(isolate, set);
+  CHECK_EQ(4, set->NumberOfBuckets());
+  CHECK_EQ(3, set->NumberOfElements());
+  CHECK_EQ(0, set->NumberOfDeletedElements());
+  for (int i = 0; i < 3; i++) {
+    CHECK(OrderedHashSet::HasKey(isolate, *set, Smi::FromInt(i)));
+  }
+  Handle<OrderedHashSet> unchanged = OrderedHashSet::Shrink(isolate, set);
+  CHECK_EQ(*set, *unchanged);
+}
+
 TEST(SmallOrderedHashSetDuplicateHashCodeDeletion) {
   LocalContext context;
   Isolate* isolate = GetIsolateFrom(&context);
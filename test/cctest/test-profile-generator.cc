@@ -461,6 +461,42 @@ TEST(SymbolizeTickSample) {
   CHECK_EQ(entry1, stack_trace[2].code_entry);
 }
 
+TEST(SymbolizeTickSampleAfterCodeMapChange) {
+  TestSetup test_setup;
+  CodeEntryStorage storage;
+  InstructionStreamMap instruction_stream_map(storage);
+  Symbolizer symbolizer(&instruction_stream_map);
+  CodeEntry* entry1 =
+      storage.Create(i::LogEventListener::CodeTag::kFunction, "aaa");
+  CodeEntry* entry2 =
+      storage.Create(i::LogEventListener::CodeTag::kFunction, "bbb");
+  instruction_stream_map.AddCode(ToAddress(0x1500), entry1, 0x200);
+
+  TickSample sample;
+  sample.pc = ToPointer(0x1600);
+  sample.tos = ToPointer(0x1500);
+  sample.stack[0] = ToPointer(0x1910);
+  sample.frames_count = 1;
+  Symbolizer::SymbolizedSample symbolized =
+      symbolizer.SymbolizeTickSample(sample);
+  CHECK_EQ(2, symbolized.stack_trace.size());
+  CHECK_EQ(entry1, symbolized.stack_trace[0].code_entry);
+  CHECK_EQ(nullptr, symbolized.stack_trace[1].code_entry);
+
+  // Lookups cached for the same addresses must see changes to the map.
+  instruction_stream_map.MoveCode(ToAddress(0x1500), ToAddress(0x1800));
+  instruction_stream_map.AddCode(ToAddress(0x1500), entry2, 0x200);
+  symbolized = symbolizer.SymbolizeTickSample(sample);
+  CHECK_EQ(2, symbolized.stack_trace.size());
+  CHECK_EQ(entry2, symbolized.stack_trace[0].code_entry);
+  CHECK_EQ(entry1, symbolized.stack_trace[1].code_entry);
+
+  instruction_stream_map.Clear();
+  symbolized = symbolizer.SymbolizeTickSample(sample);
+  CHECK_EQ(1, symbolized.stack_trace.size());
+  CHECK_EQ(nullptr, symbolized.stack_trace[0].code_entry);
+}
+
 static void CheckNodeIds(const ProfileNode* node, unsigned* expectedId) {
   CHECK_EQ((*expectedId)++, node->id());
   for (const ProfileNode* child : *node->children()) {
@@ -481,6 +481,26 @@ UNINITIALIZED_TEST(SnapshotCompression) {
   shared_space_blob.Dispose();
   context_blob.Dispose();
 }
+
+UNINITIALIZED_TEST(SnapshotCompressionMultipleChunks) {
+  // Large enough to be split into several independently compressed chunks,
+  // with a trailing partial chunk.
+  const size_t kSize = 3 * MB + 123;
+  std::vector<uint8_t> data(kSize);
+  uint32_t seed = 0x12345678;
+  for (size_t i = 0; i < kSize; i++) {
+    seed = seed * 1103515245 + 12345;
+    // Mix compressible runs with noise.
+    data[i] = (i & 0x1000) ? static_cast<uint8_t>(i) : (seed >> 24);
+  }
+  base::Vector<const uint8_t> blob(data.data(), data.size());
+  SnapshotData original_snapshot_data(blob);
+  SnapshotData compressed =
+      i::SnapshotCompression::Compress(&original_snapshot_data);
+  SnapshotData decompressed =
+      i::SnapshotCompression::Decompress(compressed.RawData());
+  CHECK_EQ(blob, decompressed.RawData());
+}
 #endif  // SNAPSHOT_COMPRESSION
 
 UNINITIALIZED_TEST(ContextSerializerContext) {
@@ -3059,6 +3079,66 @@ TEST(CodeSerializerAfterExecute) {
   v8_flags.always_turbofan = prev_always_turbofan_value;
 }
 
+TEST(CodeSerializerKeepsPreparseData) {
+  // Lazy functions which contain inner functions carry the preparse data of
+  // those inner functions in their UncompiledData. The code cache must keep it,
+  // so that compiling such a function after a cache hit can skip the inner
+  // functions instead of preparsing them again.
+  const char* js_source =
+      "function outer() {"
+      "  var x = 'abc';"
+      "  function inner() { return x; }"
+      "  return inner();"
+      "}"
+      "'abc' + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile_expected(i_isolate2);
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    }
+    CHECK(!cache->rejected);
+
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    bool found_outer = false;
+    SharedFunctionInfo::ScriptIterator it(
+        i_isolate2, Script::cast(toplevel->script()));
+    for (Tagged<SharedFunctionInfo> sfi = it.Next(); !sfi.is_null();
+         sfi = it.Next()) {
+      if (strcmp(sfi->DebugNameCStr().get(), "outer") != 0) continue;
+      found_outer = true;
+      CHECK(!sfi->is_compiled());
+      CHECK(sfi->HasUncompiledDataWithPreparseData());
+    }
+    CHECK(found_outer);
+
+    script->BindToCurrentContext()
+        ->Run(isolate2->GetCurrentContext())
+        .ToLocalChecked();
+    v8::Local<v8::Value> result = CompileRun("outer()");
+    CHECK(result->Equals(isolate2->GetCurrentContext(), v8_str("abc"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
@@ -40,6 +40,7 @@
 #include "src/execution/messages.h"
 #include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"
+#include "src/objects/external-string-region-table.h"
 #include "src/objects/objects-inl.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
@@ -2128,6 +2129,63 @@ TEST(CheckCachedDataInternalExternalUncachedStringTwoByte) {
   }
 }
 
+class TestExternalStringRegion : public v8::String::ExternalStringRegion {
+ public:
+  TestExternalStringRegion(const char* data, size_t length, bool* released)
+      : data_(data), length_(length), released_(released) {}
+  ~TestExternalStringRegion() override { *released_ = true; }
+
+  const void* data() const override { return data_; }
+  size_t byte_length() const override { return length_; }
+
+ private:
+  const char* data_;
+  size_t length_;
+  bool* released_;
+};
+
+// Strings created from a region share a single reference to it, can be
+// internalized without a copy, and release the region once they all died.
+TEST(ExternalStringsFromRegion) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  v8::Isolate* v8_isolate = CcTest::isolate();
+  ExternalStringRegionTable* table = isolate->external_string_region_table();
+  static const char kData[] = "alphabetagamma";
+  bool released = false;
+  {
+    auto region = std::make_shared<TestExternalStringRegion>(
+        kData, strlen(kData), &released);
+    v8::HandleScope scope(v8_isolate);
+    v8::Local<v8::String> alpha =
+        v8::String::NewExternalOneByte(v8_isolate, region, 0, 5)
+            .ToLocalChecked();
+    v8::Local<v8::String> beta =
+        v8::String::NewExternalOneByte(v8_isolate, region, 5, 4)
+            .ToLocalChecked();
+    CHECK(alpha->IsExternalOneByte());
+    CHECK(beta->StringEquals(v8_str("beta")));
+    CHECK_EQ(1u, table->region_count());
+    CHECK_EQ(2u, table->live_slice_count());
+
+    Handle<String> string = Utils::OpenHandle(*alpha);
+    Handle<String> internal = isolate->factory()->InternalizeString(string);
+    CHECK(IsInternalizedString(*string));
+    CHECK(string.equals(internal));
+  }
+  CHECK(!released);
+
+  {
+    DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+        isolate->heap());
+    heap::InvokeMajorGC(isolate->heap());
+    heap::InvokeMajorGC(isolate->heap());
+  }
+  CHECK_EQ(0u, table->live_slice_count());
+  CHECK_EQ(0u, table->region_count());
+  CHECK(released);
+}
+
 }  // namespace test_strings
 }  // namespace internal
 }  // namespace v8
@@ -493,4 +493,61 @@ WASM_EXEC_TEST(I32x4DotI8x16I7x16AddS) {
   }
 }
 
+#ifdef V8_ENABLE_WASM_SIMD256_REVEC
+TEST(RunWasmTurbofan_I32x8DotI8x32I7x32AddS) {
+  EXPERIMENTAL_FLAG_SCOPE(revectorize);
+  if (!CpuFeatures::IsSupported(AVX2)) return;
+  WasmRunner<int32_t, int32_t, int32_t, int32_t, int32_t> r(
+      TestExecutionTier::kTurbofan);
+  int32_t* memory = r.builder().AddMemoryElems<int32_t>(32);
+  int8_t* memory_bytes = reinterpret_cast<int8_t*>(memory);
+  // Inputs: 32 lhs bytes at 0, 32 rhs bytes at 32, 8 accumulators at 64;
+  // the 8 results are stored at 96.
+  uint8_t lhs = 0, rhs = 1, acc = 2, dst = 3;
+  uint8_t temp1 = r.AllocateLocal(kWasmS128);
+  uint8_t temp2 = r.AllocateLocal(kWasmS128);
+  constexpr uint8_t offset = 16;
+
+  BUILD_AND_CHECK_REVEC_NODE(
+      r, compiler::IrOpcode::kI32x8DotI8x32I7x32AddS,
+      WASM_LOCAL_SET(temp1,
+                     WASM_SIMD_TERNOP(kExprI32x4DotI8x16I7x16AddS,
+                                      WASM_SIMD_LOAD_MEM(WASM_LOCAL_GET(lhs)),
+                                      WASM_SIMD_LOAD_MEM(WASM_LOCAL_GET(rhs)),
+                                      WASM_SIMD_LOAD_MEM(WASM_LOCAL_GET(acc)))),
+      WASM_LOCAL_SET(
+          temp2,
+          WASM_SIMD_TERNOP(
+              kExprI32x4DotI8x16I7x16AddS,
+              WASM_SIMD_LOAD_MEM_OFFSET(offset, WASM_LOCAL_GET(lhs)),
+              WASM_SIMD_LOAD_MEM_OFFSET(offset, WASM_LOCAL_GET(rhs)),
+              WASM_SIMD_LOAD_MEM_OFFSET(offset, WASM_LOCAL_GET(acc)))),
+      WASM_SIMD_STORE_MEM(WASM_LOCAL_GET(dst), WASM_LOCAL_GET(temp1)),
+      WASM_SIMD_STORE_MEM_OFFSET(offset, WASM_LOCAL_GET(dst),
+                                 WASM_LOCAL_GET(temp2)),
+      WASM_ONE);
+
+  for (int8_t x : compiler::ValueHelper::GetVector<int8_t>()) {
+    for (int8_t y : compiler::ValueHelper::GetVector<int8_t>()) {
+      for (int32_t z : compiler::ValueHelper::GetVector<int32_t>()) {
+        for (int i = 0; i < 32; i++) {
+          r.builder().WriteMemory(&memory_bytes[i], x);
+          r.builder().WriteMemory(&memory_bytes[32 + i],
+                                  static_cast<int8_t>(y & 0x7F));
+        }
+        for (int i = 0; i < 8; i++) {
+          r.builder().WriteMemory(&memory[16 + i], z);
+        }
+        r.Call(0, 32, 64, 96);
+        int32_t expected = base::AddWithWraparound(
+            base::MulWithWraparound(x * (y & 0x7F), 4), z);
+        for (int i = 0; i < 8; i++) {
+          CHECK_EQ(expected, memory[24 + i]);
+        }
+      }
+    }
+  }
+}
+#endif  // V8_ENABLE_WASM_SIMD256_REVEC
+
 }  // namespace v8::internal::wasm
@@ -11,6 +11,7 @@
 #include "src/snapshot/code-serializer.h"
 #include "src/utils/version.h"
 #include "src/wasm/module-decoder.h"
+#include "src/wasm/wasm-code-cache-store.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-module-builder.h"
 #include "src/wasm/wasm-module.h"
@@ -352,6 +353,61 @@ TEST(TierDownAfterDeserialization) {
   CHECK_NULL(native_module->GetCode(0));
 }
 
+TEST(LazyDeserialization) {
+  WasmSerializationTest test;
+  FlagScope<bool> lazy_deserialization(&v8_flags.wasm_lazy_deserialization,
+                                       true);
+
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  Handle<WasmModuleObject> module_object;
+  CHECK(test.Deserialize().ToHandle(&module_object));
+
+  auto* native_module = module_object->native_module();
+  CHECK_NOT_NULL(native_module->lazily_deserialized_code());
+  {
+    WasmCodeRefScope code_ref_scope;
+    // The serialized TurboFan code is only materialized on the first call.
+    CHECK_NULL(native_module->GetCode(2));
+  }
+
+  test.DeserializeAndRun();
+
+  WasmCodeRefScope code_ref_scope;
+  auto* turbofan_code = native_module->GetCode(2);
+  CHECK_NOT_NULL(turbofan_code);
+  CHECK_EQ(ExecutionTier::kTurbofan, turbofan_code->tier());
+}
+
+TEST(CodeCacheStore) {
+  WasmSerializationTest test;
+  FlagScope<const char*> code_cache_dir(&v8_flags.wasm_code_cache_dir, ".");
+  FlagScope<unsigned> max_entries(&v8_flags.wasm_code_cache_dir_max_entries,
+                                  1);
+
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  Handle<WasmModuleObject> module_object;
+  CHECK(test.Deserialize().ToHandle(&module_object));
+  base::Vector<const uint8_t> wire_bytes =
+      module_object->native_module()->wire_bytes();
+
+  WasmCodeCacheStore::Store(module_object->native_module());
+  std::unique_ptr<WasmCodeCacheStore::Entry> entry =
+      WasmCodeCacheStore::Lookup(wire_bytes);
+  CHECK_NOT_NULL(entry);
+  CHECK(DeserializeNativeModule(isolate, entry->data(), wire_bytes, {})
+            .ToHandle(&module_object));
+
+  // An entry for other wire bytes in the same slot is not used.
+  std::vector<uint8_t> other_wire_bytes(wire_bytes.begin(), wire_bytes.end());
+  other_wire_bytes.push_back(0);
+  CHECK_NULL(WasmCodeCacheStore::Lookup(base::VectorOf(other_wire_bytes)));
+
+  WasmCodeCacheStore::Remove(wire_bytes);
+  CHECK_NULL(WasmCodeCacheStore::Lookup(wire_bytes));
+}
+
 TEST(SerializeLiftoffModuleFails) {
   // Make sure that no function is tiered up to TurboFan.
   if (!v8_flags.liftoff) return;
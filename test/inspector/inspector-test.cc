@@ -499,6 +499,9 @@ class InspectorExtension : public InspectorIsolateData::SetupGlobalTask {
     inspector->Set(isolate, "addInspectedObject",
                    v8::FunctionTemplate::New(
                        isolate, &InspectorExtension::AddInspectedObject));
+    inspector->Set(isolate, "setConsolePreviewBudget",
+                   v8::FunctionTemplate::New(
+                       isolate, &InspectorExtension::SetConsolePreviewBudget));
     inspector->Set(isolate, "setMaxAsyncTaskStacks",
                    v8::FunctionTemplate::New(
                        isolate, &InspectorExtension::SetMaxAsyncTaskStacks));
@@ -587,6 +590,17 @@ class InspectorExtension : public InspectorIsolateData::SetupGlobalTask {
     data->AddInspectedObject(info[0].As<v8::Int32>()->Value(), info[1]);
   }
 
+  static void SetConsolePreviewBudget(
+      const v8::FunctionCallbackInfo<v8::Value>& info) {
+    if (info.Length() != 2 || !info[0]->IsInt32() || !info[1]->IsInt32()) {
+      FATAL("Internal error: setConsolePreviewBudget(session_id, max).");
+    }
+    v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
+    InspectorIsolateData* data = InspectorIsolateData::FromContext(context);
+    data->SetConsolePreviewBudget(info[0].As<v8::Int32>()->Value(),
+                                  info[1].As<v8::Int32>()->Value());
+  }
+
   static void SetMaxAsyncTaskStacks(
       const v8::FunctionCallbackInfo<v8::Value>& info) {
     if (info.Length() != 1 || !info[0]->IsInt32()) {
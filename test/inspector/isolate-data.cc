@@ -332,6 +332,13 @@ void InspectorIsolateData::AddInspectedObject(int session_id,
   it->second->addInspectedObject(std::move(inspectable));
 }
 
+void InspectorIsolateData::SetConsolePreviewBudget(int session_id,
+                                                   int max_preview_properties) {
+  auto it = sessions_.find(session_id);
+  if (it == sessions_.end()) return;
+  it->second->setConsolePreviewBudget(max_preview_properties);
+}
+
 void InspectorIsolateData::SetMaxAsyncTaskStacksForTest(int limit) {
   v8::SealHandleScope seal_handle_scope(isolate());
   v8_inspector::SetMaxAsyncTaskStacksForTest(inspector_.get(), limit);
@@ -90,6 +90,7 @@ class InspectorIsolateData : public v8_inspector::V8InspectorClient {
   void ExternalAsyncTaskFinished(const v8_inspector::V8StackTraceId& parent);
 
   void AddInspectedObject(int session_id, v8::Local<v8::Value> object);
+  void SetConsolePreviewBudget(int session_id, int max_preview_properties);
 
   // Test utilities.
   void SetCurrentTimeMS(double time);
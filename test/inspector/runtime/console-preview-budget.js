@@ -0,0 +1,42 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+let {session, contextGroup, Protocol} = InspectorTest.start(
+    'Checks that the console preview budget caps previews per message.');
+
+(async function test() {
+  await Protocol.Runtime.enable();
+  InspectorTest.log('Without budget');
+  await logArguments();
+
+  InspectorTest.log('With budget of 3 properties');
+  await setBudget(3);
+  await logArguments();
+
+  InspectorTest.log('Budget removed');
+  await setBudget(-1);
+  await logArguments();
+  InspectorTest.completeTest();
+})();
+
+function setBudget(budget) {
+  return Protocol.Runtime.evaluate({
+    expression: `inspector.setConsolePreviewBudget(${session.id}, ${budget})`
+  });
+}
+
+async function logArguments() {
+  Protocol.Runtime.evaluate(
+      {expression: 'console.log({a: 1, b: 2}, {c: 3, d: 4}, [5, 6])'});
+  const {params: {args}} = await Protocol.Runtime.onceConsoleAPICalled();
+  for (const arg of args) {
+    if (!arg.preview) {
+      InspectorTest.log(`${arg.description}: no preview`);
+      continue;
+    }
+    const overflow = arg.preview.overflow ? ', overflow' : '';
+    InspectorTest.log(`${arg.description}: ${
+        arg.preview.properties.length} properties${overflow}`);
+  }
+}
@@ -0,0 +1,42 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Collators created with default options for fast-path locales compare ASCII
+// strings without ICU; the results must match the full comparison.
+
+const strings = [
+  "", "a", "A", "b", "B", "ab", "aB", "Ab", "a b", "a-b", "a_b", "a1", "a10",
+  "a2", "-", "_", " ", "\t", "\u0001", "a\u0001", "z", "Z", "zz", "ä", "ä",
+  "Å", "Å", "ß", "ss", "SS", "æ", "ae", "ñ", "ñ", "ÿ",
+  "y", "µ", "ʼn", "abcé", "abce", "abcf",
+];
+
+function Sign(x) { return x < 0 ? -1 : x > 0 ? 1 : 0; }
+
+for (const locale of [undefined, "en", "en-US", "de", "fr", "pl"]) {
+  const fast = new Intl.Collator(locale);
+  // Any option opts out of the fast path.
+  const slow = new Intl.Collator(locale, {usage: "sort"});
+  for (const a of strings) {
+    for (const b of strings) {
+      const expected = Sign(slow.compare(a, b));
+      assertEquals(expected, Sign(fast.compare(a, b)), `${locale}: ${a} ${b}`);
+      assertEquals(expected, Sign(a.localeCompare(b, locale)),
+                   `${locale}: ${a} ${b}`);
+    }
+  }
+}
+
+// Latin-1 case conversion takes a vectorized path for longer strings.
+let latin1 = "";
+for (let i = 0; i < 256; i++) latin1 += String.fromCharCode(i);
+for (let i = 0; i < 40; i++) {
+  const s = latin1.substring(i) + latin1.substring(0, i);
+  const lower = s.toLowerCase();
+  const upper = s.toUpperCase();
+  for (let j = 0; j < s.length; j++) {
+    assertEquals(s[j].toLowerCase(), lower[j]);
+  }
+  assertEquals(s.split("").map(c => c.toUpperCase()).join(""), upper);
+}
@@ -0,0 +1,27 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Number.prototype.toLocaleString caches formatters for many locales and
+// formats small integers in English without ICU; both have to agree with a
+// freshly constructed Intl.NumberFormat.
+
+const numbers = [0, 7, 999, 1000, -1000, 123456, -1234567, 2 ** 30 - 1,
+                 -(2 ** 30), 2 ** 31 - 1, -(2 ** 31), 1234.5678, -0, NaN];
+const locales = ["en", "en-US", "en-GB", "en-IN", "de", "fr", "ar", "hi", "ja",
+                 "zh", "ru", "es", "pt-BR", "it", "ko", "th-TH-u-nu-thai"];
+
+for (let round = 0; round < 3; round++) {
+  for (const locale of locales) {
+    const format = new Intl.NumberFormat(locale);
+    for (const n of numbers) {
+      assertEquals(format.format(n), n.toLocaleString(locale),
+                   locale + " " + n);
+    }
+  }
+}
+
+const defaultFormat = new Intl.NumberFormat();
+for (const n of numbers) {
+  assertEquals(defaultFormat.format(n), n.toLocaleString());
+}
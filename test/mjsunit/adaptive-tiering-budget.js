@@ -0,0 +1,27 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --adaptive-tiering-budget
+// Flags: --trace-adaptive-tiering-budget
+// Flags: --adaptive-tiering-budget-maglev-target-ms=0.001
+// Flags: --adaptive-tiering-budget-turbofan-target-ms=0.001
+
+// Tiny targets make every compile count as expensive, which drives the
+// budgets to their upper bound. Functions must still tier up and compute the
+// same results.
+function add(a, b) {
+  return a + b;
+}
+
+%PrepareFunctionForOptimization(add);
+assertEquals(3, add(1, 2));
+%OptimizeMaglevOnNextCall(add);
+assertEquals(5, add(2, 3));
+%PrepareFunctionForOptimization(add);
+%OptimizeFunctionOnNextCall(add);
+assertEquals(7, add(3, 4));
+
+let sum = 0;
+for (let i = 0; i < 10000; i++) sum = add(sum, 1);
+assertEquals(10000, sum);
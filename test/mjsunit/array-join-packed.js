@@ -0,0 +1,56 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Packed arrays of strings and Smis are joined in two passes directly from
+// their elements. Compare against a join built with string concatenation.
+
+function slowJoin(array, sep = ',') {
+  let result = '';
+  for (let i = 0; i < array.length; i++) {
+    if (i > 0) result += sep;
+    const element = array[i];
+    if (element !== undefined && element !== null) result += String(element);
+  }
+  return result;
+}
+
+function check(array, sep) {
+  assertEquals(slowJoin(array, sep), array.join(sep));
+}
+
+for (const sep of [undefined, '', ',', '\t', ' | ', ' ', '\u{1F600}']) {
+  check([], sep);
+  check([1], sep);
+  check(['a'], sep);
+  check([''], sep);
+  check(['', ''], sep);
+  check([0, -1, 1, 9, 10, 99, 100, -10, 1073741823, -1073741824], sep);
+  check(['a', 1, 'bc', -20, ''], sep);
+  check(['é', 12, '☃', 'x'], sep);
+  check(['ab' + 'cd'.repeat(10), 3], sep);
+}
+
+// Single string elements are returned as is.
+const s = 'x'.repeat(100);
+assertSame(s, [s].join());
+assertSame(s, [s].join('-'));
+
+// Arrays with other elements use the generic path.
+check([1.5, 'a', 2], ',');
+check(['a', undefined, null, 'b'], ',');
+check([{toString() { return 'obj'; }}, 1], ',');
+const holey = ['a', , 'b'];
+assertEquals('a,,b', holey.join());
+assertThrows(() => [Symbol(), 'a'].join(), TypeError);
+
+// Cyclic arrays.
+const cyclic = [1, 'a'];
+cyclic.push(cyclic);
+assertEquals('1,a,', cyclic.join());
+
+// Large arrays, as produced by CSV exporters.
+const row = [];
+for (let i = 0; i < 100000; i++) row.push(i % 3 == 0 ? 'field' + i : i - 50000);
+check(row, ',');
+check(row, '');
@@ -81,3 +81,34 @@ testHasPropertyThenGet(undefined);
   Array.prototype.lastIndexOf.call(array, 0);
   assertEquals(1,count);
 })();
+
+// Elements are compared per elements kind without going through the generic
+// strict equality where possible.
+(function testFastPathsByElementsKind() {
+  // PACKED_SMI_ELEMENTS and HOLEY_SMI_ELEMENTS.
+  assertEquals(2, [1, 2, 1, 3].lastIndexOf(1));
+  assertEquals(-1, [1, 2, 3].lastIndexOf("1"));
+  assertEquals(1, [1, 2, 3].lastIndexOf(2.0));
+  assertEquals(-1, [1, , 3].lastIndexOf(undefined));
+
+  // PACKED_DOUBLE_ELEMENTS and HOLEY_DOUBLE_ELEMENTS.
+  assertEquals(2, [1.5, 2.5, 1.5].lastIndexOf(1.5));
+  assertEquals(1, [1.5, 2, 3.5].lastIndexOf(2));
+  assertEquals(-1, [1.5, NaN, 3.5].lastIndexOf(NaN));
+  assertEquals(1, [1.5, -0, 3.5].lastIndexOf(0));
+  assertEquals(1, [1.5, 0, 3.5].lastIndexOf(-0));
+  assertEquals(-1, [1.5, 2.5].lastIndexOf("1.5"));
+  assertEquals(-1, [1.5, , 3.5].lastIndexOf(undefined));
+
+  // PACKED_ELEMENTS and HOLEY_ELEMENTS.
+  const o = {};
+  const s = Symbol();
+  assertEquals(3, [o, s, null, o, 1].lastIndexOf(o));
+  assertEquals(1, [o, s, null].lastIndexOf(s));
+  assertEquals(2, [o, s, null].lastIndexOf(null));
+  assertEquals(-1, [o, , null].lastIndexOf(undefined));
+  assertEquals(0, [1.5, o].lastIndexOf(1.5));
+  assertEquals(0, [3, o].lastIndexOf(3.0));
+  assertEquals(1, [o, "a" + "b"].lastIndexOf("ab"));
+  assertEquals(0, [10n, o].lastIndexOf(10n));
+})();
@@ -0,0 +1,60 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Shifting arrays whose backing store lives in large object space moves the
+// remaining elements to a regular backing store once they fit, so that later
+// shifts can left-trim. Check that no elements are lost or reordered.
+
+function checkShifts(array, expected) {
+  const length = array.length;
+  for (let i = 0; i < length; i++) {
+    assertEquals(expected(i), array.shift(), `element ${i}`);
+  }
+  assertEquals(0, array.length);
+}
+
+(function SmiElements() {
+  const array = [];
+  for (let i = 0; i < 34000; i++) array.push(i);
+  checkShifts(array, i => i);
+})();
+
+(function DoubleElements() {
+  const array = [];
+  for (let i = 0; i < 17000; i++) array.push(i + 0.5);
+  checkShifts(array, i => i + 0.5);
+})();
+
+(function Queue() {
+  // Interleave pushes, as queue-style code does.
+  const array = [];
+  let pushed = 0;
+  while (pushed < 34000) array.push(pushed++);
+  for (let shifted = 0; shifted < pushed; shifted++) {
+    assertEquals(shifted, array.shift());
+    if (shifted % 1000 == 0 && pushed < 40000) array.push(pushed++);
+  }
+  assertEquals(0, array.length);
+})();
+
+(function ObjectElements() {
+  const array = [];
+  for (let i = 0; i < 34000; i++) array.push({value: i});
+  let next = 0;
+  while (array.length > 0) {
+    assertEquals(next++, array.shift().value);
+  }
+  assertEquals(34000, next);
+})();
+
+(function HoleyElements() {
+  const array = [];
+  for (let i = 0; i < 34000; i++) array.push(i);
+  delete array[20000];
+  for (let i = 0; i < 34000; i++) {
+    const value = array.shift();
+    assertEquals(i == 20000 ? undefined : i, value);
+  }
+  assertEquals(0, array.length);
+})();
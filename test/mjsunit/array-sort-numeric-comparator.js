@@ -0,0 +1,74 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Array.prototype.sort skips calling plain numeric comparators on packed
+// number arrays. Check that the result matches the generic sort.
+
+const asc = (a, b) => a - b;
+const desc = (a, b) => b - a;
+function ascFunction(a, b) { return a - b; }
+// Same result, but not recognized as a numeric comparator.
+const ascSlow = (a, b) => a < b ? -1 : a > b ? 1 : 0;
+
+function check(input, comparator, slow) {
+  const expected = input.slice().sort(slow);
+  const actual = input.slice().sort(comparator);
+  assertEquals(expected.length, actual.length);
+  for (let i = 0; i < expected.length; i++) {
+    assertTrue(Object.is(expected[i], actual[i]), `index ${i}`);
+  }
+}
+
+const ascSlowReversed = (a, b) => ascSlow(b, a);
+
+// Packed Smis, including copy-on-write literals.
+check([3, 1, 2], asc, ascSlow);
+check([3, 1, 2], desc, ascSlowReversed);
+check([5, -1, 0, 1073741823, -1073741824, 5, 2], ascFunction, ascSlow);
+const literal = [9, 8, 7, 6, 5, 4, 3, 2, 1];
+literal.sort(asc);
+assertEquals([1, 2, 3, 4, 5, 6, 7, 8, 9], literal);
+assertEquals([9, 8, 7, 6, 5, 4, 3, 2, 1], [9, 8, 7, 6, 5, 4, 3, 2, 1]);
+
+// Packed doubles, including infinities and signed zeros, whose relative order
+// must be kept.
+check([1.5, -0, 0, -Infinity, Infinity, 0, -0, 2.25, -3.5], asc, ascSlow);
+check([1.5, -0, 0, -Infinity, Infinity, 0, -0, 2.25, -3.5], desc,
+      ascSlowReversed);
+
+// NaN makes the comparator inconsistent; the generic sort handles it.
+const withNaN = [3.5, NaN, 1.5, 2.5];
+withNaN.sort(asc);
+assertEquals(4, withNaN.length);
+assertTrue(withNaN.some(Number.isNaN));
+
+// Larger random inputs.
+let seed = 1;
+function random() {
+  seed = (seed * 16807) % 2147483647;
+  return seed;
+}
+const smis = [];
+const doubles = [];
+for (let i = 0; i < 1000; i++) {
+  smis.push(random() % 100);
+  doubles.push((random() % 1000) / 8);
+}
+check(smis, asc, ascSlow);
+check(smis, desc, ascSlowReversed);
+check(doubles, asc, ascSlow);
+check(doubles, desc, ascSlowReversed);
+
+// Holey arrays and non-number elements still go through the generic sort.
+const holey = [3, , 1, 2];
+holey.sort(asc);
+assertEquals([1, 2, 3], holey.slice(0, 3));
+assertEquals(4, holey.length);
+assertFalse(3 in holey);
+check(['3', 1, '2'], asc, ascSlow);
+
+// Comparators with other bodies are still called.
+let calls = 0;
+[3, 1, 2].sort((a, b) => { calls++; return a - b; });
+assertTrue(calls > 0);
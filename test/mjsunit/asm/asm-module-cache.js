@@ -0,0 +1,65 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+const kModuleSource = `
+function Module(stdlib, foreign, heap) {
+  "use asm";
+  var fn = foreign.fn;
+  function add(a, b) {
+    a = a | 0;
+    b = b | 0;
+    return (a + b) | 0;
+  }
+  function callFn() {
+    fn();
+  }
+  return { add: add, callFn: callFn };
+}`;
+
+function thrower() {
+  throw new Error('from foreign');
+}
+
+function checkModule(Module, line) {
+  assertTrue(%IsAsmWasmCode(Module));
+  const m = Module(this, {fn: thrower});
+  assertEquals(5, m.add(2, 3));
+  try {
+    m.callFn();
+    assertUnreachable();
+  } catch (e) {
+    // The source position of the call must refer to this copy of the module.
+    assertMatches(new RegExp(`callFn.*:${line}:`), e.stack);
+  }
+}
+
+(function TestSameSourceInRealms() {
+  // Identical scripts in different realms translate to identical modules,
+  // which are shared.
+  for (let i = 0; i < 2; ++i) {
+    const realm = Realm.create();
+    Realm.eval(realm, kModuleSource);
+    const Module = Realm.global(realm).Module;
+    assertTrue(%IsAsmWasmCode(Module));
+    const m = Module(Realm.global(realm), {fn: () => {}});
+    assertEquals(7, m.add(3, 4));
+  }
+})();
+
+(function TestSameSourceRepeatedly() {
+  checkModule(eval(`(${kModuleSource})`), 11);
+  checkModule(eval(`(${kModuleSource})`), 11);
+})();
+
+(function TestDifferentPositions() {
+  // The same module at a different position must report its own positions.
+  checkModule(eval(`\n\n(${kModuleSource})`), 13);
+})();
+
+(function TestStrictAndSloppy() {
+  checkModule(eval(`(${kModuleSource})`), 11);
+  checkModule(eval(`'use strict';(${kModuleSource})`), 11);
+})();
@@ -0,0 +1,80 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// The closures that resume an async function after an await are created on
+// its first await and reused by the later ones. Check that resumption still
+// delivers the right values and exceptions to the right activation.
+
+async function sum(n, delay) {
+  let total = 0;
+  for (let i = 0; i < n; i++) {
+    total += await (delay ? Promise.resolve(i) : i);
+  }
+  return total;
+}
+
+async function catchAll(n) {
+  const caught = [];
+  for (let i = 0; i < n; i++) {
+    try {
+      if (i % 2) await Promise.reject(i);
+      await i;
+    } catch (e) {
+      caught.push(e);
+    }
+  }
+  return caught;
+}
+
+async function thenables(n) {
+  let total = 0;
+  for (let i = 0; i < n; i++) {
+    total += await { then(resolve) { resolve(i); } };
+  }
+  return total;
+}
+
+let results = [];
+function check() {
+  %PerformMicrotaskCheckpoint();
+  assertEquals([45, 45, 45, 4950, [1, 3, 5, 7, 9], 45, 'done'], results);
+  results = [];
+}
+
+function run() {
+  // Several activations of the same functions are suspended at the same time,
+  // each one must be resumed with its own values.
+  const promises = [
+    sum(10, false), sum(10, true), sum(10, false), sum(100, true),
+    catchAll(10), thenables(10),
+    (async () => { await null; await undefined; return 'done'; })()
+  ];
+  Promise.all(promises).then(r => { results = r; });
+}
+
+%PrepareFunctionForOptimization(sum);
+%PrepareFunctionForOptimization(catchAll);
+%PrepareFunctionForOptimization(thenables);
+run();
+check();
+run();
+check();
+%OptimizeFunctionOnNextCall(sum);
+%OptimizeFunctionOnNextCall(catchAll);
+%OptimizeFunctionOnNextCall(thenables);
+run();
+check();
+
+// An exception thrown after the first await rejects the result.
+async function throwsLater() {
+  await 1;
+  await 2;
+  throw new Error('later');
+}
+let error;
+throwsLater().catch(e => { error = e; });
+%PerformMicrotaskCheckpoint();
+assertEquals('later', error.message);
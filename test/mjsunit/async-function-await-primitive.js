@@ -0,0 +1,66 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Awaiting a value that is not an object schedules the continuation without
+// creating a wrapper promise. Check that this takes exactly one tick, like
+// awaiting a native promise, and that values are passed through unchanged.
+
+const log = [];
+
+async function awaitValues() {
+  for (const value of [1, 1.5, 'str', undefined, null, true, 10n,
+                       Symbol.for('sym')]) {
+    log.push(await value);
+  }
+}
+
+async function awaitPromises() {
+  for (let i = 0; i < 8; i++) {
+    await Promise.resolve();
+    log.push('promise');
+  }
+}
+
+function ticks() {
+  let p = Promise.resolve();
+  for (let i = 0; i < 8; i++) {
+    p = p.then(() => log.push('tick'));
+  }
+}
+
+function run() {
+  log.length = 0;
+  ticks();
+  awaitValues();
+  awaitPromises();
+  %PerformMicrotaskCheckpoint();
+  const expected = [];
+  const values = [1, 1.5, 'str', undefined, null, true, 10n,
+                  Symbol.for('sym')];
+  for (let i = 0; i < 8; i++) expected.push('tick', values[i], 'promise');
+  assertEquals(expected, log);
+}
+
+%PrepareFunctionForOptimization(awaitValues);
+%PrepareFunctionForOptimization(awaitPromises);
+run();
+run();
+%OptimizeFunctionOnNextCall(awaitValues);
+%OptimizeFunctionOnNextCall(awaitPromises);
+run();
+
+// Objects are still checked for a "then" method.
+(function() {
+  let calls = 0;
+  async function awaitThenable() {
+    return await { then(resolve) { calls++; resolve(42); } };
+  }
+  let result;
+  awaitThenable().then(v => result = v);
+  %PerformMicrotaskCheckpoint();
+  assertEquals(1, calls);
+  assertEquals(42, result);
+})();
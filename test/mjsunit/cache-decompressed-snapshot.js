@@ -0,0 +1,18 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --cache-decompressed-snapshot
+
+// Contexts created after the first one reuse the decompressed context
+// snapshot. Check that they are still fully set up and independent.
+for (let i = 0; i < 5; i++) {
+  const realm = Realm.create();
+  assertEquals(3, Realm.eval(realm, '[1, 2, 3].length'));
+  assertEquals('function', Realm.eval(realm, 'typeof Array.prototype.map'));
+  Realm.eval(realm, 'globalThis.marker = ' + i);
+  assertEquals(i, Realm.eval(realm, 'marker'));
+  assertFalse(Realm.global(realm).Array === Array);
+  Realm.dispose(realm);
+}
+assertEquals(undefined, globalThis.marker);
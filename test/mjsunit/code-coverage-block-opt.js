@@ -3,7 +3,7 @@
 // found in the LICENSE file.
 
 // Flags: --allow-natives-syntax --no-always-turbofan --turbofan
-// Flags: --no-stress-flush-code --turbo-inlining
+// Flags: --no-stress-flush-code --turbo-inlining --maglev
 // Flags: --expose-gc
 // Files: test/mjsunit/code-coverage-utils.js
 
@@ -30,6 +30,20 @@ f(); f(); f(); f(); f(); f();             // 0200
       {"start":50,"end":76,"count":8} ]
   );
 
+  await TestCoverage(
+    "maglev-compiled function",
+    `
+function g(x) { if (x) nop(); }           // 0000
+%PrepareFunctionForOptimization(g);       // 0050
+g(true); g(false);                        // 0100
+%OptimizeMaglevOnNextCall(g);             // 0150
+g(true); g(true); g(false);               // 0200
+    `,
+    [ {"start":0,"end":249,"count":1},
+      {"start":0,"end":31,"count":5},
+      {"start":23,"end":29,"count":3} ]
+  );
+
   // This test is tricky: it requires a non-toplevel, optimized function.
   // After initial collection, counts are cleared. Further invocation_counts
   // are not collected for optimized functions, and on the next coverage
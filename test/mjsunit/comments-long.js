@@ -0,0 +1,33 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Long comments with line terminators and '*' at varying offsets.
+
+(function TestSingleLineComments() {
+  const terminators = ['\n', '\r', '\u2028', '\u2029'];
+  for (const terminator of terminators) {
+    for (let length = 0; length < 40; length++) {
+      const body = 'x'.repeat(length) + '\u2027\u202a\u0a0a';
+      assertEquals(length, eval(`// ${body}${terminator}${length}`));
+    }
+  }
+})();
+
+(function TestMultiLineComments() {
+  for (let length = 0; length < 40; length++) {
+    const body = 'y'.repeat(length);
+    assertEquals(1, eval(`/* ${body} * ${body} */ 1`));
+    // No line terminator before '*/', so the return value is still 2.
+    assertEquals(2, (0, eval)(`(function() { return /* ${body} */ 2; })()`));
+    // A line terminator inside the comment triggers ASI after 'return'.
+    assertEquals(undefined,
+                 eval(`(function() { return /* ${body}\n${body} */ 3; })()`));
+    assertEquals(undefined,
+                 eval(`(function() { return /* ${body}\u2028 */ 4; })()`));
+    assertThrows(() => eval(`/* ${body} *`), SyntaxError);
+  }
+  const license =
+      '/*!\n' + ' * Licensed under the MIT license.\n'.repeat(1000) + ' */ 5';
+  assertEquals(5, eval(license));
+})();
@@ -0,0 +1,55 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-turbo-inlining --no-maglev-inlining
+
+// Optimized code may call a known, still interpreted function through the
+// InterpreterEntryTrampoline directly. Such calls have to keep working when the
+// callee tiers up or loses its bytecode afterwards.
+
+function callee(a, b) {
+  return a + b;
+}
+%NeverOptimizeFunction(callee);
+
+function caller(x) {
+  return callee(x, 1) + callee(x);
+}
+
+%PrepareFunctionForOptimization(caller);
+assertEquals(NaN, caller(1));
+assertEquals(NaN, caller(2));
+%OptimizeFunctionOnNextCall(caller);
+assertEquals(NaN, caller(3));
+
+function callee2(a, b) {
+  return a * (b === undefined ? 2 : b);
+}
+
+function caller2(x) {
+  return callee2(x) + callee2(x, 3, 4);
+}
+
+%PrepareFunctionForOptimization(caller2);
+assertEquals(5 * 2 + 5 * 3, caller2(5));
+%OptimizeFunctionOnNextCall(caller2);
+assertEquals(7 * 2 + 7 * 3, caller2(7));
+
+// Tier up the callee while the caller keeps its code.
+%PrepareFunctionForOptimization(callee2);
+callee2(1);
+%OptimizeFunctionOnNextCall(callee2);
+callee2(1);
+assertEquals(9 * 2 + 9 * 3, caller2(9));
+%DeoptimizeFunction(callee2);
+assertEquals(11 * 2 + 11 * 3, caller2(11));
+
+// Maglev callers.
+function caller3(x) {
+  return callee2(x, x);
+}
+%PrepareFunctionForOptimization(caller3);
+assertEquals(4, caller3(2));
+%OptimizeMaglevOnNextCall(caller3);
+assertEquals(9, caller3(3));
@@ -32,3 +32,39 @@
   assertEquals("first", f(0));
   assertEquals("second", f(1));
 })();
+
+// Test variable index access to array with 4 elements.
+(function testFourElementArrayVariableIndex() {
+  function f(i) {
+    const a = ["first", "second", "third", "fourth"];
+    return a[i];
+  }
+
+  %PrepareFunctionForOptimization(f);
+  for (let i = 0; i < 4; ++i) f(i);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals("first", f(0));
+  assertEquals("second", f(1));
+  assertEquals("third", f(2));
+  assertEquals("fourth", f(3));
+})();
+
+// Test tuple-returning helpers destructured with a variable index.
+(function testInlinedTupleVariableIndex() {
+  function pair(a, b) {
+    return [a, b, a + b];
+  }
+  function f(x, y, i) {
+    const t = pair(x, y);
+    return t[i & 1] + t[2];
+  }
+
+  %PrepareFunctionForOptimization(pair);
+  %PrepareFunctionForOptimization(f);
+  assertEquals(4, f(1, 2, 0));
+  assertEquals(5, f(1, 2, 1));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(4, f(1, 2, 0));
+  assertEquals(5, f(1, 2, 1));
+  assertEquals(33, f(10, 20, 3));
+})();
@@ -0,0 +1,72 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// This file excercises two byte string support for fast API calls.
+
+// Flags: --turbo-fast-api-calls --expose-fast-api --allow-natives-syntax --turbofan
+// --always-turbofan is disabled because we rely on particular feedback for
+// optimizing to the fastest path.
+// Flags: --no-always-turbofan
+// The test relies on optimizing/deoptimizing at predictable moments, so
+// it's not suitable for deoptimization fuzzing.
+// Flags: --deopt-every-n-times=0
+
+const fast_c_api = new d8.test.FastCAPI();
+
+function toBytes(input) {
+  const code_units = Uint16Array.from(input, c => c.charCodeAt(0));
+  return new Uint8Array(code_units.buffer);
+}
+
+function assertSlowCall(input) {
+  assertEquals(new Uint8Array(input.length * 2), copy_string(false, input));
+}
+
+function assertFastCall(input) {
+  assertEquals(toBytes(input), copy_string(false, input));
+}
+
+function copy_string(should_fallback = false, input) {
+  const buffer = new Uint8Array(input.length * 2);
+  fast_c_api.copy_two_byte_string(should_fallback, input, buffer);
+  return buffer;
+}
+
+%PrepareFunctionForOptimization(copy_string);
+assertSlowCall('ሴt');
+%OptimizeFunctionOnNextCall(copy_string);
+
+fast_c_api.reset_counts();
+assertFastCall('ሴt');
+assertFastCall('नमस्ते');
+assertFastCall(['नमस्ते', 'World'].join(''));
+assertOptimized(copy_string);
+assertEquals(3, fast_c_api.fast_call_count());
+assertEquals(0, fast_c_api.slow_call_count());
+
+// Fall back for one byte strings.
+fast_c_api.reset_counts();
+assertSlowCall('Hello');
+assertSlowCall('');
+assertOptimized(copy_string);
+assertEquals(0, fast_c_api.fast_call_count());
+assertEquals(2, fast_c_api.slow_call_count());
+
+// Fall back for cons strings.
+function getCons() {
+  // Long enough not to be flattened eagerly.
+  return 'hello, world: ' + String.fromCharCode(0x1234);
+}
+fast_c_api.reset_counts();
+assertSlowCall(getCons());
+assertOptimized(copy_string);
+assertEquals(0, fast_c_api.fast_call_count());
+assertEquals(1, fast_c_api.slow_call_count());
+
+// Fall back for SMI and non-string inputs.
+fast_c_api.reset_counts();
+assertSlowCall(1);
+assertSlowCall({});
+assertEquals(0, fast_c_api.fast_call_count());
+assertEquals(2, fast_c_api.slow_call_count());
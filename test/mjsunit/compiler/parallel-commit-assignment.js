@@ -0,0 +1,24 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-parallel-commit-assignment
+// Flags: --turbo-parallel-commit-assignment-min-live-ranges=1
+
+function foo(a, b, c) {
+  let x = a + b;
+  let y = b * c;
+  let z = 0;
+  for (let i = 0; i < a; i++) {
+    z += x * i - y;
+    if (z > 1000) z = z % 97;
+  }
+  return [x, y, z, a + b + c];
+}
+
+%PrepareFunctionForOptimization(foo);
+const expected = foo(10, 3, 7);
+foo(5, 2, 1);
+%OptimizeFunctionOnNextCall(foo);
+assertEquals(expected, foo(10, 3, 7));
+assertOptimized(foo);
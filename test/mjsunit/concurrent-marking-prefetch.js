@@ -0,0 +1,26 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --concurrent-marking --concurrent-marking-prefetch-distance=8
+
+// Build an old-generation object graph that concurrent marking tasks walk with
+// prefetching enabled, and check that nothing reachable is lost.
+let roots = [];
+for (let i = 0; i < 100; i++) {
+  let list = null;
+  for (let j = 0; j < 1000; j++) {
+    list = {value: j, next: list, payload: [i, j]};
+  }
+  roots.push(list);
+}
+gc();
+gc();
+for (let list of roots) {
+  let count = 0;
+  for (let node = list; node; node = node.next) {
+    assertEquals(node.payload[1], node.value);
+    count++;
+  }
+  assertEquals(1000, count);
+}
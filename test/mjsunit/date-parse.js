@@ -317,6 +317,26 @@ for (var i = 0; i < 24 * 365 * 100; i += 150) {
   assertEquals(ms, Date.parse(s), "parse own: " + s);
 }
 
+// Same for the fixed-width ISO format, in UTC, with an offset and in local
+// time.
+function pad2(n) { return String(n).padStart(2, "0"); }
+for (var i = 0; i < 24 * 365 * 100; i += 150) {
+  var ms = i * (3600 * 1000) + i % 1000;
+  var d = new Date(ms);
+  var s = d.toISOString();
+  assertEquals(ms, Date.parse(s), "parse own ISO: " + s);
+  assertEquals(ms + 5400000, Date.parse(s.replace("Z", "-01:30")),
+               "parse own ISO with offset: " + s);
+  var local = d.getFullYear() + "-" + pad2(d.getMonth() + 1) + "-" +
+      pad2(d.getDate()) + "T" + pad2(d.getHours()) + ":" +
+      pad2(d.getMinutes()) + ":" + pad2(d.getSeconds()) + "." +
+      String(d.getMilliseconds()).padStart(3, "0");
+  assertEquals(new Date(d.getFullYear(), d.getMonth(), d.getDate(),
+                        d.getHours(), d.getMinutes(), d.getSeconds(),
+                        d.getMilliseconds()).getTime(),
+               Date.parse(local), "parse own local ISO: " + local);
+}
+
 // Negative tests.
 var testCasesNegative = [
     'May 25 2008 1:30 (PM)) UTC',  // Bad unmatched ')' after number.
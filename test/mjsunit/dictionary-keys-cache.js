@@ -0,0 +1,69 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// The enumerable keys of dictionary-mode objects are cached between calls.
+// Check that every kind of mutation is reflected in the results.
+
+function forInKeys(o) {
+  const keys = [];
+  for (const key in o) keys.push(key);
+  return keys;
+}
+
+function check(expected, o) {
+  assertFalse(%HasFastProperties(o));
+  assertEquals(expected, Object.keys(o));
+  assertEquals(expected, forInKeys(o));
+  assertEquals(expected, Object.entries(o).map(e => e[0]));
+  assertEquals(expected.map(k => o[k]), Object.values(o));
+}
+
+const o = {a: 1, b: 2, c: 3};
+delete o.b;
+check(['a', 'c'], o);
+check(['a', 'c'], o);
+
+// Adding a key.
+o.d = 4;
+check(['a', 'c', 'd'], o);
+
+// Deleting and adding a key keeps the number of elements but not the keys.
+delete o.a;
+o.e = 5;
+check(['c', 'd', 'e'], o);
+
+// Changing enumerability without adding or deleting keys.
+Object.defineProperty(o, 'c', {enumerable: false});
+check(['d', 'e'], o);
+Object.defineProperty(o, 'c', {enumerable: true});
+check(['c', 'd', 'e'], o);
+
+// Changing values keeps the keys.
+o.d = 40;
+check(['c', 'd', 'e'], o);
+
+// The returned arrays are not shared with the cache.
+const keys = Object.keys(o);
+keys[0] = 'x';
+keys.push('y');
+check(['c', 'd', 'e'], o);
+
+// Shadowing through non-enumerable own keys still applies in for-in.
+const proto = {c: 0, p: 1};
+const child = Object.create(proto);
+child.q = 1;
+child.r = 2;
+delete child.q;
+Object.defineProperty(child, 'c', {value: 3, enumerable: false});
+assertFalse(%HasFastProperties(child));
+assertEquals(['r'], Object.keys(child));
+assertEquals(['r', 'p'], forInKeys(child));
+assertEquals(['r', 'p'], forInKeys(child));
+
+// Symbols are never included.
+const s = Symbol('s');
+o[s] = 6;
+check(['c', 'd', 'e'], o);
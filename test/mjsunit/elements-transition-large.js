@@ -0,0 +1,56 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Transitions of backing stores in large object space, which may be converted
+// in place.
+const kLength = 100000;
+
+function MakeSmiArray(holey) {
+  const a = [];
+  for (let i = 0; i < kLength; i++) a.push(i);
+  if (holey) delete a[7];
+  assertTrue(%HasSmiElements(a));
+  return a;
+}
+
+for (const holey of [false, true]) {
+  const a = MakeSmiArray(holey);
+  a[3] = 0.5;
+  assertTrue(%HasDoubleElements(a));
+  assertEquals(holey, %HasHoleyElements(a));
+  assertEquals(kLength, a.length);
+  for (let i = 0; i < kLength; i++) {
+    if (i === 3) {
+      assertEquals(0.5, a[i]);
+    } else if (holey && i === 7) {
+      assertFalse(i in a);
+    } else {
+      assertEquals(i, a[i]);
+    }
+  }
+  a[5] = "x";
+  assertTrue(%HasObjectElements(a));
+  assertEquals(0.5, a[3]);
+  assertEquals("x", a[5]);
+  assertEquals(kLength - 1, a[kLength - 1]);
+  gc();
+  assertEquals(kLength - 2, a[kLength - 2]);
+}
+
+// Pushing doubles into a Smi array may grow and convert it in one go.
+{
+  const a = MakeSmiArray(false);
+  a.push(1.5, 2.5);
+  assertTrue(%HasDoubleElements(a));
+  assertEquals(kLength + 2, a.length);
+  assertEquals(kLength - 1, a[kLength - 1]);
+  assertEquals(1.5, a[kLength]);
+  assertEquals(2.5, a[kLength + 1]);
+  a.unshift({});
+  assertTrue(%HasObjectElements(a));
+  assertEquals(0, a[1]);
+  assertEquals(2.5, a[kLength + 2]);
+}
@@ -0,0 +1,67 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Collections constructed from fast arrays presize their backing store from
+// the array length.
+
+(function TestMapFromArray() {
+  const kCount = 10000;
+  const entries = [];
+  for (let i = 0; i < kCount; i++) entries.push([i, 'v' + i]);
+  const map = new Map(entries);
+  assertEquals(kCount, map.size);
+  let i = 0;
+  for (const [key, value] of map) {
+    assertEquals(i, key);
+    assertEquals('v' + i, value);
+    i++;
+  }
+  map.set(kCount, 'last');
+  assertEquals(kCount + 1, map.size);
+})();
+
+(function TestSetFromArray() {
+  const kCount = 10000;
+  const values = [];
+  for (let i = 0; i < kCount; i++) values.push('s' + i);
+  const set = new Set(values);
+  assertEquals(kCount, set.size);
+  assertEquals(values, [...set]);
+  const doubles = [];
+  for (let i = 0; i < kCount; i++) doubles.push(i + 0.5);
+  assertEquals(doubles, [...new Set(doubles)]);
+})();
+
+(function TestDuplicates() {
+  const kCount = 10000;
+  const set = new Set(new Array(kCount).fill(1));
+  assertEquals(1, set.size);
+  assertTrue(set.has(1));
+  for (let i = 0; i < 100; i++) set.add(i);
+  assertEquals(100, set.size);
+
+  const entries = [];
+  for (let i = 0; i < kCount; i++) entries.push([i % 3, i]);
+  const map = new Map(entries);
+  assertEquals(3, map.size);
+  assertEquals([0, 1, 2], [...map.keys()]);
+  assertEquals([kCount - 1, kCount - 3, kCount - 2], [...map.values()]);
+})();
+
+(function TestSetFromSet() {
+  const source = new Set();
+  for (let i = 0; i < 1000; i++) source.add(i);
+  for (let i = 0; i < 1000; i += 2) source.delete(i);
+  const copy = new Set(source);
+  assertEquals(500, copy.size);
+  assertEquals([...source], [...copy]);
+})();
+
+(function TestSideEffectsFallBack() {
+  const entries = [[1, 1], [2, 2]];
+  const map = new Map(entries);
+  assertEquals(2, map.size);
+  const holey = [, [1, 1]];
+  assertThrows(() => new Map(holey), TypeError);
+})();
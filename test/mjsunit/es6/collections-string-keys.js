@@ -0,0 +1,44 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Lookups with string keys that share a bucket, including keys that are not
+// internalized and keys whose hash has not been computed yet.
+
+(function TestMapStringKeys() {
+  const kCount = 5000;
+  const map = new Map();
+  for (let i = 0; i < kCount; i++) {
+    map.set('key' + i, i);
+  }
+  assertEquals(kCount, map.size);
+  for (let i = 0; i < kCount; i++) {
+    // Build each key anew so it is a different string object.
+    const key = ['k', 'e', 'y'].join('') + String(i);
+    assertTrue(map.has(key));
+    assertEquals(i, map.get(key));
+    assertFalse(map.has(key + 'x'));
+    assertEquals(undefined, map.get('x' + key));
+  }
+  // Integer index strings keep their value in the hash field.
+  map.set('123', 'a');
+  assertEquals('a', map.get(String(100 + 23)));
+  assertFalse(map.has(String(321)));
+})();
+
+(function TestSetStringKeys() {
+  const kCount = 5000;
+  const set = new Set();
+  for (let i = 0; i < kCount; i++) {
+    set.add(String.fromCharCode(0x100 + (i % 64)) + i);
+  }
+  for (let i = 0; i < kCount; i++) {
+    const key = String.fromCharCode(0x100 + (i % 64)) + String(i);
+    assertTrue(set.has(key));
+    assertFalse(set.has(String.fromCharCode(0x101 + (i % 64)) + String(i)));
+  }
+  for (let i = 0; i < kCount; i += 2) {
+    assertTrue(set.delete('' + String.fromCharCode(0x100 + (i % 64)) + i));
+  }
+  assertEquals(kCount / 2, set.size);
+})();
@@ -0,0 +1,53 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --typed-array-parallel-copy-threshold=1
+
+// Large copies between non-overlapping typed arrays are split into chunks that
+// are copied on worker threads. Check a sample of the copied bytes, including
+// the unaligned tail.
+
+const kLength = 33 * 1024 * 1024 + 5;
+const kStride = 4093;
+
+function value(i) {
+  return (i * 31 + 7) & 0xff;
+}
+
+const source = new Uint8Array(kLength);
+for (let i = 0; i < kLength; i += kStride) source[i] = value(i);
+source[kLength - 1] = value(kLength - 1);
+
+function check(array, offset) {
+  for (let i = 0; i + offset < array.length; i += kStride) {
+    assertEquals(value(i), array[i + offset], `index ${i}`);
+  }
+  assertEquals(value(kLength - 1), array[kLength - 1 + offset]);
+}
+
+// TypedArray.prototype.set with the same element type.
+const target = new Uint8Array(kLength + 3);
+target.set(source, 3);
+check(target, 3);
+assertEquals(0, target[0]);
+
+// TypedArray.prototype.slice.
+check(source.slice(), 0);
+
+// Constructing from a typed array of the same type.
+check(new Uint8Array(source), 0);
+
+// Overlapping set within one buffer still behaves like memmove.
+const overlapping = new Uint8Array(source.buffer, 0, kLength - 1);
+const shifted = new Uint8Array(source.buffer, 1, kLength - 1);
+shifted.set(overlapping);
+for (let i = 0; i + 1 < kLength; i += kStride) {
+  assertEquals(value(i), source[i + 1], `index ${i}`);
+}
+
+// Cross-type sets take the element-wise conversion path.
+const floats = new Float32Array([-1, 0.5, 1.5, 254.6, 300, NaN, -0]);
+const clamped = new Uint8ClampedArray(floats.length);
+clamped.set(floats);
+assertEquals([0, 0, 2, 255, 255, 0, 0], Array.from(clamped));
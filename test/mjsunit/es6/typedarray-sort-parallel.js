@@ -0,0 +1,65 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --typed-array-parallel-sort-threshold=1000
+
+// Large typed arrays are sorted in chunks on worker threads. Check that the
+// result matches sorting with an equivalent comparator.
+
+let seed = 1;
+function random() {
+  seed = (seed * 16807) % 2147483647;
+  return seed;
+}
+
+function compare(a, b) {
+  if (a < b) return -1;
+  if (a > b) return 1;
+  if (a === 0 && b === 0) return Object.is(b, -0) - Object.is(a, -0);
+  if (a !== a) return b !== b ? 0 : 1;
+  if (b !== b) return -1;
+  return 0;
+}
+
+function check(array) {
+  const expected = array.slice().sort(compare);
+  array.sort();
+  assertEquals(expected.length, array.length);
+  for (let i = 0; i < expected.length; i++) {
+    assertTrue(Object.is(expected[i], array[i]), `index ${i}`);
+  }
+}
+
+for (const length of [999, 1000, 1001, 4099, 20000]) {
+  const int32 = new Int32Array(length);
+  const uint8 = new Uint8Array(length);
+  const float64 = new Float64Array(length);
+  const bigint64 = new BigInt64Array(length);
+  for (let i = 0; i < length; i++) {
+    int32[i] = random() - 1073741824;
+    uint8[i] = random();
+    float64[i] = (random() % 1000) / 8 - 60;
+    bigint64[i] = BigInt(random()) * BigInt(random());
+  }
+  float64[1] = NaN;
+  float64[2] = -0;
+  float64[3] = 0;
+  float64[length - 1] = -Infinity;
+  check(int32);
+  check(uint8);
+  check(float64);
+  check(bigint64);
+}
+
+// Views into SharedArrayBuffers are sorted through a copy.
+const shared = new Float32Array(new SharedArrayBuffer(4 * 5000));
+for (let i = 0; i < shared.length; i++) shared[i] = random() % 777;
+check(shared);
+
+// Already sorted and reversed inputs.
+const sorted = new Uint32Array(10000);
+for (let i = 0; i < sorted.length; i++) sorted[i] = i;
+check(sorted);
+sorted.reverse();
+check(sorted);
@@ -0,0 +1,41 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --noincremental-marking
+// Flags: --js-finalization-registry-batch-cleanup
+
+(async function () {
+
+  let cleanup_calls = [];
+  let cleanup = function (holdings) {
+    cleanup_calls.push(holdings);
+  }
+
+  let fg = new FinalizationRegistry(cleanup, { batch: true });
+
+  // Register a few objects inside a closure so that we can reliably kill them.
+  (function () {
+    for (let i = 0; i < 3; ++i) {
+      fg.register({}, "holdings" + i);
+    }
+  })();
+
+  // We need to invoke GC asynchronously and wait for it to finish, so that
+  // it doesn't need to scan the stack. Otherwise, the objects may not be
+  // reclaimed because of conservative stack scanning and the test may not
+  // work as intended.
+  await gc({ type: 'major', execution: 'async' });
+  assertEquals(0, cleanup_calls.length);
+
+  // All holdings are delivered to a single callback invocation as an array.
+  let timeout_func = function () {
+    assertEquals(1, cleanup_calls.length);
+    assertTrue(Array.isArray(cleanup_calls[0]));
+    assertEquals(["holdings0", "holdings1", "holdings2"],
+                 cleanup_calls[0].sort());
+  }
+
+  setTimeout(timeout_func, 0);
+
+})();
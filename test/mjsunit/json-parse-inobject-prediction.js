@@ -0,0 +1,39 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Objects parsed from JSON that are consistently extended afterwards should
+// eventually be allocated with in-object space for the extra properties.
+function parseAndExtend(json) {
+  const o = JSON.parse(json);
+  o.extra1 = 1;
+  o.extra2 = 2;
+  return o;
+}
+
+const kJson = '{"a":1,"b":"x"}';
+let objects = [];
+for (let i = 0; i < 10; i++) objects.push(parseAndExtend(kJson));
+
+const last = objects[objects.length - 1];
+assertEquals(1, last.a);
+assertEquals("x", last.b);
+assertEquals(1, last.extra1);
+assertEquals(2, last.extra2);
+assertTrue(%HasFastProperties(last));
+assertTrue(%HaveSameMap(last, parseAndExtend(kJson)));
+
+// Siblings in an array share the predicted map.
+const array = JSON.parse('[' + kJson + ',' + kJson + ',' + kJson + ']');
+assertTrue(%HaveSameMap(array[0], array[1]));
+assertTrue(%HaveSameMap(array[1], array[2]));
+for (const o of array) {
+  assertEquals(1, o.a);
+  assertEquals("x", o.b);
+}
+
+// Property order and values are unaffected by the prediction.
+assertEquals(['a', 'b', 'extra1', 'extra2'], Object.keys(last));
+assertEquals('{"a":1,"b":"x","extra1":1,"extra2":2}', JSON.stringify(last));
@@ -0,0 +1,34 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Exercise the block-wise scanning of JSON strings: terminating and escape
+// characters at every offset relative to the block boundaries, in one-byte
+// and two-byte sources.
+
+function parse(two_byte_source, string) {
+  if (two_byte_source) return JSON.parse('["Ā",' + string + ']')[1];
+  return JSON.parse(string);
+}
+
+function check(two_byte_source, fill) {
+  for (let length = 0; length < 70; length++) {
+    const body = fill.repeat(length);
+    assertEquals(body, parse(two_byte_source, '"' + body + '"'));
+    assertEquals(body + '\n' + body,
+                 parse(two_byte_source, '"' + body + '\\n' + body + '"'));
+    assertEquals(body + '"', parse(two_byte_source, '"' + body + '\\""'));
+    assertEquals(body + 'ሴ',
+                 parse(two_byte_source, '"' + body + '\\u1234"'));
+    assertThrows(() => parse(two_byte_source, '"' + body + '\x01"'),
+                 SyntaxError);
+    assertThrows(() => parse(two_byte_source, '"' + body), SyntaxError);
+  }
+}
+
+check(false, 'a');
+check(false, 'xyz\xff');
+check(true, 'a');
+check(true, 'b\xe9');
+check(true, 'Ā');
+check(true, 'ab中');
@@ -0,0 +1,66 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Arrays of objects sharing a map are serialized using a cached plan of the
+// map's properties; make sure it stays correct when the objects change.
+
+function record(i) {
+  return {id: i, name: 'n' + i, score: i + 0.5, nested: {x: i}};
+}
+
+let records = [];
+for (let i = 0; i < 10; i++) records.push(record(i));
+let expected = '[' + records.map(r =>
+    `{"id":${r.id},"name":"${r.name}","score":${r.score},` +
+    `"nested":{"x":${r.nested.x}}}`).join(',') + ']';
+assertEquals(expected, JSON.stringify(records));
+assertEquals(expected, JSON.stringify(records));
+
+// Non-enumerable and symbol-keyed properties are skipped.
+let a = {p: 1, q: 2};
+let b = {p: 3, q: 4};
+Object.defineProperty(a, 'hidden', {value: 5, enumerable: false});
+Object.defineProperty(b, 'hidden', {value: 6, enumerable: false});
+a[Symbol('s')] = 7;
+assertEquals('[{"p":1,"q":2},{"p":3,"q":4}]', JSON.stringify([a, b]));
+
+// Accessors are called.
+let getter_calls = 0;
+let proto = {};
+function WithAccessor(v) {
+  this.v = v;
+  Object.defineProperty(this, 'w', {
+    get() { getter_calls++; return this.v * 2; },
+    enumerable: true
+  });
+}
+assertEquals('[{"v":1,"w":2},{"v":2,"w":4}]',
+             JSON.stringify([new WithAccessor(1), new WithAccessor(2)]));
+assertEquals(2, getter_calls);
+
+// A toJSON of a nested object changes the shape of its holder mid-way.
+let holders = [];
+for (let i = 0; i < 3; i++) {
+  let holder = {first: i, second: null, third: i + 0.25};
+  holder.second = {
+    toJSON() {
+      holder.third = 'changed';
+      delete holder.first;
+      return 'second';
+    }
+  };
+  holders.push(holder);
+}
+assertEquals(
+    '[{"first":0,"second":"second","third":"changed"},' +
+        '{"first":1,"second":"second","third":"changed"},' +
+        '{"first":2,"second":"second","third":"changed"}]',
+    JSON.stringify(holders));
+
+// Field representations generalized after the first serialization.
+let points = [{x: 1, y: 2}, {x: 3, y: 4}];
+assertEquals('[{"x":1,"y":2},{"x":3,"y":4}]', JSON.stringify(points));
+points[1].x = 'three';
+points[0].y = 2.5;
+assertEquals('[{"x":1,"y":2.5},{"x":"three","y":4}]', JSON.stringify(points));
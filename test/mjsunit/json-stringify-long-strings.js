@@ -0,0 +1,30 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Exercise the block-wise copying of strings that need no escaping, with
+// characters to escape at every offset relative to the block boundaries.
+
+function check(fill) {
+  for (let length = 0; length < 70; length++) {
+    const body = fill.repeat(length);
+    assertEquals('"' + body + '"', JSON.stringify(body));
+    assertEquals('"' + body + '\\n' + body + '"',
+                 JSON.stringify(body + '\n' + body));
+    assertEquals('"' + body + '\\"\\\\' + body + '"',
+                 JSON.stringify(body + '"\\' + body));
+    assertEquals('"' + body + '\\u0001"', JSON.stringify(body + '\x01'));
+    assertEquals('"' + body + '\\ud800' + body + '"',
+                 JSON.stringify(body + '\uD800' + body));
+    assertEquals('"' + body + '\\udc00"', JSON.stringify(body + '\uDC00'));
+    assertEquals('"' + body + '😀' + body + '"',
+                 JSON.stringify(body + '😀' + body));
+    assertEquals('["' + body + '",{"' + body + '":1}]',
+                 JSON.stringify([body, {[body]: 1}]));
+  }
+}
+
+check('a');
+check('xyz\xff');
+check('Ā');
+check('ab中');
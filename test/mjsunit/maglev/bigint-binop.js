@@ -0,0 +1,72 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+
+// Checks BigInt arithmetic with BigInt feedback, including results that no
+// longer fit into 64 bits.
+(function() {
+  function add(x, y) { return x + y; }
+  function sub(x, y) { return x - y; }
+  function mul(x, y) { return x * y; }
+
+  for (let f of [add, sub, mul]) {
+    %PrepareFunctionForOptimization(f);
+    f(1n, 2n);
+    f(3n, 4n);
+    %OptimizeMaglevOnNextCall(f);
+    f(1n, 2n);
+    assertTrue(isMaglevved(f));
+  }
+
+  assertEquals(3n, add(1n, 2n));
+  assertEquals(-1n, sub(1n, 2n));
+  assertEquals(6n, mul(2n, 3n));
+  assertEquals(2n ** 64n, add(2n ** 63n, 2n ** 63n));
+  assertEquals(-(2n ** 64n), sub(-(2n ** 63n), 2n ** 63n));
+  assertEquals(2n ** 126n, mul(2n ** 63n, 2n ** 63n));
+  assertTrue(isMaglevved(add));
+  assertTrue(isMaglevved(sub));
+  assertTrue(isMaglevved(mul));
+
+  // Non-BigInt inputs deopt.
+  assertEquals(3, add(1, 2));
+  assertFalse(isMaglevved(add));
+  assertThrows(() => mul(1n, 2), TypeError);
+  assertFalse(isMaglevved(mul));
+})();
+
+// Checks BigInt comparisons with BigInt feedback.
+(function() {
+  function lt(x, y) { return x < y; }
+  function le(x, y) { return x <= y; }
+  function gt(x, y) { return x > y; }
+  function ge(x, y) { return x >= y; }
+  function eq(x, y) { return x == y; }
+  function seq(x, y) { return x === y; }
+
+  for (let f of [lt, le, gt, ge, eq, seq]) {
+    %PrepareFunctionForOptimization(f);
+    f(1n, 2n);
+    f(2n, 1n);
+    %OptimizeMaglevOnNextCall(f);
+    f(1n, 2n);
+    assertTrue(isMaglevved(f));
+  }
+
+  const big = 2n ** 100n;
+  assertTrue(lt(1n, 2n));
+  assertFalse(lt(big, -big));
+  assertTrue(le(big, big));
+  assertTrue(gt(big, 2n ** 64n));
+  assertFalse(ge(-big, 0n));
+  assertTrue(eq(big, 2n ** 100n));
+  assertFalse(seq(big, big + 1n));
+  for (let f of [lt, le, gt, ge, eq, seq]) {
+    assertTrue(isMaglevved(f));
+  }
+
+  assertTrue(lt(1, 2));
+  assertFalse(isMaglevved(lt));
+})();
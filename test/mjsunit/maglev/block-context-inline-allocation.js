@@ -0,0 +1,58 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev
+
+(function() {
+  let outer = 10;
+  function foo(n) {
+    let fns = [];
+    for (let i = 0; i < n; ++i) {
+      let j = i * 2;
+      fns.push(() => i + j + outer);
+    }
+    return fns.map(f => f());
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals([10, 13, 16], foo(3));
+  %OptimizeMaglevOnNextCall(foo);
+  assertEquals([10, 13, 16, 19], foo(4));
+  assertTrue(isMaglevved(foo));
+  outer = 0;
+  assertEquals([0, 3], foo(2));
+})();
+
+(function() {
+  function foo(x) {
+    {
+      let a = x;
+      let g = () => a;
+      a++;
+      return g();
+    }
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(2, foo(1));
+  %OptimizeMaglevOnNextCall(foo);
+  assertEquals(3, foo(2));
+  assertTrue(isMaglevved(foo));
+})();
+
+(function() {
+  // TDZ checks on block-scoped variables still throw.
+  function foo() {
+    {
+      let f = () => a;
+      f();
+      let a = 1;
+    }
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertThrows(foo, ReferenceError);
+  %OptimizeMaglevOnNextCall(foo);
+  assertThrows(foo, ReferenceError);
+})();
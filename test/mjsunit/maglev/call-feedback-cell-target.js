@@ -0,0 +1,32 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+
+function make_adder(x) {
+  return (y) => x + y;
+}
+
+// The call site sees several closures of the same function, so its feedback
+// is the shared feedback cell.
+function call(f, y) {
+  return f(y);
+}
+
+let add1 = make_adder(1);
+let add2 = make_adder(2);
+
+%PrepareFunctionForOptimization(make_adder);
+%PrepareFunctionForOptimization(call);
+assertEquals(11, call(add1, 10));
+assertEquals(12, call(add2, 10));
+%OptimizeMaglevOnNextCall(call);
+assertEquals(11, call(add1, 10));
+assertEquals(12, call(add2, 10));
+assertEquals(13, call(make_adder(3), 10));
+assertTrue(isMaglevved(call));
+
+// A different function deopts.
+assertEquals(20, call((y) => y * 2, 10));
+assertFalse(isMaglevved(call));
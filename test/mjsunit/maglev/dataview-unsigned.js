@@ -0,0 +1,52 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev
+
+const dv = new DataView(new ArrayBuffer(8));
+
+function getU8(i) { return dv.getUint8(i); }
+function setU8(i, v) { dv.setUint8(i, v); }
+function getU16(i, le) { return dv.getUint16(i, le); }
+function setU16(i, v, le) { dv.setUint16(i, v, le); }
+function setU32(i, v, le) { dv.setUint32(i, v, le); }
+
+function test() {
+  setU8(0, 0xFE);
+  assertEquals(0xFE, getU8(0));
+  setU8(1, -1);
+  assertEquals(0xFF, getU8(1));
+
+  setU16(2, 0xFFEE, false);
+  assertEquals(0xFF, dv.getUint8(2));
+  assertEquals(0xEE, dv.getUint8(3));
+  assertEquals(0xFFEE, getU16(2, false));
+  assertEquals(0xEEFF, getU16(2, true));
+  setU16(2, 0x8001, true);
+  assertEquals(0x8001, getU16(2, true));
+
+  setU32(4, 0xFFFFFFFE, false);
+  assertEquals(0xFFFFFFFE, dv.getUint32(4, false));
+  setU32(4, 0x80000001, true);
+  assertEquals(0x80000001, dv.getUint32(4, true));
+  setU32(4, -2, true);
+  assertEquals(0xFFFFFFFE, dv.getUint32(4, true));
+}
+
+%PrepareFunctionForOptimization(getU8);
+%PrepareFunctionForOptimization(setU8);
+%PrepareFunctionForOptimization(getU16);
+%PrepareFunctionForOptimization(setU16);
+%PrepareFunctionForOptimization(setU32);
+test();
+%OptimizeMaglevOnNextCall(getU8);
+%OptimizeMaglevOnNextCall(setU8);
+%OptimizeMaglevOnNextCall(getU16);
+%OptimizeMaglevOnNextCall(setU16);
+%OptimizeMaglevOnNextCall(setU32);
+test();
+
+// Out of bounds accesses still throw.
+assertThrows(() => getU16(7, true), RangeError);
+assertThrows(() => setU32(6, 1, true), RangeError);
@@ -0,0 +1,23 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --allocation-site-pretenuring
+// Flags: --expose-gc --stress-scavenge=0 --gc-interval=-1
+
+function create() {
+  return [];
+}
+
+%PrepareFunctionForOptimization(create);
+let array = create();
+if (%PretenureAllocationSite(array)) {
+  // Apply the pretenuring decision.
+  gc();
+  %OptimizeMaglevOnNextCall(create);
+  array = create();
+  if (isMaglevved(create)) {
+    assertFalse(%InYoungGeneration(array));
+  }
+}
+assertEquals(0, array.length);
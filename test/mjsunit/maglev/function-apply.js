@@ -1,126 +1,72 @@
-// Copyright 2023 the V8 project authors. All rights reserved.
+// Copyright 2024 the V8 project authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
 // Flags: --allow-natives-syntax --maglev
 
-function foo(...args) {
-  return {'this': this, 'arguments': args};
+function sum() {
+  let result = this === undefined ? 0 : this.base;
+  for (let i = 0; i < arguments.length; ++i) result += arguments[i];
+  return result;
 }
 
-function validCalls(a, ...args) {
-  let obj = {};
+(function TestApplyWithoutArguments() {
+  function foo(receiver) {
+    return sum.apply(receiver);
+  }
 
-  // No receiver or receiver is null or undefined.
-  assertEquals({'this': this, 'arguments': []}, foo.apply());
-  assertEquals({'this': this, 'arguments': []}, foo.apply(null));
-  assertEquals({'this': this, 'arguments': []}, foo.apply(undefined));
-  // Receiver is object.
-  assertEquals({'this': obj, 'arguments': []}, foo.apply(obj));
-  // Valid arguments array.
-  assertEquals({'this': this, 'arguments': [3, 4]}, foo.apply(null, args));
-  assertEquals({'this': obj, 'arguments': [3, 4]}, foo.apply(obj, args));
-  assertEquals(
-      {'this': this, 'arguments': [2, 3, 4]}, foo.apply(null, [a, ...args]));
-  assertEquals(
-      {'this': obj, 'arguments': [2, 3, 4]}, foo.apply(obj, [a, ...args]));
-  // Extra arguments are ignored.
-  assertEquals({'this': this, 'arguments': [3, 4]}, foo.apply(null, args, a));
-  assertEquals({'this': obj, 'arguments': [3, 4]}, foo.apply(obj, args, a));
-}
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(1, foo({base: 1}));
+  %OptimizeMaglevOnNextCall(foo);
+  assertEquals(2, foo({base: 2}));
+  assertTrue(isMaglevved(foo));
+})();
 
-%PrepareFunctionForOptimization(validCalls);
-validCalls(2, 3, 4);
-validCalls(2, 3, 4);
-%OptimizeMaglevOnNextCall(validCalls);
-validCalls(2, 3, 4);
+(function TestApplyWithNullishArguments() {
+  function foo(receiver) {
+    return sum.apply(receiver, null) + sum.apply(receiver, undefined);
+  }
 
-function invalidArgsArrayExplicitReceiver(a) {
-  return foo.apply(null, a);
-}
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(2, foo({base: 1}));
+  %OptimizeMaglevOnNextCall(foo);
+  assertEquals(4, foo({base: 2}));
+  assertTrue(isMaglevved(foo));
+})();
 
-%PrepareFunctionForOptimization(invalidArgsArrayExplicitReceiver);
-assertThrows(
-    () => invalidArgsArrayExplicitReceiver(2, 3, 4), TypeError,
-    'CreateListFromArrayLike called on non-object');
-assertThrows(
-    () => invalidArgsArrayExplicitReceiver(2, 3, 4), TypeError,
-    'CreateListFromArrayLike called on non-object');
-assertEquals(
-    {'this': this, 'arguments': []},
-    invalidArgsArrayExplicitReceiver(null, null, null));
-%OptimizeMaglevOnNextCall(invalidArgsArrayExplicitReceiver);
-assertThrows(
-    () => invalidArgsArrayExplicitReceiver(2, 3, 4), TypeError,
-    'CreateListFromArrayLike called on non-object');
-assertEquals(
-    {'this': this, 'arguments': []},
-    invalidArgsArrayExplicitReceiver(null, null, null));
+(function TestApplyForwardingArguments() {
+  function wrapper() {
+    return sum.apply(this, arguments);
+  }
 
-function invalidArgsArrayImplicitReceiver(...args) {
-  return foo.apply(...args);
-}
+  %PrepareFunctionForOptimization(wrapper);
+  assertEquals(7, wrapper.call({base: 1}, 2, 4));
+  %OptimizeMaglevOnNextCall(wrapper);
+  assertEquals(7, wrapper.call({base: 1}, 2, 4));
+  assertEquals(10, wrapper.call({base: 0}, 1, 2, 3, 4));
+  assertTrue(isMaglevved(wrapper));
+})();
 
-%PrepareFunctionForOptimization(invalidArgsArrayImplicitReceiver);
-assertThrows(
-    () => invalidArgsArrayImplicitReceiver(2, 3, 4), TypeError,
-    'CreateListFromArrayLike called on non-object');
-assertThrows(
-    () => invalidArgsArrayImplicitReceiver(2, 3, 4), TypeError,
-    'CreateListFromArrayLike called on non-object');
-assertEquals(
-    {'this': this, 'arguments': []},
-    invalidArgsArrayImplicitReceiver(null, null, null));
-%OptimizeMaglevOnNextCall(invalidArgsArrayImplicitReceiver);
-assertThrows(
-    () => invalidArgsArrayImplicitReceiver(2, 3, 4), TypeError,
-    'CreateListFromArrayLike called on non-object');
-assertEquals(
-    {'this': this, 'arguments': []},
-    invalidArgsArrayImplicitReceiver(null, null, null));
-
-function invalidArgsArrayWithExtraSpread(a, ...args) {
-  return foo.apply(null, a, ...args);
-}
+(function TestApplyForwardingRest() {
+  function wrapper(...args) {
+    return sum.apply({base: 100}, args, 'ignored');
+  }
 
-%PrepareFunctionForOptimization(invalidArgsArrayWithExtraSpread);
-assertThrows(
-    () => invalidArgsArrayWithExtraSpread(2, 3, 4), TypeError,
-    'CreateListFromArrayLike called on non-object');
-assertThrows(
-    () => invalidArgsArrayWithExtraSpread(2, 3, 4), TypeError,
-    'CreateListFromArrayLike called on non-object');
-assertEquals(
-    {'this': this, 'arguments': []},
-    invalidArgsArrayWithExtraSpread(null, null, null));
-%OptimizeMaglevOnNextCall(invalidArgsArrayWithExtraSpread);
-assertThrows(
-    () => invalidArgsArrayWithExtraSpread(2, 3, 4), TypeError,
-    'CreateListFromArrayLike called on non-object');
-assertEquals(
-    {'this': this, 'arguments': []},
-    invalidArgsArrayWithExtraSpread(null, null, null));
+  %PrepareFunctionForOptimization(wrapper);
+  assertEquals(103, wrapper(1, 2));
+  %OptimizeMaglevOnNextCall(wrapper);
+  assertEquals(106, wrapper(1, 2, 3));
+  assertTrue(isMaglevved(wrapper));
+})();
 
-function nullArgsArray(a, ...args) {
-  assertEquals({'this': this, 'arguments': []}, foo.apply(null, null));
-}
-
-%PrepareFunctionForOptimization(nullArgsArray);
-nullArgsArray(2, 3, 4);
-nullArgsArray(2, 3, 4);
-nullArgsArray(null, null, null);
-%OptimizeMaglevOnNextCall(nullArgsArray);
-nullArgsArray(2, 3, 4);
-nullArgsArray(null, null, null);
-
-function nullArgsArrayWithExtraSpread(a, ...args) {
-  assertEquals({'this': this, 'arguments': []}, foo.apply(null, null, ...args));
-}
+(function TestApplyInvalidArgumentsList() {
+  function foo(list) {
+    return sum.apply(undefined, list);
+  }
 
-%PrepareFunctionForOptimization(nullArgsArrayWithExtraSpread);
-nullArgsArrayWithExtraSpread(2, 3, 4);
-nullArgsArrayWithExtraSpread(2, 3, 4);
-nullArgsArrayWithExtraSpread(null, null, null);
-%OptimizeMaglevOnNextCall(nullArgsArrayWithExtraSpread);
-nullArgsArrayWithExtraSpread(2, 3, 4);
-nullArgsArrayWithExtraSpread(null, null, null);
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(3, foo([1, 2]));
+  %OptimizeMaglevOnNextCall(foo);
+  assertEquals(3, foo({length: 2, 0: 1, 1: 2}));
+  assertThrows(() => foo(1), TypeError);
+})();
@@ -0,0 +1,38 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev
+
+function* gen(a, b) {
+  let live = a + b;
+  {
+    let dead1 = {a};
+    let dead2 = [b, dead1];
+    yield dead2.length;
+  }
+  let x = yield live;
+  let y = yield live + x;
+  return live + x + y;
+}
+
+function run() {
+  let g = gen(1, 2);
+  let results = [g.next().value, g.next().value, g.next(10).value,
+                 g.next(100).value];
+  return results;
+}
+
+%PrepareFunctionForOptimization(gen);
+assertEquals([2, 3, 13, 113], run());
+assertEquals([2, 3, 13, 113], run());
+%OptimizeMaglevOnNextCall(gen);
+assertEquals([2, 3, 13, 113], run());
+
+// Resuming a generator suspended by Maglev code in the interpreter.
+let g = gen(1, 2);
+g.next();
+g.next();
+%DeoptimizeFunction(gen);
+assertEquals({value: 13, done: false}, g.next(10));
+assertEquals({value: 113, done: true}, g.next(100));
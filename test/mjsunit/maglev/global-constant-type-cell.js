@@ -0,0 +1,33 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev
+
+var config = {scale: 2};
+config = {scale: 3};  // Same map, so the cell becomes constant-type.
+var counter = 1;
+counter = 2;  // Smi, so the cell becomes constant-type.
+
+function foo(x) {
+  return x * config.scale + counter;
+}
+
+%PrepareFunctionForOptimization(foo);
+assertEquals(5, foo(1));
+%OptimizeMaglevOnNextCall(foo);
+assertEquals(8, foo(2));
+assertTrue(isMaglevved(foo));
+
+// Storing a value of the same type keeps the code.
+config = {scale: 4};
+counter = 3;
+assertEquals(11, foo(2));
+assertTrue(isMaglevved(foo));
+
+// Storing a value of a different type invalidates it.
+counter = 0.5;
+assertEquals(8.5, foo(2));
+assertFalse(isMaglevved(foo));
+config = {scale: 1, extra: true};
+assertEquals(2.5, foo(2));
@@ -0,0 +1,35 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+
+let map = new Map([[1, 'one'], ['two', 2], [-0, 'zero'], [NaN, 'nan']]);
+let obj = {};
+map.set(obj, obj);
+
+function get(m, key) {
+  return m.get(key);
+}
+
+function test() {
+  assertEquals('one', get(map, 1));
+  assertEquals(2, get(map, 'two'));
+  assertEquals('zero', get(map, 0));
+  assertEquals('zero', get(map, -0));
+  assertEquals('nan', get(map, NaN));
+  assertEquals(obj, get(map, obj));
+  assertEquals(undefined, get(map, 3));
+  assertEquals(undefined, get(map, {}));
+  assertEquals(undefined, get(new Map(), 1));
+}
+
+%PrepareFunctionForOptimization(get);
+test();
+%OptimizeMaglevOnNextCall(get);
+test();
+assertTrue(isMaglevved(get));
+
+// A receiver which isn't a Map deopts.
+assertThrows(() => get(new Set([1]), 1), TypeError);
+assertFalse(isMaglevved(get));
@@ -0,0 +1,114 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev
+
+(function TestGetTrap() {
+  let log = [];
+  let handler = {
+    get(target, key, receiver) {
+      log.push(key);
+      return key === 'x' ? target.x * 2 : undefined;
+    }
+  };
+  let p = new Proxy({x: 21}, handler);
+  function load(o) {
+    return o.x;
+  }
+
+  %PrepareFunctionForOptimization(load);
+  assertEquals(42, load(p));
+  %OptimizeMaglevOnNextCall(load);
+  assertEquals(42, load(p));
+  assertTrue(isMaglevved(load));
+  assertEquals(['x', 'x'], log);
+
+  // Non-proxy receivers deoptimize.
+  assertEquals(1, load({x: 1}));
+  assertFalse(isMaglevved(load));
+})();
+
+(function TestGetWithoutTrap() {
+  let p = new Proxy({x: 1}, {});
+  function load(o) {
+    return o.x;
+  }
+
+  %PrepareFunctionForOptimization(load);
+  assertEquals(1, load(p));
+  %OptimizeMaglevOnNextCall(load);
+  assertEquals(1, load(p));
+  assertEquals(undefined, load(new Proxy({}, {})));
+})();
+
+(function TestGetInvariantCheck() {
+  let target = {};
+  Object.defineProperty(target, 'x', {value: 1, configurable: false});
+  let p = new Proxy(target, {get: () => 2});
+  let ok = new Proxy({x: 1}, {get: () => 2});
+  function load(o) {
+    return o.x;
+  }
+
+  %PrepareFunctionForOptimization(load);
+  assertEquals(2, load(ok));
+  %OptimizeMaglevOnNextCall(load);
+  assertEquals(2, load(ok));
+  assertThrows(() => load(p), TypeError);
+})();
+
+(function TestSetTrap() {
+  let stored = {};
+  let p = new Proxy({}, {
+    set(target, key, value, receiver) {
+      stored[key] = value;
+      return true;
+    }
+  });
+  function store(o, v) {
+    o.y = v;
+    return v;
+  }
+
+  %PrepareFunctionForOptimization(store);
+  assertEquals(1, store(p, 1));
+  %OptimizeMaglevOnNextCall(store);
+  assertEquals(2, store(p, 2));
+  assertTrue(isMaglevved(store));
+  assertEquals({y: 2}, stored);
+})();
+
+(function TestSetTrapReturnsFalse() {
+  let p = new Proxy({}, {set: () => false});
+  function sloppyStore(o) {
+    o.z = 1;
+  }
+  function strictStore(o) {
+    'use strict';
+    o.z = 1;
+  }
+
+  %PrepareFunctionForOptimization(sloppyStore);
+  %PrepareFunctionForOptimization(strictStore);
+  sloppyStore(p);
+  assertThrows(() => strictStore(p), TypeError);
+  %OptimizeMaglevOnNextCall(sloppyStore);
+  %OptimizeMaglevOnNextCall(strictStore);
+  sloppyStore(p);
+  assertThrows(() => strictStore(p), TypeError);
+})();
+
+(function TestRevokedProxy() {
+  let {proxy, revoke} = Proxy.revocable({x: 1}, {});
+  function load(o) {
+    return o.x;
+  }
+
+  %PrepareFunctionForOptimization(load);
+  assertEquals(1, load(proxy));
+  %OptimizeMaglevOnNextCall(load);
+  assertEquals(1, load(proxy));
+  revoke();
+  assertThrows(() => load(proxy), TypeError);
+})();
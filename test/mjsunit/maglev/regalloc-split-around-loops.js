@@ -0,0 +1,32 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --no-turbofan
+// Flags: --maglev-regalloc-split-around-loops
+
+function g(x) { return x + 1; }
+%NeverOptimizeFunction(g);
+
+// {a}, {b} and {c} are live across the loops, but only used after them.
+function f(n, d) {
+  let a = n + 1;
+  let b = n * 2;
+  let c = d + 0.5;
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    sum = g(sum);
+  }
+  let prod = 1.5;
+  for (let i = 0; i < n; i++) {
+    prod = prod * d + i;
+  }
+  return [a, b, c, sum, prod];
+}
+
+%PrepareFunctionForOptimization(f);
+let expected = f(10, 1.25);
+assertEquals(f(10, 1.25), expected);
+%OptimizeMaglevOnNextCall(f);
+assertEquals(expected, f(10, 1.25));
+assertEquals(f(0, 2.5), [1, 0, 3, 0, 1.5]);
@@ -0,0 +1,39 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev
+
+(function() {
+  function prepend(s) {
+    return "" + s;
+  }
+  function append(s) {
+    return s + "";
+  }
+  function both(a, b) {
+    return "" + a + "" + b + "";
+  }
+
+  %PrepareFunctionForOptimization(prepend);
+  %PrepareFunctionForOptimization(append);
+  %PrepareFunctionForOptimization(both);
+  assertEquals("abc", prepend("abc"));
+  assertEquals("abc", append("abc"));
+  assertEquals("abcdef", both("abc", "def"));
+  %OptimizeMaglevOnNextCall(prepend);
+  %OptimizeMaglevOnNextCall(append);
+  %OptimizeMaglevOnNextCall(both);
+  assertEquals("xyz", prepend("xyz"));
+  assertEquals("xyz", append("xyz"));
+  assertEquals("", prepend(""));
+  assertEquals("", append(""));
+  assertEquals("xyzuvw", both("xyz", "uvw"));
+  assertTrue(isMaglevved(prepend));
+  assertTrue(isMaglevved(append));
+  assertTrue(isMaglevved(both));
+
+  // Non-string inputs still deoptimize through the string check.
+  assertEquals("1", prepend(1));
+  assertEquals("1", append(1));
+})();
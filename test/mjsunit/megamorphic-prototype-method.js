@@ -0,0 +1,56 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Megamorphic loads of inherited methods are served from the stub cache by
+// handlers guarded by prototype validity cells. Check that changes anywhere on
+// the prototype chain invalidate them for all receiver shapes.
+
+class Base {
+  m() { return 'base'; }
+}
+class Middle extends Base {}
+
+const kShapes = 24;
+const receivers = [];
+for (let i = 0; i < kShapes; i++) {
+  const C = class extends Middle {};
+  const o = new C();
+  o['own' + i] = i;
+  receivers.push(o);
+}
+
+function call(o) {
+  return o.m();
+}
+
+function checkAll(expected) {
+  for (const o of receivers) assertEquals(expected, call(o));
+}
+
+%PrepareFunctionForOptimization(call);
+checkAll('base');
+checkAll('base');
+
+// Replace the method on the holder.
+Base.prototype.m = function() { return 'changed'; };
+checkAll('changed');
+
+// Shadow it on an intermediate prototype.
+Middle.prototype.m = function() { return 'middle'; };
+checkAll('middle');
+
+%OptimizeFunctionOnNextCall(call);
+checkAll('middle');
+
+// Remove the shadowing method again, in optimized code.
+delete Middle.prototype.m;
+checkAll('changed');
+
+// Shadow it on a single receiver only.
+receivers[3].m = function() { return 'own'; };
+for (let i = 0; i < kShapes; i++) {
+  assertEquals(i == 3 ? 'own' : 'changed', call(receivers[i]));
+}
@@ -0,0 +1,16 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --minor-ms --minor-ms-defer-finalization
+
+// Keep a linked structure alive across young generation cycles so that
+// concurrent marking has a transitive closure to work on while the GC task is
+// being deferred.
+let head = null;
+for (let i = 0; i < 200000; i++) {
+  head = {value: i, next: (i % 1000) ? head : null};
+}
+let count = 0;
+for (let node = head; node; node = node.next) count++;
+assertEquals(1000, count);
@@ -0,0 +1,42 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --parallel-compile-tasks-for-toplevel --use-external-strings
+
+function lazy_toplevel(a, b) {
+  function inner() { return a + b; }
+  return inner();
+}
+
+var toplevel_expression = function(x) { return x * 2; };
+
+(function(a) {
+  assertEquals(a, "IIFE");
+  assertEquals(3, lazy_toplevel(1, 2));
+  assertEquals(8, toplevel_expression(4));
+})("IIFE");
+
+function* lazy_generator() {
+  yield 1;
+  yield 2;
+}
+
+var gen = lazy_generator();
+assertEquals(1, gen.next().value);
+assertEquals(2, gen.next().value);
+
+async function lazy_async() {
+  return 42;
+}
+lazy_async().then(value => assertEquals(42, value));
+
+class TopLevelClass {
+  method() { return lazy_toplevel(20, 22); }
+}
+assertEquals(42, new TopLevelClass().method());
+
+// Never called, so only compiled on the background thread.
+function never_called() {
+  return 1;
+}
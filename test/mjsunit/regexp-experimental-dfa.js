@@ -0,0 +1,54 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-lazy-dfa
+
+function Test(regexp, subject, expectedResult, expectedLastIndex = 0) {
+  assertEquals(%RegexpTypeTag(regexp), "EXPERIMENTAL");
+  var result = regexp.exec(subject);
+  if (result instanceof Array && expectedResult instanceof Array) {
+    assertArrayEquals(expectedResult, result);
+  } else {
+    assertEquals(expectedResult, result);
+  }
+  assertEquals(expectedLastIndex, regexp.lastIndex);
+}
+
+const kLong = 'abcdefghij'.repeat(1000);
+const kLongTwoByte = 'abcdefghiሴ'.repeat(1000);
+
+// Subjects without a match are rejected by the DFA.
+Test(/x+y/, kLong, null);
+Test(/x+y/, kLongTwoByte, null);
+Test(/(a|b)*c{2}/, kLong, null);
+Test(/^bcd/, kLong, null);
+Test(/bcd/y, kLong, null);
+
+// If there is a match, the NFA computes the captures.
+Test(/(x+)(y)/, kLong + 'xxy' + kLong, ['xxy', 'xx', 'y']);
+Test(/(x+)(y)/, kLongTwoByte + 'xxy', ['xxy', 'xx', 'y']);
+Test(/(?:(a)|b)+c/, 'xxabbac', ['abbac', 'a']);
+Test(/^(ab)c/, 'abcd', ['abc', 'ab']);
+Test(/(?:)/, kLong, ['']);
+Test(/ሴ(a)/, kLongTwoByte, ['ሴa', 'a']);
+
+// Empty quantifier iterations don't match.
+Test(/(?:a*)*x/, 'aaaa', null);
+Test(/(?:a*)+b/, 'aaaab', ['aaaab']);
+
+// Sticky and global regexps resume the search at lastIndex.
+Test(/bcd/y, 'abcd', null, 0);
+var re = /bcd/y;
+re.lastIndex = 1;
+Test(re, 'abcd', ['bcd'], 4);
+re = /a(b)?/g;
+assertEquals(['ab', 'a', 'ab'], 'abxaab'.match(re));
+assertEquals(null, 'xyzxyz'.match(re));
+
+// Assertions and lookbehinds aren't handled by the DFA, but still work.
+Test(/a$/, 'aaab', null);
+Test(/\ba/, 'xa a', ['a']);
+Test(/(?<=x)y/, 'yyxy', ['y']);
+Test(/(?<!x)y/, 'xyxy', null);
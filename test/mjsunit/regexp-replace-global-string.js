@@ -0,0 +1,45 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Global replacements with a string are done by the runtime in one pass.
+
+(function TestManyMatches() {
+  const subject = 'a,b,'.repeat(10000);
+  assertEquals('a;b;'.repeat(10000), subject.replace(/,/g, ';'));
+  assertEquals('ab'.repeat(10000), subject.replace(/,/g, ''));
+  assertEquals('[a],[b],'.repeat(10000), subject.replace(/[ab]/g, '[$&]'));
+  assertEquals(subject, subject.replaceAll(/x/g, 'y'));
+})();
+
+(function TestLastIndex() {
+  const re = /o/g;
+  re.lastIndex = 3;
+  assertEquals('f00 b4r', 'foo b4r'.replace(re, '0'));
+  assertEquals(0, re.lastIndex);
+
+  const sticky = /o/gy;
+  assertEquals('foo', 'foo'.replace(sticky, '0'));
+  assertEquals('00f', 'oof'.replace(sticky, '0'));
+  assertEquals(0, sticky.lastIndex);
+})();
+
+(function TestEmptyMatches() {
+  assertEquals('-a-b-c-', 'abc'.replace(/(?:)/g, '-'));
+  assertEquals('-\u{1F600}-', '\u{1F600}'.replace(/(?:)/gu, '-'));
+  assertEquals('-\uD83D-\uDE00-', '\u{1F600}'.replace(/(?:)/g, '-'));
+})();
+
+(function TestTwoByte() {
+  assertEquals('ሴ+ሴ+', 'ሴ.ሴ.'.replace(/\./g, '+'));
+  assertEquals('xሴx', 'x.x'.replace(/\./g, 'ሴ'));
+})();
+
+(function TestNonGlobal() {
+  assertEquals('a;b,', 'a,b,'.replace(/,/, ';'));
+  assertEquals('a,b,', 'a,b,'.replace(/x/, ';'));
+  const sticky = /b/y;
+  sticky.lastIndex = 2;
+  assertEquals('a,;,', 'a,b,'.replace(sticky, ';'));
+  assertEquals(3, sticky.lastIndex);
+})();
@@ -0,0 +1,59 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-simd --no-regexp-tier-up
+
+// Exercise the Boyer-Moore skip loop with long one-byte subjects, so that the
+// vectorized version is used where supported.
+
+function padding(n) {
+  return 'abcdefghijklmnopqrstuvwxyz0123456789'.repeat(
+      Math.ceil(n / 36)).substring(0, n);
+}
+
+function testFind(re, needle, offset = 0) {
+  for (let prefix = 0; prefix < 70; prefix++) {
+    for (let suffix of [0, 1, 7, 15, 16, 17, 40]) {
+      const s = padding(prefix) + needle + padding(suffix);
+      const m = re.exec(s);
+      assertNotNull(m, `${re} ${prefix} ${suffix}`);
+      assertEquals(prefix + offset, m.index);
+    }
+  }
+}
+
+testFind(/ERROR.*timeout/, 'ERROR: connection timeout');
+testFind(/[XYZ]{3}/, 'ZYX');
+testFind(/(?:QUUX|QUUZ)!/, 'QUUZ!');
+testFind(/étéé/, 'étéé');
+// Characters that map to the same skip table entry as the pattern
+// characters (ie. that are equal modulo the table size).
+testFind(/ÁÂÃÄ+/, 'ÁÂÃÄ');
+testFind(/ABCD+/, 'ÁÂÃÄABCD', 4);
+
+function testNoMatch(re) {
+  for (let len = 0; len < 100; len++) {
+    assertNull(re.exec(padding(len)));
+    assertNull(re.exec(padding(len) + 'ERROR: timeou'));
+  }
+}
+
+testNoMatch(/ERROR.*timeout/);
+testNoMatch(/[XYZ]{3}/);
+testNoMatch(/(?:QUUX|QUUZ)!/);
+
+// Global matching resumes the skip loop from the previous match.
+(function TestGlobal() {
+  const s = (padding(33) + 'WXYZ').repeat(20);
+  const matches = s.match(/WXYZ/g);
+  assertEquals(20, matches.length);
+  let index = 0;
+  const re = /WX[YZ]Z/g;
+  let m;
+  while ((m = re.exec(s)) !== null) {
+    assertEquals(33 + index * 37, m.index);
+    index++;
+  }
+  assertEquals(20, index);
+})();
@@ -0,0 +1,55 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Shrinking a resizable ArrayBuffer decommits the pages past the new length
+// without zeroing them first. Check that growing the buffer again only ever
+// exposes zeros, both within the last committed page and beyond it.
+
+'use strict';
+
+const kMaxLength = 64 * 1024 * 1024;
+const kStride = 1021;
+
+function fill(ta, from, to) {
+  for (let i = from; i < to; i += kStride) ta[i] = 0xab;
+  ta[to - 1] = 0xab;
+}
+
+function checkZero(ta, from, to) {
+  // Look at the indices written by {fill}.
+  const first = Math.ceil(from / kStride) * kStride;
+  for (let i = first; i < to; i += kStride) {
+    assertEquals(0, ta[i], `index ${i}`);
+  }
+  assertEquals(0, ta[from]);
+  assertEquals(0, ta[to - 1]);
+}
+
+const rab = new ArrayBuffer(4096, {maxByteLength: kMaxLength});
+const ta = new Uint8Array(rab);
+
+// Grow from a few pages up to the maximum and fill the whole buffer.
+for (const length of [8192, 1024 * 1024, kMaxLength]) {
+  const old_length = rab.byteLength;
+  rab.resize(length);
+  assertEquals(length, ta.length);
+  checkZero(ta, old_length, length);
+  fill(ta, 0, length);
+}
+
+// Shrink to a length that is not page aligned and grow back.
+for (const length of [100, 5000, 3 * 1024 * 1024 + 17]) {
+  rab.resize(length);
+  assertEquals(length, ta.length);
+  assertEquals(0xab, ta[length - 1]);
+  rab.resize(kMaxLength);
+  checkZero(ta, length, kMaxLength);
+  fill(ta, 0, kMaxLength);
+}
+
+// Shrinking to zero and growing again works as well.
+rab.resize(0);
+assertEquals(0, ta.length);
+rab.resize(4096);
+checkZero(ta, 0, 4096);
@@ -0,0 +1,85 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --shared-string-table --harmony-struct --allow-natives-syntax
+// Flags: --verify-heap
+
+"use strict";
+
+// Optimizing compilers lower stores to shared struct fields to a field store
+// that is preceded by a shared value barrier.
+
+const Box = new SharedStructType(['payload', 'other']);
+
+function store(box, value) {
+  box.payload = value;
+}
+
+function storeCaught(box, value) {
+  try {
+    box.payload = value;
+    return true;
+  } catch (e) {
+    assertInstanceof(e, TypeError);
+    return false;
+  }
+}
+
+function storeMixed(receiver, value) {
+  receiver.payload = value;
+}
+
+function testStores() {
+  const box = new Box();
+  const shared = new Box();
+  store(box, 42);
+  assertEquals(42, box.payload);
+  store(box, 2000000000.5);
+  assertEquals(2000000000.5, box.payload);
+  // Not internalized and thus not shared yet.
+  const str = 'str' + Math.random();
+  store(box, str);
+  assertEquals(str, box.payload);
+  store(box, shared);
+  assertSame(shared, box.payload);
+  store(box, undefined);
+  assertEquals(undefined, box.payload);
+
+  assertTrue(storeCaught(box, 1));
+  assertFalse(storeCaught(box, {}));
+  assertEquals(1, box.payload);
+  assertThrows(() => store(box, {}), TypeError);
+  assertEquals(1, box.payload);
+
+  // Polymorphic stores to shared structs and ordinary objects.
+  const object = {payload: 0};
+  const unshared = {};
+  storeMixed(object, unshared);
+  assertSame(unshared, object.payload);
+  storeMixed(box, 'mixed');
+  assertEquals('mixed', box.payload);
+}
+
+function prepare() {
+  %PrepareFunctionForOptimization(store);
+  %PrepareFunctionForOptimization(storeCaught);
+  %PrepareFunctionForOptimization(storeMixed);
+  testStores();
+  testStores();
+}
+
+prepare();
+%OptimizeMaglevOnNextCall(store);
+%OptimizeMaglevOnNextCall(storeCaught);
+%OptimizeMaglevOnNextCall(storeMixed);
+testStores();
+
+prepare();
+%OptimizeFunctionOnNextCall(store);
+%OptimizeFunctionOnNextCall(storeCaught);
+%OptimizeFunctionOnNextCall(storeMixed);
+testStores();
+
+// Verifies that there are no shared->local edges.
+%SharedGC();
@@ -0,0 +1,73 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --async-stack-traces
+
+// Stack trace capture stops as soon as Error.stackTraceLimit frames have been
+// collected. Check that the limit is still honored exactly, including for
+// inlined frames and async frames.
+
+function frameNames(error) {
+  return error.stack.split('\n').slice(1).map(
+      line => line.trim().replace(/^at (async )?/, '').split(' ')[0]);
+}
+
+function a() { return new Error(); }
+function b() { return a(); }
+function c() { return b(); }
+function d() { return c(); }
+
+const savedLimit = Error.stackTraceLimit;
+
+function check() {
+  for (let limit = 0; limit <= 4; limit++) {
+    Error.stackTraceLimit = limit;
+    assertEquals(['a', 'b', 'c', 'd'].slice(0, limit), frameNames(d()));
+  }
+  Error.stackTraceLimit = savedLimit;
+}
+
+%PrepareFunctionForOptimization(a);
+%PrepareFunctionForOptimization(b);
+%PrepareFunctionForOptimization(c);
+%PrepareFunctionForOptimization(d);
+check();
+check();
+// All of a, b and c are inlined into d.
+%OptimizeFunctionOnNextCall(d);
+check();
+
+// Error.captureStackTrace skips frames up to the given function.
+Error.stackTraceLimit = 2;
+const object = {};
+function captureFromB() { Error.captureStackTrace(object, b2); }
+function b2() { captureFromB(); }
+function c2() { b2(); }
+function d2() { c2(); }
+function e2() { d2(); }
+e2();
+assertEquals(['c2', 'd2'], frameNames(object));
+Error.stackTraceLimit = savedLimit;
+
+// Async frames are appended after the synchronous ones, up to the limit.
+async function inner() {
+  await 1;
+  throw new Error();
+}
+async function middle() { await inner(); }
+async function outer() { await middle(); }
+
+function checkAsync(limit, expected) {
+  let error;
+  Error.stackTraceLimit = limit;
+  outer().catch(e => error = e);
+  %PerformMicrotaskCheckpoint();
+  Error.stackTraceLimit = savedLimit;
+  assertEquals(expected, frameNames(error));
+}
+
+checkAsync(0, []);
+checkAsync(1, ['inner']);
+checkAsync(2, ['inner', 'middle']);
+checkAsync(3, ['inner', 'middle', 'outer']);
@@ -0,0 +1,55 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Searches in long subjects, with near misses that match the first and the
+// last character of the pattern, at every alignment.
+
+function NaiveIndexOf(subject, pattern, start) {
+  outer: for (let i = start; i <= subject.length - pattern.length; i++) {
+    for (let j = 0; j < pattern.length; j++) {
+      if (subject[j + i] !== pattern[j]) continue outer;
+    }
+    return i;
+  }
+  return -1;
+}
+
+function TestPatterns(filler, patterns) {
+  for (const pattern of patterns) {
+    // The filler doesn't occur in any of the patterns.
+    const nearMiss = pattern[0] +
+        filler.repeat(Math.max(1, pattern.length - 2)) +
+        pattern[pattern.length - 1];
+    for (let offset = 0; offset < 40; offset++) {
+      const subject = filler.repeat(offset) + nearMiss + filler.repeat(3) +
+          pattern + filler.repeat(40 - offset);
+      const expected = NaiveIndexOf(subject, pattern, 0);
+      assertEquals(expected, subject.indexOf(pattern));
+      assertTrue(subject.includes(pattern));
+      assertEquals(-1, subject.indexOf(pattern, expected + 1));
+      assertEquals(2, subject.split(pattern).length);
+      assertEquals(-1, (subject.substring(0, expected) + nearMiss)
+                           .indexOf(pattern));
+    }
+  }
+}
+
+const kOneBytePatterns = ['ab', 'abc', 'a\0c', 'xyzzy', 'abcdefghij',
+                          'needle in a haystack'];
+TestPatterns('-', kOneBytePatterns);
+TestPatterns('ꙮ', kOneBytePatterns);
+
+const kTwoBytePatterns = ['aሴ', 'ሴb', 'ሴ\0ሴ', 'ሴሴሴሴb', 'aሴbሴcሴdሴeሴ'];
+TestPatterns('-', kTwoBytePatterns);
+TestPatterns('ꙮ', kTwoBytePatterns);
+
+(function TestLongSubject() {
+  const subject = 'abcdefgh'.repeat(4096) + 'abcdefgX';
+  assertEquals(8 * 4096, subject.indexOf('abcdefgX'));
+  assertEquals(8 * 4096 - 1, subject.indexOf('habcdefgX'));
+  assertEquals(-1, subject.indexOf('abcdefgY'));
+  assertFalse(subject.includes('hX'));
+  assertTrue(subject.includes('gX'));
+  assertEquals(4098, subject.split('ab').length);
+})();
@@ -0,0 +1,91 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Large cons strings are searched segment by segment without flattening.
+// Check matches inside segments, matches straddling segment boundaries, and
+// ropes fragmented enough for the search to fall back to flattening.
+
+function reference(pieces, pattern, start) {
+  return pieces.join('').indexOf(pattern, start);
+}
+
+function buildRope(pieces) {
+  let s = '';
+  for (const piece of pieces) s += piece;
+  return s;
+}
+
+function check(pieces, pattern, start = 0) {
+  const rope = buildRope(pieces);
+  assertEquals(reference(pieces, pattern, start), rope.indexOf(pattern, start),
+               `${pattern} from ${start}`);
+  assertEquals(reference(pieces, pattern, start) !== -1,
+               buildRope(pieces).includes(pattern, start));
+}
+
+function pieces(count, length, ch = 'a') {
+  return new Array(count).fill(ch.repeat(length));
+}
+
+// Long segments.
+(function() {
+  const p = pieces(20, 1000);
+  p[13] = 'a'.repeat(500) + 'needle' + 'a'.repeat(494);
+  check(p, 'needle');
+  check(p, 'needle', 13000);
+  check(p, 'needle', 13501);
+  check(p, 'n');
+  check(p, 'missing');
+})();
+
+// A match straddling each possible boundary position.
+(function() {
+  const pattern = 'abcdefghij';
+  for (let split = 1; split < pattern.length; split++) {
+    const p = pieces(10, 1000, '-');
+    p[5] = '-'.repeat(1000 - split) + pattern.substring(0, split);
+    p[6] = pattern.substring(split) + '-'.repeat(1000 - pattern.length + split);
+    check(p, pattern);
+    check(p, pattern, 5999);
+  }
+})();
+
+// A match spanning several segments shorter than the pattern.
+(function() {
+  const p = pieces(10, 1000, '-');
+  p.splice(4, 0, 'wid', 'e', 'ne', 'edle');
+  check(p, 'wideneedle');
+  check(p, 'eneedl');
+})();
+
+// Two-byte segments and patterns.
+(function() {
+  const p = pieces(10, 1000, 'ሴ');
+  p[7] = 'ሴ'.repeat(999) + '⍅';
+  p[8] = 'x' + 'ሴ'.repeat(999);
+  check(p, '⍅x');
+  check(p, 'xሴ');
+  check(p, 'ሴሴ', 2);
+})();
+
+// Fragmented ropes give up on segment-wise search.
+(function() {
+  const p = pieces(10000, 1);
+  p[9000] = 'b';
+  p[9001] = 'c';
+  check(p, 'bc');
+  check(p, 'abc', 100);
+  check(p, 'cb');
+})();
+
+// The rope is still usable afterwards.
+(function() {
+  const p = pieces(20, 1000);
+  p[3] = 'x' + 'a'.repeat(999);
+  const rope = buildRope(p);
+  assertEquals(3000, rope.indexOf('x'));
+  assertEquals(3000, rope.indexOf('xa'));
+  assertEquals(20000, rope.length);
+  assertEquals('x', rope[3000]);
+})();
@@ -0,0 +1,66 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --turboshaft --turboshaft-bounds-check-elimination
+// Flags: --allow-natives-syntax
+
+function sum_float64(a) {
+  let sum = 0;
+  for (let i = 0; i < a.length; i++) {
+    sum += a[i];
+  }
+  return sum;
+}
+
+let f64 = new Float64Array(100);
+for (let i = 0; i < f64.length; i++) f64[i] = i * 0.5;
+
+%PrepareFunctionForOptimization(sum_float64);
+assertEquals(2475, sum_float64(f64));
+%OptimizeFunctionOnNextCall(sum_float64);
+assertEquals(2475, sum_float64(f64));
+assertEquals(0, sum_float64(new Float64Array(0)));
+
+function sum_array(a) {
+  let sum = 0;
+  for (let i = 0; i < a.length; i++) {
+    sum += a[i];
+  }
+  return sum;
+}
+
+%PrepareFunctionForOptimization(sum_array);
+assertEquals(6, sum_array([1, 2, 3]));
+%OptimizeFunctionOnNextCall(sum_array);
+assertEquals(6, sum_array([1, 2, 3]));
+assertEquals(0, sum_array([]));
+
+// The loop bound is unrelated to the array, so the checks must stay.
+function sum_with_unrelated_bound(a, n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    sum += a[i];
+  }
+  return sum;
+}
+
+%PrepareFunctionForOptimization(sum_with_unrelated_bound);
+assertEquals(3, sum_with_unrelated_bound(new Int32Array([1, 2]), 2));
+%OptimizeFunctionOnNextCall(sum_with_unrelated_bound);
+assertEquals(3, sum_with_unrelated_bound(new Int32Array([1, 2]), 2));
+assertEquals(NaN, sum_with_unrelated_bound(new Int32Array([1, 2]), 3));
+
+function sum_dataview(dv) {
+  let sum = 0;
+  for (let i = 0; i < dv.byteLength; i++) {
+    sum += dv.getUint8(i);
+  }
+  return sum;
+}
+
+let dv = new DataView(new Uint8Array([1, 2, 3, 4]).buffer);
+%PrepareFunctionForOptimization(sum_dataview);
+assertEquals(10, sum_dataview(dv));
+%OptimizeFunctionOnNextCall(sum_dataview);
+assertEquals(10, sum_dataview(dv));
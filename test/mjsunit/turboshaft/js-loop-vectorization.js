@@ -0,0 +1,117 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --turboshaft --turboshaft-js-loop-vectorization
+// Flags: --allow-natives-syntax
+
+function test(f, make_args, expected) {
+  %PrepareFunctionForOptimization(f);
+  assertEquals(expected(), f(...make_args()));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(expected(), f(...make_args()));
+}
+
+function fill(array, f) {
+  for (let i = 0; i < array.length; i++) array[i] = f(i);
+  return array;
+}
+
+// Lengths that are and aren't multiples of the number of lanes.
+for (let n of [0, 1, 3, 4, 17, 100]) {
+  function add_f64(a, b, c) {
+    for (let i = 0; i < c.length; i++) {
+      c[i] = a[i] + b[i];
+    }
+    return Array.from(c);
+  }
+  test(add_f64,
+       () => [fill(new Float64Array(n), i => i * 0.5),
+              fill(new Float64Array(n), i => i * 1.5),
+              new Float64Array(n)],
+       () => Array.from(fill(new Float64Array(n), i => i * 2)));
+
+  function mul_add_f64(a, b, c, k) {
+    for (let i = 0; i < c.length; i++) {
+      c[i] = a[i] * b[i] + k;
+    }
+    return Array.from(c);
+  }
+  test(mul_add_f64,
+       () => [fill(new Float64Array(n), i => i),
+              fill(new Float64Array(n), i => i + 0.25),
+              new Float64Array(n), 3.5],
+       () => Array.from(fill(new Float64Array(n), i => i * (i + 0.25) + 3.5)));
+
+  function add_i32(a, b, c) {
+    for (let i = 0; i < c.length; i++) {
+      c[i] = a[i] + b[i];
+    }
+    return Array.from(c);
+  }
+  test(add_i32,
+       () => [fill(new Int32Array(n), i => 0x7fffffff - i),
+              fill(new Int32Array(n), i => i * 3),
+              new Int32Array(n)],
+       () => Array.from(fill(new Int32Array(n),
+                             i => ((0x7fffffff - i) + i * 3) | 0)));
+
+  function mul_f32(a, b, c) {
+    for (let i = 0; i < c.length; i++) {
+      c[i] = a[i] * b[i];
+    }
+    return Array.from(c);
+  }
+  test(mul_f32,
+       () => [fill(new Float32Array(n), i => i / 3),
+              fill(new Float32Array(n), i => i + 0.1),
+              new Float32Array(n)],
+       () => Array.from(fill(new Float32Array(n),
+                             i => Math.fround(Math.fround(i / 3) *
+                                              Math.fround(i + 0.1)))));
+}
+
+// The stored array overlaps the loaded array: the scalar loop propagates
+// values stored in previous iterations, which the vectorized loop must do as
+// well.
+(function() {
+  function shift(a, b, n) {
+    for (let i = 0; i < n; i++) {
+      b[i] = a[i] + 1;
+    }
+    return Array.from(a);
+  }
+  function make_args() {
+    let buffer = new Float64Array(20);
+    return [buffer.subarray(0, 19), buffer.subarray(1), 19];
+  }
+  test(shift, make_args,
+       () => Array.from(fill(new Float64Array(19), i => i)));
+})();
+
+// In-place updates are fine.
+(function() {
+  function scale(a, k) {
+    for (let i = 0; i < a.length; i++) {
+      a[i] = a[i] * k;
+    }
+    return Array.from(a);
+  }
+  test(scale, () => [fill(new Float64Array(9), i => i), 2],
+       () => Array.from(fill(new Float64Array(9), i => i * 2)));
+})();
+
+// Non-zero start.
+(function() {
+  function sub_from(a, b, c, start) {
+    for (let i = start; i < c.length; i++) {
+      c[i] = a[i] - b[i];
+    }
+    return Array.from(c);
+  }
+  test(sub_from,
+       () => [fill(new Float64Array(11), i => i * 4),
+              fill(new Float64Array(11), i => i),
+              new Float64Array(11), 3],
+       () => Array.from(fill(new Float64Array(11), i => i < 3 ? 0 : i * 3)));
+})();
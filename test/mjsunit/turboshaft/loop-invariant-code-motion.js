@@ -0,0 +1,54 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --turboshaft --turboshaft-licm --allow-natives-syntax
+
+// The loop header computes {a * b} and {a + b}, which only depend on values
+// defined before the loop and can thus be hoisted to the pre-header.
+function invariant_arith(a, b, n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    sum += (a * b) | 0;
+    sum += (a + b) | 0;
+  }
+  return sum;
+}
+
+%PrepareFunctionForOptimization(invariant_arith);
+assertEquals(0, invariant_arith(3, 4, 0));
+assertEquals(190, invariant_arith(3, 4, 10));
+%OptimizeFunctionOnNextCall(invariant_arith);
+assertEquals(0, invariant_arith(3, 4, 0));
+assertEquals(190, invariant_arith(3, 4, 10));
+assertEquals(-10, invariant_arith(-1, -1, 10));
+
+// Loads from an object that is written to in the loop must not be hoisted.
+function written_in_loop(o, n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    sum += o.x;
+    o.x = i;
+  }
+  return sum;
+}
+
+%PrepareFunctionForOptimization(written_in_loop);
+assertEquals(45 + 100 - 9, written_in_loop({x: 100}, 10));
+%OptimizeFunctionOnNextCall(written_in_loop);
+assertEquals(45 + 100 - 9, written_in_loop({x: 100}, 10));
+
+// Loads from an object that isn't modified in the loop can be hoisted.
+function read_only_loop(o, n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    sum += o.x;
+  }
+  return sum;
+}
+
+%PrepareFunctionForOptimization(read_only_loop);
+assertEquals(50, read_only_loop({x: 5}, 10));
+%OptimizeFunctionOnNextCall(read_only_loop);
+assertEquals(50, read_only_loop({x: 5}, 10));
+assertEquals(0, read_only_loop({x: 5}, 0));
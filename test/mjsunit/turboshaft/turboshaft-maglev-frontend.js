@@ -16,3 +16,15 @@ assertEquals(6, add_smi(3));
 assertOptimized(add_smi);
 assertEquals("aa", add_smi("a"));
 assertUnoptimized(add_smi);
+
+// Functions with nodes that cannot be translated from Maglev yet are
+// optimized through the bytecode graph builder instead.
+function call_and_compare(f, x) {
+  return f(x) < x * 2;
+}
+
+%PrepareFunctionForOptimization(call_and_compare);
+assertTrue(call_and_compare(add_smi, 3.5) === false);
+%OptimizeFunctionOnNextCall(call_and_compare);
+assertFalse(call_and_compare(add_smi, 3.5));
+assertOptimized(call_and_compare);
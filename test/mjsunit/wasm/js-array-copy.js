@@ -0,0 +1,100 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-wasm-js-array-copy
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+let builder = new WasmModuleBuilder();
+let kArrayI8 = builder.addArray(kWasmI8, true, kNoSuperType, true);
+let kArrayI16 = builder.addArray(kWasmI16, true, kNoSuperType, true);
+builder.addFunction('newI8', makeSig([kWasmI32], [wasmRefType(kArrayI8)]))
+    .addBody([
+      kExprLocalGet, 0,
+      kGCPrefix, kExprArrayNewDefault, kArrayI8,
+    ])
+    .exportFunc();
+builder.addFunction('newI16', makeSig([kWasmI32], [wasmRefType(kArrayI16)]))
+    .addBody([
+      kExprLocalGet, 0,
+      kGCPrefix, kExprArrayNewDefault, kArrayI16,
+    ])
+    .exportFunc();
+builder.addFunction('get', makeSig([wasmRefType(kArrayI8), kWasmI32],
+                                   [kWasmI32]))
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 1,
+      kGCPrefix, kExprArrayGetU, kArrayI8,
+    ])
+    .exportFunc();
+builder.addFunction('set', makeSig([wasmRefType(kArrayI8), kWasmI32,
+                                    kWasmI32], []))
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 1,
+      kExprLocalGet, 2,
+      kGCPrefix, kExprArraySet, kArrayI8,
+    ])
+    .exportFunc();
+let instance = builder.instantiate();
+let {newI8, newI16, get, set} = instance.exports;
+
+(function TestCopyToTypedArray() {
+  print(arguments.callee.name);
+  let array = newI8(8);
+  for (let i = 0; i < 8; ++i) set(array, i, i + 1);
+  let bytes = new Uint8Array(10);
+  WebAssembly.Array.copyToTypedArray(array, 2, bytes, 1, 5);
+  assertEquals([0, 3, 4, 5, 6, 7, 0, 0, 0, 0], Array.from(bytes));
+  let signed = new Int8Array(8);
+  set(array, 0, 0xff);
+  WebAssembly.Array.copyToTypedArray(array, 0, signed, 0, 8);
+  assertEquals([-1, 2, 3, 4, 5, 6, 7, 8], Array.from(signed));
+})();
+
+(function TestCopyFromTypedArray() {
+  print(arguments.callee.name);
+  let array = newI8(6);
+  let bytes = Uint8Array.from([10, 20, 30, 40]);
+  WebAssembly.Array.copyFromTypedArray(array, 1, bytes, 1, 3);
+  let result = [];
+  for (let i = 0; i < 6; ++i) result.push(get(array, i));
+  assertEquals([0, 20, 30, 40, 0, 0], result);
+  // Also works for typed arrays backed by a shared or resizable buffer.
+  let shared = new Uint8Array(new SharedArrayBuffer(4));
+  shared[3] = 99;
+  WebAssembly.Array.copyFromTypedArray(array, 5, shared, 3, 1);
+  assertEquals(99, get(array, 5));
+  let rab = new ArrayBuffer(2, {maxByteLength: 8});
+  let view = new Uint8Array(rab);
+  rab.resize(8);
+  WebAssembly.Array.copyToTypedArray(array, 0, view, 2, 6);
+  assertEquals([0, 0, 0, 20, 30, 40, 0, 99], Array.from(view));
+})();
+
+(function TestCopyErrors() {
+  print(arguments.callee.name);
+  let array = newI8(4);
+  let bytes = new Uint8Array(4);
+  let copy = WebAssembly.Array.copyToTypedArray;
+  // Out-of-bounds ranges trap, on either side.
+  assertTraps(kTrapArrayOutOfBounds, () => copy(array, 1, bytes, 0, 4));
+  assertTraps(kTrapArrayOutOfBounds, () => copy(array, 0, bytes, 1, 4));
+  assertTraps(kTrapArrayOutOfBounds, () => copy(array, -1, bytes, 0, 1));
+  assertTraps(kTrapArrayOutOfBounds, () => copy(array, 0, bytes, 0, -1));
+  // Empty copies at the end are fine.
+  copy(array, 4, bytes, 4, 0);
+  // Only i8 arrays and byte-sized typed arrays are supported.
+  assertTraps(kTrapIllegalCast, () => copy(newI16(4), 0, bytes, 0, 1));
+  assertTraps(kTrapIllegalCast, () => copy({}, 0, bytes, 0, 1));
+  assertTraps(kTrapNullDereference, () => copy(null, 0, bytes, 0, 1));
+  assertThrows(() => copy(array, 0, new Uint16Array(4), 0, 1), TypeError);
+  assertThrows(() => copy(array, 0, [0, 0], 0, 1), TypeError);
+  let buffer = new ArrayBuffer(4);
+  let detached = new Uint8Array(buffer);
+  buffer.transfer();
+  assertThrows(() => copy(array, 0, detached, 0, 1), TypeError,
+               /detached ArrayBuffer/);
+})();
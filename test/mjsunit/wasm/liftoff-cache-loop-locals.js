@@ -0,0 +1,70 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff --no-wasm-tier-up
+// Flags: --liftoff-cache-loop-locals
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+
+// sum of (a * i + b) for i in [0, n). {a} and {b} are only read in the loop and
+// stay in registers, {i} and {sum} are assigned and get spilled.
+builder.addFunction('sum', makeSig([kWasmI32, kWasmI32, kWasmI32], [kWasmI32]))
+    .addLocals(kWasmI32, 2)  // i, sum
+    .addBody([
+      kExprLoop, kWasmVoid,
+        kExprLocalGet, 4,
+        kExprLocalGet, 0, kExprLocalGet, 3, kExprI32Mul,
+        kExprLocalGet, 1, kExprI32Add,
+        kExprI32Add,
+        kExprLocalSet, 4,
+        kExprLocalGet, 3, kExprI32Const, 1, kExprI32Add,
+        kExprLocalTee, 3,
+        kExprLocalGet, 2, kExprI32LtS,
+        kExprBrIf, 0,
+      kExprEnd,
+      kExprLocalGet, 4,
+    ])
+    .exportFunc();
+
+// Nested loops, with a read-only local that is also on the value stack when
+// entering the loops.
+builder.addFunction('nested', makeSig([kWasmI32, kWasmI32], [kWasmI32]))
+    .addLocals(kWasmI32, 3)  // i, j, sum
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLoop, kWasmVoid,
+        kExprI32Const, 0, kExprLocalSet, 3,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 4, kExprLocalGet, 0, kExprI32Add, kExprLocalSet, 4,
+          kExprLocalGet, 3, kExprI32Const, 1, kExprI32Add,
+          kExprLocalTee, 3,
+          kExprLocalGet, 1, kExprI32LtS,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 2, kExprI32Const, 1, kExprI32Add,
+        kExprLocalTee, 2,
+        kExprLocalGet, 1, kExprI32LtS,
+        kExprBrIf, 0,
+      kExprEnd,
+      kExprLocalGet, 4,
+      kExprI32Add,
+    ])
+    .exportFunc();
+
+const instance = builder.instantiate();
+
+function sum(a, b, n) {
+  let result = 0;
+  for (let i = 0; i < n; ++i) result = (result + a * i + b) | 0;
+  return result;
+}
+
+for (const [a, b, n] of [[0, 0, 0], [1, 2, 1], [3, -4, 10], [7, 11, 1000]]) {
+  assertTrue(%IsLiftoffFunction(instance.exports.sum));
+  assertEquals(sum(a, b, n), instance.exports.sum(a, b, n));
+}
+assertEquals(5 + 5 * 3 * 3, instance.exports.nested(5, 3));
+assertEquals(-2 + -2 * 10 * 10, instance.exports.nested(-2, 10));
@@ -0,0 +1,44 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-wasm-memory64 --wasm-memory64-trap-handling
+// Flags: --wasm-memory64-guard-regions-max-pages=16
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Memories up to 16 pages use guard regions, larger ones explicit bounds
+// checks. Both must behave the same.
+function TestOutOfBounds(max_pages) {
+  print(`Testing memory64 with maximum of ${max_pages} pages`);
+  let builder = new WasmModuleBuilder();
+  builder.addMemory64(1, max_pages);
+  builder.exportMemoryAs('memory');
+  builder.addFunction('load', makeSig([kWasmF64], [kWasmI32]))
+      .addBody([
+        kExprLocalGet, 0,           // local.get 0
+        kExprI64UConvertF64,        // i64.uconvert_sat.f64
+        kExprI32LoadMem, 2, 0x10,   // load with offset 16
+      ])
+      .exportFunc();
+  builder.addFunction('grow', kSig_l_l)
+      .addBody([kExprLocalGet, 0, kExprMemoryGrow, 0])
+      .exportFunc();
+  let instance = builder.instantiate();
+  let load = instance.exports.load;
+
+  assertEquals(0, load(kPageSize - 20));
+  assertTraps(kTrapMemOutOfBounds, () => load(kPageSize - 19));
+  assertTraps(kTrapMemOutOfBounds, () => load(max_pages * kPageSize));
+  // Indexes beyond the guard regions must trap as well.
+  assertTraps(kTrapMemOutOfBounds, () => load(64 * kPageSize));
+  assertTraps(kTrapMemOutOfBounds, () => load(2 ** 40));
+  assertTraps(kTrapMemOutOfBounds, () => load(2 ** 53));
+
+  assertEquals(1n, instance.exports.grow(BigInt(max_pages - 1)));
+  assertEquals(0, load(max_pages * kPageSize - 20));
+  assertTraps(kTrapMemOutOfBounds, () => load(max_pages * kPageSize - 19));
+}
+
+TestOutOfBounds(16);
+TestOutOfBounds(17);
@@ -0,0 +1,54 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-shared-import-wrapper-cache --no-wasm-to-js-generic-wrapper
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+function InstantiateWithImport(sig, imp, body) {
+  let builder = new WasmModuleBuilder();
+  let imp_index = builder.addImport('m', 'f', sig);
+  builder.addFunction('main', sig).addBody(body(imp_index)).exportFunc();
+  return builder.instantiate({m: {f: imp}}).exports.main;
+}
+
+(function TestWrappersSharedBetweenModules() {
+  print(arguments.callee.name);
+  let call_add = idx => [
+    kExprLocalGet, 0, kExprLocalGet, 1, kExprCallFunction, idx
+  ];
+  // Several modules with the same import signature, with matching and
+  // mismatching arity.
+  let add = (a, b) => a + b;
+  let first = (a) => a;
+  let sum = (...args) => args.reduce((a, b) => a + b, 0);
+  for (let i = 0; i < 3; ++i) {
+    assertEquals(5, InstantiateWithImport(kSig_i_ii, add, call_add)(2, 3));
+    assertEquals(2, InstantiateWithImport(kSig_i_ii, first, call_add)(2, 3));
+    assertEquals(5, InstantiateWithImport(kSig_i_ii, sum, call_add)(2, 3));
+    assertEquals(
+        7.5, InstantiateWithImport(kSig_d_dd, add, call_add)(2.5, 5));
+  }
+})();
+
+(function TestModuleSpecificTypesAreNotShared() {
+  print(arguments.callee.name);
+  // Signatures with indexed reference types use per-module wrappers.
+  for (let i = 0; i < 2; ++i) {
+    let builder = new WasmModuleBuilder();
+    let struct = builder.addStruct([makeField(kWasmI32, true)]);
+    let sig = makeSig([wasmRefNullType(struct)], [wasmRefNullType(struct)]);
+    let imp_index = builder.addImport('m', 'f', sig);
+    builder.addFunction('main', kSig_i_v)
+        .addBody([
+          kExprI32Const, 42,
+          kGCPrefix, kExprStructNew, struct,
+          kExprCallFunction, imp_index,
+          kGCPrefix, kExprStructGet, struct, 0,
+        ])
+        .exportFunc();
+    let instance = builder.instantiate({m: {f: x => x}});
+    assertEquals(42, instance.exports.main());
+  }
+})();
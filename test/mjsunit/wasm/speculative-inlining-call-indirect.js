@@ -0,0 +1,88 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-wasm-inlining --wasm-inlining-call-indirect
+// Flags: --no-wasm-tier-up --wasm-dynamic-tiering --allow-natives-syntax
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+function createModule() {
+  let builder = new WasmModuleBuilder();
+  let sig_index = builder.addType(kSig_i_i);
+  let global = builder.addGlobal(kWasmI32, true, false);
+
+  // f0(x) = x - 1
+  let f0 = builder.addFunction("f0", sig_index)
+    .addBody([kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub])
+    .exportFunc();
+  // f1(x) = x + global
+  let f1 = builder.addFunction("f1", sig_index)
+    .addBody([kExprLocalGet, 0, kExprGlobalGet, global.index, kExprI32Add])
+    .exportFunc();
+  // f2 has an incompatible signature.
+  let f2 = builder.addFunction("f2", kSig_v_v).addBody([]);
+
+  builder.addFunction("setGlobal", kSig_v_i)
+    .addBody([kExprLocalGet, 0, kExprGlobalSet, global.index])
+    .exportFunc();
+
+  // main(x, i) = table[i](x)
+  builder.addFunction("main", kSig_i_ii)
+    .addBody([kExprLocalGet, 0, kExprLocalGet, 1,
+              kExprCallIndirect, sig_index, kTableZero])
+    .exportFunc();
+  // tail(x, i) = return table[i](x)
+  builder.addFunction("tail", kSig_i_ii)
+    .addBody([kExprLocalGet, 0, kExprLocalGet, 1,
+              kExprReturnCallIndirect, sig_index, kTableZero])
+    .exportFunc();
+
+  builder.appendToTable([f0.index, f1.index, f2.index]);
+  builder.addExportOfKind("table", kExternalTable, 0);
+  return builder.toModule();
+}
+
+const module = createModule();
+
+(function CallIndirectSpecSucceededTest() {
+  print(arguments.callee.name);
+  let instance = new WebAssembly.Instance(module);
+  for (let i = 0; i < 20; i++) assertEquals(9, instance.exports.main(10, 0));
+  assertEquals(9, instance.exports.tail(10, 0));
+  %WasmTierUpFunction(instance.exports.main);
+  // The tiered-up function should have {f0} speculatively inlined.
+  assertEquals(9, instance.exports.main(10, 0));
+  // Other entries take the generic path.
+  instance.exports.setGlobal(5);
+  assertEquals(15, instance.exports.main(10, 1));
+  assertTraps(kTrapFuncSigMismatch, () => instance.exports.main(10, 2));
+  assertTraps(kTrapTableOutOfBounds, () => instance.exports.main(10, 3));
+})();
+
+(function CallIndirectSpecTableChangedTest() {
+  print(arguments.callee.name);
+  let instance = new WebAssembly.Instance(module);
+  let other = new WebAssembly.Instance(module);
+  instance.exports.setGlobal(1);
+  other.exports.setGlobal(2);
+  for (let i = 0; i < 20; i++) assertEquals(11, instance.exports.main(10, 1));
+  %WasmTierUpFunction(instance.exports.main);
+  assertEquals(11, instance.exports.main(10, 1));
+  // The same function of another instance must not hit the inlined case.
+  instance.exports.table.set(1, other.exports.f1);
+  assertEquals(12, instance.exports.main(10, 1));
+  instance.exports.table.set(1, instance.exports.f0);
+  assertEquals(9, instance.exports.main(10, 1));
+})();
+
+(function CallIndirectMegamorphicTest() {
+  print(arguments.callee.name);
+  let instance = new WebAssembly.Instance(module);
+  for (let i = 0; i < 20; i++) {
+    assertEquals(i % 2 ? 10 : 9, instance.exports.main(10, i % 2));
+  }
+  %WasmTierUpFunction(instance.exports.main);
+  assertEquals(9, instance.exports.main(10, 0));
+  assertEquals(10, instance.exports.main(10, 1));
+})();
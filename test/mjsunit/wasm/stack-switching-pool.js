@@ -0,0 +1,42 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-wasm-stack-switching --expose-gc
+// Flags: --wasm-stack-switching-stack-size=100 --wasm-stack-pool-size=400
+
+// Creates and retires many stacks, so that stacks are both reused from the
+// pool and freed because the pool is full.
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function TestStackPoolReuse() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  let import_index = builder.addImport('m', 'import', kSig_i_r);
+  builder.addFunction('test', kSig_i_r)
+      .addBody([
+        kExprLocalGet, 0,
+        kExprCallFunction, import_index,  // suspend
+        kExprI32Const, 1,
+        kExprI32Add,
+      ])
+      .exportFunc();
+  let js_import = new WebAssembly.Function(
+      {parameters: ['externref'], results: ['i32']},
+      () => Promise.resolve(41), {suspending: 'first'});
+  let instance = builder.instantiate({m: {import: js_import}});
+  let wrapped_export = ToPromising(instance.exports.test);
+
+  async function run() {
+    for (let round = 0; round < 10; ++round) {
+      let promises = [];
+      for (let i = 0; i < 20; ++i) promises.push(wrapped_export());
+      for (let v of await Promise.all(promises)) assertEquals(42, v);
+      // Collect the finished continuations, returning their stacks to the
+      // pool.
+      gc();
+    }
+  }
+  assertPromiseResult(run());
+})();
@@ -0,0 +1,31 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-test-streaming --wasm-lazy-validation
+// Flags: --wasm-streaming-background-validation
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function testBackgroundValidationDefersErrors() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  builder.addFunction('valid', kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprI32Const, 1, kExprI32Add])
+      .exportFunc();
+  builder.addFunction('invalid', kSig_i_i)
+      .addBody([kExprLocalGet, 0, kExprI64Const, 1, kExprI32Mul])
+      .exportFunc();
+
+  // The validation error found in the background must not fail the module;
+  // it is only reported once the invalid function gets called.
+  let bytes = builder.toBuffer();
+  assertPromiseResult(
+      WebAssembly.instantiateStreaming(Promise.resolve(bytes))
+          .then(({module, instance}) => {
+            assertEquals(4, instance.exports.valid(3));
+            assertThrows(
+                () => instance.exports.invalid(3), WebAssembly.CompileError,
+                /Compiling function #1:"invalid" failed/);
+          }));
+})();
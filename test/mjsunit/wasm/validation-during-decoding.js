@@ -0,0 +1,56 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-lazy-compilation --no-wasm-lazy-validation
+// Flags: --wasm-background-validation-during-decoding
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const kNumFunctions = 200;
+
+function buildModule(invalid_index) {
+  let builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1);
+  for (let i = 0; i < kNumFunctions; ++i) {
+    let body = i == invalid_index ?
+        [kExprLocalGet, 0, kExprI64Const, 1, kExprI32Mul] :
+        [kExprLocalGet, 0, ...wasmI32Const(i), kExprI32Add];
+    builder.addFunction('f' + i, kSig_i_i).addBody(body).exportFunc();
+  }
+  // A data section (and the name section) follow the code section and are
+  // decoded while function bodies get validated.
+  builder.addDataSegment(0, [1, 2, 3, 4]);
+  return builder.toBuffer();
+}
+
+(function testValidModule() {
+  print(arguments.callee.name);
+  let bytes = buildModule(-1);
+  assertTrue(WebAssembly.validate(bytes));
+  let instance = new WebAssembly.Instance(new WebAssembly.Module(bytes));
+  assertEquals(7 + 123, instance.exports.f123(7));
+})();
+
+(function testInvalidFunction() {
+  print(arguments.callee.name);
+  let bytes = buildModule(kNumFunctions - 3);
+  assertFalse(WebAssembly.validate(bytes));
+  assertThrows(
+      () => new WebAssembly.Module(bytes), WebAssembly.CompileError,
+      /Compiling function #197:"f197" failed/);
+})();
+
+(function testStructureErrorAfterCodeSectionWins() {
+  print(arguments.callee.name);
+  let module_bytes = buildModule(5);
+  // Append a truncated section; this module structure error must be reported
+  // instead of the validation error found in the background.
+  let bytes = new Uint8Array(module_bytes.length + 2);
+  bytes.set(new Uint8Array(module_bytes));
+  bytes.set([kUnknownSectionCode, 10], module_bytes.length);
+  assertFalse(WebAssembly.validate(bytes));
+  assertThrows(
+      () => new WebAssembly.Module(bytes), WebAssembly.CompileError,
+      /extends past end of the module/);
+})();
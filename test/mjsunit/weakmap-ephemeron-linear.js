@@ -0,0 +1,29 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-gc --ephemeron-fixpoint-iterations=0
+
+// Builds two levels of ephemerons that are wide enough for a single round of
+// the linear ephemeron algorithm to discover tens of thousands of keys at once.
+
+const kWidth = 40000;
+const map = new WeakMap();
+const roots = [];
+
+(function () {
+  for (let i = 0; i < kWidth; ++i) {
+    const key = {};
+    const inner_key = {};
+    roots.push(key);
+    map.set(inner_key, {index: i});
+    map.set(key, {next: inner_key});
+  }
+})();
+
+gc();
+
+for (let i = 0; i < kWidth; ++i) {
+  const inner_key = map.get(roots[i]).next;
+  assertEquals(i, map.get(inner_key).index);
+}
@@ -10,6 +10,7 @@
 #include "include/v8-primitive.h"
 #include "include/v8-script.h"
 #include "src/codegen/compilation-cache.h"
+#include "src/flags/flags.h"
 #include "test/unittests/heap/heap-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -725,6 +726,58 @@ TEST_F(MergeDeserializedCodeTest, MergeWithNoFollowUpWork) {
            GetSharedFunctionInfo(original_script));
 }
 
+TEST_F(MergeDeserializedCodeTest, MergeOnMainThreadWithoutBackgroundMerge) {
+  i::v8_flags.merge_background_deserialized_script_with_compilation_cache =
+      true;
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cached_data;
+  IsolateAndContextScope scope(this);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate());
+  i::DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      i_isolate->heap());
+
+  ScriptOrigin default_origin(NewString(""));
+
+  constexpr char kSourceCode[] = "function f() {}";
+  Local<Script> original_script;
+  {
+    v8::EscapableHandleScope handle_scope(isolate());
+    Local<Script> script =
+        Script::Compile(context(), NewString(kSourceCode), &default_origin)
+            .ToLocalChecked();
+    cached_data.reset(
+        ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+    original_script = handle_scope.Escape(script);
+  }
+
+  // Age the top-level bytecode so that the Isolate compilation cache will
+  // contain only the Script.
+  i::SharedFunctionInfo::EnsureOldForTesting(
+      GetSharedFunctionInfo(original_script));
+  InvokeMajorGC(i_isolate);
+  InvokeMajorGC(i_isolate);
+
+  DeserializeThread deserialize_thread(ScriptCompiler::StartConsumingCodeCache(
+      isolate(), std::make_unique<ScriptCompiler::CachedData>(
+                     cached_data->data, cached_data->length,
+                     ScriptCompiler::CachedData::BufferNotOwned)));
+  CHECK(deserialize_thread.Start());
+  deserialize_thread.Join();
+
+  // Finish without SourceTextAvailable or MergeWithExistingScript. The
+  // deserialized content should still end up in the original Script.
+  ScriptCompiler::Source source(NewString(kSourceCode), default_origin,
+                                cached_data.release(),
+                                deserialize_thread.TakeTask().release());
+  Local<Script> script =
+      ScriptCompiler::Compile(context(), &source,
+                              ScriptCompiler::kConsumeCodeCache)
+          .ToLocalChecked();
+
+  CHECK_EQ(GetSharedFunctionInfo(script)->script(),
+           GetSharedFunctionInfo(original_script)->script());
+  CHECK(!script->Run(context()).IsEmpty());
+}
+
 TEST_F(MergeDeserializedCodeTest, MergeThatCompilesLazyFunction) {
   i::v8_flags.merge_background_deserialized_script_with_compilation_cache =
       true;
@@ -908,4 +961,32 @@ TEST_F(MergeDeserializedCodeTest, MergeThatStartsButDoesNotFinish) {
   }
 }
 
+// Check that scripts compiled without cached data go through the persistent
+// code cache given by --code-cache-dir, and that entries evicting each other
+// from the same slot are told apart.
+TEST_F(DeserializeTest, CodeCacheDir) {
+  std::string directory = testing::TempDir();
+  const char* old_directory = i::v8_flags.code_cache_dir;
+  unsigned old_max_entries = i::v8_flags.code_cache_dir_max_entries;
+  i::v8_flags.code_cache_dir = directory.c_str();
+  i::v8_flags.code_cache_dir_max_entries = 1;
+
+  const char* kSources[] = {"function foo() { return 42; }",
+                            "function foo() { return 43; }"};
+  for (int round = 0; round < 2; ++round) {
+    for (int i = 0; i < 2; ++i) {
+      for (int repeat = 0; repeat < 2; ++repeat) {
+        IsolateAndContextScope scope(this);
+        Local<Script> script =
+            Script::Compile(context(), NewString(kSources[i])).ToLocalChecked();
+        CHECK(!script->Run(context()).IsEmpty());
+        CHECK_EQ(RunGlobalFunc("foo"), Integer::New(isolate(), 42 + i));
+      }
+    }
+  }
+
+  i::v8_flags.code_cache_dir = old_directory;
+  i::v8_flags.code_cache_dir_max_entries = old_max_entries;
+}
+
 }  // namespace v8
@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <limits>
+
 #include "include/v8-container.h"
 #include "include/v8-primitive.h"
 #include "include/v8-value.h"
@@ -148,5 +150,44 @@ TEST_F(ArrayTest, IterateEarlyTermination) {
   CHECK(array->Iterate(context(), break_callback, nullptr).IsJust());
 }
 
+TEST_F(ArrayTest, NewFromNativeElements) {
+  HandleScope scope(isolate());
+  const double doubles[] = {1.5, -0.0, 3};
+  Local<Array> double_array = Array::New(isolate(), doubles);
+  CHECK_EQ(3u, double_array->Length());
+  for (uint32_t i = 0; i < 3; i++) {
+    CHECK_EQ(doubles[i], double_array->Get(context(), i)
+                             .ToLocalChecked()
+                             ->NumberValue(context())
+                             .FromJust());
+  }
+
+  const int32_t ints[] = {0, -7, std::numeric_limits<int32_t>::max()};
+  Local<Array> int_array = Array::New(isolate(), ints);
+  CHECK_EQ(3u, int_array->Length());
+  for (uint32_t i = 0; i < 3; i++) {
+    CHECK_EQ(ints[i], int_array->Get(context(), i)
+                          .ToLocalChecked()
+                          ->Int32Value(context())
+                          .FromJust());
+  }
+
+  const char* strings[] = {"foo", "b\xc3\xa4r", "bazqux"};
+  const int lengths[] = {-1, -1, 3};
+  Local<Array> string_array =
+      Array::New(isolate(), strings, lengths, 3).ToLocalChecked();
+  CHECK_EQ(3u, string_array->Length());
+  Local<Value> expected[] = {
+      String::NewFromUtf8Literal(isolate(), "foo"),
+      String::NewFromUtf8Literal(isolate(), "b\xc3\xa4r"),
+      String::NewFromUtf8Literal(isolate(), "baz")};
+  for (uint32_t i = 0; i < 3; i++) {
+    CHECK(string_array->Get(context(), i).ToLocalChecked()->StrictEquals(
+        expected[i]));
+  }
+
+  CHECK_EQ(0u, Array::New(isolate(), MemorySpan<const double>())->Length());
+}
+
 }  // namespace
 }  // namespace v8
@@ -8,6 +8,7 @@
 #include "include/v8-local-handle.h"
 #include "include/v8-primitive.h"
 #include "include/v8-template.h"
+#include "src/api/api-inl.h"
 #include "src/objects/objects-inl.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -37,6 +38,91 @@ TEST_F(ObjectTest, SetAccessorWhenUnconfigurablePropAlreadyDefined) {
   ASSERT_FALSE(try_catch.HasCaught());
 }
 
+TEST_F(ObjectTest, DictionaryTemplateInstancesShareFastMap) {
+  Local<Name> names[] = {String::NewFromUtf8Literal(isolate(), "a"),
+                         String::NewFromUtf8Literal(isolate(), "b")};
+  Local<DictionaryTemplate> tmpl =
+      DictionaryTemplate::New(isolate(), names, arraysize(names));
+
+  Local<Value> values1[] = {Integer::New(isolate(), 1),
+                            String::NewFromUtf8Literal(isolate(), "one")};
+  Local<Value> values2[] = {Integer::New(isolate(), 2),
+                            String::NewFromUtf8Literal(isolate(), "two")};
+  Local<Object> obj1 =
+      tmpl->NewInstance(context(), values1, arraysize(values1))
+          .ToLocalChecked();
+  Local<Object> obj2 =
+      tmpl->NewInstance(context(), values2, arraysize(values2))
+          .ToLocalChecked();
+
+  auto i_obj1 = Utils::OpenDirectHandle(*obj1);
+  auto i_obj2 = Utils::OpenDirectHandle(*obj2);
+  EXPECT_TRUE(internal::JSObject::cast(*i_obj1)->HasFastProperties());
+  EXPECT_EQ(i_obj1->map(), i_obj2->map());
+  EXPECT_EQ(2, obj2->Get(context(), names[0])
+                   .ToLocalChecked()
+                   ->Int32Value(context())
+                   .FromJust());
+  EXPECT_TRUE(obj2->Get(context(), names[1])
+                  .ToLocalChecked()
+                  ->StrictEquals(values2[1]));
+
+  // A value that does not fit the field representation generalizes the
+  // shared map instead of falling back to dictionary mode.
+  Local<Value> values3[] = {Number::New(isolate(), 2.5),
+                            Undefined(isolate())};
+  Local<Object> obj3 =
+      tmpl->NewInstance(context(), values3, arraysize(values3))
+          .ToLocalChecked();
+  EXPECT_TRUE(internal::JSObject::cast(*Utils::OpenDirectHandle(*obj3))
+                  ->HasFastProperties());
+  EXPECT_EQ(2.5, obj3->Get(context(), names[0])
+                     .ToLocalChecked()
+                     ->NumberValue(context())
+                     .FromJust());
+}
+
+TEST_F(ObjectTest, DictionaryTemplateWithIndexName) {
+  Local<Name> names[] = {String::NewFromUtf8Literal(isolate(), "0"),
+                         String::NewFromUtf8Literal(isolate(), "x")};
+  Local<DictionaryTemplate> tmpl =
+      DictionaryTemplate::New(isolate(), names, arraysize(names));
+  Local<Value> values[] = {Integer::New(isolate(), 7),
+                           Integer::New(isolate(), 8)};
+  Local<Object> obj =
+      tmpl->NewInstance(context(), values, arraysize(values)).ToLocalChecked();
+  EXPECT_EQ(7, obj->Get(context(), 0)
+                   .ToLocalChecked()
+                   ->Int32Value(context())
+                   .FromJust());
+  EXPECT_EQ(8, obj->Get(context(), names[1])
+                   .ToLocalChecked()
+                   ->Int32Value(context())
+                   .FromJust());
+}
+
+TEST_F(ObjectTest, PreparedFunctionCall) {
+  Local<Function> add =
+      RunJS("(function(a, b) { return this.base + a + b; })").As<Function>();
+  Local<Object> recv = RunJS("({base: 100})").As<Object>();
+  PreparedFunctionCall call(isolate(), add, 2);
+  EXPECT_EQ(2, call.argc());
+  for (int i = 0; i < 3; ++i) {
+    HandleScope scope(isolate());
+    call.SetArgument(0, Integer::New(isolate(), i));
+    call.SetArgument(1, Integer::New(isolate(), 10));
+    Local<Value> result = call.Call(context(), recv).ToLocalChecked();
+    EXPECT_EQ(110 + i, result->Int32Value(context()).FromJust());
+  }
+
+  Local<Function> thrower =
+      RunJS("(function() { throw new Error('boom'); })").As<Function>();
+  PreparedFunctionCall throwing_call(isolate(), thrower, 0);
+  TryCatch try_catch(isolate());
+  EXPECT_TRUE(throwing_call.Call(context(), recv).IsEmpty());
+  EXPECT_TRUE(try_catch.HasCaught());
+}
+
 using LapContextTest = TestWithIsolate;
 
 TEST_F(LapContextTest, CurrentContextInLazyAccessorOnPrototype) {
@@ -507,6 +507,77 @@ TEST_F(CompileHintsTest, StreamingCompileHints) {
   EXPECT_FALSE(FunctionIsCompiled("func2"));
 }
 
+namespace {
+
+class StreamingMergeThread : public base::Thread {
+ public:
+  explicit StreamingMergeThread(ScriptCompiler::ScriptStreamingTask* task)
+      : Thread(base::Thread::Options("StreamingMergeThread")), task_(task) {}
+
+  void Run() override { task_->MergeWithExistingScript(); }
+
+ private:
+  ScriptCompiler::ScriptStreamingTask* task_;
+};
+
+}  // namespace
+
+TEST_F(ScriptTest, StreamingMergeWithExistingScript) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate());
+  i::DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      i_isolate->heap());
+  const char* url = "http://www.foo.com/merge.js";
+  v8::ScriptOrigin origin(NewString(url), 0, 0);
+
+  const char* chunks[] = {"function f() { return 1; }\n", "f();", nullptr};
+  std::unique_ptr<char[]> full_source(
+      i::TestSourceStream::FullSourceString(chunks));
+
+  // Compile the script once to populate the compilation cache, then age its
+  // top-level bytecode so that the cache only retains the Script.
+  v8::Global<Script> original_script;
+  {
+    v8::HandleScope handle_scope(isolate());
+    v8::ScriptCompiler::Source script_source(NewString(full_source.get()),
+                                             origin);
+    Local<Script> script =
+        v8::ScriptCompiler::Compile(v8_context(), &script_source)
+            .ToLocalChecked();
+    original_script.Reset(isolate(), script);
+    i::SharedFunctionInfo::EnsureOldForTesting(
+        i::Handle<i::JSFunction>::cast(Utils::OpenHandle(*script))->shared());
+  }
+  InvokeMajorGC();
+  // A second GC is necessary in case incremental marking had already started
+  // before the bytecode was aged.
+  InvokeMajorGC();
+
+  v8::ScriptCompiler::StreamedSource source(
+      std::make_unique<i::TestSourceStream>(chunks),
+      v8::ScriptCompiler::StreamedSource::ONE_BYTE);
+  std::unique_ptr<v8::ScriptCompiler::ScriptStreamingTask> task(
+      v8::ScriptCompiler::StartStreaming(isolate(), &source));
+
+  task->SourceTextAvailable(isolate(), NewString(full_source.get()), origin);
+  StreamerThread::StartThreadForTaskAndJoin(task.get());
+
+  ASSERT_TRUE(task->ShouldMergeWithExistingScript());
+  StreamingMergeThread merge_thread(task.get());
+  CHECK(merge_thread.Start());
+  merge_thread.Join();
+  task.reset();
+
+  v8::Local<Script> script =
+      v8::ScriptCompiler::Compile(v8_context(), &source,
+                                  NewString(full_source.get()), origin)
+          .ToLocalChecked();
+  EXPECT_EQ(script->GetUnboundScript()->GetId(),
+            original_script.Get(isolate())->GetUnboundScript()->GetId());
+
+  v8::Local<v8::Value> result = script->Run(v8_context()).ToLocalChecked();
+  EXPECT_EQ(1, result->Int32Value(v8_context()).FromJust());
+}
+
 TEST_F(ScriptTest, CompileHintsMagicCommentBasic) {
   i::FlagScope<bool> flag_scope(&i::v8_flags.compile_hints_magic, true);
 
@@ -1546,6 +1546,16 @@ TEST_F(DisasmX64Test, DisasmX64YMMRegister) {
             vpmovzxwd(ymm7, Operand(rbx, rcx, times_4, 10000)));
     COMPARE("c4627d35c6           vpmovzxdq ymm8,ymm6", vpmovzxdq(ymm8, ymm6));
   }
+
+  if (!CpuFeatures::IsSupported(AVX_VNNI)) return;
+  {
+    CpuFeatureScope fscope(t.assm(), AVX_VNNI);
+
+    COMPARE("c4e27150c2           vpdpbusd xmm0,xmm1,xmm2",
+            vpdpbusd(xmm0, xmm1, xmm2));
+    COMPARE("c4e27550c2           vpdpbusd ymm0,ymm1,ymm2",
+            vpdpbusd(ymm0, ymm1, ymm2));
+  }
 }
 
 #undef __
@@ -76,6 +76,74 @@ TEST(OS, RemapPages) {
   }
 }
 
+TEST(OS, RemapSharedCopy) {
+  if constexpr (OS::IsRemapSharedCopySupported()) {
+    const size_t size = OS::AllocatePageSize();
+    ASSERT_TRUE(size <= kMaxPageSize);
+    // Copy fewer bytes than a page, the rest of the mapping is zeroed.
+    const size_t copied = strlen(kArray) + 1;
+
+    void* first = OS::Allocate(nullptr, size, OS::AllocatePageSize(),
+                               OS::MemoryPermission::kNoAccess);
+    void* second = OS::Allocate(nullptr, size, OS::AllocatePageSize(),
+                                OS::MemoryPermission::kNoAccess);
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+
+    // Memory files may not be mappable as executable in the running kernel.
+    if (OS::RemapSharedCopy(kArray, copied, first,
+                            OS::MemoryPermission::kReadExecute)) {
+      EXPECT_EQ(0, memcmp(first, kArray, copied));
+      EXPECT_EQ(0, static_cast<const char*>(first)[size - 1]);
+      EXPECT_TRUE(OS::RemapSharedCopy(kArray, copied, second,
+                                      OS::MemoryPermission::kReadExecute));
+      EXPECT_EQ(0, memcmp(second, kArray, copied));
+    }
+
+    OS::Free(first, size);
+    OS::Free(second, size);
+  }
+}
+
+TEST(OS, AdviseHugePages) {
+  if constexpr (OS::IsHugePagesSupported()) {
+    const size_t size = 2 * OS::kHugePageSize;
+    uint8_t* data = static_cast<uint8_t*>(OS::Allocate(
+        nullptr, size, OS::kHugePageSize, OS::MemoryPermission::kReadWrite));
+    ASSERT_TRUE(data);
+
+    // Transparent huge pages may be disabled in the running kernel, in which
+    // case the call fails. Either way the memory must stay usable.
+    USE(OS::AdviseHugePages(data, size));
+    memset(data, 0x42, size);
+    EXPECT_EQ(0x42, data[0]);
+    EXPECT_EQ(0x42, data[size - 1]);
+
+    OS::Free(data, size);
+  }
+}
+
+TEST(OS, MarkPagesMergeable) {
+  if constexpr (OS::IsMergeablePagesSupported()) {
+    const size_t size = base::OS::AllocatePageSize();
+    uint8_t* data = static_cast<uint8_t*>(
+        OS::Allocate(nullptr, size, base::OS::AllocatePageSize(),
+                     OS::MemoryPermission::kReadWrite));
+    ASSERT_TRUE(data);
+    memset(data, 0x42, size);
+
+    // Merging may be unavailable in the running kernel, in which case the
+    // call fails. Either way the contents must be left intact and writable.
+    USE(OS::MarkPagesMergeable(data, size));
+    EXPECT_EQ(0x42, data[0]);
+    EXPECT_EQ(0x42, data[size - 1]);
+    data[0] = 0x17;
+    EXPECT_EQ(0x17, data[0]);
+
+    OS::Free(data, size);
+  }
+}
+
 #ifdef V8_TARGET_OS_LINUX
 TEST(OS, ParseProcMaps) {
   // Truncated
@@ -0,0 +1,137 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/numbers/schubfach-dtoa.h"
+
+#include <string.h>
+
+#include "src/base/numbers/bignum-dtoa.h"
+#include "src/base/numbers/double.h"
+#include "src/base/utils/random-number-generator.h"
+#include "test/unittests/gay-shortest.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace base {
+namespace test_schubfach_dtoa {
+
+using SchubfachDtoaTest = ::testing::Test;
+
+static const int kBufferSize = 100;
+
+TEST_F(SchubfachDtoaTest, VariousDoubles) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+
+  SchubfachDtoa(1.0, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("1", buffer.begin()));
+  CHECK_EQ(1, point);
+
+  SchubfachDtoa(1.5, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("15", buffer.begin()));
+  CHECK_EQ(1, point);
+
+  SchubfachDtoa(0.1, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("1", buffer.begin()));
+  CHECK_EQ(0, point);
+
+  SchubfachDtoa(1e23, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("1", buffer.begin()));
+  CHECK_EQ(24, point);
+
+  double min_double = 5e-324;
+  SchubfachDtoa(min_double, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("5", buffer.begin()));
+  CHECK_EQ(-323, point);
+
+  double max_double = 1.7976931348623157e308;
+  SchubfachDtoa(max_double, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("17976931348623157", buffer.begin()));
+  CHECK_EQ(309, point);
+
+  SchubfachDtoa(4294967272.0, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("4294967272", buffer.begin()));
+  CHECK_EQ(10, point);
+
+  SchubfachDtoa(4.1855804968213567e298, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("4185580496821357", buffer.begin()));
+  CHECK_EQ(299, point);
+
+  SchubfachDtoa(5.5626846462680035e-309, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("5562684646268003", buffer.begin()));
+  CHECK_EQ(-308, point);
+
+  // FastDtoa cannot decide this one and has to fall back to bignums.
+  SchubfachDtoa(3.5844466002796428e+298, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("35844466002796428", buffer.begin()));
+  CHECK_EQ(299, point);
+
+  uint64_t smallest_normal64 = 0x0010'0000'0000'0000;
+  SchubfachDtoa(Double(smallest_normal64).value(), buffer, &length, &point);
+  CHECK_EQ(0, strcmp("22250738585072014", buffer.begin()));
+  CHECK_EQ(-307, point);
+
+  uint64_t largest_denormal64 = 0x000F'FFFF'FFFF'FFFF;
+  SchubfachDtoa(Double(largest_denormal64).value(), buffer, &length, &point);
+  CHECK_EQ(0, strcmp("2225073858507201", buffer.begin()));
+  CHECK_EQ(-307, point);
+
+  // 2^53 + 2 has a shorter neighbor in its rounding interval only on the
+  // upper side.
+  SchubfachDtoa(9007199254740994.0, buffer, &length, &point);
+  CHECK_EQ(0, strcmp("9007199254740994", buffer.begin()));
+  CHECK_EQ(16, point);
+}
+
+TEST_F(SchubfachDtoaTest, GayShortest) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  bool needed_max_length = false;
+
+  Vector<const PrecomputedShortest> precomputed =
+      PrecomputedShortestRepresentations();
+  for (int i = 0; i < precomputed.length(); ++i) {
+    const PrecomputedShortest current_test = precomputed[i];
+    SchubfachDtoa(current_test.v, buffer, &length, &point);
+    CHECK_GE(kSchubfachDtoaMaximalLength, length);
+    if (length == kSchubfachDtoaMaximalLength) needed_max_length = true;
+    CHECK_EQ(current_test.decimal_point, point);
+    CHECK_EQ(0, strcmp(current_test.representation, buffer.begin()));
+  }
+  CHECK(needed_max_length);
+}
+
+TEST_F(SchubfachDtoaTest, MatchesBignumDtoa) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  char expected_container[kBufferSize];
+  Vector<char> expected(expected_container, kBufferSize);
+  int length;
+  int point;
+  int expected_length;
+  int expected_point;
+
+  RandomNumberGenerator rng(1337);
+  for (int i = 0; i < 100000; ++i) {
+    uint64_t bits = static_cast<uint64_t>(rng.NextInt64()) &
+                    ~Double::kSignMask;
+    double v = Double(bits).value();
+    if (v == 0 || Double(v).IsSpecial()) continue;
+    SchubfachDtoa(v, buffer, &length, &point);
+    BignumDtoa(v, BIGNUM_DTOA_SHORTEST, 0, expected, &expected_length,
+               &expected_point);
+    expected[expected_length] = '\0';
+    CHECK_EQ(expected_length, length);
+    CHECK_EQ(expected_point, point);
+    CHECK_EQ(0, strcmp(expected.begin(), buffer.begin()));
+  }
+}
+
+}  // namespace test_schubfach_dtoa
+}  // namespace base
+}  // namespace v8
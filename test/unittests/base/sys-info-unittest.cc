@@ -12,6 +12,12 @@ TEST(SysInfoTest, NumberOfProcessors) {
   EXPECT_LT(0, SysInfo::NumberOfProcessors());
 }
 
+TEST(SysInfoTest, NumberOfAvailableProcessors) {
+  EXPECT_LT(0, SysInfo::NumberOfAvailableProcessors());
+  EXPECT_GE(SysInfo::NumberOfProcessors(),
+            SysInfo::NumberOfAvailableProcessors());
+}
+
 TEST(SysInfoTest, AmountOfPhysicalMemory) {
   EXPECT_LT(0, SysInfo::AmountOfPhysicalMemory());
 }
@@ -21,5 +27,10 @@ TEST(SysInfoTest, AmountOfVirtualMemory) {
   EXPECT_LE(0, SysInfo::AmountOfVirtualMemory());
 }
 
+TEST(SysInfoTest, AmountOfContainerMemory) {
+  EXPECT_LE(0, SysInfo::AmountOfContainerMemoryLimit());
+  EXPECT_LE(0, SysInfo::AmountOfContainerMemoryUsage());
+}
+
 }  // namespace base
 }  // namespace v8
@@ -569,6 +569,29 @@ TARGET_TEST_F(SchedulerTest, BranchHintFalse) {
 }
 
 
+TARGET_TEST_F(SchedulerTest, ThrowBlockDeferred) {
+  Node* start = graph()->NewNode(common()->Start(1));
+  graph()->SetStart(start);
+
+  Node* p0 = graph()->NewNode(common()->Parameter(0), start);
+  Node* br = graph()->NewNode(common()->Branch(), p0, start);
+  Node* t = graph()->NewNode(common()->IfTrue(), br);
+  Node* f = graph()->NewNode(common()->IfFalse(), br);
+  Node* thr = graph()->NewNode(common()->Throw(), start, t);
+  Node* zero = graph()->NewNode(common()->Int32Constant(0));
+  Node* ret = graph()->NewNode(common()->Return(), zero, p0, start, f);
+  Node* end = graph()->NewNode(common()->End(2), ret, thr);
+
+  graph()->SetEnd(end);
+
+  Schedule* schedule = ComputeAndVerifySchedule(9);
+  // Make sure the throwing block is deferred even though the branch has no
+  // hint.
+  EXPECT_TRUE(schedule->block(t)->deferred());
+  EXPECT_FALSE(schedule->block(f)->deferred());
+}
+
+
 TARGET_TEST_F(SchedulerTest, CallException) {
   Node* start = graph()->NewNode(common()->Start(1));
   graph()->SetStart(start);
@@ -43,8 +43,8 @@ class DateCacheMock : public DateCache {
     return rule == nullptr ? 0 : rule->offset_sec * 1000;
   }
 
-  int GetLocalOffsetFromOS(int64_t time_sec, bool is_utc) override {
-    return local_offset_ + GetDaylightSavingsOffsetFromOS(time_sec);
+  int GetLocalOffsetFromOS(int64_t time_ms, bool is_utc) override {
+    return local_offset_ + GetDaylightSavingsOffsetFromOS(time_ms / 1000);
   }
 
  private:
@@ -141,6 +141,34 @@ TEST_F(DateTest, DaylightSavingsTime) {
   CheckDST(august_20);
 }
 
+TEST_F(DateTest, LocalTimeToUTC) {
+  v8::HandleScope scope(isolate());
+  DateCacheMock::Rule rules[] = {
+      {0, 2, 0, 10, 0, 3600},  // DST from March to November in any year.
+  };
+
+  int local_offset_ms = 3600000;  // +1 hour.
+
+  DateCache* date_cache =
+      new DateCacheMock(local_offset_ms, rules, arraysize(rules));
+
+  reinterpret_cast<Isolate*>(isolate())->set_date_cache(date_cache);
+
+  // Check every hour of 2010 and 2011, in both directions.
+  int64_t start_of_2010 = TimeFromYearMonthDay(date_cache, 2010, 0, 1);
+  int64_t start_of_2012 = TimeFromYearMonthDay(date_cache, 2012, 0, 1);
+  for (int64_t time = start_of_2010; time < start_of_2012; time += 3600000) {
+    CHECK_EQ(time - date_cache->GetLocalOffsetFromOS(time, false),
+             date_cache->ToUTC(time));
+    CheckDST(time);
+  }
+  for (int64_t time = start_of_2012; time >= start_of_2010; time -= 3600000) {
+    CHECK_EQ(time - date_cache->GetLocalOffsetFromOS(time, false),
+             date_cache->ToUTC(time));
+    CheckDST(time);
+  }
+}
+
 namespace {
 int legacy_parse_count = 0;
 void DateParseLegacyCounterCallback(v8::Isolate* isolate,
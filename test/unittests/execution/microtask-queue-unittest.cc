@@ -192,6 +192,31 @@ TEST_P(MicrotaskQueueTest, BufferGrowth) {
   EXPECT_EQ(MicrotaskQueue::kMinimumCapacity + 2, count);
 }
 
+// The queue keeps track of the number of microtasks it ran and of its largest
+// size, both for microtasks enqueued from C++ and from builtins.
+TEST_P(MicrotaskQueueTest, Counters) {
+  EXPECT_EQ(0, microtask_queue()->finished_microtask_count());
+  EXPECT_EQ(0, microtask_queue()->size_high_water_mark());
+
+  for (int i = 0; i < 3; ++i) {
+    microtask_queue()->EnqueueMicrotask(*NewMicrotask([] {}));
+  }
+  EXPECT_EQ(3, microtask_queue()->size_high_water_mark());
+  EXPECT_EQ(3, microtask_queue()->RunMicrotasks(isolate()));
+  EXPECT_EQ(3, microtask_queue()->finished_microtask_count());
+  EXPECT_EQ(3, microtask_queue()->size_high_water_mark());
+
+  RunJS(
+      "for (let i = 0; i < 20; ++i) {"
+      "  Promise.resolve().then(() => {});"
+      "}");
+  EXPECT_EQ(20, microtask_queue()->size());
+  EXPECT_EQ(20, microtask_queue()->size_high_water_mark());
+  EXPECT_EQ(20, microtask_queue()->RunMicrotasks(isolate()));
+  EXPECT_EQ(23, microtask_queue()->finished_microtask_count());
+  EXPECT_EQ(20, microtask_queue()->size_high_water_mark());
+}
+
 // MicrotaskQueue instances form a doubly linked list.
 TEST_P(MicrotaskQueueTest, InstanceChain) {
   ClearTestMicrotaskQueue();
@@ -0,0 +1,84 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/shared-tiering-decisions.h"
+
+#include "src/api/api-inl.h"
+#include "src/base/platform/platform.h"
+#include "src/flags/flags.h"
+#include "src/objects/js-function-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+class SharedTieringDecisionsTest : public TestWithContext {
+ public:
+  SharedTieringDecisionsTest() { SharedTieringDecisions::ClearForTesting(); }
+  ~SharedTieringDecisionsTest() override {
+    SharedTieringDecisions::ClearForTesting();
+  }
+
+  // Scripts that only differ after the function compile to distinct
+  // SharedFunctionInfos with the same source text and position.
+  Handle<SharedFunctionInfo> CompileFunction(const char* suffix) {
+    std::string source =
+        std::string("(function f(a) { return a + 1; })") + suffix;
+    Handle<JSFunction> function = Handle<JSFunction>::cast(
+        Utils::OpenHandle(*RunJS(source.c_str())));
+    return handle(function->shared(), i_isolate());
+  }
+};
+
+TEST_F(SharedTieringDecisionsTest, DecisionCarriesOverToSameFunction) {
+  FlagScope<bool> flag_scope(&v8_flags.shared_tiering_decisions, true);
+  Handle<SharedFunctionInfo> first = CompileFunction("");
+  ASSERT_EQ(CachedTieringDecision::kPending, first->cached_tiering_decision());
+  EXPECT_FALSE(SharedTieringDecisions::Apply(*first));
+
+  SharedTieringDecisions::Record(*first, CachedTieringDecision::kEarlyMaglev);
+  Handle<SharedFunctionInfo> second = CompileFunction(" // second");
+  ASSERT_NE(*first, *second);
+  EXPECT_TRUE(SharedTieringDecisions::Apply(*second));
+  EXPECT_EQ(CachedTieringDecision::kEarlyMaglev,
+            second->cached_tiering_decision());
+
+  // A later kNormal decision, e.g. after a deopt, drops the entry again.
+  SharedTieringDecisions::Record(*first, CachedTieringDecision::kNormal);
+  Handle<SharedFunctionInfo> third = CompileFunction(" // third");
+  EXPECT_FALSE(SharedTieringDecisions::Apply(*third));
+  EXPECT_EQ(CachedTieringDecision::kPending, third->cached_tiering_decision());
+}
+
+TEST_F(SharedTieringDecisionsTest, DifferentSourceIsNotMatched) {
+  FlagScope<bool> flag_scope(&v8_flags.shared_tiering_decisions, true);
+  Handle<SharedFunctionInfo> first = CompileFunction("");
+  SharedTieringDecisions::Record(*first, CachedTieringDecision::kEarlyTurbofan);
+  Handle<JSFunction> other = Handle<JSFunction>::cast(
+      Utils::OpenHandle(*RunJS("(function f(a) { return a + 2; })")));
+  EXPECT_FALSE(SharedTieringDecisions::Apply(other->shared()));
+}
+
+TEST_F(SharedTieringDecisionsTest, DecisionsSurviveFileRoundTrip) {
+  FlagScope<bool> flag_scope(&v8_flags.shared_tiering_decisions, true);
+  const char* kFileName = "shared-tiering-decisions-unittest.tmp";
+  Handle<SharedFunctionInfo> first = CompileFunction("");
+  SharedTieringDecisions::Record(*first, CachedTieringDecision::kEarlyMaglev);
+  SharedTieringDecisions::StoreToFileForTesting(kFileName);
+
+  SharedTieringDecisions::ClearForTesting();
+  Handle<SharedFunctionInfo> second = CompileFunction(" // second");
+  EXPECT_FALSE(SharedTieringDecisions::Apply(*second));
+
+  SharedTieringDecisions::LoadFromFileForTesting(kFileName);
+  EXPECT_TRUE(SharedTieringDecisions::Apply(*second));
+  EXPECT_EQ(CachedTieringDecision::kEarlyMaglev,
+            second->cached_tiering_decision());
+  base::OS::Remove(kFileName);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -224,6 +224,40 @@ TEST_F(ThreadTerminationTest, TerminateOnlyV8ThreadFromOtherThread) {
       "try { loop(); fail(); } catch(e) { fail(); }");
 }
 
+// Test that an execution deadline terminates a loop that performs no calls,
+// without running finally blocks, and that the isolate can run code again.
+TEST_F(ThreadTerminationTest, ExecutionDeadline) {
+  HandleScope scope(isolate());
+  Local<ObjectTemplate> global =
+      CreateGlobalTemplate(isolate(), TerminateCurrentThread, DoLoop);
+  Local<Context> context = Context::New(isolate(), nullptr, global);
+  Context::Scope context_scope(context);
+  isolate()->SetExecutionDeadline(10);
+  MaybeLocal<Value> result =
+      TryRunJS("try { while (true) {} } finally { fail(); }");
+  CHECK(result.IsEmpty());
+  CHECK(!isolate()->IsExecutionTerminating());
+  isolate()->ClearExecutionDeadline();
+  result = TryRunJS("1 + 1");
+  CHECK(!result.IsEmpty());
+}
+
+// Test that a cleared execution deadline doesn't terminate execution.
+TEST_F(ThreadTerminationTest, ClearExecutionDeadline) {
+  HandleScope scope(isolate());
+  Local<ObjectTemplate> global =
+      CreateGlobalTemplate(isolate(), TerminateCurrentThread, DoLoop);
+  Local<Context> context = Context::New(isolate(), nullptr, global);
+  Context::Scope context_scope(context);
+  isolate()->SetExecutionDeadline(1);
+  isolate()->SetExecutionDeadline(60 * 1000);
+  isolate()->ClearExecutionDeadline();
+  MaybeLocal<Value> result = TryRunJS(
+      "var start = Date.now(); while (Date.now() - start < 50) {} 42");
+  CHECK(!result.IsEmpty());
+  CHECK(!isolate()->IsExecutionTerminating());
+}
+
 // Test that execution can be terminated from within JSON.stringify.
 TEST_F(ThreadTerminationTest, TerminateJsonStringify) {
   TestTerminatingFromCurrentThread(
@@ -176,5 +176,47 @@ TEST(AllocationObserverTest, RecursiveRemove) {
            10 /* aligned_object_size */ + 50 /* smallest step size */);
 }
 
+namespace {
+class LazyVerifyStepObserver : public VerifyStepObserver {
+ public:
+  explicit LazyVerifyStepObserver(size_t step_size)
+      : VerifyStepObserver(step_size) {}
+
+  bool IsLazy() const override { return true; }
+};
+}  // namespace
+
+TEST(AllocationObserverTest, LazyStep) {
+  AllocationCounter counter;
+  const Address kSomeObjectAddress = 8;
+
+  LazyVerifyStepObserver lazy100(100);
+  VerifyStepObserver precise1000(1000);
+
+  counter.AddAllocationObserver(&lazy100);
+  counter.AddAllocationObserver(&precise1000);
+  CHECK_EQ(counter.NextBytes(), 100);
+  CHECK_EQ(counter.NextPreciseBytes(), 1000);
+
+  // Lazy observers may be advanced past their step.
+  counter.AdvanceAllocationObservers(150);
+  CHECK_EQ(counter.NextBytes(), 0);
+  CHECK_EQ(counter.NextPreciseBytes(), 850);
+
+  lazy100.Expect(150, 10);
+  precise1000.ExpectNoInvocation();
+  counter.InvokeAllocationObservers(kSomeObjectAddress, 10, 10);
+  CHECK_EQ(lazy100.Invocations(), 1);
+
+  // The 50 bytes allocated past the step are taken off the next step.
+  CHECK_EQ(counter.NextBytes(), 10 /* aligned_object_size */ + 50);
+  CHECK_EQ(counter.NextPreciseBytes(), 850);
+
+  counter.RemoveAllocationObserver(&precise1000);
+  CHECK_EQ(counter.NextPreciseBytes(), SIZE_MAX);
+  counter.RemoveAllocationObserver(&lazy100);
+  CHECK_EQ(SIZE_MAX, counter.NextBytes());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -16,6 +16,7 @@
 #include "include/v8-cppgc.h"
 #include "include/v8-local-handle.h"
 #include "include/v8-object.h"
+#include "include/v8-template.h"
 #include "include/v8-traced-handle.h"
 #include "src/api/api-inl.h"
 #include "src/common/globals.h"
@@ -202,6 +203,49 @@ TEST_F(UnifiedHeapDetachedTest, StandaloneTestingHeap) {
   heap.FinalizeGarbageCollection(cppgc::EmbedderStackState::kNoHeapPointers);
 }
 
+TEST_F(UnifiedHeapDetachedTest, CompactWrapper) {
+  constexpr int kWrappableIndex = 0;
+  auto heap = v8::CppHeap::Create(
+      V8::GetCurrentPlatform(),
+      CppHeapCreateParams{
+          {},
+          WrapperDescriptor(kWrappableIndex, kWrappableIndex,
+                            WrapperHelper::kTracedEmbedderId)});
+  ASSERT_TRUE(heap->wrapper_descriptor().IsCompact());
+  auto& js_heap = *isolate()->heap();
+  js_heap.AttachCppHeap(heap.get());
+  auto& cpp_heap = *CppHeap::From(js_heap.cpp_heap());
+
+  v8::HandleScope scope(v8_isolate());
+  v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
+  v8::Context::Scope context_scope(context);
+  v8::Local<v8::ObjectTemplate> tmpl = v8::ObjectTemplate::New(v8_isolate());
+  tmpl->SetInternalFieldCount(1);
+  v8::Local<v8::Object> api_object =
+      tmpl->NewInstance(context).ToLocalChecked();
+  auto* object =
+      cppgc::MakeGarbageCollected<Wrappable>(heap->GetAllocationHandle());
+  cppgc::WeakPersistent<Wrappable> weak_holder{object};
+  api_object->SetAlignedPointerInInternalField(kWrappableIndex, object);
+
+  EmbedderStackStateScope stack_scope(
+      &js_heap, EmbedderStackStateScope::kExplicitInvocation,
+      StackState::kNoHeapPointers);
+  {
+    // The single internal field keeps the wrappable alive.
+    InvokeMajorGC();
+    cpp_heap.AsBase().sweeper().FinishIfRunning();
+    EXPECT_TRUE(weak_holder);
+  }
+  api_object->SetAlignedPointerInInternalField(kWrappableIndex, nullptr);
+  {
+    InvokeMajorGC();
+    cpp_heap.AsBase().sweeper().FinishIfRunning();
+    EXPECT_FALSE(weak_holder);
+  }
+  js_heap.DetachCppHeap();
+}
+
 }  // namespace v8::internal
 
 namespace cppgc {
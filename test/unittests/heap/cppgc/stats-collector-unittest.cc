@@ -57,6 +57,30 @@ TEST_F(StatsCollectorTest, EventPrevGCMarkedObjectSize) {
   EXPECT_EQ(1024u, event.marked_bytes);
 }
 
+TEST_F(StatsCollectorTest, CollectionTotalsAreKeptPerCollectionType) {
+  FakeAllocate(kMinReportedSize);
+  stats.NotifyMarkingStarted(CollectionType::kMinor,
+                             GCConfig::MarkingType::kAtomic,
+                             GCConfig::IsForcedGC::kNotForced);
+  stats.NotifyMarkingCompleted(kNoMarkedBytes);
+  stats.NotifySweepingCompleted(GCConfig::SweepingType::kAtomic);
+  {
+    const auto& minor = stats.GetCollectionTotals(CollectionType::kMinor);
+    EXPECT_EQ(1u, minor.cycles);
+    EXPECT_EQ(kMinReportedSize, minor.freed_object_bytes);
+    const auto& major = stats.GetCollectionTotals(CollectionType::kMajor);
+    EXPECT_EQ(0u, major.cycles);
+    EXPECT_EQ(0u, major.freed_object_bytes);
+  }
+  stats.NotifyMarkingStarted(CollectionType::kMajor,
+                             GCConfig::MarkingType::kAtomic,
+                             GCConfig::IsForcedGC::kNotForced);
+  stats.NotifyMarkingCompleted(kNoMarkedBytes);
+  stats.NotifySweepingCompleted(GCConfig::SweepingType::kAtomic);
+  EXPECT_EQ(1u, stats.GetCollectionTotals(CollectionType::kMinor).cycles);
+  EXPECT_EQ(1u, stats.GetCollectionTotals(CollectionType::kMajor).cycles);
+}
+
 TEST_F(StatsCollectorTest, AllocationNoReportBelowAllocationThresholdBytes) {
   constexpr size_t kObjectSize = 17;
   EXPECT_LT(kObjectSize, StatsCollector::kAllocationThresholdBytes);
@@ -6,7 +6,10 @@
 
 #include <cmath>
 #include <limits>
+#include <memory>
+#include <vector>
 
+#include "include/v8-metrics.h"
 #include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
@@ -597,4 +600,45 @@ TEST_F(GCTracerTest, RecordScavengerHistograms) {
   GcHistogram::CleanUp();
 }
 
+namespace {
+
+class YoungCycleRecorder : public v8::metrics::Recorder {
+ public:
+  void AddMainThreadEvent(const v8::metrics::GarbageCollectionYoungCycle& event,
+                          ContextId) override {
+    events_.push_back(event);
+  }
+
+  std::vector<v8::metrics::GarbageCollectionYoungCycle> events_;
+};
+
+}  // namespace
+
+TEST_F(GCTracerTest, ReportScavengerPhasesToRecorder) {
+  if (v8_flags.stress_incremental_marking) return;
+  auto recorder = std::make_shared<YoungCycleRecorder>();
+  isolate()->SetMetricsRecorder(recorder);
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+  StartTracing(tracer, GarbageCollector::SCAVENGER, StartTracingMode::kAtomic);
+  tracer->current_.scopes[GCTracer::Scope::SCAVENGER_SCAVENGE_ROOTS] =
+      base::TimeDelta::FromMilliseconds(1);
+  tracer->current_.scopes[GCTracer::Scope::SCAVENGER_SCAVENGE_PARALLEL_PHASE] =
+      base::TimeDelta::FromMilliseconds(2);
+  tracer->current_.scopes
+      [GCTracer::Scope::SCAVENGER_SCAVENGE_WEAK_GLOBAL_HANDLES_PROCESS] =
+      base::TimeDelta::FromMilliseconds(3);
+  tracer->current_.scopes[GCTracer::Scope::SCAVENGER_SCAVENGE_UPDATE_REFS] =
+      base::TimeDelta::FromMilliseconds(4);
+  StopTracing(tracer, GarbageCollector::SCAVENGER);
+  ASSERT_EQ(1u, recorder->events_.size());
+  const v8::metrics::GarbageCollectionYoungPhases& phases =
+      recorder->events_[0].main_thread_phases;
+  EXPECT_EQ(1000, phases.roots_wall_clock_duration_in_us);
+  EXPECT_EQ(2000, phases.copy_or_mark_wall_clock_duration_in_us);
+  EXPECT_EQ(3000, phases.weak_wall_clock_duration_in_us);
+  EXPECT_EQ(4000, phases.update_references_wall_clock_duration_in_us);
+  EXPECT_EQ(-1, phases.sweep_wall_clock_duration_in_us);
+}
+
 }  // namespace v8::internal
@@ -299,6 +299,55 @@ TEST_F(GlobalHandlesTest, PhantomHandlesWithoutCallbacks) {
   CHECK(g2.IsEmpty());
 }
 
+namespace {
+
+size_t reset_weak_callbacks = 0;
+
+void ResetAndCountWeakCallback(
+    const v8::WeakCallbackInfo<v8::Global<v8::Object>>& data) {
+  data.GetParameter()->Reset();
+  ++reset_weak_callbacks;
+}
+
+}  // namespace
+
+TEST_F(GlobalHandlesTest, ManyPhantomHandles) {
+  // Enough handles for weak nodes to be filtered on background threads.
+  constexpr size_t kHandles = 64 * 1024;
+  v8::Isolate* isolate = v8_isolate();
+  DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      i_isolate()->heap());
+
+  std::vector<v8::Global<v8::Object>> weak(kHandles);
+  std::vector<v8::Global<v8::Object>> strong;
+  reset_weak_callbacks = 0;
+  {
+    v8::HandleScope scope(isolate);
+    for (size_t i = 0; i < kHandles; ++i) {
+      v8::Local<v8::Object> object = v8::Object::New(isolate);
+      weak[i].Reset(isolate, object);
+      if (i % 2 == 0) {
+        weak[i].SetWeak();
+      } else {
+        weak[i].SetWeak(&weak[i], &ResetAndCountWeakCallback,
+                        v8::WeakCallbackType::kParameter);
+      }
+      if (i % 3 == 0) strong.emplace_back(isolate, object);
+    }
+  }
+  InvokeMajorGC();
+  size_t expected_callbacks = 0;
+  for (size_t i = 0; i < kHandles; ++i) {
+    if (i % 3 == 0) {
+      CHECK(!weak[i].IsEmpty());
+      continue;
+    }
+    CHECK(weak[i].IsEmpty());
+    if (i % 2 == 1) ++expected_callbacks;
+  }
+  CHECK_EQ(expected_callbacks, reset_weak_callbacks);
+}
+
 TEST_F(GlobalHandlesTest, WeakHandleToUnmodifiedJSObjectDiesOnScavenge) {
   if (v8_flags.single_generation) return;
 
@@ -20,6 +20,7 @@
 #include "src/heap/spaces-inl.h"
 #include "src/heap/trusted-range.h"
 #include "src/objects/objects-inl.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/heap/heap-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -173,6 +174,22 @@ TEST_F(HeapTest, ExternalLimitStaysAboveDefaultForExplicitHandling) {
   EXPECT_GE(heap->external_memory_limit(), kExternalAllocationSoftLimit);
 }
 
+TEST_F(HeapTest, InstanceTypeStatsAtLastGC) {
+  FlagScope<bool> flag_scope(&v8_flags.track_gc_instance_type_stats, true);
+  HandleScope scope(i_isolate());
+  const int kLength = 1024;
+  Handle<FixedArray> array =
+      i_isolate()->factory()->NewFixedArray(kLength, AllocationType::kOld);
+  InvokeMajorGC();
+
+  HeapObjectStatistics stats;
+  EXPECT_TRUE(v8_isolate()->GetHeapObjectStatisticsAtLastGC(
+      &stats, static_cast<size_t>(FIXED_ARRAY_TYPE)));
+  EXPECT_STREQ("FIXED_ARRAY_TYPE", stats.object_type());
+  EXPECT_LE(1u, stats.object_count());
+  EXPECT_LE(static_cast<size_t>(array->Size()), stats.object_size());
+}
+
 #ifdef V8_COMPRESS_POINTERS
 TEST_F(HeapTest, HeapLayout) {
   // Produce some garbage.
@@ -243,6 +243,26 @@ class InnerPointerResolutionTest
       EXPECT_EQ(object.address, base_ptr);
   }
 
+  // Resolves inner pointers of all objects with the same visitor, backwards
+  // and then forwards, so that later lookups reuse objects found earlier.
+  void TestAllWithSharedVisitor() {
+    ConservativeStackVisitor visitor = ConservativeStackVisitor::ForTesting(
+        isolate(), GarbageCollector::MARK_COMPACTOR);
+    auto run_test = [this, &visitor](const ObjectRequest& object) {
+      for (int offset : {0, 1, object.size / 2, object.size - 1}) {
+        Address base_ptr = visitor.FindBasePtr(object.address + offset);
+        bool should_return_null =
+            !IsPageAlive(object.page_id) || object.type == ObjectRequest::FREE;
+        EXPECT_EQ(should_return_null ? kNullAddress : object.address,
+                  base_ptr);
+      }
+    };
+    for (auto it = objects_.rbegin(); it != objects_.rend(); ++it) {
+      run_test(*it);
+    }
+    for (const ObjectRequest& object : objects_) run_test(object);
+  }
+
   // This must be called with an address not contained in any created object.
   void RunTestOutside(Address ptr) {
     Address base_ptr = ResolveInnerPointer(ptr);
@@ -282,6 +302,26 @@ TEST_F(InnerPointerResolutionTest, EmptyPage) {
 
 // Tests with some objects laid out randomly.
 
+TEST_F(InnerPointerResolutionTest, SharedVisitor) {
+  if (v8_flags.enable_third_party_heap) return;
+  CreateObjectsInPage({
+      {16 * kTaggedSize},
+      {12 * kTaggedSize, ObjectRequest::REGULAR, ObjectRequest::MARKED},
+      {13 * kTaggedSize},
+      {1 * kTaggedSize, ObjectRequest::FREE},
+      {15 * kTaggedSize},
+      {2 * kTaggedSize, ObjectRequest::FREE},
+      {2 * kTaggedSize},
+      {128 * kTaggedSize, ObjectRequest::REGULAR, ObjectRequest::MARKED},
+      {10544 * kTaggedSize},
+  });
+  CreateObjectsInPage({
+      {32 * kTaggedSize},
+      {64 * kTaggedSize},
+  });
+  TestAllWithSharedVisitor();
+}
+
 TEST_F(InnerPointerResolutionTest, NothingMarked) {
   if (v8_flags.enable_third_party_heap) return;
   CreateObjectsInPage({
@@ -8,6 +8,7 @@
 #include "src/base/region-allocator.h"
 #include "src/execution/isolate.h"
 #include "src/heap/heap-inl.h"
+#include "src/heap/large-spaces.h"
 #include "src/heap/memory-allocator.h"
 #include "src/heap/spaces-inl.h"
 #include "src/utils/ostreams.h"
@@ -402,6 +403,48 @@ TEST_F(PoolTest, UnmapOnTeardown) {
   tracking_page_allocator()->CheckIsFree(page->address(), page_size);
 #endif  // V8_COMPRESS_POINTERS
 }
+
+TEST_F(PoolTest, ReuseLargePage) {
+  if (v8_flags.enable_third_party_heap) return;
+  MemoryAllocator::LargePagePool* large_page_pool =
+      allocator()->large_page_pool();
+  const size_t object_size = 256 * KB;
+  LargePage* page = allocator()->AllocateLargePage(
+      heap()->lo_space(), object_size, Executability::NOT_EXECUTABLE);
+  EXPECT_NE(nullptr, page);
+  const Address address = page->address();
+  const size_t page_size = page->size();
+
+  allocator()->Free(MemoryAllocator::FreeMode::kPool, page);
+  EXPECT_EQ(1, large_page_pool->NumberOfChunks());
+  EXPECT_EQ(page_size, large_page_pool->CommittedBufferedMemory());
+  tracking_page_allocator()->CheckPagePermissions(address, page_size,
+                                                  PageAllocator::kReadWrite);
+
+  // A slightly smaller object reuses the pooled chunk.
+  page = allocator()->AllocateLargePage(heap()->lo_space(),
+                                        object_size - 16 * KB,
+                                        Executability::NOT_EXECUTABLE);
+  EXPECT_NE(nullptr, page);
+  EXPECT_EQ(address, page->address());
+  EXPECT_GE(page_size, page->size());
+  EXPECT_EQ(0, large_page_pool->NumberOfChunks());
+  EXPECT_EQ(0u, large_page_pool->CommittedBufferedMemory());
+
+  // A much smaller object does not.
+  allocator()->Free(MemoryAllocator::FreeMode::kPool, page);
+  EXPECT_EQ(1, large_page_pool->NumberOfChunks());
+  LargePage* small_page = allocator()->AllocateLargePage(
+      heap()->lo_space(), object_size / 2, Executability::NOT_EXECUTABLE);
+  EXPECT_NE(nullptr, small_page);
+  EXPECT_NE(address, small_page->address());
+  EXPECT_EQ(1, large_page_pool->NumberOfChunks());
+
+  allocator()->Free(MemoryAllocator::FreeMode::kImmediately, small_page);
+  large_page_pool->ReleasePooledChunks();
+  EXPECT_EQ(0, large_page_pool->NumberOfChunks());
+  EXPECT_EQ(0u, large_page_pool->CommittedBufferedMemory());
+}
 #endif  // !V8_OS_FUCHSIA && !V8_ENABLE_SANDBOX
 
 }  // namespace internal
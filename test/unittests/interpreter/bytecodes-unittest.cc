@@ -319,6 +319,18 @@ TEST(Bytecodes, IsJumpIfToBoolean) {
 #undef TEST_BYTECODE
 }
 
+TEST(Bytecodes, DispatchLookaheadsAreExclusive) {
+#define TEST_BYTECODE(Name, ...)                                              \
+  EXPECT_FALSE(                                                               \
+      Bytecodes::IsStarLookahead(Bytecode::k##Name, OperandScale::kSingle) && \
+      Bytecodes::IsJumpIfLookahead(Bytecode::k##Name, OperandScale::kSingle)); \
+  EXPECT_FALSE(                                                               \
+      Bytecodes::IsJumpIfLookahead(Bytecode::k##Name, OperandScale::kDouble));
+
+  BYTECODE_LIST(TEST_BYTECODE)
+#undef TEST_BYTECODE
+}
+
 #undef OR_IS_BYTECODE
 #undef IN_BYTECODE_LIST
 
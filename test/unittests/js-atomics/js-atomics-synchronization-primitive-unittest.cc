@@ -140,6 +140,9 @@ TEST_F(JSAtomicsMutexTest, Contention) {
   ParkingThread::ParkedJoinAll(local_isolate, threads);
 
   EXPECT_FALSE(contended_mutex->IsHeld());
+  // The spin count adapts to contention but stays bounded.
+  EXPECT_LE(0, contended_mutex->spin_count_estimate());
+  EXPECT_GE(256, contended_mutex->spin_count_estimate());
 }
 
 TEST_F(JSAtomicsMutexTest, Timeout) {
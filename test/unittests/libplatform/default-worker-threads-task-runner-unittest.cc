@@ -114,6 +114,31 @@ TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskOrderMultipleWorkers) {
   ASSERT_EQ(1, std::count(order.begin(), order.end(), 5));
 }
 
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskFromWorkers) {
+  DefaultWorkerThreadsTaskRunner runner(4, RealTime);
+
+  // Every task posts two more tasks from the worker thread it runs on, which
+  // are queued locally and stolen by the other workers.
+  constexpr int kMaxDepth = 8;
+  constexpr int kTaskCount = (1 << (kMaxDepth + 1)) - 1;
+  std::atomic_int count{0};
+  base::Semaphore semaphore(0);
+  std::function<void(int)> spawn = [&](int depth) {
+    if (depth < kMaxDepth) {
+      for (int i = 0; i < 2; i++) {
+        runner.PostTask(
+            std::make_unique<TestTask>([&, depth] { spawn(depth + 1); }));
+      }
+    }
+    if (++count == kTaskCount) semaphore.Signal();
+  };
+  runner.PostTask(std::make_unique<TestTask>([&] { spawn(0); }));
+
+  semaphore.Wait();
+  runner.Terminate();
+  ASSERT_EQ(kTaskCount, count);
+}
+
 class FakeClock {
  public:
   static double time() { return time_.load(); }
@@ -156,6 +156,36 @@ TEST_F(RuntimeCallStatsTest, RuntimeCallTimer) {
   EXPECT_EQ(100, counter()->time().InMicroseconds());
 }
 
+TEST_F(RuntimeCallStatsTest, RuntimeCallTimerSampling) {
+  TracingFlags::runtime_stats.store(
+      v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING,
+      std::memory_order_relaxed);
+  RuntimeCallTimer timer;
+  RuntimeCallTimer timer2;
+
+  stats()->Enter(&timer, counter_id());
+  EXPECT_FALSE(timer.IsStarted());
+  EXPECT_EQ(&timer, stats()->current_timer());
+  EXPECT_EQ(counter(), stats()->current_counter());
+
+  stats()->Enter(&timer2, counter_id2());
+  EXPECT_EQ(&timer, timer2.parent());
+  EXPECT_EQ(&timer2, stats()->current_timer());
+  EXPECT_EQ(counter2(), stats()->current_counter());
+  Sleep(100);
+
+  stats()->Leave(&timer2);
+  EXPECT_EQ(counter(), stats()->current_counter());
+  stats()->Leave(&timer);
+  EXPECT_EQ(nullptr, stats()->current_timer());
+  EXPECT_EQ(nullptr, stats()->current_counter());
+
+  // The sampling mode only tracks the active counter.
+  EXPECT_EQ(0, counter()->count());
+  EXPECT_EQ(0, counter2()->count());
+  EXPECT_EQ(0, counter2()->time().InMicroseconds());
+}
+
 TEST_F(RuntimeCallStatsTest, RuntimeCallTimerSubTimer) {
   RuntimeCallTimer timer;
   RuntimeCallTimer timer2;
@@ -371,6 +371,25 @@ TEST_F(StrtodTest, Strtod) {
                       -1076));
 }
 
+TEST_F(StrtodTest, NineteenDigits) {
+  // Significands of up to 19 digits are handled without bignums. Check that
+  // exact halfway cases still round to even.
+  CHECK_EQ(9007199254740992.0, StrtodChar("9007199254740993", 0));
+  CHECK_EQ(9007199254740996.0, StrtodChar("9007199254740995", 0));
+  CHECK_EQ(4503599627370496.0, StrtodChar("45035996273704965", -1));
+  CHECK_EQ(4503599627370498.0, StrtodChar("45035996273704975", -1));
+  CHECK_EQ(4611686018427387904.0, StrtodChar("4611686018427388416", 0));
+  CHECK_EQ(4611686018427389952.0, StrtodChar("4611686018427389440", 0));
+
+  CHECK_EQ(1234567890123456789e-300,
+           StrtodChar("1234567890123456789", -300));
+  CHECK_EQ(1234567890123456789e100, StrtodChar("1234567890123456789", 100));
+  CHECK_EQ(9999999999999999999e289, StrtodChar("9999999999999999999", 289));
+  CHECK_EQ(V8_INFINITY, StrtodChar("9999999999999999999", 290));
+  CHECK_EQ(5e-324, StrtodChar("2470328229206232721", -342));
+  CHECK_EQ(0.0, StrtodChar("2470328229206232720", -342));
+}
+
 static int CompareBignumToDiyFp(const Bignum& bignum_digits,
                                 int bignum_exponent, DiyFp diy_fp) {
   Bignum bignum;
@@ -10,7 +10,7 @@
 #include "src/heap/heap.h"
 #include "src/heap/local-heap-inl.h"
 #include "src/heap/local-heap.h"
-#include "src/heap/parked-scope.h"
+#include "src/heap/parked-scope-inl.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -309,6 +309,69 @@ TEST_F(ConcurrentStringTest, InspectTwoByteExternalizing_ThinString) {
   thread->Join();
 }
 
+class ConcurrentInternalizationThread final : public ParkingThread {
+ public:
+  ConcurrentInternalizationThread(Isolate* isolate, int strings, int offset)
+      : ParkingThread(base::Thread::Options("ThreadWithLocalHeap")),
+        isolate_(isolate),
+        strings_(strings),
+        offset_(offset) {}
+
+  void Run() override {
+    LocalIsolate local_isolate(isolate_, ThreadKind::kBackground);
+    UnparkedScope unparked_scope(local_isolate.heap());
+
+    results_.resize(strings_);
+    for (int i = 0; i < strings_; i++) {
+      // Start at a different string on every thread, so that they insert
+      // some strings concurrently and look up others.
+      int index = (i + offset_) % strings_;
+      std::string name = "string" + std::to_string(index);
+      Handle<String> result = local_isolate.factory()->InternalizeString(
+          base::OneByteVector(name.c_str()));
+      results_[index] = local_isolate.heap()->NewPersistentHandle(result);
+    }
+    ph_ = local_isolate.heap()->DetachPersistentHandles();
+  }
+
+  Handle<String> result(int index) const { return results_[index]; }
+
+ private:
+  Isolate* isolate_;
+  int strings_;
+  int offset_;
+  std::vector<Handle<String>> results_;
+  std::unique_ptr<PersistentHandles> ph_;
+};
+
+// Internalize the same strings from several background threads, while the
+// string table grows.
+TEST_F(ConcurrentStringTest, ConcurrentInternalization) {
+  constexpr int kThreads = 4;
+  constexpr int kStrings = 10000;
+
+  std::vector<std::unique_ptr<ConcurrentInternalizationThread>> threads;
+  for (int i = 0; i < kThreads; i++) {
+    auto thread = std::make_unique<ConcurrentInternalizationThread>(
+        i_isolate(), kStrings, i * kStrings / kThreads / 2);
+    EXPECT_TRUE(thread->Start());
+    threads.push_back(std::move(thread));
+  }
+  ParkingThread::ParkedJoinAll(i_isolate()->main_thread_local_isolate(),
+                               threads);
+
+  HandleScope handle_scope(i_isolate());
+  for (int i = 0; i < kStrings; i++) {
+    std::string name = "string" + std::to_string(i);
+    Handle<String> expected = i_isolate()->factory()->InternalizeString(
+        base::OneByteVector(name.c_str()));
+    for (const auto& thread : threads) {
+      EXPECT_TRUE(IsInternalizedString(*thread->result(i)));
+      EXPECT_EQ(*expected, *thread->result(i));
+    }
+  }
+}
+
 }  // anonymous namespace
 
 }  // namespace internal
@@ -11,6 +11,7 @@
 #include "src/objects/objects-inl.h"
 #include "src/objects/objects.h"
 #include "src/objects/ordered-hash-table.h"
+#include "src/strings/string-hasher-inl.h"
 #include "src/third_party/siphash/halfsiphash.h"
 #include "src/utils/utils.h"
 #include "test/unittests/test-utils.h"
@@ -303,5 +304,52 @@ TEST_F(HashcodeTest, DefaultHashQuality) {
   TestIntegerHashQuality(DefaultHash);
 }
 
+TEST_F(HashcodeTest, StringHashIndependentOfRepresentation) {
+  // One-byte and two-byte strings with the same contents must have the same
+  // hash, for all lengths and in particular around the lengths at which the
+  // hashing strategy changes.
+  for (int length = 0; length < 100; length++) {
+    std::vector<uint8_t> one_byte;
+    std::vector<uint16_t> two_byte;
+    for (int i = 0; i < length; i++) {
+      uint8_t c = static_cast<uint8_t>('a' + (i * 7) % 26);
+      if (i % 5 == 4) c = 0xE9;
+      one_byte.push_back(c);
+      two_byte.push_back(c);
+    }
+    CHECK_EQ(StringHasher::HashSequentialString(one_byte.data(), length,
+                                                0x123456789ABCDEFU),
+             StringHasher::HashSequentialString(two_byte.data(), length,
+                                                0x123456789ABCDEFU));
+  }
+}
+
+TEST_F(HashcodeTest, StringHashQuality) {
+  constexpr int kSamplesLog2 = 16;
+  constexpr int kBucketsLog2 = 10;
+  for (const char* prefix : {"", "property", "a_rather_long_property_name_"}) {
+    int samples = 1 << kSamplesLog2;
+    int num_buckets = 1 << kBucketsLog2;
+    int mean = samples / num_buckets;
+    std::vector<int> buckets(num_buckets);
+    for (int i = 0; i < samples; i++) {
+      std::ostringstream name;
+      name << prefix << "_" << i;
+      std::string str = name.str();
+      uint32_t hash = Name::HashBits::decode(StringHasher::HashSequentialString(
+          str.c_str(), static_cast<int>(str.length()), 0x123456789ABCDEFU));
+      buckets[hash % num_buckets]++;
+    }
+    int sum_deviation = 0;
+    for (int bucket : buckets) {
+      int deviation = bucket - mean;
+      sum_deviation += deviation * deviation;
+    }
+    double variation_coefficient =
+        sqrt(sum_deviation * 1.0 / num_buckets) / mean;
+    CHECK_LT(variation_coefficient, 0.4);
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
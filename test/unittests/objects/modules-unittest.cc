@@ -2,6 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <string>
+#include <vector>
+
 #include "include/v8-function.h"
 #include "src/flags/flags.h"
 #include "test/unittests/test-utils.h"
@@ -1208,4 +1211,81 @@ TEST_F(ModuleTest, IsGraphAsyncTopLevelAwait) {
   cycle_two_module_global.Reset();
 }
 
+TEST_F(ModuleTest, CompileModuleGraph) {
+  HandleScope scope(isolate());
+  v8::TryCatch try_catch(isolate());
+
+  // A diamond plus enough leaves to keep several worker threads busy.
+  constexpr int kLeafCount = 32;
+  std::vector<std::string> specifiers;
+  std::vector<std::string> sources;
+  std::string main_source =
+      "import {a} from 'a.js';\n"
+      "import {b} from 'b.js';\n";
+  std::string sum = "a + b";
+  for (int i = 0; i < kLeafCount; ++i) {
+    std::string name = "leaf" + std::to_string(i);
+    main_source += "import {" + name + "} from '" + name + ".js';\n";
+    sum += " + " + name;
+    specifiers.push_back(name + ".js");
+    sources.push_back("export const " + name + " = " + std::to_string(i) +
+                      ";");
+  }
+  main_source += "Object.graphSum = " + sum + ";";
+  specifiers.insert(specifiers.begin(), {"main.js", "a.js", "b.js", "c.js"});
+  sources.insert(sources.begin(),
+                 {main_source,
+                  "import {c} from 'c.js'; export const a = c + 100;",
+                  "import {c} from 'c.js'; export const b = c + 1000;",
+                  "export const c = 10000;"});
+
+  std::vector<ScriptCompiler::ModuleGraphEntry> entries;
+  for (size_t i = 0; i < sources.size(); ++i) {
+    entries.push_back({NewString(specifiers[i].c_str()), sources[i].data(),
+                       sources[i].size()});
+  }
+  Local<Module> module =
+      ScriptCompiler::CompileModuleGraph(context(), {entries.data(),
+                                                     entries.size()})
+          .ToLocalChecked();
+  CHECK_EQ(Module::kInstantiated, module->GetStatus());
+
+  module->Evaluate(context()).ToLocalChecked();
+  CHECK_EQ(Module::kEvaluated, module->GetStatus());
+  Local<Value> result = RunJS("Object.graphSum");
+  CHECK(result->IsInt32());
+  // a + b + the leaves 0..kLeafCount-1.
+  CHECK_EQ(2 * 10000 + 100 + 1000 + kLeafCount * (kLeafCount - 1) / 2,
+           result->Int32Value(context()).FromJust());
+  CHECK(!try_catch.HasCaught());
+}
+
+TEST_F(ModuleTest, CompileModuleGraphFailures) {
+  HandleScope scope(isolate());
+
+  // Unresolvable import.
+  {
+    v8::TryCatch try_catch(isolate());
+    std::string source = "import 'missing.js';";
+    ScriptCompiler::ModuleGraphEntry entry = {NewString("main.js"),
+                                              source.data(), source.size()};
+    CHECK(ScriptCompiler::CompileModuleGraph(context(), {&entry, 1})
+              .IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+
+  // Syntax error in a dependency.
+  {
+    v8::TryCatch try_catch(isolate());
+    std::string main_source = "import 'dep.js';";
+    std::string dep_source = "export const = ;";
+    ScriptCompiler::ModuleGraphEntry entries[] = {
+        {NewString("main.js"), main_source.data(), main_source.size()},
+        {NewString("dep.js"), dep_source.data(), dep_source.size()}};
+    CHECK(ScriptCompiler::CompileModuleGraph(context(), {entries, 2})
+              .IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+}
+
 }  // anonymous namespace
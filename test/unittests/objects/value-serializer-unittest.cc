@@ -768,6 +768,46 @@ TEST_F(ValueSerializerTest, EncodeTwoByteStringUsesPadding) {
                          data.begin() + 2));
 }
 
+TEST_F(ValueSerializerTest, DecodeStringsInPlaceFromBackingStore) {
+  const std::vector<uint8_t> data = EncodeTest(
+      "['x'.repeat(2000), '\\u2028'.repeat(1000), 'short']");
+  std::shared_ptr<BackingStore> backing_store =
+      SharedArrayBuffer::NewBackingStore(isolate(), data.size());
+  memcpy(backing_store->Data(), data.data(), data.size());
+
+  Local<Context> context = deserialization_context();
+  Context::Scope scope(context);
+  Local<Value> result;
+  {
+    ValueDeserializer deserializer(
+        isolate(), static_cast<const uint8_t*>(backing_store->Data()),
+        data.size());
+    deserializer.SetDataBackingStore(backing_store);
+    ASSERT_TRUE(deserializer.ReadHeader(context).FromMaybe(false));
+    ASSERT_TRUE(deserializer.ReadValue(context).ToLocal(&result));
+  }
+  ASSERT_TRUE(result->IsArray());
+  Local<Object> array = result.As<Object>();
+  Local<String> one_byte =
+      array->Get(context, 0).ToLocalChecked().As<String>();
+  Local<String> two_byte =
+      array->Get(context, 1).ToLocalChecked().As<String>();
+  Local<String> short_string =
+      array->Get(context, 2).ToLocalChecked().As<String>();
+  EXPECT_TRUE(one_byte->IsExternalOneByte());
+  EXPECT_TRUE(two_byte->IsExternal());
+  EXPECT_FALSE(short_string->IsExternalOneByte());
+
+  // The strings keep the data alive on their own.
+  backing_store.reset();
+  CHECK(context->Global()
+            ->CreateDataProperty(context, StringFromUtf8("result"), result)
+            .FromMaybe(false));
+  ExpectScriptTrue("result[0] === 'x'.repeat(2000)");
+  ExpectScriptTrue("result[1] === '\\u2028'.repeat(1000)");
+  ExpectScriptTrue("result[2] === 'short'");
+}
+
 TEST_F(ValueSerializerTest, RoundTripDictionaryObject) {
   // Empty object.
   Local<Value> value = RoundTripTest("({})");
@@ -987,6 +1027,58 @@ TEST_F(ValueSerializerTest, RoundTripDictionaryObjectForTransitions) {
       ",{\"\xF0\x9F\x91\x8A\":5,\"\xF0\x9F\x91\x9B\":6}]");
 }
 
+TEST_F(ValueSerializerTest, RoundTripObjectsWithSharedShape) {
+  // Objects after the first one of a given map are written with a shape.
+  RoundTripJSON(
+      "[{\"a\":1,\"b\":\"x\",\"c\":null}"
+      ",{\"a\":2,\"b\":\"y\",\"c\":true}"
+      ",{\"a\":3.5,\"b\":\"z\",\"c\":false}"
+      ",{\"a\":4,\"b\":{},\"c\":0}"
+      ",{\"a\":5,\"b\":\"w\",\"c\":-1}]");
+  Local<Value> value = RoundTripTest(
+      "var o = {x: 1, y: 'a'};"
+      "[o, {x: 2, y: 'b'}, o, {x: 3n, y: undefined}]");
+  ASSERT_TRUE(value->IsArray());
+  ExpectScriptTrue("result[0] === result[2]");
+  ExpectScriptTrue("result[1].x === 2 && result[1].y === 'b'");
+  ExpectScriptTrue("result[3].x === 3n && result[3].y === undefined");
+  ExpectScriptTrue("Object.keys(result[3]).join() === 'x,y'");
+
+  // A shape makes repeated objects much smaller.
+  std::vector<uint8_t> one = EncodeTest("[{alpha: 1, beta: 2}]");
+  std::vector<uint8_t> many =
+      EncodeTest("Array.from({length: 100}, (_, i) => ({alpha: i, beta: i}))");
+  EXPECT_LT(many.size(), one.size() + 99 * 8);
+}
+
+TEST_F(ValueSerializerTest, DecodeObjectsWithShape) {
+  DecodeTestFutureVersions(
+      {0xFF, 0x10,              // Version 16
+       0x41, 0x02,              // Dense array, length 2
+       0x4F, 0x00, 0x02,        // Shaped object, new shape 0, 2 properties
+       0x22, 0x01, 0x61,        // "a"
+       0x22, 0x01, 0x62,        // "b"
+       0x49, 0x02, 0x49, 0x04,  // 1, 2
+       0x4F, 0x00,              // Shaped object, shape 0
+       0x49, 0x06, 0x22, 0x01, 0x63,  // 3, "c"
+       0x24, 0x00, 0x02},             // End dense array
+      [this](Local<Value> value) {
+        ExpectScriptTrue("result[0].a === 1 && result[0].b === 2");
+        ExpectScriptTrue("result[1].a === 3 && result[1].b === 'c'");
+        ExpectScriptTrue("Object.keys(result[1]).join() === 'a,b'");
+      });
+  // Reference to a shape that has not been defined.
+  InvalidDecodeTest({0xFF, 0x10, 0x4F, 0x01, 0x49, 0x02});
+  // Duplicate property names.
+  InvalidDecodeTest({0xFF, 0x10, 0x4F, 0x00, 0x02, 0x22, 0x01, 0x61, 0x22,
+                     0x01, 0x61, 0x49, 0x02, 0x49, 0x04});
+  // Non-string property name.
+  InvalidDecodeTest({0xFF, 0x10, 0x4F, 0x00, 0x01, 0x49, 0x02, 0x49, 0x04});
+  // Shapes did not exist before version 16.
+  InvalidDecodeTest({0xFF, 0x0F, 0x4F, 0x00, 0x01, 0x22, 0x01, 0x61, 0x49,
+                     0x02});
+}
+
 TEST_F(ValueSerializerTest, DecodeDictionaryObjectVersion0) {
   // Empty object.
   Local<Value> value = DecodeTestForVersion0({0x7B, 0x00});
@@ -19,6 +19,7 @@
 #include "src/init/v8.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -2365,6 +2366,63 @@ TEST_F(RegExpTestWithContext, RegExpInterruptReentrantExecution) {
   CHECK(IsNull(*result));
 }
 
+TEST_F(RegExpTest, BytecodeCache) {
+  RegExpBytecodeCache::ClearForTesting();
+  HandleScope scope(i_isolate());
+  Factory* factory = i_isolate()->factory();
+  Handle<String> pattern = factory->NewStringFromAsciiChecked("a(b|c)+d");
+  const RegExpFlags flags = RegExpFlag::kGlobal;
+  constexpr bool kIsOneByte = true;
+  constexpr uint32_t kBacktrackLimit = JSRegExp::kNoBacktrackLimit;
+
+  int register_count = -1;
+  CHECK(RegExpBytecodeCache::Lookup(i_isolate(), *pattern, flags, kIsOneByte,
+                                    kBacktrackLimit, &register_count)
+            .is_null());
+
+  Handle<ByteArray> bytecode = factory->NewByteArray(4);
+  for (int i = 0; i < bytecode->length(); i++) bytecode->set(i, i + 1);
+  RegExpBytecodeCache::Insert(*pattern, flags, kIsOneByte, kBacktrackLimit,
+                              *bytecode, 3);
+
+  Handle<ByteArray> cached =
+      RegExpBytecodeCache::Lookup(i_isolate(), *pattern, flags, kIsOneByte,
+                                  kBacktrackLimit, &register_count)
+          .ToHandleChecked();
+  CHECK_NE(*cached, *bytecode);
+  CHECK_EQ(bytecode->length(), cached->length());
+  for (int i = 0; i < bytecode->length(); i++) {
+    CHECK_EQ(bytecode->get(i), cached->get(i));
+  }
+  CHECK_EQ(3, register_count);
+
+  // Entries are specific to flags, subject encoding and backtrack limit.
+  CHECK(RegExpBytecodeCache::Lookup(i_isolate(), *pattern, RegExpFlags{},
+                                    kIsOneByte, kBacktrackLimit,
+                                    &register_count)
+            .is_null());
+  CHECK(RegExpBytecodeCache::Lookup(i_isolate(), *pattern, flags, !kIsOneByte,
+                                    kBacktrackLimit, &register_count)
+            .is_null());
+  CHECK(RegExpBytecodeCache::Lookup(i_isolate(), *pattern, flags, kIsOneByte,
+                                    100, &register_count)
+            .is_null());
+
+  CHECK(!RegExpBytecodeCache::HasTieredUp(*pattern, flags, kIsOneByte,
+                                          kBacktrackLimit));
+  RegExpBytecodeCache::RecordTierUp(*pattern, flags, kIsOneByte,
+                                    kBacktrackLimit);
+  CHECK(RegExpBytecodeCache::HasTieredUp(*pattern, flags, kIsOneByte,
+                                         kBacktrackLimit));
+  CHECK(!RegExpBytecodeCache::Lookup(i_isolate(), *pattern, flags, kIsOneByte,
+                                     kBacktrackLimit, &register_count)
+             .is_null());
+
+  RegExpBytecodeCache::ClearForTesting();
+  CHECK(!RegExpBytecodeCache::HasTieredUp(*pattern, flags, kIsOneByte,
+                                          kBacktrackLimit));
+}
+
 #undef CHECK_PARSE_ERROR
 #undef CHECK_SIMPLE
 #undef CHECK_MIN_MAX
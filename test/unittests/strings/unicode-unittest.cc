@@ -110,6 +110,30 @@ TEST(UnicodeTest, SurrogateOverrunsBuffer) {
   CHECK_EQ(output_utf16[0], 0x00);
 }
 
+TEST(UnicodeTest, AsciiRunsAroundNonAscii) {
+  // Place a non-ASCII sequence at every offset of ASCII runs long enough to
+  // exercise the vectorized and word-sized fast paths.
+  const std::vector<uint8_t> sequences[] = {
+      {0xC2, 0x80}, {0xE0, 0xA0, 0x80}, {0xF0, 0x90, 0x80, 0x80}, {0xFF}};
+  for (const auto& sequence : sequences) {
+    for (size_t prefix = 0; prefix < 40; prefix++) {
+      std::vector<uint8_t> bytes(prefix, 'a');
+      bytes.insert(bytes.end(), sequence.begin(), sequence.end());
+      bytes.insert(bytes.end(), 37, 'b');
+
+      std::vector<unibrow::uchar> expected;
+      DecodeNormally(bytes, &expected);
+      std::vector<unibrow::uchar> output_utf16;
+      DecodeUtf16(bytes, &output_utf16);
+
+      CHECK_EQ(output_utf16.size(), expected.size());
+      for (size_t i = 0; i < output_utf16.size(); ++i) {
+        CHECK_EQ(output_utf16[i], expected[i]);
+      }
+    }
+  }
+}
+
 TEST(UnicodeTest, IncrementalUTF8DecodingVsNonIncrementalUtf8Decoding) {
   // Unfortunately, V8 has two UTF-8 decoders. This test checks that they
   // produce the same result. This test was inspired by
@@ -5,6 +5,7 @@
 #include "src/zone/zone.h"
 
 #include "src/zone/accounting-allocator.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -25,5 +26,37 @@ TEST_F(ZoneTest, 8ByteAlignment) {
   }
 }
 
+TEST_F(ZoneTest, SegmentPoolReuse) {
+  FlagScope<size_t> pool_size(&v8_flags.zone_segment_pool_size, 1 * MB);
+  AccountingAllocator allocator;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(1 * KB);
+  }
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  size_t pooled = allocator.GetPooledMemoryUsage();
+  EXPECT_LT(0u, pooled);
+  size_t hits = allocator.GetSegmentPoolHits();
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(1 * KB);
+    EXPECT_EQ(hits + 1, allocator.GetSegmentPoolHits());
+    EXPECT_EQ(0u, allocator.GetPooledMemoryUsage());
+  }
+  EXPECT_EQ(pooled, allocator.GetPooledMemoryUsage());
+  allocator.ReleasePooledSegments();
+  EXPECT_EQ(0u, allocator.GetPooledMemoryUsage());
+}
+
+TEST_F(ZoneTest, SegmentPoolDisabled) {
+  FlagScope<size_t> pool_size(&v8_flags.zone_segment_pool_size, 0);
+  AccountingAllocator allocator;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    zone.Allocate<ZoneTestTag>(1 * KB);
+  }
+  EXPECT_EQ(0u, allocator.GetPooledMemoryUsage());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -44,6 +44,12 @@ parser.add_option(
     action="store_true",
     default=False,
     help="Skip pprof upload (relevant for Googlers only)")
+parser.add_option(
+    "--builtins-summary",
+    action="store_true",
+    default=False,
+    help="Print the samples of each recorded event (see --event, e.g. "
+    "'cycles,cache-misses,branch-misses') attributed to embedded builtins.")
 
 d8_options = optparse.OptionGroup(
     parser, "d8-forwarded Options",
@@ -243,6 +249,24 @@ log(f"RESULTS in '{options.perf_data_dir}'")
 BYTES_TO_MIB = 1 / 1024 / 1024
 print(f"{result.name:67}{(result.stat().st_size*BYTES_TO_MIB):10.2f}MiB")
 
+# ==============================================================================
+if options.builtins_summary:
+  log("BUILTINS SUMMARY")
+  # Embedded builtins are symbolized as Builtins_<name> from the binary, or
+  # as Builtin:<name> through the jitdump records when the embedded blob has
+  # been remapped into the code range.
+  cmd = [
+      "perf", "report", f"--input={result.absolute()}", "--stdio",
+      "--no-children", "--sort=sym"
+  ]
+  try:
+    report = subprocess.check_output(cmd).decode('utf-8')
+    for line in report.splitlines():
+      if line.startswith("#") or "Builtins_" in line or "Builtin:" in line:
+        print(line)
+  except subprocess.CalledProcessError:
+    print(shlex.join(cmd))
+
 # ==============================================================================
 if not shutil.which('gcertstatus') or options.skip_pprof:
   log("ANALYSIS")
@@ -223,7 +223,9 @@ INCOMPATIBLE_FLAGS_PER_BUILD_VARIABLE = {
                  INCOMPATIBLE_FLAGS_PER_VARIANT["jitless"],
     "verify_predictable": [
         "--parallel-compile-tasks-for-eager-toplevel",
-        "--parallel-compile-tasks-for-lazy", "--concurrent-recompilation",
+        "--parallel-compile-tasks-for-lazy",
+        "--parallel-compile-tasks-for-lazy-toplevel",
+        "--parallel-compile-tasks-for-toplevel", "--concurrent-recompilation",
         "--stress-concurrent-allocation", "--stress-concurrent-inlining"
     ],
     "dict_property_const_tracking": ["--stress-concurrent-inlining"],
@@ -241,6 +243,8 @@ INCOMPATIBLE_FLAGS_PER_EXTRA_FLAG = {
     ],
     "--parallel-compile-tasks-for-eager-toplevel": ["--predictable"],
     "--parallel-compile-tasks-for-lazy": ["--predictable"],
+    "--parallel-compile-tasks-for-lazy-toplevel": ["--predictable"],
+    "--parallel-compile-tasks-for-toplevel": ["--predictable"],
     "--gc-interval=*": ["--gc-interval=*"],
     "--optimize-for-size": ["--max-semi-space-size=*"],
     "--stress_concurrent_allocation":